@@ -4,6 +4,8 @@
 
 #include "../include/hipsolver_dispatcher.hpp"
 #include "../rocblascommon/program_options.hpp"
+#include <fstream>
+#include <sys/stat.h>
 
 using rocblas_int    = int;
 using rocblas_stride = ptrdiff_t;
@@ -32,10 +34,30 @@ Options:
 )HELP_STR";
 // clang-format on
 
-int main(int argc, char* argv[])
-try
+// options of a single benchmark case
+struct bench_options
 {
-    Arguments argus;
+    Arguments   argus;
+    std::string function;
+    std::string output;
+    std::string sweep;
+    std::string file;
+    std::string baseline;
+    std::string timing;
+    double      tolerance;
+    rocblas_int update_baseline;
+    char        precision;
+    rocblas_int device_id;
+};
+
+// parses a command line into opts; returns false if the help message was printed
+static bool parse_bench_options(int argc, char* argv[], bench_options& opts)
+{
+    Arguments&   argus     = opts.argus;
+    std::string& function  = opts.function;
+    std::string& output    = opts.output;
+    char&        precision = opts.precision;
+    rocblas_int& device_id = opts.device_id;
 
     // disable unit_check in client benchmark, it is only
     // used in gtest unit test
@@ -44,16 +66,21 @@ try
     // enable timing check,otherwise no performance data collected
     argus.timing = 1;
 
-    std::string function;
-    char        precision;
-    rocblas_int device_id;
-
     // take arguments and set default values
     // clang-format off
     options_description desc("rocsolver client command line options");
     desc.add_options()("help,h", "Produces this help message.")
 
         // test options
+        ("baseline",
+         value<std::string>(&opts.baseline)->default_value(""),
+            "Baseline of a performance regression run, given as a csv file or as a directory\n"
+            "                           holding one <arch>.csv file per GPU architecture, e.g. gfx90a.csv or sm_80.csv.\n"
+            "                           The median time of every run is compared with the baseline, a report is written\n"
+            "                           to standard error, and the client fails if any run regressed. Requires csv output.\n"
+            "                           Nothing is run if the baseline file does not exist.\n"
+            "                           ")
+
         ("batch_count",
          value<rocblas_int>(&argus.batch_count)->default_value(1),
             "Number of matrices or problem instances in the batch.\n"
@@ -65,6 +92,14 @@ try
             "Set the default device to be used for subsequent program runs.\n"
             "                           ")
 
+        ("device_verify",
+         value<rocblas_int>(&argus.device_verify)->default_value(0),
+            "Compute the error of verify on the device? 0 = No, 1 = Yes.\n"
+            "                           The residual of the results is computed with device BLAS kernels and only its norm\n"
+            "                           is copied back, instead of comparing with the CPU results. Only applicable to\n"
+            "                           getrf (square), potrf and syevd/heevd computing eigenvectors.\n"
+            "                           ")
+
         ("function,f",
          value<std::string>(&function)->default_value("getrf"),
             "The LAPACK function to test.\n"
@@ -77,6 +112,69 @@ try
             "                           Reported time will be the average.\n"
             "                           ")
 
+        ("timing",
+         value<std::string>(&opts.timing)->default_value("wall"),
+            "Timing of the calls inside the GPU timing loop.\n"
+            "                           Options are: wall, event.\n"
+            "                           wall measures the host wall time between synchronizations of the stream, and\n"
+            "                           event the device time between events recorded on the stream, which excludes the\n"
+            "                           synchronization latency and the host jitter. Concurrent runs are always timed\n"
+            "                           with the wall time. When the client is built with HIPSOLVER_BENCH_TRACE, the\n"
+            "                           kernel launches and memory copies per call are also reported.\n"
+            "                           ")
+
+        ("streams",
+         value<rocblas_int>(&argus.streams)->default_value(1),
+            "Number of streams for concurrent benchmarking.\n"
+            "                           With more than one stream or handle, max(streams, handles) independent problems\n"
+            "                           are submitted round-robin and the aggregate solves per second are reported.\n"
+            "                           Only applicable to getrf, potrf and syevd/heevd.\n"
+            "                           ")
+
+        ("handles",
+         value<rocblas_int>(&argus.handles)->default_value(1),
+            "Number of hipSOLVER handles for concurrent benchmarking.\n"
+            "                           ")
+
+        ("pinned",
+         value<rocblas_int>(&argus.pinned)->default_value(0),
+            "Allocate the host matrices in pinned memory? 0 = No, 1 = Yes.\n"
+            "                           Pinned (page-locked) memory speeds up the host-device copies and lets them\n"
+            "                           overlap with the computations.\n"
+            "                           ")
+
+        ("e2e",
+         value<rocblas_int>(&argus.e2e)->default_value(0),
+            "Time the host-device copies together with the computations? 0 = No, 1 = Yes.\n"
+            "                           Every timed call copies the input to the device, solves, and copies the results\n"
+            "                           back. With more than one stream, the copies of one problem overlap with the\n"
+            "                           computations of the others. Only applicable to getrf, potrf and syevd/heevd.\n"
+            "                           ")
+
+        ("sweep",
+         value<std::string>(&opts.sweep)->default_value(""),
+            "Size sweep of the form name=start:end:step, e.g. m=64:8192:x2.\n"
+            "                           The step is additive (16 or +16) or multiplicative (x2); name=v1,v2,... lists\n"
+            "                           the values explicitly. Multiple sweeps separated by ';' run their cartesian product.\n"
+            "                           All cases run in a single process with one hipSOLVER handle.\n"
+            "                           ")
+
+        ("file",
+         value<std::string>(&opts.file)->default_value(""),
+            "Test list to run in a single process with one hipSOLVER handle.\n"
+            "                           Every non-empty line that does not start with # holds the options of one case,\n"
+            "                           e.g. -f getrf -r d -m 1024 --batch_count 1. These options extend or override the\n"
+            "                           ones given on the command line.\n"
+            "                           ")
+
+        ("output",
+         value<std::string>(&output)->default_value("text"),
+            "Output format of the performance results. Options are: text, csv, json.\n"
+            "                           csv and json write one record per run to standard output, with the\n"
+            "                           min, median, p95, max and mean times of the hot calls, and GFLOP/s and\n"
+            "                           GB/s derived from the median time.\n"
+            "                           ")
+
         ("perf",
          value<rocblas_int>(&argus.perf)->default_value(0),
             "Ignore CPU timing results? 0 = No, 1 = Yes.\n"
@@ -171,11 +269,11 @@ try
         //     "                           Leading dimension of matrices W.\n"
         //     "                           ")
 
-        // ("ldx",
-        //  value<rocblas_int>(),
-        //     "Matrix size parameter.\n"
-        //     "                           Leading dimension of matrices X.\n"
-        //     "                           ")
+        ("ldx",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices X.\n"
+            "                           ")
 
         // ("ldy",
         //  value<rocblas_int>(),
@@ -287,6 +385,77 @@ try
             "                           Indicates how the right singular vectors are to be calculated and stored.\n"
             "                           ")
 
+        // gesvdj and syevj options
+        ("econ",
+         value<rocblas_int>()->default_value(0),
+            "0 = all singular vectors, 1 = economy size.\n"
+            "                           Indicates whether only the leading min(m, n) singular vectors are computed.\n"
+            "                           ")
+
+        ("max_sweeps",
+         value<rocblas_int>()->default_value(100),
+            "Maximum number of Jacobi sweeps.\n"
+            "                           ")
+
+        ("tolerance",
+         value<double>()->default_value(0),
+            "Convergence tolerance of the Jacobi iterations.\n"
+            "                           0 selects the machine precision.\n"
+            "                           ")
+
+        ("sort_eig",
+         value<rocblas_int>()->default_value(1),
+            "0 = unsorted, 1 = ascending order.\n"
+            "                           Indicates whether syevj sorts the computed eigenvalues.\n"
+            "                           ")
+
+        // syevdx/sygvdx options
+        ("range",
+         value<char>()->default_value('A'),
+            "A = all eigenvalues, V = eigenvalues in (vl, vu], I = the il-th through iu-th eigenvalues.\n"
+            "                           Indicates which eigenvalues, and eigenvectors if requested, are computed.\n"
+            "                           ")
+
+        ("vl",
+         value<double>(),
+            "Lower bound of the eigenvalue interval when range = V.\n"
+            "                           ")
+
+        ("vu",
+         value<double>(),
+            "Upper bound of the eigenvalue interval when range = V.\n"
+            "                           ")
+
+        ("il",
+         value<rocblas_int>(),
+            "Index of the smallest eigenvalue to compute when range = I.\n"
+            "                           Defaults to 1.\n"
+            "                           ")
+
+        ("iu",
+         value<rocblas_int>(),
+            "Index of the largest eigenvalue to compute when range = I.\n"
+            "                           Defaults to n.\n"
+            "                           ")
+
+        // getrf/potrf options
+        ("alg",
+         value<rocblas_int>()->default_value(0),
+            "0 = default algorithm, 1 = alternative algorithm.\n"
+            "                           Algorithm hint set with hipsolverSetAdvOptions. On AMD, 1 selects the unblocked algorithm.\n"
+            "                           ")
+
+        ("pivot",
+         value<rocblas_int>()->default_value(1),
+            "0 = no pivoting, 1 = partial pivoting.\n"
+            "                           Pivoting hint of getrf set with hipsolverSetAdvOptions. Results without pivoting are not verified.\n"
+            "                           ")
+
+        ("unblocked_size",
+         value<rocblas_int>()->default_value(0),
+            "Problems up to this size use the unblocked algorithm (AMD only).\n"
+            "                           ")
+
         // other options
         // ("direct",
         //  value<char>()->default_value('F'),
@@ -335,6 +504,17 @@ try
             "                           Indicates if a matrix should be transposed.\n"
             "                           ")
 
+        ("tolerance",
+         value<double>(&opts.tolerance)->default_value(0.1),
+            "Relative increase of the median time over the baseline that is reported as a regression.\n"
+            "                           A tolerance column in the baseline overrides it for its row.\n"
+            "                           ")
+
+        ("update_baseline",
+         value<rocblas_int>(&opts.update_baseline)->default_value(0),
+            "Write the results to the baseline instead of comparing with it? 0 = No, 1 = Yes.\n"
+            "                           ")
+
         ("uplo",
          value<char>()->default_value('U'),
             "U = upper, L = lower.\n"
@@ -350,20 +530,11 @@ try
     if(vm.count("help"))
     {
         std::cout << help_str << desc << std::endl;
-        return 0;
+        return false;
     }
 
     argus.populate(vm);
 
-    // set device ID
-    if(!argus.perf)
-    {
-        rocblas_int device_count = query_device_property();
-        if(device_count <= device_id)
-            throw std::invalid_argument("Invalid Device ID");
-    }
-    set_device(device_id);
-
     // catch invalid arguments
     argus.validate_precision("precision");
     argus.validate_operation("trans");
@@ -376,10 +547,274 @@ try
     // argus.validate_workmode("fast_alg");
     argus.validate_itype("itype");
     argus.validate_evect("jobz");
+    argus.validate_erange("range");
+    if(!hipsolver_bench_writer::is_valid(output))
+        throw std::invalid_argument("Invalid value for output");
+    if(!opts.baseline.empty() && output != "csv")
+        throw std::invalid_argument("A baseline requires csv output");
+    if(opts.tolerance < 0)
+        throw std::invalid_argument("Invalid value for tolerance");
+    if(opts.timing != "wall" && opts.timing != "event")
+        throw std::invalid_argument("Invalid value for timing");
+
+    return true;
+}
+
+// runs one benchmark case and writes its machine-readable results
+static void run_bench_case(const bench_options&      opts,
+                           Arguments&                argus,
+                           hipsolver_bench_writer&   writer,
+                           hipsolver_bench_baseline* baseline)
+{
+    hipsolver_bench_timer::mode() = (opts.timing == "event") ? hipsolver_bench_timer::event
+                                                              : hipsolver_bench_timer::wall;
+    hipsolver_bench_timer::totals() = hipsolver_bench_timer::totals_t();
 
     // select and dispatch function test/benchmark
-    hipsolver_dispatcher::invoke(function, precision, argus);
+    hipsolver_bench_samples().clear();
+    hipsolver_dispatcher::invoke(opts.function, opts.precision, argus);
+
+    // launches and copies per timed call, if they were counted
+    const hipsolver_bench_timer::totals_t& totals = hipsolver_bench_timer::totals();
+
+    double launches = -1, memcpys = -1;
+    if(hipsolver_bench_timer::tracing() && totals.calls)
+    {
+        launches = double(totals.launches) / totals.calls;
+        memcpys  = double(totals.memcpys) / totals.calls;
+        if(opts.output == "text")
+            std::cerr << "Per call: " << launches << " kernel launches, " << memcpys
+                      << " memcpys" << std::endl;
+    }
+
+    // write machine-readable results
+    if(opts.output != "text" && !hipsolver_bench_samples().empty())
+    {
+        hipsolver_bench_record record;
+        record.function  = opts.function;
+        record.precision = opts.precision;
+        record.iters     = argus.iters;
+        record.problems  = std::max(argus.streams, argus.handles);
+        record.timing    = totals.calls ? opts.timing : "wall";
+        record.launches  = launches;
+        record.memcpys   = memcpys;
+        record.stats     = hipsolver_bench_compute_stats(hipsolver_bench_samples());
+        hipsolver_bench_get_model(opts.function, opts.precision, argus, record.model);
+
+        writer.write(record);
+        if(baseline)
+            baseline->check(record);
+    }
+}
+
+// expands one sweep of the form name=start:end:step or name=v1,v2,...
+static std::vector<rocblas_int> parse_sweep_values(const std::string& name,
+                                                   const std::string& range)
+{
+    std::vector<rocblas_int> values;
+    std::istringstream       ss(range);
+    std::string              tok;
+
+    if(range.find(':') == std::string::npos)
+    {
+        while(std::getline(ss, tok, ','))
+            values.push_back(std::stoi(tok));
+    }
+    else
+    {
+        std::vector<std::string> parts;
+        while(std::getline(ss, tok, ':'))
+            parts.push_back(tok);
+        if(parts.size() < 2 || parts.size() > 3)
+            throw std::invalid_argument("Invalid range for sweep of " + name);
+
+        rocblas_int start = std::stoi(parts[0]);
+        rocblas_int end   = std::stoi(parts[1]);
+        std::string step  = parts.size() == 3 ? parts[2] : "1";
+
+        bool        mult = !step.empty() && step[0] == 'x';
+        rocblas_int inc  = std::stoi((mult || step[0] == '+') ? step.substr(1) : step);
+        if((mult && (inc < 2 || start < 1)) || (!mult && inc < 1))
+            throw std::invalid_argument("Invalid step for sweep of " + name);
+
+        for(int64_t v = start; v <= end; v = mult ? v * inc : v + inc)
+            values.push_back(rocblas_int(v));
+    }
+
+    if(values.empty())
+        throw std::invalid_argument("Empty sweep of " + name);
+    return values;
+}
+
+// runs the cartesian product of all the sweeps of a case
+static void run_bench_sweep(const bench_options&      opts,
+                            hipsolver_bench_writer&   writer,
+                            hipsolver_bench_baseline* baseline)
+{
+    std::vector<std::string>              names;
+    std::vector<std::vector<rocblas_int>> values;
+
+    std::istringstream ss(opts.sweep);
+    std::string        spec;
+    while(std::getline(ss, spec, ';'))
+    {
+        if(spec.find_first_not_of(' ') == std::string::npos)
+            continue;
+
+        size_t pos = spec.find('=');
+        if(pos == std::string::npos)
+            throw std::invalid_argument("Invalid value for sweep");
 
+        std::string name = spec.substr(0, pos);
+        name.erase(0, name.find_first_not_of(' '));
+        names.push_back(name);
+        values.push_back(parse_sweep_values(name, spec.substr(pos + 1)));
+    }
+
+    std::vector<size_t> idx(names.size(), 0);
+    while(true)
+    {
+        Arguments argus = opts.argus;
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            if(names[i] == "batch_count")
+                argus.batch_count = values[i][idx[i]];
+            else
+                argus.set<rocblas_int>(names[i], values[i][idx[i]]);
+        }
+        run_bench_case(opts, argus, writer, baseline);
+
+        // advance to the next point, the last sweep varying fastest
+        size_t i = names.size();
+        while(i > 0 && ++idx[i - 1] == values[i - 1].size())
+            idx[--i] = 0;
+        if(i == 0)
+            break;
+    }
+}
+
+// returns the baseline file of the current device: path itself, or the file of its
+// architecture if path is a directory
+static std::string bench_baseline_path(const std::string& path, int device_id)
+{
+    struct stat st;
+    if(stat(path.c_str(), &st) != 0 || !S_ISDIR(st.st_mode))
+        return path;
+
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device_id) != hipSuccess)
+        throw std::invalid_argument("Cannot query the architecture of the device");
+
+    // drop the target features, as in gfx90a:sramecc+:xnack-
+    std::string arch = props.gcnArchName;
+    arch             = arch.substr(0, arch.find(':'));
+    if(arch.empty())
+        arch = "sm_" + std::to_string(props.major) + std::to_string(props.minor);
+
+    return path + "/" + arch + ".csv";
+}
+
+int main(int argc, char* argv[])
+try
+{
+    bench_options opts;
+    if(!parse_bench_options(argc, argv, opts))
+        return 0;
+
+    // set device ID
+    if(!opts.argus.perf)
+    {
+        rocblas_int device_count = query_device_property();
+        if(device_count <= opts.device_id)
+            throw std::invalid_argument("Invalid Device ID");
+    }
+    set_device(opts.device_id);
+
+    // all cases share a single handle, and with it the handle's workspace
+    hipsolver_local_handle handle;
+    hipsolver_local_handle::set_shared(handle);
+
+    // the results are compared with the baseline, or replace it
+    std::string               baseline_path;
+    std::ofstream             baseline_file;
+    hipsolver_bench_baseline  baseline;
+    hipsolver_bench_baseline* check = nullptr;
+    if(!opts.baseline.empty())
+    {
+        baseline_path = bench_baseline_path(opts.baseline, opts.device_id);
+        if(opts.update_baseline)
+        {
+            baseline_file.open(baseline_path);
+            if(!baseline_file)
+                throw std::invalid_argument("Cannot write baseline " + baseline_path);
+        }
+        else
+        {
+            // an architecture without a recorded baseline has nothing to regress from
+            struct stat st;
+            if(stat(baseline_path.c_str(), &st) != 0)
+            {
+                std::cerr << "No baseline " << baseline_path
+                          << "; skipping the performance comparison. Record one with the "
+                             "hipsolver-perf-baseline target."
+                          << std::endl;
+                return 0;
+            }
+            baseline.load(baseline_path, opts.tolerance);
+            check = &baseline;
+        }
+    }
+
+    hipsolver_bench_writer writer(opts.output,
+                                  baseline_file.is_open() ? baseline_file : std::cout);
+
+    if(opts.file.empty())
+        run_bench_sweep(opts, writer, check);
+    else
+    {
+        std::ifstream list(opts.file);
+        if(!list)
+            throw std::invalid_argument("Cannot open file " + opts.file);
+
+        // the options of each case are appended to the command line, without --file
+        std::vector<std::string> base;
+        for(int i = 0; i < argc; i++)
+        {
+            if(std::string(argv[i]) == "--file")
+                i++;
+            else
+                base.push_back(argv[i]);
+        }
+
+        std::string line;
+        while(std::getline(list, line))
+        {
+            std::istringstream       ss(line);
+            std::vector<std::string> tokens = base;
+            std::string              tok;
+            while(ss >> tok)
+                tokens.push_back(tok);
+            if(tokens.size() == base.size() || tokens[base.size()][0] == '#')
+                continue;
+
+            std::vector<char*> case_argv;
+            for(auto& t : tokens)
+                case_argv.push_back(&t[0]);
+
+            bench_options case_opts;
+            if(parse_bench_options(int(case_argv.size()), case_argv.data(), case_opts))
+                run_bench_sweep(case_opts, writer, check);
+        }
+    }
+
+    hipsolver_local_handle::set_shared(nullptr);
+
+    if(check)
+    {
+        std::cerr << "Performance comparison with " << baseline_path << ":\n";
+        if(baseline.report(std::cerr) > 0)
+            return 1;
+    }
     return 0;
 }
 
@@ -0,0 +1,896 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "../include/hipsolver_fortran.hpp"
+#include "hipsolver.h"
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdio>
+#include <hip/hip_runtime_api.h>
+#include <string>
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+#include <rocblas.h>
+#include <rocsolver.h>
+#else
+#include <cusolverDn.h>
+#endif
+
+/*
+ * Host overhead of the hipSOLVER wrappers.
+ *
+ * Every benchmark calls a hipSOLVER function on a problem of order 1, where the time of a call is
+ * the time taken to enqueue it, and calls the backend function that it wraps in the same
+ * iteration. The wrapper_ns and backend_ns counters are the mean host time of the two calls, and
+ * overhead_ns is their difference: the cost added by hipSOLVER for the translation of the
+ * arguments, the exception guard, the bufferSize query of a call without a work array, and the
+ * setup of the backend workspace.
+ *
+ * Each function is called through the C API and through the Fortran interface of the clients,
+ * with a work array given by the caller ("user") and without one ("auto"); the bufferSize
+ * queries are compared with the workspace query of the backend.
+ *
+ * Example: ./hipsolver-overhead-bench --benchmark_filter=getrf
+ */
+
+// the device is synchronized, outside of the timed calls, after this many iterations, so that
+// the launch queue does not fill up
+constexpr int64_t overhead_sync_interval = 256;
+
+// the capacity of the work array, in elements; a problem of order 1 needs much less
+constexpr int overhead_work_capacity = 1 << 20;
+
+// the device arrays of the problems of order 1, shared by all the benchmarks
+struct overhead_problem
+{
+    hipsolverHandle_t handle = nullptr;
+    double*           A      = nullptr;
+    double*           B      = nullptr;
+    double*           tau    = nullptr;
+    double*           D      = nullptr;
+    double*           E      = nullptr;
+    double*           U      = nullptr;
+    double*           V      = nullptr;
+    double*           work   = nullptr;
+    int*              ipiv   = nullptr;
+    int*              info   = nullptr;
+};
+
+static overhead_problem problem;
+
+/******************** BACKEND ********************/
+// the workspace queries and the calls of the backend functions that the benchmarked functions
+// wrap, on the same problems
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+typedef rocblas_status overhead_status_t;
+
+inline bool overhead_backend_ok(rocblas_status status)
+{
+    return status == rocblas_status_success || status == rocblas_status_size_unchanged
+           || status == rocblas_status_size_increased;
+}
+
+// rocSOLVER takes its workspace from the handle, and its workspace query is a dry run of the
+// function between the start and the stop of a size query
+template <typename F>
+static rocblas_status overhead_query(F call)
+{
+    size_t         size;
+    rocblas_handle handle = (rocblas_handle)problem.handle;
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status = call(handle);
+    rocblas_stop_device_memory_size_query(handle, &size);
+    return status;
+}
+
+static rocblas_status overhead_getrf_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dgetrf(handle, 1, 1, nullptr, 1, nullptr, nullptr);
+    });
+}
+
+static rocblas_status overhead_getrf_backend()
+{
+    return rocsolver_dgetrf(
+        (rocblas_handle)problem.handle, 1, 1, problem.A, 1, problem.ipiv, problem.info);
+}
+
+static rocblas_status overhead_getrs_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dgetrs(handle,
+                                rocblas_operation_none,
+                                1,
+                                1,
+                                nullptr,
+                                1,
+                                nullptr,
+                                nullptr,
+                                1);
+    });
+}
+
+static rocblas_status overhead_getrs_backend()
+{
+    return rocsolver_dgetrs((rocblas_handle)problem.handle,
+                            rocblas_operation_none,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.ipiv,
+                            problem.B,
+                            1);
+}
+
+static rocblas_status overhead_potrf_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dpotrf(handle, rocblas_fill_lower, 1, nullptr, 1, nullptr);
+    });
+}
+
+static rocblas_status overhead_potrf_backend()
+{
+    return rocsolver_dpotrf(
+        (rocblas_handle)problem.handle, rocblas_fill_lower, 1, problem.A, 1, problem.info);
+}
+
+static rocblas_status overhead_potrs_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dpotrs(handle, rocblas_fill_lower, 1, 1, nullptr, 1, nullptr, 1);
+    });
+}
+
+static rocblas_status overhead_potrs_backend()
+{
+    return rocsolver_dpotrs(
+        (rocblas_handle)problem.handle, rocblas_fill_lower, 1, 1, problem.A, 1, problem.B, 1);
+}
+
+static rocblas_status overhead_geqrf_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dgeqrf(handle, 1, 1, nullptr, 1, nullptr);
+    });
+}
+
+static rocblas_status overhead_geqrf_backend()
+{
+    return rocsolver_dgeqrf((rocblas_handle)problem.handle, 1, 1, problem.A, 1, problem.tau);
+}
+
+static rocblas_status overhead_ormqr_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dormqr(handle,
+                                rocblas_side_left,
+                                rocblas_operation_none,
+                                1,
+                                1,
+                                1,
+                                nullptr,
+                                1,
+                                nullptr,
+                                nullptr,
+                                1);
+    });
+}
+
+static rocblas_status overhead_ormqr_backend()
+{
+    return rocsolver_dormqr((rocblas_handle)problem.handle,
+                            rocblas_side_left,
+                            rocblas_operation_none,
+                            1,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.tau,
+                            problem.B,
+                            1);
+}
+
+static rocblas_status overhead_syevd_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dsyevd(handle,
+                                rocblas_evect_original,
+                                rocblas_fill_lower,
+                                1,
+                                nullptr,
+                                1,
+                                nullptr,
+                                nullptr,
+                                nullptr);
+    });
+}
+
+static rocblas_status overhead_syevd_backend()
+{
+    return rocsolver_dsyevd((rocblas_handle)problem.handle,
+                            rocblas_evect_original,
+                            rocblas_fill_lower,
+                            1,
+                            problem.A,
+                            1,
+                            problem.D,
+                            problem.E,
+                            problem.info);
+}
+
+static rocblas_status overhead_gesvd_query()
+{
+    return overhead_query([](rocblas_handle handle) {
+        return rocsolver_dgesvd(handle,
+                                rocblas_svect_all,
+                                rocblas_svect_all,
+                                1,
+                                1,
+                                nullptr,
+                                1,
+                                nullptr,
+                                nullptr,
+                                1,
+                                nullptr,
+                                1,
+                                nullptr,
+                                rocblas_outofplace,
+                                nullptr);
+    });
+}
+
+static rocblas_status overhead_gesvd_backend()
+{
+    return rocsolver_dgesvd((rocblas_handle)problem.handle,
+                            rocblas_svect_all,
+                            rocblas_svect_all,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.D,
+                            problem.U,
+                            1,
+                            problem.V,
+                            1,
+                            problem.E,
+                            rocblas_outofplace,
+                            problem.info);
+}
+#else
+typedef cusolverStatus_t overhead_status_t;
+
+inline bool overhead_backend_ok(cusolverStatus_t status)
+{
+    return status == CUSOLVER_STATUS_SUCCESS;
+}
+
+// cuSOLVER takes its workspace from the caller, in the size given by its workspace query
+static int overhead_lwork;
+
+static cusolverStatus_t overhead_getrf_query()
+{
+    return cusolverDnDgetrf_bufferSize(
+        (cusolverDnHandle_t)problem.handle, 1, 1, problem.A, 1, &overhead_lwork);
+}
+
+static cusolverStatus_t overhead_getrf_backend()
+{
+    return cusolverDnDgetrf((cusolverDnHandle_t)problem.handle,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.work,
+                            problem.ipiv,
+                            problem.info);
+}
+
+// getrs and potrs take no workspace in cuSOLVER
+static cusolverStatus_t overhead_getrs_query()
+{
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+static cusolverStatus_t overhead_getrs_backend()
+{
+    return cusolverDnDgetrs((cusolverDnHandle_t)problem.handle,
+                            CUBLAS_OP_N,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.ipiv,
+                            problem.B,
+                            1,
+                            problem.info);
+}
+
+static cusolverStatus_t overhead_potrf_query()
+{
+    return cusolverDnDpotrf_bufferSize((cusolverDnHandle_t)problem.handle,
+                                       CUBLAS_FILL_MODE_LOWER,
+                                       1,
+                                       problem.A,
+                                       1,
+                                       &overhead_lwork);
+}
+
+static cusolverStatus_t overhead_potrf_backend()
+{
+    return cusolverDnDpotrf((cusolverDnHandle_t)problem.handle,
+                            CUBLAS_FILL_MODE_LOWER,
+                            1,
+                            problem.A,
+                            1,
+                            problem.work,
+                            overhead_lwork,
+                            problem.info);
+}
+
+static cusolverStatus_t overhead_potrs_query()
+{
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+static cusolverStatus_t overhead_potrs_backend()
+{
+    return cusolverDnDpotrs((cusolverDnHandle_t)problem.handle,
+                            CUBLAS_FILL_MODE_LOWER,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.B,
+                            1,
+                            problem.info);
+}
+
+static cusolverStatus_t overhead_geqrf_query()
+{
+    return cusolverDnDgeqrf_bufferSize(
+        (cusolverDnHandle_t)problem.handle, 1, 1, problem.A, 1, &overhead_lwork);
+}
+
+static cusolverStatus_t overhead_geqrf_backend()
+{
+    return cusolverDnDgeqrf((cusolverDnHandle_t)problem.handle,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.tau,
+                            problem.work,
+                            overhead_lwork,
+                            problem.info);
+}
+
+static cusolverStatus_t overhead_ormqr_query()
+{
+    return cusolverDnDormqr_bufferSize((cusolverDnHandle_t)problem.handle,
+                                       CUBLAS_SIDE_LEFT,
+                                       CUBLAS_OP_N,
+                                       1,
+                                       1,
+                                       1,
+                                       problem.A,
+                                       1,
+                                       problem.tau,
+                                       problem.B,
+                                       1,
+                                       &overhead_lwork);
+}
+
+static cusolverStatus_t overhead_ormqr_backend()
+{
+    return cusolverDnDormqr((cusolverDnHandle_t)problem.handle,
+                            CUBLAS_SIDE_LEFT,
+                            CUBLAS_OP_N,
+                            1,
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.tau,
+                            problem.B,
+                            1,
+                            problem.work,
+                            overhead_lwork,
+                            problem.info);
+}
+
+static cusolverStatus_t overhead_syevd_query()
+{
+    return cusolverDnDsyevd_bufferSize((cusolverDnHandle_t)problem.handle,
+                                       CUSOLVER_EIG_MODE_VECTOR,
+                                       CUBLAS_FILL_MODE_LOWER,
+                                       1,
+                                       problem.A,
+                                       1,
+                                       problem.D,
+                                       &overhead_lwork);
+}
+
+static cusolverStatus_t overhead_syevd_backend()
+{
+    return cusolverDnDsyevd((cusolverDnHandle_t)problem.handle,
+                            CUSOLVER_EIG_MODE_VECTOR,
+                            CUBLAS_FILL_MODE_LOWER,
+                            1,
+                            problem.A,
+                            1,
+                            problem.D,
+                            problem.work,
+                            overhead_lwork,
+                            problem.info);
+}
+
+static cusolverStatus_t overhead_gesvd_query()
+{
+    return cusolverDnDgesvd_bufferSize((cusolverDnHandle_t)problem.handle, 1, 1, &overhead_lwork);
+}
+
+static cusolverStatus_t overhead_gesvd_backend()
+{
+    return cusolverDnDgesvd((cusolverDnHandle_t)problem.handle,
+                            'A',
+                            'A',
+                            1,
+                            1,
+                            problem.A,
+                            1,
+                            problem.D,
+                            problem.U,
+                            1,
+                            problem.V,
+                            1,
+                            problem.work,
+                            overhead_lwork,
+                            problem.E,
+                            problem.info);
+}
+#endif
+
+/******************** TIMING ********************/
+// times wrapper against backend, which return a hipsolverStatus_t and a backend status
+template <typename W, typename B>
+static void overhead_register(const std::string& name, W wrapper, B backend)
+{
+    benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State& state) {
+        // the first calls grow the workspace and fill the caches of the wrapper and the backend
+        if(wrapper() != HIPSOLVER_STATUS_SUCCESS || !overhead_backend_ok(backend()))
+        {
+            state.SkipWithError("the first calls failed");
+            return;
+        }
+        (void)hipDeviceSynchronize();
+
+        using clock       = std::chrono::steady_clock;
+        double  wrapper_t = 0, backend_t = 0;
+        int64_t calls = 0;
+        for(auto _ : state)
+        {
+            clock::time_point t0 = clock::now();
+            benchmark::DoNotOptimize(wrapper());
+            clock::time_point t1 = clock::now();
+            benchmark::DoNotOptimize(backend());
+            clock::time_point t2 = clock::now();
+
+            wrapper_t += std::chrono::duration<double, std::nano>(t1 - t0).count();
+            backend_t += std::chrono::duration<double, std::nano>(t2 - t1).count();
+            if(++calls % overhead_sync_interval == 0)
+                (void)hipDeviceSynchronize();
+        }
+        (void)hipDeviceSynchronize();
+
+        state.counters["wrapper_ns"]
+            = benchmark::Counter(wrapper_t, benchmark::Counter::kAvgIterations);
+        state.counters["backend_ns"]
+            = benchmark::Counter(backend_t, benchmark::Counter::kAvgIterations);
+        state.counters["overhead_ns"]
+            = benchmark::Counter(wrapper_t - backend_t, benchmark::Counter::kAvgIterations);
+    });
+}
+
+/*! \brief Registers the benchmarks of a function: its bufferSize query against the workspace
+ *  query of the backend, and its call with and without a work array against the backend call,
+ *  through the C API and, if the Fortran interface of the clients has the function, Fortran.
+ *
+ *  bufferSize(fortran, lwork) and call(fortran, work, lwork) call the function.
+ */
+template <typename S, typename F>
+static void overhead_register_function(const std::string& name,
+                                       bool               has_fortran,
+                                       S                  bufferSize,
+                                       F                  call,
+                                       overhead_status_t (*backend_query)(),
+                                       overhead_status_t (*backend)())
+{
+    for(bool fortran : {false, true})
+    {
+        if(fortran && !has_fortran)
+            continue;
+
+        std::string api = fortran ? "/Fortran" : "/C";
+        int         lwork;
+        if(bufferSize(fortran, &lwork) != HIPSOLVER_STATUS_SUCCESS
+           || lwork > overhead_work_capacity)
+            continue;
+
+        overhead_register(
+            name + "_bufferSize" + api,
+            [=] {
+                int size;
+                return bufferSize(fortran, &size);
+            },
+            backend_query);
+        overhead_register(
+            name + api + "/user", [=] { return call(fortran, problem.work, lwork); }, backend);
+        overhead_register(
+            name + api + "/auto", [=] { return call(fortran, nullptr, 0); }, backend);
+    }
+}
+
+/******************** FUNCTIONS ********************/
+static void overhead_register_all()
+{
+    overhead_register_function(
+        "getrf",
+        true,
+        [](bool fortran, int* lwork) {
+            if(fortran)
+                return hipsolverDgetrf_bufferSizeFortran(problem.handle, 1, 1, problem.A, 1, lwork);
+            return hipsolverDgetrf_bufferSize(problem.handle, 1, 1, problem.A, 1, lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            if(fortran)
+                return hipsolverDgetrfFortran(
+                    problem.handle, 1, 1, problem.A, 1, work, lwork, problem.ipiv, problem.info);
+            return hipsolverDgetrf(
+                problem.handle, 1, 1, problem.A, 1, work, lwork, problem.ipiv, problem.info);
+        },
+        overhead_getrf_query,
+        overhead_getrf_backend);
+
+    overhead_register_function(
+        "getrs",
+        true,
+        [](bool fortran, int* lwork) {
+            if(fortran)
+                return hipsolverDgetrs_bufferSizeFortran(problem.handle,
+                                                         HIPSOLVER_OP_N,
+                                                         1,
+                                                         1,
+                                                         problem.A,
+                                                         1,
+                                                         problem.ipiv,
+                                                         problem.B,
+                                                         1,
+                                                         lwork);
+            return hipsolverDgetrs_bufferSize(problem.handle,
+                                              HIPSOLVER_OP_N,
+                                              1,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              problem.ipiv,
+                                              problem.B,
+                                              1,
+                                              lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            if(fortran)
+                return hipsolverDgetrsFortran(problem.handle,
+                                              HIPSOLVER_OP_N,
+                                              1,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              problem.ipiv,
+                                              problem.B,
+                                              1,
+                                              work,
+                                              lwork,
+                                              problem.info);
+            return hipsolverDgetrs(problem.handle,
+                                   HIPSOLVER_OP_N,
+                                   1,
+                                   1,
+                                   problem.A,
+                                   1,
+                                   problem.ipiv,
+                                   problem.B,
+                                   1,
+                                   work,
+                                   lwork,
+                                   problem.info);
+        },
+        overhead_getrs_query,
+        overhead_getrs_backend);
+
+    overhead_register_function(
+        "potrf",
+        true,
+        [](bool fortran, int* lwork) {
+            if(fortran)
+                return hipsolverDpotrf_bufferSizeFortran(
+                    problem.handle, HIPSOLVER_FILL_MODE_LOWER, 1, problem.A, 1, lwork);
+            return hipsolverDpotrf_bufferSize(
+                problem.handle, HIPSOLVER_FILL_MODE_LOWER, 1, problem.A, 1, lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            if(fortran)
+                return hipsolverDpotrfFortran(problem.handle,
+                                              HIPSOLVER_FILL_MODE_LOWER,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              work,
+                                              lwork,
+                                              problem.info);
+            return hipsolverDpotrf(problem.handle,
+                                   HIPSOLVER_FILL_MODE_LOWER,
+                                   1,
+                                   problem.A,
+                                   1,
+                                   work,
+                                   lwork,
+                                   problem.info);
+        },
+        overhead_potrf_query,
+        overhead_potrf_backend);
+
+    // the Fortran interface of the clients only has the batched potrs
+    overhead_register_function(
+        "potrs",
+        false,
+        [](bool fortran, int* lwork) {
+            return hipsolverDpotrs_bufferSize(
+                problem.handle, HIPSOLVER_FILL_MODE_LOWER, 1, 1, problem.A, 1, problem.B, 1, lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            return hipsolverDpotrs(problem.handle,
+                                   HIPSOLVER_FILL_MODE_LOWER,
+                                   1,
+                                   1,
+                                   problem.A,
+                                   1,
+                                   problem.B,
+                                   1,
+                                   work,
+                                   lwork,
+                                   problem.info);
+        },
+        overhead_potrs_query,
+        overhead_potrs_backend);
+
+    overhead_register_function(
+        "geqrf",
+        true,
+        [](bool fortran, int* lwork) {
+            if(fortran)
+                return hipsolverDgeqrf_bufferSizeFortran(problem.handle, 1, 1, problem.A, 1, lwork);
+            return hipsolverDgeqrf_bufferSize(problem.handle, 1, 1, problem.A, 1, lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            if(fortran)
+                return hipsolverDgeqrfFortran(
+                    problem.handle, 1, 1, problem.A, 1, problem.tau, work, lwork, problem.info);
+            return hipsolverDgeqrf(
+                problem.handle, 1, 1, problem.A, 1, problem.tau, work, lwork, problem.info);
+        },
+        overhead_geqrf_query,
+        overhead_geqrf_backend);
+
+    overhead_register_function(
+        "ormqr",
+        true,
+        [](bool fortran, int* lwork) {
+            if(fortran)
+                return hipsolverDormqr_bufferSizeFortran(problem.handle,
+                                                         HIPSOLVER_SIDE_LEFT,
+                                                         HIPSOLVER_OP_N,
+                                                         1,
+                                                         1,
+                                                         1,
+                                                         problem.A,
+                                                         1,
+                                                         problem.tau,
+                                                         problem.B,
+                                                         1,
+                                                         lwork);
+            return hipsolverDormqr_bufferSize(problem.handle,
+                                              HIPSOLVER_SIDE_LEFT,
+                                              HIPSOLVER_OP_N,
+                                              1,
+                                              1,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              problem.tau,
+                                              problem.B,
+                                              1,
+                                              lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            if(fortran)
+                return hipsolverDormqrFortran(problem.handle,
+                                              HIPSOLVER_SIDE_LEFT,
+                                              HIPSOLVER_OP_N,
+                                              1,
+                                              1,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              problem.tau,
+                                              problem.B,
+                                              1,
+                                              work,
+                                              lwork,
+                                              problem.info);
+            return hipsolverDormqr(problem.handle,
+                                   HIPSOLVER_SIDE_LEFT,
+                                   HIPSOLVER_OP_N,
+                                   1,
+                                   1,
+                                   1,
+                                   problem.A,
+                                   1,
+                                   problem.tau,
+                                   problem.B,
+                                   1,
+                                   work,
+                                   lwork,
+                                   problem.info);
+        },
+        overhead_ormqr_query,
+        overhead_ormqr_backend);
+
+    overhead_register_function(
+        "syevd",
+        true,
+        [](bool fortran, int* lwork) {
+            if(fortran)
+                return hipsolverDsyevd_bufferSizeFortran(problem.handle,
+                                                         HIPSOLVER_EIG_MODE_VECTOR,
+                                                         HIPSOLVER_FILL_MODE_LOWER,
+                                                         1,
+                                                         problem.A,
+                                                         1,
+                                                         problem.D,
+                                                         lwork);
+            return hipsolverDsyevd_bufferSize(problem.handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              HIPSOLVER_FILL_MODE_LOWER,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              problem.D,
+                                              lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            if(fortran)
+                return hipsolverDsyevdFortran(problem.handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              HIPSOLVER_FILL_MODE_LOWER,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              problem.D,
+                                              work,
+                                              lwork,
+                                              problem.info);
+            return hipsolverDsyevd(problem.handle,
+                                   HIPSOLVER_EIG_MODE_VECTOR,
+                                   HIPSOLVER_FILL_MODE_LOWER,
+                                   1,
+                                   problem.A,
+                                   1,
+                                   problem.D,
+                                   work,
+                                   lwork,
+                                   problem.info);
+        },
+        overhead_syevd_query,
+        overhead_syevd_backend);
+
+    overhead_register_function(
+        "gesvd",
+        true,
+        [](bool fortran, int* lwork) {
+            if(fortran)
+                return hipsolverDgesvd_bufferSizeFortran(problem.handle, 'A', 'A', 1, 1, lwork);
+            return hipsolverDgesvd_bufferSize(problem.handle, 'A', 'A', 1, 1, lwork);
+        },
+        [](bool fortran, double* work, int lwork) {
+            if(fortran)
+                return hipsolverDgesvdFortran(problem.handle,
+                                              'A',
+                                              'A',
+                                              1,
+                                              1,
+                                              problem.A,
+                                              1,
+                                              problem.D,
+                                              problem.U,
+                                              1,
+                                              problem.V,
+                                              1,
+                                              work,
+                                              lwork,
+                                              problem.E,
+                                              problem.info);
+            return hipsolverDgesvd(problem.handle,
+                                   'A',
+                                   'A',
+                                   1,
+                                   1,
+                                   problem.A,
+                                   1,
+                                   problem.D,
+                                   problem.U,
+                                   1,
+                                   problem.V,
+                                   1,
+                                   work,
+                                   lwork,
+                                   problem.E,
+                                   problem.info);
+        },
+        overhead_gesvd_query,
+        overhead_gesvd_backend);
+}
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    if(hipsolverCreate(&problem.handle) != HIPSOLVER_STATUS_SUCCESS)
+    {
+        fprintf(stderr, "hipsolverCreate failed\n");
+        return 1;
+    }
+
+    // A = 1, so that every factorization of the problems of order 1 succeeds
+    double one = 1;
+    bool   ok  = hipMalloc(&problem.A, sizeof(double)) == hipSuccess
+              && hipMalloc(&problem.B, sizeof(double)) == hipSuccess
+              && hipMalloc(&problem.tau, sizeof(double)) == hipSuccess
+              && hipMalloc(&problem.D, sizeof(double)) == hipSuccess
+              && hipMalloc(&problem.E, sizeof(double)) == hipSuccess
+              && hipMalloc(&problem.U, sizeof(double)) == hipSuccess
+              && hipMalloc(&problem.V, sizeof(double)) == hipSuccess
+              && hipMalloc(&problem.work, sizeof(double) * overhead_work_capacity) == hipSuccess
+              && hipMalloc(&problem.ipiv, sizeof(int)) == hipSuccess
+              && hipMalloc(&problem.info, sizeof(int)) == hipSuccess
+              && hipMemcpy(problem.A, &one, sizeof(double), hipMemcpyHostToDevice) == hipSuccess
+              && hipMemcpy(problem.B, &one, sizeof(double), hipMemcpyHostToDevice) == hipSuccess;
+    if(!ok)
+    {
+        fprintf(stderr, "the allocation of the device arrays failed\n");
+        return 1;
+    }
+
+    overhead_register_all();
+    benchmark::RunSpecifiedBenchmarks();
+
+    (void)hipFree(problem.A);
+    (void)hipFree(problem.B);
+    (void)hipFree(problem.tau);
+    (void)hipFree(problem.D);
+    (void)hipFree(problem.E);
+    (void)hipFree(problem.U);
+    (void)hipFree(problem.V);
+    (void)hipFree(problem.work);
+    (void)hipFree(problem.ipiv);
+    (void)hipFree(problem.info);
+    hipsolverDestroy(problem.handle);
+    return 0;
+}
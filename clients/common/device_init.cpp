@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************/
+
+#include "../rocblascommon/rocblas_init.hpp"
+
+#ifdef __HIP_PLATFORM_NVCC__
+#include <curand.h>
+#else
+#include <rocrand.h>
+#endif
+
+/*!\file
+ * \brief provide the device random generator used by the device-side initialization of the
+ * clients, it is only used for testing, not part of the GPU library
+ */
+
+#ifdef __HIP_PLATFORM_NVCC__
+
+/*************************************************************************/
+// cuRAND backend
+
+#define RAND_GENERATOR(rng) ((curandGenerator_t)(rng).get())
+
+static hipsolverStatus_t rand2hip_status(curandStatus_t status)
+{
+    return status == CURAND_STATUS_SUCCESS ? HIPSOLVER_STATUS_SUCCESS
+                                           : HIPSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+device_rand_generator::device_rand_generator(hipsolverHandle_t handle)
+    : m_gen(nullptr)
+    , m_stream(0)
+{
+    curandGenerator_t gen;
+    hipsolverGetStream(handle, &m_stream);
+    if(curandCreateGenerator(&gen, CURAND_RNG_PSEUDO_PHILOX4_32_10) == CURAND_STATUS_SUCCESS)
+    {
+        curandSetStream(gen, m_stream);
+        m_gen = gen;
+    }
+}
+
+device_rand_generator::~device_rand_generator()
+{
+    if(m_gen)
+        curandDestroyGenerator((curandGenerator_t)m_gen);
+}
+
+static hipsolverStatus_t rand_seed(const device_rand_generator& rng, unsigned long long seed)
+{
+    return rand2hip_status(curandSetPseudoRandomGeneratorSeed(RAND_GENERATOR(rng), seed));
+}
+
+static hipsolverStatus_t rand_uniform(const device_rand_generator& rng, float* x, size_t n)
+{
+    return rand2hip_status(curandGenerateUniform(RAND_GENERATOR(rng), x, n));
+}
+
+static hipsolverStatus_t rand_uniform(const device_rand_generator& rng, double* x, size_t n)
+{
+    return rand2hip_status(curandGenerateUniformDouble(RAND_GENERATOR(rng), x, n));
+}
+
+#else
+
+/*************************************************************************/
+// rocRAND backend
+
+#define RAND_GENERATOR(rng) ((rocrand_generator)(rng).get())
+
+static hipsolverStatus_t rand2hip_status(rocrand_status status)
+{
+    return status == ROCRAND_STATUS_SUCCESS ? HIPSOLVER_STATUS_SUCCESS
+                                            : HIPSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+device_rand_generator::device_rand_generator(hipsolverHandle_t handle)
+    : m_gen(nullptr)
+    , m_stream(0)
+{
+    rocrand_generator gen;
+    hipsolverGetStream(handle, &m_stream);
+    if(rocrand_create_generator(&gen, ROCRAND_RNG_PSEUDO_PHILOX4_32_10) == ROCRAND_STATUS_SUCCESS)
+    {
+        rocrand_set_stream(gen, m_stream);
+        m_gen = gen;
+    }
+}
+
+device_rand_generator::~device_rand_generator()
+{
+    if(m_gen)
+        rocrand_destroy_generator((rocrand_generator)m_gen);
+}
+
+static hipsolverStatus_t rand_seed(const device_rand_generator& rng, unsigned long long seed)
+{
+    return rand2hip_status(rocrand_set_seed(RAND_GENERATOR(rng), seed));
+}
+
+static hipsolverStatus_t rand_uniform(const device_rand_generator& rng, float* x, size_t n)
+{
+    return rand2hip_status(rocrand_generate_uniform(RAND_GENERATOR(rng), x, n));
+}
+
+static hipsolverStatus_t rand_uniform(const device_rand_generator& rng, double* x, size_t n)
+{
+    return rand2hip_status(rocrand_generate_uniform_double(RAND_GENERATOR(rng), x, n));
+}
+
+#endif
+
+/*************************************************************************/
+// complex values are generated as pairs of real values
+
+template <typename T>
+hipsolverStatus_t rocblas_init_device(const device_rand_generator& rng,
+                                      T*                           A,
+                                      size_t                       M,
+                                      size_t                       N,
+                                      size_t                       lda,
+                                      size_t                       stride,
+                                      size_t                       batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    if(!rng.get())
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(M == 0 || N == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // the whole extent of the batch is generated at once, including the padding
+    size_t            size   = (batch_count - 1) * stride + (N - 1) * lda + M;
+    hipsolverStatus_t status = rand_seed(rng, hipsolver_rng());
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    return rand_uniform(rng, (S*)A, size * (sizeof(T) / sizeof(S)));
+}
+
+#define INSTANTIATE_DEVICE_INIT(T)                                                  \
+    template hipsolverStatus_t rocblas_init_device<T>(const device_rand_generator&, \
+                                                      T*,                           \
+                                                      size_t,                       \
+                                                      size_t,                       \
+                                                      size_t,                       \
+                                                      size_t,                       \
+                                                      size_t);
+
+INSTANTIATE_DEVICE_INIT(float)
+INSTANTIATE_DEVICE_INIT(double)
+INSTANTIATE_DEVICE_INIT(hipsolverComplex)
+INSTANTIATE_DEVICE_INIT(hipsolverDoubleComplex)
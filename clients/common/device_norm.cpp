@@ -0,0 +1,957 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************/
+
+#include "../include/device_norm.hpp"
+
+#ifdef __HIP_PLATFORM_NVCC__
+#include <cublas_v2.h>
+#else
+#include <rocblas.h>
+#endif
+
+/*!\file
+ * \brief provide template functions interfaces to the device BLAS used by the device-side
+ * verification of the clients, it is only used for testing, not part of the GPU library
+ */
+
+#ifdef __HIP_PLATFORM_NVCC__
+
+/*************************************************************************/
+// cuBLAS backend
+
+#define BLAS_HANDLE(blas) ((cublasHandle_t)(blas).get())
+
+static hipsolverStatus_t blas2hip_status(cublasStatus_t status)
+{
+    return status == CUBLAS_STATUS_SUCCESS ? HIPSOLVER_STATUS_SUCCESS
+                                           : HIPSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+static cublasOperation_t hip2blas_operation(hipsolverOperation_t op)
+{
+    return op == HIPSOLVER_OP_N ? CUBLAS_OP_N : (op == HIPSOLVER_OP_T ? CUBLAS_OP_T : CUBLAS_OP_C);
+}
+
+static cublasFillMode_t hip2blas_fill(hipsolverFillMode_t fill)
+{
+    return fill == HIPSOLVER_FILL_MODE_UPPER ? CUBLAS_FILL_MODE_UPPER : CUBLAS_FILL_MODE_LOWER;
+}
+
+static cublasSideMode_t hip2blas_side(hipsolverSideMode_t side)
+{
+    return side == HIPSOLVER_SIDE_LEFT ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT;
+}
+
+static cublasDiagType_t hip2blas_diag(bool unit_diag)
+{
+    return unit_diag ? CUBLAS_DIAG_UNIT : CUBLAS_DIAG_NON_UNIT;
+}
+
+device_blas_handle::device_blas_handle(hipsolverHandle_t handle)
+    : m_handle(nullptr)
+    , m_stream(0)
+{
+    cublasHandle_t blas;
+    hipsolverGetStream(handle, &m_stream);
+    if(cublasCreate(&blas) == CUBLAS_STATUS_SUCCESS)
+    {
+        cublasSetStream(blas, m_stream);
+        m_handle = blas;
+    }
+}
+
+device_blas_handle::~device_blas_handle()
+{
+    if(m_handle)
+        cublasDestroy((cublasHandle_t)m_handle);
+}
+
+static cublasStatus_t blas_geam(cublasHandle_t    handle,
+                                cublasOperation_t transA,
+                                int               m,
+                                int               n,
+                                const float*      alpha,
+                                const float*      A,
+                                int               lda,
+                                const float*      beta,
+                                const float*      B,
+                                int               ldb,
+                                float*            C,
+                                int               ldc)
+{
+    return cublasSgeam(handle, transA, CUBLAS_OP_N, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static cublasStatus_t blas_geam(cublasHandle_t    handle,
+                                cublasOperation_t transA,
+                                int               m,
+                                int               n,
+                                const double*     alpha,
+                                const double*     A,
+                                int               lda,
+                                const double*     beta,
+                                const double*     B,
+                                int               ldb,
+                                double*           C,
+                                int               ldc)
+{
+    return cublasDgeam(handle, transA, CUBLAS_OP_N, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static cublasStatus_t blas_geam(cublasHandle_t    handle,
+                                cublasOperation_t transA,
+                                int               m,
+                                int               n,
+                                const cuComplex*  alpha,
+                                const cuComplex*  A,
+                                int               lda,
+                                const cuComplex*  beta,
+                                const cuComplex*  B,
+                                int               ldb,
+                                cuComplex*        C,
+                                int               ldc)
+{
+    return cublasCgeam(handle, transA, CUBLAS_OP_N, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static cublasStatus_t blas_geam(cublasHandle_t         handle,
+                                cublasOperation_t      transA,
+                                int                    m,
+                                int                    n,
+                                const cuDoubleComplex* alpha,
+                                const cuDoubleComplex* A,
+                                int                    lda,
+                                const cuDoubleComplex* beta,
+                                const cuDoubleComplex* B,
+                                int                    ldb,
+                                cuDoubleComplex*       C,
+                                int                    ldc)
+{
+    return cublasZgeam(handle, transA, CUBLAS_OP_N, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static cublasStatus_t blas_trmm(cublasHandle_t    handle,
+                                cublasSideMode_t  side,
+                                cublasFillMode_t  uplo,
+                                cublasOperation_t transA,
+                                cublasDiagType_t  diag,
+                                int               m,
+                                int               n,
+                                const float*      alpha,
+                                const float*      A,
+                                int               lda,
+                                float*            B,
+                                int               ldb)
+{
+    return cublasStrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, B, ldb);
+}
+
+static cublasStatus_t blas_trmm(cublasHandle_t    handle,
+                                cublasSideMode_t  side,
+                                cublasFillMode_t  uplo,
+                                cublasOperation_t transA,
+                                cublasDiagType_t  diag,
+                                int               m,
+                                int               n,
+                                const double*     alpha,
+                                const double*     A,
+                                int               lda,
+                                double*           B,
+                                int               ldb)
+{
+    return cublasDtrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, B, ldb);
+}
+
+static cublasStatus_t blas_trmm(cublasHandle_t    handle,
+                                cublasSideMode_t  side,
+                                cublasFillMode_t  uplo,
+                                cublasOperation_t transA,
+                                cublasDiagType_t  diag,
+                                int               m,
+                                int               n,
+                                const cuComplex*  alpha,
+                                const cuComplex*  A,
+                                int               lda,
+                                cuComplex*        B,
+                                int               ldb)
+{
+    return cublasCtrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, B, ldb);
+}
+
+static cublasStatus_t blas_trmm(cublasHandle_t         handle,
+                                cublasSideMode_t       side,
+                                cublasFillMode_t       uplo,
+                                cublasOperation_t      transA,
+                                cublasDiagType_t       diag,
+                                int                    m,
+                                int                    n,
+                                const cuDoubleComplex* alpha,
+                                const cuDoubleComplex* A,
+                                int                    lda,
+                                cuDoubleComplex*       B,
+                                int                    ldb)
+{
+    return cublasZtrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, B, ldb);
+}
+
+static cublasStatus_t blas_symm_hemm(cublasHandle_t   handle,
+                                     cublasSideMode_t side,
+                                     cublasFillMode_t uplo,
+                                     int              m,
+                                     int              n,
+                                     const float*     alpha,
+                                     const float*     A,
+                                     int              lda,
+                                     const float*     B,
+                                     int              ldb,
+                                     const float*     beta,
+                                     float*           C,
+                                     int              ldc)
+{
+    return cublasSsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static cublasStatus_t blas_symm_hemm(cublasHandle_t   handle,
+                                     cublasSideMode_t side,
+                                     cublasFillMode_t uplo,
+                                     int              m,
+                                     int              n,
+                                     const double*    alpha,
+                                     const double*    A,
+                                     int              lda,
+                                     const double*    B,
+                                     int              ldb,
+                                     const double*    beta,
+                                     double*          C,
+                                     int              ldc)
+{
+    return cublasDsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static cublasStatus_t blas_symm_hemm(cublasHandle_t   handle,
+                                     cublasSideMode_t side,
+                                     cublasFillMode_t uplo,
+                                     int              m,
+                                     int              n,
+                                     const cuComplex* alpha,
+                                     const cuComplex* A,
+                                     int              lda,
+                                     const cuComplex* B,
+                                     int              ldb,
+                                     const cuComplex* beta,
+                                     cuComplex*       C,
+                                     int              ldc)
+{
+    return cublasChemm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static cublasStatus_t blas_symm_hemm(cublasHandle_t         handle,
+                                     cublasSideMode_t       side,
+                                     cublasFillMode_t       uplo,
+                                     int                    m,
+                                     int                    n,
+                                     const cuDoubleComplex* alpha,
+                                     const cuDoubleComplex* A,
+                                     int                    lda,
+                                     const cuDoubleComplex* B,
+                                     int                    ldb,
+                                     const cuDoubleComplex* beta,
+                                     cuDoubleComplex*       C,
+                                     int                    ldc)
+{
+    return cublasZhemm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static cublasStatus_t blas_axpy(cublasHandle_t handle,
+                                int            n,
+                                const float*   alpha,
+                                const float*   x,
+                                int            incx,
+                                float*         y,
+                                int            incy)
+{
+    return cublasSaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_axpy(cublasHandle_t handle,
+                                int            n,
+                                const double*  alpha,
+                                const double*  x,
+                                int            incx,
+                                double*        y,
+                                int            incy)
+{
+    return cublasDaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_axpy(cublasHandle_t   handle,
+                                int              n,
+                                const cuComplex* alpha,
+                                const cuComplex* x,
+                                int              incx,
+                                cuComplex*       y,
+                                int              incy)
+{
+    return cublasCaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_axpy(cublasHandle_t         handle,
+                                int                    n,
+                                const cuDoubleComplex* alpha,
+                                const cuDoubleComplex* x,
+                                int                    incx,
+                                cuDoubleComplex*       y,
+                                int                    incy)
+{
+    return cublasZaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_swap(cublasHandle_t handle,
+                                int            n,
+                                float*         x,
+                                int            incx,
+                                float*         y,
+                                int            incy)
+{
+    return cublasSswap(handle, n, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_swap(cublasHandle_t handle,
+                                int            n,
+                                double*        x,
+                                int            incx,
+                                double*        y,
+                                int            incy)
+{
+    return cublasDswap(handle, n, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_swap(cublasHandle_t handle,
+                                int            n,
+                                cuComplex*     x,
+                                int            incx,
+                                cuComplex*     y,
+                                int            incy)
+{
+    return cublasCswap(handle, n, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_swap(cublasHandle_t   handle,
+                                int              n,
+                                cuDoubleComplex* x,
+                                int              incx,
+                                cuDoubleComplex* y,
+                                int              incy)
+{
+    return cublasZswap(handle, n, x, incx, y, incy);
+}
+
+static cublasStatus_t blas_nrm2(cublasHandle_t handle,
+                                int            n,
+                                const float*   x,
+                                int            incx,
+                                float*         result)
+{
+    return cublasSnrm2(handle, n, x, incx, result);
+}
+
+static cublasStatus_t blas_nrm2(cublasHandle_t handle,
+                                int            n,
+                                const double*  x,
+                                int            incx,
+                                double*        result)
+{
+    return cublasDnrm2(handle, n, x, incx, result);
+}
+
+static cublasStatus_t blas_nrm2(cublasHandle_t   handle,
+                                int              n,
+                                const cuComplex* x,
+                                int              incx,
+                                float*           result)
+{
+    return cublasScnrm2(handle, n, x, incx, result);
+}
+
+static cublasStatus_t blas_nrm2(cublasHandle_t         handle,
+                                int                    n,
+                                const cuDoubleComplex* x,
+                                int                    incx,
+                                double*                result)
+{
+    return cublasDznrm2(handle, n, x, incx, result);
+}
+
+using blas_float_complex  = cuComplex;
+using blas_double_complex = cuDoubleComplex;
+
+#else
+
+/*************************************************************************/
+// rocBLAS backend
+
+#define BLAS_HANDLE(blas) ((rocblas_handle)(blas).get())
+
+static hipsolverStatus_t blas2hip_status(rocblas_status status)
+{
+    return status == rocblas_status_success ? HIPSOLVER_STATUS_SUCCESS
+                                            : HIPSOLVER_STATUS_INTERNAL_ERROR;
+}
+
+static rocblas_operation hip2blas_operation(hipsolverOperation_t op)
+{
+    return op == HIPSOLVER_OP_N ? rocblas_operation_none
+                                : (op == HIPSOLVER_OP_T ? rocblas_operation_transpose
+                                                        : rocblas_operation_conjugate_transpose);
+}
+
+static rocblas_fill hip2blas_fill(hipsolverFillMode_t fill)
+{
+    return fill == HIPSOLVER_FILL_MODE_UPPER ? rocblas_fill_upper : rocblas_fill_lower;
+}
+
+static rocblas_side hip2blas_side(hipsolverSideMode_t side)
+{
+    return side == HIPSOLVER_SIDE_LEFT ? rocblas_side_left : rocblas_side_right;
+}
+
+static rocblas_diagonal hip2blas_diag(bool unit_diag)
+{
+    return unit_diag ? rocblas_diagonal_unit : rocblas_diagonal_non_unit;
+}
+
+device_blas_handle::device_blas_handle(hipsolverHandle_t handle)
+    : m_handle(nullptr)
+    , m_stream(0)
+{
+    rocblas_handle blas;
+    hipsolverGetStream(handle, &m_stream);
+    if(rocblas_create_handle(&blas) == rocblas_status_success)
+    {
+        rocblas_set_stream(blas, m_stream);
+        m_handle = blas;
+    }
+}
+
+device_blas_handle::~device_blas_handle()
+{
+    if(m_handle)
+        rocblas_destroy_handle((rocblas_handle)m_handle);
+}
+
+static rocblas_status blas_geam(rocblas_handle    handle,
+                                rocblas_operation transA,
+                                int               m,
+                                int               n,
+                                const float*      alpha,
+                                const float*      A,
+                                int               lda,
+                                const float*      beta,
+                                const float*      B,
+                                int               ldb,
+                                float*            C,
+                                int               ldc)
+{
+    return rocblas_sgeam(
+        handle, transA, rocblas_operation_none, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static rocblas_status blas_geam(rocblas_handle    handle,
+                                rocblas_operation transA,
+                                int               m,
+                                int               n,
+                                const double*     alpha,
+                                const double*     A,
+                                int               lda,
+                                const double*     beta,
+                                const double*     B,
+                                int               ldb,
+                                double*           C,
+                                int               ldc)
+{
+    return rocblas_dgeam(
+        handle, transA, rocblas_operation_none, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static rocblas_status blas_geam(rocblas_handle               handle,
+                                rocblas_operation            transA,
+                                int                          m,
+                                int                          n,
+                                const rocblas_float_complex* alpha,
+                                const rocblas_float_complex* A,
+                                int                          lda,
+                                const rocblas_float_complex* beta,
+                                const rocblas_float_complex* B,
+                                int                          ldb,
+                                rocblas_float_complex*       C,
+                                int                          ldc)
+{
+    return rocblas_cgeam(
+        handle, transA, rocblas_operation_none, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static rocblas_status blas_geam(rocblas_handle                handle,
+                                rocblas_operation             transA,
+                                int                           m,
+                                int                           n,
+                                const rocblas_double_complex* alpha,
+                                const rocblas_double_complex* A,
+                                int                           lda,
+                                const rocblas_double_complex* beta,
+                                const rocblas_double_complex* B,
+                                int                           ldb,
+                                rocblas_double_complex*       C,
+                                int                           ldc)
+{
+    return rocblas_zgeam(
+        handle, transA, rocblas_operation_none, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+static rocblas_status blas_trmm(rocblas_handle    handle,
+                                rocblas_side      side,
+                                rocblas_fill      uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal  diag,
+                                int               m,
+                                int               n,
+                                const float*      alpha,
+                                const float*      A,
+                                int               lda,
+                                float*            B,
+                                int               ldb)
+{
+    return rocblas_strmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+static rocblas_status blas_trmm(rocblas_handle    handle,
+                                rocblas_side      side,
+                                rocblas_fill      uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal  diag,
+                                int               m,
+                                int               n,
+                                const double*     alpha,
+                                const double*     A,
+                                int               lda,
+                                double*           B,
+                                int               ldb)
+{
+    return rocblas_dtrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+static rocblas_status blas_trmm(rocblas_handle               handle,
+                                rocblas_side                 side,
+                                rocblas_fill                 uplo,
+                                rocblas_operation            transA,
+                                rocblas_diagonal             diag,
+                                int                          m,
+                                int                          n,
+                                const rocblas_float_complex* alpha,
+                                const rocblas_float_complex* A,
+                                int                          lda,
+                                rocblas_float_complex*       B,
+                                int                          ldb)
+{
+    return rocblas_ctrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+static rocblas_status blas_trmm(rocblas_handle                handle,
+                                rocblas_side                  side,
+                                rocblas_fill                  uplo,
+                                rocblas_operation             transA,
+                                rocblas_diagonal              diag,
+                                int                           m,
+                                int                           n,
+                                const rocblas_double_complex* alpha,
+                                const rocblas_double_complex* A,
+                                int                           lda,
+                                rocblas_double_complex*       B,
+                                int                           ldb)
+{
+    return rocblas_ztrmm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+static rocblas_status blas_symm_hemm(rocblas_handle handle,
+                                     rocblas_side   side,
+                                     rocblas_fill   uplo,
+                                     int            m,
+                                     int            n,
+                                     const float*   alpha,
+                                     const float*   A,
+                                     int            lda,
+                                     const float*   B,
+                                     int            ldb,
+                                     const float*   beta,
+                                     float*         C,
+                                     int            ldc)
+{
+    return rocblas_ssymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static rocblas_status blas_symm_hemm(rocblas_handle handle,
+                                     rocblas_side   side,
+                                     rocblas_fill   uplo,
+                                     int            m,
+                                     int            n,
+                                     const double*  alpha,
+                                     const double*  A,
+                                     int            lda,
+                                     const double*  B,
+                                     int            ldb,
+                                     const double*  beta,
+                                     double*        C,
+                                     int            ldc)
+{
+    return rocblas_dsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static rocblas_status blas_symm_hemm(rocblas_handle               handle,
+                                     rocblas_side                 side,
+                                     rocblas_fill                 uplo,
+                                     int                          m,
+                                     int                          n,
+                                     const rocblas_float_complex* alpha,
+                                     const rocblas_float_complex* A,
+                                     int                          lda,
+                                     const rocblas_float_complex* B,
+                                     int                          ldb,
+                                     const rocblas_float_complex* beta,
+                                     rocblas_float_complex*       C,
+                                     int                          ldc)
+{
+    return rocblas_chemm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static rocblas_status blas_symm_hemm(rocblas_handle                handle,
+                                     rocblas_side                  side,
+                                     rocblas_fill                  uplo,
+                                     int                           m,
+                                     int                           n,
+                                     const rocblas_double_complex* alpha,
+                                     const rocblas_double_complex* A,
+                                     int                           lda,
+                                     const rocblas_double_complex* B,
+                                     int                           ldb,
+                                     const rocblas_double_complex* beta,
+                                     rocblas_double_complex*       C,
+                                     int                           ldc)
+{
+    return rocblas_zhemm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static rocblas_status blas_axpy(rocblas_handle handle,
+                                int            n,
+                                const float*   alpha,
+                                const float*   x,
+                                int            incx,
+                                float*         y,
+                                int            incy)
+{
+    return rocblas_saxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static rocblas_status blas_axpy(rocblas_handle handle,
+                                int            n,
+                                const double*  alpha,
+                                const double*  x,
+                                int            incx,
+                                double*        y,
+                                int            incy)
+{
+    return rocblas_daxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static rocblas_status blas_axpy(rocblas_handle               handle,
+                                int                          n,
+                                const rocblas_float_complex* alpha,
+                                const rocblas_float_complex* x,
+                                int                          incx,
+                                rocblas_float_complex*       y,
+                                int                          incy)
+{
+    return rocblas_caxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static rocblas_status blas_axpy(rocblas_handle                handle,
+                                int                           n,
+                                const rocblas_double_complex* alpha,
+                                const rocblas_double_complex* x,
+                                int                           incx,
+                                rocblas_double_complex*       y,
+                                int                           incy)
+{
+    return rocblas_zaxpy(handle, n, alpha, x, incx, y, incy);
+}
+
+static rocblas_status blas_swap(rocblas_handle handle,
+                                int            n,
+                                float*         x,
+                                int            incx,
+                                float*         y,
+                                int            incy)
+{
+    return rocblas_sswap(handle, n, x, incx, y, incy);
+}
+
+static rocblas_status blas_swap(rocblas_handle handle,
+                                int            n,
+                                double*        x,
+                                int            incx,
+                                double*        y,
+                                int            incy)
+{
+    return rocblas_dswap(handle, n, x, incx, y, incy);
+}
+
+static rocblas_status blas_swap(rocblas_handle         handle,
+                                int                    n,
+                                rocblas_float_complex* x,
+                                int                    incx,
+                                rocblas_float_complex* y,
+                                int                    incy)
+{
+    return rocblas_cswap(handle, n, x, incx, y, incy);
+}
+
+static rocblas_status blas_swap(rocblas_handle          handle,
+                                int                     n,
+                                rocblas_double_complex* x,
+                                int                     incx,
+                                rocblas_double_complex* y,
+                                int                     incy)
+{
+    return rocblas_zswap(handle, n, x, incx, y, incy);
+}
+
+static rocblas_status blas_nrm2(rocblas_handle handle,
+                                int            n,
+                                const float*   x,
+                                int            incx,
+                                float*         result)
+{
+    return rocblas_snrm2(handle, n, x, incx, result);
+}
+
+static rocblas_status blas_nrm2(rocblas_handle handle,
+                                int            n,
+                                const double*  x,
+                                int            incx,
+                                double*        result)
+{
+    return rocblas_dnrm2(handle, n, x, incx, result);
+}
+
+static rocblas_status blas_nrm2(rocblas_handle               handle,
+                                int                          n,
+                                const rocblas_float_complex* x,
+                                int                          incx,
+                                float*                       result)
+{
+    return rocblas_scnrm2(handle, n, x, incx, result);
+}
+
+static rocblas_status blas_nrm2(rocblas_handle                handle,
+                                int                           n,
+                                const rocblas_double_complex* x,
+                                int                           incx,
+                                double*                       result)
+{
+    return rocblas_dznrm2(handle, n, x, incx, result);
+}
+
+using blas_float_complex  = rocblas_float_complex;
+using blas_double_complex = rocblas_double_complex;
+
+#endif
+
+/*************************************************************************/
+// hipSOLVER types are passed to the backend as their layout compatible BLAS types
+
+template <typename T>
+struct blas_type
+{
+    using type = T;
+};
+
+template <>
+struct blas_type<hipsolverComplex>
+{
+    using type = blas_float_complex;
+};
+
+template <>
+struct blas_type<hipsolverDoubleComplex>
+{
+    using type = blas_double_complex;
+};
+
+template <typename T>
+using blas_t = typename blas_type<T>::type;
+
+template <typename T>
+hipsolverStatus_t device_geam(const device_blas_handle& blas,
+                              hipsolverOperation_t      transA,
+                              int                       m,
+                              int                       n,
+                              T                         alpha,
+                              const T*                  A,
+                              int                       lda,
+                              T                         beta,
+                              const T*                  B,
+                              int                       ldb,
+                              T*                        C,
+                              int                       ldc)
+{
+    return blas2hip_status(blas_geam(BLAS_HANDLE(blas),
+                                     hip2blas_operation(transA),
+                                     m,
+                                     n,
+                                     (const blas_t<T>*)&alpha,
+                                     (const blas_t<T>*)A,
+                                     lda,
+                                     (const blas_t<T>*)&beta,
+                                     (const blas_t<T>*)B,
+                                     ldb,
+                                     (blas_t<T>*)C,
+                                     ldc));
+}
+
+template <typename T>
+hipsolverStatus_t device_trmm(const device_blas_handle& blas,
+                              hipsolverSideMode_t       side,
+                              hipsolverFillMode_t       uplo,
+                              hipsolverOperation_t      transA,
+                              bool                      unit_diag,
+                              int                       m,
+                              int                       n,
+                              T                         alpha,
+                              const T*                  A,
+                              int                       lda,
+                              T*                        B,
+                              int                       ldb)
+{
+    return blas2hip_status(blas_trmm(BLAS_HANDLE(blas),
+                                     hip2blas_side(side),
+                                     hip2blas_fill(uplo),
+                                     hip2blas_operation(transA),
+                                     hip2blas_diag(unit_diag),
+                                     m,
+                                     n,
+                                     (const blas_t<T>*)&alpha,
+                                     (const blas_t<T>*)A,
+                                     lda,
+                                     (blas_t<T>*)B,
+                                     ldb));
+}
+
+template <typename T>
+hipsolverStatus_t device_symm_hemm(const device_blas_handle& blas,
+                                   hipsolverSideMode_t       side,
+                                   hipsolverFillMode_t       uplo,
+                                   int                       m,
+                                   int                       n,
+                                   T                         alpha,
+                                   const T*                  A,
+                                   int                       lda,
+                                   const T*                  B,
+                                   int                       ldb,
+                                   T                         beta,
+                                   T*                        C,
+                                   int                       ldc)
+{
+    return blas2hip_status(blas_symm_hemm(BLAS_HANDLE(blas),
+                                          hip2blas_side(side),
+                                          hip2blas_fill(uplo),
+                                          m,
+                                          n,
+                                          (const blas_t<T>*)&alpha,
+                                          (const blas_t<T>*)A,
+                                          lda,
+                                          (const blas_t<T>*)B,
+                                          ldb,
+                                          (const blas_t<T>*)&beta,
+                                          (blas_t<T>*)C,
+                                          ldc));
+}
+
+template <typename T>
+hipsolverStatus_t device_axpy(
+    const device_blas_handle& blas, int n, T alpha, const T* x, int incx, T* y, int incy)
+{
+    return blas2hip_status(blas_axpy(BLAS_HANDLE(blas),
+                                     n,
+                                     (const blas_t<T>*)&alpha,
+                                     (const blas_t<T>*)x,
+                                     incx,
+                                     (blas_t<T>*)y,
+                                     incy));
+}
+
+template <typename T>
+hipsolverStatus_t
+    device_swap(const device_blas_handle& blas, int n, T* x, int incx, T* y, int incy)
+{
+    return blas2hip_status(
+        blas_swap(BLAS_HANDLE(blas), n, (blas_t<T>*)x, incx, (blas_t<T>*)y, incy));
+}
+
+template <typename T>
+hipsolverStatus_t
+    device_nrm2(const device_blas_handle& blas, int n, const T* x, int incx, double* result)
+{
+    decltype(std::real(T{})) nrm = 0;
+    hipsolverStatus_t        status
+        = blas2hip_status(blas_nrm2(BLAS_HANDLE(blas), n, (const blas_t<T>*)x, incx, &nrm));
+    *result = nrm;
+    return status;
+}
+
+#define INSTANTIATE_DEVICE_BLAS(T)                                                               \
+    template hipsolverStatus_t device_geam<T>(const device_blas_handle&,                         \
+                                              hipsolverOperation_t,                              \
+                                              int,                                               \
+                                              int,                                               \
+                                              T,                                                 \
+                                              const T*,                                          \
+                                              int,                                               \
+                                              T,                                                 \
+                                              const T*,                                          \
+                                              int,                                               \
+                                              T*,                                                \
+                                              int);                                              \
+    template hipsolverStatus_t device_trmm<T>(const device_blas_handle&,                         \
+                                              hipsolverSideMode_t,                               \
+                                              hipsolverFillMode_t,                               \
+                                              hipsolverOperation_t,                              \
+                                              bool,                                              \
+                                              int,                                               \
+                                              int,                                               \
+                                              T,                                                 \
+                                              const T*,                                          \
+                                              int,                                               \
+                                              T*,                                                \
+                                              int);                                              \
+    template hipsolverStatus_t device_symm_hemm<T>(const device_blas_handle&,                    \
+                                                   hipsolverSideMode_t,                          \
+                                                   hipsolverFillMode_t,                          \
+                                                   int,                                          \
+                                                   int,                                          \
+                                                   T,                                            \
+                                                   const T*,                                     \
+                                                   int,                                          \
+                                                   const T*,                                     \
+                                                   int,                                          \
+                                                   T,                                            \
+                                                   T*,                                           \
+                                                   int);                                         \
+    template hipsolverStatus_t device_axpy<T>(                                                   \
+        const device_blas_handle&, int, T, const T*, int, T*, int);                              \
+    template hipsolverStatus_t device_swap<T>(const device_blas_handle&, int, T*, int, T*, int); \
+    template hipsolverStatus_t device_nrm2<T>(                                                   \
+        const device_blas_handle&, int, const T*, int, double*)
+
+INSTANTIATE_DEVICE_BLAS(float);
+INSTANTIATE_DEVICE_BLAS(double);
+INSTANTIATE_DEVICE_BLAS(hipsolverComplex);
+INSTANTIATE_DEVICE_BLAS(hipsolverDoubleComplex);
@@ -76,6 +76,21 @@ char hipsolver2char_eform(hipsolverEigType_t value)
     }
 }
 
+char hipsolver2char_erange(hipsolverEigRange_t value)
+{
+    switch(value)
+    {
+    case HIPSOLVER_EIG_RANGE_ALL:
+        return 'A';
+    case HIPSOLVER_EIG_RANGE_V:
+        return 'V';
+    case HIPSOLVER_EIG_RANGE_I:
+        return 'I';
+    default:
+        throw std::invalid_argument("Invalid enum");
+    }
+}
+
 /* ============================================================================================ */
 /*  Convert lapack char constants to hipsolver type. */
 
@@ -93,6 +108,8 @@ hipsolverStatus_t string2hipsolver_status(const std::string& value)
            : value == "HIPSOLVER_STATUS_HANDLE_IS_NULLPTR" ? HIPSOLVER_STATUS_HANDLE_IS_NULLPTR
            : value == "HIPSOLVER_STATUS_INVALID_ENUM"      ? HIPSOLVER_STATUS_INVALID_ENUM
            : value == "HIPSOLVER_STATUS_UNKNOWN"           ? HIPSOLVER_STATUS_UNKNOWN
+           : value == "HIPSOLVER_STATUS_CAPTURE_UNSAFE"    ? HIPSOLVER_STATUS_CAPTURE_UNSAFE
+           : value == "HIPSOLVER_STATUS_ZERO_PIVOT"        ? HIPSOLVER_STATUS_ZERO_PIVOT
                                                            : static_cast<hipsolverStatus_t>(-1);
 }
 
@@ -173,3 +190,21 @@ hipsolverEigType_t char2hipsolver_eform(char value)
         throw std::invalid_argument("Invalid character");
     }
 }
+
+hipsolverEigRange_t char2hipsolver_erange(char value)
+{
+    switch(value)
+    {
+    case 'a':
+    case 'A':
+        return HIPSOLVER_EIG_RANGE_ALL;
+    case 'v':
+    case 'V':
+        return HIPSOLVER_EIG_RANGE_V;
+    case 'i':
+    case 'I':
+        return HIPSOLVER_EIG_RANGE_I;
+    default:
+        throw std::invalid_argument("Invalid character");
+    }
+}
@@ -377,6 +377,51 @@ void zgebrd_(int*                    m,
              int*                    size_w,
              int*                    info);
 
+void sgels_(char*  trans,
+            int*   m,
+            int*   n,
+            int*   nrhs,
+            float* A,
+            int*   lda,
+            float* B,
+            int*   ldb,
+            float* work,
+            int*   lwork,
+            int*   info);
+void dgels_(char*   trans,
+            int*    m,
+            int*    n,
+            int*    nrhs,
+            double* A,
+            int*    lda,
+            double* B,
+            int*    ldb,
+            double* work,
+            int*    lwork,
+            int*    info);
+void cgels_(char*             trans,
+            int*              m,
+            int*              n,
+            int*              nrhs,
+            hipsolverComplex* A,
+            int*              lda,
+            hipsolverComplex* B,
+            int*              ldb,
+            hipsolverComplex* work,
+            int*              lwork,
+            int*              info);
+void zgels_(char*                   trans,
+            int*                    m,
+            int*                    n,
+            int*                    nrhs,
+            hipsolverDoubleComplex* A,
+            int*                    lda,
+            hipsolverDoubleComplex* B,
+            int*                    ldb,
+            hipsolverDoubleComplex* work,
+            int*                    lwork,
+            int*                    info);
+
 void sgeqrf_(int* m, int* n, float* A, int* lda, float* ipiv, float* work, int* lwork, int* info);
 void dgeqrf_(
     int* m, int* n, double* A, int* lda, double* ipiv, double* work, int* lwork, int* info);
@@ -484,11 +529,52 @@ void zgetrs_(char*                   trans,
              int*                    ldb,
              int*                    info);
 
+void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
+void cgetri_(int*              n,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              ipiv,
+             hipsolverComplex* work,
+             int*              lwork,
+             int*              info);
+void zgetri_(int*                    n,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    ipiv,
+             hipsolverDoubleComplex* work,
+             int*                    lwork,
+             int*                    info);
+
 void spotrf_(char* uplo, int* m, float* A, int* lda, int* info);
 void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipsolverComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipsolverDoubleComplex* A, int* lda, int* info);
 
+void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotri_(char* uplo, int* n, hipsolverComplex* A, int* lda, int* info);
+void zpotri_(char* uplo, int* n, hipsolverDoubleComplex* A, int* lda, int* info);
+
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*             uplo,
+             int*              n,
+             int*              nrhs,
+             hipsolverComplex* A,
+             int*              lda,
+             hipsolverComplex* B,
+             int*              ldb,
+             int*              info);
+void zpotrs_(char*                   uplo,
+             int*                    n,
+             int*                    nrhs,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             hipsolverDoubleComplex* B,
+             int*                    ldb,
+             int*                    info);
+
 void ssyevd_(char*  evect,
              char*  uplo,
              int*   n,
@@ -599,6 +685,184 @@ void zhegvd_(int*                    itype,
              int*                    liwork,
              int*                    info);
 
+void ssyevx_(char*  evect,
+             char*  erange,
+             char*  uplo,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* vl,
+             float* vu,
+             int*   il,
+             int*   iu,
+             float* abstol,
+             int*   nev,
+             float* W,
+             float* Z,
+             int*   ldz,
+             float* work,
+             int*   lwork,
+             int*   iwork,
+             int*   ifail,
+             int*   info);
+void dsyevx_(char*   evect,
+             char*   erange,
+             char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* vl,
+             double* vu,
+             int*    il,
+             int*    iu,
+             double* abstol,
+             int*    nev,
+             double* W,
+             double* Z,
+             int*    ldz,
+             double* work,
+             int*    lwork,
+             int*    iwork,
+             int*    ifail,
+             int*    info);
+void cheevx_(char*             evect,
+             char*             erange,
+             char*             uplo,
+             int*              n,
+             hipsolverComplex* A,
+             int*              lda,
+             float*            vl,
+             float*            vu,
+             int*              il,
+             int*              iu,
+             float*            abstol,
+             int*              nev,
+             float*            W,
+             hipsolverComplex* Z,
+             int*              ldz,
+             hipsolverComplex* work,
+             int*              lwork,
+             float*            rwork,
+             int*              iwork,
+             int*              ifail,
+             int*              info);
+void zheevx_(char*                   evect,
+             char*                   erange,
+             char*                   uplo,
+             int*                    n,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             double*                 vl,
+             double*                 vu,
+             int*                    il,
+             int*                    iu,
+             double*                 abstol,
+             int*                    nev,
+             double*                 W,
+             hipsolverDoubleComplex* Z,
+             int*                    ldz,
+             hipsolverDoubleComplex* work,
+             int*                    lwork,
+             double*                 rwork,
+             int*                    iwork,
+             int*                    ifail,
+             int*                    info);
+
+void ssygvx_(int*   itype,
+             char*  evect,
+             char*  erange,
+             char*  uplo,
+             int*   n,
+             float* A,
+             int*   lda,
+             float* B,
+             int*   ldb,
+             float* vl,
+             float* vu,
+             int*   il,
+             int*   iu,
+             float* abstol,
+             int*   nev,
+             float* W,
+             float* Z,
+             int*   ldz,
+             float* work,
+             int*   lwork,
+             int*   iwork,
+             int*   ifail,
+             int*   info);
+void dsygvx_(int*    itype,
+             char*   evect,
+             char*   erange,
+             char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             double* B,
+             int*    ldb,
+             double* vl,
+             double* vu,
+             int*    il,
+             int*    iu,
+             double* abstol,
+             int*    nev,
+             double* W,
+             double* Z,
+             int*    ldz,
+             double* work,
+             int*    lwork,
+             int*    iwork,
+             int*    ifail,
+             int*    info);
+void chegvx_(int*              itype,
+             char*             evect,
+             char*             erange,
+             char*             uplo,
+             int*              n,
+             hipsolverComplex* A,
+             int*              lda,
+             hipsolverComplex* B,
+             int*              ldb,
+             float*            vl,
+             float*            vu,
+             int*              il,
+             int*              iu,
+             float*            abstol,
+             int*              nev,
+             float*            W,
+             hipsolverComplex* Z,
+             int*              ldz,
+             hipsolverComplex* work,
+             int*              lwork,
+             float*            rwork,
+             int*              iwork,
+             int*              ifail,
+             int*              info);
+void zhegvx_(int*                    itype,
+             char*                   evect,
+             char*                   erange,
+             char*                   uplo,
+             int*                    n,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             hipsolverDoubleComplex* B,
+             int*                    ldb,
+             double*                 vl,
+             double*                 vu,
+             int*                    il,
+             int*                    iu,
+             double*                 abstol,
+             int*                    nev,
+             double*                 W,
+             hipsolverDoubleComplex* Z,
+             int*                    ldz,
+             hipsolverDoubleComplex* work,
+             int*                    lwork,
+             double*                 rwork,
+             int*                    iwork,
+             int*                    ifail,
+             int*                    info);
+
 void ssytrd_(char*  uplo,
              int*   n,
              float* A,
@@ -640,6 +904,68 @@ void zhetrd_(char*                   uplo,
              int*                    size_w,
              int*                    info);
 
+void ssytrf_(char* uplo, int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dsytrf_(char*   uplo,
+             int*    n,
+             double* A,
+             int*    lda,
+             int*    ipiv,
+             double* work,
+             int*    lwork,
+             int*    info);
+void csytrf_(char*             uplo,
+             int*              n,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              ipiv,
+             hipsolverComplex* work,
+             int*              lwork,
+             int*              info);
+void zsytrf_(char*                   uplo,
+             int*                    n,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    ipiv,
+             hipsolverDoubleComplex* work,
+             int*                    lwork,
+             int*                    info);
+void ssytrs_(char*  uplo,
+             int*   n,
+             int*   nrhs,
+             float* A,
+             int*   lda,
+             int*   ipiv,
+             float* B,
+             int*   ldb,
+             int*   info);
+void dsytrs_(char*   uplo,
+             int*    n,
+             int*    nrhs,
+             double* A,
+             int*    lda,
+             int*    ipiv,
+             double* B,
+             int*    ldb,
+             int*    info);
+void csytrs_(char*             uplo,
+             int*              n,
+             int*              nrhs,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              ipiv,
+             hipsolverComplex* B,
+             int*              ldb,
+             int*              info);
+void zsytrs_(char*                   uplo,
+             int*                    n,
+             int*                    nrhs,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    ipiv,
+             hipsolverDoubleComplex* B,
+             int*                    ldb,
+             int*                    info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1404,6 +1730,75 @@ void cblas_gebrd<hipsolverDoubleComplex, double>(int                     m,
     zgebrd_(&m, &n, A, &lda, D, E, tauq, taup, work, &size_w, &info);
 }
 
+// gels
+template <>
+void cblas_gels<float>(hipsolverOperation_t trans,
+                       int                  m,
+                       int                  n,
+                       int                  nrhs,
+                       float*               A,
+                       int                  lda,
+                       float*               B,
+                       int                  ldb,
+                       float*               work,
+                       int                  lwork,
+                       int*                 info)
+{
+    char transC = hipsolver2char_operation(trans);
+    sgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<double>(hipsolverOperation_t trans,
+                        int                  m,
+                        int                  n,
+                        int                  nrhs,
+                        double*              A,
+                        int                  lda,
+                        double*              B,
+                        int                  ldb,
+                        double*              work,
+                        int                  lwork,
+                        int*                 info)
+{
+    char transC = hipsolver2char_operation(trans);
+    dgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<hipsolverComplex>(hipsolverOperation_t trans,
+                                  int                  m,
+                                  int                  n,
+                                  int                  nrhs,
+                                  hipsolverComplex*    A,
+                                  int                  lda,
+                                  hipsolverComplex*    B,
+                                  int                  ldb,
+                                  hipsolverComplex*    work,
+                                  int                  lwork,
+                                  int*                 info)
+{
+    char transC = hipsolver2char_operation(trans);
+    cgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cblas_gels<hipsolverDoubleComplex>(hipsolverOperation_t    trans,
+                                        int                     m,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info)
+{
+    char transC = hipsolver2char_operation(trans);
+    zgels_(&transC, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
 // geqrf
 template <>
 void cblas_geqrf<float>(int m, int n, float* A, int lda, float* ipiv, float* work, int lwork)
@@ -1601,35 +1996,145 @@ void cblas_getrs<hipsolverDoubleComplex>(hipsolverOperation_t    trans,
     zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
 }
 
-// potrf
+// getri
 template <>
-void cblas_potrf<float>(hipsolverFillMode_t uplo, int n, float* A, int lda, int* info)
+void cblas_getri<float>(int n, float* A, int lda, int* ipiv, float* work, int lwork, int* info)
 {
-    char uploC = hipsolver2char_fill(uplo);
-    spotrf_(&uploC, &n, A, &lda, info);
+    sgetri_(&n, A, &lda, ipiv, work, &lwork, info);
 }
 
 template <>
-void cblas_potrf<double>(hipsolverFillMode_t uplo, int n, double* A, int lda, int* info)
+void cblas_getri<double>(int n, double* A, int lda, int* ipiv, double* work, int lwork, int* info)
 {
-    char uploC = hipsolver2char_fill(uplo);
-    dpotrf_(&uploC, &n, A, &lda, info);
+    dgetri_(&n, A, &lda, ipiv, work, &lwork, info);
 }
 
 template <>
-void cblas_potrf<hipsolverComplex>(
-    hipsolverFillMode_t uplo, int n, hipsolverComplex* A, int lda, int* info)
+void cblas_getri<hipsolverComplex>(
+    int n, hipsolverComplex* A, int lda, int* ipiv, hipsolverComplex* work, int lwork, int* info)
 {
-    char uploC = hipsolver2char_fill(uplo);
-    cpotrf_(&uploC, &n, A, &lda, info);
+    cgetri_(&n, A, &lda, ipiv, work, &lwork, info);
 }
 
 template <>
-void cblas_potrf<hipsolverDoubleComplex>(
-    hipsolverFillMode_t uplo, int n, hipsolverDoubleComplex* A, int lda, int* info)
+void cblas_getri<hipsolverDoubleComplex>(int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int*                    ipiv,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
 {
-    char uploC = hipsolver2char_fill(uplo);
-    zpotrf_(&uploC, &n, A, &lda, info);
+    zgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+// potrf
+template <>
+void cblas_potrf<float>(hipsolverFillMode_t uplo, int n, float* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    spotrf_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potrf<double>(hipsolverFillMode_t uplo, int n, double* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    dpotrf_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potrf<hipsolverComplex>(
+    hipsolverFillMode_t uplo, int n, hipsolverComplex* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    cpotrf_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potrf<hipsolverDoubleComplex>(
+    hipsolverFillMode_t uplo, int n, hipsolverDoubleComplex* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    zpotrf_(&uploC, &n, A, &lda, info);
+}
+
+// potri
+template <>
+void cblas_potri<float>(hipsolverFillMode_t uplo, int n, float* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    spotri_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potri<double>(hipsolverFillMode_t uplo, int n, double* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    dpotri_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potri<hipsolverComplex>(
+    hipsolverFillMode_t uplo, int n, hipsolverComplex* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    cpotri_(&uploC, &n, A, &lda, info);
+}
+
+template <>
+void cblas_potri<hipsolverDoubleComplex>(
+    hipsolverFillMode_t uplo, int n, hipsolverDoubleComplex* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    zpotri_(&uploC, &n, A, &lda, info);
+}
+
+// potrs
+template <>
+void cblas_potrs<float>(
+    hipsolverFillMode_t uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    spotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs<double>(
+    hipsolverFillMode_t uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    dpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   int                 nrhs,
+                                   hipsolverComplex*   A,
+                                   int                 lda,
+                                   hipsolverComplex*   B,
+                                   int                 ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    cpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cblas_potrs<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    zpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
 }
 
 // syevd & heevd
@@ -1842,6 +2347,424 @@ void cblas_sygvd_hegvd<hipsolverDoubleComplex, double>(hipsolverEigType_t      i
             info);
 }
 
+// syevx & heevx
+template <>
+void cblas_syevx_heevx<float, float>(hipsolverEigMode_t  evect,
+                                     hipsolverEigRange_t erange,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     float*              A,
+                                     int                 lda,
+                                     float               vl,
+                                     float               vu,
+                                     int                 il,
+                                     int                 iu,
+                                     float               abstol,
+                                     int*                nev,
+                                     float*              W,
+                                     float*              Z,
+                                     int                 ldz,
+                                     float*              work,
+                                     int                 lwork,
+                                     float*              rwork,
+                                     int*                iwork,
+                                     int*                ifail,
+                                     int*                info)
+{
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    ssyevx_(&evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            iwork,
+            ifail,
+            info);
+}
+
+template <>
+void cblas_syevx_heevx<double, double>(hipsolverEigMode_t  evect,
+                                       hipsolverEigRange_t erange,
+                                       hipsolverFillMode_t uplo,
+                                       int                 n,
+                                       double*             A,
+                                       int                 lda,
+                                       double              vl,
+                                       double              vu,
+                                       int                 il,
+                                       int                 iu,
+                                       double              abstol,
+                                       int*                nev,
+                                       double*             W,
+                                       double*             Z,
+                                       int                 ldz,
+                                       double*             work,
+                                       int                 lwork,
+                                       double*             rwork,
+                                       int*                iwork,
+                                       int*                ifail,
+                                       int*                info)
+{
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    dsyevx_(&evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            iwork,
+            ifail,
+            info);
+}
+
+template <>
+void cblas_syevx_heevx<hipsolverComplex, float>(hipsolverEigMode_t  evect,
+                                                hipsolverEigRange_t erange,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipsolverComplex*   A,
+                                                int                 lda,
+                                                float               vl,
+                                                float               vu,
+                                                int                 il,
+                                                int                 iu,
+                                                float               abstol,
+                                                int*                nev,
+                                                float*              W,
+                                                hipsolverComplex*   Z,
+                                                int                 ldz,
+                                                hipsolverComplex*   work,
+                                                int                 lwork,
+                                                float*              rwork,
+                                                int*                iwork,
+                                                int*                ifail,
+                                                int*                info)
+{
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    cheevx_(&evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            rwork,
+            iwork,
+            ifail,
+            info);
+}
+
+template <>
+void cblas_syevx_heevx<hipsolverDoubleComplex, double>(hipsolverEigMode_t      evect,
+                                                       hipsolverEigRange_t     erange,
+                                                       hipsolverFillMode_t     uplo,
+                                                       int                     n,
+                                                       hipsolverDoubleComplex* A,
+                                                       int                     lda,
+                                                       double                  vl,
+                                                       double                  vu,
+                                                       int                     il,
+                                                       int                     iu,
+                                                       double                  abstol,
+                                                       int*                    nev,
+                                                       double*                 W,
+                                                       hipsolverDoubleComplex* Z,
+                                                       int                     ldz,
+                                                       hipsolverDoubleComplex* work,
+                                                       int                     lwork,
+                                                       double*                 rwork,
+                                                       int*                    iwork,
+                                                       int*                    ifail,
+                                                       int*                    info)
+{
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    zheevx_(&evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            rwork,
+            iwork,
+            ifail,
+            info);
+}
+
+// sygvx & hegvx
+template <>
+void cblas_sygvx_hegvx<float, float>(hipsolverEigType_t  itype,
+                                     hipsolverEigMode_t  evect,
+                                     hipsolverEigRange_t erange,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     float*              A,
+                                     int                 lda,
+                                     float*              B,
+                                     int                 ldb,
+                                     float               vl,
+                                     float               vu,
+                                     int                 il,
+                                     int                 iu,
+                                     float               abstol,
+                                     int*                nev,
+                                     float*              W,
+                                     float*              Z,
+                                     int                 ldz,
+                                     float*              work,
+                                     int                 lwork,
+                                     float*              rwork,
+                                     int*                iwork,
+                                     int*                ifail,
+                                     int*                info)
+{
+    int  itypeI  = hipsolver2char_eform(itype) - '0';
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    ssygvx_(&itypeI,
+            &evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            B,
+            &ldb,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            iwork,
+            ifail,
+            info);
+}
+
+template <>
+void cblas_sygvx_hegvx<double, double>(hipsolverEigType_t  itype,
+                                       hipsolverEigMode_t  evect,
+                                       hipsolverEigRange_t erange,
+                                       hipsolverFillMode_t uplo,
+                                       int                 n,
+                                       double*             A,
+                                       int                 lda,
+                                       double*             B,
+                                       int                 ldb,
+                                       double              vl,
+                                       double              vu,
+                                       int                 il,
+                                       int                 iu,
+                                       double              abstol,
+                                       int*                nev,
+                                       double*             W,
+                                       double*             Z,
+                                       int                 ldz,
+                                       double*             work,
+                                       int                 lwork,
+                                       double*             rwork,
+                                       int*                iwork,
+                                       int*                ifail,
+                                       int*                info)
+{
+    int  itypeI  = hipsolver2char_eform(itype) - '0';
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    dsygvx_(&itypeI,
+            &evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            B,
+            &ldb,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            iwork,
+            ifail,
+            info);
+}
+
+template <>
+void cblas_sygvx_hegvx<hipsolverComplex, float>(hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  evect,
+                                                hipsolverEigRange_t erange,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipsolverComplex*   A,
+                                                int                 lda,
+                                                hipsolverComplex*   B,
+                                                int                 ldb,
+                                                float               vl,
+                                                float               vu,
+                                                int                 il,
+                                                int                 iu,
+                                                float               abstol,
+                                                int*                nev,
+                                                float*              W,
+                                                hipsolverComplex*   Z,
+                                                int                 ldz,
+                                                hipsolverComplex*   work,
+                                                int                 lwork,
+                                                float*              rwork,
+                                                int*                iwork,
+                                                int*                ifail,
+                                                int*                info)
+{
+    int  itypeI  = hipsolver2char_eform(itype) - '0';
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    chegvx_(&itypeI,
+            &evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            B,
+            &ldb,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            rwork,
+            iwork,
+            ifail,
+            info);
+}
+
+template <>
+void cblas_sygvx_hegvx<hipsolverDoubleComplex, double>(hipsolverEigType_t      itype,
+                                                       hipsolverEigMode_t      evect,
+                                                       hipsolverEigRange_t     erange,
+                                                       hipsolverFillMode_t     uplo,
+                                                       int                     n,
+                                                       hipsolverDoubleComplex* A,
+                                                       int                     lda,
+                                                       hipsolverDoubleComplex* B,
+                                                       int                     ldb,
+                                                       double                  vl,
+                                                       double                  vu,
+                                                       int                     il,
+                                                       int                     iu,
+                                                       double                  abstol,
+                                                       int*                    nev,
+                                                       double*                 W,
+                                                       hipsolverDoubleComplex* Z,
+                                                       int                     ldz,
+                                                       hipsolverDoubleComplex* work,
+                                                       int                     lwork,
+                                                       double*                 rwork,
+                                                       int*                    iwork,
+                                                       int*                    ifail,
+                                                       int*                    info)
+{
+    int  itypeI  = hipsolver2char_eform(itype) - '0';
+    char evectC  = hipsolver2char_evect(evect);
+    char erangeC = hipsolver2char_erange(erange);
+    char uploC   = hipsolver2char_fill(uplo);
+    zhegvx_(&itypeI,
+            &evectC,
+            &erangeC,
+            &uploC,
+            &n,
+            A,
+            &lda,
+            B,
+            &ldb,
+            &vl,
+            &vu,
+            &il,
+            &iu,
+            &abstol,
+            nev,
+            W,
+            Z,
+            &ldz,
+            work,
+            &lwork,
+            rwork,
+            iwork,
+            ifail,
+            info);
+}
+
 // sytrd & hetrd
 template <>
 void cblas_sytrd_hetrd<float, float>(hipsolverFillMode_t uplo,
@@ -1906,3 +2829,121 @@ void cblas_sytrd_hetrd<hipsolverDoubleComplex, double>(hipsolverFillMode_t     u
     char uploC = hipsolver2char_fill(uplo);
     zhetrd_(&uploC, &n, A, &lda, D, E, tau, work, &size_w, &info);
 }
+
+// sytrf
+template <>
+void cblas_sytrf<float>(hipsolverFillMode_t uplo,
+                        int                 n,
+                        float*              A,
+                        int                 lda,
+                        int*                ipiv,
+                        float*              work,
+                        int                 lwork,
+                        int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    ssytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf<double>(hipsolverFillMode_t uplo,
+                         int                 n,
+                         double*             A,
+                         int                 lda,
+                         int*                ipiv,
+                         double*             work,
+                         int                 lwork,
+                         int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    dsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   hipsolverComplex*   A,
+                                   int                 lda,
+                                   int*                ipiv,
+                                   hipsolverComplex*   work,
+                                   int                 lwork,
+                                   int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    csytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cblas_sytrf<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int*                    ipiv,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    zsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
+}
+
+// sytrs
+template <>
+void cblas_sytrs<float>(hipsolverFillMode_t uplo,
+                        int                 n,
+                        int                 nrhs,
+                        float*              A,
+                        int                 lda,
+                        int*                ipiv,
+                        float*              B,
+                        int                 ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    ssytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs<double>(hipsolverFillMode_t uplo,
+                         int                 n,
+                         int                 nrhs,
+                         double*             A,
+                         int                 lda,
+                         int*                ipiv,
+                         double*             B,
+                         int                 ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    dsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   int                 nrhs,
+                                   hipsolverComplex*   A,
+                                   int                 lda,
+                                   int*                ipiv,
+                                   hipsolverComplex*   B,
+                                   int                 ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    csytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cblas_sytrs<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int*                    ipiv,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb)
+{
+    int  info;
+    char uploC = hipsolver2char_fill(uplo);
+    zsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
@@ -4,8 +4,18 @@
 
 #include "utility.hpp"
 #include "hipsolver.h"
+#include <atomic>
+#include <cstring>
 #include <sys/time.h>
 
+#ifdef HIPSOLVER_BENCH_TRACE
+#ifdef __HIP_PLATFORM_NVCC__
+#include <cupti.h>
+#else
+#include <roctracer/roctracer_hip.h>
+#endif
+#endif
+
 hipsolver_rng_t hipsolver_rng(69069);
 hipsolver_rng_t hipsolver_seed(hipsolver_rng);
 
@@ -173,3 +183,142 @@ void set_device(int device_id)
 #ifdef __cplusplus
 }
 #endif
+
+/* ============================================================================================ */
+/*  timing of the hot calls of the benchmarks */
+
+// kernel launches and memory copies issued by the host since the program started
+static std::atomic<int64_t> bench_launches(0);
+static std::atomic<int64_t> bench_memcpys(0);
+
+#ifdef HIPSOLVER_BENCH_TRACE
+// returns the counter of the API function name, or null if it neither launches nor copies
+static std::atomic<int64_t>* bench_trace_counter(const char* name)
+{
+    if(strstr(name, "LaunchKernel") || strstr(name, "LaunchCooperativeKernel"))
+        return &bench_launches;
+    if(strstr(name, "Memcpy"))
+        return &bench_memcpys;
+    return nullptr;
+}
+
+#ifdef __HIP_PLATFORM_NVCC__
+// counts the driver API calls, which include those made by the runtime API
+static void CUPTIAPI bench_trace_callback(void*                arg,
+                                          CUpti_CallbackDomain domain,
+                                          CUpti_CallbackId     cbid,
+                                          const void*          data)
+{
+    const CUpti_CallbackData* info = static_cast<const CUpti_CallbackData*>(data);
+    if(info->callbackSite == CUPTI_API_ENTER)
+    {
+        std::atomic<int64_t>* counter = bench_trace_counter(info->functionName);
+        if(counter)
+            (*counter)++;
+    }
+}
+
+static bool bench_trace_enable()
+{
+    CUpti_SubscriberHandle subscriber;
+    return cuptiSubscribe(&subscriber, bench_trace_callback, nullptr)
+               == CUPTI_SUCCESS
+           && cuptiEnableDomain(1, subscriber, CUPTI_CB_DOMAIN_DRIVER_API) == CUPTI_SUCCESS;
+}
+#else
+static void bench_trace_callback(uint32_t domain, uint32_t cid, const void* data, void* counter)
+{
+    if(static_cast<const hip_api_data_t*>(data)->phase == ACTIVITY_API_PHASE_ENTER)
+        (*static_cast<std::atomic<int64_t>*>(counter))++;
+}
+
+// the callback is only enabled for the functions that launch or copy
+static bool bench_trace_enable()
+{
+    for(uint32_t cid = 0; cid < HIP_API_ID_NUMBER; cid++)
+    {
+        const char* name = roctracer_op_string(ACTIVITY_DOMAIN_HIP_API, cid, 0);
+        std::atomic<int64_t>* counter = name ? bench_trace_counter(name) : nullptr;
+        if(!counter)
+            continue;
+        if(roctracer_enable_op_callback(ACTIVITY_DOMAIN_HIP_API, cid, bench_trace_callback, counter)
+           != ROCTRACER_STATUS_SUCCESS)
+            return false;
+    }
+    return true;
+}
+#endif
+#endif
+
+hipsolver_bench_timer::mode_t& hipsolver_bench_timer::mode()
+{
+    static mode_t m = wall;
+    return m;
+}
+
+bool hipsolver_bench_timer::tracing()
+{
+#ifdef HIPSOLVER_BENCH_TRACE
+    static bool enabled = bench_trace_enable();
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+hipsolver_bench_timer::totals_t& hipsolver_bench_timer::totals()
+{
+    static totals_t t;
+    return t;
+}
+
+hipsolver_bench_timer::hipsolver_bench_timer(hipStream_t stream)
+    : stream(stream)
+{
+    if(mode() == event)
+    {
+        hipEventCreate(&start_event);
+        hipEventCreate(&stop_event);
+    }
+
+    // the callbacks are registered before the first call is timed
+    tracing();
+}
+
+hipsolver_bench_timer::~hipsolver_bench_timer()
+{
+    if(start_event)
+        hipEventDestroy(start_event);
+    if(stop_event)
+        hipEventDestroy(stop_event);
+}
+
+void hipsolver_bench_timer::start()
+{
+    // in event mode, the work already queued on the stream is not waited for
+    if(start_event)
+        hipEventRecord(start_event, stream);
+    else
+        start_us = get_time_us_sync(stream);
+
+    launches0 = bench_launches;
+    memcpys0  = bench_memcpys;
+}
+
+double hipsolver_bench_timer::stop()
+{
+    totals_t& t = totals();
+    t.calls++;
+    t.launches += bench_launches - launches0;
+    t.memcpys += bench_memcpys - memcpys0;
+
+    if(start_event)
+    {
+        float ms = 0;
+        hipEventRecord(stop_event, stream);
+        hipEventSynchronize(stop_event);
+        hipEventElapsedTime(&ms, start_event, stop_event);
+        return ms * 1000.0;
+    }
+    return get_time_us_sync(stream) - start_us;
+}
@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, lda}
+const vector<vector<int>> adv_size_range = {{1, 1}, {20, 20}, {70, 80}};
+
+class ADV_OPTIONS : public ::TestWithParam<vector<int>>
+{
+protected:
+    ADV_OPTIONS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates a diagonally dominant symmetric matrix, which needs no pivoting
+static void adv_init_dominant(host_strided_batch_vector<double>& hA, int n, int lda)
+{
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * lda] = hA[0][i + j * lda];
+        hA[0][i + i * lda] += 400;
+    }
+}
+
+TEST(ADV_OPTIONS_API, bad_arg)
+{
+    hipsolver_local_handle handle;
+    int                    value;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(nullptr, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_PIVOTING, 0),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetAdvOptions(nullptr, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_PIVOTING, &value),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_PIVOTING, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, hipsolverDnFunction_t(-1), HIPSOLVER_ADV_PIVOTING, 0),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_GETRF, hipsolverAdvOption_t(-1), 0),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_ALGORITHM, 2),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_UNBLOCKED_SIZE, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // potrf never pivots
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_POTRF, HIPSOLVER_ADV_PIVOTING, 1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+#if !defined(__HIP_PLATFORM_HCC__) && !defined(__HIP_PLATFORM_AMD__)
+    // cuSOLVER has no runtime choice of blocking
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_UNBLOCKED_SIZE, 32),
+        HIPSOLVER_STATUS_NOT_SUPPORTED);
+#endif
+}
+
+TEST(ADV_OPTIONS_API, set_get)
+{
+    hipsolver_local_handle handle;
+    int                    value;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_ALGORITHM, &value),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(value, HIPSOLVER_ALG_0);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_PIVOTING, &value),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(value, 1);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_PIVOTING, 0),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_PIVOTING, &value),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(value, 0);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_POTRF, HIPSOLVER_ADV_ALGORITHM, HIPSOLVER_ALG_1),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetAdvOptions(handle, HIPSOLVERDN_POTRF, HIPSOLVER_ADV_ALGORITHM, &value),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(value, HIPSOLVER_ALG_1);
+
+    // the hints of one function do not change the others
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_ALGORITHM, &value),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(value, HIPSOLVER_ALG_0);
+}
+
+// without pivoting, getrf must give the same factorization as getrf without a pivot array, and
+// must not reference the pivot array
+TEST_P(ADV_OPTIONS, getrf_nopivot)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1];
+
+    hipsolver_local_handle handle;
+    int                    lwork;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, n, n, nullptr, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hAResAdv(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hIpiv(n, 1, n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    adv_init_dominant(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrf(handle, n, n, dA.data(), lda, dWork.data(), lwork, nullptr, dinfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    for(int i = 0; i < n; i++)
+        hIpiv[0][i] = -1;
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+
+    CHECK_ROCBLAS_ERROR(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_PIVOTING, 0));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrf(
+            handle, n, n, dA.data(), lda, dWork.data(), lwork, dIpiv.data(), dinfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hAResAdv.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    EXPECT_EQ(hinfo[0][0], 0);
+    for(int i = 0; i < n; i++)
+        EXPECT_EQ(hIpiv[0][i], -1);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[0], hAResAdv[0]), n);
+}
+
+// the unblocked algorithms must give the same factorizations as the blocked ones
+TEST_P(ADV_OPTIONS, potrf_algorithm)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1];
+
+    hipsolver_local_handle handle;
+    int                    lwork;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, n, nullptr, lda, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hAResAdv(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    adv_init_dominant(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf(handle,
+                                          HIPSOLVER_FILL_MODE_UPPER,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          dWork.data(),
+                                          lwork,
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    CHECK_ROCBLAS_ERROR(hipsolverSetAdvOptions(
+        handle, HIPSOLVERDN_POTRF, HIPSOLVER_ADV_ALGORITHM, HIPSOLVER_ALG_1));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf(handle,
+                                          HIPSOLVER_FILL_MODE_UPPER,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          dWork.data(),
+                                          lwork,
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hAResAdv.transfer_from(dA));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    EXPECT_EQ(hinfo[0][0], 0);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[0], hAResAdv[0]), n);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, ADV_OPTIONS, ValuesIn(adv_size_range));
@@ -0,0 +1,490 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include <limits>
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {m, n, lda}
+const vector<vector<int>> api64_size_range = {{1, 1, 1}, {20, 20, 20}, {40, 30, 50}};
+
+class API64 : public ::TestWithParam<vector<int>>
+{
+protected:
+    API64() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates a well conditioned symmetric positive definite matrix
+static void api64_init_spd(host_strided_batch_vector<double>& hA, int n, int lda)
+{
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * lda] = hA[0][i + j * lda];
+        hA[0][i + i * lda] += 400;
+    }
+}
+
+TEST(API64_BAD_ARG, handle)
+{
+    size_t lwork;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_64_bufferSize(nullptr, HIPSOLVER_FILL_MODE_UPPER, 1, nullptr, 1, &lwork),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd_64_bufferSize(nullptr,
+                                                        HIPSOLVER_EIG_MODE_VECTOR,
+                                                        HIPSOLVER_FILL_MODE_UPPER,
+                                                        1,
+                                                        nullptr,
+                                                        1,
+                                                        nullptr,
+                                                        &lwork),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvd_64_bufferSize(nullptr, 'N', 'N', 1, 1, &lwork),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST(API64_BAD_ARG, generic)
+{
+    hipsolver_local_handle handle;
+    hipsolverDnParams_t    params;
+    size_t                 dev, host;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreateParams(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetAdvOptions(nullptr, HIPSOLVERDN_GETRF, HIPSOLVER_ALG_0),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    CHECK_ROCBLAS_ERROR(hipsolverDnCreateParams(&params));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnSetAdvOptions(params, HIPSOLVERDN_GETRF, hipsolverAlgMode_t(-1)),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_GETRF, HIPSOLVER_ALG_1),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrf_bufferSize(
+                              nullptr, params, 1, 1, HIP_R_64F, nullptr, 1, HIP_R_64F, &dev, &host),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnXgetrf_bufferSize(
+            handle, params, 1, 1, HIP_R_64F, nullptr, 1, HIP_R_64F, nullptr, &host),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // rocSOLVER computes in the precision of the data only
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrf_bufferSize(
+                              handle, params, 1, 1, HIP_R_16F, nullptr, 1, HIP_R_16F, &dev, &host),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXpotrf_bufferSize(handle,
+                                                       params,
+                                                       HIPSOLVER_FILL_MODE_UPPER,
+                                                       1,
+                                                       HIP_R_32F,
+                                                       nullptr,
+                                                       1,
+                                                       HIP_R_64F,
+                                                       &dev,
+                                                       &host),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+#endif
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params), HIPSOLVER_STATUS_SUCCESS);
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+// rocSOLVER takes 32-bit sizes, so larger sizes are rejected rather than truncated
+TEST(API64_BAD_ARG, size)
+{
+    hipsolver_local_handle handle;
+    size_t                 lwork;
+    int64_t                big = int64_t(numeric_limits<int>::max()) + 1;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_64_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, big, nullptr, big, &lwork),
+        HIPSOLVER_STATUS_NOT_SUPPORTED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvd_64_bufferSize(handle, 'N', 'N', big, 1, &lwork),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+}
+#endif
+
+// the 64-bit functions must give the same results as the 32-bit functions
+TEST_P(API64, potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[1], lda = size[2];
+
+    hipsolver_local_handle handle;
+    int                    lwork;
+    size_t                 lwork64;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, n, nullptr, lda, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_64_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, n, nullptr, lda, &lwork64),
+        HIPSOLVER_STATUS_SUCCESS);
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    EXPECT_EQ(lwork64, size_t(lwork));
+#endif
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes64(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(lwork64, 1, lwork64, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    if(lwork64)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    api64_init_spd(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf(handle,
+                                          HIPSOLVER_FILL_MODE_UPPER,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          dWork.data(),
+                                          lwork,
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_64(handle,
+                                             HIPSOLVER_FILL_MODE_UPPER,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             dWork.data(),
+                                             lwork64,
+                                             dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes64.transfer_from(dA));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    EXPECT_EQ(hinfo[0][0], 0);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[0], hARes64[0]), n);
+}
+
+TEST_P(API64, syevd)
+{
+    vector<int> size = GetParam();
+    int         n = size[1], lda = size[2];
+
+    hipsolver_local_handle handle;
+    hipsolverEigMode_t     jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_LOWER;
+    int                    lwork;
+    size_t                 lwork64;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, nullptr, lda, nullptr, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDsyevd_64_bufferSize(handle, jobz, uplo, n, nullptr, lda, nullptr, &lwork64),
+        HIPSOLVER_STATUS_SUCCESS);
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    EXPECT_EQ(lwork64, size_t(lwork));
+#endif
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hD(n, 1, n, 1);
+    host_strided_batch_vector<double>   hD64(n, 1, n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dD(n, 1, n, 1);
+    device_strided_batch_vector<double> dWork(lwork64, 1, lwork64, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    if(lwork64)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    api64_init_spd(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          dD.data(),
+                                          dWork.data(),
+                                          lwork,
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hD.transfer_from(dD));
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd_64(handle,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             dD.data(),
+                                             dWork.data(),
+                                             lwork64,
+                                             dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hD64.transfer_from(dD));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    EXPECT_EQ(hinfo[0][0], 0);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', 1, n, 1, hD[0], hD64[0]), n);
+}
+
+TEST_P(API64, gesvd)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1], lda = size[2];
+
+    hipsolver_local_handle handle;
+    int                    lwork;
+    size_t                 lwork64;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvd_bufferSize(handle, 'N', 'N', m, n, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvd_64_bufferSize(handle, 'N', 'N', m, n, &lwork64),
+                          HIPSOLVER_STATUS_SUCCESS);
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    EXPECT_EQ(lwork64, size_t(lwork));
+#endif
+
+    int k = min(m, n);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hS(k, 1, k, 1);
+    host_strided_batch_vector<double>   hS64(k, 1, k, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dS(k, 1, k, 1);
+    device_strided_batch_vector<double> dE(k, 1, k, 1);
+    device_strided_batch_vector<double> dWork(lwork64, 1, lwork64, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    if(lwork64)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocblas_init<double>(hA, true);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvd(handle,
+                                          'N',
+                                          'N',
+                                          m,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          dS.data(),
+                                          nullptr,
+                                          1,
+                                          nullptr,
+                                          1,
+                                          dWork.data(),
+                                          lwork,
+                                          dE.data(),
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hS.transfer_from(dS));
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvd_64(handle,
+                                             'N',
+                                             'N',
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             dS.data(),
+                                             nullptr,
+                                             1,
+                                             nullptr,
+                                             1,
+                                             dWork.data(),
+                                             lwork64,
+                                             dE.data(),
+                                             dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hS64.transfer_from(dS));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    EXPECT_EQ(hinfo[0][0], 0);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', 1, k, 1, hS[0], hS64[0]), k);
+}
+
+// the generic functions must give the same results as the typed functions
+TEST_P(API64, generic_getrf)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1], lda = size[2];
+    int         k = min(m, n);
+
+    hipsolver_local_handle handle;
+    int                    lwork;
+    size_t                 dev, host;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, m, n, nullptr, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrf_bufferSize(handle,
+                                                       nullptr,
+                                                       m,
+                                                       n,
+                                                       HIP_R_64F,
+                                                       nullptr,
+                                                       lda,
+                                                       HIP_R_64F,
+                                                       &dev,
+                                                       &host),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>    hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>    hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>    hAResX(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>       hIpiv(k, 1, k, 1);
+    host_strided_batch_vector<int64_t>   hIpivX(k, 1, k, 1);
+    host_strided_batch_vector<int>       hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double>  dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double>  dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    device_strided_batch_vector<char>    dBuffer(max(dev, size_t(1)), 1, max(dev, size_t(1)), 1);
+    device_strided_batch_vector<int>     dIpiv(k, 1, k, 1);
+    device_strided_batch_vector<int64_t> dIpivX(k, 1, k, 1);
+    device_strided_batch_vector<int>     dinfo(1, 1, 1, 1);
+    vector<char>                         hBuffer(max(host, size_t(1)));
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dBuffer.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dIpivX.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocblas_init<double>(hA, true);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrf(
+            handle, m, n, dA.data(), lda, dWork.data(), lwork, dIpiv.data(), dinfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXgetrf(handle,
+                                            nullptr,
+                                            m,
+                                            n,
+                                            HIP_R_64F,
+                                            dA.data(),
+                                            lda,
+                                            dIpivX.data(),
+                                            HIP_R_64F,
+                                            dBuffer.data(),
+                                            dev,
+                                            hBuffer.data(),
+                                            host,
+                                            dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hAResX.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivX.transfer_from(dIpivX));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    EXPECT_EQ(hinfo[0][0], 0);
+    for(int i = 0; i < k; i++)
+        EXPECT_EQ(hIpivX[0][i], int64_t(hIpiv[0][i]));
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', m, n, lda, hARes[0], hAResX[0]), m);
+}
+
+TEST_P(API64, generic_potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[1], lda = size[2];
+
+    hipsolver_local_handle handle;
+    hipsolverDnParams_t    params;
+    size_t                 lwork64, dev, host;
+
+    CHECK_ROCBLAS_ERROR(hipsolverDnCreateParams(&params));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_64_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, n, nullptr, lda, &lwork64),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXpotrf_bufferSize(handle,
+                                                       params,
+                                                       HIPSOLVER_FILL_MODE_UPPER,
+                                                       n,
+                                                       HIP_R_64F,
+                                                       nullptr,
+                                                       lda,
+                                                       HIP_R_64F,
+                                                       &dev,
+                                                       &host),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    size_t size_w = max(max(lwork64, dev), size_t(1));
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hAResX(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<char>   dWork(size_w, 1, size_w, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    vector<char>                        hBuffer(max(host, size_t(1)));
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    api64_init_spd(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_64(handle,
+                                             HIPSOLVER_FILL_MODE_UPPER,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             (double*)dWork.data(),
+                                             lwork64,
+                                             dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDnXpotrf(handle,
+                                            params,
+                                            HIPSOLVER_FILL_MODE_UPPER,
+                                            n,
+                                            HIP_R_64F,
+                                            dA.data(),
+                                            lda,
+                                            HIP_R_64F,
+                                            dWork.data(),
+                                            dev,
+                                            hBuffer.data(),
+                                            host,
+                                            dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hAResX.transfer_from(dA));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_EQ(hinfo[0][0], 0);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[0], hAResX[0]), n);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, API64, ValuesIn(api64_size_range));
@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include <cstdlib>
+#include <fstream>
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, lda}
+const vector<vector<int>> autotune_size_range = {{1, 1}, {20, 20}, {70, 80}, {300, 300}};
+
+class AUTOTUNE : public ::TestWithParam<vector<int>>
+{
+protected:
+    AUTOTUNE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates a diagonally dominant symmetric matrix
+static void autotune_init(host_strided_batch_vector<double>& hA, int n, int lda)
+{
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * lda] = hA[0][i + j * lda];
+        hA[0][i + i * lda] += 10 * n;
+    }
+}
+
+TEST(AUTOTUNE_MODE, bad_arg)
+{
+    hipsolver_local_handle  handle;
+    hipsolverAutotuneMode_t mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(nullptr, HIPSOLVER_AUTOTUNE_ON),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(nullptr, &mode),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(handle, hipsolverAutotuneMode_t(-1)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+}
+
+TEST(AUTOTUNE_MODE, set_get)
+{
+    hipsolver_local_handle  handle;
+    hipsolverAutotuneMode_t mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(handle, HIPSOLVER_AUTOTUNE_ON),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_AUTOTUNE_ON);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(handle, HIPSOLVER_AUTOTUNE_OFF),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_AUTOTUNE_OFF);
+}
+
+// handles created while HIPSOLVER_AUTOTUNE_PATH is set start enabled, and save their selections
+TEST(AUTOTUNE_MODE, cache_file)
+{
+    string path = testing::TempDir() + "hipsolver_autotune_gtest.txt";
+    remove(path.c_str());
+    setenv("HIPSOLVER_AUTOTUNE_PATH", path.c_str(), 1);
+
+    hipsolverHandle_t       handle;
+    hipsolverAutotuneMode_t mode;
+    int                     n = 40, lwork;
+    CHECK_ROCBLAS_ERROR(hipsolverCreate(&handle));
+    unsetenv("HIPSOLVER_AUTOTUNE_PATH");
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_AUTOTUNE_ON);
+
+    host_strided_batch_vector<double>   hA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    autotune_init(hA, n, n);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrf_bufferSize(handle, n, n, dA.data(), n, &lwork));
+    device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf(handle,
+                                          n,
+                                          n,
+                                          dA.data(),
+                                          n,
+                                          dWork.data(),
+                                          lwork,
+                                          dIpiv.data(),
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_ROCBLAS_ERROR(hipsolverDestroy(handle));
+
+    // cuSOLVER has no runtime choice of algorithm to tune for getrf
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    ifstream file(path);
+    string   header;
+    int      version = 0;
+    file >> header >> version;
+    EXPECT_EQ(header, "hipsolver-autotune");
+    EXPECT_EQ(version, 1);
+#endif
+    remove(path.c_str());
+}
+
+// the first call of an unseen shape selects an algorithm, and the second reuses it; both must
+// give the factorization of a handle without autotuning
+TEST_P(AUTOTUNE, getrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1];
+
+    hipsolver_local_handle handle, tuned;
+    int                    lwork;
+
+    CHECK_ROCBLAS_ERROR(hipsolverSetAutotuneMode(handle, HIPSOLVER_AUTOTUNE_OFF));
+    CHECK_ROCBLAS_ERROR(hipsolverSetAutotuneMode(tuned, HIPSOLVER_AUTOTUNE_ON));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrf_bufferSize(handle, n, n, nullptr, lda, &lwork));
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hATuned(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    autotune_init(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrf(
+        handle, n, n, dA.data(), lda, dWork.data(), lwork, dIpiv.data(), dinfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    for(int call = 0; call < 2; call++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDgetrf(
+                tuned, n, n, dA.data(), lda, dWork.data(), lwork, dIpiv.data(), dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hATuned.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+        EXPECT_EQ(hinfo[0][0], 0);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[0], hATuned[0]), n);
+    }
+}
+
+TEST_P(AUTOTUNE, potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1];
+
+    hipsolver_local_handle handle, tuned;
+    int                    lwork;
+
+    CHECK_ROCBLAS_ERROR(hipsolverSetAutotuneMode(handle, HIPSOLVER_AUTOTUNE_OFF));
+    CHECK_ROCBLAS_ERROR(hipsolverSetAutotuneMode(tuned, HIPSOLVER_AUTOTUNE_ON));
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDpotrf_bufferSize(handle, HIPSOLVER_FILL_MODE_LOWER, n, nullptr, lda, &lwork));
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hATuned(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    autotune_init(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrf(
+        handle, HIPSOLVER_FILL_MODE_LOWER, n, dA.data(), lda, dWork.data(), lwork, dinfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    for(int call = 0; call < 2; call++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrf(tuned,
+                                              HIPSOLVER_FILL_MODE_LOWER,
+                                              n,
+                                              dA.data(),
+                                              lda,
+                                              dWork.data(),
+                                              lwork,
+                                              dinfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hATuned.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+        EXPECT_EQ(hinfo[0][0], 0);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[0], hATuned[0]), n);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, AUTOTUNE, ValuesIn(autotune_size_range));
@@ -0,0 +1,482 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, kl, ku, batch_count}; pbtrf uses kd = kl
+const vector<vector<int>> band_size_range
+    = {{1, 0, 0, 1}, {10, 1, 2, 3}, {64, 3, 0, 2}, {65, 0, 4, 2}, {150, 8, 5, 4}, {300, 70, 20, 2}};
+
+const int band_nrhs = 3;
+
+class BAND : public ::TestWithParam<vector<int>>
+{
+protected:
+    BAND() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates the batch of bc matrices of order n in A, dense, with kl subdiagonals and ku
+// superdiagonals. The matrices are diagonally dominant and symmetric if sym is true; if pivot is
+// true, they are generated with one subdiagonal and superdiagonal less and their rows 2i and
+// 2i + 1 are interchanged, so that the factorization has pivoting to do.
+static void band_init(vector<double>& A, int n, int kl, int ku, int bc, bool sym, bool pivot)
+{
+    host_strided_batch_vector<double> hR(n * n * bc, 1, n * n * bc, 1);
+    rocblas_init<double>(hR, true);
+    int dl = pivot ? kl - 1 : kl, du = pivot ? ku - 1 : ku;
+
+    A.assign(size_t(n) * n * bc, 0);
+    for(int b = 0; b < bc; b++)
+    {
+        double* M = A.data() + size_t(b) * n * n;
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = max(0, j - du); i <= min(n - 1, j + dl); i++)
+            {
+                if(sym && i < j)
+                    continue;
+                M[i + j * n] = (hR[0][b * n * n + i + j * n] - 5.5) / 10;
+                if(i == j)
+                    M[i + j * n] += kl + ku + 1;
+                if(sym)
+                    M[j + i * n] = M[i + j * n];
+            }
+        }
+        for(int i = 0; pivot && i + 1 < n; i += 2)
+            for(int j = 0; j < n; j++)
+                swap(M[i + j * n], M[i + 1 + j * n]);
+    }
+}
+
+// copies matrix b of A to the band storage AB with kl subdiagonals and ku superdiagonals, where
+// entry (i, j) is at AB[shift + i - j + j * ldab]
+static void band_pack(
+    const vector<double>& A, int n, int b, int kl, int ku, int shift, int ldab, double* AB)
+{
+    const double* M = A.data() + size_t(b) * n * n;
+    for(int j = 0; j < n; j++)
+        for(int i = max(0, j - ku); i <= min(n - 1, j + kl); i++)
+            AB[shift + i - j + j * ldab] = M[i + j * n];
+}
+
+// B = op(A) * X for matrix b of A and the band_nrhs columns of X, with leading dimension ldb
+static void band_rhs(
+    const vector<double>& A, int n, int b, bool trans, const double* X, double* B, int ldb)
+{
+    const double* M = A.data() + size_t(b) * n * n;
+    for(int c = 0; c < band_nrhs; c++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            double sum = 0;
+            for(int j = 0; j < n; j++)
+                sum += (trans ? M[j + i * n] : M[i + j * n]) * X[j + c * ldb];
+            B[i + c * ldb] = sum;
+        }
+    }
+}
+
+TEST(BAND_BAD_ARG, gbtrf)
+{
+    hipsolver_local_handle              handle;
+    int                                 n = 4, kl = 1, ku = 1, ldab = 4, lw;
+    device_strided_batch_vector<double> dAB(ldab * n, 1, ldab * n, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgbtrf_bufferSize(nullptr, n, kl, ku, dAB.data(), ldab, &lw),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgbtrf_bufferSize(handle, n, kl, ku, dAB.data(), ldab - 1, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgbtrf_bufferSize(handle, n, -1, ku, dAB.data(), ldab, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgbtrf_bufferSize(handle, n, kl, ku, dAB.data(), ldab, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgbtrs_bufferSize(
+            handle, HIPSOLVER_OP_N, n, kl, ku, 1, dAB.data(), ldab, nullptr, nullptr, n - 1, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrf_bufferSize(handle, n, kl, ku, dAB.data(), ldab, &lw));
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverDgbtrf(handle,
+                                          n,
+                                          kl,
+                                          ku,
+                                          dAB.data(),
+                                          ldab,
+                                          dWork.data(),
+                                          lw - 1,
+                                          dIpiv.data(),
+                                          dInfo.data()),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgbtrf(
+            handle, n, kl, ku, dAB.data(), ldab, dWork.data(), lw, nullptr, dInfo.data()),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST(BAND_BAD_ARG, pbtrf)
+{
+    hipsolver_local_handle              handle;
+    int                                 n = 4, kd = 1, ldab = 2, lw;
+    device_strided_batch_vector<double> dAB(ldab * n, 1, ldab * n, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpbtrf_bufferSize(
+                              nullptr, HIPSOLVER_FILL_MODE_LOWER, n, kd, dAB.data(), ldab, &lw),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpbtrf_bufferSize(handle, hipsolverFillMode_t(-1), n, kd, dAB.data(), ldab, &lw),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpbtrf_bufferSize(
+                              handle, HIPSOLVER_FILL_MODE_LOWER, n, kd, dAB.data(), kd, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpbtrfStridedBatched_bufferSize(handle,
+                                                                   HIPSOLVER_FILL_MODE_UPPER,
+                                                                   n,
+                                                                   kd,
+                                                                   dAB.data(),
+                                                                   ldab,
+                                                                   ldab * n - 1,
+                                                                   &lw,
+                                                                   2),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+// gbtrf and gbtrs factorize and solve with a band storage that has one unused row, and with B of
+// leading dimension n + 1
+TEST_P(BAND, gbtrf_gbtrs)
+{
+    int n = GetParam()[0], kl = GetParam()[1], ku = GetParam()[2];
+    int ldab = 2 * kl + ku + 2, ldb = n + 1, lw, lwf, lws;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hAB(ldab * n, 1, ldab * n, 1);
+    host_strided_batch_vector<double>   hX(ldb * band_nrhs, 1, ldb * band_nrhs, 1);
+    host_strided_batch_vector<double>   hB(ldb * band_nrhs, 1, ldb * band_nrhs, 1);
+    host_strided_batch_vector<int>      hInfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dAB(ldab * n, 1, ldab * n, 1);
+    device_strided_batch_vector<double> dB(ldb * band_nrhs, 1, ldb * band_nrhs, 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    vector<double> A;
+    band_init(A, n, kl, ku, 1, false, kl > 0 && ku > 0);
+    rocblas_init<double>(hAB, true);
+    band_pack(A, n, 0, kl, ku, kl + ku, ldab, hAB[0]);
+    rocblas_init<double>(hX, true);
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrf_bufferSize(handle, n, kl, ku, dAB.data(), ldab, &lwf));
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrs_bufferSize(handle,
+                                                   HIPSOLVER_OP_N,
+                                                   n,
+                                                   kl,
+                                                   ku,
+                                                   band_nrhs,
+                                                   dAB.data(),
+                                                   ldab,
+                                                   dIpiv.data(),
+                                                   dB.data(),
+                                                   ldb,
+                                                   &lws));
+    lw = max(max(lwf, lws), 1);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrf(
+        handle, n, kl, ku, dAB.data(), ldab, dWork.data(), lwf, dIpiv.data(), dInfo.data()));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    EXPECT_EQ(hInfo[0][0], 0);
+
+    for(hipsolverOperation_t trans : {HIPSOLVER_OP_N, HIPSOLVER_OP_T})
+    {
+        band_rhs(A, n, 0, trans != HIPSOLVER_OP_N, hX[0], hB[0], ldb);
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_ROCBLAS_ERROR(hipsolverDgbtrs(handle,
+                                            trans,
+                                            n,
+                                            kl,
+                                            ku,
+                                            band_nrhs,
+                                            dAB.data(),
+                                            ldab,
+                                            dIpiv.data(),
+                                            dB.data(),
+                                            ldb,
+                                            dWork.data(),
+                                            lws,
+                                            dInfo.data()));
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, band_nrhs, ldb, hX[0], hB[0]), n);
+    }
+}
+
+// the strided batched variants solve matrices that are ldab * n + 5 apart
+TEST_P(BAND, gbtrfStridedBatched_gbtrsStridedBatched)
+{
+    int n = GetParam()[0], kl = GetParam()[1], ku = GetParam()[2], bc = GetParam()[3];
+    int ldab = 2 * kl + ku + 1, ldb = n, sab = ldab * n + 5, sb = ldb * band_nrhs, lwf, lws;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hAB(sab * bc, 1, sab * bc, 1);
+    host_strided_batch_vector<double>   hX(sb * bc, 1, sb * bc, 1);
+    host_strided_batch_vector<double>   hB(sb * bc, 1, sb * bc, 1);
+    host_strided_batch_vector<int>      hInfo(bc, 1, bc, 1);
+    device_strided_batch_vector<double> dAB(sab * bc, 1, sab * bc, 1);
+    device_strided_batch_vector<double> dB(sb * bc, 1, sb * bc, 1);
+    device_strided_batch_vector<int>    dIpiv(n * bc, 1, n * bc, 1);
+    device_strided_batch_vector<int>    dInfo(bc, 1, bc, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    vector<double> A;
+    band_init(A, n, kl, ku, bc, false, kl > 0 && ku > 0);
+    rocblas_init<double>(hAB, true);
+    rocblas_init<double>(hX, true);
+    for(int b = 0; b < bc; b++)
+    {
+        band_pack(A, n, b, kl, ku, kl + ku, ldab, hAB[0] + b * sab);
+        band_rhs(A, n, b, false, hX[0] + b * sb, hB[0] + b * sb, ldb);
+    }
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrfStridedBatched_bufferSize(
+        handle, n, kl, ku, dAB.data(), ldab, sab, &lwf, bc));
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrsStridedBatched_bufferSize(handle,
+                                                                 HIPSOLVER_OP_N,
+                                                                 n,
+                                                                 kl,
+                                                                 ku,
+                                                                 band_nrhs,
+                                                                 dAB.data(),
+                                                                 ldab,
+                                                                 sab,
+                                                                 dIpiv.data(),
+                                                                 n,
+                                                                 dB.data(),
+                                                                 ldb,
+                                                                 sb,
+                                                                 &lws,
+                                                                 bc));
+    int                                 lw = max(max(lwf, lws), 1);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrfStridedBatched(handle,
+                                                      n,
+                                                      kl,
+                                                      ku,
+                                                      dAB.data(),
+                                                      ldab,
+                                                      sab,
+                                                      dWork.data(),
+                                                      lwf,
+                                                      dIpiv.data(),
+                                                      n,
+                                                      dInfo.data(),
+                                                      bc));
+    CHECK_ROCBLAS_ERROR(hipsolverDgbtrsStridedBatched(handle,
+                                                      HIPSOLVER_OP_N,
+                                                      n,
+                                                      kl,
+                                                      ku,
+                                                      band_nrhs,
+                                                      dAB.data(),
+                                                      ldab,
+                                                      sab,
+                                                      dIpiv.data(),
+                                                      n,
+                                                      dB.data(),
+                                                      ldb,
+                                                      sb,
+                                                      dWork.data(),
+                                                      lws,
+                                                      dInfo.data(),
+                                                      bc));
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    for(int b = 0; b < bc; b++)
+        EXPECT_EQ(hInfo[0][b], 0);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, band_nrhs * bc, ldb, hX[0], hB[0]), n);
+}
+
+// pbtrf and pbtrs factorize and solve with both triangles, with kd = kl
+TEST_P(BAND, pbtrf_pbtrs)
+{
+    int n = GetParam()[0], kd = GetParam()[1], ldab = kd + 1, ldb = n, lwf, lws;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hAB(ldab * n, 1, ldab * n, 1);
+    host_strided_batch_vector<double>   hX(ldb * band_nrhs, 1, ldb * band_nrhs, 1);
+    host_strided_batch_vector<double>   hB(ldb * band_nrhs, 1, ldb * band_nrhs, 1);
+    host_strided_batch_vector<int>      hInfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dAB(ldab * n, 1, ldab * n, 1);
+    device_strided_batch_vector<double> dB(ldb * band_nrhs, 1, ldb * band_nrhs, 1);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    vector<double> A;
+    band_init(A, n, kd, kd, 1, true, false);
+    rocblas_init<double>(hX, true);
+    band_rhs(A, n, 0, false, hX[0], hB[0], ldb);
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        bool lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+        band_pack(A, n, 0, lower ? kd : 0, lower ? 0 : kd, lower ? 0 : kd, ldab, hAB[0]);
+        CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+        CHECK_ROCBLAS_ERROR(
+            hipsolverDpbtrf_bufferSize(handle, uplo, n, kd, dAB.data(), ldab, &lwf));
+        CHECK_ROCBLAS_ERROR(hipsolverDpbtrs_bufferSize(
+            handle, uplo, n, kd, band_nrhs, dAB.data(), ldab, dB.data(), ldb, &lws));
+        int                                 lw = max(max(lwf, lws), 1);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+        CHECK_ROCBLAS_ERROR(hipsolverDpbtrf(
+            handle, uplo, n, kd, dAB.data(), ldab, dWork.data(), lwf, dInfo.data()));
+        CHECK_ROCBLAS_ERROR(hipsolverDpbtrs(handle,
+                                            uplo,
+                                            n,
+                                            kd,
+                                            band_nrhs,
+                                            dAB.data(),
+                                            ldab,
+                                            dB.data(),
+                                            ldb,
+                                            dWork.data(),
+                                            lws,
+                                            dInfo.data()));
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+        EXPECT_EQ(hInfo[0][0], 0);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, band_nrhs, ldb, hX[0], hB[0]), n);
+    }
+}
+
+// pbtrfStridedBatched reports the leading minor that is not positive definite in the last
+// matrix of the batch
+TEST_P(BAND, pbtrfStridedBatched_pbtrsStridedBatched)
+{
+    int n = GetParam()[0], kd = GetParam()[1], bc = GetParam()[3];
+    int ldab = kd + 1, ldb = n, sab = ldab * n, sb = ldb * band_nrhs, lwf, lws;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hAB(sab * bc, 1, sab * bc, 1);
+    host_strided_batch_vector<double>   hX(sb * bc, 1, sb * bc, 1);
+    host_strided_batch_vector<double>   hB(sb * bc, 1, sb * bc, 1);
+    host_strided_batch_vector<int>      hInfo(bc, 1, bc, 1);
+    device_strided_batch_vector<double> dAB(sab * bc, 1, sab * bc, 1);
+    device_strided_batch_vector<double> dB(sb * bc, 1, sb * bc, 1);
+    device_strided_batch_vector<int>    dInfo(bc, 1, bc, 1);
+    CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    vector<double> A;
+    int            bad = n / 2;
+    band_init(A, n, kd, kd, bc, true, false);
+    rocblas_init<double>(hX, true);
+    if(bc > 1)
+        A[size_t(bc - 1) * n * n + bad + bad * n] = -1;
+    for(int b = 0; b < bc; b++)
+    {
+        band_pack(A, n, b, kd, 0, 0, ldab, hAB[0] + b * sab);
+        band_rhs(A, n, b, false, hX[0] + b * sb, hB[0] + b * sb, ldb);
+    }
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDpbtrfStridedBatched_bufferSize(
+        handle, HIPSOLVER_FILL_MODE_LOWER, n, kd, dAB.data(), ldab, sab, &lwf, bc));
+    CHECK_ROCBLAS_ERROR(hipsolverDpbtrsStridedBatched_bufferSize(handle,
+                                                                 HIPSOLVER_FILL_MODE_LOWER,
+                                                                 n,
+                                                                 kd,
+                                                                 band_nrhs,
+                                                                 dAB.data(),
+                                                                 ldab,
+                                                                 sab,
+                                                                 dB.data(),
+                                                                 ldb,
+                                                                 sb,
+                                                                 &lws,
+                                                                 bc));
+    int                                 lw = max(max(lwf, lws), 1);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDpbtrfStridedBatched(handle,
+                                                      HIPSOLVER_FILL_MODE_LOWER,
+                                                      n,
+                                                      kd,
+                                                      dAB.data(),
+                                                      ldab,
+                                                      sab,
+                                                      dWork.data(),
+                                                      lwf,
+                                                      dInfo.data(),
+                                                      bc));
+    CHECK_ROCBLAS_ERROR(hipsolverDpbtrsStridedBatched(handle,
+                                                      HIPSOLVER_FILL_MODE_LOWER,
+                                                      n,
+                                                      kd,
+                                                      band_nrhs,
+                                                      dAB.data(),
+                                                      ldab,
+                                                      sab,
+                                                      dB.data(),
+                                                      ldb,
+                                                      sb,
+                                                      dWork.data(),
+                                                      lws,
+                                                      dInfo.data(),
+                                                      bc));
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    // the solves of the last matrix are not meaningful when it is not positive definite
+    int good = bc > 1 ? bc - 1 : bc;
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, band_nrhs * good, ldb, hX[0], hB[0]), n);
+
+    // pbtrs resets the infos, so the factorization is run again to read them
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    CHECK_ROCBLAS_ERROR(hipsolverDpbtrfStridedBatched(handle,
+                                                      HIPSOLVER_FILL_MODE_LOWER,
+                                                      n,
+                                                      kd,
+                                                      dAB.data(),
+                                                      ldab,
+                                                      sab,
+                                                      dWork.data(),
+                                                      lwf,
+                                                      dInfo.data(),
+                                                      bc));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    for(int b = 0; b < bc; b++)
+        EXPECT_EQ(hInfo[0][b], b == bc - 1 && bc > 1 ? bad + 1 : 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, BAND, ValuesIn(band_size_range));
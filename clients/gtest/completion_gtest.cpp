@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include <mutex>
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, lda}
+const vector<vector<int>> completion_size_range = {{1, 1}, {10, 10}, {20, 30}};
+
+class COMPLETION : public ::TestWithParam<vector<int>>
+{
+protected:
+    COMPLETION() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// the completions reported to the callback, in order
+struct completion_record
+{
+    mutex          lock;
+    vector<string> routines;
+    vector<int>    infos;
+    int            unknown = 0;
+};
+
+static void completion_callback(
+    hipsolverHandle_t handle, const char* routine, const int* info, int count, void* user_data)
+{
+    completion_record* rec = (completion_record*)user_data;
+    lock_guard<mutex>  lock(rec->lock);
+
+    rec->routines.push_back(routine ? routine : "");
+    if(!info)
+        rec->unknown++;
+    else
+        for(int i = 0; i < count; i++)
+            rec->infos.push_back(info[i]);
+}
+
+TEST(COMPLETION_API, bad_arg)
+{
+    hipsolver_local_handle    handle;
+    hipsolverCompletionMode_t mode;
+    hipEvent_t                event;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionMode(nullptr, HIPSOLVER_COMPLETION_MODE_EVENT),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionMode(nullptr, &mode),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionEvent(nullptr, &event),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionCallback(nullptr, completion_callback, nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionMode(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionMode(handle, hipsolverCompletionMode_t(-1)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // the event is only available while it is recorded
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionEvent(handle, &event),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionMode(handle, HIPSOLVER_COMPLETION_MODE_EVENT),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionEvent(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST(COMPLETION_API, set_get)
+{
+    hipsolver_local_handle    handle;
+    hipsolverCompletionMode_t mode;
+    hipEvent_t                event = nullptr;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_COMPLETION_MODE_DEFAULT);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionMode(handle, HIPSOLVER_COMPLETION_MODE_EVENT),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_COMPLETION_MODE_EVENT);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionEvent(handle, &event), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_NE(event, nullptr);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionMode(handle, HIPSOLVER_COMPLETION_MODE_DEFAULT),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_COMPLETION_MODE_DEFAULT);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionCallback(handle, completion_callback, nullptr),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionCallback(handle, nullptr, nullptr),
+                          HIPSOLVER_STATUS_SUCCESS);
+}
+
+// three Cholesky factorizations, of which only the second one fails, must each be reported to
+// the callback with their info value by the time the completion event of the last one completes
+TEST_P(COMPLETION, potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1];
+
+    // the handle is destroyed before the record of its callbacks
+    completion_record      rec;
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    lwork;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionMode(handle, HIPSOLVER_COMPLETION_MODE_EVENT),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetCompletionCallback(handle, completion_callback, &rec),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, nullptr, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hB(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(lwork, 1, lwork, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    if(lwork)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // hA is positive definite, while hB has a negative leading entry
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * lda] = hA[0][i + j * lda];
+        hA[0][i + i * lda] += 400;
+    }
+    for(int i = 0; i < lda * n; i++)
+        hB[0][i] = hA[0][i];
+    hB[0][0] = -1;
+
+    for(int k = 0; k < 3; k++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(k == 1 ? hB : hA));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrf(handle, uplo, n, dA.data(), lda, dWork.data(), lwork, dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+    }
+
+    hipEvent_t event;
+    EXPECT_ROCBLAS_STATUS(hipsolverGetCompletionEvent(handle, &event), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+    lock_guard<mutex> lock(rec.lock);
+    ASSERT_EQ(rec.routines.size(), 3);
+    EXPECT_EQ(rec.unknown, 0);
+    ASSERT_EQ(rec.infos.size(), 3);
+    for(int k = 0; k < 3; k++)
+        EXPECT_EQ(rec.routines[k], "hipsolverDpotrf");
+    EXPECT_EQ(rec.infos[0], 0);
+    EXPECT_EQ(rec.infos[1], 1);
+    EXPECT_EQ(rec.infos[2], 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, COMPLETION, ValuesIn(completion_size_range));
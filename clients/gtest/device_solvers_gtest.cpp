@@ -0,0 +1,156 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include "hipsolver_device.hpp"
+
+using ::testing::Test;
+using namespace std;
+
+// the device solvers are also callable from host code, where they are checked against the
+// residuals of the problems they solve
+
+const int device_nrhs = 2;
+
+// generates a well conditioned symmetric matrix of order N, with leading dimension LDA
+template <int N, int LDA>
+static void device_init(double* A)
+{
+    host_strided_batch_vector<double> hA(LDA * N, 1, LDA * N, 1);
+    rocblas_init<double>(hA, true);
+    for(int j = 0; j < N; j++)
+    {
+        for(int i = 0; i < LDA; i++)
+            A[i + j * LDA] = hA[0][i + j * LDA];
+        for(int i = 0; i < j; i++)
+            A[j + i * LDA] = A[i + j * LDA];
+        A[j + j * LDA] += 10 * N;
+    }
+}
+
+// B = op(A) * X
+template <int N, int LDA>
+static void device_rhs(hipsolverOperation_t trans, const double* A, const double* X, double* B)
+{
+    for(int c = 0; c < device_nrhs; c++)
+    {
+        for(int i = 0; i < N; i++)
+        {
+            double sum = 0;
+            for(int j = 0; j < N; j++)
+                sum += (trans == HIPSOLVER_OP_N ? A[i + j * LDA] : A[j + i * LDA]) * X[j + c * N];
+            B[i + c * N] = sum;
+        }
+    }
+}
+
+template <int N, int LDA = N>
+static void device_potrf_potrs()
+{
+    double A[LDA * N], F[LDA * N], X[N * device_nrhs], B[N * device_nrhs];
+    device_init<N, LDA>(A);
+    for(double& x : X)
+        x = random_generator<double>();
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        copy(A, A + LDA * N, F);
+        device_rhs<N, LDA>(HIPSOLVER_OP_N, A, X, B);
+        EXPECT_EQ((hipsolver::device::potrf<double, N, LDA>(uplo, F)), 0);
+        hipsolver::device::potrs<double, N, device_nrhs, LDA>(uplo, F, B);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', N, device_nrhs, N, X, B), N);
+    }
+}
+
+template <int N, int LDA = N>
+static void device_getrf_getrs()
+{
+    double A[LDA * N], F[LDA * N], X[N * device_nrhs], B[N * device_nrhs];
+    int    ipiv[N];
+    device_init<N, LDA>(A);
+    for(double& x : X)
+        x = random_generator<double>();
+
+    // a nonsymmetric matrix whose first column needs pivoting
+    for(int j = 1; j < N; j++)
+        A[0 + j * LDA] *= -2;
+    A[0] = 0;
+
+    for(hipsolverOperation_t trans : {HIPSOLVER_OP_N, HIPSOLVER_OP_T})
+    {
+        copy(A, A + LDA * N, F);
+        device_rhs<N, LDA>(trans, A, X, B);
+        EXPECT_EQ((hipsolver::device::getrf<double, N, N, LDA>(F, ipiv)), 0);
+        hipsolver::device::getrs<double, N, device_nrhs, LDA>(trans, F, ipiv, B);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', N, device_nrhs, N, X, B), N * N);
+    }
+}
+
+template <int N, int LDA = N>
+static void device_syevj()
+{
+    double A[LDA * N], V[LDA * N], W[N];
+    device_init<N, LDA>(A);
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        copy(A, A + LDA * N, V);
+        EXPECT_EQ(
+            (hipsolver::device::syevj<double, N, LDA>(HIPSOLVER_EIG_MODE_VECTOR, uplo, V, W)), 0);
+
+        // A * v = w * v, in ascending order of w
+        double err = 0;
+        for(int k = 0; k < N; k++)
+        {
+            if(k > 0)
+                EXPECT_LE(W[k - 1], W[k]);
+            for(int i = 0; i < N; i++)
+            {
+                double sum = 0;
+                for(int j = 0; j < N; j++)
+                    sum += A[i + j * LDA] * V[j + k * LDA];
+                err = max(err, abs(sum - W[k] * V[i + k * LDA]));
+            }
+        }
+        ROCSOLVER_TEST_CHECK(double, err / (10 * N), N);
+    }
+}
+
+TEST(DEVICE_SOLVERS, potrf_potrs)
+{
+    device_potrf_potrs<1>();
+    device_potrf_potrs<3>();
+    device_potrf_potrs<4, 5>();
+    device_potrf_potrs<8>();
+    device_potrf_potrs<16>();
+}
+
+TEST(DEVICE_SOLVERS, getrf_getrs)
+{
+    device_getrf_getrs<2>();
+    device_getrf_getrs<3>();
+    device_getrf_getrs<6, 7>();
+    device_getrf_getrs<8>();
+    device_getrf_getrs<16>();
+}
+
+TEST(DEVICE_SOLVERS, syevj)
+{
+    device_syevj<1>();
+    device_syevj<3>();
+    device_syevj<4, 5>();
+    device_syevj<8>();
+    device_syevj<16>();
+}
+
+TEST(DEVICE_SOLVERS, info)
+{
+    // a matrix that is not positive definite, and a singular one
+    double A[4] = {1, 0, 0, -1};
+    double B[4] = {0, 0, 0, 1};
+    int    ipiv[2];
+    EXPECT_EQ((hipsolver::device::potrf<double, 2>(HIPSOLVER_FILL_MODE_LOWER, A)), 2);
+    EXPECT_EQ((hipsolver::device::getrf<double, 2>(B, ipiv)), 1);
+}
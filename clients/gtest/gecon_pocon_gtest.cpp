@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n}
+const vector<vector<int>> con_size_range = {{1}, {2}, {20}, {64}, {100}};
+
+const int con_batch_count = 3;
+
+class GECON_POCON : public ::TestWithParam<vector<int>>
+{
+protected:
+    GECON_POCON() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// the 1-norm of A, or its infinity-norm
+static double con_norm(const double* A, int n, bool one_norm)
+{
+    double norm = 0;
+    for(int j = 0; j < n; j++)
+    {
+        double sum = 0;
+        for(int i = 0; i < n; i++)
+            sum += abs(one_norm ? A[i + j * n] : A[j + i * n]);
+        norm = max(norm, sum);
+    }
+    return norm;
+}
+
+// the exact reciprocal condition number of A, with the inverse computed by Gauss-Jordan
+// elimination with partial pivoting
+static double con_exact(const double* A, int n, bool one_norm)
+{
+    vector<double> W(A, A + size_t(n) * n), X(size_t(n) * n, 0);
+    for(int i = 0; i < n; i++)
+        X[i + i * n] = 1;
+    for(int k = 0; k < n; k++)
+    {
+        int p = k;
+        for(int i = k + 1; i < n; i++)
+            if(abs(W[i + k * n]) > abs(W[p + k * n]))
+                p = i;
+        for(int j = 0; j < n; j++)
+        {
+            swap(W[k + j * n], W[p + j * n]);
+            swap(X[k + j * n], X[p + j * n]);
+        }
+        double d = W[k + k * n];
+        for(int j = 0; j < n; j++)
+        {
+            W[k + j * n] /= d;
+            X[k + j * n] /= d;
+        }
+        for(int i = 0; i < n; i++)
+        {
+            double f = W[i + k * n];
+            if(i == k || f == 0)
+                continue;
+            for(int j = 0; j < n; j++)
+            {
+                W[i + j * n] -= f * W[k + j * n];
+                X[i + j * n] -= f * X[k + j * n];
+            }
+        }
+    }
+    return 1 / (con_norm(A, n, one_norm) * con_norm(X.data(), n, one_norm));
+}
+
+// the estimate never exceeds the norm of the inverse, and is seldom far below it
+static void con_check(double rcond, double exact)
+{
+    EXPECT_GE(rcond, exact * (1 - 1e-8));
+    EXPECT_LE(rcond, exact * 10);
+}
+
+// general matrices with rows of growing scale, and symmetric positive definite matrices
+static void con_init(host_strided_batch_vector<double>& hA, int n, int bc, bool spd)
+{
+    rocblas_init<double>(hA, true);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            if(spd)
+            {
+                for(int j = 0; j < i; j++)
+                    hA[b][j + i * n] = hA[b][i + j * n];
+                hA[b][i + i * n] += 40 + i;
+            }
+            else
+            {
+                hA[b][i + i * n] += 20;
+                for(int j = 0; j < n; j++)
+                    hA[b][i + j * n] *= 1 + i;
+            }
+        }
+    }
+}
+
+TEST(GECON_POCON_BAD_ARG, gecon)
+{
+    hipsolver_local_handle              handle;
+    hipsolverNormType_t                 norm = HIPSOLVER_NORM_ONE;
+    device_strided_batch_vector<double> dA(100, 1, 100, 1);
+    double                              anorm = 1, rcond;
+    int                                 lw;
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgecon_bufferSize(nullptr, norm, 10, dA.data(), 10, &lw),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgecon_bufferSize(handle, hipsolverNormType_t(-1), 10, dA.data(), 10, &lw),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgecon_bufferSize(handle, norm, 10, dA.data(), 9, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgecon_bufferSize(handle, norm, 10, dA.data(), 10, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgecon_bufferSize(handle, norm, 10, dA.data(), 10, &lw),
+                          HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgecon(nullptr, norm, 10, dA.data(), 10, anorm, &rcond, dWork.data(), lw),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgecon(handle, norm, -1, dA.data(), 10, anorm, &rcond, dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgecon(handle, norm, 10, dA.data(), 10, -1, &rcond, dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgecon(handle, norm, 10, dA.data(), 10, anorm, nullptr, dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the workspace is too small
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgecon(handle, norm, 10, dA.data(), 10, anorm, &rcond, dWork.data(), lw - 1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // quick return
+    EXPECT_ROCBLAS_STATUS(hipsolverDgecon(handle, norm, 0, nullptr, 1, 0, &rcond, nullptr, 0),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(rcond, 1);
+
+    // a zero matrix is singular
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgecon(handle, norm, 10, dA.data(), 10, 0, &rcond, dWork.data(), lw),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(rcond, 0);
+}
+
+// the estimates from the factors of getrf must bound the exact reciprocal condition numbers in
+// both norms, and the batched estimates must match those of the single matrices
+TEST_P(GECON_POCON, gecon)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], bc = con_batch_count;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hA(n * n, 1, n * n, bc);
+    host_batch_vector<double>           hLU(n * n, 1, bc);
+    device_batch_vector<double>         dA(n * n, 1, bc);
+    device_strided_batch_vector<int>    dipiv(n, 1, n, bc);
+    device_strided_batch_vector<int>    dinfo(bc, 1, bc, 1);
+    host_strided_batch_vector<int>      hinfo(bc, 1, bc, 1);
+    device_strided_batch_vector<double> dB(n * n, 1, n * n, 1);
+    int                                 lw, lwf;
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dipiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    con_init(hA, n, bc, false);
+
+    // factor each matrix with getrf
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, n, n, dB.data(), n, &lwf),
+                          HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWorkf(lwf, 1, lwf, 1);
+    if(lwf)
+        CHECK_HIP_ERROR(dWorkf.memcheck());
+    host_strided_batch_vector<double> hB(n * n, 1, n * n, 1);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int i = 0; i < n * n; i++)
+            hB[0][i] = hA[b][i];
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrf(handle,
+                                              n,
+                                              n,
+                                              dB.data(),
+                                              n,
+                                              dWorkf.data(),
+                                              lwf,
+                                              dipiv.data() + b * n,
+                                              dinfo.data() + b),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        for(int i = 0; i < n * n; i++)
+            hLU[b][i] = hB[0][i];
+    }
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    for(int b = 0; b < bc; b++)
+        EXPECT_EQ(hinfo[0][b], 0);
+    CHECK_HIP_ERROR(dA.transfer_from(hLU));
+
+    for(hipsolverNormType_t norm : {HIPSOLVER_NORM_ONE, HIPSOLVER_NORM_INF})
+    {
+        bool           one_norm = norm == HIPSOLVER_NORM_ONE;
+        vector<double> anorm(bc), rcond(bc), rcondb(bc);
+        for(int b = 0; b < bc; b++)
+            anorm[b] = con_norm(hA[b], n, one_norm);
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDgeconBatched_bufferSize(handle, norm, n, dA.data(), n, &lw, bc),
+            HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        for(int b = 0; b < bc; b++)
+        {
+            for(int i = 0; i < n * n; i++)
+                hB[0][i] = hLU[b][i];
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            EXPECT_ROCBLAS_STATUS(
+                hipsolverDgecon(
+                    handle, norm, n, dB.data(), n, anorm[b], &rcond[b], dWork.data(), lw),
+                HIPSOLVER_STATUS_SUCCESS);
+            con_check(rcond[b], con_exact(hA[b], n, one_norm));
+        }
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDgeconBatched(handle,
+                                                     norm,
+                                                     n,
+                                                     dA.data(),
+                                                     n,
+                                                     anorm.data(),
+                                                     rcondb.data(),
+                                                     dWork.data(),
+                                                     lw,
+                                                     bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        for(int b = 0; b < bc; b++)
+            EXPECT_EQ(rcondb[b], rcond[b]);
+    }
+}
+
+// the estimates from the factors of potrf must bound the exact reciprocal condition numbers,
+// with either triangle, and the batched estimates must match those of the single matrices
+TEST_P(GECON_POCON, pocon)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], bc = con_batch_count;
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        hipsolver_local_handle              handle;
+        host_strided_batch_vector<double>   hA(n * n, 1, n * n, bc);
+        host_batch_vector<double>           hL(n * n, 1, bc);
+        host_strided_batch_vector<double>   hB(n * n, 1, n * n, 1);
+        host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+        device_batch_vector<double>         dA(n * n, 1, bc);
+        device_strided_batch_vector<double> dB(n * n, 1, n * n, 1);
+        device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+        int                                 lw, lwf;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        con_init(hA, n, bc, true);
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, dB.data(), n, &lwf),
+                              HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWorkf(lwf, 1, lwf, 1);
+        if(lwf)
+            CHECK_HIP_ERROR(dWorkf.memcheck());
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpoconBatched_bufferSize(handle, uplo, n, dA.data(), n, &lw, bc),
+            HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        vector<double> anorm(bc), rcond(bc), rcondb(bc);
+        for(int b = 0; b < bc; b++)
+        {
+            for(int i = 0; i < n * n; i++)
+                hB[0][i] = hA[b][i];
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            EXPECT_ROCBLAS_STATUS(
+                hipsolverDpotrf(handle, uplo, n, dB.data(), n, dWorkf.data(), lwf, dinfo.data()),
+                HIPSOLVER_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+            EXPECT_EQ(hinfo[0][0], 0);
+
+            anorm[b] = con_norm(hA[b], n, true);
+            EXPECT_ROCBLAS_STATUS(
+                hipsolverDpocon(
+                    handle, uplo, n, dB.data(), n, anorm[b], &rcond[b], dWork.data(), lw),
+                HIPSOLVER_STATUS_SUCCESS);
+            con_check(rcond[b], con_exact(hA[b], n, true));
+
+            CHECK_HIP_ERROR(hB.transfer_from(dB));
+            for(int i = 0; i < n * n; i++)
+                hL[b][i] = hB[0][i];
+        }
+
+        CHECK_HIP_ERROR(dA.transfer_from(hL));
+        EXPECT_ROCBLAS_STATUS(hipsolverDpoconBatched(handle,
+                                                     uplo,
+                                                     n,
+                                                     dA.data(),
+                                                     n,
+                                                     anorm.data(),
+                                                     rcondb.data(),
+                                                     dWork.data(),
+                                                     lw,
+                                                     bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        for(int b = 0; b < bc; b++)
+            EXPECT_EQ(rcondb[b], rcond[b]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GECON_POCON, ValuesIn(con_size_range));
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gels.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gels_tuple;
+
+// each A_range vector is a {M, N, lda, ldb, ldx};
+
+// each B_range vector is a {nrhs};
+
+// case when M = N = nrhs = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // invalid
+    {-1, -1, 1, 1, 1},
+    {20, 10, 5, 20, 10},
+    {20, 10, 20, 5, 10},
+    // invalid for gels, valid for gels_strided_batched
+    {20, 10, 20, 20, 5},
+    {10, 20, 10, 20, 20},
+    /// normal (valid) samples
+    {20, 20, 20, 20, 20},
+    {50, 30, 50, 50, 30},
+    {70, 40, 100, 80, 50}};
+
+const vector<vector<int>> matrix_sizeB_range = {
+    // invalid
+    {-1},
+    // normal (valid) samples
+    {1},
+    {10},
+    {30},
+};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_sizeA_range = {{192, 192, 192, 192, 192},
+//                                                       {640, 320, 700, 645, 320},
+//                                                       {1000, 1000, 1000, 1000, 1000}};
+
+// const vector<vector<int>> large_matrix_sizeB_range = {{100}, {200}, {524}};
+
+Arguments gels_setup_arguments(gels_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_sizeA[0]);
+    arg.set<rocblas_int>("n", matrix_sizeA[1]);
+    arg.set<rocblas_int>("nrhs", matrix_sizeB[0]);
+    arg.set<rocblas_int>("lda", matrix_sizeA[2]);
+    arg.set<rocblas_int>("ldb", matrix_sizeA[3]);
+    arg.set<rocblas_int>("ldx", matrix_sizeA[4]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GELS : public ::TestWithParam<gels_tuple>
+{
+protected:
+    GELS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gels_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
+            testing_gels_bad_arg<false, STRIDED, T>();
+
+        arg.batch_count = STRIDED ? 3 : 1;
+        testing_gels<false, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GELS, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GELS, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GELS, __float_complex)
+{
+    run_tests<false, hipsolverComplex>();
+}
+
+TEST_P(GELS, __double_complex)
+{
+    run_tests<false, hipsolverDoubleComplex>();
+}
+
+// strided_batched tests
+
+TEST_P(GELS, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GELS, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GELS, strided_batched__float_complex)
+{
+    run_tests<true, hipsolverComplex>();
+}
+
+TEST_P(GELS, strided_batched__double_complex)
+{
+    run_tests<true, hipsolverDoubleComplex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GELS,
+//                          Combine(ValuesIn(large_matrix_sizeA_range),
+//                                  ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -81,7 +81,7 @@ protected:
         if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == -1)
             testing_geqrf_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
         testing_geqrf<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
@@ -136,6 +136,90 @@ TEST_P(GEQRF_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// batched tests
+
+TEST_P(GEQRF, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GEQRF, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GEQRF, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GEQRF_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GEQRF_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEQRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRF_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRF_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GEQRF,
 //                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
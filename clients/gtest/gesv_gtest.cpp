@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gesv_tuple;
+
+// each A_range vector is a {N, lda, ldb, ldx};
+
+// each B_range vector is a {nrhs};
+
+// case when N = nrhs = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // invalid
+    {-1, 1, 1, 1},
+    {10, 2, 10, 10},
+    {10, 10, 2, 10},
+    {10, 10, 10, 2},
+    /// normal (valid) samples
+    {20, 20, 20, 20},
+    {30, 50, 30, 30},
+    {30, 30, 50, 40},
+    {50, 60, 60, 60}};
+
+const vector<vector<int>> matrix_sizeB_range = {
+    // invalid
+    {-1},
+    // normal (valid) samples
+    {1},
+    {10},
+    {30},
+};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_sizeA_range = {{192, 192, 192, 192},
+//                                                       {600, 700, 645, 600},
+//                                                       {1000, 1000, 1000, 1000},
+//                                                       {1000, 2000, 2000, 2000}};
+
+// const vector<vector<int>> large_matrix_sizeB_range = {{100}, {200}, {524}};
+
+Arguments gesv_setup_arguments(gesv_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_sizeA[0]);
+    arg.set<rocblas_int>("nrhs", matrix_sizeB[0]);
+    arg.set<rocblas_int>("lda", matrix_sizeA[1]);
+    arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+    arg.set<rocblas_int>("ldx", matrix_sizeA[3]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GESV : public ::TestWithParam<gesv_tuple>
+{
+protected:
+    GESV() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = gesv_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
+            testing_gesv_bad_arg<false, T>();
+
+        testing_gesv<false, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GESV, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GESV, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// a matrix that overflows single precision is solved in double precision instead
+TEST(GESV_FALLBACK, __double)
+{
+    hipsolver_local_handle handle;
+    const int              n      = 2;
+    int                    niters = 0;
+
+    // A = diag(1e300, 1) and B = A * [1, 1]
+    host_strided_batch_vector<double>   hA(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hB(n, 1, n, 1);
+    host_strided_batch_vector<double>   hX(n, 1, n, 1);
+    host_strided_batch_vector<int>      hInfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<double> dB(n, 1, n, 1);
+    device_strided_batch_vector<double> dX(n, 1, n, 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    hA[0][0] = 1e300;
+    hA[0][1] = 0;
+    hA[0][2] = 0;
+    hA[0][3] = 1;
+    hB[0][0] = 1e300;
+    hB[0][1] = 1;
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    size_t size_W;
+    CHECK_ROCBLAS_ERROR(hipsolver_gesv_bufferSize(false,
+                                                  handle,
+                                                  n,
+                                                  1,
+                                                  dA.data(),
+                                                  n,
+                                                  dIpiv.data(),
+                                                  dB.data(),
+                                                  n,
+                                                  dX.data(),
+                                                  n,
+                                                  &size_W));
+    device_strided_batch_vector<unsigned char> dWork(size_W, 1, size_W, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    CHECK_ROCBLAS_ERROR(hipsolver_gesv(false,
+                                       handle,
+                                       n,
+                                       1,
+                                       dA.data(),
+                                       n,
+                                       dIpiv.data(),
+                                       dB.data(),
+                                       n,
+                                       dX.data(),
+                                       n,
+                                       dWork.data(),
+                                       size_W,
+                                       &niters,
+                                       dInfo.data()));
+    CHECK_HIP_ERROR(hX.transfer_from(dX));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    EXPECT_LT(niters, 0);
+    EXPECT_EQ(hInfo[0][0], 0);
+    EXPECT_DOUBLE_EQ(hX[0][0], 1.0);
+    EXPECT_DOUBLE_EQ(hX[0][1], 1.0);
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GESV,
+//                          Combine(ValuesIn(large_matrix_sizeA_range),
+//                                  ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -144,7 +144,7 @@ protected:
            && arg.peek<char>("jobu") == 'N' && arg.peek<char>("jobv") == 'N')
             testing_gesvd_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
         testing_gesvd<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
@@ -199,6 +199,48 @@ TEST_P(GESVD_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// strided_batched tests
+
+TEST_P(GESVD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESVD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESVD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESVD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GESVD_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESVD_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESVD_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GESVD,
 //                          Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
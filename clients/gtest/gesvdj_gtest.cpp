@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvdj.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gesvdj_tuple;
+
+// each size_range vector is a {m, n};
+
+// each opt_range vector is a {lda, ldu, ldv, jobz, econ};
+// if ldx = -1 then ldx < limit (invalid size)
+// if ldx = 0 then ldx = limit
+// if ldx = 1 then ldx > limit
+// if jobz = 0 then no singular vectors are computed
+// if jobz = 1 then singular vectors are computed
+// if econ = 0 then all the singular vectors are computed
+// if econ = 1 then only the first min(m, n) singular vectors are computed
+
+// case when m = -1, n = 1, and jobz = 0 will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+// (matrices are kept small enough for the batched Jacobi solver of cuSOLVER)
+const vector<vector<int>> size_range = {
+    // invalid
+    {-1, 1},
+    {1, -1},
+    // normal (valid) samples
+    {1, 1},
+    {20, 20},
+    {30, 20},
+    {20, 32}};
+
+const vector<vector<int>> opt_range = {
+    // invalid
+    {-1, 0, 0, 0, 0},
+    {0, -1, 0, 1, 0},
+    {0, 0, -1, 1, 0},
+    // normal (valid) samples
+    {0, 0, 0, 0, 0},
+    {1, 1, 1, 0, 0},
+    {0, 0, 0, 1, 0},
+    {1, 1, 1, 1, 0},
+    {0, 0, 0, 1, 1}};
+
+Arguments gesvdj_setup_arguments(gesvdj_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    vector<int> opt  = std::get<1>(tup);
+
+    Arguments arg;
+
+    // sizes
+    rocblas_int m = size[0];
+    rocblas_int n = size[1];
+    arg.set<rocblas_int>("m", m);
+    arg.set<rocblas_int>("n", n);
+
+    // leading dimensions
+    arg.set<rocblas_int>("lda", m + opt[0] * 10);
+    arg.set<rocblas_int>("ldu", m + opt[1] * 10);
+    arg.set<rocblas_int>("ldv", n + opt[2] * 10);
+
+    // vector options
+    arg.set<char>("jobz", opt[3] == 0 ? 'N' : 'V');
+    arg.set<rocblas_int>("econ", opt[4]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GESVDJ : public ::TestWithParam<gesvdj_tuple>
+{
+protected:
+    GESVDJ() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesvdj_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == 1
+           && arg.peek<char>("jobz") == 'N')
+            testing_gesvdj_bad_arg<false, BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
+        testing_gesvdj<false, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GESVDJ, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GESVDJ, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESVDJ, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GESVDJ, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GESVDJ, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESVDJ, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESVDJ, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESVDJ, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVDJ,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
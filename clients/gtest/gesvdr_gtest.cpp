@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> gesvdr_tuple;
+
+// each size_range vector is a {m, n, k, p}
+const vector<vector<int>> gesvdr_size_range
+    = {{1, 1, 1, 0}, {60, 45, 5, 5}, {45, 60, 5, 5}, {300, 200, 10, 6}};
+
+// the number of power iterations
+const vector<int> gesvdr_niters_range = {0, 2};
+
+class GESVDR : public ::TestWithParam<gesvdr_tuple>
+{
+protected:
+    GESVDR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// orthonormalizes the k columns of the rows-by-k matrix X by Gram-Schmidt with reorthogonalization
+static void gesvdr_orth(double* X, int rows, int k)
+{
+    for(int j = 0; j < k; j++)
+    {
+        double* x = X + j * rows;
+        for(int pass = 0; pass < 2; pass++)
+            for(int i = 0; i < j; i++)
+            {
+                double* y   = X + i * rows;
+                double  dot = 0;
+                for(int r = 0; r < rows; r++)
+                    dot += x[r] * y[r];
+                for(int r = 0; r < rows; r++)
+                    x[r] -= dot * y[r];
+            }
+        double norm = 0;
+        for(int r = 0; r < rows; r++)
+            norm += x[r] * x[r];
+        for(int r = 0; r < rows; r++)
+            x[r] /= sqrt(norm);
+    }
+}
+
+TEST(GESVDR_BAD_ARG, gesvdr)
+{
+    hipsolver_local_handle              handle;
+    int                                 m = 6, n = 5, k = 2, p = 1, lw;
+    device_strided_batch_vector<double> dA(m * n, 1, m * n, 1);
+    device_strided_batch_vector<double> dS(k, 1, k, 1);
+    device_strided_batch_vector<double> dU(m * k, 1, m * k, 1);
+    device_strided_batch_vector<double> dV(n * k, 1, n * k, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgesvdr_bufferSize(nullptr, 'S', 'S', m, n, k, p, 0, m, m, n, &lw),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgesvdr_bufferSize(handle, 'A', 'S', m, n, k, p, 0, m, m, n, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgesvdr_bufferSize(handle, 'S', 'S', m, n, k, n, 0, m, m, n, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgesvdr_bufferSize(handle, 'S', 'S', m, n, k, p, -1, m, m, n, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgesvdr_bufferSize(handle, 'S', 'S', m, n, k, p, 0, m, m - 1, n, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgesvdr_bufferSize(handle, 'S', 'S', m, n, k, p, 0, m, m, n, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDgesvdr_bufferSize(handle, 'S', 'S', m, n, k, p, 0, m, m, n, &lw));
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvdr(handle,
+                                           'S',
+                                           'S',
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           0,
+                                           dA.data(),
+                                           m,
+                                           dS.data(),
+                                           dU.data(),
+                                           m,
+                                           dV.data(),
+                                           n,
+                                           dWork.data(),
+                                           lw - 1,
+                                           dinfo.data()),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvdr(handle,
+                                           'S',
+                                           'S',
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           0,
+                                           dA.data(),
+                                           m,
+                                           dS.data(),
+                                           nullptr,
+                                           m,
+                                           dV.data(),
+                                           n,
+                                           dWork.data(),
+                                           lw,
+                                           dinfo.data()),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+// A = X * diag(sigma) * Y^T has exact rank k, with orthonormal X and Y and singular values that
+// decay by halves, so that the randomized SVD recovers it to rounding; its leading dimension is
+// m + 1, and those of U and V are m + 2 and n + 3
+TEST_P(GESVDR, gesvdr)
+{
+    vector<int> size   = std::get<0>(GetParam());
+    int         niters = std::get<1>(GetParam());
+    int         m = size[0], n = size[1], k = size[2], p = size[3];
+    int         lda = m + 1, ldu = m + 2, ldv = n + 3, lw;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hX(m * k, 1, m * k, 1);
+    host_strided_batch_vector<double>   hY(n * k, 1, n * k, 1);
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hS(k, 1, k, 1);
+    host_strided_batch_vector<double>   hSRes(k, 1, k, 1);
+    host_strided_batch_vector<double>   hU(ldu * k, 1, ldu * k, 1);
+    host_strided_batch_vector<double>   hV(ldv * k, 1, ldv * k, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dS(k, 1, k, 1);
+    device_strided_batch_vector<double> dU(ldu * k, 1, ldu * k, 1);
+    device_strided_batch_vector<double> dV(ldv * k, 1, ldv * k, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocblas_init<double>(hX, true);
+    rocblas_init<double>(hY, true);
+    gesvdr_orth(hX[0], m, k);
+    gesvdr_orth(hY[0], n, k);
+    for(int q = 0; q < k; q++)
+        hS[0][q] = ldexp(1.0, -q);
+    for(int i = 0; i < lda; i++)
+        for(int j = 0; j < n; j++)
+        {
+            double sum = 0;
+            for(int q = 0; q < k && i < m; q++)
+                sum += hX[0][i + q * m] * hS[0][q] * hY[0][j + q * n];
+            hA[0][i + j * lda] = sum;
+        }
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDgesvdr_bufferSize(handle, 'S', 'S', m, n, k, p, niters, lda, ldu, ldv, &lw));
+    device_strided_batch_vector<double> dWork(max(lw, 1), 1, max(lw, 1), 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDgesvdr(handle,
+                                         'S',
+                                         'S',
+                                         m,
+                                         n,
+                                         k,
+                                         p,
+                                         niters,
+                                         dA.data(),
+                                         lda,
+                                         dS.data(),
+                                         dU.data(),
+                                         ldu,
+                                         dV.data(),
+                                         ldv,
+                                         dWork.data(),
+                                         lw,
+                                         dinfo.data()));
+    CHECK_HIP_ERROR(hSRes.transfer_from(dS));
+    CHECK_HIP_ERROR(hU.transfer_from(dU));
+    CHECK_HIP_ERROR(hV.transfer_from(dV));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    EXPECT_EQ(hinfo[0][0], 0);
+
+    // the singular values, and A reconstructed from the singular triplets
+    for(int i = 0; i < lda; i++)
+        for(int j = 0; j < n; j++)
+        {
+            double sum = 0;
+            for(int q = 0; q < k && i < m; q++)
+                sum += hU[0][i + q * ldu] * hSRes[0][q] * hV[0][j + q * ldv];
+            hARes[0][i + j * lda] = sum;
+        }
+
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', k, 1, k, hS[0], hSRes[0]), max(m, n));
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', m, n, lda, hA[0], hARes[0]), max(m, n));
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVDR,
+                         Combine(ValuesIn(gesvdr_size_range), ValuesIn(gesvdr_niters_range)));
@@ -83,7 +83,7 @@ protected:
     virtual void TearDown() {}
 
     template <bool BATCHED, bool STRIDED, typename T>
-    void run_tests()
+    void run_tests(bool device_verify = false)
     {
         Arguments arg = getrf_setup_arguments(GetParam());
 
@@ -95,7 +95,8 @@ protected:
                 testing_getrf_npvt_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
         }
 
-        arg.batch_count = 1;
+        arg.batch_count   = (BATCHED || STRIDED) ? 3 : 1;
+        arg.device_verify = device_verify;
         if(!NPVT)
             testing_getrf<FORTRAN, BATCHED, STRIDED, T>(arg);
         else
@@ -199,6 +200,209 @@ TEST_P(GETRF_NPVT_FORTRAN, __double_complex)
     run_tests<false, false, hipsolverDoubleComplex>();
 }
 
+// batched tests
+TEST_P(GETRF, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF, batched__float_complex)
+{
+    run_tests<true, false, hipsolverComplex>();
+}
+
+TEST_P(GETRF, batched__double_complex)
+{
+    run_tests<true, false, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, hipsolverComplex>();
+}
+
+TEST_P(GETRF_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_NPVT, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_NPVT, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_NPVT, batched__float_complex)
+{
+    run_tests<true, false, hipsolverComplex>();
+}
+
+TEST_P(GETRF_NPVT, batched__double_complex)
+{
+    run_tests<true, false, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, hipsolverComplex>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, hipsolverDoubleComplex>();
+}
+
+// strided_batched tests
+TEST_P(GETRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF, strided_batched__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>();
+}
+
+TEST_P(GETRF, strided_batched__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>();
+}
+
+TEST_P(GETRF_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>();
+}
+
+TEST_P(GETRF_NPVT_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>();
+}
+
+// device verification tests
+TEST_P(GETRF, device_verify__float)
+{
+    run_tests<false, false, float>(true);
+}
+
+TEST_P(GETRF, device_verify__double)
+{
+    run_tests<false, false, double>(true);
+}
+
+TEST_P(GETRF, device_verify__float_complex)
+{
+    run_tests<false, false, hipsolverComplex>(true);
+}
+
+TEST_P(GETRF, device_verify__double_complex)
+{
+    run_tests<false, false, hipsolverDoubleComplex>(true);
+}
+
+TEST_P(GETRF, strided_batched_device_verify__float)
+{
+    run_tests<false, true, float>(true);
+}
+
+TEST_P(GETRF, strided_batched_device_verify__double)
+{
+    run_tests<false, true, double>(true);
+}
+
+TEST_P(GETRF, strided_batched_device_verify__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>(true);
+}
+
+TEST_P(GETRF, strided_batched_device_verify__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>(true);
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GETRF,
 //                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getri.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> getri_tuple;
+
+// each matrix_size_range vector is a {n, lda, ldc}
+
+// case when n = -1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1},
+    {20, 5, 20},
+    {20, 20, 5},
+    // normal (valid) samples
+    {32, 32, 32},
+    {50, 50, 60},
+    {70, 100, 70},
+    {100, 150, 100}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range
+//     = {{192, 192, 192}, {500, 600, 500}, {640, 640, 700}, {1000, 1024, 1000}};
+
+Arguments getri_setup_arguments(getri_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", tup[0]);
+    arg.set<rocblas_int>("lda", tup[1]);
+    arg.set<rocblas_int>("ldc", tup[2]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GETRI : public ::TestWithParam<getri_tuple>
+{
+protected:
+    GETRI() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getri_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1)
+            testing_getri_bad_arg<false, BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
+        testing_getri<false, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GETRI, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRI, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRI, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRI, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GETRI, outofplace_batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRI, outofplace_batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRI, outofplace_batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRI, outofplace_batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETRI, outofplace_strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRI, outofplace_strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRI, outofplace_strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRI, outofplace_strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack, GETRI, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRI, ValuesIn(matrix_size_range));
@@ -98,7 +98,7 @@ protected:
         if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
             testing_getrs_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
         testing_getrs<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
@@ -153,6 +153,90 @@ TEST_P(GETRS_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// batched tests
+
+TEST_P(GETRS, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRS, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRS, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRS, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRS_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRS_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRS_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRS_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETRS, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRS, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRS, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRS, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRS_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRS_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRS_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRS_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GETRS,
 //                          Combine(ValuesIn(large_matrix_sizeA_range),
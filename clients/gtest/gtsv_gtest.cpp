@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {m, batch_count}
+const vector<vector<int>> gtsv_size_range = {{3, 1}, {4, 7}, {16, 64}, {100, 5}, {512, 3}};
+
+const int gtsv_nrhs = 2;
+
+class GTSV : public ::TestWithParam<vector<int>>
+{
+protected:
+    GTSV() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates in hD[0], ..., hD[4] the second subdiagonal, subdiagonal, diagonal, superdiagonal and
+// second superdiagonal of diagonally dominant matrices of order m, where entry i of matrix b is at
+// index(i, b); the entries that fall outside of the matrices are zero
+template <typename F>
+static void gtsv_init(host_strided_batch_vector<double>& hD, int m, int bc, F index)
+{
+    rocblas_init<double>(hD, true);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int i = 0; i < m; i++)
+        {
+            hD[2][index(i, b)] += 50;
+            for(int k = -2; k <= 2; k++)
+                if(i + k < 0 || i + k >= m)
+                    hD[k + 2][index(i, b)] = 0;
+        }
+    }
+}
+
+// rhs = A * x for matrix b of gtsv_init
+template <typename F>
+static void gtsv_rhs(
+    host_strided_batch_vector<double>& hD, const double* x, double* rhs, int m, int b, F index)
+{
+    for(int i = 0; i < m; i++)
+    {
+        double sum = 0;
+        for(int k = -2; k <= 2; k++)
+            if(i + k >= 0 && i + k < m)
+                sum += hD[k + 2][index(i, b)] * x[index(i + k, b)];
+        rhs[index(i, b)] = sum;
+    }
+}
+
+TEST(GTSV_BAD_ARG, gtsv)
+{
+    hipsolver_local_handle              handle;
+    int                                 m = 4, n = 2, lw;
+    device_strided_batch_vector<double> dD(m, 1, m, 3);
+    device_strided_batch_vector<double> dB(m * n, 1, m * n, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgtsv_bufferSize(nullptr, m, n, dD[0], dD[1], dD[2], dB.data(), m, &lw),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgtsv_bufferSize(handle, -1, n, dD[0], dD[1], dD[2], dB.data(), m, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgtsv_bufferSize(handle, m, n, dD[0], dD[1], dD[2], dB.data(), m, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgtsv_bufferSize(handle, m, n, dD[0], dD[1], dD[2], dB.data(), m, &lw),
+        HIPSOLVER_STATUS_SUCCESS);
+    if(lw > 0)
+    {
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDgtsv(
+                handle, m, n, dD[0], dD[1], dD[2], dB.data(), m, dWork.data(), lw - 1),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDgtsv(handle, m, n, dD[0], dD[1], dD[2], dB.data(), m, nullptr, lw),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+    }
+}
+
+TEST(GTSV_BAD_ARG, gtsvStridedBatch)
+{
+    hipsolver_local_handle              handle;
+    int                                 m = 4, bc = 3, lw;
+    device_strided_batch_vector<double> dD(m * bc, 1, m * bc, 3);
+    device_strided_batch_vector<double> dx(m * bc, 1, m * bc, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgtsvStridedBatch_bufferSize(
+                              nullptr, m, dD[0], dD[1], dD[2], dx.data(), bc, m, &lw),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgtsvStridedBatch_bufferSize(
+                              handle, m, dD[0], dD[1], dD[2], dx.data(), -1, m, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgtsvStridedBatch_bufferSize(
+                              handle, m, dD[0], dD[1], dD[2], dx.data(), bc, m, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgtsvStridedBatch_bufferSize(
+                              handle, m, dD[0], dD[1], dD[2], dx.data(), bc, m, &lw),
+                          HIPSOLVER_STATUS_SUCCESS);
+    if(lw > 0)
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDgtsvStridedBatch(
+                handle, m, dD[0], dD[1], dD[2], dx.data(), bc, m, nullptr, lw),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+// gtsv solves the systems of B, whose leading dimension is m + 1
+TEST_P(GTSV, gtsv)
+{
+    int m = GetParam()[0], ldb = m + 1, lw;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hD(m, 1, m, 5);
+    host_strided_batch_vector<double>   hX(ldb * gtsv_nrhs, 1, ldb * gtsv_nrhs, 1);
+    host_strided_batch_vector<double>   hB(ldb * gtsv_nrhs, 1, ldb * gtsv_nrhs, 1);
+    device_strided_batch_vector<double> dD(m, 1, m, 5);
+    device_strided_batch_vector<double> dB(ldb * gtsv_nrhs, 1, ldb * gtsv_nrhs, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+
+    // a tridiagonal matrix
+    auto index = [](int i, int) { return i; };
+    gtsv_init(hD, m, 1, index);
+    fill(hD[0], hD[0] + m, 0.0);
+    fill(hD[4], hD[4] + m, 0.0);
+    rocblas_init<double>(hX, true);
+    for(int c = 0; c < gtsv_nrhs; c++)
+        gtsv_rhs(hD, hX[0] + c * ldb, hB[0] + c * ldb, m, 0, index);
+    CHECK_HIP_ERROR(dD.transfer_from(hD));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgtsv_bufferSize(
+        handle, m, gtsv_nrhs, dD[1], dD[2], dD[3], dB.data(), ldb, &lw));
+    device_strided_batch_vector<double> dWork(max(lw, 1), 1, max(lw, 1), 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDgtsv(
+        handle, m, gtsv_nrhs, dD[1], dD[2], dD[3], dB.data(), ldb, dWork.data(), lw));
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', m, gtsv_nrhs, ldb, hX[0], hB[0]), m);
+}
+
+// gtsvStridedBatch solves systems whose diagonals and right-hand sides are m + 3 apart
+TEST_P(GTSV, gtsvStridedBatch)
+{
+    int m = GetParam()[0], bc = GetParam()[1], stride = m + 3, size = stride * bc, lw;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hD(size, 1, size, 5);
+    host_strided_batch_vector<double>   hX(size, 1, size, 1);
+    host_strided_batch_vector<double>   hB(size, 1, size, 1);
+    device_strided_batch_vector<double> dD(size, 1, size, 5);
+    device_strided_batch_vector<double> dx(size, 1, size, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+
+    // tridiagonal matrices
+    auto index = [stride](int i, int b) { return b * stride + i; };
+    gtsv_init(hD, m, bc, index);
+    fill(hD[0], hD[0] + size, 0.0);
+    fill(hD[4], hD[4] + size, 0.0);
+    rocblas_init<double>(hX, true);
+    for(int b = 0; b < bc; b++)
+        gtsv_rhs(hD, hX[0], hB[0], m, b, index);
+    CHECK_HIP_ERROR(dD.transfer_from(hD));
+    CHECK_HIP_ERROR(dx.transfer_from(hB));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgtsvStridedBatch_bufferSize(
+        handle, m, dD[1], dD[2], dD[3], dx.data(), bc, stride, &lw));
+    device_strided_batch_vector<double> dWork(max(lw, 1), 1, max(lw, 1), 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDgtsvStridedBatch(
+        handle, m, dD[1], dD[2], dD[3], dx.data(), bc, stride, dWork.data(), lw));
+    CHECK_HIP_ERROR(hB.transfer_from(dx));
+
+    double err = 0;
+    for(int b = 0; b < bc; b++)
+        err = max(err, norm_error('F', m, 1, m, hX[0] + index(0, b), hB[0] + index(0, b)));
+    ROCSOLVER_TEST_CHECK(double, err, m);
+}
+
+// gpsvInterleavedBatch solves pentadiagonal systems in the interleaved layout
+TEST_P(GTSV, gpsvInterleavedBatch)
+{
+    int m = GetParam()[0], bc = GetParam()[1], size = m * bc, lw;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hD(size, 1, size, 5);
+    host_strided_batch_vector<double>   hX(size, 1, size, 1);
+    host_strided_batch_vector<double>   hB(size, 1, size, 1);
+    device_strided_batch_vector<double> dD(size, 1, size, 5);
+    device_strided_batch_vector<double> dx(size, 1, size, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+
+    auto index = [bc](int i, int b) { return b + i * bc; };
+    gtsv_init(hD, m, bc, index);
+    rocblas_init<double>(hX, true);
+    for(int b = 0; b < bc; b++)
+        gtsv_rhs(hD, hX[0], hB[0], m, b, index);
+    CHECK_HIP_ERROR(dD.transfer_from(hD));
+    CHECK_HIP_ERROR(dx.transfer_from(hB));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgpsvInterleavedBatch_bufferSize(
+        handle, m, dD[0], dD[1], dD[2], dD[3], dD[4], dx.data(), bc, &lw));
+    device_strided_batch_vector<double> dWork(max(lw, 1), 1, max(lw, 1), 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDgpsvInterleavedBatch(
+        handle, m, dD[0], dD[1], dD[2], dD[3], dD[4], dx.data(), bc, dWork.data(), lw));
+    CHECK_HIP_ERROR(hB.transfer_from(dx));
+
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', size, 1, size, hX[0], hB[0]), m);
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GTSV, ValuesIn(gtsv_size_range));
@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include <thread>
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {threads, handles}
+const vector<vector<int>> pool_size_range = {{1, 0}, {4, 2}, {8, 8}};
+
+class HANDLE_POOL : public ::TestWithParam<vector<int>>
+{
+protected:
+    HANDLE_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST(HANDLE_POOL_API, bad_arg)
+{
+    hipsolverHandlePool_t pool;
+    hipsolverHandle_t     handle;
+    int                   handles, idle;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(nullptr, 1, 0),
+                          HIPSOLVER_STATUS_HANDLE_IS_NULLPTR);
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateHandlePool(&pool, -1, 0), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyHandlePool(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(nullptr, &handle),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(nullptr, handle),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetCount(nullptr, &handles, &idle),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    CHECK_ROCBLAS_ERROR(hipsolverCreateHandlePool(&pool, 1, 0));
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetCount(pool, nullptr, &idle),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // only handles lent by the pool can be released, and only once
+    hipsolver_local_handle other;
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, other), HIPSOLVER_STATUS_INVALID_VALUE);
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolAcquire(pool, &handle));
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolRelease(pool, handle));
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    CHECK_ROCBLAS_ERROR(hipsolverDestroyHandlePool(pool));
+}
+
+TEST(HANDLE_POOL_API, recycle)
+{
+    hipsolverHandlePool_t pool;
+    hipsolverHandle_t     first, second;
+    hipStream_t           stream;
+    int                   handles, idle;
+
+    CHECK_ROCBLAS_ERROR(hipsolverCreateHandlePool(&pool, 1, 1 << 20));
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolGetCount(pool, &handles, &idle));
+    EXPECT_EQ(handles, 1);
+    EXPECT_EQ(idle, 1);
+
+    // the handle is bound to a stream of the calling thread
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolAcquire(pool, &first));
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(first, &stream));
+    EXPECT_NE(stream, nullptr);
+
+    // the pool grows when all of its handles are in use
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolAcquire(pool, &second));
+    EXPECT_NE(first, second);
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolGetCount(pool, &handles, &idle));
+    EXPECT_EQ(handles, 2);
+    EXPECT_EQ(idle, 0);
+
+    // released handles are lent again instead of creating new ones
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolRelease(pool, second));
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolAcquire(pool, &second));
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolGetCount(pool, &handles, &idle));
+    EXPECT_EQ(handles, 2);
+
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolRelease(pool, first));
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolRelease(pool, second));
+
+    // the stream of a thread that holds no handle is given to the next thread
+    hipStream_t other = nullptr;
+    thread([&]() {
+        hipsolverHandle_t handle;
+        if(hipsolverHandlePoolAcquire(pool, &handle) != HIPSOLVER_STATUS_SUCCESS)
+            return;
+        hipsolverGetStream(handle, &other);
+        hipsolverHandlePoolRelease(pool, handle);
+    }).join();
+    EXPECT_EQ(other, stream);
+
+    CHECK_ROCBLAS_ERROR(hipsolverDestroyHandlePool(pool));
+}
+
+// every thread factors its own matrix with a handle of the pool
+TEST_P(HANDLE_POOL, threads)
+{
+    vector<int> size    = GetParam();
+    int         threads = size[0], n = 20;
+
+    hipsolverHandlePool_t pool;
+    CHECK_ROCBLAS_ERROR(hipsolverCreateHandlePool(&pool, size[1], 0));
+
+    // the random generator is not thread-safe, so all the threads factor copies of one matrix
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, 1);
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * n] = hA[0][i + j * n];
+        hA[0][i + i * n] += 400;
+    }
+
+    vector<int>         infos(threads, -1);
+    vector<hipStream_t> streams(threads, nullptr);
+    vector<thread>      workers;
+    for(int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]() {
+            hipsolverHandle_t handle;
+            int               lwork = 0;
+            if(hipsolverHandlePoolAcquire(pool, &handle) != HIPSOLVER_STATUS_SUCCESS)
+                return;
+            hipsolverGetStream(handle, &streams[t]);
+            hipsolverStatus_t status = hipsolverDpotrf_bufferSize(
+                handle, HIPSOLVER_FILL_MODE_UPPER, n, nullptr, n, &lwork);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                hipsolverHandlePoolRelease(pool, handle);
+            ASSERT_EQ(status, HIPSOLVER_STATUS_SUCCESS);
+
+            host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+            device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+            device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+            device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+            if(dA.memcheck() == hipSuccess && dWork.memcheck() == hipSuccess
+               && dinfo.memcheck() == hipSuccess && dA.transfer_from(hA) == hipSuccess
+               && hipsolverDpotrf(handle,
+                                  HIPSOLVER_FILL_MODE_UPPER,
+                                  n,
+                                  dA.data(),
+                                  n,
+                                  dWork.data(),
+                                  lwork,
+                                  dinfo.data())
+                      == HIPSOLVER_STATUS_SUCCESS
+               && hipStreamSynchronize(streams[t]) == hipSuccess
+               && hinfo.transfer_from(dinfo) == hipSuccess)
+                infos[t] = hinfo[0][0];
+
+            hipsolverHandlePoolRelease(pool, handle);
+        });
+    }
+    for(auto& w : workers)
+        w.join();
+
+    for(int t = 0; t < threads; t++)
+    {
+        EXPECT_EQ(infos[t], 0);
+        EXPECT_NE(streams[t], nullptr);
+    }
+
+    int handles, idle;
+    CHECK_ROCBLAS_ERROR(hipsolverHandlePoolGetCount(pool, &handles, &idle));
+    EXPECT_EQ(handles, idle);
+    EXPECT_LE(handles, max(threads, size[1]));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDestroyHandlePool(pool));
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HANDLE_POOL, ValuesIn(pool_size_range));
@@ -2,6 +2,7 @@
  * Copyright 2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#include "../rocblascommon/d_vector.hpp"
 #include <gtest/gtest.h>
 #include <stdexcept>
 
@@ -13,5 +14,10 @@ int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
 
-    return RUN_ALL_TESTS();
+    int status = RUN_ALL_TESTS();
+
+    // return the device memory cached by the test containers before the runtime shuts down
+    device_memory_pool::instance().release();
+
+    return status;
 }
@@ -0,0 +1,371 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// orders solved on the host by the tests below
+const vector<int> host_size_range = {1, 4, 8};
+
+class HOST_DISPATCH : public ::TestWithParam<int>
+{
+protected:
+    HOST_DISPATCH() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// orders of the batched tests, with and without fixed-size host solvers
+const vector<int> host_batched_range = {1, 3, 8, 32, 33};
+
+class HOST_DISPATCH_BATCHED : public ::TestWithParam<int>
+{
+protected:
+    HOST_DISPATCH_BATCHED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// managed allocation of a test, freed when it goes out of scope
+template <typename T>
+struct host_dispatch_array
+{
+    T* data = nullptr;
+
+    explicit host_dispatch_array(size_t size)
+    {
+        if(hipMallocManaged(&data, sizeof(T) * max(size, size_t(1))) != hipSuccess)
+            data = nullptr;
+    }
+    ~host_dispatch_array()
+    {
+        if(data)
+            hipFree(data);
+    }
+};
+
+TEST(HOST_DISPATCH_API, bad_arg)
+{
+    hipsolver_local_handle handle;
+    int64_t                host_calls, device_calls;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_POTRF, HIPSOLVER_ADV_HOST_SIZE, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_SYEVD, HIPSOLVER_ADV_ALGORITHM, 2),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetHostDispatchStats(nullptr, HIPSOLVERDN_POTRF, &host_calls, &device_calls),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetHostDispatchStats(handle, HIPSOLVERDN_POTRF, nullptr, &device_calls),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetHostDispatchStats(handle, HIPSOLVERDN_POTRF, &host_calls, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHostDispatchStats(
+                              handle, hipsolverDnFunction_t(-1), &host_calls, &device_calls),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverResetHostDispatchStats(nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST(HOST_DISPATCH_API, set_get)
+{
+    hipsolver_local_handle handle;
+    int                    value;
+    int64_t                host_calls, device_calls;
+
+    for(hipsolverDnFunction_t f : {HIPSOLVERDN_GETRF, HIPSOLVERDN_POTRF, HIPSOLVERDN_SYEVD})
+    {
+        // the host path is disabled by default
+        CHECK_ROCBLAS_ERROR(hipsolverGetAdvOptions(handle, f, HIPSOLVER_ADV_HOST_SIZE, &value));
+        EXPECT_EQ(value, 0);
+        CHECK_ROCBLAS_ERROR(hipsolverGetHostDispatchStats(handle, f, &host_calls, &device_calls));
+        EXPECT_EQ(host_calls, 0);
+        EXPECT_EQ(device_calls, 0);
+
+        CHECK_ROCBLAS_ERROR(hipsolverSetAdvOptions(handle, f, HIPSOLVER_ADV_HOST_SIZE, 8));
+        CHECK_ROCBLAS_ERROR(hipsolverGetAdvOptions(handle, f, HIPSOLVER_ADV_HOST_SIZE, &value));
+        EXPECT_EQ(value, 8);
+    }
+}
+
+// solves the same problems in managed memory, on the host, and in device memory; the host
+// results must agree with the device ones and the calls must be counted where they ran
+TEST_P(HOST_DISPATCH, potrf_getrf_syevd)
+{
+    int n   = GetParam();
+    int lda = n;
+
+    hipsolver_local_handle handle;
+    hipStream_t            stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, 1);
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * lda] = hA[0][i + j * lda];
+        hA[0][i + i * lda] += 400;
+    }
+
+    int lwork_potrf, lwork_getrf, lwork_syevd;
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrf_bufferSize(
+        handle, HIPSOLVER_FILL_MODE_LOWER, n, nullptr, lda, &lwork_potrf));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrf_bufferSize(handle, n, n, nullptr, lda, &lwork_getrf));
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd_bufferSize(handle,
+                                                   HIPSOLVER_EIG_MODE_NOVECTOR,
+                                                   HIPSOLVER_FILL_MODE_LOWER,
+                                                   n,
+                                                   nullptr,
+                                                   lda,
+                                                   nullptr,
+                                                   &lwork_syevd));
+    int lwork = max(max(lwork_potrf, lwork_getrf), max(lwork_syevd, 1));
+
+    // the device does not support managed memory
+    host_dispatch_array<double> mA(n * n), mD(n);
+    host_dispatch_array<int>    mIpiv(n), mInfo(1);
+    if(!mA.data || !mD.data || !mIpiv.data || !mInfo.data)
+        return;
+
+    for(hipsolverDnFunction_t f : {HIPSOLVERDN_GETRF, HIPSOLVERDN_POTRF, HIPSOLVERDN_SYEVD})
+        CHECK_ROCBLAS_ERROR(hipsolverSetAdvOptions(handle, f, HIPSOLVER_ADV_HOST_SIZE, 8));
+
+    host_strided_batch_vector<double>   hARes(n * n, 1, n * n, 1);
+    host_strided_batch_vector<int>      hIpivRes(n, 1, n, 1);
+    device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<double> dD(n, 1, n, 1);
+    device_strided_batch_vector<double> dWork(lwork, 1, lwork, 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    double  tol = 10 * n * get_epsilon<double>();
+    int64_t host_calls, device_calls;
+
+    // potrf
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrf(
+        handle, HIPSOLVER_FILL_MODE_LOWER, n, dA.data(), lda, dWork.data(), lwork, dInfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    copy(hA[0], hA[0] + n * n, mA.data);
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDpotrf(handle, HIPSOLVER_FILL_MODE_LOWER, n, mA.data, lda, nullptr, 0, mInfo.data));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(mInfo.data[0], 0);
+    EXPECT_LE(norm_error_lowerTr('F', n, n, lda, hARes[0], mA.data), tol);
+    CHECK_ROCBLAS_ERROR(
+        hipsolverGetHostDispatchStats(handle, HIPSOLVERDN_POTRF, &host_calls, &device_calls));
+    EXPECT_EQ(host_calls, 1);
+    EXPECT_EQ(device_calls, 1);
+
+    // getrf
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrf(
+        handle, n, n, dA.data(), lda, dWork.data(), lwork, dIpiv.data(), dInfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+
+    copy(hA[0], hA[0] + n * n, mA.data);
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDgetrf(handle, n, n, mA.data, lda, nullptr, 0, mIpiv.data, mInfo.data));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(mInfo.data[0], 0);
+    EXPECT_LE(norm_error('F', n, n, lda, hARes[0], mA.data), tol);
+    for(int i = 0; i < n; i++)
+        EXPECT_EQ(mIpiv.data[i], hIpivRes[0][i]);
+
+    // syevd
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd(handle,
+                                        HIPSOLVER_EIG_MODE_NOVECTOR,
+                                        HIPSOLVER_FILL_MODE_LOWER,
+                                        n,
+                                        dA.data(),
+                                        lda,
+                                        dD.data(),
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data()));
+    host_strided_batch_vector<double> hDRes(n, 1, n, 1);
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+
+    copy(hA[0], hA[0] + n * n, mA.data);
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd(handle,
+                                        HIPSOLVER_EIG_MODE_NOVECTOR,
+                                        HIPSOLVER_FILL_MODE_LOWER,
+                                        n,
+                                        mA.data,
+                                        lda,
+                                        mD.data,
+                                        nullptr,
+                                        0,
+                                        mInfo.data));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(mInfo.data[0], 0);
+    EXPECT_LE(norm_error('F', 1, n, 1, hDRes[0], mD.data), tol);
+
+    // the device calls above were counted too; resetting clears every function
+    CHECK_ROCBLAS_ERROR(
+        hipsolverGetHostDispatchStats(handle, HIPSOLVERDN_SYEVD, &host_calls, &device_calls));
+    EXPECT_EQ(host_calls, 1);
+    EXPECT_EQ(device_calls, 1);
+
+    CHECK_ROCBLAS_ERROR(hipsolverResetHostDispatchStats(handle));
+    CHECK_ROCBLAS_ERROR(
+        hipsolverGetHostDispatchStats(handle, HIPSOLVERDN_GETRF, &host_calls, &device_calls));
+    EXPECT_EQ(host_calls, 0);
+    EXPECT_EQ(device_calls, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HOST_DISPATCH, ValuesIn(host_size_range));
+
+// solves batches in managed memory on the host: the strided getrf and getrs must recover the
+// solutions of their systems, and potrfBatched must agree with the device
+TEST_P(HOST_DISPATCH_BATCHED, potrf_getrf_getrs)
+{
+    int n = GetParam(), lda = n + 1, ldb = n, nrhs = 2, bc = 3;
+    int strideA = lda * n, strideB = ldb * nrhs;
+
+    hipsolver_local_handle handle;
+    hipStream_t            stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+
+    host_batch_vector<double>         hA(strideA, 1, bc);
+    host_strided_batch_vector<double> hX(strideB, 1, strideB, bc);
+    rocblas_init<double>(hA, true);
+    rocblas_init<double>(hX, false);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < i; j++)
+                hA[b][j + i * lda] = hA[b][i + j * lda];
+            hA[b][i + i * lda] += 400;
+        }
+    }
+
+    host_dispatch_array<double>  mA(strideA * bc), mB(strideB * bc);
+    host_dispatch_array<double*> mAarray(bc);
+    host_dispatch_array<int>     mIpiv(n * bc), mInfo(bc);
+    if(!mA.data || !mB.data || !mAarray.data || !mIpiv.data || !mInfo.data)
+        return;
+
+    CHECK_ROCBLAS_ERROR(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_GETRF, HIPSOLVER_ADV_HOST_SIZE, 64));
+    CHECK_ROCBLAS_ERROR(
+        hipsolverSetAdvOptions(handle, HIPSOLVERDN_POTRF, HIPSOLVER_ADV_HOST_SIZE, 64));
+
+    double  tol = 10 * n * get_epsilon<double>();
+    int64_t host_calls, device_calls;
+
+    // getrf and getrs, with B = A * X
+    for(int b = 0; b < bc; b++)
+    {
+        copy(hA[b], hA[b] + strideA, mA.data + b * strideA);
+        for(int c = 0; c < nrhs; c++)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                double sum = 0;
+                for(int j = 0; j < n; j++)
+                    sum += hA[b][i + j * lda] * hX[b][j + c * ldb];
+                mB.data[b * strideB + i + c * ldb] = sum;
+            }
+        }
+    }
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrfStridedBatched(
+        handle, n, n, mA.data, lda, strideA, nullptr, 0, mIpiv.data, n, mInfo.data, bc));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrsStridedBatched(handle,
+                                                      HIPSOLVER_OP_N,
+                                                      n,
+                                                      nrhs,
+                                                      mA.data,
+                                                      lda,
+                                                      strideA,
+                                                      mIpiv.data,
+                                                      n,
+                                                      mB.data,
+                                                      ldb,
+                                                      strideB,
+                                                      nullptr,
+                                                      0,
+                                                      mInfo.data,
+                                                      bc));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(mInfo.data[b], 0);
+        EXPECT_LE(norm_error('F', n, nrhs, ldb, hX[b], mB.data + b * strideB), tol);
+    }
+    CHECK_ROCBLAS_ERROR(
+        hipsolverGetHostDispatchStats(handle, HIPSOLVERDN_GETRF, &host_calls, &device_calls));
+    EXPECT_EQ(host_calls, 2);
+    EXPECT_EQ(device_calls, 0);
+
+    // potrfBatched
+    int lwork;
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrfBatched_bufferSize(
+        handle, HIPSOLVER_FILL_MODE_LOWER, n, nullptr, lda, &lwork, bc));
+
+    device_batch_vector<double>         dA(strideA, 1, bc);
+    device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, bc);
+    host_batch_vector<double>           hARes(strideA, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrfBatched(handle,
+                                               HIPSOLVER_FILL_MODE_LOWER,
+                                               n,
+                                               dA.data(),
+                                               lda,
+                                               dWork.data(),
+                                               lwork,
+                                               dInfo.data(),
+                                               bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    for(int b = 0; b < bc; b++)
+    {
+        copy(hA[b], hA[b] + strideA, mA.data + b * strideA);
+        mAarray.data[b] = mA.data + b * strideA;
+    }
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrfBatched(
+        handle, HIPSOLVER_FILL_MODE_LOWER, n, mAarray.data, lda, nullptr, 0, mInfo.data, bc));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(mInfo.data[b], 0);
+        EXPECT_LE(norm_error_lowerTr('F', n, n, lda, hARes[b], mA.data + b * strideA), tol);
+    }
+    CHECK_ROCBLAS_ERROR(
+        hipsolverGetHostDispatchStats(handle, HIPSOLVERDN_POTRF, &host_calls, &device_calls));
+    EXPECT_EQ(host_calls, 1);
+    EXPECT_EQ(device_calls, 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HOST_DISPATCH_BATCHED, ValuesIn(host_batched_range));
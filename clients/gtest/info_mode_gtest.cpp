@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, lda}
+const vector<vector<int>> info_size_range = {{1, 1}, {10, 10}, {20, 30}};
+
+class INFO_MODE : public ::TestWithParam<vector<int>>
+{
+protected:
+    INFO_MODE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST(INFO_MODE_API, bad_arg)
+{
+    hipsolver_local_handle handle;
+    hipsolverInfoMode_t    mode;
+    hipsolverInfoSummary_t summary;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetInfoMode(nullptr, HIPSOLVER_INFO_MODE_AGGREGATE),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoMode(nullptr, &mode), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoAsync(nullptr, &summary, nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoMode(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetInfoMode(handle, hipsolverInfoMode_t(-1)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // summaries are only available while aggregation is enabled
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoAsync(handle, &summary, nullptr),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetInfoMode(handle, HIPSOLVER_INFO_MODE_AGGREGATE),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoAsync(handle, nullptr, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST(INFO_MODE_API, set_get)
+{
+    hipsolver_local_handle handle;
+    hipsolverInfoMode_t    mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_INFO_MODE_DEFAULT);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetInfoMode(handle, HIPSOLVER_INFO_MODE_AGGREGATE),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_INFO_MODE_AGGREGATE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetInfoMode(handle, HIPSOLVER_INFO_MODE_DEFAULT),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_INFO_MODE_DEFAULT);
+}
+
+// three Cholesky factorizations, of which only the second one fails, must be reported in a
+// single summary
+TEST_P(INFO_MODE, potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1];
+
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    lwork;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetInfoMode(handle, HIPSOLVER_INFO_MODE_AGGREGATE),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, nullptr, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hB(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(lwork, 1, lwork, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    if(lwork)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    // hA is positive definite, while hB has a negative leading entry
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * lda] = hA[0][i + j * lda];
+        hA[0][i + i * lda] += 400;
+    }
+    for(int i = 0; i < lda * n; i++)
+        hB[0][i] = hA[0][i];
+    hB[0][0] = -1;
+
+    for(int k = 0; k < 3; k++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(k == 1 ? hB : hA));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrf(handle, uplo, n, dA.data(), lda, dWork.data(), lwork, dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+    }
+
+    hipEvent_t event;
+    CHECK_HIP_ERROR(hipEventCreate(&event));
+
+    hipsolverInfoSummary_t summary;
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoAsync(handle, &summary, event),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+    EXPECT_EQ(summary.info_count, 3);
+    EXPECT_NE(summary.any_failure, 0);
+    EXPECT_EQ(summary.failure_count, 1);
+    EXPECT_EQ(summary.first_failure, 1);
+
+    // a new summary starts from an empty log
+    EXPECT_ROCBLAS_STATUS(hipsolverGetInfoAsync(handle, &summary, event),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+    EXPECT_EQ(summary.info_count, 0);
+    EXPECT_EQ(summary.any_failure, 0);
+    EXPECT_EQ(summary.failure_count, 0);
+    EXPECT_EQ(summary.first_failure, -1);
+
+    CHECK_HIP_ERROR(hipEventDestroy(event));
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, INFO_MODE, ValuesIn(info_size_range));
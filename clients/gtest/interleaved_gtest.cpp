@@ -0,0 +1,380 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, batch_count}; the leading dimension of the matrices is n + 1
+const vector<vector<int>> interleaved_size_range
+    = {{1, 1}, {2, 100}, {4, 1000}, {8, 257}, {16, 64}, {40, 3}};
+
+const int interleaved_nrhs = 2;
+
+class INTERLEAVED : public ::TestWithParam<vector<int>>
+{
+protected:
+    INTERLEAVED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// the index of entry (i, j) of matrix b of an interleaved batch
+static size_t interleaved_index(int i, int j, int b, int ld, int bc)
+{
+    return b + (i + size_t(j) * ld) * bc;
+}
+
+// generates well conditioned symmetric matrices in the interleaved layout, with zeros in the
+// padding
+static void interleaved_init(host_strided_batch_vector<double>& hA, int n, int lda, int bc)
+{
+    rocblas_init<double>(hA, true);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < j; i++)
+                hA[0][interleaved_index(j, i, b, lda, bc)]
+                    = hA[0][interleaved_index(i, j, b, lda, bc)];
+            hA[0][interleaved_index(j, j, b, lda, bc)] += 10 * n;
+            for(int i = n; i < lda; i++)
+                hA[0][interleaved_index(i, j, b, lda, bc)] = 0;
+        }
+    }
+}
+
+TEST(INTERLEAVED_BAD_ARG, getrfInterleavedBatched)
+{
+    // larger than the small batched kernels, so that the batch is converted in the workspace
+    hipsolver_local_handle              handle;
+    int                                 n = 40, bc = 3, lw;
+    device_strided_batch_vector<double> dA(n * n * bc, 1, n * n * bc, 1);
+    device_strided_batch_vector<int>    dIpiv(n * bc, 1, n * bc, 1);
+    device_strided_batch_vector<int>    dinfo(bc, 1, bc, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrfInterleavedBatched_bufferSize(
+                              nullptr, n, n, dA.data(), n, &lw, bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfInterleavedBatched_bufferSize(handle, -1, n, dA.data(), n, &lw, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfInterleavedBatched_bufferSize(handle, n, n, dA.data(), n - 1, &lw, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfInterleavedBatched_bufferSize(handle, n, n, dA.data(), n, &lw, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfInterleavedBatched_bufferSize(handle, n, n, dA.data(), n, nullptr, bc),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfInterleavedBatched_bufferSize(handle, n, n, dA.data(), n, &lw, bc),
+        HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    // the workspace holds the strided copy of the batch
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrfInterleavedBatched(handle,
+                                                            n,
+                                                            n,
+                                                            dA.data(),
+                                                            n,
+                                                            dWork.data(),
+                                                            lw - 1,
+                                                            dIpiv.data(),
+                                                            dinfo.data(),
+                                                            bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // without a work array, the workspace is taken from the handle on AMD
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    hipsolverStatus_t no_work = HIPSOLVER_STATUS_SUCCESS;
+#else
+    hipsolverStatus_t no_work = HIPSOLVER_STATUS_INVALID_VALUE;
+#endif
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfInterleavedBatched(
+            handle, n, n, dA.data(), n, nullptr, lw, dIpiv.data(), dinfo.data(), bc),
+        no_work);
+
+    // quick return
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrfInterleavedBatched(
+                              handle, 0, n, nullptr, 1, nullptr, 0, nullptr, dinfo.data(), bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+}
+
+// converting a strided batch to the interleaved layout and back must give the batch back
+TEST_P(INTERLEAVED, conversions)
+{
+    int n = GetParam()[0], bc = GetParam()[1], lda = n + 1, strideA = lda * n + 3;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hA(strideA * bc, 1, strideA * bc, 1);
+    host_strided_batch_vector<double>   hI(lda * n * bc, 1, lda * n * bc, 1);
+    host_strided_batch_vector<double>   hR(strideA * bc, 1, strideA * bc, 1);
+    device_strided_batch_vector<double> dA(strideA * bc, 1, strideA * bc, 1);
+    device_strided_batch_vector<double> dI(lda * n * bc, 1, lda * n * bc, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dI.memcheck());
+    rocblas_init<double>(hA, true);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDstridedToInterleaved(
+                              handle, n, n, dA.data(), lda, strideA, dI.data(), lda, bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hI.transfer_from(dI));
+    for(int b = 0; b < bc; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                EXPECT_EQ(hI[0][interleaved_index(i, j, b, lda, bc)],
+                          hA[0][i + j * lda + size_t(b) * strideA]);
+
+    CHECK_HIP_ERROR(hipMemset(dA.data(), 0, sizeof(double) * strideA * bc));
+    EXPECT_ROCBLAS_STATUS(hipsolverDinterleavedToStrided(
+                              handle, n, n, dI.data(), lda, dA.data(), lda, strideA, bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hR.transfer_from(dA));
+    for(int b = 0; b < bc; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                EXPECT_EQ(hR[0][i + j * lda + size_t(b) * strideA],
+                          hA[0][i + j * lda + size_t(b) * strideA]);
+}
+
+// the factors of potrf_interleaved_batched must reproduce the matrices
+TEST_P(INTERLEAVED, potrfInterleavedBatched)
+{
+    int n = GetParam()[0], bc = GetParam()[1], lda = n + 1, size = lda * n * bc;
+
+    hipsolver_local_handle              handle;
+    hipsolverFillMode_t                 uplo = HIPSOLVER_FILL_MODE_LOWER;
+    host_strided_batch_vector<double>   hA(size, 1, size, 1);
+    host_strided_batch_vector<double>   hL(size, 1, size, 1);
+    host_strided_batch_vector<int>      hinfo(bc, 1, bc, 1);
+    device_strided_batch_vector<double> dA(size, 1, size, 1);
+    device_strided_batch_vector<int>    dinfo(bc, 1, bc, 1);
+    int                                 lw;
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    interleaved_init(hA, n, lda, bc);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfInterleavedBatched_bufferSize(handle, uplo, n, dA.data(), lda, &lw, bc),
+        HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfInterleavedBatched(
+                              handle, uplo, n, dA.data(), lda, dWork.data(), lw, dinfo.data(), bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    // on AMD, the workspace of a call without a work array is taken from the handle, and must
+    // give the same factors
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    CHECK_HIP_ERROR(hL.transfer_from(dA));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfInterleavedBatched(
+                              handle, uplo, n, dA.data(), lda, nullptr, 0, dinfo.data(), bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    host_strided_batch_vector<double> hL2(size, 1, size, 1);
+    CHECK_HIP_ERROR(hL2.transfer_from(dA));
+    for(int i = 0; i < size; i++)
+        EXPECT_EQ(hL2[0][i], hL[0][i]);
+#endif
+    CHECK_HIP_ERROR(hL.transfer_from(dA));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    // L * L^T = A, and the padding is not written
+    double err = 0;
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(hinfo[0][b], 0);
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = j; i < n; i++)
+            {
+                double sum = 0;
+                for(int l = 0; l <= j; l++)
+                    sum += hL[0][interleaved_index(i, l, b, lda, bc)]
+                           * hL[0][interleaved_index(j, l, b, lda, bc)];
+                err = max(err, abs(sum - hA[0][interleaved_index(i, j, b, lda, bc)]));
+            }
+            EXPECT_EQ(hL[0][interleaved_index(n, j, b, lda, bc)], 0);
+        }
+    }
+    ROCSOLVER_TEST_CHECK(double, err / (10 * n), n);
+}
+
+// the systems solved with the factors of getrf_interleaved_batched must match their known
+// solutions
+TEST_P(INTERLEAVED, getrfInterleavedBatched_getrsInterleavedBatched)
+{
+    int n = GetParam()[0], bc = GetParam()[1], lda = n + 1, ldb = n;
+    int size = lda * n * bc, bsize = ldb * interleaved_nrhs * bc;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hA(size, 1, size, 1);
+    host_strided_batch_vector<double>   hX(bsize, 1, bsize, 1);
+    host_strided_batch_vector<double>   hB(bsize, 1, bsize, 1);
+    host_strided_batch_vector<int>      hinfo(bc, 1, bc, 1);
+    device_strided_batch_vector<double> dA(size, 1, size, 1);
+    device_strided_batch_vector<double> dB(bsize, 1, bsize, 1);
+    device_strided_batch_vector<int>    dIpiv(n * bc, 1, n * bc, 1);
+    device_strided_batch_vector<int>    dinfo(bc, 1, bc, 1);
+    int                                 lwf, lws;
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    interleaved_init(hA, n, lda, bc);
+    rocblas_init<double>(hX, false);
+
+    // B = A * X
+    for(int b = 0; b < bc; b++)
+    {
+        for(int k = 0; k < interleaved_nrhs; k++)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                double sum = 0;
+                for(int j = 0; j < n; j++)
+                    sum += hA[0][interleaved_index(i, j, b, lda, bc)]
+                           * hX[0][interleaved_index(j, k, b, ldb, bc)];
+                hB[0][interleaved_index(i, k, b, ldb, bc)] = sum;
+            }
+        }
+    }
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfInterleavedBatched_bufferSize(handle, n, n, dA.data(), lda, &lwf, bc),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrsInterleavedBatched_bufferSize(handle,
+                                                                       HIPSOLVER_OP_N,
+                                                                       n,
+                                                                       interleaved_nrhs,
+                                                                       dA.data(),
+                                                                       lda,
+                                                                       dIpiv.data(),
+                                                                       dB.data(),
+                                                                       ldb,
+                                                                       &lws,
+                                                                       bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    int                                 lw = max(lwf, lws);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrfInterleavedBatched(handle,
+                                                            n,
+                                                            n,
+                                                            dA.data(),
+                                                            lda,
+                                                            dWork.data(),
+                                                            lwf,
+                                                            dIpiv.data(),
+                                                            dinfo.data(),
+                                                            bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    for(int b = 0; b < bc; b++)
+        EXPECT_EQ(hinfo[0][b], 0);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrsInterleavedBatched(handle,
+                                                            HIPSOLVER_OP_N,
+                                                            n,
+                                                            interleaved_nrhs,
+                                                            dA.data(),
+                                                            lda,
+                                                            dIpiv.data(),
+                                                            dB.data(),
+                                                            ldb,
+                                                            dWork.data(),
+                                                            lws,
+                                                            dinfo.data(),
+                                                            bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+
+    double err = 0;
+    for(int i = 0; i < bsize; i++)
+        err = max(err, abs(hB[0][i] - hX[0][i]));
+    ROCSOLVER_TEST_CHECK(double, err, n);
+}
+
+// the eigenpairs computed by syevj_interleaved_batched must satisfy A * v = w * v
+TEST_P(INTERLEAVED, syevjInterleavedBatched)
+{
+    int n = GetParam()[0], bc = GetParam()[1], lda = n + 1, size = lda * n * bc;
+
+    hipsolver_local_handle              handle;
+    hipsolver_local_syevj_info          params;
+    hipsolverEigMode_t                  jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    hipsolverFillMode_t                 uplo = HIPSOLVER_FILL_MODE_UPPER;
+    host_strided_batch_vector<double>   hA(size, 1, size, 1);
+    host_strided_batch_vector<double>   hV(size, 1, size, 1);
+    host_strided_batch_vector<double>   hW(n * bc, 1, n * bc, 1);
+    host_strided_batch_vector<int>      hinfo(bc, 1, bc, 1);
+    device_strided_batch_vector<double> dA(size, 1, size, 1);
+    device_strided_batch_vector<double> dW(n * bc, 1, n * bc, 1);
+    device_strided_batch_vector<int>    dinfo(bc, 1, bc, 1);
+    int                                 lw;
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    interleaved_init(hA, n, lda, bc);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevjInterleavedBatched_bufferSize(
+                              handle, jobz, uplo, n, dA.data(), lda, dW.data(), &lw, params, bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevjInterleavedBatched(handle,
+                                                            jobz,
+                                                            uplo,
+                                                            n,
+                                                            dA.data(),
+                                                            lda,
+                                                            dW.data(),
+                                                            dWork.data(),
+                                                            lw,
+                                                            dinfo.data(),
+                                                            params,
+                                                            bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hV.transfer_from(dA));
+    CHECK_HIP_ERROR(hW.transfer_from(dW));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    double err = 0;
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(hinfo[0][b], 0);
+        for(int k = 0; k < n; k++)
+        {
+            double w = hW[0][b + size_t(k) * bc];
+            for(int i = 0; i < n; i++)
+            {
+                double sum = 0;
+                for(int j = 0; j < n; j++)
+                    sum += hA[0][interleaved_index(i, j, b, lda, bc)]
+                           * hV[0][interleaved_index(j, k, b, lda, bc)];
+                err = max(err, abs(sum - w * hV[0][interleaved_index(i, k, b, lda, bc)]));
+            }
+        }
+    }
+    ROCSOLVER_TEST_CHECK(double, err / (10 * n), n);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, INTERLEAVED, ValuesIn(interleaved_size_range));
@@ -0,0 +1,219 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+const vector<hipsolverManagedMemoryMode_t> managed_mode_range
+    = {HIPSOLVER_MANAGED_MEMORY_OFF,
+       HIPSOLVER_MANAGED_MEMORY_PREFETCH,
+       HIPSOLVER_MANAGED_MEMORY_PREFETCH_RETURN};
+
+class MANAGED_MEMORY : public ::TestWithParam<hipsolverManagedMemoryMode_t>
+{
+protected:
+    MANAGED_MEMORY() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// managed allocation of a test, freed when it goes out of scope
+template <typename T>
+struct managed_array
+{
+    T* data = nullptr;
+
+    explicit managed_array(size_t size)
+    {
+        if(hipMallocManaged(&data, sizeof(T) * max(size, size_t(1))) != hipSuccess)
+            data = nullptr;
+    }
+    ~managed_array()
+    {
+        if(data)
+            hipFree(data);
+    }
+};
+
+TEST(MANAGED_MEMORY_API, mode)
+{
+    hipsolver_local_handle       handle;
+    hipsolverManagedMemoryMode_t mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetManagedMemoryMode(nullptr, HIPSOLVER_MANAGED_MEMORY_OFF),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetManagedMemoryMode(nullptr, &mode),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetManagedMemoryMode(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetManagedMemoryMode(handle, hipsolverManagedMemoryMode_t(-1)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    // managed arguments migrate on demand by default
+    CHECK_ROCBLAS_ERROR(hipsolverGetManagedMemoryMode(handle, &mode));
+    EXPECT_EQ(mode, HIPSOLVER_MANAGED_MEMORY_OFF);
+
+    for(hipsolverManagedMemoryMode_t m : managed_mode_range)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverSetManagedMemoryMode(handle, m));
+        CHECK_ROCBLAS_ERROR(hipsolverGetManagedMemoryMode(handle, &mode));
+        EXPECT_EQ(mode, m);
+    }
+}
+
+// factors the same matrix in managed memory and in device memory; the results must not depend
+// on where the arguments were prefetched
+TEST_P(MANAGED_MEMORY, potrf_syevd)
+{
+    hipsolverManagedMemoryMode_t mode = GetParam();
+    int                          n    = 50;
+
+    hipsolver_local_handle handle;
+    hipStream_t            stream;
+    CHECK_ROCBLAS_ERROR(hipsolverSetManagedMemoryMode(handle, mode));
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, 1);
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * n] = hA[0][i + j * n];
+        hA[0][i + i * n] += 400;
+    }
+
+    int lwork_potrf, lwork_syevd;
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDpotrf_bufferSize(handle, HIPSOLVER_FILL_MODE_LOWER, n, nullptr, n, &lwork_potrf));
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd_bufferSize(handle,
+                                                   HIPSOLVER_EIG_MODE_VECTOR,
+                                                   HIPSOLVER_FILL_MODE_LOWER,
+                                                   n,
+                                                   nullptr,
+                                                   n,
+                                                   nullptr,
+                                                   &lwork_syevd));
+    int lwork = max(lwork_potrf, lwork_syevd);
+
+    // the device does not support managed memory
+    managed_array<double> mA(n * n), mD(n), mWork(lwork);
+    managed_array<int>    mInfo(1);
+    if(!mA.data || !mD.data || !mWork.data || !mInfo.data)
+        return;
+
+    // reference computed in device memory
+    host_strided_batch_vector<double>   hARes(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hDRes(n, 1, n, 1);
+    device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<double> dD(n, 1, n, 1);
+    device_strided_batch_vector<double> dWork(max(lwork, 1), 1, max(lwork, 1), 1);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // potrf
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrf(handle,
+                                        HIPSOLVER_FILL_MODE_LOWER,
+                                        n,
+                                        dA.data(),
+                                        n,
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    copy(hA[0], hA[0] + n * n, mA.data);
+    CHECK_ROCBLAS_ERROR(hipsolverDpotrf(
+        handle, HIPSOLVER_FILL_MODE_LOWER, n, mA.data, n, mWork.data, lwork, mInfo.data));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(mInfo.data[0], 0);
+    EXPECT_EQ(norm_error('F', n, n, n, hARes[0], mA.data), 0);
+
+    // syevd
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd(handle,
+                                        HIPSOLVER_EIG_MODE_VECTOR,
+                                        HIPSOLVER_FILL_MODE_LOWER,
+                                        n,
+                                        dA.data(),
+                                        n,
+                                        dD.data(),
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data()));
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+
+    copy(hA[0], hA[0] + n * n, mA.data);
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd(handle,
+                                        HIPSOLVER_EIG_MODE_VECTOR,
+                                        HIPSOLVER_FILL_MODE_LOWER,
+                                        n,
+                                        mA.data,
+                                        n,
+                                        mD.data,
+                                        mWork.data,
+                                        lwork,
+                                        mInfo.data));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(mInfo.data[0], 0);
+    EXPECT_EQ(norm_error('F', 1, n, 1, hDRes[0], mD.data), 0);
+
+    // the hints are not reported as errors
+    EXPECT_EQ(hipGetLastError(), hipSuccess);
+}
+
+// factors the second of two matrices of one managed allocation, of which only the extent of the
+// arguments is prefetched; a failed call returns its own status
+TEST_P(MANAGED_MEMORY, submatrix_status)
+{
+    hipsolverManagedMemoryMode_t mode = GetParam();
+    int                          n    = 50;
+
+    hipsolver_local_handle handle;
+    hipStream_t            stream;
+    CHECK_ROCBLAS_ERROR(hipsolverSetManagedMemoryMode(handle, mode));
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+
+    int lwork;
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDpotrf_bufferSize(handle, HIPSOLVER_FILL_MODE_LOWER, n, nullptr, n, &lwork));
+
+    // the device does not support managed memory
+    managed_array<double> mA(2 * n * n), mWork(lwork);
+    managed_array<int>    mInfo(1);
+    if(!mA.data || !mWork.data || !mInfo.data)
+        return;
+
+    double* A = mA.data + n * n;
+    fill(mA.data, mA.data + 2 * n * n, 0.0);
+    for(int i = 0; i < n; i++)
+        A[i + i * n] = 4;
+
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDpotrf(handle, HIPSOLVER_FILL_MODE_LOWER, n, A, n, mWork.data, lwork, mInfo.data));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(mInfo.data[0], 0);
+    for(int i = 0; i < n; i++)
+        EXPECT_EQ(A[i + i * n], 2);
+    EXPECT_EQ(mA.data[0], 0);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf(
+            handle, HIPSOLVER_FILL_MODE_LOWER, n, A, n - 1, mWork.data, lwork, mInfo.data),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    EXPECT_EQ(hipGetLastError(), hipSuccess);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, MANAGED_MEMORY, ValuesIn(managed_mode_range));
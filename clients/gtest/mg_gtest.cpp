@@ -0,0 +1,846 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, nb}
+const vector<vector<int>> mg_size_range = {{1, 1}, {20, 4}, {33, 8}, {64, 16}};
+
+// the NVIDIA backend is only tested with the lower triangle and untransposed systems, which all
+// the versions of cuSOLVERMg support
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+const vector<hipsolverFillMode_t>  mg_fill_range
+    = {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER};
+const vector<hipsolverOperation_t> mg_op_range   = {HIPSOLVER_OP_N, HIPSOLVER_OP_T, HIPSOLVER_OP_C};
+#else
+const vector<hipsolverFillMode_t>  mg_fill_range = {HIPSOLVER_FILL_MODE_LOWER};
+const vector<hipsolverOperation_t> mg_op_range   = {HIPSOLVER_OP_N};
+#endif
+
+class MG : public ::TestWithParam<vector<int>>
+{
+protected:
+    MG() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// a matrix stored in the 1D block-cyclic column layout of hipsolverMg
+template <typename T>
+class mg_matrix
+{
+    vector<int> devices;
+    int         rows, cols, nb;
+    vector<T*>  ptrs;
+
+    int owner(int j) const
+    {
+        return (j / nb) % int(devices.size());
+    }
+    T* column(int j) const
+    {
+        return ptrs[owner(j)] + size_t(j / nb / devices.size() * nb + j % nb) * rows;
+    }
+
+public:
+    mg_matrix(const vector<int>& devices, int rows, int cols, int nb)
+        : devices(devices)
+        , rows(rows)
+        , cols(cols)
+        , nb(nb)
+        , ptrs(devices.size(), nullptr)
+    {
+        // allocate every local block in full, which is enough for all the devices
+        size_t blocks = (cols + nb - 1) / nb;
+        size_t local  = (blocks + devices.size() - 1) / devices.size() * nb;
+        size_t size   = sizeof(T) * max(size_t(rows) * local, size_t(1));
+        for(size_t d = 0; d < devices.size(); d++)
+        {
+            if(hipSetDevice(devices[d]) != hipSuccess || hipMalloc(&ptrs[d], size) != hipSuccess)
+                ptrs[d] = nullptr;
+        }
+        hipSetDevice(devices[0]);
+    }
+
+    ~mg_matrix()
+    {
+        for(size_t d = 0; d < devices.size(); d++)
+        {
+            hipSetDevice(devices[d]);
+            hipFree(ptrs[d]);
+        }
+        hipSetDevice(devices[0]);
+    }
+
+    T** data()
+    {
+        return ptrs.data();
+    }
+
+    hipError_t memcheck() const
+    {
+        for(T* p : ptrs)
+            if(!p)
+                return hipErrorOutOfMemory;
+        return hipSuccess;
+    }
+
+    hipError_t scatter(const T* hA, int lda)
+    {
+        for(int j = 0; j < cols; j++)
+        {
+            const T*   src = hA + size_t(j) * lda;
+            hipError_t err = hipMemcpy(column(j), src, sizeof(T) * rows, hipMemcpyHostToDevice);
+            if(err != hipSuccess)
+                return err;
+        }
+        return hipSuccess;
+    }
+
+    hipError_t gather(T* hA, int lda) const
+    {
+        for(int j = 0; j < cols; j++)
+        {
+            T*         dst = hA + size_t(j) * lda;
+            hipError_t err = hipMemcpy(dst, column(j), sizeof(T) * rows, hipMemcpyDeviceToHost);
+            if(err != hipSuccess)
+                return err;
+        }
+        return hipSuccess;
+    }
+};
+
+// a batch of matrices in managed memory, with its array of pointers, which every device of a
+// device group can access
+template <typename T>
+class mg_managed_batch
+{
+    size_t size;
+    T*     buffer = nullptr;
+    T**    ptrs   = nullptr;
+
+public:
+    mg_managed_batch(size_t size, int bc)
+        : size(size)
+    {
+        if(hipMallocManaged(&buffer, sizeof(T) * max(size * bc, size_t(1))) != hipSuccess
+           || hipMallocManaged(&ptrs, sizeof(T*) * max(bc, 1)) != hipSuccess)
+            return;
+        for(int b = 0; b < bc; b++)
+            ptrs[b] = buffer + b * size;
+    }
+
+    ~mg_managed_batch()
+    {
+        hipFree(buffer);
+        hipFree(ptrs);
+    }
+
+    T** data()
+    {
+        return ptrs;
+    }
+
+    T* operator[](int b)
+    {
+        return buffer + b * size;
+    }
+
+    hipError_t memcheck() const
+    {
+        return buffer && ptrs ? hipSuccess : hipErrorOutOfMemory;
+    }
+};
+
+static vector<int> mg_devices()
+{
+    int count = 0;
+    EXPECT_EQ(hipGetDeviceCount(&count), hipSuccess);
+
+    vector<int> devices(count);
+    for(int d = 0; d < count; d++)
+        devices[d] = d;
+    return devices;
+}
+
+// generates a well conditioned symmetric positive definite matrix
+static void mg_init_spd(host_strided_batch_vector<double>& hA, int n)
+{
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * n] = hA[0][i + j * n];
+        hA[0][i + i * n] += 400;
+    }
+}
+
+TEST(MG_BAD_ARG, handle)
+{
+    hipsolverMgHandle_t     handle;
+    hipsolverMgMatrixDesc_t desc;
+    int                     device = 0;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(nullptr), HIPSOLVER_STATUS_HANDLE_IS_NULLPTR);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(nullptr, 1, &device),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(nullptr, &desc, 1, 1, 1),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroyMatrixDesc(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+
+    // no device has been selected yet
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(handle, &desc, 1, 1, 1),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(handle, 0, &device),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(handle, 1, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(handle, 1, &device), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(handle, nullptr, 1, 1, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(handle, &desc, -1, 1, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(handle, &desc, 1, 1, 0),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST(MG_BAD_ARG, routines)
+{
+    hipsolverMgHandle_t     handle;
+    hipsolverMgMatrixDesc_t desc;
+    int                     device = 0;
+    int64_t                 lwork;
+    hipsolverFillMode_t     uplo = HIPSOLVER_FILL_MODE_LOWER;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(handle, 1, &device), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(handle, &desc, 10, 10, 2),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDpotrf_bufferSize(nullptr, uplo, 10, nullptr, desc, &lwork),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDpotrf_bufferSize(handle, uplo, 10, nullptr, nullptr, &lwork),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDpotrf_bufferSize(handle, uplo, -1, nullptr, desc, &lwork),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDgetrf_bufferSize(
+                              handle, 10, 10, nullptr, nullptr, nullptr, &lwork),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // the rocSOLVER backend supports both triangles and all the operations, and rejects the
+    // values that are not valid
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDpotrf_bufferSize(
+                              handle, HIPSOLVER_FILL_MODE_UPPER, 10, nullptr, desc, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDpotrf_bufferSize(
+                              handle, hipsolverFillMode_t(-1), 10, nullptr, desc, &lwork),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDgetrs_bufferSize(handle,
+                                                       HIPSOLVER_OP_T,
+                                                       10,
+                                                       1,
+                                                       nullptr,
+                                                       desc,
+                                                       nullptr,
+                                                       nullptr,
+                                                       desc,
+                                                       &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDsyevd_bufferSize(handle,
+                                                       HIPSOLVER_EIG_MODE_VECTOR,
+                                                       HIPSOLVER_FILL_MODE_UPPER,
+                                                       10,
+                                                       nullptr,
+                                                       desc,
+                                                       nullptr,
+                                                       &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDsyevd_bufferSize(handle,
+                                                       hipsolverEigMode_t(-1),
+                                                       uplo,
+                                                       10,
+                                                       nullptr,
+                                                       desc,
+                                                       nullptr,
+                                                       &lwork),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+#endif
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroyMatrixDesc(desc), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST(MG_BAD_ARG, device_group)
+{
+    hipsolver_local_handle handle;
+    hipsolverMgHandle_t    mg, group;
+    hipsolverFillMode_t    uplo   = HIPSOLVER_FILL_MODE_LOWER;
+    int                    device = 0;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&mg), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(nullptr, mg), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetDeviceGroup(nullptr, &group),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetDeviceGroup(handle, nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // no device has been selected yet
+    EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(handle, mg), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(mg, 1, &device), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(handle, mg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetDeviceGroup(handle, &group), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(group, mg);
+
+    // the batch is checked before it is split
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfBatched(handle, uplo, 10, nullptr, 10, nullptr, 0, nullptr, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(handle, nullptr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetDeviceGroup(handle, &group), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(group, nullptr);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(mg), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// the distributed factorization must match the factorization computed on a single device
+static void mg_potrf(const vector<int>& size, hipsolverFillMode_t uplo)
+{
+    int n = size[0], nb = size[1];
+
+    vector<int>             devices = mg_devices();
+    hipsolverMgHandle_t     mg;
+    hipsolverMgMatrixDesc_t descA;
+    int64_t                 lwork;
+    int                     info;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&mg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(mg, int(devices.size()), devices.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(mg, &descA, n, n, nb),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double> hARes(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double> hAMg(n * n, 1, n * n, 1);
+    mg_init_spd(hA, n);
+
+    {
+        mg_matrix<double> dA(devices, n, n, nb);
+        CHECK_HIP_ERROR(dA.memcheck());
+        EXPECT_ROCBLAS_STATUS(hipsolverMgDpotrf_bufferSize(mg, uplo, n, dA.data(), descA, &lwork),
+                              HIPSOLVER_STATUS_SUCCESS);
+        mg_matrix<double> dWork(devices, int(lwork), 1, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.scatter(hA[0], n));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverMgDpotrf(mg, uplo, n, dA.data(), descA, dWork.data(), lwork, &info),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(dA.gather(hAMg[0], n));
+        EXPECT_EQ(info, 0);
+    }
+
+    {
+        hipsolver_local_handle              handle;
+        int                                 lw;
+        device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+        device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, dA.data(), n, &lw),
+                              HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        if(lw)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrf(handle, uplo, n, dA.data(), n, dWork.data(), lw, dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    }
+
+    // only the triangle uplo is referenced
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            if(uplo == HIPSOLVER_FILL_MODE_LOWER ? i < j : i > j)
+                hARes[0][i + j * n] = hAMg[0][i + j * n] = 0;
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hARes[0], hAMg[0]), n);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroyMatrixDesc(descA), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(mg), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_P(MG, potrf)
+{
+    for(hipsolverFillMode_t uplo : mg_fill_range)
+        mg_potrf(GetParam(), uplo);
+}
+
+// the solution of the distributed getrf and getrs must match the one computed on a single device
+static void mg_getrf_getrs(const vector<int>& size, hipsolverOperation_t trans)
+{
+    int n = size[0], nb = size[1], nrhs = 3;
+
+    vector<int>             devices = mg_devices();
+    hipsolverMgHandle_t     mg;
+    hipsolverMgMatrixDesc_t descA, descB;
+    int64_t                 lwork_getrf, lwork_getrs;
+    int                     info;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&mg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(mg, int(devices.size()), devices.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(mg, &descA, n, n, nb),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(mg, &descB, n, nrhs, 1),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double> hB(n * nrhs, 1, n * nrhs, 1);
+    host_strided_batch_vector<double> hXRes(n * nrhs, 1, n * nrhs, 1);
+    host_strided_batch_vector<double> hXMg(n * nrhs, 1, n * nrhs, 1);
+    rocblas_init<double>(hA, true);
+    rocblas_init<double>(hB, true);
+    for(int i = 0; i < n; i++)
+        hA[0][i + i * n] += 400;
+
+    {
+        mg_matrix<double> dA(devices, n, n, nb);
+        mg_matrix<double> dB(devices, n, nrhs, 1);
+        mg_matrix<int>    dIpiv(devices, 1, n, nb);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverMgDgetrf_bufferSize(mg, n, n, dA.data(), descA, dIpiv.data(), &lwork_getrf),
+            HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverMgDgetrs_bufferSize(mg,
+                                                           trans,
+                                                           n,
+                                                           nrhs,
+                                                           dA.data(),
+                                                           descA,
+                                                           dIpiv.data(),
+                                                           dB.data(),
+                                                           descB,
+                                                           &lwork_getrs),
+                              HIPSOLVER_STATUS_SUCCESS);
+        int64_t           lwork = max(lwork_getrf, lwork_getrs);
+        mg_matrix<double> dWork(devices, int(lwork), 1, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.scatter(hA[0], n));
+        CHECK_HIP_ERROR(dB.scatter(hB[0], n));
+        EXPECT_ROCBLAS_STATUS(hipsolverMgDgetrf(mg,
+                                                n,
+                                                n,
+                                                dA.data(),
+                                                descA,
+                                                dIpiv.data(),
+                                                dWork.data(),
+                                                lwork,
+                                                &info),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(info, 0);
+        EXPECT_ROCBLAS_STATUS(hipsolverMgDgetrs(mg,
+                                                trans,
+                                                n,
+                                                nrhs,
+                                                dA.data(),
+                                                descA,
+                                                dIpiv.data(),
+                                                dB.data(),
+                                                descB,
+                                                dWork.data(),
+                                                lwork,
+                                                &info),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(info, 0);
+        CHECK_HIP_ERROR(dB.gather(hXMg[0], n));
+    }
+
+    {
+        hipsolver_local_handle              handle;
+        int                                 lw_getrf, lw_getrs;
+        device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+        device_strided_batch_vector<double> dB(n * nrhs, 1, n * nrhs, 1);
+        device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+        device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, n, n, dA.data(), n, &lw_getrf),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrs_bufferSize(handle,
+                                                         trans,
+                                                         n,
+                                                         nrhs,
+                                                         dA.data(),
+                                                         n,
+                                                         dIpiv.data(),
+                                                         dB.data(),
+                                                         n,
+                                                         &lw_getrs),
+                              HIPSOLVER_STATUS_SUCCESS);
+        int                                 lw = max(lw_getrf, lw_getrs);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        if(lw)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrf(handle,
+                                              n,
+                                              n,
+                                              dA.data(),
+                                              n,
+                                              dWork.data(),
+                                              lw,
+                                              dIpiv.data(),
+                                              dinfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrs(handle,
+                                              trans,
+                                              n,
+                                              nrhs,
+                                              dA.data(),
+                                              n,
+                                              dIpiv.data(),
+                                              dB.data(),
+                                              n,
+                                              dWork.data(),
+                                              lw,
+                                              dinfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hXRes.transfer_from(dB));
+    }
+
+    ROCSOLVER_TEST_CHECK(double, norm_error('I', n, nrhs, n, hXRes[0], hXMg[0]), n);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroyMatrixDesc(descA), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroyMatrixDesc(descB), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(mg), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_P(MG, getrf_getrs)
+{
+    for(hipsolverOperation_t trans : mg_op_range)
+        mg_getrf_getrs(GetParam(), trans);
+}
+
+// the eigenvalues of the distributed syevd must match the ones computed on a single device, and
+// its eigenvectors must satisfy A * V = V * diag(W)
+static void mg_syevd(const vector<int>& size, hipsolverFillMode_t uplo)
+{
+    int n = size[0], nb = size[1];
+
+    vector<int>             devices = mg_devices();
+    hipsolverMgHandle_t     mg;
+    hipsolverMgMatrixDesc_t descA;
+    hipsolverEigMode_t      jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    int64_t                 lwork;
+    int                     info;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&mg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(mg, int(devices.size()), devices.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreateMatrixDesc(mg, &descA, n, n, nb),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double> hV(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double> hWRes(n, 1, n, 1);
+    host_strided_batch_vector<double> hWMg(n, 1, n, 1);
+    mg_init_spd(hA, n);
+
+    {
+        mg_matrix<double> dA(devices, n, n, nb);
+        CHECK_HIP_ERROR(dA.memcheck());
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverMgDsyevd_bufferSize(mg, jobz, uplo, n, dA.data(), descA, hWMg[0], &lwork),
+            HIPSOLVER_STATUS_SUCCESS);
+        mg_matrix<double> dWork(devices, int(lwork), 1, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.scatter(hA[0], n));
+        EXPECT_ROCBLAS_STATUS(hipsolverMgDsyevd(mg,
+                                                jobz,
+                                                uplo,
+                                                n,
+                                                dA.data(),
+                                                descA,
+                                                hWMg[0],
+                                                dWork.data(),
+                                                lwork,
+                                                &info),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(dA.gather(hV[0], n));
+        EXPECT_EQ(info, 0);
+    }
+
+    {
+        hipsolver_local_handle              handle;
+        int                                 lw;
+        device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+        device_strided_batch_vector<double> dW(n, 1, n, 1);
+        device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dW.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, dA.data(), n, dW.data(), &lw),
+            HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        if(lw)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                              jobz,
+                                              uplo,
+                                              n,
+                                              dA.data(),
+                                              n,
+                                              dW.data(),
+                                              dWork.data(),
+                                              lw,
+                                              dinfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hWRes.transfer_from(dW));
+    }
+
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', 1, n, 1, hWRes[0], hWMg[0]), n);
+
+    double err = 0, nrm = 0;
+    for(int j = 0; j < n; j++)
+    {
+        nrm = max(nrm, abs(hWMg[0][j]));
+        for(int i = 0; i < n; i++)
+        {
+            double sum = -hWMg[0][j] * hV[0][i + j * n];
+            for(int k = 0; k < n; k++)
+                sum += hA[0][i + k * n] * hV[0][k + j * n];
+            err = max(err, abs(sum));
+        }
+    }
+    ROCSOLVER_TEST_CHECK(double, err / nrm, n * n);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroyMatrixDesc(descA), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(mg), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_P(MG, syevd)
+{
+    for(hipsolverFillMode_t uplo : mg_fill_range)
+        mg_syevd(GetParam(), uplo);
+}
+
+// the batched factorizations of a handle with a device group must match the ones computed on the
+// device of the handle, with a batch that does not split evenly over the devices
+TEST_P(MG, potrfBatched_device_group)
+{
+    vector<int> size = GetParam();
+    int         n    = size[0];
+
+    vector<int>         devices = mg_devices();
+    int                 bc      = 2 * int(devices.size()) + 1;
+    hipsolverMgHandle_t mg;
+    hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_LOWER;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&mg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(mg, int(devices.size()), devices.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, bc);
+    host_strided_batch_vector<double> hARes(n * n, 1, n * n, bc);
+    host_strided_batch_vector<double> hAMg(n * n, 1, n * n, bc);
+    rocblas_init<double>(hA, true);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < i; j++)
+                hA[b][j + i * n] = hA[b][i + j * n];
+            hA[b][i + i * n] += 400;
+        }
+    }
+
+    for(bool grouped : {false, true})
+    {
+        hipsolver_local_handle   handle;
+        mg_managed_batch<double> dA(n * n, bc);
+        mg_managed_batch<int>    dinfo(1, bc);
+        int                      lw;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        for(int b = 0; b < bc; b++)
+            for(int i = 0; i < n * n; i++)
+                dA[b][i] = hA[b][i];
+
+        EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(handle, grouped ? mg : nullptr),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfBatched_bufferSize(handle, uplo, n, dA.data(), n, &lw, bc),
+            HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        if(lw)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfBatched(handle, uplo, n, dA.data(), n, dWork.data(), lw, dinfo[0], bc),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(handle, nullptr), HIPSOLVER_STATUS_SUCCESS);
+
+        host_strided_batch_vector<double>& hRes = grouped ? hAMg : hARes;
+        for(int b = 0; b < bc; b++)
+        {
+            EXPECT_EQ(dinfo[b][0], 0);
+            for(int i = 0; i < n * n; i++)
+                hRes[b][i] = dA[b][i];
+        }
+    }
+
+    // only the lower triangle is referenced
+    for(int b = 0; b < bc; b++)
+    {
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < j; i++)
+                hARes[b][i + j * n] = hAMg[b][i + j * n] = 0;
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hARes[b], hAMg[b]), n);
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(mg), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_P(MG, getrfBatched_getrsBatched_device_group)
+{
+    vector<int> size = GetParam();
+    int         n    = size[0];
+
+    vector<int>          devices = mg_devices();
+    int                  bc      = 2 * int(devices.size()) + 1;
+    hipsolverMgHandle_t  mg;
+    hipsolverOperation_t trans = HIPSOLVER_OP_N;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgCreate(&mg), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDeviceSelect(mg, int(devices.size()), devices.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double> hA(n * n, 1, n * n, bc);
+    host_strided_batch_vector<double> hB(n, 1, n, bc);
+    host_strided_batch_vector<double> hXRes(n, 1, n, bc);
+    host_strided_batch_vector<double> hXMg(n, 1, n, bc);
+    rocblas_init<double>(hA, true);
+    rocblas_init<double>(hB, true);
+    for(int b = 0; b < bc; b++)
+        for(int i = 0; i < n; i++)
+            hA[b][i + i * n] += 400;
+
+    for(bool grouped : {false, true})
+    {
+        hipsolver_local_handle   handle;
+        mg_managed_batch<double> dA(n * n, bc);
+        mg_managed_batch<double> dB(n, bc);
+        mg_managed_batch<int>    dIpiv(n, bc);
+        mg_managed_batch<int>    dinfo(1, bc);
+        int                      lw_getrf, lw_getrs;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        for(int b = 0; b < bc; b++)
+        {
+            for(int i = 0; i < n * n; i++)
+                dA[b][i] = hA[b][i];
+            for(int i = 0; i < n; i++)
+                dB[b][i] = hB[b][i];
+        }
+
+        EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(handle, grouped ? mg : nullptr),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDgetrfBatched_bufferSize(handle, n, n, dA.data(), n, &lw_getrf, bc),
+            HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrsBatched_bufferSize(handle,
+                                                                trans,
+                                                                n,
+                                                                1,
+                                                                dA.data(),
+                                                                n,
+                                                                dIpiv[0],
+                                                                n,
+                                                                dB.data(),
+                                                                n,
+                                                                &lw_getrs,
+                                                                bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        int                                 lw = max(lw_getrf, lw_getrs);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        if(lw)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrfBatched(handle,
+                                                     n,
+                                                     n,
+                                                     dA.data(),
+                                                     n,
+                                                     dWork.data(),
+                                                     lw,
+                                                     dIpiv[0],
+                                                     n,
+                                                     dinfo[0],
+                                                     bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrsBatched(handle,
+                                                     trans,
+                                                     n,
+                                                     1,
+                                                     dA.data(),
+                                                     n,
+                                                     dIpiv[0],
+                                                     n,
+                                                     dB.data(),
+                                                     n,
+                                                     dWork.data(),
+                                                     lw,
+                                                     dinfo[0],
+                                                     bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        EXPECT_ROCBLAS_STATUS(hipsolverSetDeviceGroup(handle, nullptr), HIPSOLVER_STATUS_SUCCESS);
+
+        host_strided_batch_vector<double>& hX = grouped ? hXMg : hXRes;
+        for(int b = 0; b < bc; b++)
+            for(int i = 0; i < n; i++)
+                hX[b][i] = dB[b][i];
+    }
+
+    for(int b = 0; b < bc; b++)
+        ROCSOLVER_TEST_CHECK(double, norm_error('I', n, 1, n, hXRes[b], hXMg[b]), n);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverMgDestroy(mg), HIPSOLVER_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, MG, ValuesIn(mg_size_range));
@@ -89,16 +89,17 @@ protected:
     virtual void SetUp() {}
     virtual void TearDown() {}
 
-    template <typename T>
+    template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
         Arguments arg = orgbr_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == 1
            && arg.get<char>("side") == 'L')
-            testing_orgbr_ungbr_bad_arg<FORTRAN, T>();
+            testing_orgbr_ungbr_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        testing_orgbr_ungbr<FORTRAN, T>(arg);
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
+        testing_orgbr_ungbr<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
 
@@ -122,42 +123,126 @@ class UNGBR_FORTRAN : public ORGBR_UNGBR<true>
 
 TEST_P(ORGBR, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORGBR, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNGBR, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNGBR, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
 }
 
 TEST_P(ORGBR_FORTRAN, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORGBR_FORTRAN, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNGBR_FORTRAN, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNGBR_FORTRAN, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(ORGBR, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORGBR, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(ORGBR_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORGBR_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(UNGBR, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNGBR, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(UNGBR_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNGBR_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(ORGBR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORGBR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(ORGBR_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORGBR_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(UNGBR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNGBR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(UNGBR_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNGBR_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
 }
 
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
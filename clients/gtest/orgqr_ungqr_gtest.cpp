@@ -75,15 +75,16 @@ protected:
     virtual void SetUp() {}
     virtual void TearDown() {}
 
-    template <typename T>
+    template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
         Arguments arg = orgqr_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == -1)
-            testing_orgqr_ungqr_bad_arg<FORTRAN, T>();
+            testing_orgqr_ungqr_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        testing_orgqr_ungqr<FORTRAN, T>(arg);
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
+        testing_orgqr_ungqr<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
 
@@ -107,42 +108,126 @@ class UNGQR_FORTRAN : public ORGQR_UNGQR<true>
 
 TEST_P(ORGQR, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORGQR, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNGQR, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNGQR, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
 }
 
 TEST_P(ORGQR_FORTRAN, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORGQR_FORTRAN, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNGQR_FORTRAN, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNGQR_FORTRAN, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(ORGQR, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORGQR, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(ORGQR_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORGQR_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(UNGQR, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNGQR, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(UNGQR_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNGQR_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(ORGQR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORGQR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(ORGQR_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORGQR_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(UNGQR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNGQR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(UNGQR_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNGQR_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
 }
 
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
@@ -59,15 +59,16 @@ protected:
     virtual void SetUp() {}
     virtual void TearDown() {}
 
-    template <typename T>
+    template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
         Arguments arg = orgtr_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("uplo") == 'U')
-            testing_orgtr_ungtr_bad_arg<FORTRAN, T>();
+            testing_orgtr_ungtr_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        testing_orgtr_ungtr<FORTRAN, T>(arg);
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
+        testing_orgtr_ungtr<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
 
@@ -91,42 +92,126 @@ class UNGTR_FORTRAN : public ORGTR_UNGTR<true>
 
 TEST_P(ORGTR, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORGTR, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNGTR, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNGTR, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
 }
 
 TEST_P(ORGTR_FORTRAN, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORGTR_FORTRAN, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNGTR_FORTRAN, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNGTR_FORTRAN, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(ORGTR, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORGTR, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(ORGTR_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORGTR_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(UNGTR, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNGTR, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(UNGTR_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNGTR_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(ORGTR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORGTR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(ORGTR_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORGTR_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(UNGTR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNGTR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(UNGTR_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNGTR_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
 }
 
 // INSTANTIATE_TEST_SUITE_P(daily_lapack, ORGTR, Combine(ValuesIn(large_size_range), ValuesIn(uplo)));
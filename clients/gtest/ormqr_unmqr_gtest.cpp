@@ -98,16 +98,17 @@ protected:
     virtual void SetUp() {}
     virtual void TearDown() {}
 
-    template <typename T>
+    template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
         Arguments arg = ormqr_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("m") == -1 && arg.peek<char>("side") == 'L'
            && arg.peek<char>("trans") == 'T')
-            testing_ormqr_unmqr_bad_arg<FORTRAN, T>();
+            testing_ormqr_unmqr_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        testing_ormqr_unmqr<FORTRAN, T>(arg);
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
+        testing_ormqr_unmqr<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
 
@@ -131,42 +132,126 @@ class UNMQR_FORTRAN : public ORMQR_UNMQR<true>
 
 TEST_P(ORMQR, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORMQR, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNMQR, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNMQR, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
 }
 
 TEST_P(ORMQR_FORTRAN, __float)
 {
-    run_tests<float>();
+    run_tests<false, false, float>();
 }
 
 TEST_P(ORMQR_FORTRAN, __double)
 {
-    run_tests<double>();
+    run_tests<false, false, double>();
 }
 
 TEST_P(UNMQR_FORTRAN, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, false, rocblas_float_complex>();
 }
 
 TEST_P(UNMQR_FORTRAN, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(ORMQR, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORMQR, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(ORMQR_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(ORMQR_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(UNMQR, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNMQR, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(UNMQR_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(UNMQR_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(ORMQR, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORMQR, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(ORMQR_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(ORMQR_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(UNMQR, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNMQR, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(UNMQR_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(UNMQR_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
 }
 
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
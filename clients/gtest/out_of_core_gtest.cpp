@@ -0,0 +1,246 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {m, n, nb}, where nb is the number of columns of the panels that
+// fit in the device memory given to the factorization
+const vector<vector<int>> ooc_size_range
+    = {{1, 1, 1}, {20, 20, 4}, {64, 64, 8}, {100, 70, 16}, {70, 100, 16}, {200, 200, 32}};
+
+class OUT_OF_CORE : public ::TestWithParam<vector<int>>
+{
+protected:
+    OUT_OF_CORE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// device memory for three panels of nb columns of m rows, and for the in-core factorization of
+// one of them
+static size_t ooc_budget(int m, int nb, int lwork)
+{
+    return sizeof(double) * (3 * size_t(m) * nb + max(lwork, 0)) + 2048;
+}
+
+// generates a well conditioned symmetric positive definite matrix
+static void ooc_init_spd(host_strided_batch_vector<double>& hA, int n)
+{
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * n] = hA[0][i + j * n];
+        hA[0][i + i * n] += 400;
+    }
+}
+
+TEST(OUT_OF_CORE_BAD_ARG, potrf)
+{
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_LOWER;
+    vector<double>         hA(100, 1);
+    int                    info;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfOutOfCore(nullptr, uplo, 10, hA.data(), 10, 1 << 20, &info),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfOutOfCore(
+                              handle, hipsolverFillMode_t(-1), 10, hA.data(), 10, 1 << 20, &info),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfOutOfCore(handle, uplo, -1, hA.data(), 10, 1 << 20, &info),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfOutOfCore(handle, uplo, 10, hA.data(), 9, 1 << 20, &info),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfOutOfCore(handle, uplo, 10, nullptr, 10, 1 << 20, &info),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfOutOfCore(handle, uplo, 10, hA.data(), 10, 1 << 20, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the budget cannot hold a single column
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfOutOfCore(handle, uplo, 10, hA.data(), 10, 64, &info),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // quick return
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfOutOfCore(handle, uplo, 0, nullptr, 1, 0, &info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info, 0);
+}
+
+TEST(OUT_OF_CORE_BAD_ARG, getrf)
+{
+    hipsolver_local_handle handle;
+    vector<double>         hA(100, 1);
+    vector<int>            ipiv(10);
+    int                    info;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(nullptr, 10, 10, hA.data(), 10, ipiv.data(), 1 << 20, &info),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(handle, -1, 10, hA.data(), 10, ipiv.data(), 1 << 20, &info),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(handle, 10, -1, hA.data(), 10, ipiv.data(), 1 << 20, &info),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(handle, 10, 10, hA.data(), 9, ipiv.data(), 1 << 20, &info),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(handle, 10, 10, nullptr, 10, ipiv.data(), 1 << 20, &info),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(handle, 10, 10, hA.data(), 10, nullptr, 1 << 20, &info),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(handle, 10, 10, hA.data(), 10, ipiv.data(), 1 << 20, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the budget cannot hold a single column
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(handle, 10, 10, hA.data(), 10, ipiv.data(), 64, &info),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // quick return
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrfOutOfCore(handle, 10, 0, nullptr, 10, nullptr, 0, &info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info, 0);
+}
+
+// the out-of-core factorization must match the factorization computed in core
+TEST_P(OUT_OF_CORE, potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[1], nb = size[2];
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        hipsolver_local_handle              handle;
+        host_strided_batch_vector<double>   hA(n * n, 1, n * n, 1);
+        host_strided_batch_vector<double>   hARes(n * n, 1, n * n, 1);
+        host_strided_batch_vector<double>   hAOoc(n * n, 1, n * n, 1);
+        host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+        device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+        device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+        int                                 lw, info;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        ooc_init_spd(hA, n);
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, dA.data(), n, &lw),
+                              HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        if(lw)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrf(handle, uplo, n, dA.data(), n, dWork.data(), lw, dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hARes.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+        EXPECT_EQ(hinfo[0][0], 0);
+
+        // the panel factorizations cannot need more workspace than the whole matrix
+        for(int i = 0; i < n * n; i++)
+            hAOoc[0][i] = hA[0][i];
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfOutOfCore(handle, uplo, n, hAOoc[0], n, ooc_budget(n, nb, lw), &info),
+            HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(info, 0);
+
+        // the other triangle is left untouched
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                if(uplo == HIPSOLVER_FILL_MODE_LOWER ? i < j : i > j)
+                {
+                    EXPECT_EQ(hAOoc[0][i + j * n], hA[0][i + j * n]);
+                    hARes[0][i + j * n] = hAOoc[0][i + j * n] = 0;
+                }
+            }
+        }
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hARes[0], hAOoc[0]), n);
+    }
+}
+
+// a matrix that is not positive definite stops the factorization at the failed panel
+TEST_P(OUT_OF_CORE, potrf_not_spd)
+{
+    vector<int> size = GetParam();
+    int         n = size[1], nb = size[2], k = n / 2;
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        hipsolver_local_handle handle;
+        vector<double>         hA(size_t(n) * n, 0);
+        int                    lw, info;
+        for(int i = 0; i < n; i++)
+            hA[i + i * n] = i == k ? -1 : 1;
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, nullptr, n, &lw),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfOutOfCore(handle, uplo, n, hA.data(), n, ooc_budget(n, nb, lw), &info),
+            HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(info, k + 1);
+    }
+}
+
+// the factors and pivots of the out-of-core factorization must reproduce the matrix
+TEST_P(OUT_OF_CORE, getrf)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1], nb = size[2], mn = min(m, n);
+
+    hipsolver_local_handle            handle;
+    host_strided_batch_vector<double> hA(m * n, 1, m * n, 1);
+    vector<double>                    hLU(size_t(m) * n);
+    vector<int>                       ipiv(mn);
+    int                               lw, info;
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < m * n; i++)
+        hLU[i] = hA[0][i];
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, m, nb, nullptr, m, &lw),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfOutOfCore(
+            handle, m, n, hLU.data(), m, ipiv.data(), ooc_budget(m, nb, lw), &info),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info, 0);
+
+    // apply the interchanges to A, and multiply the factors
+    host_strided_batch_vector<double> hPA(m * n, 1, m * n, 1);
+    host_strided_batch_vector<double> hLxU(m * n, 1, m * n, 1);
+    for(int i = 0; i < m * n; i++)
+        hPA[0][i] = hA[0][i];
+    for(int i = 0; i < mn; i++)
+    {
+        EXPECT_GE(ipiv[i], i + 1);
+        EXPECT_LE(ipiv[i], m);
+        for(int j = 0; j < n; j++)
+            swap(hPA[0][i + j * m], hPA[0][ipiv[i] - 1 + j * m]);
+    }
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i < m; i++)
+        {
+            double sum = 0;
+            for(int l = 0; l <= min(i, min(j, mn - 1)); l++)
+                sum += (l == i ? 1 : hLU[i + l * m]) * hLU[l + j * m];
+            hLxU[0][i + j * m] = sum;
+        }
+    }
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', m, n, m, hPA[0], hLxU[0]), max(m, n));
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, OUT_OF_CORE, ValuesIn(ooc_size_range));
@@ -0,0 +1,269 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {m, n, lda}
+const vector<vector<int>> plan_size_range = {{1, 1, 1}, {20, 20, 20}, {40, 30, 50}};
+
+class PLAN : public ::TestWithParam<vector<int>>
+{
+protected:
+    PLAN() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates a well conditioned symmetric positive definite matrix
+static void plan_init_spd(host_strided_batch_vector<double>& hA, int n, int lda)
+{
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+    {
+        for(int j = 0; j < i; j++)
+            hA[0][j + i * lda] = hA[0][i + j * lda];
+        hA[0][i + i * lda] += 400;
+    }
+}
+
+TEST(PLAN_BAD_ARG, create)
+{
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    hipsolverPlan_t        plan;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_createPlan(nullptr, uplo, 1, 1, &plan),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_createPlan(nullptr, 1, 1, 1, &plan),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd_createPlan(nullptr,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_UPPER,
+                                                     1,
+                                                     1,
+                                                     &plan),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_createPlan(handle, uplo, 1, 1, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_createPlan(handle, uplo, -1, 1, &plan),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_createPlan(handle, 10, 10, 5, &plan),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd_createPlan(handle,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_UPPER,
+                                                     10,
+                                                     5,
+                                                     &plan),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_createPlan(handle, hipsolverFillMode_t(-1), 1, 1, &plan),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+}
+
+// a plan can only be executed by the routine and precision it was created for
+TEST(PLAN_BAD_ARG, exec)
+{
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    hipsolverPlan_t        plan;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_execPlan(nullptr, nullptr, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_createPlan(handle, uplo, 1, 1, &plan),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpotrf_execPlan(plan, nullptr, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_execPlan(plan, nullptr, nullptr, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyPlan(plan), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyPlan(nullptr), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// executing a plan, repeatedly, must give the results of the regular function
+TEST_P(PLAN, potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[1], lda = size[2];
+
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    hipsolverPlan_t        plan;
+    int                    lwork;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, nullptr, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_createPlan(handle, uplo, n, lda, &plan),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hAPlan(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(lwork, 1, lwork, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    if(lwork)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    plan_init_spd(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf(handle, uplo, n, dA.data(), lda, dWork.data(), lwork, dinfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    for(int run = 0; run < 2; run++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_execPlan(plan, dA.data(), dinfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hAPlan.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+        EXPECT_EQ(hinfo[0][0], 0);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[0], hAPlan[0]), n);
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyPlan(plan), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_P(PLAN, getrf)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1], lda = size[2];
+    int         k = min(m, n);
+
+    hipsolver_local_handle handle;
+    hipsolverPlan_t        plan;
+    int                    lwork;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, m, n, nullptr, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_createPlan(handle, m, n, lda, &plan),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hAPlan(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<int>      hIpiv(k, 1, k, 1);
+    host_strided_batch_vector<int>      hIpivPlan(k, 1, k, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dWork(lwork, 1, lwork, 1);
+    device_strided_batch_vector<int>    dIpiv(k, 1, k, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    if(lwork)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocblas_init<double>(hA, true);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf(handle,
+                                          m,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          dWork.data(),
+                                          lwork,
+                                          dIpiv.data(),
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+
+    for(int run = 0; run < 2; run++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_execPlan(plan, dA.data(), dIpiv.data(), dinfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hAPlan.transfer_from(dA));
+        CHECK_HIP_ERROR(hIpivPlan.transfer_from(dIpiv));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+        EXPECT_EQ(hinfo[0][0], 0);
+        for(int i = 0; i < k; i++)
+            EXPECT_EQ(hIpivPlan[0][i], hIpiv[0][i]);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', m, n, lda, hARes[0], hAPlan[0]), k);
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyPlan(plan), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_P(PLAN, syevd)
+{
+    vector<int> size = GetParam();
+    int         n = size[1], lda = size[2];
+
+    hipsolver_local_handle handle;
+    hipsolverEigMode_t     jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_LOWER;
+    hipsolverPlan_t        plan;
+    int                    lwork;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, nullptr, lda, nullptr, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd_createPlan(handle, jobz, uplo, n, lda, &plan),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hD(n, 1, n, 1);
+    host_strided_batch_vector<double>   hDPlan(n, 1, n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dD(n, 1, n, 1);
+    device_strided_batch_vector<double> dWork(lwork, 1, lwork, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    if(lwork)
+        CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    plan_init_spd(hA, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          dD.data(),
+                                          dWork.data(),
+                                          lwork,
+                                          dinfo.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hD.transfer_from(dD));
+
+    for(int run = 0; run < 2; run++)
+    {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevd_execPlan(plan, dA.data(), dD.data(), dinfo.data()),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hDPlan.transfer_from(dD));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+        EXPECT_EQ(hinfo[0][0], 0);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', 1, n, 1, hD[0], hDPlan[0]), n);
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyPlan(plan), HIPSOLVER_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, PLAN, ValuesIn(plan_size_range));
@@ -0,0 +1,312 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> posqrt_tuple;
+
+// each size_range vector is a {m, n, batch_count}
+const vector<vector<int>> geqdwh_size_range = {{1, 1, 1}, {20, 20, 1}, {45, 30, 1}, {30, 12, 3}};
+
+// each size_range vector is a {n, uplo, batch_count}, where uplo is 0 for upper and 1 for lower
+const vector<vector<int>> posqrt_size_range
+    = {{1, 0, 1}, {20, 0, 1}, {20, 1, 1}, {35, 1, 3}, {12, 0, 4}};
+
+const vector<char> posqrt_job_range = {'S', 'I'};
+
+class GEQDWH : public ::TestWithParam<vector<int>>
+{
+protected:
+    GEQDWH() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class POSQRT : public ::TestWithParam<posqrt_tuple>
+{
+protected:
+    POSQRT() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// C = op(A) * B, for the m-by-k op(A), with op the transpose if trans is true
+static void polar_gemm(bool          trans,
+                       int           m,
+                       int           n,
+                       int           k,
+                       const double* A,
+                       int           lda,
+                       const double* B,
+                       int           ldb,
+                       double*       C,
+                       int           ldc)
+{
+    for(int i = 0; i < m; i++)
+        for(int j = 0; j < n; j++)
+        {
+            double sum = 0;
+            for(int q = 0; q < k; q++)
+                sum += (trans ? A[q + i * lda] : A[i + q * lda]) * B[q + j * ldb];
+            C[i + j * ldc] = sum;
+        }
+}
+
+TEST(POLAR_BAD_ARG, geqdwh)
+{
+    hipsolver_local_handle              handle;
+    int                                 m = 6, n = 5, lw;
+    device_strided_batch_vector<double> dA(m * n, 1, m * n, 1);
+    device_strided_batch_vector<double> dH(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dH.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqdwh_bufferSize(nullptr, m, n, m, n, &lw),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqdwh_bufferSize(handle, n - 1, n, m, n, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqdwh_bufferSize(handle, m, n, m - 1, n, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqdwh_bufferSize(handle, m, n, m, n - 1, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqdwh_bufferSize(handle, m, n, m, n, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqdwhStridedBatched_bufferSize(
+                              handle, m, n, m, m * n - 1, n, n * n, &lw, 2),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgeqdwh_bufferSize(handle, m, n, m, n, &lw));
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgeqdwh(
+            handle, m, n, dA.data(), m, dH.data(), n, dWork.data(), lw - 1, dinfo.data()),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgeqdwh(handle, m, n, nullptr, m, dH.data(), n, dWork.data(), lw, dinfo.data()),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgeqdwh(handle, m, n, dA.data(), m, dH.data(), n, dWork.data(), lw, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST(POLAR_BAD_ARG, posqrt)
+{
+    hipsolver_local_handle              handle;
+    hipsolverFillMode_t                 uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                                 n    = 5, lw;
+    device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDposqrt_bufferSize(nullptr, 'S', uplo, n, n, &lw),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDposqrt_bufferSize(handle, 'N', uplo, n, n, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDposqrt_bufferSize(handle, 'S', hipsolverFillMode_t(-1), n, n, &lw),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverDposqrt_bufferSize(handle, 'S', uplo, n, n - 1, &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDposqrtStridedBatched_bufferSize(handle, 'S', uplo, n, n, n * n, &lw, -1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    CHECK_ROCBLAS_ERROR(hipsolverDposqrt_bufferSize(handle, 'I', uplo, n, n, &lw));
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDposqrt(handle, 'I', uplo, n, dA.data(), n, dWork.data(), lw - 1, dinfo.data()),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDposqrt(handle, 'I', uplo, n, dA.data(), n, dWork.data(), lw, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+// the factors of A, with leading dimension m + 1, must satisfy U^T * U = I, U * H = A and
+// H = H^T, with H of leading dimension n + 2; a batch of one is computed by geqdwh, and larger
+// batches by geqdwhStridedBatched
+TEST_P(GEQDWH, geqdwh)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1], bc = size[2];
+    int         lda = m + 1, ldh = n + 2, sA = lda * n, sH = ldh * n, lw;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hA(sA, 1, sA, bc);
+    host_strided_batch_vector<double>   hU(sA, 1, sA, bc);
+    host_strided_batch_vector<double>   hH(sH, 1, sH, bc);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, bc);
+    device_strided_batch_vector<double> dA(sA, 1, sA, bc);
+    device_strided_batch_vector<double> dH(sH, 1, sH, bc);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dH.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocblas_init<double>(hA, true);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(bc == 1)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverDgeqdwh_bufferSize(handle, m, n, lda, ldh, &lw));
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+        CHECK_ROCBLAS_ERROR(hipsolverDgeqdwh(
+            handle, m, n, dA.data(), lda, dH.data(), ldh, dWork.data(), lw, dinfo.data()));
+    }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverDgeqdwhStridedBatched_bufferSize(
+            handle, m, n, lda, sA, ldh, sH, &lw, bc));
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+        CHECK_ROCBLAS_ERROR(hipsolverDgeqdwhStridedBatched(handle,
+                                                           m,
+                                                           n,
+                                                           dA.data(),
+                                                           lda,
+                                                           sA,
+                                                           dH.data(),
+                                                           ldh,
+                                                           sH,
+                                                           dWork.data(),
+                                                           lw,
+                                                           dinfo.data(),
+                                                           bc));
+    }
+    CHECK_HIP_ERROR(hU.transfer_from(dA));
+    CHECK_HIP_ERROR(hH.transfer_from(dH));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    vector<double> hI(n * n), hUU(n * n), hUH(m * n), hA0(m * n), hHT(n * n), hHn(n * n);
+    for(int i = 0; i < n; i++)
+        hI[i + i * n] = 1;
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(hinfo[b][0], 0);
+
+        polar_gemm(true, n, n, m, hU[b], lda, hU[b], lda, hUU.data(), n);
+        polar_gemm(false, m, n, n, hU[b], lda, hH[b], ldh, hUH.data(), m);
+        for(int i = 0; i < m; i++)
+            for(int j = 0; j < n; j++)
+                hA0[i + j * m] = hA[b][i + j * lda];
+        for(int i = 0; i < n; i++)
+            for(int j = 0; j < n; j++)
+            {
+                hHn[i + j * n] = hH[b][i + j * ldh];
+                hHT[i + j * n] = hH[b][j + i * ldh];
+            }
+
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hI.data(), hUU.data()), m);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', m, n, m, hA0.data(), hUH.data()), m);
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hHn.data(), hHT.data()), n);
+    }
+}
+
+// A = G * G^T + n * I is positive definite, with leading dimension n + 1, and is given by its
+// triangle uplo only; the square root S must satisfy S * S = A, and the inverse square root
+// S * A * S = I. The last matrix of a batch of more than one is not positive definite, which
+// must be reported in its info and leave it unchanged.
+TEST_P(POSQRT, posqrt)
+{
+    vector<int>         size = std::get<0>(GetParam());
+    signed char         job  = std::get<1>(GetParam());
+    int                 n = size[0], bc = size[2];
+    hipsolverFillMode_t uplo = size[1] ? HIPSOLVER_FILL_MODE_LOWER : HIPSOLVER_FILL_MODE_UPPER;
+    int                 lda = n + 1, sA = lda * n, lw;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hG(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hA(sA, 1, sA, bc);
+    host_strided_batch_vector<double>   hARes(sA, 1, sA, bc);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, bc);
+    device_strided_batch_vector<double> dA(sA, 1, sA, bc);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocblas_init<double>(hG, true);
+    vector<double> hA0(n * n);
+    polar_gemm(false, n, n, n, hG[0], n, hG[0], n, hA0.data(), n);
+    for(int i = 0; i < n * n; i++)
+        hA0[i] = hA0[i] / n;
+    for(int i = 0; i < n; i++)
+        for(int j = 0; j < n; j++)
+            hA0[i + j * n] = 0.5 * (hA0[i + j * n] + hA0[j + i * n]) + (i == j ? n : 0);
+
+    // the other triangle is not referenced
+    for(int b = 0; b < bc; b++)
+        for(int i = 0; i < lda; i++)
+            for(int j = 0; j < n; j++)
+            {
+                bool in_uplo       = (uplo == HIPSOLVER_FILL_MODE_UPPER) ? i <= j : i >= j;
+                hA[b][i + j * lda] = (i < n && in_uplo) ? hA0[i + j * n] : -99;
+            }
+    if(bc > 1)
+        hA[bc - 1][0] = -1;
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(bc == 1)
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverDposqrt_bufferSize(handle, job, uplo, n, lda, &lw));
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+        CHECK_ROCBLAS_ERROR(hipsolverDposqrt(
+            handle, job, uplo, n, dA.data(), lda, dWork.data(), lw, dinfo.data()));
+    }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(
+            hipsolverDposqrtStridedBatched_bufferSize(handle, job, uplo, n, lda, sA, &lw, bc));
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+        CHECK_ROCBLAS_ERROR(hipsolverDposqrtStridedBatched(
+            handle, job, uplo, n, dA.data(), lda, sA, dWork.data(), lw, dinfo.data(), bc));
+    }
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+    vector<double> hI(n * n), hS(n * n), hP(n * n), hQ(n * n);
+    for(int i = 0; i < n; i++)
+        hI[i + i * n] = 1;
+    for(int b = 0; b < bc; b++)
+    {
+        if(bc > 1 && b == bc - 1)
+        {
+            EXPECT_EQ(hinfo[b][0], 1);
+            for(int i = 0; i < sA; i++)
+                EXPECT_EQ(hARes[b][i], hA[b][i]);
+            continue;
+        }
+        EXPECT_EQ(hinfo[b][0], 0);
+
+        for(int i = 0; i < n; i++)
+            for(int j = 0; j < n; j++)
+                hS[i + j * n] = hARes[b][i + j * lda];
+        polar_gemm(false, n, n, n, hS.data(), n, hS.data(), n, hP.data(), n);
+        if(job == 'S')
+            ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hA0.data(), hP.data()), n);
+        else
+        {
+            polar_gemm(false, n, n, n, hP.data(), n, hA0.data(), n, hQ.data(), n);
+            ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hI.data(), hQ.data()), n);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GEQDWH, ValuesIn(geqdwh_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POSQRT,
+                         Combine(ValuesIn(posqrt_size_range), ValuesIn(posqrt_job_range)));
@@ -71,14 +71,15 @@ protected:
     virtual void TearDown() {}
 
     template <bool BATCHED, bool STRIDED, typename T>
-    void run_tests()
+    void run_tests(bool device_verify = false)
     {
         Arguments arg = potrf_setup_arguments(GetParam());
 
         if(arg.peek<char>("uplo") == 'L' && arg.peek<int>("n") == -1)
             testing_potrf_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        arg.batch_count   = (BATCHED || STRIDED ? 3 : 1);
+        arg.device_verify = device_verify;
         testing_potrf<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
@@ -173,6 +174,47 @@ TEST_P(POTRF_FORTRAN, batched__double_complex)
     run_tests<true, false, rocblas_double_complex>();
 }
 
+// device verification tests
+TEST_P(POTRF, device_verify__float)
+{
+    run_tests<false, false, float>(true);
+}
+
+TEST_P(POTRF, device_verify__double)
+{
+    run_tests<false, false, double>(true);
+}
+
+TEST_P(POTRF, device_verify__float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>(true);
+}
+
+TEST_P(POTRF, device_verify__double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>(true);
+}
+
+TEST_P(POTRF, strided_batched_device_verify__float)
+{
+    run_tests<false, true, float>(true);
+}
+
+TEST_P(POTRF, strided_batched_device_verify__double)
+{
+    run_tests<false, true, double>(true);
+}
+
+TEST_P(POTRF, strided_batched_device_verify__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>(true);
+}
+
+TEST_P(POTRF, strided_batched_device_verify__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>(true);
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          POTRF,
 //                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
@@ -0,0 +1,392 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, k}, where k is the number of columns of V
+const vector<vector<int>> update_size_range = {{1, 1}, {20, 3}, {64, 1}, {100, 8}, {200, 40}};
+
+const int update_batch_count = 3;
+
+class POTRF_UPDATE : public ::TestWithParam<vector<int>>
+{
+protected:
+    POTRF_UPDATE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates well conditioned symmetric positive definite matrices
+static void update_init_spd(host_strided_batch_vector<double>& hA, int n, int bc)
+{
+    rocblas_init<double>(hA, true);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < i; j++)
+                hA[b][j + i * n] = hA[b][i + j * n];
+            hA[b][i + i * n] += 400;
+        }
+    }
+}
+
+// returns A + V * V^T
+static vector<double> update_add(const double* A, const double* V, int n, int k)
+{
+    vector<double> B(A, A + size_t(n) * n);
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            for(int l = 0; l < k; l++)
+                B[i + j * n] += V[i + l * n] * V[j + l * n];
+    return B;
+}
+
+// the factor of A computed by potrf; the other triangle keeps the values of A
+static vector<double>
+    update_factor(hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, const double* A)
+{
+    host_strided_batch_vector<double>   hA(n * n, 1, n * n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    int                                 lw;
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    for(int i = 0; i < n * n; i++)
+        hA[0][i] = A[i];
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrf_bufferSize(handle, uplo, n, dA.data(), n, &lw),
+                          HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    if(lw)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf(handle, uplo, n, dA.data(), n, dWork.data(), lw, dinfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hA.transfer_from(dA));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    EXPECT_EQ(hinfo[0][0], 0);
+
+    return vector<double>(hA[0], hA[0] + size_t(n) * n);
+}
+
+// the triangle uplo of Res must match the factor L, and the other triangle must be untouched
+static void update_check(
+    hipsolverFillMode_t uplo, int n, int k, const double* A, const double* L, const double* Res)
+{
+    vector<double> hL(L, L + size_t(n) * n), hRes(Res, Res + size_t(n) * n);
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            if(uplo == HIPSOLVER_FILL_MODE_LOWER ? i < j : i > j)
+            {
+                EXPECT_EQ(hRes[i + j * n], A[i + j * n]);
+                hL[i + j * n] = hRes[i + j * n] = 0;
+            }
+        }
+    }
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hL.data(), hRes.data()), 10 * max(n, k));
+}
+
+TEST(POTRF_UPDATE_BAD_ARG, potrfUpdate)
+{
+    hipsolver_local_handle              handle;
+    hipsolverFillMode_t                 uplo = HIPSOLVER_FILL_MODE_LOWER;
+    device_strided_batch_vector<double> dA(100, 1, 100, 1);
+    device_strided_batch_vector<double> dV(100, 1, 100, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    int                                 lw;
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfUpdate_bufferSize(nullptr, uplo, 10, 10, dA.data(), 10, dV.data(), 10, &lw),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfUpdate_bufferSize(handle,
+                                                           hipsolverFillMode_t(-1),
+                                                           10,
+                                                           10,
+                                                           dA.data(),
+                                                           10,
+                                                           dV.data(),
+                                                           10,
+                                                           &lw),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfUpdate_bufferSize(handle, uplo, 10, 10, dA.data(), 10, dV.data(), 9, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfUpdate_bufferSize(
+                              handle, uplo, 10, 10, dA.data(), 10, dV.data(), 10, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfUpdate_bufferSize(handle, uplo, 10, 10, dA.data(), 10, dV.data(), 10, &lw),
+        HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfUpdate(nullptr,
+                                                uplo,
+                                                10,
+                                                10,
+                                                dA.data(),
+                                                10,
+                                                dV.data(),
+                                                10,
+                                                dWork.data(),
+                                                lw,
+                                                dinfo.data()),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfUpdate(handle,
+                                                uplo,
+                                                -1,
+                                                10,
+                                                dA.data(),
+                                                10,
+                                                dV.data(),
+                                                10,
+                                                dWork.data(),
+                                                lw,
+                                                dinfo.data()),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfDowndate(handle,
+                                                  uplo,
+                                                  10,
+                                                  10,
+                                                  dA.data(),
+                                                  9,
+                                                  dV.data(),
+                                                  10,
+                                                  dWork.data(),
+                                                  lw,
+                                                  dinfo.data()),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfUpdate(
+            handle, uplo, 10, 10, dA.data(), 10, nullptr, 10, dWork.data(), lw, dinfo.data()),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfUpdate(
+            handle, uplo, 10, 10, dA.data(), 10, dV.data(), 10, dWork.data(), lw, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the workspace is too small
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfUpdate(
+            handle, uplo, 10, 10, dA.data(), 10, dV.data(), 10, dWork.data(), lw - 1, dinfo.data()),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // quick return
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfUpdate(
+            handle, uplo, 10, 0, dA.data(), 10, nullptr, 10, nullptr, 0, dinfo.data()),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    EXPECT_EQ(hinfo[0][0], 0);
+}
+
+// the update must match the factorization of A + V * V^T, and the downdate must recover the
+// factor of A
+TEST_P(POTRF_UPDATE, potrfUpdate)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], k = size[1];
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        hipsolver_local_handle              handle;
+        host_strided_batch_vector<double>   hA(n * n, 1, n * n, 1);
+        host_strided_batch_vector<double>   hV(n * k, 1, n * k, 1);
+        host_strided_batch_vector<double>   hRes(n * n, 1, n * n, 1);
+        host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+        device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+        device_strided_batch_vector<double> dV(n * k, 1, n * k, 1);
+        device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+        int                                 lw;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        update_init_spd(hA, n, 1);
+        rocblas_init<double>(hV, false);
+
+        vector<double> hB  = update_add(hA[0], hV[0], n, k);
+        vector<double> hL  = update_factor(handle, uplo, n, hA[0]);
+        vector<double> hLB = update_factor(handle, uplo, n, hB.data());
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfUpdate_bufferSize(handle, uplo, n, k, dA.data(), n, dV.data(), n, &lw),
+            HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        // update the factor of A
+        for(int i = 0; i < n * n; i++)
+            hRes[0][i] = hL[i];
+        CHECK_HIP_ERROR(dA.transfer_from(hRes));
+        CHECK_HIP_ERROR(dV.transfer_from(hV));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfUpdate(
+                handle, uplo, n, k, dA.data(), n, dV.data(), n, dWork.data(), lw, dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+        EXPECT_EQ(hinfo[0][0], 0);
+        update_check(uplo, n, k, hA[0], hLB.data(), hRes[0]);
+
+        // downdate it back, with a new copy of V
+        CHECK_HIP_ERROR(dV.transfer_from(hV));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfDowndate(
+                handle, uplo, n, k, dA.data(), n, dV.data(), n, dWork.data(), lw, dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+        EXPECT_EQ(hinfo[0][0], 0);
+        update_check(uplo, n, k, hA[0], hL.data(), hRes[0]);
+    }
+}
+
+// a downdate that leaves a matrix that is not positive definite reports its first failed minor
+TEST_P(POTRF_UPDATE, potrfDowndate_not_spd)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], k = size[1], j = n / 2;
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        hipsolver_local_handle              handle;
+        host_strided_batch_vector<double>   hA(n * n, 1, n * n, 1);
+        host_strided_batch_vector<double>   hV(n * k, 1, n * k, 1);
+        host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+        device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+        device_strided_batch_vector<double> dV(n * k, 1, n * k, 1);
+        device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+        int                                 lw;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // I - 4 * e_j * e_j^T has a negative diagonal entry in row j
+        for(int i = 0; i < n * n; i++)
+            hA[0][i] = i % (n + 1) == 0 ? 1 : 0;
+        for(int i = 0; i < n * k; i++)
+            hV[0][i] = i == j ? 2 : 0;
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfUpdate_bufferSize(handle, uplo, n, k, dA.data(), n, dV.data(), n, &lw),
+            HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dV.transfer_from(hV));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfDowndate(
+                handle, uplo, n, k, dA.data(), n, dV.data(), n, dWork.data(), lw, dinfo.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+        EXPECT_EQ(hinfo[0][0], j + 1);
+    }
+}
+
+// every matrix of the batch must be updated and downdated as in the single matrix case
+TEST_P(POTRF_UPDATE, potrfUpdateBatched)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], k = size[1], bc = update_batch_count;
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        hipsolver_local_handle            handle;
+        host_strided_batch_vector<double> hA(n * n, 1, n * n, bc);
+        host_strided_batch_vector<double> hV(n * k, 1, n * k, bc);
+        host_batch_vector<double>         hRes(n * n, 1, bc);
+        host_batch_vector<double>         hVb(n * k, 1, bc);
+        host_strided_batch_vector<int>    hinfo(bc, 1, bc, 1);
+        device_batch_vector<double>       dA(n * n, 1, bc);
+        device_batch_vector<double>       dV(n * k, 1, bc);
+        device_strided_batch_vector<int>  dinfo(bc, 1, bc, 1);
+        int                               lw;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        update_init_spd(hA, n, bc);
+        rocblas_init<double>(hV, false);
+
+        vector<vector<double>> hL(bc), hLB(bc);
+        for(int b = 0; b < bc; b++)
+        {
+            vector<double> hB = update_add(hA[b], hV[b], n, k);
+            hL[b]             = update_factor(handle, uplo, n, hA[b]);
+            hLB[b]            = update_factor(handle, uplo, n, hB.data());
+            for(int i = 0; i < n * n; i++)
+                hRes[b][i] = hL[b][i];
+            for(int i = 0; i < n * k; i++)
+                hVb[b][i] = hV[b][i];
+        }
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrfUpdateBatched_bufferSize(
+                                  handle, uplo, n, k, dA.data(), n, dV.data(), n, &lw, bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+        CHECK_HIP_ERROR(dA.transfer_from(hRes));
+        CHECK_HIP_ERROR(dV.transfer_from(hVb));
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrfUpdateBatched(handle,
+                                                           uplo,
+                                                           n,
+                                                           k,
+                                                           dA.data(),
+                                                           n,
+                                                           dV.data(),
+                                                           n,
+                                                           dWork.data(),
+                                                           lw,
+                                                           dinfo.data(),
+                                                           bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+        for(int b = 0; b < bc; b++)
+        {
+            EXPECT_EQ(hinfo[0][b], 0);
+            update_check(uplo, n, k, hA[b], hLB[b].data(), hRes[b]);
+        }
+
+        CHECK_HIP_ERROR(dV.transfer_from(hVb));
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrfDowndateBatched(handle,
+                                                             uplo,
+                                                             n,
+                                                             k,
+                                                             dA.data(),
+                                                             n,
+                                                             dV.data(),
+                                                             n,
+                                                             dWork.data(),
+                                                             lw,
+                                                             dinfo.data(),
+                                                             bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+        for(int b = 0; b < bc; b++)
+        {
+            EXPECT_EQ(hinfo[0][b], 0);
+            update_check(uplo, n, k, hA[b], hL[b].data(), hRes[b]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, POTRF_UPDATE, ValuesIn(update_size_range));
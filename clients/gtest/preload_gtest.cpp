@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<int, hipDataType> preload_tuple;
+
+// orders of the warm-up problems
+const vector<int> preload_size_range = {0, 1, 64, 300};
+
+const vector<hipDataType> preload_type_range = {HIP_R_32F, HIP_R_64F, HIP_C_32F, HIP_C_64F};
+
+class PRELOAD : public ::TestWithParam<preload_tuple>
+{
+protected:
+    PRELOAD() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST(PRELOAD_API, bad_arg)
+{
+    hipsolver_local_handle handle;
+    hipsolverDnFunction_t  functions[] = {HIPSOLVERDN_POTRF, hipsolverDnFunction_t(-1)};
+
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(nullptr, functions, 1, HIP_R_64F, 1),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(handle, nullptr, 1, HIP_R_64F, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(handle, functions, -1, HIP_R_64F, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(handle, functions, 1, HIP_R_64F, -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(handle, functions, 2, HIP_R_64F, 1),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(handle, functions, 1, HIP_R_16F, 1),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+
+    // nothing to preload
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(handle, nullptr, 0, HIP_R_64F, 1),
+                          HIPSOLVER_STATUS_SUCCESS);
+}
+
+// the warm-up calls are finished when preloading returns
+TEST_P(PRELOAD, preload)
+{
+    int         n    = std::get<0>(GetParam());
+    hipDataType type = std::get<1>(GetParam());
+
+    hipsolver_local_handle handle;
+    hipsolverDnFunction_t  functions[] = {HIPSOLVERDN_GETRF, HIPSOLVERDN_POTRF, HIPSOLVERDN_SYEVD};
+
+    EXPECT_ROCBLAS_STATUS(hipsolverPreload(handle, functions, 3, type, n),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    EXPECT_EQ(hipStreamQuery(stream), hipSuccess);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PRELOAD,
+                         Combine(ValuesIn(preload_size_range), ValuesIn(preload_type_range)));
@@ -0,0 +1,307 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {m, n}, where Q is m-by-n
+const vector<vector<int>> qr_update_size_range
+    = {{1, 1}, {2, 1}, {20, 5}, {64, 32}, {100, 99}, {150, 40}};
+
+enum qr_update_op
+{
+    qr_insert_column,
+    qr_delete_column,
+    qr_insert_row,
+    qr_delete_row
+};
+
+class QR_UPDATE : public ::TestWithParam<vector<int>>
+{
+protected:
+    QR_UPDATE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// computes the thin QR factorization of the m-by-n matrix A by modified Gram-Schmidt, with a
+// second pass of orthogonalization
+static void qr_update_factor(int m, int n, const double* A, vector<double>& Q, vector<double>& R)
+{
+    Q.assign(A, A + size_t(m) * n);
+    R.assign(size_t(n) * n, 0);
+    for(int j = 0; j < n; j++)
+    {
+        for(int pass = 0; pass < 2; pass++)
+        {
+            for(int k = 0; k < j; k++)
+            {
+                double d = 0;
+                for(int i = 0; i < m; i++)
+                    d += Q[i + k * m] * Q[i + j * m];
+                for(int i = 0; i < m; i++)
+                    Q[i + j * m] -= d * Q[i + k * m];
+                R[k + j * n] += d;
+            }
+        }
+        double d = 0;
+        for(int i = 0; i < m; i++)
+            d += Q[i + j * m] * Q[i + j * m];
+        d = sqrt(d);
+        for(int i = 0; i < m; i++)
+            Q[i + j * m] /= d;
+        R[j + j * n] = d;
+    }
+}
+
+// Q * R must match the m-by-n matrix A, and Q^T * Q must be the identity; only the upper
+// triangle of R is read
+static void qr_update_check(
+    int m, int n, const double* A, const double* Q, int ldq, const double* R, int ldr)
+{
+    if(m == 0 || n == 0)
+        return;
+
+    vector<double> hA(A, A + size_t(m) * n), hQR(size_t(m) * n, 0);
+    vector<double> hI(size_t(n) * n, 0), hQQ(size_t(n) * n, 0);
+    for(int j = 0; j < n; j++)
+    {
+        for(int k = 0; k <= j; k++)
+            for(int i = 0; i < m; i++)
+                hQR[i + j * m] += Q[i + k * ldq] * R[k + j * ldr];
+        for(int k = 0; k < n; k++)
+            for(int i = 0; i < m; i++)
+                hQQ[k + j * n] += Q[i + k * ldq] * Q[i + j * ldq];
+        hI[j + j * n] = 1;
+    }
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', m, n, m, hA.data(), hQR.data()), 10 * m);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hI.data(), hQQ.data()), 10 * m);
+}
+
+// updates the factorization of a random m-by-n matrix with the operation op at position pos, and
+// checks it against the updated matrix
+static void qr_update_test(int m, int n, qr_update_op op, int pos)
+{
+    // Q and R have room for a new row and column
+    int ldq = m + 1, ldr = n + 1;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hA(m * n, 1, m * n, 1);
+    host_strided_batch_vector<double>   hx(m + n, 1, m + n, 1);
+    host_strided_batch_vector<double>   hQ(ldq * (n + 1), 1, ldq * (n + 1), 1);
+    host_strided_batch_vector<double>   hR(ldr * (n + 1), 1, ldr * (n + 1), 1);
+    device_strided_batch_vector<double> dQ(ldq * (n + 1), 1, ldq * (n + 1), 1);
+    device_strided_batch_vector<double> dR(ldr * (n + 1), 1, ldr * (n + 1), 1);
+    device_strided_batch_vector<double> dx(m + n, 1, m + n, 1);
+    int                                 lw;
+    CHECK_HIP_ERROR(dQ.memcheck());
+    CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+    rocblas_init<double>(hA, true);
+    rocblas_init<double>(hx, false);
+
+    vector<double> Q, R;
+    qr_update_factor(m, n, hA[0], Q, R);
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i < m; i++)
+            hQ[0][i + j * ldq] = Q[i + j * m];
+        for(int i = 0; i < n; i++)
+            hR[0][i + j * ldr] = R[i + j * n];
+    }
+
+    // the updated matrix, of mu-by-nu
+    int            mu = m, nu = n;
+    vector<double> hB;
+    switch(op)
+    {
+    case qr_insert_column:
+        nu = n + 1;
+        for(int j = 0; j < nu; j++)
+            for(int i = 0; i < m; i++)
+                hB.push_back(j == pos - 1 ? hx[0][i] : hA[0][i + (j < pos - 1 ? j : j - 1) * m]);
+        break;
+    case qr_delete_column:
+        nu = n - 1;
+        for(int j = 0; j < nu; j++)
+            for(int i = 0; i < m; i++)
+                hB.push_back(hA[0][i + (j < pos - 1 ? j : j + 1) * m]);
+        break;
+    case qr_insert_row:
+        mu = m + 1;
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < mu; i++)
+                hB.push_back(i == pos - 1 ? hx[0][j] : hA[0][(i < pos - 1 ? i : i - 1) + j * m]);
+        break;
+    case qr_delete_row:
+        mu = m - 1;
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < mu; i++)
+                hB.push_back(hA[0][(i < pos - 1 ? i : i + 1) + j * m]);
+        break;
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrUpdate_bufferSize(handle, m, n, dQ.data(), ldq, dR.data(), ldr, &lw),
+        HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    CHECK_HIP_ERROR(dQ.transfer_from(hQ));
+    CHECK_HIP_ERROR(dR.transfer_from(hR));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    hipsolverStatus_t status = HIPSOLVER_STATUS_SUCCESS;
+    switch(op)
+    {
+    case qr_insert_column:
+        status = hipsolverDqrInsertColumn(
+            handle, m, n, pos, dQ.data(), ldq, dR.data(), ldr, dx.data(), dWork.data(), lw);
+        break;
+    case qr_delete_column:
+        status = hipsolverDqrDeleteColumn(
+            handle, m, n, pos, dQ.data(), ldq, dR.data(), ldr, dWork.data(), lw);
+        break;
+    case qr_insert_row:
+        status = hipsolverDqrInsertRow(
+            handle, m, n, pos, dQ.data(), ldq, dR.data(), ldr, dx.data(), dWork.data(), lw);
+        break;
+    case qr_delete_row:
+        status = hipsolverDqrDeleteRow(
+            handle, m, n, pos, dQ.data(), ldq, dR.data(), ldr, dWork.data(), lw);
+        break;
+    }
+    EXPECT_ROCBLAS_STATUS(status, HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hQ.transfer_from(dQ));
+    CHECK_HIP_ERROR(hR.transfer_from(dR));
+
+    qr_update_check(mu, nu, hB.data(), hQ[0], ldq, hR[0], ldr);
+}
+
+TEST(QR_UPDATE_BAD_ARG, qrUpdate)
+{
+    hipsolver_local_handle              handle;
+    device_strided_batch_vector<double> dQ(121, 1, 121, 1);
+    device_strided_batch_vector<double> dR(121, 1, 121, 1);
+    device_strided_batch_vector<double> dx(11, 1, 11, 1);
+    int                                 lw;
+    CHECK_HIP_ERROR(dQ.memcheck());
+    CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrUpdate_bufferSize(nullptr, 10, 5, dQ.data(), 11, dR.data(), 11, &lw),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrUpdate_bufferSize(handle, 5, 10, dQ.data(), 11, dR.data(), 11, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrUpdate_bufferSize(handle, 10, 5, dQ.data(), 9, dR.data(), 11, &lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrUpdate_bufferSize(handle, 10, 5, dQ.data(), 11, dR.data(), 11, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrUpdate_bufferSize(handle, 10, 5, dQ.data(), 11, dR.data(), 11, &lw),
+        HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertColumn(
+            nullptr, 10, 5, 1, dQ.data(), 11, dR.data(), 11, dx.data(), dWork.data(), lw),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertColumn(
+            handle, 10, 5, 0, dQ.data(), 11, dR.data(), 11, dx.data(), dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertColumn(
+            handle, 10, 5, 7, dQ.data(), 11, dR.data(), 11, dx.data(), dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertColumn(
+            handle, 10, 10, 1, dQ.data(), 11, dR.data(), 11, dx.data(), dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertColumn(
+            handle, 10, 5, 1, dQ.data(), 11, dR.data(), 5, dx.data(), dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertColumn(
+            handle, 10, 5, 1, dQ.data(), 11, dR.data(), 11, nullptr, dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrDeleteColumn(handle, 10, 5, 6, dQ.data(), 11, dR.data(), 11, dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertRow(
+            handle, 10, 5, 1, dQ.data(), 10, dR.data(), 11, dx.data(), dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrInsertRow(
+            handle, 10, 5, 12, dQ.data(), 11, dR.data(), 11, dx.data(), dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrDeleteRow(handle, 10, 5, 11, dQ.data(), 11, dR.data(), 11, dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrDeleteRow(handle, 5, 5, 1, dQ.data(), 11, dR.data(), 11, dWork.data(), lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the workspace is too small
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrDeleteColumn(
+            handle, 10, 5, 1, dQ.data(), 11, dR.data(), 11, dWork.data(), lw - 1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDqrDeleteColumn(handle, 10, 5, 1, dQ.data(), 11, dR.data(), 11, nullptr, lw),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+// the first, a middle and the last positions are tested for each operation
+TEST_P(QR_UPDATE, qrInsertColumn)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1];
+
+    // the new column must fit in Q
+    if(n < m)
+        for(int j : {1, n / 2 + 1, n + 1})
+            qr_update_test(m, n, qr_insert_column, j);
+}
+
+TEST_P(QR_UPDATE, qrDeleteColumn)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1];
+
+    for(int j : {1, (n + 1) / 2, n})
+        qr_update_test(m, n, qr_delete_column, j);
+}
+
+TEST_P(QR_UPDATE, qrInsertRow)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1];
+
+    for(int i : {1, m / 2 + 1, m + 1})
+        qr_update_test(m, n, qr_insert_row, i);
+}
+
+TEST_P(QR_UPDATE, qrDeleteRow)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1];
+
+    // the remaining rows must keep A of full column rank
+    if(n < m)
+        for(int i : {1, (m + 1) / 2, m})
+            qr_update_test(m, n, qr_delete_row, i);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, QR_UPDATE, ValuesIn(qr_update_size_range));
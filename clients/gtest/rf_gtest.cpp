@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+const vector<int> rf_size_range = {1, 10, 100};
+
+class RF : public ::TestWithParam<int>
+{
+protected:
+    RF() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// a CSR matrix with zero-based indices stored on the host
+struct rf_csr
+{
+    int            n = 0;
+    vector<int>    rowPtr;
+    vector<int>    colInd;
+    vector<double> val;
+
+    int nnz() const
+    {
+        return int(val.size());
+    }
+
+    // the values of the tridiagonal matrix with diagonal d and off-diagonals -1
+    void tridiagonal(int size, double d)
+    {
+        n = size;
+        rowPtr.assign(1, 0);
+        colInd.clear();
+        val.clear();
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = max(i - 1, 0); j <= min(i + 1, n - 1); j++)
+            {
+                colInd.push_back(j);
+                val.push_back(i == j ? d : -1);
+            }
+            rowPtr.push_back(nnz());
+        }
+    }
+};
+
+// the LU factors without pivoting of the tridiagonal matrix with diagonal d; L holds its unit
+// diagonal
+static void rf_factors(int n, double d, rf_csr& L, rf_csr& U)
+{
+    L.n = U.n = n;
+    L.rowPtr.assign(1, 0);
+    U.rowPtr.assign(1, 0);
+
+    double u = d;
+    for(int i = 0; i < n; i++)
+    {
+        if(i > 0)
+        {
+            double l = -1 / u;
+            u        = d + l;
+            L.colInd.push_back(i - 1);
+            L.val.push_back(l);
+        }
+        L.colInd.push_back(i);
+        L.val.push_back(1);
+        L.rowPtr.push_back(L.nnz());
+
+        U.colInd.push_back(i);
+        U.val.push_back(u);
+        if(i < n - 1)
+        {
+            U.colInd.push_back(i + 1);
+            U.val.push_back(-1);
+        }
+        U.rowPtr.push_back(U.nnz());
+    }
+}
+
+// relative residual max |A * x - b| / max |b| for the tridiagonal matrix with diagonal d
+static double rf_residual(int n, double d, const double* x, const double* b)
+{
+    double err = 0, scale = 0;
+    for(int i = 0; i < n; i++)
+    {
+        double r = d * x[i] - (i > 0 ? x[i - 1] : 0) - (i < n - 1 ? x[i + 1] : 0);
+        err      = max(err, abs(r - b[i]));
+        scale    = max(scale, abs(b[i]));
+    }
+    return scale > 0 ? err / scale : err;
+}
+
+TEST(RF_BAD_ARG, handle)
+{
+    hipsolverRfHandle_t handle;
+    double              zero, boost;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverRfCreate(nullptr), HIPSOLVER_STATUS_HANDLE_IS_NULLPTR);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfDestroy(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverRfCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfSetNumericProperties(handle, 1e-14, 1e-10),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfGetNumericProperties(handle, &zero, &boost),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(zero, 1e-14);
+    EXPECT_EQ(boost, 1e-10);
+
+    // the factorization needs a setup and an analysis
+    EXPECT_NE(hipsolverRfRefactor(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// the factors of P * A * Q given to the setup must be refactorized when the values of A change
+TEST_P(RF, refactor)
+{
+    int    n = GetParam();
+    rf_csr A, L, U;
+    A.tridiagonal(n, 4);
+    rf_factors(n, 4, L, U);
+
+    // the tridiagonal matrices are unchanged by reversing both their rows and columns
+    vector<int> P(n), Q(n);
+    for(int i = 0; i < n; i++)
+        P[i] = Q[i] = n - 1 - i;
+
+    hipsolverRfHandle_t handle;
+    EXPECT_ROCBLAS_STATUS(hipsolverRfCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfSetupHost(n,
+                                               A.nnz(),
+                                               A.rowPtr.data(),
+                                               A.colInd.data(),
+                                               A.val.data(),
+                                               L.nnz(),
+                                               L.rowPtr.data(),
+                                               L.colInd.data(),
+                                               L.val.data(),
+                                               U.nnz(),
+                                               U.rowPtr.data(),
+                                               U.colInd.data(),
+                                               U.val.data(),
+                                               P.data(),
+                                               Q.data(),
+                                               handle),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfAnalyze(handle), HIPSOLVER_STATUS_SUCCESS);
+
+    device_strided_batch_vector<int>    dAp(n + 1, 1, n + 1, 1);
+    device_strided_batch_vector<int>    dAi(A.nnz(), 1, A.nnz(), 1);
+    device_strided_batch_vector<double> dAx(A.nnz(), 1, A.nnz(), 1);
+    device_strided_batch_vector<int>    dP(n, 1, n, 1);
+    device_strided_batch_vector<int>    dQ(n, 1, n, 1);
+    device_strided_batch_vector<double> dT(n, 1, n, 1);
+    device_strided_batch_vector<double> dX(n, 1, n, 1);
+    host_strided_batch_vector<double>   hb(n, 1, n, 1);
+    host_strided_batch_vector<double>   hx(n, 1, n, 1);
+    CHECK_HIP_ERROR(dAp.memcheck());
+    CHECK_HIP_ERROR(dAi.memcheck());
+    CHECK_HIP_ERROR(dAx.memcheck());
+    CHECK_HIP_ERROR(dP.memcheck());
+    CHECK_HIP_ERROR(dQ.memcheck());
+    CHECK_HIP_ERROR(dT.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAp.data(), A.rowPtr.data(), sizeof(int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAi.data(), A.colInd.data(), sizeof(int) * A.nnz(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dP.data(), P.data(), sizeof(int) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dQ.data(), Q.data(), sizeof(int) * n, hipMemcpyHostToDevice));
+    rocblas_init<double>(hb, true);
+
+    for(double d : {4.0, 5.0})
+    {
+        A.tridiagonal(n, d);
+        CHECK_HIP_ERROR(
+            hipMemcpy(dAx.data(), A.val.data(), sizeof(double) * A.nnz(), hipMemcpyHostToDevice));
+        EXPECT_ROCBLAS_STATUS(hipsolverRfResetValues(n,
+                                                     A.nnz(),
+                                                     dAp.data(),
+                                                     dAi.data(),
+                                                     dAx.data(),
+                                                     dP.data(),
+                                                     dQ.data(),
+                                                     handle),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverRfRefactor(handle), HIPSOLVER_STATUS_SUCCESS);
+
+        CHECK_HIP_ERROR(dX.transfer_from(hb));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverRfSolve(handle, dP.data(), dQ.data(), 1, dT.data(), n, dX.data(), n),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hx.transfer_from(dX));
+        ROCSOLVER_TEST_CHECK(double, rf_residual(n, d, hx[0], hb[0]), 10 * n);
+    }
+
+    int     nnzM;
+    int*    Mp;
+    int*    Mi;
+    double* Mx;
+    EXPECT_ROCBLAS_STATUS(hipsolverRfAccessBundledFactorsDevice(handle, &nnzM, &Mp, &Mi, &Mx),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(nnzM, L.nnz() + U.nnz() - n);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverRfDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// every matrix of a batch is refactorized, and a zero pivot is reported for its matrix only
+TEST_P(RF, batch)
+{
+    int       n     = GetParam();
+    const int batch = 3;
+    rf_csr    A, L, U;
+    A.tridiagonal(n, 4);
+    rf_factors(n, 4, L, U);
+
+    vector<int> P(n), Q(n);
+    for(int i = 0; i < n; i++)
+        P[i] = Q[i] = i;
+
+    // the matrix b has the diagonal 4 + b
+    vector<vector<double>> hAx(batch);
+    vector<double*>        hAx_array(batch);
+    for(int b = 0; b < batch; b++)
+    {
+        A.tridiagonal(n, 4 + b);
+        hAx[b]       = A.val;
+        hAx_array[b] = hAx[b].data();
+    }
+
+    hipsolverRfHandle_t handle;
+    EXPECT_ROCBLAS_STATUS(hipsolverRfCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfBatchSetupHost(batch,
+                                                    n,
+                                                    A.nnz(),
+                                                    A.rowPtr.data(),
+                                                    A.colInd.data(),
+                                                    hAx_array.data(),
+                                                    L.nnz(),
+                                                    L.rowPtr.data(),
+                                                    L.colInd.data(),
+                                                    L.val.data(),
+                                                    U.nnz(),
+                                                    U.rowPtr.data(),
+                                                    U.colInd.data(),
+                                                    U.val.data(),
+                                                    P.data(),
+                                                    Q.data(),
+                                                    handle),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfBatchAnalyze(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfBatchRefactor(handle), HIPSOLVER_STATUS_SUCCESS);
+
+    vector<int> position(batch);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfBatchZeroPivot(handle, position.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    for(int b = 0; b < batch; b++)
+        EXPECT_EQ(position[b], -1);
+
+    device_strided_batch_vector<int>    dP(n, 1, n, 1);
+    device_strided_batch_vector<int>    dQ(n, 1, n, 1);
+    device_strided_batch_vector<double> dT(2 * n, 1, 2 * n, 1);
+    device_strided_batch_vector<double> dX(n, 1, n, batch);
+    host_strided_batch_vector<double>   hb(n, 1, n, batch);
+    host_strided_batch_vector<double>   hx(n, 1, n, batch);
+    CHECK_HIP_ERROR(dP.memcheck());
+    CHECK_HIP_ERROR(dQ.memcheck());
+    CHECK_HIP_ERROR(dT.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(hipMemcpy(dP.data(), P.data(), sizeof(int) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dQ.data(), Q.data(), sizeof(int) * n, hipMemcpyHostToDevice));
+    rocblas_init<double>(hb, true);
+    CHECK_HIP_ERROR(dX.transfer_from(hb));
+
+    vector<double*> dX_array(batch);
+    for(int b = 0; b < batch; b++)
+        dX_array[b] = dX[b];
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverRfBatchSolve(handle, dP.data(), dQ.data(), 1, dT.data(), n, dX_array.data(), n),
+        HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hx.transfer_from(dX));
+    for(int b = 0; b < batch; b++)
+        ROCSOLVER_TEST_CHECK(double, rf_residual(n, 4 + b, hx[b], hb[b]), 10 * n);
+
+    // the matrix 1 becomes zero
+    device_strided_batch_vector<int>    dAp(n + 1, 1, n + 1, 1);
+    device_strided_batch_vector<int>    dAi(A.nnz(), 1, A.nnz(), 1);
+    device_strided_batch_vector<double> dAx(A.nnz(), 1, A.nnz(), batch);
+    CHECK_HIP_ERROR(dAp.memcheck());
+    CHECK_HIP_ERROR(dAi.memcheck());
+    CHECK_HIP_ERROR(dAx.memcheck());
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAp.data(), A.rowPtr.data(), sizeof(int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dAi.data(), A.colInd.data(), sizeof(int) * A.nnz(), hipMemcpyHostToDevice));
+    fill(hAx[1].begin(), hAx[1].end(), 0.0);
+
+    vector<double*> dAx_array(batch);
+    for(int b = 0; b < batch; b++)
+    {
+        dAx_array[b] = dAx[b];
+        CHECK_HIP_ERROR(hipMemcpy(
+            dAx[b], hAx[b].data(), sizeof(double) * A.nnz(), hipMemcpyHostToDevice));
+    }
+    EXPECT_ROCBLAS_STATUS(hipsolverRfBatchResetValues(batch,
+                                                      n,
+                                                      A.nnz(),
+                                                      dAp.data(),
+                                                      dAi.data(),
+                                                      dAx_array.data(),
+                                                      dP.data(),
+                                                      dQ.data(),
+                                                      handle),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfBatchRefactor(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverRfBatchZeroPivot(handle, position.data()),
+                          HIPSOLVER_STATUS_ZERO_PIVOT);
+    EXPECT_EQ(position[0], -1);
+    EXPECT_EQ(position[1], 0);
+    EXPECT_EQ(position[2], -1);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverRfDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, RF, ValuesIn(rf_size_range));
@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// orders of the tests; on the AMD backend the batches of real matrices of order up to 32 are
+// solved by the small batched kernels, and the larger ones by rocSOLVER
+const vector<int> small_batched_range = {1, 2, 5, 16, 31, 32, 33};
+
+// more matrices than the threads of a block of the kernels
+const int small_batched_count = 70;
+const int small_batched_nrhs  = 3;
+
+class SMALL_BATCHED : public ::TestWithParam<int>
+{
+protected:
+    SMALL_BATCHED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates well conditioned matrices of order n, symmetric positive definite if spd is true
+template <typename H>
+static void small_batched_init(H& hA, int n, int lda, bool spd)
+{
+    rocblas_init<double>(hA, true);
+    for(int b = 0; b < small_batched_count; b++)
+    {
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < j && spd; i++)
+                hA[b][j + i * lda] = hA[b][i + j * lda];
+            hA[b][j + j * lda] += spd ? 400 : 20;
+        }
+    }
+}
+
+// B = op(A) * X
+template <typename H>
+static void small_batched_rhs(hipsolverOperation_t trans,
+                              int                  n,
+                              const H&             hA,
+                              int                  lda,
+                              const H&             hX,
+                              H&                   hB,
+                              int                  ldb)
+{
+    for(int b = 0; b < small_batched_count; b++)
+    {
+        for(int c = 0; c < small_batched_nrhs; c++)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                double sum = 0;
+                for(int j = 0; j < n; j++)
+                    sum += (trans == HIPSOLVER_OP_N ? hA[b][i + j * lda] : hA[b][j + i * lda])
+                           * hX[b][j + c * ldb];
+                hB[b][i + c * ldb] = sum;
+            }
+        }
+    }
+}
+
+// the strided getrf and getrs must recover the solutions of their systems, for both operations
+TEST_P(SMALL_BATCHED, getrf_getrs_strided)
+{
+    int n = GetParam(), lda = n + 1, ldb = n + 2, bc = small_batched_count;
+    int strideA = lda * n, strideB = ldb * small_batched_nrhs;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hA(strideA, 1, strideA, bc);
+    host_strided_batch_vector<double>   hX(strideB, 1, strideB, bc);
+    host_strided_batch_vector<double>   hB(strideB, 1, strideB, bc);
+    host_strided_batch_vector<int>      hInfo(1, 1, 1, bc);
+    device_strided_batch_vector<double> dA(strideA, 1, strideA, bc);
+    device_strided_batch_vector<double> dB(strideB, 1, strideB, bc);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, bc);
+    device_strided_batch_vector<int>    dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    small_batched_init(hA, n, lda, false);
+    rocblas_init<double>(hX, false);
+    double tol = 100 * n * get_epsilon<double>();
+
+    for(hipsolverOperation_t trans : {HIPSOLVER_OP_N, HIPSOLVER_OP_T})
+    {
+        small_batched_rhs(trans, n, hA, lda, hX, hB, ldb);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+        CHECK_ROCBLAS_ERROR(hipsolverDgetrfStridedBatched(
+            handle, n, n, dA.data(), lda, strideA, nullptr, 0, dIpiv.data(), n, dInfo.data(), bc));
+        CHECK_ROCBLAS_ERROR(hipsolverDgetrsStridedBatched(handle,
+                                                          trans,
+                                                          n,
+                                                          small_batched_nrhs,
+                                                          dA.data(),
+                                                          lda,
+                                                          strideA,
+                                                          dIpiv.data(),
+                                                          n,
+                                                          dB.data(),
+                                                          ldb,
+                                                          strideB,
+                                                          nullptr,
+                                                          0,
+                                                          dInfo.data(),
+                                                          bc));
+        CHECK_HIP_ERROR(hB.transfer_from(dB));
+        CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+        for(int b = 0; b < bc; b++)
+        {
+            EXPECT_EQ(hInfo[b][0], 0);
+            EXPECT_LE(norm_error('F', n, small_batched_nrhs, ldb, hX[b], hB[b]), tol);
+        }
+    }
+}
+
+// getrfBatched and getrsBatched on arrays of pointers, with and without pivoting; the factors
+// computed without pivoting must reproduce their matrices
+TEST_P(SMALL_BATCHED, getrf_getrs_batched)
+{
+    int n = GetParam(), lda = n + 1, ldb = n, bc = small_batched_count;
+    int sizeA = lda * n, sizeB = ldb * small_batched_nrhs;
+
+    hipsolver_local_handle           handle;
+    host_batch_vector<double>        hA(sizeA, 1, bc);
+    host_batch_vector<double>        hARes(sizeA, 1, bc);
+    host_batch_vector<double>        hX(sizeB, 1, bc);
+    host_batch_vector<double>        hB(sizeB, 1, bc);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    device_batch_vector<double>      dA(sizeA, 1, bc);
+    device_batch_vector<double>      dB(sizeB, 1, bc);
+    device_strided_batch_vector<int> dIpiv(n, 1, n, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    small_batched_init(hA, n, lda, false);
+    rocblas_init<double>(hX, false);
+    small_batched_rhs(HIPSOLVER_OP_N, n, hA, lda, hX, hB, ldb);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    double tol = 100 * n * get_epsilon<double>();
+
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrfBatched(
+        handle, n, n, dA.data(), lda, nullptr, 0, dIpiv.data(), n, dInfo.data(), bc));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrsBatched(handle,
+                                               HIPSOLVER_OP_N,
+                                               n,
+                                               small_batched_nrhs,
+                                               dA.data(),
+                                               lda,
+                                               dIpiv.data(),
+                                               n,
+                                               dB.data(),
+                                               ldb,
+                                               nullptr,
+                                               0,
+                                               dInfo.data(),
+                                               bc));
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(hInfo[b][0], 0);
+        EXPECT_LE(norm_error('F', n, small_batched_nrhs, ldb, hX[b], hB[b]), tol);
+    }
+
+    // without pivoting, A = L * U
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrfBatched(
+        handle, n, n, dA.data(), lda, nullptr, 0, nullptr, n, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    for(int b = 0; b < bc; b++)
+    {
+        EXPECT_EQ(hInfo[b][0], 0);
+        double err = 0, nrm = 0;
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                double sum = 0;
+                for(int k = 0; k <= min(i, j); k++)
+                    sum += (k == i ? 1 : hARes[b][i + k * lda]) * hARes[b][k + j * lda];
+                err = max(err, abs(sum - hA[b][i + j * lda]));
+                nrm = max(nrm, abs(hA[b][i + j * lda]));
+            }
+        }
+        EXPECT_LE(err / nrm, tol);
+    }
+}
+
+// potrfBatched must compute the Cholesky factors of its matrices, in either triangle
+TEST_P(SMALL_BATCHED, potrf_batched)
+{
+    int n = GetParam(), lda = n + 1, bc = small_batched_count, sizeA = lda * n;
+
+    hipsolver_local_handle           handle;
+    host_batch_vector<double>        hA(sizeA, 1, bc);
+    host_batch_vector<double>        hARes(sizeA, 1, bc);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    device_batch_vector<double>      dA(sizeA, 1, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    small_batched_init(hA, n, lda, true);
+    double tol = 100 * n * get_epsilon<double>();
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        bool lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(
+            hipsolverDpotrfBatched(handle, uplo, n, dA.data(), lda, nullptr, 0, dInfo.data(), bc));
+        CHECK_HIP_ERROR(hARes.transfer_from(dA));
+        CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+        // A = L * L^T, or U^T * U where U(k, j) is L(j, k)
+        for(int b = 0; b < bc; b++)
+        {
+            EXPECT_EQ(hInfo[b][0], 0);
+            double err = 0, nrm = 0;
+            for(int j = 0; j < n; j++)
+            {
+                for(int i = j; i < n; i++)
+                {
+                    double sum = 0;
+                    for(int k = 0; k <= j; k++)
+                        sum += lower ? hARes[b][i + k * lda] * hARes[b][j + k * lda]
+                                     : hARes[b][k + i * lda] * hARes[b][k + j * lda];
+                    double a = lower ? hA[b][i + j * lda] : hA[b][j + i * lda];
+                    err      = max(err, abs(sum - a));
+                    nrm      = max(nrm, abs(a));
+                }
+            }
+            EXPECT_LE(err / nrm, tol);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SMALL_BATCHED, ValuesIn(small_batched_range));
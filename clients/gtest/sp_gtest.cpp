@@ -0,0 +1,538 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range value is the number of points k along each side of a k x k grid
+const vector<int> sp_size_range = {1, 4, 10};
+
+class SP : public ::TestWithParam<int>
+{
+protected:
+    SP() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// a CSR matrix with zero-based indices stored on the host
+struct sp_csr
+{
+    int            n = 0;
+    vector<int>    rowPtr;
+    vector<int>    colInd;
+    vector<double> val;
+
+    int nnz() const
+    {
+        return int(val.size());
+    }
+
+    // y = (A + shift * I) * x
+    void multiply(const double* x, double* y, double shift = 0) const
+    {
+        for(int i = 0; i < n; i++)
+        {
+            y[i] = shift * x[i];
+            for(int k = rowPtr[i]; k < rowPtr[i + 1]; k++)
+                y[i] += val[k] * x[colInd[k]];
+        }
+    }
+};
+
+// the 5-point Laplacian of a k x k grid, which is symmetric positive definite
+static sp_csr sp_laplacian(int k)
+{
+    sp_csr A;
+    auto   add = [&A](int col, double v) {
+        A.colInd.push_back(col);
+        A.val.push_back(v);
+    };
+
+    A.n = k * k;
+    A.rowPtr.push_back(0);
+    for(int i = 0; i < k; i++)
+    {
+        for(int j = 0; j < k; j++)
+        {
+            int row = i * k + j;
+            if(i > 0)
+                add(row - k, -1);
+            if(j > 0)
+                add(row - 1, -1);
+            add(row, 4);
+            if(j < k - 1)
+                add(row + 1, -1);
+            if(i < k - 1)
+                add(row + k, -1);
+            A.rowPtr.push_back(A.nnz());
+        }
+    }
+    return A;
+}
+
+// relative residual max |(A + shift * I) * x - b| / max |b|
+static double sp_residual(const sp_csr& A, const double* x, const double* b, double shift = 0)
+{
+    vector<double> r(A.n);
+    A.multiply(x, r.data(), shift);
+
+    double err = 0, scale = 0;
+    for(int i = 0; i < A.n; i++)
+    {
+        err   = max(err, abs(r[i] - b[i]));
+        scale = max(scale, abs(b[i]));
+    }
+    return scale > 0 ? err / scale : err;
+}
+
+// copies the pattern and values of A to the device
+struct sp_device_csr
+{
+    device_strided_batch_vector<int>    rowPtr;
+    device_strided_batch_vector<int>    colInd;
+    device_strided_batch_vector<double> val;
+
+    sp_device_csr(const sp_csr& A, int batch = 1)
+        : rowPtr(A.n + 1, 1, A.n + 1, 1)
+        , colInd(A.nnz(), 1, A.nnz(), 1)
+        , val(A.nnz() * batch, 1, A.nnz() * batch, 1)
+    {
+        CHECK_HIP_ERROR(rowPtr.memcheck());
+        CHECK_HIP_ERROR(colInd.memcheck());
+        CHECK_HIP_ERROR(val.memcheck());
+        CHECK_HIP_ERROR(hipMemcpy(
+            rowPtr.data(), A.rowPtr.data(), sizeof(int) * (A.n + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            colInd.data(), A.colInd.data(), sizeof(int) * A.nnz(), hipMemcpyHostToDevice));
+    }
+};
+
+TEST(SP_BAD_ARG, handle)
+{
+    hipsolverSpHandle_t      handle;
+    hipsolverSpMatDescr_t    descr;
+    hipsolverSpCsrcholInfo_t chol;
+    hipsolverSpCsrqrInfo_t   qr;
+    hipsolverIndexBase_t     base;
+    hipStream_t              stream;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreate(nullptr), HIPSOLVER_STATUS_HANDLE_IS_NULLPTR);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroy(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateMatDescr(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyMatDescr(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateCsrcholInfo(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateCsrqrInfo(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpSetStream(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpGetStream(handle, &stream), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stream, hipStream_t(0));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateMatDescr(&descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpGetMatIndexBase(descr, &base), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(base, HIPSOLVER_INDEX_BASE_ZERO);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpSetMatIndexBase(descr, HIPSOLVER_INDEX_BASE_ONE),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpGetMatIndexBase(descr, &base), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(base, HIPSOLVER_INDEX_BASE_ONE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpSetMatIndexBase(descr, hipsolverIndexBase_t(-1)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateCsrcholInfo(&chol), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateCsrqrInfo(&qr), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyCsrqrInfo(qr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyCsrcholInfo(chol), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyMatDescr(descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST(SP_BAD_ARG, routines)
+{
+    hipsolverSpHandle_t   handle;
+    hipsolverSpMatDescr_t descr;
+    int                   singularity;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateMatDescr(&descr), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvchol(nullptr,
+                                                 0,
+                                                 0,
+                                                 descr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 0,
+                                                 0,
+                                                 nullptr,
+                                                 &singularity),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvchol(handle,
+                                                 -1,
+                                                 0,
+                                                 descr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 0,
+                                                 0,
+                                                 nullptr,
+                                                 &singularity),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvqr(handle,
+                                               0,
+                                               0,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               nullptr,
+                                               0,
+                                               0,
+                                               nullptr,
+                                               &singularity),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // empty systems are not singular
+    singularity = 0;
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvchol(handle,
+                                                 0,
+                                                 0,
+                                                 descr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 nullptr,
+                                                 0,
+                                                 0,
+                                                 nullptr,
+                                                 &singularity),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(singularity, -1);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // the systems are densified on AMD, so large orders are rejected before any allocation
+    device_strided_batch_vector<int>    dRowPtr(1, 1, 1, 1);
+    device_strided_batch_vector<double> dv(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dRowPtr.memcheck());
+    CHECK_HIP_ERROR(dv.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvchol(handle,
+                                                 8193,
+                                                 0,
+                                                 descr,
+                                                 nullptr,
+                                                 dRowPtr.data(),
+                                                 nullptr,
+                                                 dv.data(),
+                                                 0,
+                                                 0,
+                                                 dv.data(),
+                                                 &singularity),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvqr(handle,
+                                               8193,
+                                               0,
+                                               descr,
+                                               nullptr,
+                                               dRowPtr.data(),
+                                               nullptr,
+                                               dv.data(),
+                                               0,
+                                               0,
+                                               dv.data(),
+                                               &singularity),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+#endif
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyMatDescr(descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// a zero pivot of the Cholesky factorization is reported, and the position is zero-based
+TEST(SP_BAD_ARG, singular)
+{
+    hipsolverSpHandle_t   handle;
+    hipsolverSpMatDescr_t descr;
+    int                   singularity;
+
+    sp_csr A;
+    A.n      = 3;
+    A.rowPtr = {0, 1, 2, 3};
+    A.colInd = {0, 1, 2};
+    A.val    = {1, 0, 1};
+
+    sp_device_csr                       dA(A);
+    device_strided_batch_vector<double> db(3, 1, 3, 1);
+    device_strided_batch_vector<double> dx(3, 1, 3, 1);
+    CHECK_HIP_ERROR(db.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA.val.data(), A.val.data(), sizeof(double) * 3, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(db.data(), 0, sizeof(double) * 3));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateMatDescr(&descr), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvchol(handle,
+                                                 3,
+                                                 3,
+                                                 descr,
+                                                 dA.val.data(),
+                                                 dA.rowPtr.data(),
+                                                 dA.colInd.data(),
+                                                 db.data(),
+                                                 1e-12,
+                                                 0,
+                                                 dx.data(),
+                                                 &singularity),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(singularity, 1);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyMatDescr(descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// the one-shot solvers must solve the Laplacian, given with one-based indices
+TEST_P(SP, csrlsv)
+{
+    int    k = GetParam();
+    sp_csr A = sp_laplacian(k);
+    int    n = A.n;
+
+    hipsolverSpHandle_t   handle;
+    hipsolverSpMatDescr_t descr;
+    int                   singularity;
+
+    // the device copy uses one-based indices
+    sp_csr A1 = A;
+    for(int& p : A1.rowPtr)
+        p++;
+    for(int& c : A1.colInd)
+        c++;
+
+    host_strided_batch_vector<double>   hb(n, 1, n, 1);
+    host_strided_batch_vector<double>   hx(n, 1, n, 1);
+    sp_device_csr                       dA(A1);
+    device_strided_batch_vector<double> db(n, 1, n, 1);
+    device_strided_batch_vector<double> dx(n, 1, n, 1);
+    CHECK_HIP_ERROR(db.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+    rocblas_init<double>(hb, true);
+    CHECK_HIP_ERROR(db.transfer_from(hb));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA.val.data(), A.val.data(), sizeof(double) * A.nnz(), hipMemcpyHostToDevice));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateMatDescr(&descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpSetMatIndexBase(descr, HIPSOLVER_INDEX_BASE_ONE),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvchol(handle,
+                                                 n,
+                                                 A.nnz(),
+                                                 descr,
+                                                 dA.val.data(),
+                                                 dA.rowPtr.data(),
+                                                 dA.colInd.data(),
+                                                 db.data(),
+                                                 1e-12,
+                                                 1,
+                                                 dx.data(),
+                                                 &singularity),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(singularity, -1);
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+    ROCSOLVER_TEST_CHECK(double, sp_residual(A, hx[0], hb[0]), 10 * n);
+
+    CHECK_HIP_ERROR(hipMemset(dx.data(), 0, sizeof(double) * n));
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrlsvqr(handle,
+                                               n,
+                                               A.nnz(),
+                                               descr,
+                                               dA.val.data(),
+                                               dA.rowPtr.data(),
+                                               dA.colInd.data(),
+                                               db.data(),
+                                               1e-12,
+                                               0,
+                                               dx.data(),
+                                               &singularity),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(singularity, -1);
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+    ROCSOLVER_TEST_CHECK(double, sp_residual(A, hx[0], hb[0]), 10 * n);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyMatDescr(descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// a factorization must be reusable for several right-hand sides
+TEST_P(SP, csrchol)
+{
+    int    k = GetParam();
+    sp_csr A = sp_laplacian(k);
+    int    n = A.n;
+
+    hipsolverSpHandle_t      handle;
+    hipsolverSpMatDescr_t    descr;
+    hipsolverSpCsrcholInfo_t info;
+    size_t                   internal, workspace;
+    int                      position;
+
+    host_strided_batch_vector<double>   hb(n, 1, n, 1);
+    host_strided_batch_vector<double>   hx(n, 1, n, 1);
+    sp_device_csr                       dA(A);
+    device_strided_batch_vector<double> db(n, 1, n, 1);
+    device_strided_batch_vector<double> dx(n, 1, n, 1);
+    CHECK_HIP_ERROR(db.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA.val.data(), A.val.data(), sizeof(double) * A.nnz(), hipMemcpyHostToDevice));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateMatDescr(&descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateCsrcholInfo(&info), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSpXcsrcholAnalysis(
+            handle, n, A.nnz(), descr, dA.rowPtr.data(), dA.colInd.data(), info),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrcholBufferInfo(handle,
+                                                        n,
+                                                        A.nnz(),
+                                                        descr,
+                                                        dA.val.data(),
+                                                        dA.rowPtr.data(),
+                                                        dA.colInd.data(),
+                                                        info,
+                                                        &internal,
+                                                        &workspace),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    int                                 lw = int(max(workspace, size_t(1)) + 7) / 8;
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrcholFactor(handle,
+                                                    n,
+                                                    A.nnz(),
+                                                    descr,
+                                                    dA.val.data(),
+                                                    dA.rowPtr.data(),
+                                                    dA.colInd.data(),
+                                                    info,
+                                                    dWork.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrcholZeroPivot(handle, info, 1e-12, &position),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(position, -1);
+
+    for(int rhs = 0; rhs < 2; rhs++)
+    {
+        rocblas_init<double>(hb, rhs == 0);
+        CHECK_HIP_ERROR(db.transfer_from(hb));
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverSpDcsrcholSolve(handle, n, db.data(), dx.data(), info, dWork.data()),
+            HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hx.transfer_from(dx));
+        ROCSOLVER_TEST_CHECK(double, sp_residual(A, hx[0], hb[0]), 10 * n);
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyCsrcholInfo(info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyMatDescr(descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+// the problems of a batch share the pattern of A; problem b solves (A + b * I) * x = b
+TEST_P(SP, csrqrsvBatched)
+{
+    int    k = GetParam(), batch = 3;
+    sp_csr A = sp_laplacian(k);
+    int    n = A.n, nnz = A.nnz();
+
+    hipsolverSpHandle_t    handle;
+    hipsolverSpMatDescr_t  descr;
+    hipsolverSpCsrqrInfo_t info;
+    size_t                 internal, workspace;
+
+    vector<double> hval(size_t(nnz) * batch);
+    for(int b = 0; b < batch; b++)
+    {
+        for(int i = 0; i < n; i++)
+            for(int p = A.rowPtr[i]; p < A.rowPtr[i + 1]; p++)
+                hval[b * nnz + p] = A.val[p] + (A.colInd[p] == i ? b : 0);
+    }
+
+    host_strided_batch_vector<double>   hb(n * batch, 1, n * batch, 1);
+    host_strided_batch_vector<double>   hx(n * batch, 1, n * batch, 1);
+    sp_device_csr                       dA(A, batch);
+    device_strided_batch_vector<double> db(n * batch, 1, n * batch, 1);
+    device_strided_batch_vector<double> dx(n * batch, 1, n * batch, 1);
+    CHECK_HIP_ERROR(db.memcheck());
+    CHECK_HIP_ERROR(dx.memcheck());
+    rocblas_init<double>(hb, true);
+    CHECK_HIP_ERROR(db.transfer_from(hb));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA.val.data(), hval.data(), sizeof(double) * hval.size(), hipMemcpyHostToDevice));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreate(&handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateMatDescr(&descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpCreateCsrqrInfo(&info), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSpXcsrqrAnalysisBatched(
+            handle, n, n, nnz, descr, dA.rowPtr.data(), dA.colInd.data(), info),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrqrBufferInfoBatched(handle,
+                                                             n,
+                                                             n,
+                                                             nnz,
+                                                             descr,
+                                                             dA.val.data(),
+                                                             dA.rowPtr.data(),
+                                                             dA.colInd.data(),
+                                                             batch,
+                                                             info,
+                                                             &internal,
+                                                             &workspace),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    int                                 lw = int(max(workspace, size_t(1)) + 7) / 8;
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDcsrqrsvBatched(handle,
+                                                     n,
+                                                     n,
+                                                     nnz,
+                                                     descr,
+                                                     dA.val.data(),
+                                                     dA.rowPtr.data(),
+                                                     dA.colInd.data(),
+                                                     db.data(),
+                                                     dx.data(),
+                                                     batch,
+                                                     info,
+                                                     dWork.data()),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+
+    for(int b = 0; b < batch; b++)
+        ROCSOLVER_TEST_CHECK(
+            double, sp_residual(A, hx[0] + b * n, hb[0] + b * n, double(b)), 10 * n);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyCsrqrInfo(info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroyMatDescr(descr), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpDestroy(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SP, ValuesIn(sp_size_range));
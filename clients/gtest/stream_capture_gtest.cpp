@@ -0,0 +1,556 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+#include <functional>
+#include <memory>
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {n, lda}
+const vector<vector<int>> capture_size_range = {{1, 1}, {12, 12}, {33, 40}};
+
+class STREAM_CAPTURE : public ::TestWithParam<vector<int>>
+{
+protected:
+    STREAM_CAPTURE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+/*! \brief Device arrays used by a captured call, with the values they hold before every run. */
+class capture_buffers
+{
+    vector<unique_ptr<device_strided_batch_vector<double>>> d_bufs;
+    vector<unique_ptr<device_strided_batch_vector<int>>>    i_bufs;
+    vector<vector<double>>                                  d_init;
+    vector<vector<int>>                                     i_init;
+
+    template <typename T>
+    static T* add(vector<unique_ptr<device_strided_batch_vector<T>>>& bufs,
+                  vector<vector<T>>&                                  inits,
+                  const vector<T>&                                    init)
+    {
+        int size = max(int(init.size()), 1);
+        bufs.emplace_back(new device_strided_batch_vector<T>(size, 1, size, 1));
+        EXPECT_EQ(bufs.back()->memcheck(), hipSuccess);
+        inits.push_back(init);
+        return bufs.back()->data();
+    }
+
+    template <typename T>
+    static void copy(const vector<unique_ptr<device_strided_batch_vector<T>>>& bufs,
+                     vector<vector<T>>&                                        values,
+                     hipMemcpyKind                                             kind)
+    {
+        for(size_t i = 0; i < bufs.size(); i++)
+        {
+            if(values[i].empty())
+                continue;
+            void* dst = kind == hipMemcpyHostToDevice ? (void*)bufs[i]->data() : values[i].data();
+            void* src = kind == hipMemcpyHostToDevice ? (void*)values[i].data() : bufs[i]->data();
+            CHECK_HIP_ERROR(hipMemcpy(dst, src, sizeof(T) * values[i].size(), kind));
+        }
+    }
+
+public:
+    double* add(const vector<double>& init)
+    {
+        return add(d_bufs, d_init, init);
+    }
+    int* add(const vector<int>& init)
+    {
+        return add(i_bufs, i_init, init);
+    }
+
+    void reset()
+    {
+        copy(d_bufs, d_init, hipMemcpyHostToDevice);
+        copy(i_bufs, i_init, hipMemcpyHostToDevice);
+    }
+
+    void read(vector<vector<double>>& d_values, vector<vector<int>>& i_values) const
+    {
+        d_values = d_init;
+        i_values = i_init;
+        copy(d_bufs, d_values, hipMemcpyDeviceToHost);
+        copy(i_bufs, i_values, hipMemcpyDeviceToHost);
+    }
+};
+
+/*! \brief Stream and handle of a capture test, and the checks performed with them. */
+class capture_context
+{
+public:
+    hipsolver_local_handle handle;
+    hipStream_t            stream;
+
+    capture_context()
+    {
+        EXPECT_EQ(hipStreamCreate(&stream), hipSuccess);
+        EXPECT_ROCBLAS_STATUS(hipsolverSetStream(handle, stream), HIPSOLVER_STATUS_SUCCESS);
+    }
+
+    ~capture_context()
+    {
+        hipStreamDestroy(stream);
+    }
+
+    /*! \brief Returns the status of call when it is made while the stream is being captured. */
+    hipsolverStatus_t capture(const function<hipsolverStatus_t()>& call, hipGraph_t* graph)
+    {
+        EXPECT_EQ(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal), hipSuccess);
+        hipsolverStatus_t status = call();
+        EXPECT_EQ(hipStreamEndCapture(stream, graph), hipSuccess);
+        return status;
+    }
+
+    /*! \brief Checks that replaying a captured call gives the results of a direct call.
+     *
+     *  The buffers are restored before every run, so that each run sees the same inputs.
+     */
+    void check(capture_buffers& bufs, const function<hipsolverStatus_t()>& call)
+    {
+        vector<vector<double>> d_ref, d_res;
+        vector<vector<int>>    i_ref, i_res;
+
+        bufs.reset();
+        EXPECT_ROCBLAS_STATUS(call(), HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        bufs.read(d_ref, i_ref);
+
+        hipGraph_t     graph = nullptr;
+        hipGraphExec_t exec  = nullptr;
+        EXPECT_ROCBLAS_STATUS(capture(call, &graph), HIPSOLVER_STATUS_SUCCESS);
+        ASSERT_NE(graph, nullptr);
+        CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+
+        for(int run = 0; run < 2; run++)
+        {
+            bufs.reset();
+            CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+            bufs.read(d_res, i_res);
+
+            for(size_t i = 0; i < d_ref.size(); i++)
+                for(size_t j = 0; j < d_ref[i].size(); j++)
+                    EXPECT_NEAR(d_res[i][j], d_ref[i][j], 1e-10 * max(1.0, abs(d_ref[i][j])))
+                        << "buffer " << i << ", entry " << j << ", run " << run;
+            for(size_t i = 0; i < i_ref.size(); i++)
+                EXPECT_EQ(i_res[i], i_ref[i]) << "buffer " << i << ", run " << run;
+        }
+
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    }
+};
+
+// a well-conditioned symmetric matrix, which is also positive definite
+static vector<double> capture_matrix(int n, int lda, int seed)
+{
+    vector<double> A(size_t(lda) * n, 0);
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = 0; i <= j; i++)
+        {
+            double v = double((7 * i + 13 * j + seed) % 17) / 17 - 0.5;
+            A[i + size_t(j) * lda] = v;
+            A[j + size_t(i) * lda] = v;
+        }
+        A[j + size_t(j) * lda] += n;
+    }
+    return A;
+}
+
+static vector<double> capture_tau(int n)
+{
+    vector<double> tau(n);
+    for(int i = 0; i < n; i++)
+        tau[i] = 1.0 + double(i % 5) / 10;
+    return tau;
+}
+
+TEST(STREAM_CAPTURE_API, info_queries)
+{
+    capture_context        ctx;
+    hipsolverInfoSummary_t summary;
+    hipGraph_t             graph = nullptr;
+
+    // the summary callback cannot be recorded
+    EXPECT_ROCBLAS_STATUS(hipsolverSetInfoMode(ctx.handle, HIPSOLVER_INFO_MODE_AGGREGATE),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        ctx.capture([&] { return hipsolverGetInfoAsync(ctx.handle, &summary, nullptr); }, &graph),
+        HIPSOLVER_STATUS_CAPTURE_UNSAFE);
+    if(graph)
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+// without a work array, a capture only succeeds once the workspace arena is large enough
+TEST(STREAM_CAPTURE_API, workspace)
+{
+    int            n = 128, lda = 128, lwork;
+    vector<double> hA = capture_matrix(n, lda, 0);
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(hA);
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    auto call = [&] {
+        return hipsolverDpotrf(
+            ctx.handle, HIPSOLVER_FILL_MODE_UPPER, n, dA, lda, nullptr, 0, dinfo);
+    };
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_bufferSize(ctx.handle, HIPSOLVER_FILL_MODE_UPPER, n, dA, lda, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+
+    hipGraph_t graph = nullptr;
+    bufs.reset();
+    EXPECT_ROCBLAS_STATUS(ctx.capture(call, &graph), HIPSOLVER_STATUS_CAPTURE_UNSAFE);
+    if(graph)
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(ctx.handle, lwork), HIPSOLVER_STATUS_SUCCESS);
+    ctx.check(bufs, call);
+}
+#endif
+
+TEST_P(STREAM_CAPTURE, potrf)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 0));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrf_bufferSize(ctx.handle, HIPSOLVER_FILL_MODE_UPPER, n, dA, lda, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        return hipsolverDpotrf(
+            ctx.handle, HIPSOLVER_FILL_MODE_UPPER, n, dA, lda, dWork, lwork, dinfo);
+    });
+}
+
+TEST_P(STREAM_CAPTURE, getrf_getrs)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork, lwork_s;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 3));
+    double*         dB    = bufs.add(capture_matrix(n, lda, 5));
+    int*            dIpiv = bufs.add(vector<int>(n, 0));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(ctx.handle, n, n, dA, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrs_bufferSize(
+                              ctx.handle, HIPSOLVER_OP_N, n, n, dA, lda, dIpiv, dB, lda, &lwork_s),
+                          HIPSOLVER_STATUS_SUCCESS);
+    lwork         = max(lwork, lwork_s);
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        hipsolverStatus_t status
+            = hipsolverDgetrf(ctx.handle, n, n, dA, lda, dWork, lwork, dIpiv, dinfo);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        return hipsolverDgetrs(
+            ctx.handle, HIPSOLVER_OP_N, n, n, dA, lda, dIpiv, dB, lda, dWork, lwork, dinfo);
+    });
+}
+
+TEST_P(STREAM_CAPTURE, geqrf_orgqr_ormqr)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork, lwork_g, lwork_m;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 1));
+    double*         dQ    = bufs.add(capture_matrix(n, lda, 2));
+    double*         dC    = bufs.add(capture_matrix(n, lda, 4));
+    double*         dTau  = bufs.add(vector<double>(n, 0));
+    double*         dTauQ = bufs.add(capture_tau(n));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqrf_bufferSize(ctx.handle, n, n, dA, lda, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDorgqr_bufferSize(ctx.handle, n, n, n, dQ, lda, dTauQ, &lwork_g),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDormqr_bufferSize(ctx.handle,
+                                                     HIPSOLVER_SIDE_LEFT,
+                                                     HIPSOLVER_OP_T,
+                                                     n,
+                                                     n,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     dTau,
+                                                     dC,
+                                                     lda,
+                                                     &lwork_m),
+                          HIPSOLVER_STATUS_SUCCESS);
+    lwork         = max(lwork, max(lwork_g, lwork_m));
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        hipsolverStatus_t status
+            = hipsolverDgeqrf(ctx.handle, n, n, dA, lda, dTau, dWork, lwork, dinfo);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status
+                = hipsolverDorgqr(ctx.handle, n, n, n, dQ, lda, dTauQ, dWork, lwork, dinfo);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolverDormqr(ctx.handle,
+                                     HIPSOLVER_SIDE_LEFT,
+                                     HIPSOLVER_OP_T,
+                                     n,
+                                     n,
+                                     n,
+                                     dA,
+                                     lda,
+                                     dTau,
+                                     dC,
+                                     lda,
+                                     dWork,
+                                     lwork,
+                                     dinfo);
+        return status;
+    });
+}
+
+TEST_P(STREAM_CAPTURE, sytrd_orgtr_ormtr)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork, lwork_g, lwork_m;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 6));
+    double*         dQ    = bufs.add(capture_matrix(n, lda, 7));
+    double*         dC    = bufs.add(capture_matrix(n, lda, 8));
+    double*         dD    = bufs.add(vector<double>(n, 0));
+    double*         dE    = bufs.add(vector<double>(n, 0));
+    double*         dTau  = bufs.add(vector<double>(n, 0));
+    double*         dTauQ = bufs.add(capture_tau(n));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_LOWER;
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDsytrd_bufferSize(ctx.handle, uplo, n, dA, lda, dD, dE, dTau, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDorgtr_bufferSize(ctx.handle, uplo, n, dQ, lda, dTauQ, &lwork_g),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDormtr_bufferSize(ctx.handle,
+                                                     HIPSOLVER_SIDE_LEFT,
+                                                     uplo,
+                                                     HIPSOLVER_OP_N,
+                                                     n,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     dTau,
+                                                     dC,
+                                                     lda,
+                                                     &lwork_m),
+                          HIPSOLVER_STATUS_SUCCESS);
+    lwork         = max(lwork, max(lwork_g, lwork_m));
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        hipsolverStatus_t status
+            = hipsolverDsytrd(ctx.handle, uplo, n, dA, lda, dD, dE, dTau, dWork, lwork, dinfo);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolverDorgtr(ctx.handle, uplo, n, dQ, lda, dTauQ, dWork, lwork, dinfo);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolverDormtr(ctx.handle,
+                                     HIPSOLVER_SIDE_LEFT,
+                                     uplo,
+                                     HIPSOLVER_OP_N,
+                                     n,
+                                     n,
+                                     dA,
+                                     lda,
+                                     dTau,
+                                     dC,
+                                     lda,
+                                     dWork,
+                                     lwork,
+                                     dinfo);
+        return status;
+    });
+}
+
+TEST_P(STREAM_CAPTURE, gebrd_orgbr)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork, lwork_g;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 9));
+    double*         dQ    = bufs.add(capture_matrix(n, lda, 10));
+    double*         dD    = bufs.add(vector<double>(n, 0));
+    double*         dE    = bufs.add(vector<double>(n, 0));
+    double*         dTauq = bufs.add(vector<double>(n, 0));
+    double*         dTaup = bufs.add(vector<double>(n, 0));
+    double*         dTauQ = bufs.add(capture_tau(n));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgebrd_bufferSize(ctx.handle, n, n, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDorgbr_bufferSize(
+                              ctx.handle, HIPSOLVER_SIDE_LEFT, n, n, n, dQ, lda, dTauQ, &lwork_g),
+                          HIPSOLVER_STATUS_SUCCESS);
+    lwork         = max(lwork, lwork_g);
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        hipsolverStatus_t status = hipsolverDgebrd(
+            ctx.handle, n, n, dA, lda, dD, dE, dTauq, dTaup, dWork, lwork, dinfo);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolverDorgbr(
+                ctx.handle, HIPSOLVER_SIDE_LEFT, n, n, n, dQ, lda, dTauQ, dWork, lwork, dinfo);
+        return status;
+    });
+}
+
+TEST_P(STREAM_CAPTURE, syevd)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 11));
+    double*         dD    = bufs.add(vector<double>(n, 0));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    hipsolverEigMode_t  jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_UPPER;
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDsyevd_bufferSize(ctx.handle, jobz, uplo, n, dA, lda, dD, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        return hipsolverDsyevd(ctx.handle, jobz, uplo, n, dA, lda, dD, dWork, lwork, dinfo);
+    });
+}
+
+TEST_P(STREAM_CAPTURE, sygvd)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 12));
+    double*         dB    = bufs.add(capture_matrix(n, lda, 13));
+    double*         dD    = bufs.add(vector<double>(n, 0));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    hipsolverEigType_t  itype = HIPSOLVER_EIG_TYPE_1;
+    hipsolverEigMode_t  jobz  = HIPSOLVER_EIG_MODE_VECTOR;
+    hipsolverFillMode_t uplo  = HIPSOLVER_FILL_MODE_UPPER;
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDsygvd_bufferSize(ctx.handle, itype, jobz, uplo, n, dA, lda, dB, lda, dD, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        return hipsolverDsygvd(
+            ctx.handle, itype, jobz, uplo, n, dA, lda, dB, lda, dD, dWork, lwork, dinfo);
+    });
+}
+
+TEST_P(STREAM_CAPTURE, gesvd)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 14));
+    double*         dS    = bufs.add(vector<double>(n, 0));
+    double*         dU    = bufs.add(vector<double>(size_t(lda) * n, 0));
+    double*         dV    = bufs.add(vector<double>(size_t(lda) * n, 0));
+    double*         dE    = bufs.add(vector<double>(n, 0));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgesvd_bufferSize(ctx.handle, 'A', 'A', n, n, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        return hipsolverDgesvd(
+            ctx.handle, 'A', 'A', n, n, dA, lda, dS, dU, lda, dV, lda, dWork, lwork, dE, dinfo);
+    });
+}
+
+TEST_P(STREAM_CAPTURE, gesvdj)
+{
+    vector<int> size = GetParam();
+    int         n = size[0], lda = size[1], lwork;
+
+    capture_context ctx;
+    capture_buffers bufs;
+    double*         dA    = bufs.add(capture_matrix(n, lda, 15));
+    double*         dS    = bufs.add(vector<double>(n, 0));
+    double*         dU    = bufs.add(vector<double>(size_t(lda) * n, 0));
+    double*         dV    = bufs.add(vector<double>(size_t(lda) * n, 0));
+    int*            dinfo = bufs.add(vector<int>(1, 0));
+
+    hipsolverGesvdjInfo_t params;
+    hipsolverEigMode_t    jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateGesvdjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgesvdj_bufferSize(
+            ctx.handle, jobz, 0, n, n, dA, lda, dS, dU, lda, dV, lda, &lwork, params),
+        HIPSOLVER_STATUS_SUCCESS);
+    double* dWork = bufs.add(vector<double>(lwork));
+
+    ctx.check(bufs, [&] {
+        return hipsolverDgesvdj(
+            ctx.handle, jobz, 0, n, n, dA, lda, dS, dU, lda, dV, lda, dWork, lwork, dinfo, params);
+    });
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // the results of the computation are synchronously copied to the host
+    double     residual;
+    int        sweeps;
+    hipGraph_t graph = nullptr;
+
+    EXPECT_ROCBLAS_STATUS(
+        ctx.capture([&] { return hipsolverXgesvdjGetResidual(ctx.handle, params, &residual); },
+                    &graph),
+        HIPSOLVER_STATUS_CAPTURE_UNSAFE);
+    if(graph)
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+    graph = nullptr;
+    EXPECT_ROCBLAS_STATUS(
+        ctx.capture([&] { return hipsolverXgesvdjGetSweeps(ctx.handle, params, &sweeps); },
+                    &graph),
+        HIPSOLVER_STATUS_CAPTURE_UNSAFE);
+    if(graph)
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+#endif
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyGesvdjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, STREAM_CAPTURE, ValuesIn(capture_size_range));
@@ -66,7 +66,7 @@ protected:
     virtual void TearDown() {}
 
     template <bool BATCHED, bool STRIDED, typename T>
-    void run_tests()
+    void run_tests(bool device_verify = false)
     {
         Arguments arg = syevd_heevd_setup_arguments(GetParam());
 
@@ -74,7 +74,8 @@ protected:
            && arg.peek<char>("uplo") == 'L')
             testing_syevd_heevd_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = 1;
+        arg.batch_count   = (BATCHED || STRIDED) ? 3 : 1;
+        arg.device_verify = device_verify;
         testing_syevd_heevd<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
@@ -137,6 +138,131 @@ TEST_P(HEEVD_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// batched tests
+
+TEST_P(SYEVD, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(SYEVD, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(SYEVD_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(SYEVD_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(HEEVD, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVD, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(HEEVD_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVD_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYEVD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYEVD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(SYEVD_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYEVD_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEEVD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(HEEVD_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVD_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// device verification tests
+TEST_P(SYEVD, device_verify__float)
+{
+    run_tests<false, false, float>(true);
+}
+
+TEST_P(SYEVD, device_verify__double)
+{
+    run_tests<false, false, double>(true);
+}
+
+TEST_P(HEEVD, device_verify__float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>(true);
+}
+
+TEST_P(HEEVD, device_verify__double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>(true);
+}
+
+TEST_P(SYEVD, strided_batched_device_verify__float)
+{
+    run_tests<false, true, float>(true);
+}
+
+TEST_P(SYEVD, strided_batched_device_verify__double)
+{
+    run_tests<false, true, double>(true);
+}
+
+TEST_P(HEEVD, strided_batched_device_verify__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>(true);
+}
+
+TEST_P(HEEVD, strided_batched_device_verify__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>(true);
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          SYEVD,
 //                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
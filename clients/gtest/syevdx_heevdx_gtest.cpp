@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_syevdx_heevdx.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>> syevdx_heevdx_tuple;
+
+// each size_range vector is a {n, lda, vl, vu, il, iu}
+
+// each op_range vector is a {jobz, range, uplo}
+
+// case when n == -1, jobz == N, range == A and uplo = L will also execute the bad arguments
+// test (null handle, null pointers and invalid values)
+
+const vector<vector<char>> op_range = {{'N', 'A', 'L'},
+                                       {'V', 'A', 'U'},
+                                       {'N', 'V', 'U'},
+                                       {'V', 'V', 'L'},
+                                       {'N', 'I', 'L'},
+                                       {'V', 'I', 'U'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // invalid
+    {-1, 1, 0, 10, 1, 1},
+    {20, 5, 0, 10, 1, 1},
+    {20, 20, 10, 0, 1, 1},
+    {20, 20, 0, 10, 10, 1},
+    {20, 20, 0, 10, 1, 30},
+    // normal (valid) samples
+    {1, 1, 0, 1000, 1, 1},
+    {12, 12, 380, 420, 3, 8},
+    {20, 30, 395, 405, 1, 20},
+    {35, 35, 390, 410, 30, 35},
+    {50, 60, 400, 450, 1, 25}};
+
+Arguments syevdx_heevdx_setup_arguments(syevdx_heevdx_tuple tup)
+{
+    vector<int>  size = std::get<0>(tup);
+    vector<char> op   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+
+    arg.set<char>("jobz", op[0]);
+    arg.set<char>("range", op[1]);
+    arg.set<char>("uplo", op[2]);
+
+    // the interval and index bounds are only set when they are used
+    if(op[1] == 'V')
+    {
+        arg.set<double>("vl", size[2]);
+        arg.set<double>("vu", size[3]);
+    }
+    else if(op[1] == 'I')
+    {
+        arg.set<rocblas_int>("il", size[4]);
+        arg.set<rocblas_int>("iu", size[5]);
+    }
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYEVDX_HEEVDX : public ::TestWithParam<syevdx_heevdx_tuple>
+{
+protected:
+    SYEVDX_HEEVDX() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = syevdx_heevdx_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("jobz") == 'N'
+           && arg.peek<char>("range") == 'A' && arg.peek<char>("uplo") == 'L')
+            testing_syevdx_heevdx_bad_arg<false, T>();
+
+        arg.batch_count = 1;
+        testing_syevdx_heevdx<false, T>(arg);
+    }
+};
+
+class SYEVDX : public SYEVDX_HEEVDX
+{
+};
+
+class HEEVDX : public SYEVDX_HEEVDX
+{
+};
+
+// non-batch tests
+
+TEST_P(SYEVDX, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(SYEVDX, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(HEEVDX, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(HEEVDX, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SYEVDX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HEEVDX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_syevj_heevj.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>> syevj_heevj_tuple;
+
+// each size_range vector is a {n, lda}
+
+// each op_range vector is a {jobz, uplo, sort_eig}
+
+// case when n == -1, jobz == N, and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<char>> op_range
+    = {{'N', 'L', '1'}, {'N', 'U', '1'}, {'V', 'L', '1'}, {'V', 'U', '1'}, {'V', 'L', '0'}};
+
+// for checkin_lapack tests
+// (matrices are kept small enough for the batched Jacobi solver of cuSOLVER)
+const vector<vector<int>> size_range = {
+    // invalid
+    {-1, 1},
+    {10, 5},
+    // normal (valid) samples
+    {1, 1},
+    {12, 12},
+    {20, 30},
+    {32, 32}};
+
+Arguments syevj_heevj_setup_arguments(syevj_heevj_tuple tup)
+{
+    vector<int>  size = std::get<0>(tup);
+    vector<char> op   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+
+    arg.set<char>("jobz", op[0]);
+    arg.set<char>("uplo", op[1]);
+    arg.set<rocblas_int>("sort_eig", op[2] - '0');
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYEVJ_HEEVJ : public ::TestWithParam<syevj_heevj_tuple>
+{
+protected:
+    SYEVJ_HEEVJ() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = syevj_heevj_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("jobz") == 'N'
+           && arg.peek<char>("uplo") == 'L')
+            testing_syevj_heevj_bad_arg<false, STRIDED, T>();
+
+        arg.batch_count = STRIDED ? 3 : 1;
+        testing_syevj_heevj<false, STRIDED, T>(arg);
+    }
+};
+
+class SYEVJ : public SYEVJ_HEEVJ
+{
+};
+
+class HEEVJ : public SYEVJ_HEEVJ
+{
+};
+
+// non-batch tests
+
+TEST_P(SYEVJ, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(SYEVJ, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(HEEVJ, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVJ, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYEVJ, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(SYEVJ, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(HEEVJ, strided_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVJ, strided_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SYEVJ, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HEEVJ, Combine(ValuesIn(size_range), ValuesIn(op_range)));
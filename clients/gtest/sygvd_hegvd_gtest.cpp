@@ -4,6 +4,7 @@
  * ************************************************************************ */
 
 #include "testing_sygvd_hegvd.hpp"
+#include "testing_sygvd_hegvd_factored.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -83,11 +84,36 @@ protected:
            && arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
             testing_sygvd_hegvd_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (STRIDED ? 3 : 1);
         testing_sygvd_hegvd<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
 
+class SYGVD_HEGVD_FACTORED : public ::TestWithParam<sygvd_tuple>
+{
+protected:
+    SYGVD_HEGVD_FACTORED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool SHARED, typename T>
+    void run_tests()
+    {
+        Arguments arg = sygvd_setup_arguments(GetParam());
+
+        if(arg.peek<char>("itype") == '1' && arg.peek<char>("jobz") == 'N'
+           && arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
+            testing_sygvd_hegvd_factored_bad_arg<false, false, true, T>();
+
+        // a zero strideB shares one factor between all the problems
+        if(SHARED)
+            arg.set<rocblas_int>("strideB", 0);
+
+        arg.batch_count = 3;
+        testing_sygvd_hegvd_factored<false, false, true, T>(arg);
+    }
+};
+
 class SYGVD : public SYGVD_HEGVD<false>
 {
 };
@@ -96,6 +122,14 @@ class HEGVD : public SYGVD_HEGVD<false>
 {
 };
 
+class SYGVD_FACTORED : public SYGVD_HEGVD_FACTORED
+{
+};
+
+class HEGVD_FACTORED : public SYGVD_HEGVD_FACTORED
+{
+};
+
 class SYGVD_FORTRAN : public SYGVD_HEGVD<true>
 {
 };
@@ -146,6 +180,90 @@ TEST_P(HEGVD_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// strided_batched tests
+
+TEST_P(SYGVD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYGVD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(SYGVD_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYGVD_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEGVD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEGVD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(HEGVD_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEGVD_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// factored tests
+
+TEST_P(SYGVD_FACTORED, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(SYGVD_FACTORED, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(HEGVD_FACTORED, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(HEGVD_FACTORED, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+TEST_P(SYGVD_FACTORED, shared__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(SYGVD_FACTORED, shared__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(HEGVD_FACTORED, shared__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(HEGVD_FACTORED, shared__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          SYGVD,
 //                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(type_range)));
@@ -177,3 +295,11 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          HEGVD_FORTRAN,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(type_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYGVD_FACTORED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(type_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HEGVD_FACTORED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(type_range)));
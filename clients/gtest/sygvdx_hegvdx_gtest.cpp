@@ -0,0 +1,135 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sygvdx_hegvdx.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>> sygvdx_hegvdx_tuple;
+
+// each size_range vector is a {n, lda, ldb, vl, vu, il, iu}
+
+// each op_range vector is a {itype, jobz, range, uplo}
+
+// case when n == -1, itype == 1, jobz == N, range == A and uplo = L will also execute the bad
+// arguments test (null handle, null pointers and invalid values)
+
+const vector<vector<char>> op_range = {{'1', 'N', 'A', 'L'},
+                                       {'1', 'V', 'A', 'U'},
+                                       {'1', 'V', 'V', 'L'},
+                                       {'1', 'N', 'I', 'U'},
+                                       {'2', 'V', 'I', 'L'},
+                                       {'2', 'N', 'V', 'U'},
+                                       {'3', 'V', 'V', 'U'},
+                                       {'3', 'V', 'I', 'L'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // invalid
+    {-1, 1, 1, 0, 10, 1, 1},
+    {20, 5, 20, 0, 10, 1, 1},
+    {20, 20, 5, 0, 10, 1, 1},
+    {20, 20, 20, 10, 0, 1, 1},
+    {20, 20, 20, 0, 10, 10, 1},
+    {20, 20, 20, 0, 10, 1, 30},
+    // normal (valid) samples
+    {1, 1, 1, 0, 1000, 1, 1},
+    {12, 12, 15, 0, 1000, 3, 8},
+    {20, 30, 20, 1, 2, 1, 20},
+    {35, 35, 35, 1, 3, 30, 35},
+    {50, 60, 50, 1, 2, 1, 25}};
+
+Arguments sygvdx_hegvdx_setup_arguments(sygvdx_hegvdx_tuple tup)
+{
+    vector<int>  size = std::get<0>(tup);
+    vector<char> op   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+    arg.set<rocblas_int>("ldb", size[2]);
+
+    arg.set<char>("itype", op[0]);
+    arg.set<char>("jobz", op[1]);
+    arg.set<char>("range", op[2]);
+    arg.set<char>("uplo", op[3]);
+
+    // the interval and index bounds are only set when they are used
+    if(op[2] == 'V')
+    {
+        arg.set<double>("vl", size[3]);
+        arg.set<double>("vu", size[4]);
+    }
+    else if(op[2] == 'I')
+    {
+        arg.set<rocblas_int>("il", size[5]);
+        arg.set<rocblas_int>("iu", size[6]);
+    }
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYGVDX_HEGVDX : public ::TestWithParam<sygvdx_hegvdx_tuple>
+{
+protected:
+    SYGVDX_HEGVDX() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = sygvdx_hegvdx_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("itype") == '1'
+           && arg.peek<char>("jobz") == 'N' && arg.peek<char>("range") == 'A'
+           && arg.peek<char>("uplo") == 'L')
+            testing_sygvdx_hegvdx_bad_arg<false, T>();
+
+        arg.batch_count = 1;
+        testing_sygvdx_hegvdx<false, T>(arg);
+    }
+};
+
+class SYGVDX : public SYGVDX_HEGVDX
+{
+};
+
+class HEGVDX : public SYGVDX_HEGVDX
+{
+};
+
+// non-batch tests
+
+TEST_P(SYGVDX, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(SYGVDX, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(HEGVDX, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(HEGVDX, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SYGVDX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HEGVDX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
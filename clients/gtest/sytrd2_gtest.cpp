@@ -0,0 +1,300 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, hipsolverFillMode_t, hipsolverEigMode_t> sytrd2_tuple;
+
+// each size_range vector is a {n, lda}; the panel width is 32 from n = 33 on, so the larger sizes
+// take several panels and several blocks of sweeps
+const vector<vector<int>> sytrd2_size_range = {{1, 1}, {2, 3}, {5, 5}, {34, 40}, {100, 100}};
+
+const vector<hipsolverFillMode_t> sytrd2_uplo_range
+    = {HIPSOLVER_FILL_MODE_UPPER, HIPSOLVER_FILL_MODE_LOWER};
+
+const vector<hipsolverEigMode_t> sytrd2_jobz_range
+    = {HIPSOLVER_EIG_MODE_NOVECTOR, HIPSOLVER_EIG_MODE_VECTOR};
+
+class SYTRD2 : public ::TestWithParam<sytrd2_tuple>
+{
+protected:
+    SYTRD2() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// fills hA with random entries, and hS with the symmetric matrix given by the uplo triangle of hA
+static void sytrd2_init(host_strided_batch_vector<double>& hA,
+                        host_strided_batch_vector<double>& hS,
+                        hipsolverFillMode_t                uplo,
+                        int                                n,
+                        int                                lda)
+{
+    rocblas_init<double>(hA, true);
+    for(int i = 0; i < n; i++)
+        for(int j = 0; j < n; j++)
+        {
+            bool stored = uplo == HIPSOLVER_FILL_MODE_UPPER ? i <= j : i >= j;
+            hS[0][i + j * n] = stored ? hA[0][i + j * lda] : hA[0][j + i * lda];
+        }
+}
+
+TEST(SYTRD2_BAD_ARG, sytrd2)
+{
+    hipsolver_local_handle              handle;
+    hipsolverEigMode_t                  jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    hipsolverFillMode_t                 uplo = HIPSOLVER_FILL_MODE_LOWER;
+    int                                 n = 5, lda = 5, lw;
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dD(n, 1, n, 1);
+    device_strided_batch_vector<double> dE(n, 1, n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2_bufferSize(
+                              nullptr, jobz, uplo, n, dA.data(), lda, dD.data(), dE.data(), &lw),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2_bufferSize(handle,
+                                                      hipsolverEigMode_t(-1),
+                                                      uplo,
+                                                      n,
+                                                      dA.data(),
+                                                      lda,
+                                                      dD.data(),
+                                                      dE.data(),
+                                                      &lw),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2_bufferSize(handle,
+                                                      jobz,
+                                                      hipsolverFillMode_t(-1),
+                                                      n,
+                                                      dA.data(),
+                                                      lda,
+                                                      dD.data(),
+                                                      dE.data(),
+                                                      &lw),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2_bufferSize(
+                              handle, jobz, uplo, n, dA.data(), n - 1, dD.data(), dE.data(), &lw),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2_bufferSize(
+                              handle, jobz, uplo, n, dA.data(), lda, dD.data(), dE.data(), nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    CHECK_ROCBLAS_ERROR(hipsolverDsytrd2_bufferSize(
+        handle, jobz, uplo, n, dA.data(), lda, dD.data(), dE.data(), &lw));
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2(handle,
+                                           jobz,
+                                           uplo,
+                                           n,
+                                           dA.data(),
+                                           lda,
+                                           dD.data(),
+                                           dE.data(),
+                                           dWork.data(),
+                                           lw - 1,
+                                           dinfo.data()),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2(handle,
+                                           jobz,
+                                           uplo,
+                                           n,
+                                           dA.data(),
+                                           lda,
+                                           dD.data(),
+                                           nullptr,
+                                           dWork.data(),
+                                           lw,
+                                           dinfo.data()),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsytrd2(handle,
+                                           jobz,
+                                           uplo,
+                                           n,
+                                           dA.data(),
+                                           lda,
+                                           dD.data(),
+                                           dE.data(),
+                                           dWork.data(),
+                                           lw,
+                                           nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+// with the vectors, A must be reconstructed as Q * T * Q^T from an orthogonal Q; without them, A
+// is left unchanged and T must keep the trace and the Frobenius norm of A
+TEST_P(SYTRD2, sytrd2)
+{
+    vector<int>         size = std::get<0>(GetParam());
+    hipsolverFillMode_t uplo = std::get<1>(GetParam());
+    hipsolverEigMode_t  jobz = std::get<2>(GetParam());
+    int                 n = size[0], lda = size[1], lw;
+
+    hipsolver_local_handle              handle;
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hS(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hSRes(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hI(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hIRes(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hD(n, 1, n, 1);
+    host_strided_batch_vector<double>   hE(n, 1, n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dD(n, 1, n, 1);
+    device_strided_batch_vector<double> dE(n, 1, n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    sytrd2_init(hA, hS, uplo, n, lda);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(hipsolverDsytrd2_bufferSize(
+        handle, jobz, uplo, n, dA.data(), lda, dD.data(), dE.data(), &lw));
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_ROCBLAS_ERROR(hipsolverDsytrd2(handle,
+                                         jobz,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         dD.data(),
+                                         dE.data(),
+                                         dWork.data(),
+                                         lw,
+                                         dinfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hD.transfer_from(dD));
+    CHECK_HIP_ERROR(hE.transfer_from(dE));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    EXPECT_EQ(hinfo[0][0], 0);
+
+    if(jobz == HIPSOLVER_EIG_MODE_NOVECTOR)
+    {
+        double trace = 0, traceRes = 0, norm = 0, normRes = 0;
+        for(int i = 0; i < n; i++)
+        {
+            trace += hS[0][i + i * n];
+            traceRes += hD[0][i];
+            normRes += hD[0][i] * hD[0][i] + (i < n - 1 ? 2 * hE[0][i] * hE[0][i] : 0);
+            for(int j = 0; j < n; j++)
+                norm += hS[0][i + j * n] * hS[0][i + j * n];
+        }
+
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', lda, n, lda, hA[0], hARes[0]), 0);
+        ROCSOLVER_TEST_CHECK(double, fabs(trace - traceRes) / max(sqrt(norm), 1.0), n);
+        ROCSOLVER_TEST_CHECK(double, fabs(norm - normRes) / max(norm, 1.0), n);
+        return;
+    }
+
+    // Q * T * Q^T and Q^T * Q
+    for(int i = 0; i < n; i++)
+        for(int j = 0; j < n; j++)
+        {
+            double sum = 0, dot = 0;
+            for(int k = 0; k < n; k++)
+            {
+                double tq = hD[0][k] * hARes[0][j + k * lda];
+                if(k > 0)
+                    tq += hE[0][k - 1] * hARes[0][j + (k - 1) * lda];
+                if(k < n - 1)
+                    tq += hE[0][k] * hARes[0][j + (k + 1) * lda];
+                sum += hARes[0][i + k * lda] * tq;
+                dot += hARes[0][k + i * lda] * hARes[0][k + j * lda];
+            }
+            hSRes[0][i + j * n] = sum;
+            hI[0][i + j * n]    = i == j ? 1 : 0;
+            hIRes[0][i + j * n] = dot;
+        }
+
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hS[0], hSRes[0]), n);
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hI[0], hIRes[0]), n);
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+// the two-stage syevd selected by HIPSOLVER_ALG_1 must give the eigenvalues of the default
+// algorithm, and eigenvectors V with A * V = V * diag(D)
+TEST_P(SYTRD2, syevd)
+{
+    vector<int>         size = std::get<0>(GetParam());
+    hipsolverFillMode_t uplo = std::get<1>(GetParam());
+    hipsolverEigMode_t  jobz = std::get<2>(GetParam());
+    int                 n = size[0], lda = size[1], lw;
+
+    hipsolver_local_handle handle, two_stage;
+    CHECK_ROCBLAS_ERROR(hipsolverSetAdvOptions(
+        two_stage, HIPSOLVERDN_SYEVD, HIPSOLVER_ADV_ALGORITHM, HIPSOLVER_ALG_1));
+
+    host_strided_batch_vector<double>   hA(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hARes(lda * n, 1, lda * n, 1);
+    host_strided_batch_vector<double>   hS(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hAV(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hVD(n * n, 1, n * n, 1);
+    host_strided_batch_vector<double>   hD(n, 1, n, 1);
+    host_strided_batch_vector<double>   hDRes(n, 1, n, 1);
+    host_strided_batch_vector<int>      hinfo(1, 1, 1, 1);
+    device_strided_batch_vector<double> dA(lda * n, 1, lda * n, 1);
+    device_strided_batch_vector<double> dD(n, 1, n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    sytrd2_init(hA, hS, uplo, n, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd(
+        handle, jobz, uplo, n, dA.data(), lda, dD.data(), nullptr, 0, dinfo.data()));
+    CHECK_HIP_ERROR(hD.transfer_from(dD));
+
+    CHECK_ROCBLAS_ERROR(
+        hipsolverDsyevd_bufferSize(two_stage, jobz, uplo, n, dA.data(), lda, dD.data(), &lw));
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(hipsolverDsyevd(
+        two_stage, jobz, uplo, n, dA.data(), lda, dD.data(), dWork.data(), lw, dinfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    EXPECT_EQ(hinfo[0][0], 0);
+
+    ROCSOLVER_TEST_CHECK(double, norm_error('F', n, 1, n, hD[0], hDRes[0]), n);
+
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+    {
+        for(int i = 0; i < n; i++)
+            for(int j = 0; j < n; j++)
+            {
+                double sum = 0;
+                for(int k = 0; k < n; k++)
+                    sum += hS[0][i + k * n] * hARes[0][k + j * lda];
+                hAV[0][i + j * n] = sum;
+                hVD[0][i + j * n] = hARes[0][i + j * lda] * hDRes[0][j];
+            }
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, n, hAV[0], hVD[0]), n);
+    }
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYTRD2,
+                         Combine(ValuesIn(sytrd2_size_range),
+                                 ValuesIn(sytrd2_uplo_range),
+                                 ValuesIn(sytrd2_jobz_range)));
@@ -73,7 +73,7 @@ protected:
         if(arg.peek<char>("uplo") == 'U' && arg.peek<rocblas_int>("n") == -1)
             testing_sytrd_hetrd_bad_arg<FORTRAN, BATCHED, STRIDED, T>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (BATCHED || STRIDED) ? 3 : 1;
         testing_sytrd_hetrd<FORTRAN, BATCHED, STRIDED, T>(arg);
     }
 };
@@ -136,6 +136,90 @@ TEST_P(HETRD_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// batched tests
+
+TEST_P(SYTRD, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(SYTRD, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(SYTRD_FORTRAN, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(SYTRD_FORTRAN, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(HETRD, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(HETRD, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(HETRD_FORTRAN, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(HETRD_FORTRAN, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYTRD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYTRD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(SYTRD_FORTRAN, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYTRD_FORTRAN, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HETRD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HETRD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(HETRD_FORTRAN, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HETRD_FORTRAN, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          SYTRD,
 //                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
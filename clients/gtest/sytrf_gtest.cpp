@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sytrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> sytrf_tuple;
+
+// each size_range vector is a {N, lda}
+
+// each uplo_range is a {uplo}
+
+// case when n = -1 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1},
+    {10, 2},
+    // normal (valid) samples
+    {10, 10},
+    {20, 30},
+    {50, 50},
+    {70, 80}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range = {
+//     {192, 192},
+//     {640, 960},
+//     {1000, 1000},
+//     {1024, 1024},
+//     {2000, 2000},
+// };
+
+Arguments sytrf_setup_arguments(sytrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        uplo        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.set<char>("uplo", uplo);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYTRF : public ::TestWithParam<sytrf_tuple>
+{
+protected:
+    SYTRF() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = sytrf_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<int>("n") == -1)
+            testing_sytrf_bad_arg<false, T>();
+
+        testing_sytrf<false, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(SYTRF, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(SYTRF, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(SYTRF, __float_complex)
+{
+    run_tests<hipsolverComplex>();
+}
+
+TEST_P(SYTRF, __double_complex)
+{
+    run_tests<hipsolverDoubleComplex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SYTRF,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYTRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
@@ -0,0 +1,304 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is the orders of the matrices of a batch; the leading dimension of each
+// matrix is its order plus one
+const vector<vector<int>> vbatched_size_range
+    = {{1}, {4, 4, 4}, {4, 7, 4, 4, 7, 1, 0, 4}, {64, 8, 100, 8, 64, 33}};
+
+const int vbatched_nrhs = 3;
+
+class VBATCHED : public ::TestWithParam<vector<int>>
+{
+protected:
+    VBATCHED() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// generates well conditioned symmetric positive definite matrices of orders n, or general
+// matrices, with zeros past their orders
+static void vbatched_init(host_batch_vector<double>& hA, const vector<int>& n, bool spd)
+{
+    rocblas_init<double>(hA, true);
+    for(size_t b = 0; b < n.size(); b++)
+    {
+        int nb = n[b], lda = nb + 1;
+        for(int j = 0; j < nb; j++)
+        {
+            for(int i = 0; i < j && spd; i++)
+                hA[b][j + i * lda] = hA[b][i + j * lda];
+            hA[b][j + j * lda] += spd ? 400 : 20;
+            hA[b][nb + j * lda] = 0;
+        }
+    }
+}
+
+// copies the sizes of a batch to the device
+static void vbatched_upload(device_strided_batch_vector<int>& d, const vector<int>& h)
+{
+    CHECK_HIP_ERROR(d.memcheck());
+    CHECK_HIP_ERROR(hipMemcpy(d.data(), h.data(), sizeof(int) * h.size(), hipMemcpyHostToDevice));
+}
+
+TEST(VBATCHED_BAD_ARG, potrfVbatched)
+{
+    hipsolver_local_handle           handle;
+    hipsolverFillMode_t              uplo = HIPSOLVER_FILL_MODE_LOWER;
+    vector<int>                      n    = {5, 5};
+    vector<int>                      lda  = {5, 4};
+    device_strided_batch_vector<int> dn(2, 1, 2, 1);
+    device_strided_batch_vector<int> dlda(2, 1, 2, 1);
+    device_strided_batch_vector<int> dinfo(2, 1, 2, 1);
+    host_strided_batch_vector<int>   hinfo(2, 1, 2, 1);
+    device_batch_vector<double>      dA(100, 1, 2);
+    int                              lw;
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    vbatched_upload(dn, n);
+    vbatched_upload(dlda, lda);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched_bufferSize(
+                              nullptr, uplo, dn.data(), dA.data(), dlda.data(), &lw, 1),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched_bufferSize(
+                              handle, uplo, dn.data(), dA.data(), dlda.data(), &lw, -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfVbatched_bufferSize(handle, uplo, nullptr, dA.data(), dlda.data(), &lw, 1),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched_bufferSize(
+                              handle, uplo, dn.data(), dA.data(), dlda.data(), nullptr, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched_bufferSize(
+                              handle, uplo, dn.data(), dA.data(), dlda.data(), &lw, 2),
+                          HIPSOLVER_STATUS_SUCCESS);
+    device_strided_batch_vector<double> dWork(max(lw, 1), 1, max(lw, 1), 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched(handle,
+                                                  uplo,
+                                                  dn.data(),
+                                                  nullptr,
+                                                  dlda.data(),
+                                                  dWork.data(),
+                                                  lw,
+                                                  dinfo.data(),
+                                                  1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the leading dimension of the second matrix is smaller than its order, which is reported by
+    // its info
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched(handle,
+                                                  uplo,
+                                                  dn.data(),
+                                                  dA.data(),
+                                                  dlda.data(),
+                                                  dWork.data(),
+                                                  lw,
+                                                  dinfo.data(),
+                                                  2),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    EXPECT_EQ(hinfo[0][1], -4);
+
+    // quick return
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfVbatched(handle, uplo, nullptr, nullptr, nullptr, nullptr, 0, nullptr, 0),
+        HIPSOLVER_STATUS_SUCCESS);
+}
+
+// every matrix must be factorized as by potrf
+TEST_P(VBATCHED, potrfVbatched)
+{
+    vector<int> n  = GetParam();
+    int         bc = n.size(), nmax = *max_element(n.begin(), n.end()), size = (nmax + 1) * nmax;
+    vector<int> lda(bc);
+    for(int b = 0; b < bc; b++)
+        lda[b] = n[b] + 1;
+
+    device_strided_batch_vector<int> dn(bc, 1, bc, 1);
+    device_strided_batch_vector<int> dlda(bc, 1, bc, 1);
+    vbatched_upload(dn, n);
+    vbatched_upload(dlda, lda);
+
+    for(hipsolverFillMode_t uplo : {HIPSOLVER_FILL_MODE_LOWER, HIPSOLVER_FILL_MODE_UPPER})
+    {
+        hipsolver_local_handle              handle;
+        host_batch_vector<double>           hA(max(size, 1), 1, bc);
+        host_batch_vector<double>           hRes(max(size, 1), 1, bc);
+        host_strided_batch_vector<double>   hB(max(size, 1), 1, max(size, 1), 1);
+        host_strided_batch_vector<int>      hinfo(bc, 1, bc, 1);
+        device_batch_vector<double>         dA(max(size, 1), 1, bc);
+        device_strided_batch_vector<double> dB(max(size, 1), 1, max(size, 1), 1);
+        device_strided_batch_vector<int>    dinfo(bc, 1, bc, 1);
+        int                                 lw;
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        vbatched_init(hA, n, true);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched_bufferSize(
+                                  handle, uplo, dn.data(), dA.data(), dlda.data(), &lw, bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        device_strided_batch_vector<double> dWork(max(lw, 1), 1, max(lw, 1), 1);
+        CHECK_HIP_ERROR(dWork.memcheck());
+        EXPECT_ROCBLAS_STATUS(hipsolverDpotrfVbatched(handle,
+                                                      uplo,
+                                                      dn.data(),
+                                                      dA.data(),
+                                                      dlda.data(),
+                                                      dWork.data(),
+                                                      lw,
+                                                      dinfo.data(),
+                                                      bc),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+
+        for(int b = 0; b < bc; b++)
+        {
+            int lwb;
+            EXPECT_EQ(hinfo[0][b], 0);
+            EXPECT_ROCBLAS_STATUS(
+                hipsolverDpotrf_bufferSize(handle, uplo, n[b], dB.data(), lda[b], &lwb),
+                HIPSOLVER_STATUS_SUCCESS);
+            device_strided_batch_vector<double> dWorkb(max(lwb, 1), 1, max(lwb, 1), 1);
+            CHECK_HIP_ERROR(dWorkb.memcheck());
+
+            for(int i = 0; i < size; i++)
+                hB[0][i] = hA[b][i];
+            CHECK_HIP_ERROR(dB.transfer_from(hB));
+            EXPECT_ROCBLAS_STATUS(
+                hipsolverDpotrf(
+                    handle, uplo, n[b], dB.data(), lda[b], dWorkb.data(), lwb, dinfo.data()),
+                HIPSOLVER_STATUS_SUCCESS);
+            CHECK_HIP_ERROR(hB.transfer_from(dB));
+            ROCSOLVER_TEST_CHECK(
+                double, norm_error('F', n[b], n[b], lda[b], hB[0], hRes[b]), max(n[b], 1));
+        }
+    }
+}
+
+// the systems solved with the factors of getrf_vbatched must match their known solutions
+TEST_P(VBATCHED, getrfVbatched_getrsVbatched)
+{
+    vector<int> n  = GetParam();
+    int         bc = n.size(), nmax = *max_element(n.begin(), n.end());
+    int         size = (nmax + 1) * nmax, bsize = max(nmax, 1) * vbatched_nrhs, npiv = 0;
+    vector<int> nrhs(bc, vbatched_nrhs), lda(bc), ldb(bc);
+    for(int b = 0; b < bc; b++)
+    {
+        lda[b] = n[b] + 1;
+        ldb[b] = max(n[b], 1);
+        npiv += n[b];
+    }
+
+    device_strided_batch_vector<int> dn(bc, 1, bc, 1);
+    device_strided_batch_vector<int> dnrhs(bc, 1, bc, 1);
+    device_strided_batch_vector<int> dlda(bc, 1, bc, 1);
+    device_strided_batch_vector<int> dldb(bc, 1, bc, 1);
+    vbatched_upload(dn, n);
+    vbatched_upload(dnrhs, nrhs);
+    vbatched_upload(dlda, lda);
+    vbatched_upload(dldb, ldb);
+
+    hipsolver_local_handle           handle;
+    host_batch_vector<double>        hA(max(size, 1), 1, bc);
+    host_batch_vector<double>        hX(bsize, 1, bc);
+    host_batch_vector<double>        hB(bsize, 1, bc);
+    host_strided_batch_vector<int>   hinfo(bc, 1, bc, 1);
+    device_batch_vector<double>      dA(max(size, 1), 1, bc);
+    device_batch_vector<double>      dB(bsize, 1, bc);
+    device_strided_batch_vector<int> dipiv(max(npiv, 1), 1, max(npiv, 1), 1);
+    device_strided_batch_vector<int> dinfo(bc, 1, bc, 1);
+    int                              lwf, lws;
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dipiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    vbatched_init(hA, n, false);
+    rocblas_init<double>(hX, false);
+
+    // B = A * X
+    for(int b = 0; b < bc; b++)
+    {
+        for(int k = 0; k < vbatched_nrhs; k++)
+        {
+            for(int i = 0; i < n[b]; i++)
+            {
+                double sum = 0;
+                for(int j = 0; j < n[b]; j++)
+                    sum += hA[b][i + j * lda[b]] * hX[b][j + k * ldb[b]];
+                hB[b][i + k * ldb[b]] = sum;
+            }
+        }
+    }
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDgetrfVbatched_bufferSize(handle, dn.data(), dA.data(), dlda.data(), &lwf, bc),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrsVbatched_bufferSize(handle,
+                                                             HIPSOLVER_OP_N,
+                                                             dn.data(),
+                                                             dnrhs.data(),
+                                                             dA.data(),
+                                                             dlda.data(),
+                                                             dipiv.data(),
+                                                             dB.data(),
+                                                             dldb.data(),
+                                                             &lws,
+                                                             bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    int                                 lw = max(max(lwf, lws), 1);
+    device_strided_batch_vector<double> dWork(lw, 1, lw, 1);
+    CHECK_HIP_ERROR(dWork.memcheck());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrfVbatched(handle,
+                                                  dn.data(),
+                                                  dA.data(),
+                                                  dlda.data(),
+                                                  dWork.data(),
+                                                  lwf,
+                                                  dipiv.data(),
+                                                  dinfo.data(),
+                                                  bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+    for(int b = 0; b < bc; b++)
+        EXPECT_EQ(hinfo[0][b], 0);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrsVbatched(handle,
+                                                  HIPSOLVER_OP_N,
+                                                  dn.data(),
+                                                  dnrhs.data(),
+                                                  dA.data(),
+                                                  dlda.data(),
+                                                  dipiv.data(),
+                                                  dB.data(),
+                                                  dldb.data(),
+                                                  dWork.data(),
+                                                  lws,
+                                                  dinfo.data(),
+                                                  bc),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+    for(int b = 0; b < bc; b++)
+        ROCSOLVER_TEST_CHECK(double,
+                             norm_error('I', n[b], vbatched_nrhs, ldb[b], hX[b], hB[b]),
+                             max(n[b], 1));
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, VBATCHED, ValuesIn(vbatched_size_range));
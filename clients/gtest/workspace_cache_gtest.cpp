@@ -0,0 +1,374 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+// each size_range vector is a {M, N, lda}
+const vector<vector<int>> cache_size_range = {{10, 10, 10}, {20, 30, 20}, {50, 50, 60}};
+
+class WORKSPACE_CACHE : public ::TestWithParam<vector<int>>
+{
+protected:
+    WORKSPACE_CACHE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST(WORKSPACE_CACHE_MODE, bad_arg)
+{
+    hipsolver_local_handle        handle;
+    hipsolverWorkspaceCacheMode_t mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceCacheMode(nullptr, HIPSOLVER_WORKSPACE_CACHE_ON),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheMode(nullptr, &mode),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverClearWorkspaceCache(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheMode(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetWorkspaceCacheMode(handle, hipsolverWorkspaceCacheMode_t(-1)),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+}
+
+TEST(WORKSPACE_CACHE_MODE, set_get)
+{
+    hipsolver_local_handle        handle;
+    hipsolverWorkspaceCacheMode_t mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceCacheMode(handle, HIPSOLVER_WORKSPACE_CACHE_OFF),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_WORKSPACE_CACHE_OFF);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceCacheMode(handle, HIPSOLVER_WORKSPACE_CACHE_ON),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverClearWorkspaceCache(handle), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST(WORKSPACE_ARENA, reserve)
+{
+    hipsolver_local_handle handle;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(nullptr, 1024),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 1 << 20), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 1024), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST(WORKSPACE_ARENA, alloc_mode)
+{
+    hipsolver_local_handle        handle;
+    hipsolverWorkspaceAllocMode_t mode;
+    hipMemPool_t                  pool;
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetWorkspaceAllocMode(nullptr, HIPSOLVER_WORKSPACE_ALLOC_STREAM_ORDERED),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceAllocMode(nullptr, &mode),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceMemPool(nullptr, nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceMemPool(nullptr, &pool),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceAllocMode(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceMemPool(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetWorkspaceAllocMode(handle, hipsolverWorkspaceAllocMode_t(-1)),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceAllocMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_WORKSPACE_ALLOC_DEFAULT);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceMemPool(handle, &pool), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool, nullptr);
+}
+
+// the arena grows in stream order, from the default pool of the device or from a given one
+TEST(WORKSPACE_ARENA, stream_ordered)
+{
+    hipsolver_local_handle        handle;
+    hipsolverWorkspaceAllocMode_t mode;
+    hipMemPool_t                  pool, pool_res;
+    hipStream_t                   stream;
+    int                           device;
+
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(hipDeviceGetDefaultMemPool(&pool, device));
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, stream));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 1024), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverSetWorkspaceAllocMode(handle, HIPSOLVER_WORKSPACE_ALLOC_STREAM_ORDERED),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 1 << 20), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceMemPool(handle, pool), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 1 << 20), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 1 << 22), HIPSOLVER_STATUS_SUCCESS);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceAllocMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_WORKSPACE_ALLOC_STREAM_ORDERED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceMemPool(handle, &pool_res),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(pool_res, pool);
+#endif
+
+    // the arena is moved back to hipMalloc
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceAllocMode(handle, HIPSOLVER_WORKSPACE_ALLOC_DEFAULT),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, 1024), HIPSOLVER_STATUS_SUCCESS);
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+TEST(WORKSPACE_STATS, bad_arg)
+{
+    hipsolver_local_handle      handle;
+    hipsolverWorkspaceStats_t   stats;
+    hipsolverRoutineWorkspace_t routine;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceStats(nullptr, &stats),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceRoutineStats(nullptr, &routine, 1),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverResetWorkspaceStats(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceGrowthCallback(nullptr, nullptr, nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceStats(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceRoutineStats(handle, nullptr, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceRoutineStats(handle, &routine, -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceRoutineStats(handle, nullptr, 0),
+                          HIPSOLVER_STATUS_SUCCESS);
+}
+
+struct workspace_growth
+{
+    int    calls = 0;
+    size_t size  = 0;
+};
+
+static void workspace_growth_callback(
+    hipsolverHandle_t, const char*, size_t old_size, size_t new_size, void* user_data)
+{
+    workspace_growth* growth = (workspace_growth*)user_data;
+    EXPECT_LT(old_size, new_size);
+    growth->calls++;
+    growth->size = new_size;
+}
+
+// getrf called without a work array takes its workspace from the handle
+TEST(WORKSPACE_STATS, getrf)
+{
+    int n = 100;
+
+    hipsolver_local_handle              handle;
+    hipsolverWorkspaceStats_t           stats;
+    workspace_growth                    growth;
+    host_strided_batch_vector<double>   hA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<double> dA(n * n, 1, n * n, 1);
+    device_strided_batch_vector<int>    dIpiv(n, 1, n, 1);
+    device_strided_batch_vector<int>    dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    rocblas_init<double>(hA, true);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_ROCBLAS_ERROR(
+        hipsolverSetWorkspaceGrowthCallback(handle, workspace_growth_callback, &growth));
+    CHECK_ROCBLAS_ERROR(hipsolverDgetrf(
+        handle, n, n, dA.data(), n, nullptr, 0, dIpiv.data(), dinfo.data()));
+    CHECK_ROCBLAS_ERROR(hipsolverGetWorkspaceStats(handle, &stats));
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    EXPECT_EQ(stats.routine_count, 1);
+    EXPECT_LE(stats.peak_request, stats.current_size);
+    EXPECT_EQ(stats.peak_size, stats.current_size);
+    EXPECT_EQ(stats.growth_count, growth.calls);
+    if(growth.calls > 0)
+        EXPECT_EQ(growth.size, stats.current_size);
+
+    hipsolverRoutineWorkspace_t routines[2];
+    CHECK_ROCBLAS_ERROR(hipsolverGetWorkspaceRoutineStats(handle, routines, 2));
+    EXPECT_STREQ(routines[0].routine, "hipsolverDgetrf");
+    EXPECT_EQ(routines[0].peak_request, stats.peak_request);
+    EXPECT_EQ(routines[0].calls, 1);
+
+    // reserving the peak request does not grow the workspace again
+    int calls = growth.calls;
+    CHECK_ROCBLAS_ERROR(hipsolverResetWorkspaceStats(handle));
+    CHECK_ROCBLAS_ERROR(hipsolverReserveWorkspace(handle, stats.peak_request));
+    CHECK_ROCBLAS_ERROR(hipsolverGetWorkspaceStats(handle, &stats));
+    EXPECT_EQ(stats.routine_count, 0);
+    EXPECT_EQ(stats.growth_count, 0);
+    EXPECT_EQ(growth.calls, calls);
+#else
+    EXPECT_EQ(stats.current_size, 0);
+    EXPECT_EQ(stats.routine_count, 0);
+    EXPECT_EQ(growth.calls, 0);
+#endif
+
+    CHECK_ROCBLAS_ERROR(hipsolverSetWorkspaceGrowthCallback(handle, nullptr, nullptr));
+}
+
+// the cached workspace size must match the size reported with the cache disabled
+TEST_P(WORKSPACE_CACHE, getrf)
+{
+    vector<int> size = GetParam();
+    int         m = size[0], n = size[1], lda = size[2];
+
+    hipsolver_local_handle handle;
+    int                    lwork_ref, lwork1, lwork2, lwork3;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceCacheMode(handle, HIPSOLVER_WORKSPACE_CACHE_OFF),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, m, n, nullptr, lda, &lwork_ref),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetWorkspaceCacheMode(handle, HIPSOLVER_WORKSPACE_CACHE_ON),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, m, n, nullptr, lda, &lwork1),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, m, n, nullptr, lda, &lwork2),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverClearWorkspaceCache(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, m, n, nullptr, lda, &lwork3),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_EQ(lwork1, lwork_ref);
+    EXPECT_EQ(lwork2, lwork_ref);
+    EXPECT_EQ(lwork3, lwork_ref);
+}
+
+TEST(BATCH_CHUNK, bad_arg)
+{
+    hipsolver_local_handle handle;
+    size_t                 bytes;
+    int                    chunk;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetBatchWorkspaceLimit(nullptr, 1024),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchWorkspaceLimit(nullptr, &bytes),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchChunkSize(nullptr, &chunk),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchWorkspaceLimit(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchChunkSize(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchWorkspaceLimit(handle, &bytes),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(bytes, size_t(0));
+    EXPECT_ROCBLAS_STATUS(hipsolverSetBatchWorkspaceLimit(handle, 1 << 20),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchWorkspaceLimit(handle, &bytes),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(bytes, size_t(1 << 20));
+}
+
+// a batch solved in chunks under a workspace limit must give the results of a single call
+TEST_P(WORKSPACE_CACHE, potrfBatched_chunks)
+{
+    vector<int>         size = GetParam();
+    int                 n = size[0], lda = size[2];
+    int                 bc   = 64;
+    hipsolverFillMode_t uplo = HIPSOLVER_FILL_MODE_LOWER;
+
+    host_batch_vector<double> hA(size_t(lda) * n, 1, bc);
+    host_batch_vector<double> hARes(size_t(lda) * n, 1, bc);
+    host_batch_vector<double> hAChunk(size_t(lda) * n, 1, bc);
+    rocblas_init<double>(hA, true);
+    for(int b = 0; b < bc; b++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < i; j++)
+                hA[b][j + i * lda] = hA[b][i + j * lda];
+            hA[b][i + i * lda] += 400;
+        }
+    }
+
+    hipsolver_local_handle handle;
+    int                    lw_one, lw_all, chunk;
+    size_t                 limit = 0;
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfBatched_bufferSize(handle, uplo, n, nullptr, lda, &lw_one, 1),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDpotrfBatched_bufferSize(handle, uplo, n, nullptr, lda, &lw_all, bc),
+        HIPSOLVER_STATUS_SUCCESS);
+
+    for(bool chunked : {false, true})
+    {
+        // the limit admits about a quarter of the batch
+        if(chunked)
+            limit = max(size_t(lw_one), size_t(lw_all) / 4);
+        EXPECT_ROCBLAS_STATUS(hipsolverSetBatchWorkspaceLimit(handle, limit),
+                              HIPSOLVER_STATUS_SUCCESS);
+
+        device_batch_vector<double>      dA(size_t(lda) * n, 1, bc);
+        device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hinfo(1, 1, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        int lw;
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfBatched_bufferSize(handle, uplo, n, dA.data(), lda, &lw, bc),
+            HIPSOLVER_STATUS_SUCCESS);
+        if(chunked && size_t(lw_one) <= limit)
+            EXPECT_LE(size_t(lw), limit);
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDpotrfBatched(handle, uplo, n, dA.data(), lda, nullptr, 0, dinfo.data(), bc),
+            HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverGetBatchChunkSize(handle, &chunk),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_GE(chunk, 1);
+        EXPECT_LE(chunk, bc);
+        if(!chunked)
+            EXPECT_EQ(chunk, bc);
+
+        host_batch_vector<double>& hRes = chunked ? hAChunk : hARes;
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hinfo.transfer_from(dinfo));
+        for(int b = 0; b < bc; b++)
+            EXPECT_EQ(hinfo[b][0], 0);
+    }
+
+    // only the lower triangle is referenced
+    for(int b = 0; b < bc; b++)
+    {
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < j; i++)
+                hARes[b][i + j * lda] = hAChunk[b][i + j * lda] = 0;
+        ROCSOLVER_TEST_CHECK(double, norm_error('F', n, n, lda, hARes[b], hAChunk[b]), n);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, WORKSPACE_CACHE, ValuesIn(cache_size_range));
@@ -9,7 +9,9 @@
 #include "../rocsolvercommon/rocsolver_arguments.hpp"
 #include "../rocsolvercommon/rocsolver_test.hpp"
 
+#include "device_norm.hpp"
 #include "hipsolver.hpp"
+#include "hipsolver_bench_report.hpp"
 #include "lapack_host_reference.hpp"
 
 using namespace std;
@@ -0,0 +1,263 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "utility.hpp"
+
+/*!\file
+ * \brief device-side verification: residuals of the results left in device memory are computed
+ * with rocBLAS (AMD) or cuBLAS (NVIDIA) kernels, and only the resulting norms are copied back.
+ */
+
+/*! \brief  BLAS handle that is automatically created and destroyed, and that runs on the
+ *          stream of the given hipSOLVER handle */
+class device_blas_handle
+{
+    void*       m_handle;
+    hipStream_t m_stream;
+
+public:
+    explicit device_blas_handle(hipsolverHandle_t handle);
+    ~device_blas_handle();
+
+    device_blas_handle(const device_blas_handle&) = delete;
+    device_blas_handle& operator=(const device_blas_handle&) = delete;
+
+    void* get() const
+    {
+        return m_handle;
+    }
+
+    hipStream_t stream() const
+    {
+        return m_stream;
+    }
+};
+
+// BLAS
+
+// C = alpha * op(A) + beta * B
+template <typename T>
+hipsolverStatus_t device_geam(const device_blas_handle& blas,
+                              hipsolverOperation_t      transA,
+                              int                       m,
+                              int                       n,
+                              T                         alpha,
+                              const T*                  A,
+                              int                       lda,
+                              T                         beta,
+                              const T*                  B,
+                              int                       ldb,
+                              T*                        C,
+                              int                       ldc);
+
+// B = alpha * op(A) * B or B = alpha * B * op(A), with A triangular
+template <typename T>
+hipsolverStatus_t device_trmm(const device_blas_handle& blas,
+                              hipsolverSideMode_t       side,
+                              hipsolverFillMode_t       uplo,
+                              hipsolverOperation_t      transA,
+                              bool                      unit_diag,
+                              int                       m,
+                              int                       n,
+                              T                         alpha,
+                              const T*                  A,
+                              int                       lda,
+                              T*                        B,
+                              int                       ldb);
+
+template <typename T>
+hipsolverStatus_t device_symm_hemm(const device_blas_handle& blas,
+                                   hipsolverSideMode_t       side,
+                                   hipsolverFillMode_t       uplo,
+                                   int                       m,
+                                   int                       n,
+                                   T                         alpha,
+                                   const T*                  A,
+                                   int                       lda,
+                                   const T*                  B,
+                                   int                       ldb,
+                                   T                         beta,
+                                   T*                        C,
+                                   int                       ldc);
+
+template <typename T>
+hipsolverStatus_t device_axpy(
+    const device_blas_handle& blas, int n, T alpha, const T* x, int incx, T* y, int incy);
+
+template <typename T>
+hipsolverStatus_t
+    device_swap(const device_blas_handle& blas, int n, T* x, int incx, T* y, int incy);
+
+// the norm is returned to the host
+template <typename T>
+hipsolverStatus_t
+    device_nrm2(const device_blas_handle& blas, int n, const T* x, int incx, double* result);
+
+// Residuals
+
+/*! \brief  sets the n-by-n matrix A to the identity */
+template <typename T>
+void device_set_identity(const device_blas_handle& blas, int n, T* A, int lda)
+{
+    std::vector<T> ones(n, T(1));
+
+    CHECK_HIP_ERROR(hipMemset2DAsync(A, lda * sizeof(T), 0, n * sizeof(T), n, blas.stream()));
+    CHECK_HIP_ERROR(hipMemcpy2DAsync(A,
+                                     (lda + 1) * sizeof(T),
+                                     ones.data(),
+                                     sizeof(T),
+                                     sizeof(T),
+                                     n,
+                                     hipMemcpyHostToDevice,
+                                     blas.stream()));
+    CHECK_HIP_ERROR(hipStreamSynchronize(blas.stream()));
+}
+
+/*! \brief  relative residual ||A - L*L'|| / ||A|| (or ||A - U'*U|| / ||A||) of the Cholesky factor
+ *          left by potrf in the uplo triangle of F, using frobenius norm. Work must hold n*n
+ *          elements. */
+template <typename T>
+void device_potrf_residual(const device_blas_handle& blas,
+                           hipsolverFillMode_t       uplo,
+                           int                       n,
+                           const T*                  A,
+                           int                       lda,
+                           const T*                  F,
+                           int                       ldf,
+                           T*                        work,
+                           double*                   err)
+{
+    double normA, normR;
+
+    CHECK_ROCBLAS_ERROR(
+        device_geam<T>(blas, HIPSOLVER_OP_N, n, n, T(1), A, lda, T(0), A, lda, work, n));
+    CHECK_ROCBLAS_ERROR(device_nrm2<T>(blas, n * n, work, 1, &normA));
+
+    // rebuild the factored matrix from the identity with two triangular products
+    device_set_identity<T>(blas, n, work, n);
+    if(uplo == HIPSOLVER_FILL_MODE_UPPER)
+    {
+        CHECK_ROCBLAS_ERROR(device_trmm<T>(
+            blas, HIPSOLVER_SIDE_LEFT, uplo, HIPSOLVER_OP_N, false, n, n, T(1), F, ldf, work, n));
+        CHECK_ROCBLAS_ERROR(device_trmm<T>(
+            blas, HIPSOLVER_SIDE_LEFT, uplo, HIPSOLVER_OP_C, false, n, n, T(1), F, ldf, work, n));
+    }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(device_trmm<T>(
+            blas, HIPSOLVER_SIDE_LEFT, uplo, HIPSOLVER_OP_C, false, n, n, T(1), F, ldf, work, n));
+        CHECK_ROCBLAS_ERROR(device_trmm<T>(
+            blas, HIPSOLVER_SIDE_LEFT, uplo, HIPSOLVER_OP_N, false, n, n, T(1), F, ldf, work, n));
+    }
+
+    CHECK_ROCBLAS_ERROR(
+        device_geam<T>(blas, HIPSOLVER_OP_N, n, n, T(1), A, lda, T(-1), work, n, work, n));
+    CHECK_ROCBLAS_ERROR(device_nrm2<T>(blas, n * n, work, 1, &normR));
+
+    *err = normA > 0 ? normR / normA : normR;
+}
+
+/*! \brief  relative residual ||P*A - L*U|| / ||A|| of the LU factorization of the n-by-n matrix
+ *          A left by getrf in F, using frobenius norm. The 1-based pivot indices hIpiv are read on
+ *          the host; they are null when the factorization has no pivoting. Work must hold 2*n*n
+ *          elements. */
+template <typename T>
+void device_getrf_residual(const device_blas_handle& blas,
+                           int                       n,
+                           const T*                  A,
+                           int                       lda,
+                           const T*                  F,
+                           int                       ldf,
+                           const int*                hIpiv,
+                           T*                        work,
+                           double*                   err)
+{
+    double normA, normR;
+    T*     PA = work;
+    T*     LU = work + size_t(n) * n;
+
+    CHECK_ROCBLAS_ERROR(
+        device_geam<T>(blas, HIPSOLVER_OP_N, n, n, T(1), A, lda, T(0), A, lda, PA, n));
+    CHECK_ROCBLAS_ERROR(device_nrm2<T>(blas, n * n, PA, 1, &normA));
+
+    // apply the row interchanges in the order they were made
+    if(hIpiv)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            if(hIpiv[i] - 1 != i)
+                CHECK_ROCBLAS_ERROR(device_swap<T>(blas, n, PA + i, n, PA + hIpiv[i] - 1, n));
+        }
+    }
+
+    device_set_identity<T>(blas, n, LU, n);
+    CHECK_ROCBLAS_ERROR(device_trmm<T>(blas,
+                                       HIPSOLVER_SIDE_LEFT,
+                                       HIPSOLVER_FILL_MODE_UPPER,
+                                       HIPSOLVER_OP_N,
+                                       false,
+                                       n,
+                                       n,
+                                       T(1),
+                                       F,
+                                       ldf,
+                                       LU,
+                                       n));
+    CHECK_ROCBLAS_ERROR(device_trmm<T>(blas,
+                                       HIPSOLVER_SIDE_LEFT,
+                                       HIPSOLVER_FILL_MODE_LOWER,
+                                       HIPSOLVER_OP_N,
+                                       true,
+                                       n,
+                                       n,
+                                       T(1),
+                                       F,
+                                       ldf,
+                                       LU,
+                                       n));
+
+    CHECK_ROCBLAS_ERROR(
+        device_geam<T>(blas, HIPSOLVER_OP_N, n, n, T(1), PA, n, T(-1), LU, n, PA, n));
+    CHECK_ROCBLAS_ERROR(device_nrm2<T>(blas, n * n, PA, 1, &normR));
+
+    *err = normA > 0 ? normR / normA : normR;
+}
+
+/*! \brief  relative residual ||A*V - V*W|| / ||A|| of the eigenvectors V and eigenvalues W of the
+ *          symmetric/hermitian matrix stored in the uplo triangle of A, using frobenius norm.
+ *          The eigenvalues hW are read on the host. Work must hold 2*n*n elements. */
+template <typename T, typename S>
+void device_eig_residual(const device_blas_handle& blas,
+                         hipsolverFillMode_t       uplo,
+                         int                       n,
+                         const T*                  A,
+                         int                       lda,
+                         const T*                  V,
+                         int                       ldv,
+                         const S*                  hW,
+                         T*                        work,
+                         double*                   err)
+{
+    double normA, normR;
+    T*     eye = work;
+    T*     AV  = work + size_t(n) * n;
+
+    // the norm of the full matrix is computed from A * I
+    device_set_identity<T>(blas, n, eye, n);
+    CHECK_ROCBLAS_ERROR(device_symm_hemm<T>(
+        blas, HIPSOLVER_SIDE_LEFT, uplo, n, n, T(1), A, lda, eye, n, T(0), AV, n));
+    CHECK_ROCBLAS_ERROR(device_nrm2<T>(blas, n * n, AV, 1, &normA));
+
+    CHECK_ROCBLAS_ERROR(device_symm_hemm<T>(
+        blas, HIPSOLVER_SIDE_LEFT, uplo, n, n, T(1), A, lda, V, ldv, T(0), AV, n));
+    for(int j = 0; j < n; j++)
+        CHECK_ROCBLAS_ERROR(
+            device_axpy<T>(blas, n, T(-hW[j]), V + size_t(j) * ldv, 1, AV + size_t(j) * n, 1));
+    CHECK_ROCBLAS_ERROR(device_nrm2<T>(blas, n * n, AV, 1, &normR));
+
+    *err = normA > 0 ? normR / normA : normR;
+}
@@ -41,9 +41,43 @@ inline testMarshal_t bool2marshal(bool FORTRAN, bool ALT)
         return FORTRAN_NORMAL_ALT;
 }
 
+inline testMarshal_t bool2marshal(bool FORTRAN, bool STRIDED, bool ALT)
+{
+    if(!STRIDED)
+        return bool2marshal(FORTRAN, ALT);
+    else if(!FORTRAN)
+        if(!ALT)
+            return C_STRIDED;
+        else
+            return C_STRIDED_ALT;
+    else if(!ALT)
+        return FORTRAN_STRIDED;
+    else
+        return FORTRAN_STRIDED_ALT;
+}
+
+/******************** ADVANCED OPTIONS ********************/
+// sets the algorithm hints of the given function; the pivoting hint is only set for getrf
+inline hipsolverStatus_t hipsolver_set_adv_options(hipsolverHandle_t     handle,
+                                                   hipsolverDnFunction_t function,
+                                                   int                   alg,
+                                                   int                   pivot,
+                                                   int                   unblocked_size)
+{
+    hipsolverStatus_t status
+        = hipsolverSetAdvOptions(handle, function, HIPSOLVER_ADV_ALGORITHM, alg);
+    if(status == HIPSOLVER_STATUS_SUCCESS && function == HIPSOLVERDN_GETRF)
+        status = hipsolverSetAdvOptions(handle, function, HIPSOLVER_ADV_PIVOTING, pivot);
+    if(status == HIPSOLVER_STATUS_SUCCESS && unblocked_size > 0)
+        status = hipsolverSetAdvOptions(
+            handle, function, HIPSOLVER_ADV_UNBLOCKED_SIZE, unblocked_size);
+    return status;
+}
+
 /******************** ORGBR/UNGBR ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
                                                           hipsolverSideMode_t side,
                                                           int                 m,
@@ -51,16 +85,31 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FO
                                                           int                 k,
                                                           float*              A,
                                                           int                 lda,
+                                                          int                 stA,
                                                           float*              tau,
-                                                          int*                lwork)
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverSorgbr_bufferSize(handle, side, m, n, k, A, lda, tau, lwork);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverSorgbr_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverSorgbrStridedBatched_bufferSize(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSorgbrStridedBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
                                                           hipsolverSideMode_t side,
                                                           int                 m,
@@ -68,16 +117,31 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FO
                                                           int                 k,
                                                           double*             A,
                                                           int                 lda,
+                                                          int                 stA,
                                                           double*             tau,
-                                                          int*                lwork)
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverDorgbr_bufferSize(handle, side, m, n, k, A, lda, tau, lwork);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverDorgbr_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverDorgbrStridedBatched_bufferSize(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDorgbrStridedBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
                                                           hipsolverSideMode_t side,
                                                           int                 m,
@@ -85,16 +149,31 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FO
                                                           int                 k,
                                                           hipsolverComplex*   A,
                                                           int                 lda,
+                                                          int                 stA,
                                                           hipsolverComplex*   tau,
-                                                          int*                lwork)
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverCungbr_bufferSize(handle, side, m, n, k, A, lda, tau, lwork);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverCungbr_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverCungbrStridedBatched_bufferSize(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCungbrStridedBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
                                                           hipsolverSideMode_t     side,
                                                           int                     m,
@@ -102,16 +181,31 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool
                                                           int                     k,
                                                           hipsolverDoubleComplex* A,
                                                           int                     lda,
+                                                          int                     stA,
                                                           hipsolverDoubleComplex* tau,
-                                                          int*                    lwork)
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverZungbr_bufferSize(handle, side, m, n, k, A, lda, tau, lwork);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverZungbr_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverZungbrStridedBatched_bufferSize(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZungbrStridedBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
                                                hipsolverSideMode_t side,
                                                int                 m,
@@ -119,18 +213,33 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
                                                int                 k,
                                                float*              A,
                                                int                 lda,
+                                               int                 stA,
                                                float*              tau,
+                                               int                 stP,
                                                float*              work,
                                                int                 lwork,
-                                               int*                info)
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverSorgbr(handle, side, m, n, k, A, lda, tau, work, lwork, info);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverSorgbrFortran(handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSorgbrStridedBatched(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSorgbrStridedBatchedFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
                                                hipsolverSideMode_t side,
                                                int                 m,
@@ -138,18 +247,33 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
                                                int                 k,
                                                double*             A,
                                                int                 lda,
+                                               int                 stA,
                                                double*             tau,
+                                               int                 stP,
                                                double*             work,
                                                int                 lwork,
-                                               int*                info)
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverDorgbr(handle, side, m, n, k, A, lda, tau, work, lwork, info);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverDorgbrFortran(handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDorgbrStridedBatched(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDorgbrStridedBatchedFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
                                                hipsolverSideMode_t side,
                                                int                 m,
@@ -157,18 +281,33 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
                                                int                 k,
                                                hipsolverComplex*   A,
                                                int                 lda,
+                                               int                 stA,
                                                hipsolverComplex*   tau,
+                                               int                 stP,
                                                hipsolverComplex*   work,
                                                int                 lwork,
-                                               int*                info)
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverCungbr(handle, side, m, n, k, A, lda, tau, work, lwork, info);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverCungbrFortran(handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCungbrStridedBatched(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCungbrStridedBatchedFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                    FORTRAN,
+                                               bool                    STRIDED,
                                                hipsolverHandle_t       handle,
                                                hipsolverSideMode_t     side,
                                                int                     m,
@@ -176,2168 +315,8638 @@ inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                    FORTRAN,
                                                int                     k,
                                                hipsolverDoubleComplex* A,
                                                int                     lda,
+                                               int                     stA,
                                                hipsolverDoubleComplex* tau,
+                                               int                     stP,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
-                                               int*                    info)
+                                               int*                    info,
+                                               int                     bc)
 {
-    if(!FORTRAN)
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
         return hipsolverZungbr(handle, side, m, n, k, A, lda, tau, work, lwork, info);
-    else
+    case FORTRAN_NORMAL:
         return hipsolverZungbrFortran(handle, side, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZungbrStridedBatched(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZungbrStridedBatchedFortran(
+            handle, side, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-/******************** ORGQR/UNGQR ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
-                                                          hipsolverHandle_t handle,
-                                                          int               m,
-                                                          int               n,
-                                                          int               k,
-                                                          float*            A,
-                                                          int               lda,
-                                                          float*            tau,
-                                                          int*              lwork)
+// batched
+inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverSideMode_t side,
+                                                          int                 m,
+                                                          int                 n,
+                                                          int                 k,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
-    else
-        return hipsolverSorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgbrBatched_bufferSize(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgbrBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
-                                                          hipsolverHandle_t handle,
-                                                          int               m,
-                                                          int               n,
-                                                          int               k,
-                                                          double*           A,
-                                                          int               lda,
-                                                          double*           tau,
-                                                          int*              lwork)
+inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverSideMode_t side,
+                                                          int                 m,
+                                                          int                 n,
+                                                          int                 k,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
-    else
-        return hipsolverDorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgbrBatched_bufferSize(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgbrBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
-                                                          hipsolverHandle_t handle,
-                                                          int               m,
-                                                          int               n,
-                                                          int               k,
-                                                          hipsolverComplex* A,
-                                                          int               lda,
-                                                          hipsolverComplex* tau,
-                                                          int*              lwork)
+inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverSideMode_t side,
+                                                          int                 m,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          hipsolverComplex*   tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
-    else
-        return hipsolverCungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungbrBatched_bufferSize(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCungbrBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_orgbr_ungbr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
+                                                          hipsolverSideMode_t     side,
                                                           int                     m,
                                                           int                     n,
                                                           int                     k,
-                                                          hipsolverDoubleComplex* A,
+                                                          hipsolverDoubleComplex* A[],
                                                           int                     lda,
+                                                          int                     stA,
                                                           hipsolverDoubleComplex* tau,
-                                                          int*                    lwork)
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
-    else
-        return hipsolverZungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungbrBatched_bufferSize(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZungbrBatched_bufferSizeFortran(
+            handle, side, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
-                                               hipsolverHandle_t handle,
-                                               int               m,
-                                               int               n,
-                                               int               k,
-                                               float*            A,
-                                               int               lda,
-                                               float*            tau,
-                                               float*            work,
-                                               int               lwork,
-                                               int*              info)
+inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverSideMode_t side,
+                                               int                 m,
+                                               int                 n,
+                                               int                 k,
+                                               float*              A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              tau,
+                                               int                 stP,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSorgqr(handle, m, n, k, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverSorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgbrBatched(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgbrBatchedFortran(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
-                                               hipsolverHandle_t handle,
-                                               int               m,
-                                               int               n,
-                                               int               k,
-                                               double*           A,
-                                               int               lda,
-                                               double*           tau,
-                                               double*           work,
-                                               int               lwork,
-                                               int*              info)
+inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverSideMode_t side,
+                                               int                 m,
+                                               int                 n,
+                                               int                 k,
+                                               double*             A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             tau,
+                                               int                 stP,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDorgqr(handle, m, n, k, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverDorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgbrBatched(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgbrBatchedFortran(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
-                                               hipsolverHandle_t handle,
-                                               int               m,
-                                               int               n,
-                                               int               k,
-                                               hipsolverComplex* A,
-                                               int               lda,
-                                               hipsolverComplex* tau,
-                                               hipsolverComplex* work,
-                                               int               lwork,
-                                               int*              info)
+inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverSideMode_t side,
+                                               int                 m,
+                                               int                 n,
+                                               int                 k,
+                                               hipsolverComplex*   A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               hipsolverComplex*   tau,
+                                               int                 stP,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCungqr(handle, m, n, k, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverCungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungbrBatched(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCungbrBatchedFortran(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_orgbr_ungbr(bool                    FORTRAN,
+                                               bool                    STRIDED,
                                                hipsolverHandle_t       handle,
+                                               hipsolverSideMode_t     side,
                                                int                     m,
                                                int                     n,
                                                int                     k,
-                                               hipsolverDoubleComplex* A,
+                                               hipsolverDoubleComplex* A[],
                                                int                     lda,
+                                               int                     stA,
                                                hipsolverDoubleComplex* tau,
+                                               int                     stP,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
-                                               int*                    info)
+                                               int*                    info,
+                                               int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZungqr(handle, m, n, k, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverZungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungbrBatched(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZungbrBatchedFortran(
+            handle, side, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
 
-/******************** ORGTR/UNGTR ********************/
+/******************** ORGQR/UNGQR ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
+                                                          bool              STRIDED,
+                                                          hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          float*            A,
+                                                          int               lda,
+                                                          int               stA,
+                                                          float*            tau,
+                                                          int               stP,
+                                                          int*              lwork,
+                                                          int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverSorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
-    else
-        return hipsolverSorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverSorgqrStridedBatched_bufferSize(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSorgqrStridedBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
+                                                          bool              STRIDED,
+                                                          hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          double*           A,
+                                                          int               lda,
+                                                          int               stA,
+                                                          double*           tau,
+                                                          int               stP,
+                                                          int*              lwork,
+                                                          int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverDorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
-    else
-        return hipsolverDorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverDorgqrStridedBatched_bufferSize(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDorgqrStridedBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          hipsolverComplex*   tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
+                                                          bool              STRIDED,
+                                                          hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          hipsolverComplex* A,
+                                                          int               lda,
+                                                          int               stA,
+                                                          hipsolverComplex* tau,
+                                                          int               stP,
+                                                          int*              lwork,
+                                                          int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverCungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
-    else
-        return hipsolverCungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverCungqrStridedBatched_bufferSize(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCungqrStridedBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
-                                                          hipsolverFillMode_t     uplo,
+                                                          int                     m,
                                                           int                     n,
+                                                          int                     k,
                                                           hipsolverDoubleComplex* A,
                                                           int                     lda,
+                                                          int                     stA,
                                                           hipsolverDoubleComplex* tau,
-                                                          int*                    lwork)
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
-    else
-        return hipsolverZungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverZungqrStridedBatched_bufferSize(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZungqrStridedBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               float*              tau,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
+                                               bool              STRIDED,
+                                               hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               k,
+                                               float*            A,
+                                               int               lda,
+                                               int               stA,
+                                               float*            tau,
+                                               int               stP,
+                                               float*            work,
+                                               int               lwork,
+                                               int*              info,
+                                               int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverSorgtr(handle, uplo, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverSorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgqr(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSorgqrStridedBatched(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSorgqrStridedBatchedFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               double*             tau,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
+                                               bool              STRIDED,
+                                               hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               k,
+                                               double*           A,
+                                               int               lda,
+                                               int               stA,
+                                               double*           tau,
+                                               int               stP,
+                                               double*           work,
+                                               int               lwork,
+                                               int*              info,
+                                               int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverDorgtr(handle, uplo, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverDorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgqr(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDorgqrStridedBatched(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDorgqrStridedBatchedFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               hipsolverComplex*   tau,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
+                                               bool              STRIDED,
+                                               hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               k,
+                                               hipsolverComplex* A,
+                                               int               lda,
+                                               int               stA,
+                                               hipsolverComplex* tau,
+                                               int               stP,
+                                               hipsolverComplex* work,
+                                               int               lwork,
+                                               int*              info,
+                                               int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverCungtr(handle, uplo, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverCungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungqr(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCungqrStridedBatched(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCungqrStridedBatchedFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool                    FORTRAN,
+                                               bool                    STRIDED,
                                                hipsolverHandle_t       handle,
-                                               hipsolverFillMode_t     uplo,
+                                               int                     m,
                                                int                     n,
+                                               int                     k,
                                                hipsolverDoubleComplex* A,
                                                int                     lda,
+                                               int                     stA,
                                                hipsolverDoubleComplex* tau,
+                                               int                     stP,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
-                                               int*                    info)
-{
-    if(!FORTRAN)
-        return hipsolverZungtr(handle, uplo, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverZungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungqr(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZungqrStridedBatched(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZungqrStridedBatchedFortran(
+            handle, m, n, k, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
-/********************************************************/
 
-/******************** ORMQR/UNMQR ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverSideMode_t  side,
-                                                          hipsolverOperation_t trans,
-                                                          int                  m,
-                                                          int                  n,
-                                                          int                  k,
-                                                          float*               A,
-                                                          int                  lda,
-                                                          float*               tau,
-                                                          float*               C,
-                                                          int                  ldc,
-                                                          int*                 lwork)
+// batched
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
+                                                          bool              STRIDED,
+                                                          hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          int               stA,
+                                                          float*            tau,
+                                                          int               stP,
+                                                          int*              lwork,
+                                                          int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverSormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverSormqr_bufferSizeFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgqrBatched_bufferSize(handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgqrBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverSideMode_t  side,
-                                                          hipsolverOperation_t trans,
-                                                          int                  m,
-                                                          int                  n,
-                                                          int                  k,
-                                                          double*              A,
-                                                          int                  lda,
-                                                          double*              tau,
-                                                          double*              C,
-                                                          int                  ldc,
-                                                          int*                 lwork)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
+                                                          bool              STRIDED,
+                                                          hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          int               stA,
+                                                          double*           tau,
+                                                          int               stP,
+                                                          int*              lwork,
+                                                          int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverDormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverDormqr_bufferSizeFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgqrBatched_bufferSize(handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgqrBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverSideMode_t  side,
-                                                          hipsolverOperation_t trans,
-                                                          int                  m,
-                                                          int                  n,
-                                                          int                  k,
-                                                          hipsolverComplex*    A,
-                                                          int                  lda,
-                                                          hipsolverComplex*    tau,
-                                                          hipsolverComplex*    C,
-                                                          int                  ldc,
-                                                          int*                 lwork)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool              FORTRAN,
+                                                          bool              STRIDED,
+                                                          hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          hipsolverComplex* A[],
+                                                          int               lda,
+                                                          int               stA,
+                                                          hipsolverComplex* tau,
+                                                          int               stP,
+                                                          int*              lwork,
+                                                          int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverCunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverCunmqr_bufferSizeFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungqrBatched_bufferSize(handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCungqrBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_orgqr_ungqr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
-                                                          hipsolverSideMode_t     side,
-                                                          hipsolverOperation_t    trans,
                                                           int                     m,
                                                           int                     n,
                                                           int                     k,
-                                                          hipsolverDoubleComplex* A,
+                                                          hipsolverDoubleComplex* A[],
                                                           int                     lda,
+                                                          int                     stA,
                                                           hipsolverDoubleComplex* tau,
-                                                          hipsolverDoubleComplex* C,
-                                                          int                     ldc,
-                                                          int*                    lwork)
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverZunmqr_bufferSizeFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungqrBatched_bufferSize(handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZungqrBatched_bufferSizeFortran(
+            handle, m, n, k, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverSideMode_t  side,
-                                               hipsolverOperation_t trans,
-                                               int                  m,
-                                               int                  n,
-                                               int                  k,
-                                               float*               A,
-                                               int                  lda,
-                                               float*               tau,
-                                               float*               C,
-                                               int                  ldc,
-                                               float*               work,
-                                               int                  lwork,
-                                               int*                 info)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
+                                               bool              STRIDED,
+                                               hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               k,
+                                               float*            A[],
+                                               int               lda,
+                                               int               stA,
+                                               float*            tau,
+                                               int               stP,
+                                               float*            work,
+                                               int               lwork,
+                                               int*              info,
+                                               int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverSormqr(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverSormqrFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgqrBatched(handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgqrBatchedFortran(
+            handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverSideMode_t  side,
-                                               hipsolverOperation_t trans,
-                                               int                  m,
-                                               int                  n,
-                                               int                  k,
-                                               double*              A,
-                                               int                  lda,
-                                               double*              tau,
-                                               double*              C,
-                                               int                  ldc,
-                                               double*              work,
-                                               int                  lwork,
-                                               int*                 info)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
+                                               bool              STRIDED,
+                                               hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               k,
+                                               double*           A[],
+                                               int               lda,
+                                               int               stA,
+                                               double*           tau,
+                                               int               stP,
+                                               double*           work,
+                                               int               lwork,
+                                               int*              info,
+                                               int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverDormqr(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverDormqrFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgqrBatched(handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgqrBatchedFortran(
+            handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverSideMode_t  side,
-                                               hipsolverOperation_t trans,
-                                               int                  m,
-                                               int                  n,
-                                               int                  k,
-                                               hipsolverComplex*    A,
-                                               int                  lda,
-                                               hipsolverComplex*    tau,
-                                               hipsolverComplex*    C,
-                                               int                  ldc,
-                                               hipsolverComplex*    work,
-                                               int                  lwork,
-                                               int*                 info)
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool              FORTRAN,
+                                               bool              STRIDED,
+                                               hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               k,
+                                               hipsolverComplex* A[],
+                                               int               lda,
+                                               int               stA,
+                                               hipsolverComplex* tau,
+                                               int               stP,
+                                               hipsolverComplex* work,
+                                               int               lwork,
+                                               int*              info,
+                                               int               bc)
 {
-    if(!FORTRAN)
-        return hipsolverCunmqr(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverCunmqrFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungqrBatched(handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCungqrBatchedFortran(
+            handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_orgqr_ungqr(bool                    FORTRAN,
+                                               bool                    STRIDED,
                                                hipsolverHandle_t       handle,
-                                               hipsolverSideMode_t     side,
-                                               hipsolverOperation_t    trans,
                                                int                     m,
                                                int                     n,
                                                int                     k,
-                                               hipsolverDoubleComplex* A,
+                                               hipsolverDoubleComplex* A[],
                                                int                     lda,
+                                               int                     stA,
                                                hipsolverDoubleComplex* tau,
-                                               hipsolverDoubleComplex* C,
-                                               int                     ldc,
+                                               int                     stP,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
-                                               int*                    info)
+                                               int*                    info,
+                                               int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZunmqr(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverZunmqrFortran(
-            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungqrBatched(handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZungqrBatchedFortran(
+            handle, m, n, k, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
 
-/******************** ORMTR/UNMTR ********************/
+/******************** ORGTR/UNGTR ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                 FORTRAN,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverSideMode_t  side,
-                                                          hipsolverFillMode_t  uplo,
-                                                          hipsolverOperation_t trans,
-                                                          int                  m,
-                                                          int                  n,
-                                                          float*               A,
-                                                          int                  lda,
-                                                          float*               tau,
-                                                          float*               C,
-                                                          int                  ldc,
-                                                          int*                 lwork)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSormtr_bufferSize(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverSormtr_bufferSizeFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverSorgtrStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSorgtrStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                 FORTRAN,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverSideMode_t  side,
-                                                          hipsolverFillMode_t  uplo,
-                                                          hipsolverOperation_t trans,
-                                                          int                  m,
-                                                          int                  n,
-                                                          double*              A,
-                                                          int                  lda,
-                                                          double*              tau,
-                                                          double*              C,
-                                                          int                  ldc,
-                                                          int*                 lwork)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDormtr_bufferSize(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverDormtr_bufferSizeFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverDorgtrStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDorgtrStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                 FORTRAN,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverSideMode_t  side,
-                                                          hipsolverFillMode_t  uplo,
-                                                          hipsolverOperation_t trans,
-                                                          int                  m,
-                                                          int                  n,
-                                                          hipsolverComplex*    A,
-                                                          int                  lda,
-                                                          hipsolverComplex*    tau,
-                                                          hipsolverComplex*    C,
-                                                          int                  ldc,
-                                                          int*                 lwork)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          hipsolverComplex*   tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCunmtr_bufferSize(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverCunmtr_bufferSizeFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverCungtrStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCungtrStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
-                                                          hipsolverSideMode_t     side,
                                                           hipsolverFillMode_t     uplo,
-                                                          hipsolverOperation_t    trans,
-                                                          int                     m,
                                                           int                     n,
                                                           hipsolverDoubleComplex* A,
                                                           int                     lda,
+                                                          int                     stA,
                                                           hipsolverDoubleComplex* tau,
-                                                          hipsolverDoubleComplex* C,
-                                                          int                     ldc,
-                                                          int*                    lwork)
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZunmtr_bufferSize(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
-    else
-        return hipsolverZunmtr_bufferSizeFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork);
+    case C_STRIDED:
+        return hipsolverZungtrStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZungtrStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                 FORTRAN,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverSideMode_t  side,
-                                               hipsolverFillMode_t  uplo,
-                                               hipsolverOperation_t trans,
-                                               int                  m,
-                                               int                  n,
-                                               float*               A,
-                                               int                  lda,
-                                               float*               tau,
-                                               float*               C,
-                                               int                  ldc,
-                                               float*               work,
-                                               int                  lwork,
-                                               int*                 info)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              tau,
+                                               int                 stP,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSormtr(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverSormtrFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgtr(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSorgtrStridedBatched(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSorgtrStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                 FORTRAN,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverSideMode_t  side,
-                                               hipsolverFillMode_t  uplo,
-                                               hipsolverOperation_t trans,
-                                               int                  m,
-                                               int                  n,
-                                               double*              A,
-                                               int                  lda,
-                                               double*              tau,
-                                               double*              C,
-                                               int                  ldc,
-                                               double*              work,
-                                               int                  lwork,
-                                               int*                 info)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             tau,
+                                               int                 stP,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDormtr(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverDormtrFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgtr(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDorgtrStridedBatched(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDorgtrStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                 FORTRAN,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverSideMode_t  side,
-                                               hipsolverFillMode_t  uplo,
-                                               hipsolverOperation_t trans,
-                                               int                  m,
-                                               int                  n,
-                                               hipsolverComplex*    A,
-                                               int                  lda,
-                                               hipsolverComplex*    tau,
-                                               hipsolverComplex*    C,
-                                               int                  ldc,
-                                               hipsolverComplex*    work,
-                                               int                  lwork,
-                                               int*                 info)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               hipsolverComplex*   tau,
+                                               int                 stP,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCunmtr(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverCunmtrFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-}
-
-inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                    FORTRAN,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverSideMode_t     side,
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungtr(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCungtrStridedBatched(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCungtrStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
                                                hipsolverFillMode_t     uplo,
-                                               hipsolverOperation_t    trans,
-                                               int                     m,
                                                int                     n,
                                                hipsolverDoubleComplex* A,
                                                int                     lda,
+                                               int                     stA,
                                                hipsolverDoubleComplex* tau,
-                                               hipsolverDoubleComplex* C,
-                                               int                     ldc,
+                                               int                     stP,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
-                                               int*                    info)
+                                               int*                    info,
+                                               int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZunmtr(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
-    else
-        return hipsolverZunmtrFortran(
-            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungtr(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZungtrStridedBatched(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZungtrStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
-/********************************************************/
 
-/******************** GEBRD ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_gebrd_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+// batched
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSgebrd_bufferSize(handle, m, n, lwork);
-    else
-        return hipsolverSgebrd_bufferSizeFortran(handle, m, n, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgtrBatched_bufferSize(handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgtrBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gebrd_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDgebrd_bufferSize(handle, m, n, lwork);
-    else
-        return hipsolverDgebrd_bufferSizeFortran(handle, m, n, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgtrBatched_bufferSize(handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgtrBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gebrd_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          hipsolverComplex*   tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCgebrd_bufferSize(handle, m, n, lwork);
-    else
-        return hipsolverCgebrd_bufferSizeFortran(handle, m, n, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungtrBatched_bufferSize(handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCungtrBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    int                     m,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZgebrd_bufferSize(handle, m, n, lwork);
-    else
-        return hipsolverZgebrd_bufferSizeFortran(handle, m, n, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungtrBatched_bufferSize(handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZungtrBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         float*            A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            D,
-                                         int               stD,
-                                         float*            E,
-                                         int               stE,
-                                         float*            tauq,
-                                         int               stQ,
-                                         float*            taup,
-                                         int               stP,
-                                         float*            work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              tau,
+                                               int                 stP,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
-    else
-        return hipsolverSgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSorgtrBatched(handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSorgtrBatchedFortran(
+            handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         double*           A,
-                                         int               lda,
-                                         int               stA,
-                                         double*           D,
-                                         int               stD,
-                                         double*           E,
-                                         int               stE,
-                                         double*           tauq,
-                                         int               stQ,
-                                         double*           taup,
-                                         int               stP,
-                                         double*           work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             tau,
+                                               int                 stP,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
-    else
-        return hipsolverDgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDorgtrBatched(handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDorgtrBatchedFortran(
+            handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         hipsolverComplex* A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            D,
-                                         int               stD,
-                                         float*            E,
-                                         int               stE,
-                                         hipsolverComplex* tauq,
-                                         int               stQ,
-                                         hipsolverComplex* taup,
-                                         int               stP,
-                                         hipsolverComplex* work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               hipsolverComplex*   tau,
+                                               int                 stP,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
-    else
-        return hipsolverCgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCungtrBatched(handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCungtrBatchedFortran(
+            handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gebrd(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         int                     m,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         double*                 D,
-                                         int                     stD,
-                                         double*                 E,
-                                         int                     stE,
-                                         hipsolverDoubleComplex* tauq,
-                                         int                     stQ,
-                                         hipsolverDoubleComplex* taup,
-                                         int                     stP,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
-{
-    if(!FORTRAN)
-        return hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
-    else
-        return hipsolverZgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+inline hipsolverStatus_t hipsolver_orgtr_ungtr(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A[],
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* tau,
+                                               int                     stP,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZungtrBatched(handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZungtrBatchedFortran(
+            handle, uplo, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
 
-/******************** GEQRF ********************/
+/******************** ORMQR/UNMQR ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          float*               tau,
+                                                          int                  stP,
+                                                          float*               C,
+                                                          int                  ldc,
+                                                          int                  stC,
+                                                          int*                 lwork,
+                                                          int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSormqr_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case C_STRIDED:
+        return hipsolverSormqrStridedBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSormqrStridedBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          double*              tau,
+                                                          int                  stP,
+                                                          double*              C,
+                                                          int                  ldc,
+                                                          int                  stC,
+                                                          int*                 lwork,
+                                                          int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDormqr_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case C_STRIDED:
+        return hipsolverDormqrStridedBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDormqrStridedBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          hipsolverComplex*    tau,
+                                                          int                  stP,
+                                                          hipsolverComplex*    C,
+                                                          int                  ldc,
+                                                          int                  stC,
+                                                          int*                 lwork,
+                                                          int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverCgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCunmqr_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case C_STRIDED:
+        return hipsolverCunmqrStridedBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCunmqrStridedBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    int                     m,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork)
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverSideMode_t     side,
+                                                          hipsolverOperation_t    trans,
+                                                          int                     m,
+                                                          int                     n,
+                                                          int                     k,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     stP,
+                                                          hipsolverDoubleComplex* C,
+                                                          int                     ldc,
+                                                          int                     stC,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverZgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZunmqr_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork);
+    case C_STRIDED:
+        return hipsolverZunmqrStridedBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZunmqrStridedBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, stA, tau, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         float*            A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            tau,
-                                         int               stT,
-                                         float*            work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               float*               A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               tau,
+                                               int                  stP,
+                                               float*               C,
+                                               int                  ldc,
+                                               int                  stC,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSormqr(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSormqrFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSormqrStridedBatched(handle,
+                                             side,
+                                             trans,
+                                             m,
+                                             n,
+                                             k,
+                                             A,
+                                             lda,
+                                             stA,
+                                             tau,
+                                             stP,
+                                             C,
+                                             ldc,
+                                             stC,
+                                             work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSormqrStridedBatchedFortran(handle,
+                                                    side,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    tau,
+                                                    stP,
+                                                    C,
+                                                    ldc,
+                                                    stC,
+                                                    work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         double*           A,
-                                         int               lda,
-                                         int               stA,
-                                         double*           tau,
-                                         int               stT,
-                                         double*           work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               double*              A,
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              tau,
+                                               int                  stP,
+                                               double*              C,
+                                               int                  ldc,
+                                               int                  stC,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDormqr(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDormqrFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDormqrStridedBatched(handle,
+                                             side,
+                                             trans,
+                                             m,
+                                             n,
+                                             k,
+                                             A,
+                                             lda,
+                                             stA,
+                                             tau,
+                                             stP,
+                                             C,
+                                             ldc,
+                                             stC,
+                                             work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDormqrStridedBatchedFortran(handle,
+                                                    side,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    tau,
+                                                    stP,
+                                                    C,
+                                                    ldc,
+                                                    stC,
+                                                    work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         hipsolverComplex* A,
-                                         int               lda,
-                                         int               stA,
-                                         hipsolverComplex* tau,
-                                         int               stT,
-                                         hipsolverComplex* work,
-                                         int               lwork,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               hipsolverComplex*    A,
+                                               int                  lda,
+                                               int                  stA,
+                                               hipsolverComplex*    tau,
+                                               int                  stP,
+                                               hipsolverComplex*    C,
+                                               int                  ldc,
+                                               int                  stC,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCunmqr(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCunmqrFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCunmqrStridedBatched(handle,
+                                             side,
+                                             trans,
+                                             m,
+                                             n,
+                                             k,
+                                             A,
+                                             lda,
+                                             stA,
+                                             tau,
+                                             stP,
+                                             C,
+                                             ldc,
+                                             stC,
+                                             work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCunmqrStridedBatchedFortran(handle,
+                                                    side,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    tau,
+                                                    stP,
+                                                    C,
+                                                    ldc,
+                                                    stC,
+                                                    work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverSideMode_t     side,
+                                               hipsolverOperation_t    trans,
+                                               int                     m,
+                                               int                     n,
+                                               int                     k,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* tau,
+                                               int                     stP,
+                                               hipsolverDoubleComplex* C,
+                                               int                     ldc,
+                                               int                     stC,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZunmqr(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZunmqrFortran(
+            handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZunmqrStridedBatched(handle,
+                                             side,
+                                             trans,
+                                             m,
+                                             n,
+                                             k,
+                                             A,
+                                             lda,
+                                             stA,
+                                             tau,
+                                             stP,
+                                             C,
+                                             ldc,
+                                             stC,
+                                             work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZunmqrStridedBatchedFortran(handle,
+                                                    side,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    tau,
+                                                    stP,
+                                                    C,
+                                                    ldc,
+                                                    stC,
+                                                    work,
+                                                    lwork,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          float*               A[],
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          float*               tau,
+                                                          int                  stP,
+                                                          float*               C[],
+                                                          int                  ldc,
+                                                          int                  stC,
+                                                          int*                 lwork,
+                                                          int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSormqrBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSormqrBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          double*              A[],
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          double*              tau,
+                                                          int                  stP,
+                                                          double*              C[],
+                                                          int                  ldc,
+                                                          int                  stC,
+                                                          int*                 lwork,
+                                                          int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDormqrBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDormqrBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          hipsolverComplex*    A[],
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          hipsolverComplex*    tau,
+                                                          int                  stP,
+                                                          hipsolverComplex*    C[],
+                                                          int                  ldc,
+                                                          int                  stC,
+                                                          int*                 lwork,
+                                                          int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCunmqrBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCunmqrBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverSideMode_t     side,
+                                                          hipsolverOperation_t    trans,
+                                                          int                     m,
+                                                          int                     n,
+                                                          int                     k,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     stP,
+                                                          hipsolverDoubleComplex* C[],
+                                                          int                     ldc,
+                                                          int                     stC,
+                                                          int*                    lwork,
+                                                          int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZunmqrBatched_bufferSize(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZunmqrBatched_bufferSizeFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               float*               A[],
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               tau,
+                                               int                  stP,
+                                               float*               C[],
+                                               int                  ldc,
+                                               int                  stC,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSormqrBatched(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSormqrBatchedFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               double*              A[],
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              tau,
+                                               int                  stP,
+                                               double*              C[],
+                                               int                  ldc,
+                                               int                  stC,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDormqrBatched(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDormqrBatchedFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               int                  k,
+                                               hipsolverComplex*    A[],
+                                               int                  lda,
+                                               int                  stA,
+                                               hipsolverComplex*    tau,
+                                               int                  stP,
+                                               hipsolverComplex*    C[],
+                                               int                  ldc,
+                                               int                  stC,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCunmqrBatched(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCunmqrBatchedFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_ormqr_unmqr(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverSideMode_t     side,
+                                               hipsolverOperation_t    trans,
+                                               int                     m,
+                                               int                     n,
+                                               int                     k,
+                                               hipsolverDoubleComplex* A[],
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* tau,
+                                               int                     stP,
+                                               hipsolverDoubleComplex* C[],
+                                               int                     ldc,
+                                               int                     stC,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZunmqrBatched(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZunmqrBatchedFortran(
+            handle, side, trans, m, n, k, A, lda, tau, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** ORMTR/UNMTR ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                 FORTRAN,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverFillMode_t  uplo,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          float*               tau,
+                                                          float*               C,
+                                                          int                  ldc,
+                                                          int*                 lwork)
+{
+    if(!FORTRAN)
+        return hipsolverSormtr_bufferSize(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    else
+        return hipsolverSormtr_bufferSizeFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                 FORTRAN,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverFillMode_t  uplo,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          double*              tau,
+                                                          double*              C,
+                                                          int                  ldc,
+                                                          int*                 lwork)
+{
+    if(!FORTRAN)
+        return hipsolverDormtr_bufferSize(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    else
+        return hipsolverDormtr_bufferSizeFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                 FORTRAN,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverFillMode_t  uplo,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          hipsolverComplex*    tau,
+                                                          hipsolverComplex*    C,
+                                                          int                  ldc,
+                                                          int*                 lwork)
+{
+    if(!FORTRAN)
+        return hipsolverCunmtr_bufferSize(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    else
+        return hipsolverCunmtr_bufferSizeFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ormtr_unmtr_bufferSize(bool                    FORTRAN,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverSideMode_t     side,
+                                                          hipsolverFillMode_t     uplo,
+                                                          hipsolverOperation_t    trans,
+                                                          int                     m,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* tau,
+                                                          hipsolverDoubleComplex* C,
+                                                          int                     ldc,
+                                                          int*                    lwork)
+{
+    if(!FORTRAN)
+        return hipsolverZunmtr_bufferSize(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+    else
+        return hipsolverZunmtr_bufferSizeFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                 FORTRAN,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverFillMode_t  uplo,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               float*               A,
+                                               int                  lda,
+                                               float*               tau,
+                                               float*               C,
+                                               int                  ldc,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info)
+{
+    if(!FORTRAN)
+        return hipsolverSormtr(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    else
+        return hipsolverSormtrFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                 FORTRAN,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverFillMode_t  uplo,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               double*              A,
+                                               int                  lda,
+                                               double*              tau,
+                                               double*              C,
+                                               int                  ldc,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info)
+{
+    if(!FORTRAN)
+        return hipsolverDormtr(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    else
+        return hipsolverDormtrFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                 FORTRAN,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverSideMode_t  side,
+                                               hipsolverFillMode_t  uplo,
+                                               hipsolverOperation_t trans,
+                                               int                  m,
+                                               int                  n,
+                                               hipsolverComplex*    A,
+                                               int                  lda,
+                                               hipsolverComplex*    tau,
+                                               hipsolverComplex*    C,
+                                               int                  ldc,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info)
+{
+    if(!FORTRAN)
+        return hipsolverCunmtr(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    else
+        return hipsolverCunmtrFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_ormtr_unmtr(bool                    FORTRAN,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverSideMode_t     side,
+                                               hipsolverFillMode_t     uplo,
+                                               hipsolverOperation_t    trans,
+                                               int                     m,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               hipsolverDoubleComplex* tau,
+                                               hipsolverDoubleComplex* C,
+                                               int                     ldc,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info)
+{
+    if(!FORTRAN)
+        return hipsolverZunmtr(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+    else
+        return hipsolverZunmtrFortran(
+            handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info);
+}
+/********************************************************/
+
+/******************** GEBRD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgebrd_bufferSize(handle, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSgebrd_bufferSizeFortran(handle, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverSgebrdStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgebrdStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgebrd_bufferSize(handle, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDgebrd_bufferSizeFortran(handle, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverDgebrdStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgebrdStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgebrd_bufferSize(handle, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCgebrd_bufferSizeFortran(handle, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverCgebrdStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgebrdStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgebrd_bufferSize(handle, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZgebrd_bufferSizeFortran(handle, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverZgebrdStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgebrdStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            D,
+                                         int               stD,
+                                         float*            E,
+                                         int               stE,
+                                         float*            tauq,
+                                         int               stQ,
+                                         float*            taup,
+                                         int               stP,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSgebrdStridedBatched(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgebrdStridedBatchedFortran(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         double*           D,
+                                         int               stD,
+                                         double*           E,
+                                         int               stE,
+                                         double*           tauq,
+                                         int               stQ,
+                                         double*           taup,
+                                         int               stP,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDgebrdStridedBatched(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgebrdStridedBatchedFortran(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            D,
+                                         int               stD,
+                                         float*            E,
+                                         int               stE,
+                                         hipsolverComplex* tauq,
+                                         int               stQ,
+                                         hipsolverComplex* taup,
+                                         int               stP,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCgebrdStridedBatched(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgebrdStridedBatchedFortran(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         double*                 D,
+                                         int                     stD,
+                                         double*                 E,
+                                         int                     stE,
+                                         hipsolverDoubleComplex* tauq,
+                                         int                     stQ,
+                                         hipsolverDoubleComplex* taup,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZgebrdStridedBatched(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgebrdStridedBatchedFortran(
+            handle, m, n, A, lda, stA, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A[],
+                                         int               lda,
+                                         int               stA,
+                                         float*            D,
+                                         int               stD,
+                                         float*            E,
+                                         int               stE,
+                                         float*            tauq,
+                                         int               stQ,
+                                         float*            taup,
+                                         int               stP,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgebrdBatched(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgebrdBatchedFortran(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A[],
+                                         int               lda,
+                                         int               stA,
+                                         double*           D,
+                                         int               stD,
+                                         double*           E,
+                                         int               stE,
+                                         double*           tauq,
+                                         int               stQ,
+                                         double*           taup,
+                                         int               stP,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgebrdBatched(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgebrdBatchedFortran(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A[],
+                                         int               lda,
+                                         int               stA,
+                                         float*            D,
+                                         int               stD,
+                                         float*            E,
+                                         int               stE,
+                                         hipsolverComplex* tauq,
+                                         int               stQ,
+                                         hipsolverComplex* taup,
+                                         int               stP,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgebrdBatched(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgebrdBatchedFortran(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gebrd(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         double*                 D,
+                                         int                     stD,
+                                         double*                 E,
+                                         int                     stE,
+                                         hipsolverDoubleComplex* tauq,
+                                         int                     stQ,
+                                         hipsolverDoubleComplex* taup,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgebrdBatched(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgebrdBatchedFortran(
+            handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GELS ********************/
+// the strided batched functions count lwork in elements rather than bytes, and solve in
+// place in B
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   bool              STRIDED,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            A,
+                                                   int               lda,
+                                                   int               stA,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   int               stB,
+                                                   float*            X,
+                                                   int               ldx,
+                                                   size_t*           lwork,
+                                                   int               bc)
+{
+    int               lw = 0;
+    hipsolverStatus_t status;
+
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+    case C_STRIDED:
+        status = hipsolverSgelsStridedBatched_bufferSize(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(float) * lw;
+        return status;
+    case FORTRAN_STRIDED:
+        status = hipsolverSgelsStridedBatched_bufferSizeFortran(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(float) * lw;
+        return status;
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   bool              STRIDED,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int               stA,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   int               stB,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   size_t*           lwork,
+                                                   int               bc)
+{
+    int               lw = 0;
+    hipsolverStatus_t status;
+
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDDgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+    case C_STRIDED:
+        status = hipsolverDgelsStridedBatched_bufferSize(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(double) * lw;
+        return status;
+    case FORTRAN_STRIDED:
+        status = hipsolverDgelsStridedBatched_bufferSizeFortran(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(double) * lw;
+        return status;
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool              FORTRAN,
+                                                   bool              STRIDED,
+                                                   hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipsolverComplex* A,
+                                                   int               lda,
+                                                   int               stA,
+                                                   hipsolverComplex* B,
+                                                   int               ldb,
+                                                   int               stB,
+                                                   hipsolverComplex* X,
+                                                   int               ldx,
+                                                   size_t*           lwork,
+                                                   int               bc)
+{
+    int               lw = 0;
+    hipsolverStatus_t status;
+
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCCgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+    case C_STRIDED:
+        status = hipsolverCgelsStridedBatched_bufferSize(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(hipsolverComplex) * lw;
+        return status;
+    case FORTRAN_STRIDED:
+        status = hipsolverCgelsStridedBatched_bufferSizeFortran(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(hipsolverComplex) * lw;
+        return status;
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels_bufferSize(bool                    FORTRAN,
+                                                   bool                    STRIDED,
+                                                   hipsolverHandle_t       handle,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int                     stA,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   int                     stB,
+                                                   hipsolverDoubleComplex* X,
+                                                   int                     ldx,
+                                                   size_t*                 lwork,
+                                                   int                     bc)
+{
+    int               lw = 0;
+    hipsolverStatus_t status;
+
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZZgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+    case C_STRIDED:
+        status = hipsolverZgelsStridedBatched_bufferSize(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(hipsolverDoubleComplex) * lw;
+        return status;
+    case FORTRAN_STRIDED:
+        status = hipsolverZgelsStridedBatched_bufferSizeFortran(
+            handle, m, n, nrhs, A, lda, stA, B, ldb, stB, &lw, bc);
+        *lwork = sizeof(hipsolverDoubleComplex) * lw;
+        return status;
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        bool              STRIDED,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        float*            A,
+                                        int               lda,
+                                        int               stA,
+                                        float*            B,
+                                        int               ldb,
+                                        int               stB,
+                                        float*            X,
+                                        int               ldx,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSSgels(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+    case C_STRIDED:
+        return hipsolverSgelsStridedBatched(handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            stA,
+                                            B,
+                                            ldb,
+                                            stB,
+                                            (float*)work,
+                                            int(lwork / sizeof(float)),
+                                            info,
+                                            bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgelsStridedBatchedFortran(handle,
+                                                   m,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   stA,
+                                                   B,
+                                                   ldb,
+                                                   stB,
+                                                   (float*)work,
+                                                   int(lwork / sizeof(float)),
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        bool              STRIDED,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           A,
+                                        int               lda,
+                                        int               stA,
+                                        double*           B,
+                                        int               ldb,
+                                        int               stB,
+                                        double*           X,
+                                        int               ldx,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDDgels(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+    case C_STRIDED:
+        return hipsolverDgelsStridedBatched(handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            stA,
+                                            B,
+                                            ldb,
+                                            stB,
+                                            (double*)work,
+                                            int(lwork / sizeof(double)),
+                                            info,
+                                            bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgelsStridedBatchedFortran(handle,
+                                                   m,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   stA,
+                                                   B,
+                                                   ldb,
+                                                   stB,
+                                                   (double*)work,
+                                                   int(lwork / sizeof(double)),
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool              FORTRAN,
+                                        bool              STRIDED,
+                                        hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        hipsolverComplex* A,
+                                        int               lda,
+                                        int               stA,
+                                        hipsolverComplex* B,
+                                        int               ldb,
+                                        int               stB,
+                                        hipsolverComplex* X,
+                                        int               ldx,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info,
+                                        int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCCgels(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+    case C_STRIDED:
+        return hipsolverCgelsStridedBatched(handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            stA,
+                                            B,
+                                            ldb,
+                                            stB,
+                                            (hipsolverComplex*)work,
+                                            int(lwork / sizeof(hipsolverComplex)),
+                                            info,
+                                            bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgelsStridedBatchedFortran(handle,
+                                                   m,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   stA,
+                                                   B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipsolverComplex*)work,
+                                                   int(lwork / sizeof(hipsolverComplex)),
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gels(bool                    FORTRAN,
+                                        bool                    STRIDED,
+                                        hipsolverHandle_t       handle,
+                                        int                     m,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        int                     stA,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* X,
+                                        int                     ldx,
+                                        void*                   work,
+                                        size_t                  lwork,
+                                        int*                    niters,
+                                        int*                    info,
+                                        int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZZgels(
+            handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+    case C_STRIDED:
+        return hipsolverZgelsStridedBatched(handle,
+                                            m,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            stA,
+                                            B,
+                                            ldb,
+                                            stB,
+                                            (hipsolverDoubleComplex*)work,
+                                            int(lwork / sizeof(hipsolverDoubleComplex)),
+                                            info,
+                                            bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgelsStridedBatchedFortran(handle,
+                                                   m,
+                                                   n,
+                                                   nrhs,
+                                                   A,
+                                                   lda,
+                                                   stA,
+                                                   B,
+                                                   ldb,
+                                                   stB,
+                                                   (hipsolverDoubleComplex*)work,
+                                                   int(lwork / sizeof(hipsolverDoubleComplex)),
+                                                   info,
+                                                   bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GEQRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int               stP,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverSgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgeqrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int               stP,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverDgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgeqrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int               stP,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverCgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgeqrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int                     stP,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverZgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgeqrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            tau,
+                                         int               stP,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSgeqrfStridedBatched(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgeqrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         double*           tau,
+                                         int               stP,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDgeqrfStridedBatched(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgeqrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         hipsolverComplex* tau,
+                                         int               stP,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCgeqrfStridedBatched(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgeqrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZgeqrfStridedBatched(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgeqrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int               stP,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgeqrfBatched_bufferSize(handle, m, n, A, lda, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int               stP,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgeqrfBatched_bufferSize(handle, m, n, A, lda, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int               stP,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgeqrfBatched_bufferSize(handle, m, n, A, lda, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int                     stP,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgeqrfBatched_bufferSize(handle, m, n, A, lda, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A[],
+                                         int               lda,
+                                         int               stA,
+                                         float*            tau,
+                                         int               stP,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgeqrfBatched(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgeqrfBatchedFortran(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A[],
+                                         int               lda,
+                                         int               stA,
+                                         double*           tau,
+                                         int               stP,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgeqrfBatched(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgeqrfBatchedFortran(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A[],
+                                         int               lda,
+                                         int               stA,
+                                         hipsolverComplex* tau,
+                                         int               stP,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgeqrfBatched(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgeqrfBatchedFortran(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_geqrf(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgeqrfBatched(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgeqrfBatchedFortran(handle, m, n, A, lda, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GESV ********************/
+// mixed precision
+inline hipsolverStatus_t hipsolver_gesv_bufferSize(bool              FORTRAN,
+                                                   hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              ipiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   size_t*           lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDSgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesv_bufferSize(bool                    FORTRAN,
+                                                   hipsolverHandle_t       handle,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int*                    ipiv,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* X,
+                                                   int                     ldx,
+                                                   size_t*                 lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZCgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesv(bool              FORTRAN,
+                                        hipsolverHandle_t handle,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           A,
+                                        int               lda,
+                                        int*              ipiv,
+                                        double*           B,
+                                        int               ldb,
+                                        double*           X,
+                                        int               ldx,
+                                        void*             work,
+                                        size_t            lwork,
+                                        int*              niters,
+                                        int*              info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDSgesv(
+            handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesv(bool                    FORTRAN,
+                                        hipsolverHandle_t       handle,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        int*                    ipiv,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        hipsolverDoubleComplex* X,
+                                        int                     ldx,
+                                        void*                   work,
+                                        size_t                  lwork,
+                                        int*                    niters,
+                                        int*                    info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZCgesv(
+            handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GESVD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    signed char             jobu,
+                                                    signed char             jobv,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+    case C_STRIDED:
+        return hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            S,
+                                         int               stS,
+                                         float*            U,
+                                         int               ldu,
+                                         int               stU,
+                                         float*            V,
+                                         int               ldv,
+                                         int               stV,
+                                         float*            work,
+                                         int               lwork,
+                                         float*            rwork,
+                                         int               stRW,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgesvd(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgesvdFortran(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case C_STRIDED:
+        return hipsolverSgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    U,
+                                                    ldu,
+                                                    stU,
+                                                    V,
+                                                    ldv,
+                                                    stV,
+                                                    work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         double*           S,
+                                         int               stS,
+                                         double*           U,
+                                         int               ldu,
+                                         int               stU,
+                                         double*           V,
+                                         int               ldv,
+                                         int               stV,
+                                         double*           work,
+                                         int               lwork,
+                                         double*           rwork,
+                                         int               stRW,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgesvd(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgesvdFortran(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case C_STRIDED:
+        return hipsolverDgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    U,
+                                                    ldu,
+                                                    stU,
+                                                    V,
+                                                    ldv,
+                                                    stV,
+                                                    work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            S,
+                                         int               stS,
+                                         hipsolverComplex* U,
+                                         int               ldu,
+                                         int               stU,
+                                         hipsolverComplex* V,
+                                         int               ldv,
+                                         int               stV,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         float*            rwork,
+                                         int               stRW,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgesvd(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgesvdFortran(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case C_STRIDED:
+        return hipsolverCgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    U,
+                                                    ldu,
+                                                    stU,
+                                                    V,
+                                                    ldv,
+                                                    stV,
+                                                    work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         signed char             jobu,
+                                         signed char             jobv,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         double*                 S,
+                                         int                     stS,
+                                         hipsolverDoubleComplex* U,
+                                         int                     ldu,
+                                         int                     stU,
+                                         hipsolverDoubleComplex* V,
+                                         int                     ldv,
+                                         int                     stV,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         double*                 rwork,
+                                         int                     stRW,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgesvd(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZgesvdFortran(
+            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+    case C_STRIDED:
+        return hipsolverZgesvdStridedBatched(handle,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             A,
+                                             lda,
+                                             stA,
+                                             S,
+                                             stS,
+                                             U,
+                                             ldu,
+                                             stU,
+                                             V,
+                                             ldv,
+                                             stV,
+                                             work,
+                                             lwork,
+                                             rwork,
+                                             stRW,
+                                             info,
+                                             bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgesvdStridedBatchedFortran(handle,
+                                                    jobu,
+                                                    jobv,
+                                                    m,
+                                                    n,
+                                                    A,
+                                                    lda,
+                                                    stA,
+                                                    S,
+                                                    stS,
+                                                    U,
+                                                    ldu,
+                                                    stU,
+                                                    V,
+                                                    ldv,
+                                                    stV,
+                                                    work,
+                                                    lwork,
+                                                    rwork,
+                                                    stRW,
+                                                    info,
+                                                    bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GESVDJ ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(bool                  FORTRAN,
+                                                     bool                  STRIDED,
+                                                     hipsolverHandle_t     handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   econ,
+                                                     int                   m,
+                                                     int                   n,
+                                                     float*                A,
+                                                     int                   lda,
+                                                     int                   stA,
+                                                     float*                S,
+                                                     int                   stS,
+                                                     float*                U,
+                                                     int                   ldu,
+                                                     int                   stU,
+                                                     float*                V,
+                                                     int                   ldv,
+                                                     int                   stV,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t params,
+                                                     int                   bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgesvdj_bufferSize(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    case C_STRIDED:
+        return hipsolverSgesvdjBatched_bufferSize(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgesvdjBatched_bufferSizeFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(bool                  FORTRAN,
+                                                     bool                  STRIDED,
+                                                     hipsolverHandle_t     handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   econ,
+                                                     int                   m,
+                                                     int                   n,
+                                                     double*               A,
+                                                     int                   lda,
+                                                     int                   stA,
+                                                     double*               S,
+                                                     int                   stS,
+                                                     double*               U,
+                                                     int                   ldu,
+                                                     int                   stU,
+                                                     double*               V,
+                                                     int                   ldv,
+                                                     int                   stV,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t params,
+                                                     int                   bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgesvdj_bufferSize(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    case C_STRIDED:
+        return hipsolverDgesvdjBatched_bufferSize(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgesvdjBatched_bufferSizeFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(bool                  FORTRAN,
+                                                     bool                  STRIDED,
+                                                     hipsolverHandle_t     handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   econ,
+                                                     int                   m,
+                                                     int                   n,
+                                                     hipsolverComplex*     A,
+                                                     int                   lda,
+                                                     int                   stA,
+                                                     float*                S,
+                                                     int                   stS,
+                                                     hipsolverComplex*     U,
+                                                     int                   ldu,
+                                                     int                   stU,
+                                                     hipsolverComplex*     V,
+                                                     int                   ldv,
+                                                     int                   stV,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t params,
+                                                     int                   bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgesvdj_bufferSize(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    case C_STRIDED:
+        return hipsolverCgesvdjBatched_bufferSize(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgesvdjBatched_bufferSizeFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(bool                    FORTRAN,
+                                                     bool                    STRIDED,
+                                                     hipsolverHandle_t       handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     int                     econ,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     int                     stA,
+                                                     double*                 S,
+                                                     int                     stS,
+                                                     hipsolverDoubleComplex* U,
+                                                     int                     ldu,
+                                                     int                     stU,
+                                                     hipsolverDoubleComplex* V,
+                                                     int                     ldv,
+                                                     int                     stV,
+                                                     int*                    lwork,
+                                                     hipsolverGesvdjInfo_t   params,
+                                                     int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgesvdj_bufferSize(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, lwork, params);
+    case C_STRIDED:
+        return hipsolverZgesvdjBatched_bufferSize(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgesvdjBatched_bufferSizeFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj(bool                  FORTRAN,
+                                          bool                  STRIDED,
+                                          hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   econ,
+                                          int                   m,
+                                          int                   n,
+                                          float*                A,
+                                          int                   lda,
+                                          int                   stA,
+                                          float*                S,
+                                          int                   stS,
+                                          float*                U,
+                                          int                   ldu,
+                                          int                   stU,
+                                          float*                V,
+                                          int                   ldv,
+                                          int                   stV,
+                                          float*                work,
+                                          int                   lwork,
+                                          int*                  info,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgesvdj(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverSgesvdjBatched(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgesvdjBatchedFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj(bool                  FORTRAN,
+                                          bool                  STRIDED,
+                                          hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   econ,
+                                          int                   m,
+                                          int                   n,
+                                          double*               A,
+                                          int                   lda,
+                                          int                   stA,
+                                          double*               S,
+                                          int                   stS,
+                                          double*               U,
+                                          int                   ldu,
+                                          int                   stU,
+                                          double*               V,
+                                          int                   ldv,
+                                          int                   stV,
+                                          double*               work,
+                                          int                   lwork,
+                                          int*                  info,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgesvdj(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverDgesvdjBatched(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgesvdjBatchedFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj(bool                  FORTRAN,
+                                          bool                  STRIDED,
+                                          hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   econ,
+                                          int                   m,
+                                          int                   n,
+                                          hipsolverComplex*     A,
+                                          int                   lda,
+                                          int                   stA,
+                                          float*                S,
+                                          int                   stS,
+                                          hipsolverComplex*     U,
+                                          int                   ldu,
+                                          int                   stU,
+                                          hipsolverComplex*     V,
+                                          int                   ldv,
+                                          int                   stV,
+                                          hipsolverComplex*     work,
+                                          int                   lwork,
+                                          int*                  info,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgesvdj(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverCgesvdjBatched(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgesvdjBatchedFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj(bool                    FORTRAN,
+                                          bool                    STRIDED,
+                                          hipsolverHandle_t       handle,
+                                          hipsolverEigMode_t      jobz,
+                                          int                     econ,
+                                          int                     m,
+                                          int                     n,
+                                          hipsolverDoubleComplex* A,
+                                          int                     lda,
+                                          int                     stA,
+                                          double*                 S,
+                                          int                     stS,
+                                          hipsolverDoubleComplex* U,
+                                          int                     ldu,
+                                          int                     stU,
+                                          hipsolverDoubleComplex* V,
+                                          int                     ldv,
+                                          int                     stV,
+                                          hipsolverDoubleComplex* work,
+                                          int                     lwork,
+                                          int*                    info,
+                                          hipsolverGesvdjInfo_t   params,
+                                          int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgesvdj(
+            handle, jobz, econ, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverZgesvdjBatched(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgesvdjBatchedFortran(
+            handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GETRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverSgetrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgetrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverDgetrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgetrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverCgetrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgetrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
+    case C_STRIDED:
+        return hipsolverZgetrfStridedBatched_bufferSize(handle, m, n, A, lda, stA, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgetrfStridedBatched_bufferSizeFortran(
+            handle, m, n, A, lda, stA, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case C_STRIDED:
+        return hipsolverSgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverSgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverSgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case C_STRIDED:
+        return hipsolverDgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverDgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverDgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case C_STRIDED:
+        return hipsolverCgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverCgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverCgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         bool                    NPVT,
+                                         hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+    case C_STRIDED:
+        return hipsolverZgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverZgetrfStridedBatched(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverZgetrfStridedBatchedFortran(
+            handle, m, n, A, lda, stA, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A[],
+                                         int               lda,
+                                         int               stA,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrfBatched(handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A[],
+                                         int               lda,
+                                         int               stA,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrfBatched(handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         bool              NPVT,
+                                         hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A[],
+                                         int               lda,
+                                         int               stA,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              ipiv,
+                                         int               stP,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrfBatched(handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         bool                    NPVT,
+                                         hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrfBatched(handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, ipiv, stP, info, bc);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZgetrfBatchedFortran(
+            handle, m, n, A, lda, work, lwork, nullptr, stP, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GETRI ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    float*            C,
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetri_bufferSize(handle, n, A, lda, ipiv, lwork);
+    case C_STRIDED:
+        return hipsolverSgetriOutOfPlaceStridedBatched_bufferSize(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgetriOutOfPlaceStridedBatched_bufferSizeFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    double*           C,
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetri_bufferSize(handle, n, A, lda, ipiv, lwork);
+    case C_STRIDED:
+        return hipsolverDgetriOutOfPlaceStridedBatched_bufferSize(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgetriOutOfPlaceStridedBatched_bufferSizeFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    hipsolverComplex* C,
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetri_bufferSize(handle, n, A, lda, ipiv, lwork);
+    case C_STRIDED:
+        return hipsolverCgetriOutOfPlaceStridedBatched_bufferSize(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgetriOutOfPlaceStridedBatched_bufferSizeFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* C,
+                                                    int                     ldc,
+                                                    int                     stC,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetri_bufferSize(handle, n, A, lda, ipiv, lwork);
+    case C_STRIDED:
+        return hipsolverZgetriOutOfPlaceStridedBatched_bufferSize(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgetriOutOfPlaceStridedBatched_bufferSizeFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         float*            C,
+                                         int               ldc,
+                                         int               stC,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetri(handle, n, A, lda, ipiv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSgetriOutOfPlaceStridedBatched(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgetriOutOfPlaceStridedBatchedFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         double*           C,
+                                         int               ldc,
+                                         int               stC,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetri(handle, n, A, lda, ipiv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDgetriOutOfPlaceStridedBatched(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgetriOutOfPlaceStridedBatchedFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         hipsolverComplex* C,
+                                         int               ldc,
+                                         int               stC,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetri(handle, n, A, lda, ipiv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCgetriOutOfPlaceStridedBatched(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgetriOutOfPlaceStridedBatchedFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* C,
+                                         int                     ldc,
+                                         int                     stC,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetri(handle, n, A, lda, ipiv, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZgetriOutOfPlaceStridedBatched(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgetriOutOfPlaceStridedBatchedFortran(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    float*            C[],
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetriOutOfPlaceBatched_bufferSize(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetriOutOfPlaceBatched_bufferSizeFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    double*           C[],
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetriOutOfPlaceBatched_bufferSize(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetriOutOfPlaceBatched_bufferSizeFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool              FORTRAN,
+                                                    bool              STRIDED,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    hipsolverComplex* A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    hipsolverComplex* C[],
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetriOutOfPlaceBatched_bufferSize(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetriOutOfPlaceBatched_bufferSizeFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* C[],
+                                                    int                     ldc,
+                                                    int                     stC,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetriOutOfPlaceBatched_bufferSize(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetriOutOfPlaceBatched_bufferSizeFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            A[],
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         float*            C[],
+                                         int               ldc,
+                                         int               stC,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetriOutOfPlaceBatched(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetriOutOfPlaceBatchedFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           A[],
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         double*           C[],
+                                         int               ldc,
+                                         int               stC,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetriOutOfPlaceBatched(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetriOutOfPlaceBatchedFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool              FORTRAN,
+                                         bool              STRIDED,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         hipsolverComplex* A[],
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         hipsolverComplex* C[],
+                                         int               ldc,
+                                         int               stC,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetriOutOfPlaceBatched(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetriOutOfPlaceBatchedFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getri(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* C[],
+                                         int                     ldc,
+                                         int                     stC,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetriOutOfPlaceBatched(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetriOutOfPlaceBatchedFortran(
+            handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** GETRS ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    float*               A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    float*               B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverSgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgetrsStridedBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    double*              A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    double*              B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverDgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgetrsStridedBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    hipsolverComplex*    A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    hipsolverComplex*    B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverCgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgetrsStridedBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverOperation_t    trans,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int                     stB,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_STRIDED:
+        return hipsolverZgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgetrsStridedBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         float*               B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSgetrsStridedBatchedFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         double*              B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDgetrsStridedBatchedFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipsolverComplex*    A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         hipsolverComplex*    B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCgetrsStridedBatchedFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZgetrsStridedBatchedFortran(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    float*               A[],
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    float*               B[],
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrsBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrsBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    double*              A[],
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    double*              B[],
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrsBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrsBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    hipsolverComplex*    A[],
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    hipsolverComplex*    B[],
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrsBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrsBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                    FORTRAN,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverOperation_t    trans,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int                     ldb,
+                                                    int                     stB,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrsBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrsBatched_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A[],
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         float*               B[],
+                                         int                  ldb,
+                                         int                  stB,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSgetrsBatched(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrsBatchedFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A[],
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         double*              B[],
+                                         int                  ldb,
+                                         int                  stB,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrsBatched(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrsBatchedFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipsolverComplex*    A[],
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         hipsolverComplex*    B[],
+                                         int                  ldb,
+                                         int                  stB,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrsBatched(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrsBatchedFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(bool                    FORTRAN,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B[],
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrsBatched(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrsBatchedFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    else
+        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    else
+        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    else
+        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+    else
+        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    else
+        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    else
+        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    else
+        return hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info);
+    else
+        return hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    else
+        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    else
+        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    else
+        return hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    else
+        return hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    else
+        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    else
+        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(!FORTRAN)
+        return hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    else
+        return hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+}
+
+inline hipsolverStatus_t hipsolver_potrf(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    if(!FORTRAN)
+        return hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    else
+        return hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+}
+/********************************************************/
+
+/******************** POTRI ********************/
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZpotri_bufferSize(handle, uplo, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCpotri(handle, uplo, n, A, lda, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZpotri(handle, uplo, n, A, lda, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRS ********************/
+// normal
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    hipsolverComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverCgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_geqrf(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_potrs(bool                    FORTRAN,
                                          hipsolverHandle_t       handle,
-                                         int                     m,
+                                         hipsolverFillMode_t     uplo,
                                          int                     n,
-                                         hipsolverDoubleComplex* A,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A[],
                                          int                     lda,
                                          int                     stA,
-                                         hipsolverDoubleComplex* tau,
-                                         int                     stT,
+                                         hipsolverDoubleComplex* B[],
+                                         int                     ldb,
+                                         int                     stB,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
                                          int*                    info,
                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info);
-    else
-        return hipsolverZgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
 
-/******************** GESVD ********************/
+/******************** SYEVD/HEEVD ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    float*            A,
-                                                    int               lda,
-                                                    int*              lwork)
-{
-    if(!FORTRAN)
-        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    else
-        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    double*           A,
-                                                    int               lda,
-                                                    int*              lwork)
-{
-    if(!FORTRAN)
-        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    else
-        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool              FORTRAN,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    hipsolverComplex* A,
-                                                    int               lda,
-                                                    int*              lwork)
-{
-    if(!FORTRAN)
-        return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    else
-        return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    signed char             jobu,
-                                                    signed char             jobv,
-                                                    int                     m,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              D,
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
-    else
-        return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    case C_STRIDED:
+        return hipsolverSsyevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsyevdStridedBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
-                                         int               m,
-                                         int               n,
-                                         float*            A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            S,
-                                         int               stS,
-                                         float*            U,
-                                         int               ldu,
-                                         int               stU,
-                                         float*            V,
-                                         int               ldv,
-                                         int               stV,
-                                         float*            work,
-                                         int               lwork,
-                                         float*            rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             D,
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    switch(bool2marshal(FORTRAN, bc != 1))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverSgesvd(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
     case FORTRAN_NORMAL:
-        return hipsolverSgesvdFortran(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    case C_STRIDED:
+        return hipsolverDsyevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsyevdStridedBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
-                                         int               m,
-                                         int               n,
-                                         double*           A,
-                                         int               lda,
-                                         int               stA,
-                                         double*           S,
-                                         int               stS,
-                                         double*           U,
-                                         int               ldu,
-                                         int               stU,
-                                         double*           V,
-                                         int               ldv,
-                                         int               stV,
-                                         double*           work,
-                                         int               lwork,
-                                         double*           rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              D,
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    switch(bool2marshal(FORTRAN, bc != 1))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverDgesvd(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
     case FORTRAN_NORMAL:
-        return hipsolverDgesvdFortran(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverCheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    case C_STRIDED:
+        return hipsolverCheevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCheevdStridedBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool              FORTRAN,
-                                         hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
-                                         int               m,
-                                         int               n,
-                                         hipsolverComplex* A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            S,
-                                         int               stS,
-                                         hipsolverComplex* U,
-                                         int               ldu,
-                                         int               stU,
-                                         hipsolverComplex* V,
-                                         int               ldv,
-                                         int               stV,
-                                         hipsolverComplex* work,
-                                         int               lwork,
-                                         float*            rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          double*                 D,
+                                                          int                     stD,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    switch(bool2marshal(FORTRAN, bc != 1))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverCgesvd(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
     case FORTRAN_NORMAL:
-        return hipsolverCgesvdFortran(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverZheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    case C_STRIDED:
+        return hipsolverZheevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZheevdStridedBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, lwork, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         signed char             jobu,
-                                         signed char             jobv,
-                                         int                     m,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         double*                 S,
-                                         int                     stS,
-                                         hipsolverDoubleComplex* U,
-                                         int                     ldu,
-                                         int                     stU,
-                                         hipsolverDoubleComplex* V,
-                                         int                     ldv,
-                                         int                     stV,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         double*                 rwork,
-                                         int                     stRW,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    switch(bool2marshal(FORTRAN, bc != 1))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverZgesvd(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
     case FORTRAN_NORMAL:
-        return hipsolverZgesvdFortran(
-            handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info);
+        return hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSsyevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsyevdStridedBatchedFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
-
-/******************** GETRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
-{
-    if(!FORTRAN)
-        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
-{
-    if(!FORTRAN)
-        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(
-    bool FORTRAN, hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
-{
-    if(!FORTRAN)
-        return hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverCgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
-}
-
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    int                     m,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork)
-{
-    if(!FORTRAN)
-        return hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork);
-    else
-        return hipsolverZgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork);
-}
 
-inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
-                                         bool              NPVT,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         float*            A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            work,
-                                         int               lwork,
-                                         int*              ipiv,
-                                         int               stP,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             D,
+                                               int                 stD,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
     case FORTRAN_NORMAL:
-        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDsyevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsyevdStridedBatchedFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
-                                         bool              NPVT,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         double*           A,
-                                         int               lda,
-                                         int               stA,
-                                         double*           work,
-                                         int               lwork,
-                                         int*              ipiv,
-                                         int               stP,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
     case FORTRAN_NORMAL:
-        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverCheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverCheevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCheevdStridedBatchedFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(bool              FORTRAN,
-                                         bool              NPVT,
-                                         hipsolverHandle_t handle,
-                                         int               m,
-                                         int               n,
-                                         hipsolverComplex* A,
-                                         int               lda,
-                                         int               stA,
-                                         hipsolverComplex* work,
-                                         int               lwork,
-                                         int*              ipiv,
-                                         int               stP,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 D,
+                                               int                     stD,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverCgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
     case FORTRAN_NORMAL:
-        return hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverZheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZheevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZheevdStridedBatchedFortran(
+            handle, jobz, uplo, n, A, lda, stA, D, stD, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(bool                    FORTRAN,
-                                         bool                    NPVT,
-                                         hipsolverHandle_t       handle,
-                                         int                     m,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    ipiv,
-                                         int                     stP,
-                                         int*                    info,
-                                         int                     bc)
+// batched
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              D,
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    switch(bool2marshal(FORTRAN, NPVT))
+    switch(bool2marshal(FORTRAN, STRIDED, false))
     {
     case C_NORMAL:
-        return hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case C_NORMAL_ALT:
-        return hipsolverZgetrf(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverSsyevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
     case FORTRAN_NORMAL:
-        return hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, nullptr, info);
+        return hipsolverSsyevdBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
-
-/******************** GETRS ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    float*               A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    float*               B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
-{
-    if(!FORTRAN)
-        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    else
-        return hipsolverSgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-}
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    double*              A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    double*              B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             D,
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    else
-        return hipsolverDgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevdBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                 FORTRAN,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    hipsolverComplex*    A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    hipsolverComplex*    B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              D,
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    else
-        return hipsolverCgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCheevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevdBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverOperation_t    trans,
-                                                    int                     n,
-                                                    int                     nrhs,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    ipiv,
-                                                    hipsolverDoubleComplex* B,
-                                                    int                     ldb,
-                                                    int*                    lwork)
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          double*                 D,
+                                                          int                     stD,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    else
-        return hipsolverZgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZheevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevdBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         float*               A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         float*               B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         float*               work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    else
-        return hipsolverSgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevdBatched(handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevdBatchedFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         double*              A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         double*              B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         double*              work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             D,
+                                               int                 stD,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    else
-        return hipsolverDgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevdBatched(handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevdBatchedFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                 FORTRAN,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         hipsolverComplex*    A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         hipsolverComplex*    B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         hipsolverComplex*    work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A[],
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    else
-        return hipsolverCgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCheevdBatched(handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevdBatchedFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverOperation_t    trans,
-                                         int                     n,
-                                         int                     nrhs,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         int*                    ipiv,
-                                         int                     stP,
-                                         hipsolverDoubleComplex* B,
-                                         int                     ldb,
-                                         int                     stB,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_syevd_heevd(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A[],
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 D,
+                                               int                     stD,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    else
-        return hipsolverZgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZheevdBatched(handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevdBatchedFortran(
+            handle, jobz, uplo, n, A, lda, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
 
-/******************** POTRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+/******************** SYEVDX/HEEVDX ********************/
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(bool                FORTRAN,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
 {
-    if(!FORTRAN)
-        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    else
-        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(bool                FORTRAN,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            double              vl,
+                                                            double              vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            double*             W,
+                                                            int*                lwork)
 {
-    if(!FORTRAN)
-        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    else
-        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(bool                FORTRAN,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
 {
-    if(!FORTRAN)
-        return hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    else
-        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCheevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lwork,
-                                                    int                     bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(bool                    FORTRAN,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverEigRange_t     range,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            double                  vl,
+                                                            double                  vu,
+                                                            int                     il,
+                                                            int                     iu,
+                                                            int*                    nev,
+                                                            double*                 W,
+                                                            int*                    lwork)
 {
-    if(!FORTRAN)
-        return hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    else
-        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZheevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                devInfo)
 {
-    if(!FORTRAN)
-        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    else
-        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 double*             W,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                devInfo)
 {
-    if(!FORTRAN)
-        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    else
-        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 int*                devInfo)
 {
-    if(!FORTRAN)
-        return hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    else
-        return hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCheevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(bool                    FORTRAN,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int                     il,
+                                                 int                     iu,
+                                                 int*                    nev,
+                                                 double*                 W,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    devInfo)
 {
-    if(!FORTRAN)
-        return hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    else
-        return hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZheevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
+/********************************************************/
 
-// batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+/******************** SYEVJ/HEEVJ ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          float*               W,
+                                                          int                  stW,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    else
-        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_STRIDED:
+        return hipsolverSsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsyevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          double*              W,
+                                                          int                  stW,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    else
-        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_STRIDED:
+        return hipsolverDsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsyevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                FORTRAN,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(bool                 FORTRAN,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          int                  stA,
+                                                          float*               W,
+                                                          int                  stW,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    else
-        return hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCheevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_STRIDED:
+        return hipsolverCheevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCheevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(bool                    FORTRAN,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A[],
-                                                    int                     lda,
-                                                    int*                    lwork,
-                                                    int                     bc)
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          double*                 W,
+                                                          int                     stW,
+                                                          int*                    lwork,
+                                                          hipsolverSyevjInfo_t    params,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    else
-        return hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZheevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_STRIDED:
+        return hipsolverZheevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZheevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_syevj_heevj(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               float*               A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    else
-        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverSsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsyevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_syevj_heevj(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               double*              A,
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              W,
+                                               int                  stW,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    else
-        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverDsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsyevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                FORTRAN,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_syevj_heevj(bool                 FORTRAN,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               hipsolverComplex*    A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
 {
-    if(!FORTRAN)
-        return hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    else
-        return hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverCheevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverCheevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverCheevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(bool                    FORTRAN,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A[],
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_syevj_heevj(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               hipsolverSyevjInfo_t    params,
+                                               int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    else
-        return hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZheevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_STRIDED:
+        return hipsolverZheevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZheevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
 
-/******************** SYEVD/HEEVD ********************/
+/******************** SYGVD/HEGVD ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          bool                FACTORED,
                                                           hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
                                                           hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           float*              A,
                                                           int                 lda,
+                                                          int                 stA,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          int                 stB,
                                                           float*              D,
-                                                          int*                lwork)
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
-    else
-        return hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case C_STRIDED:
+        return hipsolverSsygvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case C_STRIDED_ALT:
+        return hipsolverSsygvdFactoredStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsygvdStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverSsygvdFactoredStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          bool                FACTORED,
                                                           hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
                                                           hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           double*             A,
                                                           int                 lda,
+                                                          int                 stA,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          int                 stB,
                                                           double*             D,
-                                                          int*                lwork)
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
-    else
-        return hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case C_STRIDED:
+        return hipsolverDsygvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case C_STRIDED_ALT:
+        return hipsolverDsygvdFactoredStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsygvdStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverDsygvdFactoredStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
+                                                          bool                FACTORED,
                                                           hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
                                                           hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           hipsolverComplex*   A,
                                                           int                 lda,
+                                                          int                 stA,
+                                                          hipsolverComplex*   B,
+                                                          int                 ldb,
+                                                          int                 stB,
                                                           float*              D,
-                                                          int*                lwork)
+                                                          int                 stD,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
-    else
-        return hipsolverCheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverChegvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case C_STRIDED:
+        return hipsolverChegvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case C_STRIDED_ALT:
+        return hipsolverChegvdFactoredStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverChegvdStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverChegvdFactoredStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
+                                                          bool                    FACTORED,
                                                           hipsolverHandle_t       handle,
+                                                          hipsolverEigType_t      itype,
                                                           hipsolverEigMode_t      jobz,
                                                           hipsolverFillMode_t     uplo,
                                                           int                     n,
                                                           hipsolverDoubleComplex* A,
                                                           int                     lda,
+                                                          int                     stA,
+                                                          hipsolverDoubleComplex* B,
+                                                          int                     ldb,
+                                                          int                     stB,
                                                           double*                 D,
-                                                          int*                    lwork)
+                                                          int                     stD,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
-    else
-        return hipsolverZheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZhegvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    case C_STRIDED:
+        return hipsolverZhegvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case C_STRIDED_ALT:
+        return hipsolverZhegvdFactoredStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZhegvdStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverZhegvdFactoredStridedBatched_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               bool                FACTORED,
                                                hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
                                                hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                float*              A,
                                                int                 lda,
                                                int                 stA,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 stB,
                                                float*              D,
-                                               int                 stW,
+                                               int                 stD,
                                                float*              work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
-    else
-        return hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSsygvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverSsygvdFactoredStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsygvdStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverSsygvdFactoredStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               bool                FACTORED,
                                                hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
                                                hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                double*             A,
                                                int                 lda,
                                                int                 stA,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 stB,
                                                double*             D,
-                                               int                 stW,
+                                               int                 stD,
                                                double*             work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
-    else
-        return hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDsygvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverDsygvdFactoredStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsygvdStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverDsygvdFactoredStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+                                               bool                STRIDED,
+                                               bool                FACTORED,
                                                hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
                                                hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                hipsolverComplex*   A,
                                                int                 lda,
                                                int                 stA,
+                                               hipsolverComplex*   B,
+                                               int                 ldb,
+                                               int                 stB,
                                                float*              D,
-                                               int                 stW,
+                                               int                 stD,
                                                hipsolverComplex*   work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
-    else
-        return hipsolverCheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverChegvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverChegvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverChegvdFactoredStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverChegvdStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverChegvdFactoredStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                    FORTRAN,
+                                               bool                    STRIDED,
+                                               bool                    FACTORED,
                                                hipsolverHandle_t       handle,
+                                               hipsolverEigType_t      itype,
                                                hipsolverEigMode_t      jobz,
                                                hipsolverFillMode_t     uplo,
                                                int                     n,
                                                hipsolverDoubleComplex* A,
                                                int                     lda,
                                                int                     stA,
+                                               hipsolverDoubleComplex* B,
+                                               int                     ldb,
+                                               int                     stB,
                                                double*                 D,
-                                               int                     stW,
+                                               int                     stD,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
                                                int*                    info,
                                                int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
-    else
-        return hipsolverZheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, FACTORED))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZhegvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZhegvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case C_STRIDED_ALT:
+        return hipsolverZhegvdFactoredStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZhegvdStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    case FORTRAN_STRIDED_ALT:
+        return hipsolverZhegvdFactoredStridedBatchedFortran(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, D, stD, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYGVDX/HEGVDX ********************/
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(bool                FORTRAN,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            float*              B,
+                                                            int                 ldb,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(bool                FORTRAN,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            double*             B,
+                                                            int                 ldb,
+                                                            double              vl,
+                                                            double              vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            double*             W,
+                                                            int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(bool                FORTRAN,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            hipsolverComplex*   B,
+                                                            int                 ldb,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverChegvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(bool                    FORTRAN,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverEigType_t      itype,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverEigRange_t     range,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            hipsolverDoubleComplex* B,
+                                                            int                     ldb,
+                                                            double                  vl,
+                                                            double                  vu,
+                                                            int                     il,
+                                                            int                     iu,
+                                                            int*                    nev,
+                                                            double*                 W,
+                                                            int*                    lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 float*              B,
+                                                 int                 ldb,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                devInfo)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 double*             B,
+                                                 int                 ldb,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 double*             W,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                devInfo)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(bool                FORTRAN,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 hipsolverComplex*   B,
+                                                 int                 ldb,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 int*                devInfo)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverChegvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(bool                    FORTRAN,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverEigType_t      itype,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 hipsolverDoubleComplex* B,
+                                                 int                     ldb,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int                     il,
+                                                 int                     iu,
+                                                 int*                    nev,
+                                                 double*                 W,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    devInfo)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                devInfo);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
 
-/******************** SYGVD/HEGVD ********************/
+/******************** SYTRD/HETRD ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           float*              A,
                                                           int                 lda,
-                                                          float*              B,
-                                                          int                 ldb,
+                                                          int                 stA,
                                                           float*              D,
-                                                          int*                lwork)
+                                                          int                 stD,
+                                                          float*              E,
+                                                          int                 stE,
+                                                          float*              tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
-    else
-        return hipsolverSsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case C_STRIDED:
+        return hipsolverSsytrdStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsytrdStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           double*             A,
                                                           int                 lda,
-                                                          double*             B,
-                                                          int                 ldb,
+                                                          int                 stA,
                                                           double*             D,
-                                                          int*                lwork)
+                                                          int                 stD,
+                                                          double*             E,
+                                                          int                 stE,
+                                                          double*             tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
-    else
-        return hipsolverDsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case C_STRIDED:
+        return hipsolverDsytrdStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsytrdStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
                                                           hipsolverComplex*   A,
                                                           int                 lda,
-                                                          hipsolverComplex*   B,
-                                                          int                 ldb,
+                                                          int                 stA,
                                                           float*              D,
-                                                          int*                lwork)
+                                                          int                 stD,
+                                                          float*              E,
+                                                          int                 stE,
+                                                          hipsolverComplex*   tau,
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
-    else
-        return hipsolverChegvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverChetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case C_STRIDED:
+        return hipsolverChetrdStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverChetrdStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
-                                                          hipsolverEigType_t      itype,
-                                                          hipsolverEigMode_t      jobz,
                                                           hipsolverFillMode_t     uplo,
                                                           int                     n,
                                                           hipsolverDoubleComplex* A,
                                                           int                     lda,
-                                                          hipsolverDoubleComplex* B,
-                                                          int                     ldb,
+                                                          int                     stA,
                                                           double*                 D,
-                                                          int*                    lwork)
+                                                          int                     stD,
+                                                          double*                 E,
+                                                          int                     stE,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
-    else
-        return hipsolverZhegvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case FORTRAN_NORMAL:
+        return hipsolverZhetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case C_STRIDED:
+        return hipsolverZhetrdStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZhetrdStridedBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                float*              A,
                                                int                 lda,
                                                int                 stA,
-                                               float*              B,
-                                               int                 ldb,
-                                               int                 stB,
                                                float*              D,
-                                               int                 stW,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               float*              tau,
+                                               int                 stP,
                                                float*              work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
-    else
-        return hipsolverSsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverSsytrdStridedBatched(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverSsytrdStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                double*             A,
                                                int                 lda,
                                                int                 stA,
-                                               double*             B,
-                                               int                 ldb,
-                                               int                 stB,
                                                double*             D,
-                                               int                 stW,
+                                               int                 stD,
+                                               double*             E,
+                                               int                 stE,
+                                               double*             tau,
+                                               int                 stP,
                                                double*             work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
-    else
-        return hipsolverDsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverDsytrdStridedBatched(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverDsytrdStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
                                                hipsolverComplex*   A,
                                                int                 lda,
                                                int                 stA,
-                                               hipsolverComplex*   B,
-                                               int                 ldb,
-                                               int                 stB,
                                                float*              D,
-                                               int                 stW,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               hipsolverComplex*   tau,
+                                               int                 stP,
                                                hipsolverComplex*   work,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
-    else
-        return hipsolverChegvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverChetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverChetrdStridedBatched(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverChetrdStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(bool                    FORTRAN,
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                    FORTRAN,
+                                               bool                    STRIDED,
                                                hipsolverHandle_t       handle,
-                                               hipsolverEigType_t      itype,
-                                               hipsolverEigMode_t      jobz,
                                                hipsolverFillMode_t     uplo,
                                                int                     n,
                                                hipsolverDoubleComplex* A,
                                                int                     lda,
                                                int                     stA,
-                                               hipsolverDoubleComplex* B,
-                                               int                     ldb,
-                                               int                     stB,
                                                double*                 D,
-                                               int                     stW,
+                                               int                     stD,
+                                               double*                 E,
+                                               int                     stE,
+                                               hipsolverDoubleComplex* tau,
+                                               int                     stP,
                                                hipsolverDoubleComplex* work,
                                                int                     lwork,
                                                int*                    info,
                                                int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
-    else
-        return hipsolverZhegvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case FORTRAN_NORMAL:
+        return hipsolverZhetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case C_STRIDED:
+        return hipsolverZhetrdStridedBatched(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_STRIDED:
+        return hipsolverZhetrdStridedBatchedFortran(
+            handle, uplo, n, A, lda, stA, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
-/********************************************************/
 
-/******************** SYTRD/HETRD ********************/
-// normal and strided_batched
+// batched
 inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
-                                                          float*              A,
+                                                          float*              A[],
                                                           int                 lda,
+                                                          int                 stA,
                                                           float*              D,
+                                                          int                 stD,
                                                           float*              E,
+                                                          int                 stE,
                                                           float*              tau,
-                                                          int*                lwork)
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    else
-        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrdBatched_bufferSize(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsytrdBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
-                                                          double*             A,
+                                                          double*             A[],
                                                           int                 lda,
+                                                          int                 stA,
                                                           double*             D,
+                                                          int                 stD,
                                                           double*             E,
+                                                          int                 stE,
                                                           double*             tau,
-                                                          int*                lwork)
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    else
-        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrdBatched_bufferSize(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsytrdBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                FORTRAN,
+                                                          bool                STRIDED,
                                                           hipsolverHandle_t   handle,
                                                           hipsolverFillMode_t uplo,
                                                           int                 n,
-                                                          hipsolverComplex*   A,
+                                                          hipsolverComplex*   A[],
                                                           int                 lda,
+                                                          int                 stA,
                                                           float*              D,
+                                                          int                 stD,
                                                           float*              E,
+                                                          int                 stE,
                                                           hipsolverComplex*   tau,
-                                                          int*                lwork)
+                                                          int                 stP,
+                                                          int*                lwork,
+                                                          int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    else
-        return hipsolverChetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverChetrdBatched_bufferSize(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverChetrdBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(bool                    FORTRAN,
+                                                          bool                    STRIDED,
                                                           hipsolverHandle_t       handle,
                                                           hipsolverFillMode_t     uplo,
                                                           int                     n,
-                                                          hipsolverDoubleComplex* A,
+                                                          hipsolverDoubleComplex* A[],
                                                           int                     lda,
+                                                          int                     stA,
                                                           double*                 D,
+                                                          int                     stD,
                                                           double*                 E,
+                                                          int                     stE,
                                                           hipsolverDoubleComplex* tau,
-                                                          int*                    lwork)
+                                                          int                     stP,
+                                                          int*                    lwork,
+                                                          int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    else
-        return hipsolverZhetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZhetrdBatched_bufferSize(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZhetrdBatched_bufferSizeFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, lwork, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
-                                               float*              A,
+                                               float*              A[],
                                                int                 lda,
                                                int                 stA,
                                                float*              D,
@@ -2350,18 +8959,26 @@ inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
                                                int                 lwork,
                                                int*                info,
                                                int                 bc)
-{
-    if(!FORTRAN)
-        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    else
-        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+{
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrdBatched(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsytrdBatchedFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
-                                               double*             A,
+                                               double*             A[],
                                                int                 lda,
                                                int                 stA,
                                                double*             D,
@@ -2375,17 +8992,25 @@ inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    else
-        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrdBatched(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsytrdBatchedFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
+                                               bool                STRIDED,
                                                hipsolverHandle_t   handle,
                                                hipsolverFillMode_t uplo,
                                                int                 n,
-                                               hipsolverComplex*   A,
+                                               hipsolverComplex*   A[],
                                                int                 lda,
                                                int                 stA,
                                                float*              D,
@@ -2399,17 +9024,25 @@ inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                FORTRAN,
                                                int*                info,
                                                int                 bc)
 {
-    if(!FORTRAN)
-        return hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    else
-        return hipsolverChetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverChetrdBatched(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverChetrdBatchedFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
 inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                    FORTRAN,
+                                               bool                    STRIDED,
                                                hipsolverHandle_t       handle,
                                                hipsolverFillMode_t     uplo,
                                                int                     n,
-                                               hipsolverDoubleComplex* A,
+                                               hipsolverDoubleComplex* A[],
                                                int                     lda,
                                                int                     stA,
                                                double*                 D,
@@ -2423,9 +9056,324 @@ inline hipsolverStatus_t hipsolver_sytrd_hetrd(bool                    FORTRAN,
                                                int*                    info,
                                                int                     bc)
 {
-    if(!FORTRAN)
-        return hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    else
-        return hipsolverZhetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    switch(bool2marshal(FORTRAN, STRIDED, false))
+    {
+    case C_NORMAL:
+        return hipsolverZhetrdBatched(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZhetrdBatchedFortran(
+            handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRF ********************/
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCsytrf_bufferSize(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    bool FORTRAN, hipsolverHandle_t handle, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZsytrf_bufferSize(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int*                ipiv,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int*                ipiv,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int*                ipiv,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int*                    ipiv,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRS ********************/
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                FORTRAN,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                ipiv,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int*                lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(bool                    FORTRAN,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    ipiv,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZsytrs_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int*                ipiv,
+                                         float*              B,
+                                         int                 ldb,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int*                ipiv,
+                                         double*             B,
+                                         int                 ldb,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(bool                FORTRAN,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int*                ipiv,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverCsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(bool                    FORTRAN,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int*                    ipiv,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info)
+{
+    switch(bool2marshal(FORTRAN, false))
+    {
+    case C_NORMAL:
+        return hipsolverZsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 /********************************************************/
@@ -0,0 +1,552 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../rocsolvercommon/rocsolver_arguments.hpp"
+
+/*
+ * ===========================================================================
+ *    Machine-readable benchmark reports. The hot calls of every getPerfData
+ *    append their individual times to hipsolver_bench_samples(); after the
+ *    benchmark has run, the client combines these samples with the flop and
+ *    memory-traffic models below into a CSV or JSON record.
+ * ===========================================================================
+ */
+
+// times (in microseconds) of the hot calls of the current benchmark run
+inline std::vector<double>& hipsolver_bench_samples()
+{
+    static std::vector<double> samples;
+    return samples;
+}
+
+struct hipsolver_bench_stats
+{
+    double min    = 0;
+    double median = 0;
+    double p95    = 0;
+    double max    = 0;
+    double mean   = 0;
+};
+
+inline hipsolver_bench_stats hipsolver_bench_compute_stats(std::vector<double> samples)
+{
+    hipsolver_bench_stats stats;
+    size_t                count = samples.size();
+    if(count == 0)
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+
+    double sum = 0;
+    for(double s : samples)
+        sum += s;
+
+    // nearest-rank definition of the 95th percentile
+    size_t rank95 = size_t(std::ceil(0.95 * count));
+
+    stats.min    = samples.front();
+    stats.max    = samples.back();
+    stats.mean   = sum / count;
+    stats.p95    = samples[std::max(rank95, size_t(1)) - 1];
+    stats.median = (count % 2) ? samples[count / 2]
+                               : (samples[count / 2 - 1] + samples[count / 2]) / 2;
+    return stats;
+}
+
+/* The size parameters of a benchmark run and its approximate operation count and memory
+   traffic. Operation counts follow the usual LAPACK models (LAWN 41, Golub & Van Loan) and
+   count complex operations as four real operations. Memory traffic assumes that every
+   referenced matrix is read and written once, which makes the bandwidth a lower bound. */
+struct hipsolver_bench_model
+{
+    int    m           = 0;
+    int    n           = 0;
+    int    k           = 0;
+    int    nrhs        = 0;
+    int    batch_count = 1;
+    double flops       = 0;
+    double bytes       = 0;
+};
+
+// fills the model of the given function; returns false if the function has no model
+inline bool hipsolver_bench_get_model(const std::string&     function,
+                                      char                   precision,
+                                      Arguments&             argus,
+                                      hipsolver_bench_model& model)
+{
+    std::string name  = function;
+    model.batch_count = 1;
+    for(const std::string suffix : {"_strided_batched", "_batched"})
+    {
+        if(name.size() > suffix.size()
+           && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+        {
+            name.erase(name.size() - suffix.size());
+            model.batch_count = argus.batch_count;
+            break;
+        }
+    }
+
+    // complex names share the model of their real counterparts
+    if(name.compare(0, 2, "un") == 0)
+        name.replace(0, 2, "or");
+    else if(name.compare(0, 2, "he") == 0)
+        name.replace(0, 2, "sy");
+
+    double m, n, k, nrhs, mn, mx, flops, elems;
+    if(name == "getrf" || name == "getrf_npvt")
+    {
+        model.m = argus.get<int>("m");
+        model.n = argus.get<int>("n", model.m);
+        m = model.m, n = model.n, mn = std::min(m, n), mx = std::max(m, n);
+        flops = mx * mn * mn - mn * mn * mn / 3;
+        elems = 2 * m * n;
+    }
+    else if(name == "getrs" || name == "potrs" || name == "sytrs")
+    {
+        model.n    = argus.get<int>("n");
+        model.nrhs = argus.get<int>("nrhs", model.n);
+        n = model.n, nrhs = model.nrhs;
+        flops = 2 * n * n * nrhs;
+        elems = n * n + 2 * n * nrhs;
+    }
+    else if(name == "gels")
+    {
+        model.m    = argus.get<int>("m");
+        model.n    = argus.get<int>("n", model.m);
+        model.nrhs = argus.get<int>("nrhs", model.n);
+        m = model.m, n = model.n, nrhs = model.nrhs;
+        flops = 2 * m * n * n - 2 * n * n * n / 3 + (4 * m * n - n * n) * nrhs;
+        elems = m * n + m * nrhs + n * nrhs;
+    }
+    else if(name == "gesv")
+    {
+        model.n    = argus.get<int>("n");
+        model.nrhs = argus.get<int>("nrhs", model.n);
+        n = model.n, nrhs = model.nrhs;
+        flops = 2 * n * n * n / 3 + 2 * n * n * nrhs;
+        elems = 2 * n * n + 2 * n * nrhs;
+    }
+    else if(name == "potrf" || name == "potri" || name == "orgtr" || name == "sytrd"
+            || name == "sytrf" || name == "getri" || name == "getri_outofplace")
+    {
+        model.n = argus.get<int>("n");
+        n       = model.n;
+        if(name == "potrf" || name == "sytrf")
+            flops = n * n * n / 3;
+        else if(name == "potri")
+            flops = 2 * n * n * n / 3;
+        else
+            flops = 4 * n * n * n / 3;
+        elems = 2 * n * n;
+    }
+    else if(name == "geqrf" || name == "gebrd")
+    {
+        model.m = argus.get<int>("m");
+        model.n = argus.get<int>("n", model.m);
+        m = model.m, n = model.n, mn = std::min(m, n), mx = std::max(m, n);
+        flops = (name == "geqrf" ? 2 : 4) * (mx * mn * mn - mn * mn * mn / 3);
+        elems = 2 * m * n;
+    }
+    else if(name == "orgqr" || name == "orgbr")
+    {
+        if(name == "orgbr" && argus.get<char>("side") == 'R')
+        {
+            model.m = argus.get<int>("m");
+            model.n = argus.get<int>("n", model.m);
+        }
+        else
+        {
+            model.n = argus.get<int>("n");
+            model.m = argus.get<int>("m", model.n);
+        }
+        model.k = argus.get<int>("k", name == "orgqr" ? model.n : std::min(model.m, model.n));
+        m = model.m, n = model.n, k = model.k;
+        flops = 4 * m * n * k - 2 * (m + n) * k * k + 4 * k * k * k / 3;
+        elems = 2 * m * n;
+    }
+    else if(name == "ormqr" || name == "ormtr")
+    {
+        bool left = argus.get<char>("side") == 'L';
+        if(left)
+        {
+            model.m = argus.get<int>("m");
+            model.n = argus.get<int>("n", model.m);
+        }
+        else
+        {
+            model.n = argus.get<int>("n");
+            model.m = argus.get<int>("m", model.n);
+        }
+        m = model.m, n = model.n;
+        if(name == "ormqr")
+        {
+            model.k = argus.get<int>("k", left ? model.m : model.n);
+            k       = model.k;
+            flops   = 4 * m * n * k - 2 * (left ? n : m) * k * k;
+            elems   = 2 * m * n + (left ? m : n) * k;
+        }
+        else
+        {
+            double nq = left ? m : n;
+            flops     = 2 * nq * m * n;
+            elems     = 2 * m * n + nq * nq;
+        }
+    }
+    else if(name == "syevj")
+    {
+        // about six sweeps, each applying n^2 / 2 rotations to the rows and columns of A
+        model.n      = argus.get<int>("n");
+        n            = model.n;
+        bool vectors = argus.get<char>("jobz") == 'V';
+        flops        = 6 * (vectors ? 6 : 4) * n * n * n;
+        elems        = 2 * n * n;
+    }
+    else if(name == "syevd" || name == "sygvd")
+    {
+        model.n      = argus.get<int>("n");
+        n            = model.n;
+        bool vectors = argus.get<char>("jobz") == 'V';
+        flops        = (vectors ? 9 : 4.0 / 3) * n * n * n;
+        elems        = 2 * n * n;
+        if(name == "sygvd")
+        {
+            // Cholesky factorization, reduction to standard form and back-transformation
+            flops += n * n * n / 3 + n * n * n + (vectors ? n * n * n : 0);
+            elems += 2 * n * n;
+        }
+    }
+    else if(name == "syevdx" || name == "sygvdx")
+    {
+        model.n      = argus.get<int>("n");
+        n            = model.n;
+        bool vectors = argus.get<char>("jobz") == 'V';
+        double k     = n;
+        if(argus.get<char>("range") == 'I')
+            k = argus.get<int>("iu", model.n) - argus.get<int>("il", 1) + 1;
+
+        // tridiagonal reduction, and back-transformation of the k selected eigenvectors
+        flops = 4.0 / 3 * n * n * n + (vectors ? 2 * n * n * k : 0);
+        elems = 2 * n * n;
+        if(name == "sygvdx")
+        {
+            flops += n * n * n / 3 + n * n * n + (vectors ? n * n * k : 0);
+            elems += 2 * n * n;
+        }
+    }
+    else if(name == "gesvd" || name == "gesvdj")
+    {
+        model.m = argus.get<int>("m");
+        model.n = argus.get<int>("n", model.m);
+        m = model.m, n = model.n, mn = std::min(m, n), mx = std::max(m, n);
+        bool vectors
+            = (name == "gesvd")
+                  ? (argus.get<char>("jobu") != 'N' || argus.get<char>("jobv") != 'N')
+                  : argus.get<char>("jobz") == 'V';
+        if(vectors)
+        {
+            flops = 4 * mx * mx * mn + 8 * mx * mn * mn + 9 * mn * mn * mn;
+            elems = 2 * m * n + m * m + n * n;
+        }
+        else
+        {
+            flops = 4 * mx * mn * mn - 4 * mn * mn * mn / 3;
+            elems = 2 * m * n;
+        }
+    }
+    else
+        return false;
+
+    bool   is_complex = (precision == 'c' || precision == 'z');
+    double elem_size  = (precision == 's') ? 4 : (precision == 'z') ? 16 : 8;
+
+    model.flops = double(model.batch_count) * flops * (is_complex ? 4 : 1);
+    model.bytes = double(model.batch_count) * elems * elem_size;
+    return true;
+}
+
+struct hipsolver_bench_record
+{
+    std::string           function;
+    char                  precision;
+    int                   iters;
+    int                   problems = 1; // problems solved per timed call
+    std::string           timing   = "wall";
+
+    // kernel launches and memory copies per timed call, or negative if they were not counted
+    double launches = -1;
+    double memcpys  = -1;
+
+    hipsolver_bench_model model;
+    hipsolver_bench_stats stats;
+};
+
+/* Writes benchmark records in CSV or JSON format. The CSV header is written before the first
+   record; JSON records are collected in an array that is closed when the writer is destroyed.
+   GFLOP/s, GB/s and solves per second are derived from the median time; the launches and copies
+   per call are left empty when they were not counted. */
+class hipsolver_bench_writer
+{
+    std::ostream&     os;
+    const std::string format;
+    size_t            count = 0;
+
+public:
+    hipsolver_bench_writer(const std::string& format, std::ostream& os = std::cout)
+        : os(os)
+        , format(format)
+    {
+    }
+
+    ~hipsolver_bench_writer()
+    {
+        if(format == "json")
+            os << (count ? "\n]" : "[]") << std::endl;
+    }
+
+    // the supported output formats
+    static bool is_valid(const std::string& format)
+    {
+        return format == "text" || format == "csv" || format == "json";
+    }
+
+    void write(const hipsolver_bench_record& r)
+    {
+        const hipsolver_bench_model& md = r.model;
+        const hipsolver_bench_stats& st = r.stats;
+
+        double scale  = (st.median > 0) ? r.problems / (st.median * 1e3) : 0;
+        double gflops = md.flops * scale;
+        double gbps   = md.bytes * scale;
+        double solves = double(md.batch_count) * scale * 1e9;
+
+        if(format == "csv")
+        {
+            if(count == 0)
+                os << "function,precision,m,n,k,nrhs,batch_count,problems,iters,min_us,median_us,"
+                      "p95_us,max_us,mean_us,gflops,gbytes_per_s,solves_per_s,timing,"
+                      "launches_per_call,memcpys_per_call\n";
+            os << r.function << ',' << r.precision << ',' << md.m << ',' << md.n << ',' << md.k
+               << ',' << md.nrhs << ',' << md.batch_count << ',' << r.problems << ',' << r.iters
+               << ',' << st.min << ',' << st.median << ',' << st.p95 << ',' << st.max << ','
+               << st.mean << ',' << gflops << ',' << gbps << ',' << solves << ',' << r.timing
+               << ',';
+            if(r.launches >= 0)
+                os << r.launches << ',' << r.memcpys;
+            else
+                os << ',';
+            os << std::endl;
+        }
+        else if(format == "json")
+        {
+            os << (count ? ",\n" : "[\n");
+            os << "  {\"function\": \"" << r.function << "\", \"precision\": \"" << r.precision
+               << "\", \"m\": " << md.m << ", \"n\": " << md.n << ", \"k\": " << md.k
+               << ", \"nrhs\": " << md.nrhs << ", \"batch_count\": " << md.batch_count
+               << ", \"problems\": " << r.problems << ", \"iters\": " << r.iters
+               << ", \"min_us\": " << st.min << ", \"median_us\": " << st.median
+               << ", \"p95_us\": " << st.p95 << ", \"max_us\": " << st.max
+               << ", \"mean_us\": " << st.mean << ", \"gflops\": " << gflops
+               << ", \"gbytes_per_s\": " << gbps << ", \"solves_per_s\": " << solves
+               << ", \"timing\": \"" << r.timing << '"';
+            if(r.launches >= 0)
+                os << ", \"launches_per_call\": " << r.launches
+                   << ", \"memcpys_per_call\": " << r.memcpys;
+            os << "}";
+            os.flush();
+        }
+        else
+            return;
+
+        count++;
+    }
+};
+
+/* Baseline of a performance regression run: the CSV records written by an earlier run of the
+   same test list on the same GPU architecture. A record regresses when its median time exceeds
+   the baseline median by more than the tolerance; an optional tolerance column of the baseline
+   overrides the default tolerance of its row. Lines starting with # are comments. */
+class hipsolver_bench_baseline
+{
+    struct entry
+    {
+        double median_us;
+        double tolerance;
+        bool   seen = false;
+    };
+
+    struct result
+    {
+        std::string key;
+        double      baseline_us;
+        double      current_us;
+        double      tolerance;
+    };
+
+    std::map<std::string, entry> entries;
+    std::vector<result>          results;
+    std::vector<std::string>     unknown;
+
+    // identifies a record by its function and sizes
+    static std::string make_key(const std::string& function,
+                                const std::string& precision,
+                                const std::string& m,
+                                const std::string& n,
+                                const std::string& k,
+                                const std::string& nrhs,
+                                const std::string& batch_count,
+                                const std::string& problems)
+    {
+        return function + " -r " + precision + " m=" + m + " n=" + n + " k=" + k + " nrhs=" + nrhs
+               + " batch_count=" + batch_count + " problems=" + problems;
+    }
+
+    static std::vector<std::string> split(const std::string& line)
+    {
+        std::vector<std::string> fields;
+        std::istringstream       ss(line);
+        std::string              field;
+        while(std::getline(ss, field, ','))
+            fields.push_back(field);
+        return fields;
+    }
+
+public:
+    // reads the baseline at path; throws std::invalid_argument if it cannot be read
+    void load(const std::string& path, double tolerance)
+    {
+        std::ifstream file(path);
+        if(!file)
+            throw std::invalid_argument("Cannot open baseline " + path);
+
+        std::map<std::string, size_t> column;
+        std::string                   line;
+        while(std::getline(file, line))
+        {
+            if(line.empty() || line[0] == '#')
+                continue;
+
+            std::vector<std::string> fields = split(line);
+            if(column.empty())
+            {
+                for(size_t i = 0; i < fields.size(); i++)
+                    column[fields[i]] = i;
+                for(const char* name : {"function",
+                                        "precision",
+                                        "m",
+                                        "n",
+                                        "k",
+                                        "nrhs",
+                                        "batch_count",
+                                        "problems",
+                                        "median_us"})
+                    if(!column.count(name))
+                        throw std::invalid_argument("Missing column " + std::string(name)
+                                                    + " in baseline " + path);
+                continue;
+            }
+
+            auto field = [&](const char* name) {
+                size_t i = column[name];
+                return i < fields.size() ? fields[i] : std::string();
+            };
+
+            entry e;
+            e.median_us = std::stod(field("median_us"));
+            e.tolerance = tolerance;
+            if(column.count("tolerance") && !field("tolerance").empty())
+                e.tolerance = std::stod(field("tolerance"));
+
+            entries[make_key(field("function"),
+                             field("precision"),
+                             field("m"),
+                             field("n"),
+                             field("k"),
+                             field("nrhs"),
+                             field("batch_count"),
+                             field("problems"))]
+                = e;
+        }
+    }
+
+    // compares a record with its baseline
+    void check(const hipsolver_bench_record& r)
+    {
+        const hipsolver_bench_model& md  = r.model;
+        std::string                  key = make_key(r.function,
+                                   std::string(1, r.precision),
+                                   std::to_string(md.m),
+                                   std::to_string(md.n),
+                                   std::to_string(md.k),
+                                   std::to_string(md.nrhs),
+                                   std::to_string(md.batch_count),
+                                   std::to_string(r.problems));
+
+        auto it = entries.find(key);
+        if(it == entries.end())
+        {
+            unknown.push_back(key);
+            return;
+        }
+
+        it->second.seen = true;
+        results.push_back({key, it->second.median_us, r.stats.median, it->second.tolerance});
+    }
+
+    /* Writes the comparison of every checked record, followed by the records missing from
+       the baseline and the baseline records that were not run. Returns the number of
+       regressions. */
+    int report(std::ostream& os) const
+    {
+        int regressions = 0;
+
+        os << std::left << std::setw(10) << "status" << std::right << std::setw(14)
+           << "baseline_us" << std::setw(14) << "current_us" << std::setw(10) << "change"
+           << std::setw(10) << "tolerance"
+           << "  case\n";
+        for(const result& r : results)
+        {
+            double      change = r.baseline_us > 0 ? r.current_us / r.baseline_us - 1 : 0;
+            const char* status = "ok";
+            if(change > r.tolerance)
+            {
+                status = "REGRESSED";
+                regressions++;
+            }
+            else if(change < -r.tolerance)
+                status = "improved";
+
+            os << std::left << std::setw(10) << status << std::right << std::fixed
+               << std::setprecision(1) << std::setw(14) << r.baseline_us << std::setw(14)
+               << r.current_us << std::showpos << std::setw(9) << 100 * change << '%'
+               << std::noshowpos << std::setw(9) << 100 * r.tolerance << '%' << "  " << r.key
+               << '\n';
+        }
+        os.unsetf(std::ios::floatfield);
+
+        for(const std::string& key : unknown)
+            os << std::left << std::setw(10) << "new" << std::right << std::setw(52) << ""
+               << "  " << key << '\n';
+        for(const auto& e : entries)
+            if(!e.second.seen)
+                os << std::left << std::setw(10) << "not run" << std::right << std::setw(52) << ""
+                   << "  " << e.first << '\n';
+
+        os << regressions << " of " << results.size() << " cases regressed" << std::endl;
+        return regressions;
+    }
+};
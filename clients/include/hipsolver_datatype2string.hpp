@@ -52,6 +52,10 @@ inline constexpr auto hipsolver2string_status(hipsolverStatus_t value)
         return "HIPSOLVER_STATUS_INVALID_ENUM";
     case HIPSOLVER_STATUS_UNKNOWN:
         return "HIPSOLVER_STATUS_UNKNOWN";
+    case HIPSOLVER_STATUS_CAPTURE_UNSAFE:
+        return "HIPSOLVER_STATUS_CAPTURE_UNSAFE";
+    case HIPSOLVER_STATUS_ZERO_PIVOT:
+        return "HIPSOLVER_STATUS_ZERO_PIVOT";
     default:
         throw std::invalid_argument("Invalid enum");
     }
@@ -67,6 +71,8 @@ char hipsolver2char_evect(hipsolverEigMode_t value);
 
 char hipsolver2char_eform(hipsolverEigType_t value);
 
+char hipsolver2char_erange(hipsolverEigRange_t value);
+
 /* ============================================================================================ */
 /*  Convert lapack char constants to hipsolver type. */
 
@@ -81,3 +87,5 @@ hipsolverSideMode_t char2hipsolver_side(char value);
 hipsolverEigMode_t char2hipsolver_evect(char value);
 
 hipsolverEigType_t char2hipsolver_eform(char value);
+
+hipsolverEigRange_t char2hipsolver_erange(char value);
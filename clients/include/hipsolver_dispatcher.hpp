@@ -8,11 +8,16 @@
 #include <map>
 #include <string>
 
+#include "testing_concurrent.hpp"
 #include "testing_gebrd.hpp"
+#include "testing_gels.hpp"
 #include "testing_geqrf.hpp"
+#include "testing_gesv.hpp"
 #include "testing_gesvd.hpp"
+#include "testing_gesvdj.hpp"
 #include "testing_getrf.hpp"
 #include "testing_getrf_npvt.hpp"
+#include "testing_getri.hpp"
 #include "testing_getrs.hpp"
 #include "testing_orgbr_ungbr.hpp"
 #include "testing_orgqr_ungqr.hpp"
@@ -20,9 +25,17 @@
 #include "testing_ormqr_unmqr.hpp"
 #include "testing_ormtr_unmtr.hpp"
 #include "testing_potrf.hpp"
+#include "testing_potri.hpp"
+#include "testing_potrs.hpp"
 #include "testing_syevd_heevd.hpp"
+#include "testing_syevdx_heevdx.hpp"
+#include "testing_syevj_heevj.hpp"
 #include "testing_sygvd_hegvd.hpp"
+#include "testing_sygvd_hegvd_factored.hpp"
+#include "testing_sygvdx_hegvdx.hpp"
 #include "testing_sytrd_hetrd.hpp"
+#include "testing_sytrf.hpp"
+#include "testing_sytrs.hpp"
 
 struct str_less
 {
@@ -44,12 +57,33 @@ class hipsolver_dispatcher
         // Map for functions that support all precisions
         static const func_map map = {
             {"gebrd", testing_gebrd<false, false, false, T>},
+            {"gebrd_batched", testing_gebrd<false, true, false, T>},
+            {"gebrd_strided_batched", testing_gebrd<false, false, true, T>},
+            {"gels", testing_gels<false, false, T>},
+            {"gels_strided_batched", testing_gels<false, true, T>},
             {"geqrf", testing_geqrf<false, false, false, T>},
+            {"geqrf_batched", testing_geqrf<false, true, false, T>},
+            {"geqrf_strided_batched", testing_geqrf<false, false, true, T>},
             {"gesvd", testing_gesvd<false, false, false, T>},
+            {"gesvd_strided_batched", testing_gesvd<false, false, true, T>},
+            {"gesvdj", testing_gesvdj<false, false, false, T>},
+            {"gesvdj_batched", testing_gesvdj<false, false, true, T>},
             {"getrf", testing_getrf<false, false, false, T>},
+            {"getrf_batched", testing_getrf<false, true, false, T>},
+            {"getrf_strided_batched", testing_getrf<false, false, true, T>},
+            {"getri", testing_getri<false, false, false, T>},
+            {"getri_outofplace_batched", testing_getri<false, true, false, T>},
+            {"getri_outofplace_strided_batched", testing_getri<false, false, true, T>},
             {"getrs", testing_getrs<false, false, false, T>},
+            {"getrs_batched", testing_getrs<false, true, false, T>},
+            {"getrs_strided_batched", testing_getrs<false, false, true, T>},
             {"potrf", testing_potrf<false, false, false, T>},
             {"potrf_batched", testing_potrf<false, true, false, T>},
+            {"potri", testing_potri<false, T>},
+            {"potrs", testing_potrs<false, false, false, T>},
+            {"potrs_batched", testing_potrs<false, true, false, T>},
+            {"sytrf", testing_sytrf<false, T>},
+            {"sytrs", testing_sytrs<false, T>},
         };
 
         // Grab function from the map and execute
@@ -68,14 +102,32 @@ class hipsolver_dispatcher
     {
         // Map for functions that support single and double precisions
         static const func_map map_real = {
-            {"orgbr", testing_orgbr_ungbr<false, T>},
-            {"orgqr", testing_orgqr_ungqr<false, T>},
-            {"orgtr", testing_orgtr_ungtr<false, T>},
-            {"ormqr", testing_ormqr_unmqr<false, T>},
+            {"orgbr", testing_orgbr_ungbr<false, false, false, T>},
+            {"orgbr_batched", testing_orgbr_ungbr<false, true, false, T>},
+            {"orgbr_strided_batched", testing_orgbr_ungbr<false, false, true, T>},
+            {"orgqr", testing_orgqr_ungqr<false, false, false, T>},
+            {"orgqr_batched", testing_orgqr_ungqr<false, true, false, T>},
+            {"orgqr_strided_batched", testing_orgqr_ungqr<false, false, true, T>},
+            {"orgtr", testing_orgtr_ungtr<false, false, false, T>},
+            {"orgtr_batched", testing_orgtr_ungtr<false, true, false, T>},
+            {"orgtr_strided_batched", testing_orgtr_ungtr<false, false, true, T>},
+            {"ormqr", testing_ormqr_unmqr<false, false, false, T>},
+            {"ormqr_batched", testing_ormqr_unmqr<false, true, false, T>},
+            {"ormqr_strided_batched", testing_ormqr_unmqr<false, false, true, T>},
             {"ormtr", testing_ormtr_unmtr<false, T>},
             {"syevd", testing_syevd_heevd<false, false, false, T>},
+            {"syevd_batched", testing_syevd_heevd<false, true, false, T>},
+            {"syevd_strided_batched", testing_syevd_heevd<false, false, true, T>},
+            {"syevdx", testing_syevdx_heevdx<false, T>},
+            {"syevj", testing_syevj_heevj<false, false, T>},
+            {"syevj_batched", testing_syevj_heevj<false, true, T>},
             {"sygvd", testing_sygvd_hegvd<false, false, false, T>},
+            {"sygvd_strided_batched", testing_sygvd_hegvd<false, false, true, T>},
+            {"sygvd_factored", testing_sygvd_hegvd_factored<false, false, true, T>},
+            {"sygvdx", testing_sygvdx_hegvdx<false, T>},
             {"sytrd", testing_sytrd_hetrd<false, false, false, T>},
+            {"sytrd_batched", testing_sytrd_hetrd<false, true, false, T>},
+            {"sytrd_strided_batched", testing_sytrd_hetrd<false, false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -94,14 +146,32 @@ class hipsolver_dispatcher
     {
         // Map for functions that support single complex and double complex precisions
         static const func_map map_complex = {
-            {"ungbr", testing_orgbr_ungbr<false, T>},
-            {"ungqr", testing_orgqr_ungqr<false, T>},
-            {"ungtr", testing_orgtr_ungtr<false, T>},
-            {"unmqr", testing_ormqr_unmqr<false, T>},
+            {"ungbr", testing_orgbr_ungbr<false, false, false, T>},
+            {"ungbr_batched", testing_orgbr_ungbr<false, true, false, T>},
+            {"ungbr_strided_batched", testing_orgbr_ungbr<false, false, true, T>},
+            {"ungqr", testing_orgqr_ungqr<false, false, false, T>},
+            {"ungqr_batched", testing_orgqr_ungqr<false, true, false, T>},
+            {"ungqr_strided_batched", testing_orgqr_ungqr<false, false, true, T>},
+            {"ungtr", testing_orgtr_ungtr<false, false, false, T>},
+            {"ungtr_batched", testing_orgtr_ungtr<false, true, false, T>},
+            {"ungtr_strided_batched", testing_orgtr_ungtr<false, false, true, T>},
+            {"unmqr", testing_ormqr_unmqr<false, false, false, T>},
+            {"unmqr_batched", testing_ormqr_unmqr<false, true, false, T>},
+            {"unmqr_strided_batched", testing_ormqr_unmqr<false, false, true, T>},
             {"unmtr", testing_ormtr_unmtr<false, T>},
             {"heevd", testing_syevd_heevd<false, false, false, T>},
+            {"heevd_batched", testing_syevd_heevd<false, true, false, T>},
+            {"heevd_strided_batched", testing_syevd_heevd<false, false, true, T>},
+            {"heevdx", testing_syevdx_heevdx<false, T>},
+            {"heevj", testing_syevj_heevj<false, false, T>},
+            {"heevj_batched", testing_syevj_heevj<false, true, T>},
             {"hegvd", testing_sygvd_hegvd<false, false, false, T>},
+            {"hegvd_strided_batched", testing_sygvd_hegvd<false, false, true, T>},
+            {"hegvd_factored", testing_sygvd_hegvd_factored<false, false, true, T>},
+            {"hegvdx", testing_sygvdx_hegvdx<false, T>},
             {"hetrd", testing_sytrd_hetrd<false, false, false, T>},
+            {"hetrd_batched", testing_sytrd_hetrd<false, true, false, T>},
+            {"hetrd_strided_batched", testing_sytrd_hetrd<false, false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -115,9 +185,102 @@ class hipsolver_dispatcher
             return HIPSOLVER_STATUS_INVALID_VALUE;
     }
 
+    template <typename T>
+    static hipsolverStatus_t run_function_mixed_precision(const char* name, Arguments& argus)
+    {
+        // Map for mixed precision functions, which support double and double complex precisions
+        static const func_map map = {
+            {"gesv", testing_gesv<false, T>},
+        };
+
+        // Grab function from the map and execute
+        auto match = map.find(name);
+        if(match != map.end())
+        {
+            match->second(argus);
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+    static hipsolverStatus_t run_function_concurrent(const char* name, Arguments& argus)
+    {
+        // Map for functions that support concurrent benchmarking with real precisions
+        static const func_map map_real = {
+            {"getrf", testing_concurrent_getrf<T>},
+            {"potrf", testing_concurrent_potrf<T>},
+            {"syevd", testing_concurrent_syevd_heevd<T>},
+        };
+
+        // Grab function from the map and execute
+        auto match = map_real.find(name);
+        if(match != map_real.end())
+        {
+            match->second(argus);
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+    static hipsolverStatus_t run_function_concurrent(const char* name, Arguments& argus)
+    {
+        // Map for functions that support concurrent benchmarking with complex precisions
+        static const func_map map_complex = {
+            {"getrf", testing_concurrent_getrf<T>},
+            {"potrf", testing_concurrent_potrf<T>},
+            {"heevd", testing_concurrent_syevd_heevd<T>},
+        };
+
+        // Grab function from the map and execute
+        auto match = map_complex.find(name);
+        if(match != map_complex.end())
+        {
+            match->second(argus);
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+        else
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    static void invoke_concurrent(const std::string& name, char precision, Arguments& argus)
+    {
+        hipsolverStatus_t status;
+
+        if(precision == 's')
+            status = run_function_concurrent<float>(name.c_str(), argus);
+        else if(precision == 'd')
+            status = run_function_concurrent<double>(name.c_str(), argus);
+        else if(precision == 'c')
+            status = run_function_concurrent<hipsolverComplex>(name.c_str(), argus);
+        else if(precision == 'z')
+            status = run_function_concurrent<hipsolverDoubleComplex>(name.c_str(), argus);
+        else
+            throw std::invalid_argument("Invalid value for --precision");
+
+        if(status == HIPSOLVER_STATUS_INVALID_VALUE)
+        {
+            std::string msg = "Concurrent benchmarking is not supported for --function ";
+            msg += name;
+            msg += " --precision ";
+            msg += precision;
+            throw std::invalid_argument(msg);
+        }
+    }
+
 public:
     static void invoke(const std::string& name, char precision, Arguments& argus)
     {
+        // several streams or handles select the concurrent benchmarks
+        if(argus.streams != 1 || argus.handles != 1)
+        {
+            invoke_concurrent(name, precision, argus);
+            return;
+        }
+
         hipsolverStatus_t status;
 
         if(precision == 's')
@@ -144,6 +307,14 @@ public:
                     = run_function_limited_precision<hipsolverDoubleComplex>(name.c_str(), argus);
         }
 
+        if(status == HIPSOLVER_STATUS_INVALID_VALUE)
+        {
+            if(precision == 'd')
+                status = run_function_mixed_precision<double>(name.c_str(), argus);
+            else if(precision == 'z')
+                status = run_function_mixed_precision<hipsolverDoubleComplex>(name.c_str(), argus);
+        }
+
         if(status == HIPSOLVER_STATUS_INVALID_VALUE)
         {
             std::string msg = "Invalid combination --function ";
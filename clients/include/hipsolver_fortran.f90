@@ -173,892 +173,1000 @@ module hipsolver_interface
         res = hipsolverZungbr(handle, side, m, n, k, A, lda, tau, work, lwork, info)
     end function hipsolverZungbrFortran
 
-    ! ******************** ORGQR/UNGQR ********************
-    function hipsolverSorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
+    ! ******************** ORGBR/UNGBR_BATCHED ********************
+    function hipsolverSorgbrBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSorgqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverSorgbrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
-    end function hipsolverSorgqr_bufferSizeFortran
+        res = hipsolverSorgbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count)
+    end function hipsolverSorgbrBatched_bufferSizeFortran
     
-    function hipsolverDorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
+    function hipsolverDorgbrBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDorgqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverDorgbrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
-    end function hipsolverDorgqr_bufferSizeFortran
+        res = hipsolverDorgbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count)
+    end function hipsolverDorgbrBatched_bufferSizeFortran
     
-    function hipsolverCungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
+    function hipsolverCungbrBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCungqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverCungbrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
-    end function hipsolverCungqr_bufferSizeFortran
+        res = hipsolverCungbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count)
+    end function hipsolverCungbrBatched_bufferSizeFortran
     
-    function hipsolverZungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
+    function hipsolverZungbrBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZungqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverZungbrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
-    end function hipsolverZungqr_bufferSizeFortran
+        res = hipsolverZungbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count)
+    end function hipsolverZungbrBatched_bufferSizeFortran
     
-    function hipsolverSorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
+    function hipsolverSorgbrBatchedFortran(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSorgqrFortran')
+            bind(c, name = 'hipsolverSorgbrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSorgqr(handle, m, n, k, A, lda, tau, work, lwork, info)
-    end function hipsolverSorgqrFortran
+        res = hipsolverSorgbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverSorgbrBatchedFortran
     
-    function hipsolverDorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
+    function hipsolverDorgbrBatchedFortran(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDorgqrFortran')
+            bind(c, name = 'hipsolverDorgbrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDorgqr(handle, m, n, k, A, lda, tau, work, lwork, info)
-    end function hipsolverDorgqrFortran
+        res = hipsolverDorgbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverDorgbrBatchedFortran
     
-    function hipsolverCungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
+    function hipsolverCungbrBatchedFortran(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCungqrFortran')
+            bind(c, name = 'hipsolverCungbrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCungqr(handle, m, n, k, A, lda, tau, work, lwork, info)
-    end function hipsolverCungqrFortran
+        res = hipsolverCungbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverCungbrBatchedFortran
     
-    function hipsolverZungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
+    function hipsolverZungbrBatchedFortran(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZungqrFortran')
+            bind(c, name = 'hipsolverZungbrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZungqr(handle, m, n, k, A, lda, tau, work, lwork, info)
-    end function hipsolverZungqrFortran
+        res = hipsolverZungbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverZungbrBatchedFortran
 
-    ! ******************** ORGTR/UNGTR ********************
-    function hipsolverSorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
+    ! ******************** ORGBR/UNGBR_STRIDED_BATCHED ********************
+    function hipsolverSorgbrStridedBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, strideA, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSorgtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverSorgbrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
-    end function hipsolverSorgtr_bufferSizeFortran
+        res = hipsolverSorgbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverSorgbrStridedBatched_bufferSizeFortran
     
-    function hipsolverDorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
+    function hipsolverDorgbrStridedBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, strideA, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDorgtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverDorgbrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
-    end function hipsolverDorgtr_bufferSizeFortran
+        res = hipsolverDorgbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverDorgbrStridedBatched_bufferSizeFortran
     
-    function hipsolverCungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
+    function hipsolverCungbrStridedBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, strideA, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCungtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverCungbrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
-    end function hipsolverCungtr_bufferSizeFortran
+        res = hipsolverCungbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverCungbrStridedBatched_bufferSizeFortran
     
-    function hipsolverZungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
+    function hipsolverZungbrStridedBatched_bufferSizeFortran(handle, side, m, n, k, A, lda, strideA, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZungtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverZungbrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
-    end function hipsolverZungtr_bufferSizeFortran
+        res = hipsolverZungbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverZungbrStridedBatched_bufferSizeFortran
     
-    function hipsolverSorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
+    function hipsolverSorgbrStridedBatchedFortran(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSorgtrFortran')
+            bind(c, name = 'hipsolverSorgbrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSorgtr(handle, uplo, n, A, lda, tau, work, lwork, info)
-    end function hipsolverSorgtrFortran
+        res = hipsolverSorgbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverSorgbrStridedBatchedFortran
     
-    function hipsolverDorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
+    function hipsolverDorgbrStridedBatchedFortran(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDorgtrFortran')
+            bind(c, name = 'hipsolverDorgbrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDorgtr(handle, uplo, n, A, lda, tau, work, lwork, info)
-    end function hipsolverDorgtrFortran
+        res = hipsolverDorgbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverDorgbrStridedBatchedFortran
     
-    function hipsolverCungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
+    function hipsolverCungbrStridedBatchedFortran(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCungtrFortran')
+            bind(c, name = 'hipsolverCungbrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCungtr(handle, uplo, n, A, lda, tau, work, lwork, info)
-    end function hipsolverCungtrFortran
+        res = hipsolverCungbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverCungbrStridedBatchedFortran
     
-    function hipsolverZungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
+    function hipsolverZungbrStridedBatchedFortran(handle, side, m, n, k, A, lda, strideA, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZungtrFortran')
+            bind(c, name = 'hipsolverZungbrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZungtr(handle, uplo, n, A, lda, tau, work, lwork, info)
-    end function hipsolverZungtrFortran
+        res = hipsolverZungbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverZungbrStridedBatchedFortran
 
-    ! ******************** ORMQR/UNMQR ********************
-    function hipsolverSormqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+    ! ******************** ORGQR/UNGQR ********************
+    function hipsolverSorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSormqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverSorgqr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
-    end function hipsolverSormqr_bufferSizeFortran
+        res = hipsolverSorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
+    end function hipsolverSorgqr_bufferSizeFortran
     
-    function hipsolverDormqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+    function hipsolverDorgqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDormqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverDorgqr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
-    end function hipsolverDormqr_bufferSizeFortran
+        res = hipsolverDorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
+    end function hipsolverDorgqr_bufferSizeFortran
     
-    function hipsolverCunmqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+    function hipsolverCungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCunmqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverCungqr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
-    end function hipsolverCunmqr_bufferSizeFortran
+        res = hipsolverCungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
+    end function hipsolverCungqr_bufferSizeFortran
     
-    function hipsolverZunmqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+    function hipsolverZungqr_bufferSizeFortran(handle, m, n, k, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZunmqr_bufferSizeFortran')
+            bind(c, name = 'hipsolverZungqr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
-    end function hipsolverZunmqr_bufferSizeFortran
+        res = hipsolverZungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork)
+    end function hipsolverZungqr_bufferSizeFortran
     
-    function hipsolverSormqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverSorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSormqrFortran')
+            bind(c, name = 'hipsolverSorgqrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverSormqrFortran
+        res = hipsolverSorgqr(handle, m, n, k, A, lda, tau, work, lwork, info)
+    end function hipsolverSorgqrFortran
     
-    function hipsolverDormqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverDorgqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDormqrFortran')
+            bind(c, name = 'hipsolverDorgqrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverDormqrFortran
+        res = hipsolverDorgqr(handle, m, n, k, A, lda, tau, work, lwork, info)
+    end function hipsolverDorgqrFortran
     
-    function hipsolverCunmqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverCungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCunmqrFortran')
+            bind(c, name = 'hipsolverCungqrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverCunmqrFortran
+        res = hipsolverCungqr(handle, m, n, k, A, lda, tau, work, lwork, info)
+    end function hipsolverCungqrFortran
     
-    function hipsolverZunmqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverZungqrFortran(handle, m, n, k, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZunmqrFortran')
+            bind(c, name = 'hipsolverZungqrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
         integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverZunmqrFortran
+        res = hipsolverZungqr(handle, m, n, k, A, lda, tau, work, lwork, info)
+    end function hipsolverZungqrFortran
 
-    ! ******************** ORMTR/UNMTR ********************
-    function hipsolverSormtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+    ! ******************** ORGQR/UNGQR_BATCHED ********************
+    function hipsolverSorgqrBatched_bufferSizeFortran(handle, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSormtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverSorgqrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
-    end function hipsolverSormtr_bufferSizeFortran
+        res = hipsolverSorgqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverSorgqrBatched_bufferSizeFortran
     
-    function hipsolverDormtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+    function hipsolverDorgqrBatched_bufferSizeFortran(handle, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDormtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverDorgqrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
-    end function hipsolverDormtr_bufferSizeFortran
+        res = hipsolverDorgqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverDorgqrBatched_bufferSizeFortran
     
-    function hipsolverCunmtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+    function hipsolverCungqrBatched_bufferSizeFortran(handle, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCunmtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverCungqrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
-    end function hipsolverCunmtr_bufferSizeFortran
+        res = hipsolverCungqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverCungqrBatched_bufferSizeFortran
     
-    function hipsolverZunmtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+    function hipsolverZungqrBatched_bufferSizeFortran(handle, m, n, k, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZunmtr_bufferSizeFortran')
+            bind(c, name = 'hipsolverZungqrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
-    end function hipsolverZunmtr_bufferSizeFortran
+        res = hipsolverZungqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverZungqrBatched_bufferSizeFortran
     
-    function hipsolverSormtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverSorgqrBatchedFortran(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSormtrFortran')
+            bind(c, name = 'hipsolverSorgqrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverSormtrFortran
+        res = hipsolverSorgqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverSorgqrBatchedFortran
     
-    function hipsolverDormtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverDorgqrBatchedFortran(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDormtrFortran')
+            bind(c, name = 'hipsolverDorgqrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverDormtrFortran
+        res = hipsolverDorgqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverDorgqrBatchedFortran
     
-    function hipsolverCunmtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverCungqrBatchedFortran(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCunmtrFortran')
+            bind(c, name = 'hipsolverCungqrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverCunmtrFortran
+        res = hipsolverCungqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverCungqrBatchedFortran
     
-    function hipsolverZunmtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+    function hipsolverZungqrBatchedFortran(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZunmtrFortran')
+            bind(c, name = 'hipsolverZungqrBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: tau
-        type(c_ptr), value :: C
-        integer(c_int), value :: ldc
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
-    end function hipsolverZunmtrFortran
+        res = hipsolverZungqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverZungqrBatchedFortran
 
-    ! ******************** GEBRD ********************
-    function hipsolverSgebrd_bufferSizeFortran(handle, m, n, lwork) &
+    ! ******************** ORGQR/UNGQR_STRIDED_BATCHED ********************
+    function hipsolverSorgqrStridedBatched_bufferSizeFortran(handle, m, n, k, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSorgqrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverSgebrd_bufferSizeFortran
+        res = hipsolverSorgqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverSorgqrStridedBatched_bufferSizeFortran
     
-    function hipsolverDgebrd_bufferSizeFortran(handle, m, n, lwork) &
+    function hipsolverDorgqrStridedBatched_bufferSizeFortran(handle, m, n, k, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDorgqrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverDgebrd_bufferSizeFortran
+        res = hipsolverDorgqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverDorgqrStridedBatched_bufferSizeFortran
     
-    function hipsolverCgebrd_bufferSizeFortran(handle, m, n, lwork) &
+    function hipsolverCungqrStridedBatched_bufferSizeFortran(handle, m, n, k, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverCungqrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverCgebrd_bufferSizeFortran
+        res = hipsolverCungqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverCungqrStridedBatched_bufferSizeFortran
     
-    function hipsolverZgebrd_bufferSizeFortran(handle, m, n, lwork) &
+    function hipsolverZungqrStridedBatched_bufferSizeFortran(handle, m, n, k, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgebrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZungqrStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgebrd_bufferSize(handle, m, n, lwork)
-    end function hipsolverZgebrd_bufferSizeFortran
-
-    function hipsolverSgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        res = hipsolverZungqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverZungqrStridedBatched_bufferSizeFortran
+    
+    function hipsolverSorgqrStridedBatchedFortran(handle, m, n, k, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgebrdFortran')
+            bind(c, name = 'hipsolverSorgqrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverSgebrdFortran
-
-    function hipsolverDgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        res = hipsolverSorgqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverSorgqrStridedBatchedFortran
+    
+    function hipsolverDorgqrStridedBatchedFortran(handle, m, n, k, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgebrdFortran')
+            bind(c, name = 'hipsolverDorgqrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverDgebrdFortran
-
-    function hipsolverCgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        res = hipsolverDorgqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverDorgqrStridedBatchedFortran
+    
+    function hipsolverCungqrStridedBatchedFortran(handle, m, n, k, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgebrdFortran')
+            bind(c, name = 'hipsolverCungqrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverCgebrdFortran
-
-    function hipsolverZgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        res = hipsolverCungqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverCungqrStridedBatchedFortran
+    
+    function hipsolverZungqrStridedBatchedFortran(handle, m, n, k, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgebrdFortran')
+            bind(c, name = 'hipsolverZungqrStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
         integer(c_int), value :: m
         integer(c_int), value :: n
+        integer(c_int), value :: k
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: D
-        type(c_ptr), value :: E
-        type(c_ptr), value :: tauq
-        type(c_ptr), value :: taup
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
-    end function hipsolverZgebrdFortran
+        res = hipsolverZungqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverZungqrStridedBatchedFortran
 
-    ! ******************** GEQRF ********************
-    function hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    ! ******************** ORGTR/UNGTR ********************
+    function hipsolverSorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverSorgtr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverSgeqrf_bufferSizeFortran
+        res = hipsolverSorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
+    end function hipsolverSorgtr_bufferSizeFortran
     
-    function hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    function hipsolverDorgtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverDorgtr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverDgeqrf_bufferSizeFortran
+        res = hipsolverDorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
+    end function hipsolverDorgtr_bufferSizeFortran
     
-    function hipsolverCgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    function hipsolverCungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverCungtr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverCgeqrf_bufferSizeFortran
+        res = hipsolverCungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
+    end function hipsolverCungtr_bufferSizeFortran
     
-    function hipsolverZgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    function hipsolverZungtr_bufferSizeFortran(handle, uplo, n, A, lda, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZgeqrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverZungtr_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverZgeqrf_bufferSizeFortran
-
-    function hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+        res = hipsolverZungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork)
+    end function hipsolverZungtr_bufferSizeFortran
+    
+    function hipsolverSorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSgeqrfFortran')
+            bind(c, name = 'hipsolverSorgtrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
@@ -1067,17 +1175,17 @@ module hipsolver_interface
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverSgeqrfFortran
-
-    function hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+        res = hipsolverSorgtr(handle, uplo, n, A, lda, tau, work, lwork, info)
+    end function hipsolverSorgtrFortran
+    
+    function hipsolverDorgtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDgeqrfFortran')
+            bind(c, name = 'hipsolverDorgtrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
@@ -1086,17 +1194,17 @@ module hipsolver_interface
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverDgeqrfFortran
-
-    function hipsolverCgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+        res = hipsolverDorgtr(handle, uplo, n, A, lda, tau, work, lwork, info)
+    end function hipsolverDorgtrFortran
+    
+    function hipsolverCungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCgeqrfFortran')
+            bind(c, name = 'hipsolverCungtrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
@@ -1105,17 +1213,17 @@ module hipsolver_interface
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverCgeqrfFortran
-
-    function hipsolverZgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+        res = hipsolverCungtr(handle, uplo, n, A, lda, tau, work, lwork, info)
+    end function hipsolverCungtrFortran
+    
+    function hipsolverZungtrFortran(handle, uplo, n, A, lda, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZgeqrfFortran')
+            bind(c, name = 'hipsolverZungtrFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
@@ -1124,1104 +1232,6594 @@ module hipsolver_interface
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
-    end function hipsolverZgeqrfFortran
+        res = hipsolverZungtr(handle, uplo, n, A, lda, tau, work, lwork, info)
+    end function hipsolverZungtrFortran
 
-    ! ******************** GESVD ********************
-    function hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    ! ******************** ORGTR/UNGTR_BATCHED ********************
+    function hipsolverSorgtrBatched_bufferSizeFortran(handle, uplo, n, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSorgtrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverSgesvd_bufferSizeFortran
+        res = hipsolverSorgtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverSorgtrBatched_bufferSizeFortran
     
-    function hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    function hipsolverDorgtrBatched_bufferSizeFortran(handle, uplo, n, A, lda, tau, strideP, lwork, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDorgtrBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        type(c_ptr), value :: lwork
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDorgtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverDorgtrBatched_bufferSizeFortran
+    
+    function hipsolverCungtrBatched_bufferSizeFortran(handle, uplo, n, A, lda, tau, strideP, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCungtrBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCungtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverCungtrBatched_bufferSizeFortran
+    
+    function hipsolverZungtrBatched_bufferSizeFortran(handle, uplo, n, A, lda, tau, strideP, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZungtrBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZungtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, batch_count)
+    end function hipsolverZungtrBatched_bufferSizeFortran
+    
+    function hipsolverSorgtrBatchedFortran(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSorgtrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSorgtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverSorgtrBatchedFortran
+    
+    function hipsolverDorgtrBatchedFortran(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDorgtrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDorgtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverDorgtrBatchedFortran
+    
+    function hipsolverCungtrBatchedFortran(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCungtrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCungtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverCungtrBatchedFortran
+    
+    function hipsolverZungtrBatchedFortran(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZungtrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZungtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverZungtrBatchedFortran
+
+    ! ******************** ORGTR/UNGTR_STRIDED_BATCHED ********************
+    function hipsolverSorgtrStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSorgtrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSorgtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverSorgtrStridedBatched_bufferSizeFortran
+    
+    function hipsolverDorgtrStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDorgtrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDorgtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverDorgtrStridedBatched_bufferSizeFortran
+    
+    function hipsolverCungtrStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCungtrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCungtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverCungtrStridedBatched_bufferSizeFortran
+    
+    function hipsolverZungtrStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, tau, strideP, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZungtrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZungtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count)
+    end function hipsolverZungtrStridedBatched_bufferSizeFortran
+    
+    function hipsolverSorgtrStridedBatchedFortran(handle, uplo, n, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSorgtrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSorgtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverSorgtrStridedBatchedFortran
+    
+    function hipsolverDorgtrStridedBatchedFortran(handle, uplo, n, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDorgtrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDorgtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverDorgtrStridedBatchedFortran
+    
+    function hipsolverCungtrStridedBatchedFortran(handle, uplo, n, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCungtrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCungtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverCungtrStridedBatchedFortran
+    
+    function hipsolverZungtrStridedBatchedFortran(handle, uplo, n, A, lda, strideA, tau, strideP, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZungtrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZungtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count)
+    end function hipsolverZungtrStridedBatchedFortran
+
+    ! ******************** ORMQR/UNMQR ********************
+    function hipsolverSormqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSormqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
+    end function hipsolverSormqr_bufferSizeFortran
+    
+    function hipsolverDormqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDormqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
+    end function hipsolverDormqr_bufferSizeFortran
+    
+    function hipsolverCunmqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
+    end function hipsolverCunmqr_bufferSizeFortran
+    
+    function hipsolverZunmqr_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmqr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork)
+    end function hipsolverZunmqr_bufferSizeFortran
+    
+    function hipsolverSormqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSormqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverSormqrFortran
+    
+    function hipsolverDormqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDormqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverDormqrFortran
+    
+    function hipsolverCunmqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverCunmqrFortran
+    
+    function hipsolverZunmqrFortran(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmqrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverZunmqrFortran
+
+    ! ******************** ORMQR/UNMQR_BATCHED ********************
+    function hipsolverSormqrBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+            ldc, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSormqrBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSormqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, &
+                lwork, batch_count)
+    end function hipsolverSormqrBatched_bufferSizeFortran
+    
+    function hipsolverDormqrBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+            ldc, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDormqrBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDormqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, &
+                lwork, batch_count)
+    end function hipsolverDormqrBatched_bufferSizeFortran
+    
+    function hipsolverCunmqrBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+            ldc, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmqrBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCunmqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, &
+                lwork, batch_count)
+    end function hipsolverCunmqrBatched_bufferSizeFortran
+    
+    function hipsolverZunmqrBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+            ldc, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmqrBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZunmqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, &
+                lwork, batch_count)
+    end function hipsolverZunmqrBatched_bufferSizeFortran
+    
+    function hipsolverSormqrBatchedFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSormqrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSormqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count)
+    end function hipsolverSormqrBatchedFortran
+    
+    function hipsolverDormqrBatchedFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDormqrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDormqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count)
+    end function hipsolverDormqrBatchedFortran
+    
+    function hipsolverCunmqrBatchedFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmqrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCunmqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count)
+    end function hipsolverCunmqrBatchedFortran
+    
+    function hipsolverZunmqrBatchedFortran(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmqrBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZunmqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count)
+    end function hipsolverZunmqrBatchedFortran
+
+    ! ******************** ORMQR/UNMQR_STRIDED_BATCHED ********************
+    function hipsolverSormqrStridedBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, strideA, &
+            tau, strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSormqrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSormqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+                strideP, C, ldc, strideC, lwork, batch_count)
+    end function hipsolverSormqrStridedBatched_bufferSizeFortran
+    
+    function hipsolverDormqrStridedBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, strideA, &
+            tau, strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDormqrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDormqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+                strideP, C, ldc, strideC, lwork, batch_count)
+    end function hipsolverDormqrStridedBatched_bufferSizeFortran
+    
+    function hipsolverCunmqrStridedBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, strideA, &
+            tau, strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmqrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCunmqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+                strideP, C, ldc, strideC, lwork, batch_count)
+    end function hipsolverCunmqrStridedBatched_bufferSizeFortran
+    
+    function hipsolverZunmqrStridedBatched_bufferSizeFortran(handle, side, trans, m, n, k, A, lda, strideA, &
+            tau, strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmqrStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZunmqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+                strideP, C, ldc, strideC, lwork, batch_count)
+    end function hipsolverZunmqrStridedBatched_bufferSizeFortran
+    
+    function hipsolverSormqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+            strideP, C, ldc, strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSormqrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, C, &
+                ldc, strideC, work, lwork, info, batch_count)
+    end function hipsolverSormqrStridedBatchedFortran
+    
+    function hipsolverDormqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+            strideP, C, ldc, strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDormqrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, C, &
+                ldc, strideC, work, lwork, info, batch_count)
+    end function hipsolverDormqrStridedBatchedFortran
+    
+    function hipsolverCunmqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+            strideP, C, ldc, strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmqrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, C, &
+                ldc, strideC, work, lwork, info, batch_count)
+    end function hipsolverCunmqrStridedBatchedFortran
+    
+    function hipsolverZunmqrStridedBatchedFortran(handle, side, trans, m, n, k, A, lda, strideA, tau, &
+            strideP, C, ldc, strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmqrStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: k
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, C, &
+                ldc, strideC, work, lwork, info, batch_count)
+    end function hipsolverZunmqrStridedBatchedFortran
+
+    ! ******************** ORMTR/UNMTR ********************
+    function hipsolverSormtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSormtr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
+    end function hipsolverSormtr_bufferSizeFortran
+    
+    function hipsolverDormtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDormtr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
+    end function hipsolverDormtr_bufferSizeFortran
+    
+    function hipsolverCunmtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmtr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
+    end function hipsolverCunmtr_bufferSizeFortran
+    
+    function hipsolverZunmtr_bufferSizeFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmtr_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork)
+    end function hipsolverZunmtr_bufferSizeFortran
+    
+    function hipsolverSormtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSormtrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverSormtrFortran
+    
+    function hipsolverDormtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDormtrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverDormtrFortran
+    
+    function hipsolverCunmtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCunmtrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverCunmtrFortran
+    
+    function hipsolverZunmtrFortran(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZunmtrFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info)
+    end function hipsolverZunmtrFortran
+
+    ! ******************** GEBRD ********************
+    function hipsolverSgebrd_bufferSizeFortran(handle, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgebrd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverSgebrd_bufferSizeFortran
+    
+    function hipsolverDgebrd_bufferSizeFortran(handle, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgebrd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverDgebrd_bufferSizeFortran
+    
+    function hipsolverCgebrd_bufferSizeFortran(handle, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgebrd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverCgebrd_bufferSizeFortran
+    
+    function hipsolverZgebrd_bufferSizeFortran(handle, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgebrd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgebrd_bufferSize(handle, m, n, lwork)
+    end function hipsolverZgebrd_bufferSizeFortran
+
+    function hipsolverSgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgebrdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverSgebrdFortran
+
+    function hipsolverDgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgebrdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverDgebrdFortran
+
+    function hipsolverCgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgebrdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverCgebrdFortran
+
+    function hipsolverZgebrdFortran(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgebrdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tauq
+        type(c_ptr), value :: taup
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info)
+    end function hipsolverZgebrdFortran
+
+    ! ******************** GEBRD_BATCHED ********************
+    function hipsolverSgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgebrdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverSgebrdBatched_bufferSizeFortran
+    
+    function hipsolverDgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgebrdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverDgebrdBatched_bufferSizeFortran
+    
+    function hipsolverCgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgebrdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverCgebrdBatched_bufferSizeFortran
+    
+    function hipsolverZgebrdBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgebrdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverZgebrdBatched_bufferSizeFortran
+    
+    function hipsolverSgebrdBatchedFortran(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, &
+            taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgebrdBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverSgebrdBatchedFortran
+    
+    function hipsolverDgebrdBatchedFortran(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, &
+            taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgebrdBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverDgebrdBatchedFortran
+    
+    function hipsolverCgebrdBatchedFortran(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, &
+            taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgebrdBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverCgebrdBatchedFortran
+    
+    function hipsolverZgebrdBatchedFortran(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, &
+            taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgebrdBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverZgebrdBatchedFortran
+
+    ! ******************** GEBRD_STRIDED_BATCHED ********************
+    function hipsolverSgebrdStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgebrdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverSgebrdStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgebrdStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgebrdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverDgebrdStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgebrdStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgebrdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverCgebrdStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgebrdStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgebrdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverZgebrdStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgebrdStridedBatchedFortran(handle, m, n, A, lda, strideA, D, strideD, E, strideE, &
+            tauq, strideQ, taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgebrdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count)
+    end function hipsolverSgebrdStridedBatchedFortran
+    
+    function hipsolverDgebrdStridedBatchedFortran(handle, m, n, A, lda, strideA, D, strideD, E, strideE, &
+            tauq, strideQ, taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgebrdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count)
+    end function hipsolverDgebrdStridedBatchedFortran
+    
+    function hipsolverCgebrdStridedBatchedFortran(handle, m, n, A, lda, strideA, D, strideD, E, strideE, &
+            tauq, strideQ, taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgebrdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count)
+    end function hipsolverCgebrdStridedBatchedFortran
+    
+    function hipsolverZgebrdStridedBatchedFortran(handle, m, n, A, lda, strideA, D, strideD, E, strideE, &
+            tauq, strideQ, taup, strideP, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgebrdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tauq
+        integer(c_int), value :: strideQ
+        type(c_ptr), value :: taup
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count)
+    end function hipsolverZgebrdStridedBatchedFortran
+
+    ! ******************** GEQRF ********************
+    function hipsolverSgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverSgeqrf_bufferSizeFortran
+    
+    function hipsolverDgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverDgeqrf_bufferSizeFortran
+    
+    function hipsolverCgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverCgeqrf_bufferSizeFortran
+    
+    function hipsolverZgeqrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverZgeqrf_bufferSizeFortran
+
+    function hipsolverSgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverSgeqrfFortran
+
+    function hipsolverDgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverDgeqrfFortran
+
+    function hipsolverCgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverCgeqrfFortran
+
+    function hipsolverZgeqrfFortran(handle, m, n, A, lda, tau, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info)
+    end function hipsolverZgeqrfFortran
+
+    ! ******************** GEQRF_BATCHED ********************
+    function hipsolverSgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, strideP, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count)
+    end function hipsolverSgeqrfBatched_bufferSizeFortran
+    
+    function hipsolverDgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, strideP, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count)
+    end function hipsolverDgeqrfBatched_bufferSizeFortran
+    
+    function hipsolverCgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, strideP, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count)
+    end function hipsolverCgeqrfBatched_bufferSizeFortran
+    
+    function hipsolverZgeqrfBatched_bufferSizeFortran(handle, m, n, A, lda, strideP, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count)
+    end function hipsolverZgeqrfBatched_bufferSizeFortran
+    
+    function hipsolverSgeqrfBatchedFortran(handle, m, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverSgeqrfBatchedFortran
+    
+    function hipsolverDgeqrfBatchedFortran(handle, m, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverDgeqrfBatchedFortran
+    
+    function hipsolverCgeqrfBatchedFortran(handle, m, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverCgeqrfBatchedFortran
+    
+    function hipsolverZgeqrfBatchedFortran(handle, m, n, A, lda, tau, strideP, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count)
+    end function hipsolverZgeqrfBatchedFortran
+
+    ! ******************** GEQRF_STRIDED_BATCHED ********************
+    function hipsolverSgeqrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, strideP, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count)
+    end function hipsolverSgeqrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgeqrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, strideP, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count)
+    end function hipsolverDgeqrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgeqrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, strideP, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count)
+    end function hipsolverCgeqrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgeqrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, strideP, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count)
+    end function hipsolverZgeqrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgeqrfStridedBatchedFortran(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgeqrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverSgeqrfStridedBatchedFortran
+    
+    function hipsolverDgeqrfStridedBatchedFortran(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgeqrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverDgeqrfStridedBatchedFortran
+    
+    function hipsolverCgeqrfStridedBatchedFortran(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgeqrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverCgeqrfStridedBatchedFortran
+    
+    function hipsolverZgeqrfStridedBatchedFortran(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgeqrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, info, &
+                batch_count)
+    end function hipsolverZgeqrfStridedBatchedFortran
+
+    ! ******************** GELS_STRIDED_BATCHED ********************
+    function hipsolverSgelsStridedBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgelsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count)
+    end function hipsolverSgelsStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgelsStridedBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgelsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count)
+    end function hipsolverDgelsStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgelsStridedBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgelsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count)
+    end function hipsolverCgelsStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgelsStridedBatched_bufferSizeFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, &
+            strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgelsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count)
+    end function hipsolverZgelsStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgelsStridedBatchedFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgelsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, lwork, &
+                info, batch_count)
+    end function hipsolverSgelsStridedBatchedFortran
+    
+    function hipsolverDgelsStridedBatchedFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgelsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, lwork, &
+                info, batch_count)
+    end function hipsolverDgelsStridedBatchedFortran
+    
+    function hipsolverCgelsStridedBatchedFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgelsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, lwork, &
+                info, batch_count)
+    end function hipsolverCgelsStridedBatchedFortran
+    
+    function hipsolverZgelsStridedBatchedFortran(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgelsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, lwork, &
+                info, batch_count)
+    end function hipsolverZgelsStridedBatchedFortran
+
+    ! ******************** GESVD ********************
+    function hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverSgesvd_bufferSizeFortran
+    
+    function hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverDgesvd_bufferSizeFortran
+    
+    function hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverCgesvd_bufferSizeFortran
+    
+    function hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
+    end function hipsolverZgesvd_bufferSizeFortran
+
+    function hipsolverSgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverSgesvdFortran
+
+    function hipsolverDgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverDgesvdFortran
+
+    function hipsolverCgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverCgesvdFortran
+
+    function hipsolverZgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
+    end function hipsolverZgesvdFortran
+
+    ! ******************** GESVD_STRIDED_BATCHED ********************
+    function hipsolverSgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count)
+    end function hipsolverSgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count)
+    end function hipsolverDgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count)
+    end function hipsolverCgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgesvdStridedBatched_bufferSizeFortran(handle, jobu, jobv, m, n, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count)
+    end function hipsolverZgesvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, &
+            ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count)
+    end function hipsolverSgesvdStridedBatchedFortran
+    
+    function hipsolverDgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, &
+            ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count)
+    end function hipsolverDgesvdStridedBatchedFortran
+    
+    function hipsolverCgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, &
+            ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count)
+    end function hipsolverCgesvdStridedBatchedFortran
+    
+    function hipsolverZgesvdStridedBatchedFortran(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, &
+            ldu, strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_signed_char), value :: jobu
+        integer(c_signed_char), value :: jobv
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: S
+        integer(c_int), value :: strideS
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        integer(c_int), value :: strideU
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        integer(c_int), value :: strideV
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: rwork
+        integer(c_int), value :: strideRwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count)
+    end function hipsolverZgesvdStridedBatchedFortran
+
+    ! ******************** GESVDJ_BATCHED ********************
+    function hipsolverSgesvdjBatched_bufferSizeFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdjBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, &
+                batch_count)
+    end function hipsolverSgesvdjBatched_bufferSizeFortran
+    
+    function hipsolverDgesvdjBatched_bufferSizeFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdjBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, &
+                batch_count)
+    end function hipsolverDgesvdjBatched_bufferSizeFortran
+    
+    function hipsolverCgesvdjBatched_bufferSizeFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdjBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, &
+                batch_count)
+    end function hipsolverCgesvdjBatched_bufferSizeFortran
+    
+    function hipsolverZgesvdjBatched_bufferSizeFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdjBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, params, &
+                batch_count)
+    end function hipsolverZgesvdjBatched_bufferSizeFortran
+    
+    function hipsolverSgesvdjBatchedFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgesvdjBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count)
+    end function hipsolverSgesvdjBatchedFortran
+    
+    function hipsolverDgesvdjBatchedFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgesvdjBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count)
+    end function hipsolverDgesvdjBatchedFortran
+    
+    function hipsolverCgesvdjBatchedFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgesvdjBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count)
+    end function hipsolverCgesvdjBatchedFortran
+    
+    function hipsolverZgesvdjBatchedFortran(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+            params, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgesvdjBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: S
+        type(c_ptr), value :: U
+        integer(c_int), value :: ldu
+        type(c_ptr), value :: V
+        integer(c_int), value :: ldv
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count)
+    end function hipsolverZgesvdjBatchedFortran
+
+    ! ******************** GETRF ********************
+    function hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverSgetrf_bufferSizeFortran
+    
+    function hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverDgetrf_bufferSizeFortran
+    
+    function hipsolverCgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverCgetrf_bufferSizeFortran
+    
+    function hipsolverZgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork)
+    end function hipsolverZgetrf_bufferSizeFortran
+
+    function hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverSgetrfFortran
+    
+    function hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverDgetrfFortran
+    
+    function hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverCgetrfFortran
+
+    function hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
+    end function hipsolverZgetrfFortran
+    
+    ! ******************** GETRF_BATCHED ********************
+    function hipsolverSgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverSgetrfBatched_bufferSizeFortran
+    
+    function hipsolverDgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverDgetrfBatched_bufferSizeFortran
+    
+    function hipsolverCgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverCgetrfBatched_bufferSizeFortran
+    
+    function hipsolverZgetrfBatched_bufferSizeFortran(handle, m, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count)
+    end function hipsolverZgetrfBatched_bufferSizeFortran
+    
+    function hipsolverSgetrfBatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count)
+    end function hipsolverSgetrfBatchedFortran
+    
+    function hipsolverDgetrfBatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count)
+    end function hipsolverDgetrfBatchedFortran
+    
+    function hipsolverCgetrfBatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count)
+    end function hipsolverCgetrfBatchedFortran
+    
+    function hipsolverZgetrfBatchedFortran(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count)
+    end function hipsolverZgetrfBatchedFortran
+
+    ! ******************** GETRF_STRIDED_BATCHED ********************
+    function hipsolverSgetrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverSgetrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgetrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverDgetrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgetrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverCgetrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgetrfStridedBatched_bufferSizeFortran(handle, m, n, A, lda, strideA, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count)
+    end function hipsolverZgetrfStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgetrfStridedBatchedFortran(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, info, &
+                batch_count)
+    end function hipsolverSgetrfStridedBatchedFortran
+    
+    function hipsolverDgetrfStridedBatchedFortran(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, info, &
+                batch_count)
+    end function hipsolverDgetrfStridedBatchedFortran
+    
+    function hipsolverCgetrfStridedBatchedFortran(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, info, &
+                batch_count)
+    end function hipsolverCgetrfStridedBatchedFortran
+    
+    function hipsolverZgetrfStridedBatchedFortran(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrfStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: m
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, info, &
+                batch_count)
+    end function hipsolverZgetrfStridedBatchedFortran
+
+    ! ******************** GETRI_OUTOFPLACE_BATCHED ********************
+    function hipsolverSgetriOutOfPlaceBatched_bufferSizeFortran(handle, n, A, lda, ipiv, strideP, C, ldc, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetriOutOfPlaceBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count)
+    end function hipsolverSgetriOutOfPlaceBatched_bufferSizeFortran
+    
+    function hipsolverDgetriOutOfPlaceBatched_bufferSizeFortran(handle, n, A, lda, ipiv, strideP, C, ldc, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetriOutOfPlaceBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count)
+    end function hipsolverDgetriOutOfPlaceBatched_bufferSizeFortran
+    
+    function hipsolverCgetriOutOfPlaceBatched_bufferSizeFortran(handle, n, A, lda, ipiv, strideP, C, ldc, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetriOutOfPlaceBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count)
+    end function hipsolverCgetriOutOfPlaceBatched_bufferSizeFortran
+    
+    function hipsolverZgetriOutOfPlaceBatched_bufferSizeFortran(handle, n, A, lda, ipiv, strideP, C, ldc, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetriOutOfPlaceBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count)
+    end function hipsolverZgetriOutOfPlaceBatched_bufferSizeFortran
+    
+    function hipsolverSgetriOutOfPlaceBatchedFortran(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetriOutOfPlaceBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count)
+    end function hipsolverSgetriOutOfPlaceBatchedFortran
+    
+    function hipsolverDgetriOutOfPlaceBatchedFortran(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetriOutOfPlaceBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count)
+    end function hipsolverDgetriOutOfPlaceBatchedFortran
+    
+    function hipsolverCgetriOutOfPlaceBatchedFortran(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetriOutOfPlaceBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count)
+    end function hipsolverCgetriOutOfPlaceBatchedFortran
+    
+    function hipsolverZgetriOutOfPlaceBatchedFortran(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetriOutOfPlaceBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count)
+    end function hipsolverZgetriOutOfPlaceBatchedFortran
+
+    ! ******************** GETRI_OUTOFPLACE_STRIDED_BATCHED ********************
+    function hipsolverSgetriOutOfPlaceStridedBatched_bufferSizeFortran(handle, n, A, lda, strideA, ipiv, &
+            strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetriOutOfPlaceStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, C, &
+                ldc, strideC, lwork, batch_count)
+    end function hipsolverSgetriOutOfPlaceStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgetriOutOfPlaceStridedBatched_bufferSizeFortran(handle, n, A, lda, strideA, ipiv, &
+            strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetriOutOfPlaceStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, C, &
+                ldc, strideC, lwork, batch_count)
+    end function hipsolverDgetriOutOfPlaceStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgetriOutOfPlaceStridedBatched_bufferSizeFortran(handle, n, A, lda, strideA, ipiv, &
+            strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetriOutOfPlaceStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, C, &
+                ldc, strideC, lwork, batch_count)
+    end function hipsolverCgetriOutOfPlaceStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgetriOutOfPlaceStridedBatched_bufferSizeFortran(handle, n, A, lda, strideA, ipiv, &
+            strideP, C, ldc, strideC, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetriOutOfPlaceStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, C, &
+                ldc, strideC, lwork, batch_count)
+    end function hipsolverZgetriOutOfPlaceStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgetriOutOfPlaceStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+            strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetriOutOfPlaceStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count)
+    end function hipsolverSgetriOutOfPlaceStridedBatchedFortran
+    
+    function hipsolverDgetriOutOfPlaceStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+            strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetriOutOfPlaceStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count)
+    end function hipsolverDgetriOutOfPlaceStridedBatchedFortran
+    
+    function hipsolverCgetriOutOfPlaceStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+            strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetriOutOfPlaceStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count)
+    end function hipsolverCgetriOutOfPlaceStridedBatchedFortran
+    
+    function hipsolverZgetriOutOfPlaceStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+            strideC, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetriOutOfPlaceStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: C
+        integer(c_int), value :: ldc
+        integer(c_int), value :: strideC
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count)
+    end function hipsolverZgetriOutOfPlaceStridedBatchedFortran
+
+    ! ******************** GETRS ********************
+    function hipsolverSgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverSgetrs_bufferSizeFortran
+    
+    function hipsolverDgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverDgetrs_bufferSizeFortran
+    
+    function hipsolverCgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverCgetrs_bufferSizeFortran
+    
+    function hipsolverZgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrs_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
+    end function hipsolverZgetrs_bufferSizeFortran
+
+    function hipsolverSgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverSgetrsFortran
+    
+    function hipsolverDgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverDgetrsFortran
+    
+    function hipsolverCgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverCgetrsFortran
+    
+    function hipsolverZgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
+    end function hipsolverZgetrsFortran
+
+    ! ******************** GETRS_BATCHED ********************
+    function hipsolverSgetrsBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, lwork, &
+                batch_count)
+    end function hipsolverSgetrsBatched_bufferSizeFortran
+    
+    function hipsolverDgetrsBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, lwork, &
+                batch_count)
+    end function hipsolverDgetrsBatched_bufferSizeFortran
+    
+    function hipsolverCgetrsBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, lwork, &
+                batch_count)
+    end function hipsolverCgetrsBatched_bufferSizeFortran
+    
+    function hipsolverZgetrsBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+            lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, lwork, &
+                batch_count)
+    end function hipsolverZgetrsBatched_bufferSizeFortran
+    
+    function hipsolverSgetrsBatchedFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, info, &
+                batch_count)
+    end function hipsolverSgetrsBatchedFortran
+    
+    function hipsolverDgetrsBatchedFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, info, &
+                batch_count)
+    end function hipsolverDgetrsBatchedFortran
+    
+    function hipsolverCgetrsBatchedFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, info, &
+                batch_count)
+    end function hipsolverCgetrsBatchedFortran
+    
+    function hipsolverZgetrsBatchedFortran(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+            info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, info, &
+                batch_count)
+    end function hipsolverZgetrsBatchedFortran
+
+    ! ******************** GETRS_STRIDED_BATCHED ********************
+    function hipsolverSgetrsStridedBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+            strideP, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count)
+    end function hipsolverSgetrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverDgetrsStridedBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+            strideP, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count)
+    end function hipsolverDgetrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverCgetrsStridedBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+            strideP, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count)
+    end function hipsolverCgetrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverZgetrsStridedBatched_bufferSizeFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+            strideP, B, ldb, strideB, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, &
+                B, ldb, strideB, lwork, batch_count)
+    end function hipsolverZgetrsStridedBatched_bufferSizeFortran
+    
+    function hipsolverSgetrsStridedBatchedFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSgetrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count)
+    end function hipsolverSgetrsStridedBatchedFortran
+    
+    function hipsolverDgetrsStridedBatchedFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDgetrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count)
+    end function hipsolverDgetrsStridedBatchedFortran
+    
+    function hipsolverCgetrsStridedBatchedFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCgetrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count)
+    end function hipsolverCgetrsStridedBatchedFortran
+    
+    function hipsolverZgetrsStridedBatchedFortran(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, &
+            ldb, strideB, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZgetrsStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: ipiv
+        integer(c_int), value :: strideP
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count)
+    end function hipsolverZgetrsStridedBatchedFortran
+
+    ! ******************** POTRF ********************
+    function hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverSpotrf_bufferSizeFortran
+    
+    function hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverDpotrf_bufferSizeFortran
+    
+    function hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverCpotrf_bufferSizeFortran
+    
+    function hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrf_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
+    end function hipsolverZpotrf_bufferSizeFortran
+
+    function hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverSpotrfFortran
+
+    function hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverDpotrfFortran
+
+    function hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverCpotrfFortran
+
+    function hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info)
+    end function hipsolverZpotrfFortran
+    
+    ! ******************** POTRF_BATCHED ********************
+    function hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverSpotrfBatched_bufferSizeFortran
+    
+    function hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverDpotrfBatched_bufferSizeFortran
+    
+    function hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverCpotrfBatched_bufferSizeFortran
+    
+    function hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
+    end function hipsolverZpotrfBatched_bufferSizeFortran
+
+    function hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverSpotrfBatchedFortran
+    
+    function hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverDpotrfBatchedFortran
+    
+    function hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverCpotrfBatchedFortran
+    
+    function hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrfBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
+    end function hipsolverZpotrfBatchedFortran
+
+    ! ******************** POTRS_BATCHED ********************
+    function hipsolverSpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverSpotrsBatched_bufferSizeFortran
+    
+    function hipsolverDpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverDpotrsBatched_bufferSizeFortran
+    
+    function hipsolverCpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverCpotrsBatched_bufferSizeFortran
+    
+    function hipsolverZpotrsBatched_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, batch_count)
+    end function hipsolverZpotrsBatched_bufferSizeFortran
+    
+    function hipsolverSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverSpotrsBatchedFortran
+    
+    function hipsolverDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverDpotrsBatchedFortran
+    
+    function hipsolverCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverCpotrsBatchedFortran
+    
+    function hipsolverZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZpotrsBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        integer(c_int), value :: nrhs
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, batch_count)
+    end function hipsolverZpotrsBatchedFortran
+
+    ! ******************** SYEVD/HEEVD ********************
+    function hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverSsyevd_bufferSizeFortran
+    
+    function hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverDsyevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverDsyevd_bufferSizeFortran
+    
+    function hipsolverCheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverCheevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverCheevd_bufferSizeFortran
+    
+    function hipsolverZheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+            result(res) &
+            bind(c, name = 'hipsolverZheevd_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: lwork
+        integer(c_int) :: res
+        res = hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
+    end function hipsolverZheevd_bufferSizeFortran
+
+    function hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverSsyevdFortran
+
+    function hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverDsyevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverDsyevdFortran
+
+    function hipsolverCheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverCheevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverCheevdFortran
+
+    function hipsolverZheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+            result(res) &
+            bind(c, name = 'hipsolverZheevdFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int) :: res
+        res = hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
+    end function hipsolverZheevdFortran
+
+    ! ******************** SYEVD/HEEVD_BATCHED ********************
+    function hipsolverSsyevdBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSsyevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, batch_count)
+    end function hipsolverSsyevdBatched_bufferSizeFortran
+    
+    function hipsolverDsyevdBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDsyevdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDsyevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, batch_count)
+    end function hipsolverDsyevdBatched_bufferSizeFortran
+    
+    function hipsolverCheevdBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCheevdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCheevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, batch_count)
+    end function hipsolverCheevdBatched_bufferSizeFortran
+    
+    function hipsolverZheevdBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZheevdBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZheevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, batch_count)
+    end function hipsolverZheevdBatched_bufferSizeFortran
+    
+    function hipsolverSsyevdBatchedFortran(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevdBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverSsyevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count)
+    end function hipsolverSsyevdBatchedFortran
+    
+    function hipsolverDsyevdBatchedFortran(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverDsyevdBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverDsyevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count)
+    end function hipsolverDsyevdBatchedFortran
+    
+    function hipsolverCheevdBatchedFortran(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+            batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverCheevdBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverDgesvd_bufferSizeFortran
+        res = hipsolverCheevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count)
+    end function hipsolverCheevdBatchedFortran
     
-    function hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    function hipsolverZheevdBatchedFortran(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZheevdBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: work
+        integer(c_int), value :: lwork
+        type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZheevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count)
+    end function hipsolverZheevdBatchedFortran
+
+    ! ******************** SYEVD/HEEVD_STRIDED_BATCHED ********************
+    function hipsolverSsyevdStridedBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, strideA, D, &
+            strideD, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverCgesvd_bufferSizeFortran
+        res = hipsolverSsyevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count)
+    end function hipsolverSsyevdStridedBatched_bufferSizeFortran
     
-    function hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork) &
+    function hipsolverDsyevdStridedBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, strideA, D, &
+            strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgesvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsyevdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork)
-    end function hipsolverZgesvd_bufferSizeFortran
-
-    function hipsolverSgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        res = hipsolverDsyevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count)
+    end function hipsolverDsyevdStridedBatched_bufferSizeFortran
+    
+    function hipsolverCheevdStridedBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, strideA, D, &
+            strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgesvdFortran')
+            bind(c, name = 'hipsolverCheevdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverCheevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count)
+    end function hipsolverCheevdStridedBatched_bufferSizeFortran
+    
+    function hipsolverZheevdStridedBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, strideA, D, &
+            strideD, lwork, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverZheevdStridedBatched_bufferSizeFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
+        integer(c_int) :: res
+        res = hipsolverZheevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count)
+    end function hipsolverZheevdStridedBatched_bufferSizeFortran
+    
+    function hipsolverSsyevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+            lwork, info, batch_count) &
+            result(res) &
+            bind(c, name = 'hipsolverSsyevdStridedBatchedFortran')
+        use iso_c_binding
+        use hipsolver_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+        integer(c_int), value :: n
+        type(c_ptr), value :: A
+        integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverSgesvdFortran
-
-    function hipsolverDgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        res = hipsolverSsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, lwork, &
+                info, batch_count)
+    end function hipsolverSsyevdStridedBatchedFortran
+    
+    function hipsolverDsyevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+            lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgesvdFortran')
+            bind(c, name = 'hipsolverDsyevdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverDgesvdFortran
-
-    function hipsolverCgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        res = hipsolverDsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, lwork, &
+                info, batch_count)
+    end function hipsolverDsyevdStridedBatchedFortran
+    
+    function hipsolverCheevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+            lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgesvdFortran')
+            bind(c, name = 'hipsolverCheevdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverCgesvdFortran
-
-    function hipsolverZgesvdFortran(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        res = hipsolverCheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, lwork, &
+                info, batch_count)
+    end function hipsolverCheevdStridedBatchedFortran
+    
+    function hipsolverZheevdStridedBatchedFortran(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+            lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgesvdFortran')
+            bind(c, name = 'hipsolverZheevdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_signed_char), value :: jobu
-        integer(c_signed_char), value :: jobv
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: S
-        type(c_ptr), value :: U
-        integer(c_int), value :: ldu
-        type(c_ptr), value :: V
-        integer(c_int), value :: ldv
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: rwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info)
-    end function hipsolverZgesvdFortran
+        res = hipsolverZheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, lwork, &
+                info, batch_count)
+    end function hipsolverZheevdStridedBatchedFortran
 
-    ! ******************** GETRF ********************
-    function hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    ! ******************** SYEVJ/HEEVJ_BATCHED ********************
+    function hipsolverSsyevjBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsyevjBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverSgetrf_bufferSizeFortran
+        res = hipsolverSsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count)
+    end function hipsolverSsyevjBatched_bufferSizeFortran
     
-    function hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    function hipsolverDsyevjBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsyevjBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverDgetrf_bufferSizeFortran
+        res = hipsolverDsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count)
+    end function hipsolverDsyevjBatched_bufferSizeFortran
     
-    function hipsolverCgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    function hipsolverCheevjBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverCheevjBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverCgetrf_bufferSizeFortran
+        res = hipsolverCheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count)
+    end function hipsolverCheevjBatched_bufferSizeFortran
     
-    function hipsolverZgetrf_bufferSizeFortran(handle, m, n, A, lda, lwork) &
+    function hipsolverZheevjBatched_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverZheevjBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: lwork
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork)
-    end function hipsolverZgetrf_bufferSizeFortran
-
-    function hipsolverSgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        res = hipsolverZheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count)
+    end function hipsolverZheevjBatched_bufferSizeFortran
+    
+    function hipsolverSsyevjBatchedFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrfFortran')
+            bind(c, name = 'hipsolverSsyevjBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverSgetrfFortran
+        res = hipsolverSsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count)
+    end function hipsolverSsyevjBatchedFortran
     
-    function hipsolverDgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+    function hipsolverDsyevjBatchedFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrfFortran')
+            bind(c, name = 'hipsolverDsyevjBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverDgetrfFortran
+        res = hipsolverDsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count)
+    end function hipsolverDsyevjBatchedFortran
     
-    function hipsolverCgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+    function hipsolverCheevjBatchedFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrfFortran')
+            bind(c, name = 'hipsolverCheevjBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverCgetrfFortran
-
-    function hipsolverZgetrfFortran(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        res = hipsolverCheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count)
+    end function hipsolverCheevjBatchedFortran
+    
+    function hipsolverZheevjBatchedFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+            batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrfFortran')
+            bind(c, name = 'hipsolverZheevjBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(c_int), value :: m
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        type(c_ptr), value :: W
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: info
+        type(c_ptr), value :: params
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info)
-    end function hipsolverZgetrfFortran
-    
-    ! ******************** GETRS ********************
-    function hipsolverSgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        res = hipsolverZheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, batch_count)
+    end function hipsolverZheevjBatchedFortran
+
+    ! ******************** SYGVD/HEGVD ********************
+    function hipsolverSsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsygvd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverSgetrs_bufferSizeFortran
+        res = hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverSsygvd_bufferSizeFortran
     
-    function hipsolverDgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+    function hipsolverDsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsygvd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverDgetrs_bufferSizeFortran
+        res = hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverDsygvd_bufferSizeFortran
     
-    function hipsolverCgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+    function hipsolverChegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverChegvd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverCgetrs_bufferSizeFortran
+        res = hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverChegvd_bufferSizeFortran
     
-    function hipsolverZgetrs_bufferSizeFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+    function hipsolverZhegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrs_bufferSizeFortran')
+            bind(c, name = 'hipsolverZhegvd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork)
-    end function hipsolverZgetrs_bufferSizeFortran
+        res = hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
+    end function hipsolverZhegvd_bufferSizeFortran
 
-    function hipsolverSgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+    function hipsolverSsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSgetrsFortran')
+            bind(c, name = 'hipsolverSsygvdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverSgetrsFortran
-    
-    function hipsolverDgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        res = hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverSsygvdFortran
+
+    function hipsolverDsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDgetrsFortran')
+            bind(c, name = 'hipsolverDsygvdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverDgetrsFortran
-    
-    function hipsolverCgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        res = hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverDsygvdFortran
+
+    function hipsolverChegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCgetrsFortran')
+            bind(c, name = 'hipsolverChegvdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverCgetrsFortran
-    
-    function hipsolverZgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        res = hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverChegvdFortran
+
+    function hipsolverZhegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZgetrsFortran')
+            bind(c, name = 'hipsolverZhegvdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_OP_N)), value :: trans
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+        integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
-        integer(c_int), value :: nrhs
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: ipiv
         type(c_ptr), value :: B
         integer(c_int), value :: ldb
+        type(c_ptr), value :: D
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info)
-    end function hipsolverZgetrsFortran
+        res = hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
+    end function hipsolverZhegvdFortran
 
-    ! ******************** POTRF ********************
-    function hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    ! ******************** SYGVD/HEGVD_STRIDED_BATCHED ********************
+    function hipsolverSsygvdStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsygvdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverSpotrf_bufferSizeFortran
+        res = hipsolverSsygvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, lwork, batch_count)
+    end function hipsolverSsygvdStridedBatched_bufferSizeFortran
     
-    function hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverDsygvdStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsygvdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverDpotrf_bufferSizeFortran
+        res = hipsolverDsygvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, lwork, batch_count)
+    end function hipsolverDsygvdStridedBatched_bufferSizeFortran
     
-    function hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverChegvdStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverChegvdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverCpotrf_bufferSizeFortran
+        res = hipsolverChegvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, lwork, batch_count)
+    end function hipsolverChegvdStridedBatched_bufferSizeFortran
     
-    function hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork) &
+    function hipsolverZhegvdStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrf_bufferSizeFortran')
+            bind(c, name = 'hipsolverZhegvdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork)
-    end function hipsolverZpotrf_bufferSizeFortran
-
-    function hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverZhegvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, lwork, batch_count)
+    end function hipsolverZhegvdStridedBatched_bufferSizeFortran
+    
+    function hipsolverSsygvdStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+            strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfFortran')
+            bind(c, name = 'hipsolverSsygvdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverSpotrfFortran
-
-    function hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverSsygvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, D, &
+                strideD, work, lwork, info, batch_count)
+    end function hipsolverSsygvdStridedBatchedFortran
+    
+    function hipsolverDsygvdStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+            strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfFortran')
+            bind(c, name = 'hipsolverDsygvdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverDpotrfFortran
-
-    function hipsolverCpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverDsygvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, D, &
+                strideD, work, lwork, info, batch_count)
+    end function hipsolverDsygvdStridedBatchedFortran
+    
+    function hipsolverChegvdStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+            strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfFortran')
+            bind(c, name = 'hipsolverChegvdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverCpotrfFortran
-
-    function hipsolverZpotrfFortran(handle, uplo, n, A, lda, work, lwork, info) &
+        res = hipsolverChegvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, D, &
+                strideD, work, lwork, info, batch_count)
+    end function hipsolverChegvdStridedBatchedFortran
+    
+    function hipsolverZhegvdStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+            strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfFortran')
+            bind(c, name = 'hipsolverZhegvdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info)
-    end function hipsolverZpotrfFortran
-    
-    ! ******************** POTRF_BATCHED ********************
-    function hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+        res = hipsolverZhegvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, D, &
+                strideD, work, lwork, info, batch_count)
+    end function hipsolverZhegvdStridedBatchedFortran
+
+    ! ******************** SYGVD/HEGVD_FACTORED_STRIDED_BATCHED ********************
+    function hipsolverSsygvdFactoredStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, &
+            strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsygvdFactoredStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverSpotrfBatched_bufferSizeFortran
+        res = hipsolverSsygvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, &
+                B, ldb, strideB, D, strideD, lwork, batch_count)
+    end function hipsolverSsygvdFactoredStridedBatched_bufferSizeFortran
     
-    function hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+    function hipsolverDsygvdFactoredStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, &
+            strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsygvdFactoredStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverDpotrfBatched_bufferSizeFortran
+        res = hipsolverDsygvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, &
+                B, ldb, strideB, D, strideD, lwork, batch_count)
+    end function hipsolverDsygvdFactoredStridedBatched_bufferSizeFortran
     
-    function hipsolverCpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+    function hipsolverChegvdFactoredStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, &
+            strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverChegvdFactoredStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverCpotrfBatched_bufferSizeFortran
+        res = hipsolverChegvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, &
+                B, ldb, strideB, D, strideD, lwork, batch_count)
+    end function hipsolverChegvdFactoredStridedBatched_bufferSizeFortran
     
-    function hipsolverZpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, batch_count) &
+    function hipsolverZhegvdFactoredStridedBatched_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, &
+            strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfBatched_bufferSizeFortran')
+            bind(c, name = 'hipsolverZhegvdFactoredStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: lwork
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count)
-    end function hipsolverZpotrfBatched_bufferSizeFortran
-
-    function hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        res = hipsolverZhegvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, &
+                B, ldb, strideB, D, strideD, lwork, batch_count)
+    end function hipsolverZhegvdFactoredStridedBatched_bufferSizeFortran
+    
+    function hipsolverSsygvdFactoredStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSpotrfBatchedFortran')
+            bind(c, name = 'hipsolverSsygvdFactoredStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverSpotrfBatchedFortran
+        res = hipsolverSsygvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count)
+    end function hipsolverSsygvdFactoredStridedBatchedFortran
     
-    function hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+    function hipsolverDsygvdFactoredStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDpotrfBatchedFortran')
+            bind(c, name = 'hipsolverDsygvdFactoredStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverDpotrfBatchedFortran
+        res = hipsolverDsygvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count)
+    end function hipsolverDsygvdFactoredStridedBatchedFortran
     
-    function hipsolverCpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+    function hipsolverChegvdFactoredStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverCpotrfBatchedFortran')
+            bind(c, name = 'hipsolverChegvdFactoredStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverCpotrfBatchedFortran
+        res = hipsolverChegvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count)
+    end function hipsolverChegvdFactoredStridedBatchedFortran
     
-    function hipsolverZpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+    function hipsolverZhegvdFactoredStridedBatchedFortran(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+            ldb, strideB, D, strideD, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZpotrfBatchedFortran')
+            bind(c, name = 'hipsolverZhegvdFactoredStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
+        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
+        type(c_ptr), value :: B
+        integer(c_int), value :: ldb
+        integer(c_int), value :: strideB
+        type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count)
-    end function hipsolverZpotrfBatchedFortran
+        res = hipsolverZhegvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count)
+    end function hipsolverZhegvdFactoredStridedBatchedFortran
 
-    ! ******************** SYEVD/HEEVD ********************
-    function hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    ! ******************** SYTRD/HETRD ********************
+    function hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverSsyevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsytrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverSsyevd_bufferSizeFortran
+        res = hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverSsytrd_bufferSizeFortran
     
-    function hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    function hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverDsyevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsytrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverDsyevd_bufferSizeFortran
+        res = hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverDsytrd_bufferSizeFortran
     
-    function hipsolverCheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    function hipsolverChetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverCheevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverChetrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverCheevd_bufferSizeFortran
+        res = hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverChetrd_bufferSizeFortran
     
-    function hipsolverZheevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, D, lwork) &
+    function hipsolverZhetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
             result(res) &
-            bind(c, name = 'hipsolverZheevd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZhetrd_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: lwork
         integer(c_int) :: res
-        res = hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork)
-    end function hipsolverZheevd_bufferSizeFortran
+        res = hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
+    end function hipsolverZhetrd_bufferSizeFortran
 
-    function hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverSsyevdFortran')
+            bind(c, name = 'hipsolverSsytrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverSsyevdFortran
+        res = hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverSsytrdFortran
 
-    function hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverDsyevdFortran')
+            bind(c, name = 'hipsolverDsytrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverDsyevdFortran
+        res = hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverDsytrdFortran
 
-    function hipsolverCheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverChetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverCheevdFortran')
+            bind(c, name = 'hipsolverChetrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverCheevdFortran
+        res = hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverChetrdFortran
 
-    function hipsolverZheevdFortran(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+    function hipsolverZhetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
             result(res) &
-            bind(c, name = 'hipsolverZheevdFortran')
+            bind(c, name = 'hipsolverZhetrdFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
         type(c_ptr), value :: D
+        type(c_ptr), value :: E
+        type(c_ptr), value :: tau
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
         integer(c_int) :: res
-        res = hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info)
-    end function hipsolverZheevdFortran
+        res = hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
+    end function hipsolverZhetrdFortran
 
-    ! ******************** SYGVD/HEGVD ********************
-    function hipsolverSsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+    ! ******************** SYTRD/HETRD_BATCHED ********************
+    function hipsolverSsytrdBatched_bufferSizeFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSsygvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsytrdBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverSsygvd_bufferSizeFortran
+        res = hipsolverSsytrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count)
+    end function hipsolverSsytrdBatched_bufferSizeFortran
     
-    function hipsolverDsygvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+    function hipsolverDsytrdBatched_bufferSizeFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDsygvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsytrdBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverDsygvd_bufferSizeFortran
+        res = hipsolverDsytrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count)
+    end function hipsolverDsytrdBatched_bufferSizeFortran
     
-    function hipsolverChegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+    function hipsolverChetrdBatched_bufferSizeFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverChegvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverChetrdBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverChegvd_bufferSizeFortran
+        res = hipsolverChetrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count)
+    end function hipsolverChetrdBatched_bufferSizeFortran
     
-    function hipsolverZhegvd_bufferSizeFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+    function hipsolverZhetrdBatched_bufferSizeFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+            strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZhegvd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZhetrdBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork)
-    end function hipsolverZhegvd_bufferSizeFortran
-
-    function hipsolverSsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        res = hipsolverZhetrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count)
+    end function hipsolverZhetrdBatched_bufferSizeFortran
+    
+    function hipsolverSsytrdBatchedFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSsygvdFortran')
+            bind(c, name = 'hipsolverSsytrdBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverSsygvdFortran
-
-    function hipsolverDsygvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        res = hipsolverSsytrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverSsytrdBatchedFortran
+    
+    function hipsolverDsytrdBatchedFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDsygvdFortran')
+            bind(c, name = 'hipsolverDsytrdBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverDsygvdFortran
-
-    function hipsolverChegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        res = hipsolverDsytrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverDsytrdBatchedFortran
+    
+    function hipsolverChetrdBatchedFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverChegvdFortran')
+            bind(c, name = 'hipsolverChetrdBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverChegvdFortran
-
-    function hipsolverZhegvdFortran(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        res = hipsolverChetrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverChetrdBatchedFortran
+    
+    function hipsolverZhetrdBatchedFortran(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, &
+            work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZhegvdFortran')
+            bind(c, name = 'hipsolverZhetrdBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
         type(c_ptr), value :: handle
-        integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-        integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
         integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
-        type(c_ptr), value :: B
-        integer(c_int), value :: ldb
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
+        type(c_ptr), value :: E
+        integer(c_int), value :: strideE
+        type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info)
-    end function hipsolverZhegvdFortran
+        res = hipsolverZhetrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count)
+    end function hipsolverZhetrdBatchedFortran
 
-    ! ******************** SYTRD/HETRD ********************
-    function hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+    ! ******************** SYTRD/HETRD_STRIDED_BATCHED ********************
+    function hipsolverSsytrdStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, D, strideD, &
+            E, strideE, tau, strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSsytrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverSsytrdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2230,17 +7828,24 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverSsytrd_bufferSizeFortran
+        res = hipsolverSsytrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count)
+    end function hipsolverSsytrdStridedBatched_bufferSizeFortran
     
-    function hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+    function hipsolverDsytrdStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, D, strideD, &
+            E, strideE, tau, strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDsytrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverDsytrdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2249,17 +7854,24 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverDsytrd_bufferSizeFortran
+        res = hipsolverDsytrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count)
+    end function hipsolverDsytrdStridedBatched_bufferSizeFortran
     
-    function hipsolverChetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+    function hipsolverChetrdStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, D, strideD, &
+            E, strideE, tau, strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverChetrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverChetrdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2268,17 +7880,24 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverChetrd_bufferSizeFortran
+        res = hipsolverChetrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count)
+    end function hipsolverChetrdStridedBatched_bufferSizeFortran
     
-    function hipsolverZhetrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork) &
+    function hipsolverZhetrdStridedBatched_bufferSizeFortran(handle, uplo, n, A, lda, strideA, D, strideD, &
+            E, strideE, tau, strideP, lwork, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZhetrd_bufferSizeFortran')
+            bind(c, name = 'hipsolverZhetrdStridedBatched_bufferSizeFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2287,17 +7906,24 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: lwork
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork)
-    end function hipsolverZhetrd_bufferSizeFortran
-
-    function hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        res = hipsolverZhetrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count)
+    end function hipsolverZhetrdStridedBatched_bufferSizeFortran
+    
+    function hipsolverSsytrdStridedBatchedFortran(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+            tau, strideP, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverSsytrdFortran')
+            bind(c, name = 'hipsolverSsytrdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2306,19 +7932,26 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverSsytrdFortran
-
-    function hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        res = hipsolverSsytrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, tau, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverSsytrdStridedBatchedFortran
+    
+    function hipsolverDsytrdStridedBatchedFortran(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+            tau, strideP, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverDsytrdFortran')
+            bind(c, name = 'hipsolverDsytrdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2327,19 +7960,26 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverDsytrdFortran
-
-    function hipsolverChetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        res = hipsolverDsytrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, tau, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverDsytrdStridedBatchedFortran
+    
+    function hipsolverChetrdStridedBatchedFortran(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+            tau, strideP, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverChetrdFortran')
+            bind(c, name = 'hipsolverChetrdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2348,19 +7988,26 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverChetrdFortran
-
-    function hipsolverZhetrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        res = hipsolverChetrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, tau, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverChetrdStridedBatchedFortran
+    
+    function hipsolverZhetrdStridedBatchedFortran(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+            tau, strideP, work, lwork, info, batch_count) &
             result(res) &
-            bind(c, name = 'hipsolverZhetrdFortran')
+            bind(c, name = 'hipsolverZhetrdStridedBatchedFortran')
         use iso_c_binding
         use hipsolver_enums
         implicit none
@@ -2369,14 +8016,20 @@ module hipsolver_interface
         integer(c_int), value :: n
         type(c_ptr), value :: A
         integer(c_int), value :: lda
+        integer(c_int), value :: strideA
         type(c_ptr), value :: D
+        integer(c_int), value :: strideD
         type(c_ptr), value :: E
+        integer(c_int), value :: strideE
         type(c_ptr), value :: tau
+        integer(c_int), value :: strideP
         type(c_ptr), value :: work
         integer(c_int), value :: lwork
         type(c_ptr), value :: info
+        integer(c_int), value :: batch_count
         integer(c_int) :: res
-        res = hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info)
-    end function hipsolverZhetrdFortran
+        res = hipsolverZhetrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, tau, &
+                strideP, work, lwork, info, batch_count)
+    end function hipsolverZhetrdStridedBatchedFortran
     
 end module hipsolver_interface
@@ -111,6 +111,237 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungbrFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// orgbr_batched/ungbr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgbrBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             float*              A[],
+                                             int                 lda,
+                                             float*              tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgbrBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             double*             A[],
+                                             int                 lda,
+                                             double*             tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungbrBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipsolverComplex*   A[],
+                                             int                 lda,
+                                             hipsolverComplex*   tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungbrBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverSideMode_t     side,
+                                             int                     m,
+                                             int                     n,
+                                             int                     k,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbrBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 float*              A[],
+                                                                 int                 lda,
+                                                                 float*              tau,
+                                                                 int                 strideP,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgbrBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 double*             A[],
+                                                                 int                 lda,
+                                                                 double*             tau,
+                                                                 int                 strideP,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungbrBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipsolverComplex*   A[],
+                                                                 int                 lda,
+                                                                 hipsolverComplex*   tau,
+                                                                 int                 strideP,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungbrBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverSideMode_t     side,
+                                  int                     m,
+                                  int                     n,
+                                  int                     k,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// orgbr_strided_batched/ungbr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgbrStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverSideMode_t side,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 k,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    float*              tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgbrStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverSideMode_t side,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 k,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    double*             tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungbrStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverSideMode_t side,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 k,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    hipsolverComplex*   tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungbrStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    hipsolverSideMode_t     side,
+                                                    int                     m,
+                                                    int                     n,
+                                                    int                     k,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    hipsolverDoubleComplex* tau,
+                                                    int                     strideP,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgbrStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverSideMode_t side,
+                                         int                 m,
+                                         int                 n,
+                                         int                 k,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         float*              tau,
+                                         int                 strideP,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgbrStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverSideMode_t side,
+                                         int                 m,
+                                         int                 n,
+                                         int                 k,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         double*             tau,
+                                         int                 strideP,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungbrStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverSideMode_t side,
+                                         int                 m,
+                                         int                 n,
+                                         int                 k,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         hipsolverComplex*   tau,
+                                         int                 strideP,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungbrStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         hipsolverSideMode_t     side,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
 // orgqr/ungqr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqr_bufferSizeFortran(
     hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork);
@@ -180,6 +411,221 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungqrFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// orgqr_batched/ungqr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgqrBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             float*            A[],
+                                             int               lda,
+                                             float*            tau,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgqrBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             double*           A[],
+                                             int               lda,
+                                             double*           tau,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungqrBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipsolverComplex* A[],
+                                             int               lda,
+                                             hipsolverComplex* tau,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungqrBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             int                     k,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqrBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 float*            A[],
+                                                                 int               lda,
+                                                                 float*            tau,
+                                                                 int               strideP,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgqrBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 double*           A[],
+                                                                 int               lda,
+                                                                 double*           tau,
+                                                                 int               strideP,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungqrBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 hipsolverComplex* A[],
+                                                                 int               lda,
+                                                                 hipsolverComplex* tau,
+                                                                 int               strideP,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungqrBatchedFortran(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  int                     k,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// orgqr_strided_batched/ungqr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgqrStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               k,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    float*            tau,
+                                                    int               strideP,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgqrStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               k,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    double*           tau,
+                                                    int               strideP,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungqrStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    int               k,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    hipsolverComplex* tau,
+                                                    int               strideP,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungqrStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    int                     k,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    hipsolverDoubleComplex* tau,
+                                                    int                     strideP,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgqrStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               k,
+                                         float*            A,
+                                         int               lda,
+                                         int               strideA,
+                                         float*            tau,
+                                         int               strideP,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgqrStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               k,
+                                         double*           A,
+                                         int               lda,
+                                         int               strideA,
+                                         double*           tau,
+                                         int               strideP,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungqrStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         int               k,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               strideA,
+                                         hipsolverComplex* tau,
+                                         int               strideP,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungqrStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
 // orgtr/ungtr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtr_bufferSizeFortran(hipsolverHandle_t   handle,
                                                                      hipsolverFillMode_t uplo,
@@ -253,6 +699,205 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungtrFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// orgtr_batched/ungtr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgtrBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A[],
+                                             int                 lda,
+                                             float*              tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgtrBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A[],
+                                             int                 lda,
+                                             double*             tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungtrBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A[],
+                                             int                 lda,
+                                             hipsolverComplex*   tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungtrBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtrBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A[],
+                                                                 int                 lda,
+                                                                 float*              tau,
+                                                                 int                 strideP,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgtrBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A[],
+                                                                 int                 lda,
+                                                                 double*             tau,
+                                                                 int                 strideP,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungtrBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipsolverComplex*   A[],
+                                                                 int                 lda,
+                                                                 hipsolverComplex*   tau,
+                                                                 int                 strideP,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungtrBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// orgtr_strided_batched/ungtr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgtrStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    float*              tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgtrStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    double*             tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungtrStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    hipsolverComplex*   tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungtrStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    hipsolverDoubleComplex* tau,
+                                                    int                     strideP,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgtrStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         float*              tau,
+                                         int                 strideP,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgtrStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         double*             tau,
+                                         int                 strideP,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungtrStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         hipsolverComplex*   tau,
+                                         int                 strideP,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungtrStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
 // ormqr/unmqr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqr_bufferSizeFortran(hipsolverHandle_t    handle,
                                                                      hipsolverSideMode_t  side,
@@ -366,6 +1011,293 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmqrFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// ormqr_batched/unmqr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSormqrBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             float*               A[],
+                                             int                  lda,
+                                             float*               tau,
+                                             int                  strideP,
+                                             float*               C[],
+                                             int                  ldc,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDormqrBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             double*              A[],
+                                             int                  lda,
+                                             double*              tau,
+                                             int                  strideP,
+                                             double*              C[],
+                                             int                  ldc,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCunmqrBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipsolverComplex*    A[],
+                                             int                  lda,
+                                             hipsolverComplex*    tau,
+                                             int                  strideP,
+                                             hipsolverComplex*    C[],
+                                             int                  ldc,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunmqrBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverSideMode_t     side,
+                                             hipsolverOperation_t    trans,
+                                             int                     m,
+                                             int                     n,
+                                             int                     k,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             hipsolverDoubleComplex* C[],
+                                             int                     ldc,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqrBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 float*               A[],
+                                                                 int                  lda,
+                                                                 float*               tau,
+                                                                 int                  strideP,
+                                                                 float*               C[],
+                                                                 int                  ldc,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDormqrBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 double*              A[],
+                                                                 int                  lda,
+                                                                 double*              tau,
+                                                                 int                  strideP,
+                                                                 double*              C[],
+                                                                 int                  ldc,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunmqrBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 hipsolverComplex*    A[],
+                                                                 int                  lda,
+                                                                 hipsolverComplex*    tau,
+                                                                 int                  strideP,
+                                                                 hipsolverComplex*    C[],
+                                                                 int                  ldc,
+                                                                 hipsolverComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunmqrBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverSideMode_t     side,
+                                  hipsolverOperation_t    trans,
+                                  int                     m,
+                                  int                     n,
+                                  int                     k,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* C[],
+                                  int                     ldc,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// ormqr_strided_batched/unmqr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSormqrStridedBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                                    hipsolverSideMode_t  side,
+                                                    hipsolverOperation_t trans,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    float*               A,
+                                                    int                  lda,
+                                                    int                  strideA,
+                                                    float*               tau,
+                                                    int                  strideP,
+                                                    float*               C,
+                                                    int                  ldc,
+                                                    int                  strideC,
+                                                    int*                 lwork,
+                                                    int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDormqrStridedBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                                    hipsolverSideMode_t  side,
+                                                    hipsolverOperation_t trans,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    double*              A,
+                                                    int                  lda,
+                                                    int                  strideA,
+                                                    double*              tau,
+                                                    int                  strideP,
+                                                    double*              C,
+                                                    int                  ldc,
+                                                    int                  strideC,
+                                                    int*                 lwork,
+                                                    int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCunmqrStridedBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                                    hipsolverSideMode_t  side,
+                                                    hipsolverOperation_t trans,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    hipsolverComplex*    A,
+                                                    int                  lda,
+                                                    int                  strideA,
+                                                    hipsolverComplex*    tau,
+                                                    int                  strideP,
+                                                    hipsolverComplex*    C,
+                                                    int                  ldc,
+                                                    int                  strideC,
+                                                    int*                 lwork,
+                                                    int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunmqrStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    hipsolverSideMode_t     side,
+                                                    hipsolverOperation_t    trans,
+                                                    int                     m,
+                                                    int                     n,
+                                                    int                     k,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    hipsolverDoubleComplex* tau,
+                                                    int                     strideP,
+                                                    hipsolverDoubleComplex* C,
+                                                    int                     ldc,
+                                                    int                     strideC,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSormqrStridedBatchedFortran(hipsolverHandle_t    handle,
+                                         hipsolverSideMode_t  side,
+                                         hipsolverOperation_t trans,
+                                         int                  m,
+                                         int                  n,
+                                         int                  k,
+                                         float*               A,
+                                         int                  lda,
+                                         int                  strideA,
+                                         float*               tau,
+                                         int                  strideP,
+                                         float*               C,
+                                         int                  ldc,
+                                         int                  strideC,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDormqrStridedBatchedFortran(hipsolverHandle_t    handle,
+                                         hipsolverSideMode_t  side,
+                                         hipsolverOperation_t trans,
+                                         int                  m,
+                                         int                  n,
+                                         int                  k,
+                                         double*              A,
+                                         int                  lda,
+                                         int                  strideA,
+                                         double*              tau,
+                                         int                  strideP,
+                                         double*              C,
+                                         int                  ldc,
+                                         int                  strideC,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCunmqrStridedBatchedFortran(hipsolverHandle_t    handle,
+                                         hipsolverSideMode_t  side,
+                                         hipsolverOperation_t trans,
+                                         int                  m,
+                                         int                  n,
+                                         int                  k,
+                                         hipsolverComplex*    A,
+                                         int                  lda,
+                                         int                  strideA,
+                                         hipsolverComplex*    tau,
+                                         int                  strideP,
+                                         hipsolverComplex*    C,
+                                         int                  ldc,
+                                         int                  strideC,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunmqrStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         hipsolverSideMode_t     side,
+                                         hipsolverOperation_t    trans,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* C,
+                                         int                     ldc,
+                                         int                     strideC,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
 // ormtr/unmtr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormtr_bufferSizeFortran(hipsolverHandle_t    handle,
                                                                      hipsolverSideMode_t  side,
@@ -552,6 +1484,225 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrdFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// gebrd_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrdBatched_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, float* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgebrdBatched_bufferSizeFortran(
+    hipsolverHandle_t handle, int m, int n, double* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgebrdBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipsolverComplex* A[],
+                                             int               lda,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgebrdBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrdBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A[],
+                                                                 int               lda,
+                                                                 float*            D,
+                                                                 int               strideD,
+                                                                 float*            E,
+                                                                 int               strideE,
+                                                                 float*            tauq,
+                                                                 int               strideQ,
+                                                                 float*            taup,
+                                                                 int               strideP,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgebrdBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A[],
+                                                                 int               lda,
+                                                                 double*           D,
+                                                                 int               strideD,
+                                                                 double*           E,
+                                                                 int               strideE,
+                                                                 double*           tauq,
+                                                                 int               strideQ,
+                                                                 double*           taup,
+                                                                 int               strideP,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgebrdBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* A[],
+                                                                 int               lda,
+                                                                 float*            D,
+                                                                 int               strideD,
+                                                                 float*            E,
+                                                                 int               strideE,
+                                                                 hipsolverComplex* tauq,
+                                                                 int               strideQ,
+                                                                 hipsolverComplex* taup,
+                                                                 int               strideP,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgebrdBatchedFortran(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  double*                 D,
+                                  int                     strideD,
+                                  double*                 E,
+                                  int                     strideE,
+                                  hipsolverDoubleComplex* tauq,
+                                  int                     strideQ,
+                                  hipsolverDoubleComplex* taup,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// gebrd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgebrdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgebrdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgebrdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgebrdStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgebrdStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               strideA,
+                                         float*            D,
+                                         int               strideD,
+                                         float*            E,
+                                         int               strideE,
+                                         float*            tauq,
+                                         int               strideQ,
+                                         float*            taup,
+                                         int               strideP,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgebrdStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               strideA,
+                                         double*           D,
+                                         int               strideD,
+                                         double*           E,
+                                         int               strideE,
+                                         double*           tauq,
+                                         int               strideQ,
+                                         double*           taup,
+                                         int               strideP,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgebrdStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               strideA,
+                                         float*            D,
+                                         int               strideD,
+                                         float*            E,
+                                         int               strideE,
+                                         hipsolverComplex* tauq,
+                                         int               strideQ,
+                                         hipsolverComplex* taup,
+                                         int               strideP,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgebrdStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         double*                 D,
+                                         int                     strideD,
+                                         double*                 E,
+                                         int                     strideE,
+                                         hipsolverDoubleComplex* tauq,
+                                         int                     strideQ,
+                                         hipsolverDoubleComplex* taup,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
 // geqrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf_bufferSizeFortran(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -605,15 +1756,327 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
-// gesvd
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_bufferSizeFortran(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
+// geqrf_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeqrfBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A[],
+                                             int               lda,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvd_bufferSizeFortran(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeqrfBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A[],
+                                             int               lda,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvd_bufferSizeFortran(
-    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeqrfBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipsolverComplex* A[],
+                                             int               lda,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A[],
+                                                                 int               lda,
+                                                                 float*            tau,
+                                                                 int               strideP,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A[],
+                                                                 int               lda,
+                                                                 double*           tau,
+                                                                 int               strideP,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* A[],
+                                                                 int               lda,
+                                                                 hipsolverComplex* tau,
+                                                                 int               strideP,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfBatchedFortran(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// geqrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeqrfStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int               strideP,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeqrfStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int               strideP,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeqrfStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int               strideP,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    int                     strideP,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeqrfStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               strideA,
+                                         float*            tau,
+                                         int               strideP,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeqrfStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               strideA,
+                                         double*           tau,
+                                         int               strideP,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeqrfStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               strideA,
+                                         hipsolverComplex* tau,
+                                         int               strideP,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
+// gels_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgelsStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgelsStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgelsStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipsolverComplex* A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   hipsolverComplex* B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int*              lwork,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgelsStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int                     strideA,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   int                     strideB,
+                                                   int*                    lwork,
+                                                   int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgelsStridedBatchedFortran(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        float*            A,
+                                        int               lda,
+                                        int               strideA,
+                                        float*            B,
+                                        int               ldb,
+                                        int               strideB,
+                                        float*            work,
+                                        int               lwork,
+                                        int*              devInfo,
+                                        int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgelsStridedBatchedFortran(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        double*           A,
+                                        int               lda,
+                                        int               strideA,
+                                        double*           B,
+                                        int               ldb,
+                                        int               strideB,
+                                        double*           work,
+                                        int               lwork,
+                                        int*              devInfo,
+                                        int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgelsStridedBatchedFortran(hipsolverHandle_t handle,
+                                        int               m,
+                                        int               n,
+                                        int               nrhs,
+                                        hipsolverComplex* A,
+                                        int               lda,
+                                        int               strideA,
+                                        hipsolverComplex* B,
+                                        int               ldb,
+                                        int               strideB,
+                                        hipsolverComplex* work,
+                                        int               lwork,
+                                        int*              devInfo,
+                                        int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgelsStridedBatchedFortran(hipsolverHandle_t       handle,
+                                        int                     m,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        int                     strideA,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int                     strideB,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    devInfo,
+                                        int                     batch_count);
+
+// gesvd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_bufferSizeFortran(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvd_bufferSizeFortran(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvd_bufferSizeFortran(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
 
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvd_bufferSizeFortran(
     hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
@@ -686,6 +2149,276 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdFortran(hipsolverHandle_t
                                                           double*                 rwork,
                                                           int*                    devInfo);
 
+// gesvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdStridedBatchedFortran(hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               strideA,
+                                         float*            S,
+                                         int               strideS,
+                                         float*            U,
+                                         int               ldu,
+                                         int               strideU,
+                                         float*            V,
+                                         int               ldv,
+                                         int               strideV,
+                                         float*            work,
+                                         int               lwork,
+                                         float*            rwork,
+                                         int               strideRwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdStridedBatchedFortran(hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               strideA,
+                                         double*           S,
+                                         int               strideS,
+                                         double*           U,
+                                         int               ldu,
+                                         int               strideU,
+                                         double*           V,
+                                         int               ldv,
+                                         int               strideV,
+                                         double*           work,
+                                         int               lwork,
+                                         double*           rwork,
+                                         int               strideRwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdStridedBatchedFortran(hipsolverHandle_t handle,
+                                         signed char       jobu,
+                                         signed char       jobv,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               strideA,
+                                         float*            S,
+                                         int               strideS,
+                                         hipsolverComplex* U,
+                                         int               ldu,
+                                         int               strideU,
+                                         hipsolverComplex* V,
+                                         int               ldv,
+                                         int               strideV,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         float*            rwork,
+                                         int               strideRwork,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         signed char             jobu,
+                                         signed char             jobv,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         double*                 S,
+                                         int                     strideS,
+                                         hipsolverDoubleComplex* U,
+                                         int                     ldu,
+                                         int                     strideU,
+                                         hipsolverDoubleComplex* V,
+                                         int                     ldv,
+                                         int                     strideV,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         double*                 rwork,
+                                         int                     strideRwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
+// gesvdj_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdjBatched_bufferSizeFortran(hipsolverHandle_t     handle,
+                                              hipsolverEigMode_t    jobz,
+                                              int                   m,
+                                              int                   n,
+                                              float*                A,
+                                              int                   lda,
+                                              float*                S,
+                                              float*                U,
+                                              int                   ldu,
+                                              float*                V,
+                                              int                   ldv,
+                                              int*                  lwork,
+                                              hipsolverGesvdjInfo_t params,
+                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdjBatched_bufferSizeFortran(hipsolverHandle_t     handle,
+                                              hipsolverEigMode_t    jobz,
+                                              int                   m,
+                                              int                   n,
+                                              double*               A,
+                                              int                   lda,
+                                              double*               S,
+                                              double*               U,
+                                              int                   ldu,
+                                              double*               V,
+                                              int                   ldv,
+                                              int*                  lwork,
+                                              hipsolverGesvdjInfo_t params,
+                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdjBatched_bufferSizeFortran(hipsolverHandle_t     handle,
+                                              hipsolverEigMode_t    jobz,
+                                              int                   m,
+                                              int                   n,
+                                              hipsolverComplex*     A,
+                                              int                   lda,
+                                              float*                S,
+                                              hipsolverComplex*     U,
+                                              int                   ldu,
+                                              hipsolverComplex*     V,
+                                              int                   ldv,
+                                              int*                  lwork,
+                                              hipsolverGesvdjInfo_t params,
+                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdjBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                              hipsolverEigMode_t      jobz,
+                                              int                     m,
+                                              int                     n,
+                                              hipsolverDoubleComplex* A,
+                                              int                     lda,
+                                              double*                 S,
+                                              hipsolverDoubleComplex* U,
+                                              int                     ldu,
+                                              hipsolverDoubleComplex* V,
+                                              int                     ldv,
+                                              int*                    lwork,
+                                              hipsolverGesvdjInfo_t   params,
+                                              int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdjBatchedFortran(hipsolverHandle_t     handle,
+                                   hipsolverEigMode_t    jobz,
+                                   int                   m,
+                                   int                   n,
+                                   float*                A,
+                                   int                   lda,
+                                   float*                S,
+                                   float*                U,
+                                   int                   ldu,
+                                   float*                V,
+                                   int                   ldv,
+                                   float*                work,
+                                   int                   lwork,
+                                   int*                  devInfo,
+                                   hipsolverGesvdjInfo_t params,
+                                   int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdjBatchedFortran(hipsolverHandle_t     handle,
+                                   hipsolverEigMode_t    jobz,
+                                   int                   m,
+                                   int                   n,
+                                   double*               A,
+                                   int                   lda,
+                                   double*               S,
+                                   double*               U,
+                                   int                   ldu,
+                                   double*               V,
+                                   int                   ldv,
+                                   double*               work,
+                                   int                   lwork,
+                                   int*                  devInfo,
+                                   hipsolverGesvdjInfo_t params,
+                                   int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdjBatchedFortran(hipsolverHandle_t     handle,
+                                   hipsolverEigMode_t    jobz,
+                                   int                   m,
+                                   int                   n,
+                                   hipsolverComplex*     A,
+                                   int                   lda,
+                                   float*                S,
+                                   hipsolverComplex*     U,
+                                   int                   ldu,
+                                   hipsolverComplex*     V,
+                                   int                   ldv,
+                                   hipsolverComplex*     work,
+                                   int                   lwork,
+                                   int*                  devInfo,
+                                   hipsolverGesvdjInfo_t params,
+                                   int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdjBatchedFortran(hipsolverHandle_t       handle,
+                                   hipsolverEigMode_t      jobz,
+                                   int                     m,
+                                   int                     n,
+                                   hipsolverDoubleComplex* A,
+                                   int                     lda,
+                                   double*                 S,
+                                   hipsolverDoubleComplex* U,
+                                   int                     ldu,
+                                   hipsolverDoubleComplex* V,
+                                   int                     ldv,
+                                   hipsolverDoubleComplex* work,
+                                   int                     lwork,
+                                   int*                    devInfo,
+                                   hipsolverGesvdjInfo_t   params,
+                                   int                     batch_count);
+
 // getrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_bufferSizeFortran(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -739,6 +2472,415 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfFortran(hipsolverHandle_t
                                                           int*                    devIpiv,
                                                           int*                    devInfo);
 
+// getrf_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A[],
+                                             int               lda,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A[],
+                                             int               lda,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipsolverComplex* A[],
+                                             int               lda,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A[],
+                                                                 int               lda,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A[],
+                                                                 int               lda,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatchedFortran(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* A[],
+                                                                 int               lda,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfBatchedFortran(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devIpiv,
+                                  int                     strideP,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// getrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               strideA,
+                                                    int*              lwork,
+                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               strideA,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              devIpiv,
+                                         int               strideP,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               strideA,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              devIpiv,
+                                         int               strideP,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfStridedBatchedFortran(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               strideA,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              devIpiv,
+                                         int               strideP,
+                                         int*              devInfo,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devIpiv,
+                                         int                     strideP,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
+// getri_outofplace_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriOutOfPlaceBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                       int               n,
+                                                       float*            A[],
+                                                       int               lda,
+                                                       int*              devIpiv,
+                                                       int               strideP,
+                                                       float*            C[],
+                                                       int               ldc,
+                                                       int*              lwork,
+                                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriOutOfPlaceBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                       int               n,
+                                                       double*           A[],
+                                                       int               lda,
+                                                       int*              devIpiv,
+                                                       int               strideP,
+                                                       double*           C[],
+                                                       int               ldc,
+                                                       int*              lwork,
+                                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriOutOfPlaceBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                       int               n,
+                                                       hipsolverComplex* A[],
+                                                       int               lda,
+                                                       int*              devIpiv,
+                                                       int               strideP,
+                                                       hipsolverComplex* C[],
+                                                       int               ldc,
+                                                       int*              lwork,
+                                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                       int                     n,
+                                                       hipsolverDoubleComplex* A[],
+                                                       int                     lda,
+                                                       int*                    devIpiv,
+                                                       int                     strideP,
+                                                       hipsolverDoubleComplex* C[],
+                                                       int                     ldc,
+                                                       int*                    lwork,
+                                                       int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriOutOfPlaceBatchedFortran(hipsolverHandle_t handle,
+                                            int               n,
+                                            float*            A[],
+                                            int               lda,
+                                            int*              devIpiv,
+                                            int               strideP,
+                                            float*            C[],
+                                            int               ldc,
+                                            float*            work,
+                                            int               lwork,
+                                            int*              devInfo,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriOutOfPlaceBatchedFortran(hipsolverHandle_t handle,
+                                            int               n,
+                                            double*           A[],
+                                            int               lda,
+                                            int*              devIpiv,
+                                            int               strideP,
+                                            double*           C[],
+                                            int               ldc,
+                                            double*           work,
+                                            int               lwork,
+                                            int*              devInfo,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriOutOfPlaceBatchedFortran(hipsolverHandle_t handle,
+                                            int               n,
+                                            hipsolverComplex* A[],
+                                            int               lda,
+                                            int*              devIpiv,
+                                            int               strideP,
+                                            hipsolverComplex* C[],
+                                            int               ldc,
+                                            hipsolverComplex* work,
+                                            int               lwork,
+                                            int*              devInfo,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceBatchedFortran(hipsolverHandle_t       handle,
+                                            int                     n,
+                                            hipsolverDoubleComplex* A[],
+                                            int                     lda,
+                                            int*                    devIpiv,
+                                            int                     strideP,
+                                            hipsolverDoubleComplex* C[],
+                                            int                     ldc,
+                                            hipsolverDoubleComplex* work,
+                                            int                     lwork,
+                                            int*                    devInfo,
+                                            int                     batch_count);
+
+// getri_outofplace_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriOutOfPlaceStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              float*            A,
+                                                              int               lda,
+                                                              int               strideA,
+                                                              int*              devIpiv,
+                                                              int               strideP,
+                                                              float*            C,
+                                                              int               ldc,
+                                                              int               strideC,
+                                                              int*              lwork,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriOutOfPlaceStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int               strideA,
+                                                              int*              devIpiv,
+                                                              int               strideP,
+                                                              double*           C,
+                                                              int               ldc,
+                                                              int               strideC,
+                                                              int*              lwork,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriOutOfPlaceStridedBatched_bufferSizeFortran(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              hipsolverComplex* A,
+                                                              int               lda,
+                                                              int               strideA,
+                                                              int*              devIpiv,
+                                                              int               strideP,
+                                                              hipsolverComplex* C,
+                                                              int               ldc,
+                                                              int               strideC,
+                                                              int*              lwork,
+                                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int                     strideA,
+                                                              int*                    devIpiv,
+                                                              int                     strideP,
+                                                              hipsolverDoubleComplex* C,
+                                                              int                     ldc,
+                                                              int                     strideC,
+                                                              int*                    lwork,
+                                                              int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriOutOfPlaceStridedBatchedFortran(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   float*            A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   int*              devIpiv,
+                                                   int               strideP,
+                                                   float*            C,
+                                                   int               ldc,
+                                                   int               strideC,
+                                                   float*            work,
+                                                   int               lwork,
+                                                   int*              devInfo,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriOutOfPlaceStridedBatchedFortran(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   int*              devIpiv,
+                                                   int               strideP,
+                                                   double*           C,
+                                                   int               ldc,
+                                                   int               strideC,
+                                                   double*           work,
+                                                   int               lwork,
+                                                   int*              devInfo,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriOutOfPlaceStridedBatchedFortran(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   hipsolverComplex* A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   int*              devIpiv,
+                                                   int               strideP,
+                                                   hipsolverComplex* C,
+                                                   int               ldc,
+                                                   int               strideC,
+                                                   hipsolverComplex* work,
+                                                   int               lwork,
+                                                   int*              devInfo,
+                                                   int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceStridedBatchedFortran(hipsolverHandle_t       handle,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int                     strideA,
+                                                   int*                    devIpiv,
+                                                   int                     strideP,
+                                                   hipsolverDoubleComplex* C,
+                                                   int                     ldc,
+                                                   int                     strideC,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo,
+                                                   int                     batch_count);
+
 // getrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrs_bufferSizeFortran(hipsolverHandle_t    handle,
                                                                      hipsolverOperation_t trans,
@@ -836,6 +2978,261 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// getrs_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A[],
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             float*               B[],
+                                             int                  ldb,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A[],
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             double*              B[],
+                                             int                  ldb,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipsolverComplex*    A[],
+                                             int                  lda,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             hipsolverComplex*    B[],
+                                             int                  ldb,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverOperation_t    trans,
+                                             int                     n,
+                                             int                     nrhs,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             int*                    devIpiv,
+                                             int                     strideP,
+                                             hipsolverDoubleComplex* B[],
+                                             int                     ldb,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 float*               A[],
+                                                                 int                  lda,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 float*               B[],
+                                                                 int                  ldb,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 double*              A[],
+                                                                 int                  lda,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 double*              B[],
+                                                                 int                  ldb,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipsolverComplex*    A[],
+                                                                 int                  lda,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 hipsolverComplex*    B[],
+                                                                 int                  ldb,
+                                                                 hipsolverComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverOperation_t    trans,
+                                  int                     n,
+                                  int                     nrhs,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  int*                    devIpiv,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* B[],
+                                  int                     ldb,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// getrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsStridedBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    float*               A,
+                                                    int                  lda,
+                                                    int                  strideA,
+                                                    int*                 devIpiv,
+                                                    int                  strideP,
+                                                    float*               B,
+                                                    int                  ldb,
+                                                    int                  strideB,
+                                                    int*                 lwork,
+                                                    int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsStridedBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    double*              A,
+                                                    int                  lda,
+                                                    int                  strideA,
+                                                    int*                 devIpiv,
+                                                    int                  strideP,
+                                                    double*              B,
+                                                    int                  ldb,
+                                                    int                  strideB,
+                                                    int*                 lwork,
+                                                    int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsStridedBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    hipsolverComplex*    A,
+                                                    int                  lda,
+                                                    int                  strideA,
+                                                    int*                 devIpiv,
+                                                    int                  strideP,
+                                                    hipsolverComplex*    B,
+                                                    int                  ldb,
+                                                    int                  strideB,
+                                                    int*                 lwork,
+                                                    int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    hipsolverOperation_t    trans,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    int*                    devIpiv,
+                                                    int                     strideP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int                     strideB,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsStridedBatchedFortran(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A,
+                                         int                  lda,
+                                         int                  strideA,
+                                         int*                 devIpiv,
+                                         int                  strideP,
+                                         float*               B,
+                                         int                  ldb,
+                                         int                  strideB,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsStridedBatchedFortran(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A,
+                                         int                  lda,
+                                         int                  strideA,
+                                         int*                 devIpiv,
+                                         int                  strideP,
+                                         double*              B,
+                                         int                  ldb,
+                                         int                  strideB,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsStridedBatchedFortran(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipsolverComplex*    A,
+                                         int                  lda,
+                                         int                  strideA,
+                                         int*                 devIpiv,
+                                         int                  strideP,
+                                         hipsolverComplex*    B,
+                                         int                  ldb,
+                                         int                  strideB,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 devInfo,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         int*                    devIpiv,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     strideB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
 // potrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSizeFortran(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -970,6 +3367,108 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatchedFortran(hipsolverHandle
                                                                  int*                    devInfo,
                                                                  int batch_count);
 
+// potrs_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrsBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A[],
+                                             int                 lda,
+                                             float*              B[],
+                                             int                 ldb,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrsBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A[],
+                                             int                 lda,
+                                             double*             B[],
+                                             int                 ldb,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrsBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipsolverComplex*   A[],
+                                             int                 lda,
+                                             hipsolverComplex*   B[],
+                                             int                 ldb,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrsBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             int                     nrhs,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             hipsolverDoubleComplex* B[],
+                                             int                     ldb,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 float*              A[],
+                                                                 int                 lda,
+                                                                 float*              B[],
+                                                                 int                 ldb,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 double*             A[],
+                                                                 int                 lda,
+                                                                 double*             B[],
+                                                                 int                 ldb,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipsolverComplex*   A[],
+                                                                 int                 lda,
+                                                                 hipsolverComplex*   B[],
+                                                                 int                 ldb,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrsBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  int                     nrhs,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  hipsolverDoubleComplex* B[],
+                                  int                     ldb,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
 // syevd/heevd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_bufferSizeFortran(hipsolverHandle_t   handle,
                                                                      hipsolverEigMode_t  jobz,
@@ -1051,6 +3550,323 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// syevd_batched/heevd_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A[],
+                                             int                 lda,
+                                             float*              D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A[],
+                                             int                 lda,
+                                             double*             D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A[],
+                                             int                 lda,
+                                             float*              D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverEigMode_t      jobz,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             double*                 D,
+                                             int                     strideD,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A[],
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A[],
+                                                                 int                 lda,
+                                                                 double*             D,
+                                                                 int                 strideD,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipsolverComplex*   A[],
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverEigMode_t      jobz,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  double*                 D,
+                                  int                     strideD,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// syevd_strided_batched/heevd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    float*              D,
+                                                    int                 strideD,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    double*             D,
+                                                    int                 strideD,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    float*              D,
+                                                    int                 strideD,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    hipsolverEigMode_t      jobz,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    double*                 D,
+                                                    int                     strideD,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverEigMode_t  jobz,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         float*              D,
+                                         int                 strideD,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverEigMode_t  jobz,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         double*             D,
+                                         int                 strideD,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverEigMode_t  jobz,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         float*              D,
+                                         int                 strideD,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         hipsolverEigMode_t      jobz,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         double*                 D,
+                                         int                     strideD,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
+// syevj_batched/heevj_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevjBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverEigMode_t   jobz,
+                                             hipsolverFillMode_t  uplo,
+                                             int                  n,
+                                             float*               A,
+                                             int                  lda,
+                                             float*               W,
+                                             int*                 lwork,
+                                             hipsolverSyevjInfo_t params,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevjBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverEigMode_t   jobz,
+                                             hipsolverFillMode_t  uplo,
+                                             int                  n,
+                                             double*              A,
+                                             int                  lda,
+                                             double*              W,
+                                             int*                 lwork,
+                                             hipsolverSyevjInfo_t params,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevjBatched_bufferSizeFortran(hipsolverHandle_t    handle,
+                                             hipsolverEigMode_t   jobz,
+                                             hipsolverFillMode_t  uplo,
+                                             int                  n,
+                                             hipsolverComplex*    A,
+                                             int                  lda,
+                                             float*               W,
+                                             int*                 lwork,
+                                             hipsolverSyevjInfo_t params,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverEigMode_t      jobz,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             double*                 W,
+                                             int*                    lwork,
+                                             hipsolverSyevjInfo_t    params,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 float*               W,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 hipsolverSyevjInfo_t params,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 double*              W,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 hipsolverSyevjInfo_t params,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjBatchedFortran(hipsolverHandle_t    handle,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 hipsolverComplex*    A,
+                                                                 int                  lda,
+                                                                 float*               W,
+                                                                 hipsolverComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 hipsolverSyevjInfo_t params,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverEigMode_t      jobz,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  double*                 W,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  hipsolverSyevjInfo_t    params,
+                                  int                     batch_count);
+
 // sygvd/hegvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSizeFortran(hipsolverHandle_t   handle,
                                                                      hipsolverEigType_t  itype,
@@ -1156,6 +3972,296 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdFortran(hipsolverHandle_t
                                                           int                     lwork,
                                                           int*                    devInfo);
 
+// sygvd_strided_batched/hegvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverEigType_t  itype,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int                 strideB,
+                                                    float*              D,
+                                                    int                 strideD,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverEigType_t  itype,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int                 strideB,
+                                                    double*             D,
+                                                    int                 strideD,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverEigType_t  itype,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int                 strideB,
+                                                    float*              D,
+                                                    int                 strideD,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    hipsolverEigType_t      itype,
+                                                    hipsolverEigMode_t      jobz,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int                     strideB,
+                                                    double*                 D,
+                                                    int                     strideD,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverEigType_t  itype,
+                                         hipsolverEigMode_t  jobz,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 strideB,
+                                         float*              D,
+                                         int                 strideD,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverEigType_t  itype,
+                                         hipsolverEigMode_t  jobz,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 strideB,
+                                         double*             D,
+                                         int                 strideD,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverEigType_t  itype,
+                                         hipsolverEigMode_t  jobz,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 strideB,
+                                         float*              D,
+                                         int                 strideD,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         hipsolverEigType_t      itype,
+                                         hipsolverEigMode_t      jobz,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     strideB,
+                                         double*                 D,
+                                         int                     strideD,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
+
+// sygvd_factored_strided_batched/hegvd_factored_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdFactoredStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            int                 strideA,
+                                                            float*              B,
+                                                            int                 ldb,
+                                                            int                 strideB,
+                                                            float*              D,
+                                                            int                 strideD,
+                                                            int*                lwork,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdFactoredStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            int                 strideA,
+                                                            double*             B,
+                                                            int                 ldb,
+                                                            int                 strideB,
+                                                            double*             D,
+                                                            int                 strideD,
+                                                            int*                lwork,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdFactoredStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            int                 strideA,
+                                                            hipsolverComplex*   B,
+                                                            int                 ldb,
+                                                            int                 strideB,
+                                                            float*              D,
+                                                            int                 strideD,
+                                                            int*                lwork,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdFactoredStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                            hipsolverEigType_t      itype,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            int                     strideA,
+                                                            hipsolverDoubleComplex* B,
+                                                            int                     ldb,
+                                                            int                     strideB,
+                                                            double*                 D,
+                                                            int                     strideD,
+                                                            int*                    lwork,
+                                                            int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdFactoredStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 float*              B,
+                                                 int                 ldb,
+                                                 int                 strideB,
+                                                 float*              D,
+                                                 int                 strideD,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdFactoredStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 double*             B,
+                                                 int                 ldb,
+                                                 int                 strideB,
+                                                 double*             D,
+                                                 int                 strideD,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdFactoredStridedBatchedFortran(hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 hipsolverComplex*   B,
+                                                 int                 ldb,
+                                                 int                 strideB,
+                                                 float*              D,
+                                                 int                 strideD,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 int*                devInfo,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdFactoredStridedBatchedFortran(hipsolverHandle_t       handle,
+                                                 hipsolverEigType_t      itype,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     strideA,
+                                                 hipsolverDoubleComplex* B,
+                                                 int                     ldb,
+                                                 int                     strideB,
+                                                 double*                 D,
+                                                 int                     strideD,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    devInfo,
+                                                 int                     batch_count);
+
 // sytrd/hetrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrd_bufferSizeFortran(hipsolverHandle_t   handle,
                                                                      hipsolverFillMode_t uplo,
@@ -1244,4 +4350,267 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrdFortran(hipsolverHandle_t
                                                           hipsolverDoubleComplex* work,
                                                           int                     lwork,
                                                           int*                    devInfo);
+
+// sytrd_batched/hetrd_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrdBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A[],
+                                             int                 lda,
+                                             float*              D,
+                                             int                 strideD,
+                                             float*              E,
+                                             int                 strideE,
+                                             float*              tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrdBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A[],
+                                             int                 lda,
+                                             double*             D,
+                                             int                 strideD,
+                                             double*             E,
+                                             int                 strideE,
+                                             double*             tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChetrdBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A[],
+                                             int                 lda,
+                                             float*              D,
+                                             int                 strideD,
+                                             float*              E,
+                                             int                 strideE,
+                                             hipsolverComplex*   tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhetrdBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A[],
+                                             int                     lda,
+                                             double*                 D,
+                                             int                     strideD,
+                                             double*                 E,
+                                             int                     strideE,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrdBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A[],
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 float*              E,
+                                                                 int                 strideE,
+                                                                 float*              tau,
+                                                                 int                 strideP,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrdBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A[],
+                                                                 int                 lda,
+                                                                 double*             D,
+                                                                 int                 strideD,
+                                                                 double*             E,
+                                                                 int                 strideE,
+                                                                 double*             tau,
+                                                                 int                 strideP,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChetrdBatchedFortran(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipsolverComplex*   A[],
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 float*              E,
+                                                                 int                 strideE,
+                                                                 hipsolverComplex*   tau,
+                                                                 int                 strideP,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhetrdBatchedFortran(hipsolverHandle_t       handle,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A[],
+                                  int                     lda,
+                                  double*                 D,
+                                  int                     strideD,
+                                  double*                 E,
+                                  int                     strideE,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// sytrd_strided_batched/hetrd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    float*              D,
+                                                    int                 strideD,
+                                                    float*              E,
+                                                    int                 strideE,
+                                                    float*              tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    double*             D,
+                                                    int                 strideD,
+                                                    double*             E,
+                                                    int                 strideE,
+                                                    double*             tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChetrdStridedBatched_bufferSizeFortran(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 strideA,
+                                                    float*              D,
+                                                    int                 strideD,
+                                                    float*              E,
+                                                    int                 strideE,
+                                                    hipsolverComplex*   tau,
+                                                    int                 strideP,
+                                                    int*                lwork,
+                                                    int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhetrdStridedBatched_bufferSizeFortran(hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     strideA,
+                                                    double*                 D,
+                                                    int                     strideD,
+                                                    double*                 E,
+                                                    int                     strideE,
+                                                    hipsolverDoubleComplex* tau,
+                                                    int                     strideP,
+                                                    int*                    lwork,
+                                                    int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         float*              D,
+                                         int                 strideD,
+                                         float*              E,
+                                         int                 strideE,
+                                         float*              tau,
+                                         int                 strideP,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         double*             D,
+                                         int                 strideD,
+                                         double*             E,
+                                         int                 strideE,
+                                         double*             tau,
+                                         int                 strideP,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChetrdStridedBatchedFortran(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 strideA,
+                                         float*              D,
+                                         int                 strideD,
+                                         float*              E,
+                                         int                 strideE,
+                                         hipsolverComplex*   tau,
+                                         int                 strideP,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhetrdStridedBatchedFortran(hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     strideA,
+                                         double*                 D,
+                                         int                     strideD,
+                                         double*                 E,
+                                         int                     strideE,
+                                         hipsolverDoubleComplex* tau,
+                                         int                     strideP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    devInfo,
+                                         int                     batch_count);
 }
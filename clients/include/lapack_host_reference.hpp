@@ -101,6 +101,19 @@ void cblas_ormtr_unmtr(hipsolverSideMode_t  side,
 template <typename T, typename S>
 void cblas_gebrd(int m, int n, T* A, int lda, S* D, S* E, T* tauq, T* taup, T* work, int size_w);
 
+template <typename T>
+void cblas_gels(hipsolverOperation_t trans,
+                int                  m,
+                int                  n,
+                int                  nrhs,
+                T*                   A,
+                int                  lda,
+                T*                   B,
+                int                  ldb,
+                T*                   work,
+                int                  lwork,
+                int*                 info);
+
 template <typename T>
 void cblas_geqrf(int m, int n, T* A, int lda, T* ipiv, T* work, int sizeW);
 
@@ -124,6 +137,9 @@ void cblas_gesvd(char leftv,
 template <typename T>
 void cblas_getrf(int m, int n, T* A, int lda, int* ipiv, int* info);
 
+template <typename T>
+void cblas_getri(int n, T* A, int lda, int* ipiv, T* work, int lwork, int* info);
+
 template <typename T>
 void cblas_getrs(
     hipsolverOperation_t trans, int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb);
@@ -131,6 +147,12 @@ void cblas_getrs(
 template <typename T>
 void cblas_potrf(hipsolverFillMode_t uplo, int n, T* A, int lda, int* info);
 
+template <typename T>
+void cblas_potri(hipsolverFillMode_t uplo, int n, T* A, int lda, int* info);
+
+template <typename T>
+void cblas_potrs(hipsolverFillMode_t uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
 template <typename T, typename S>
 void cblas_syevd_heevd(hipsolverEigMode_t  evect,
                        hipsolverFillMode_t uplo,
@@ -164,6 +186,63 @@ void cblas_sygvd_hegvd(hipsolverEigType_t  itype,
                        int                 liwork,
                        int*                info);
 
+template <typename T, typename S>
+void cblas_syevx_heevx(hipsolverEigMode_t  evect,
+                       hipsolverEigRange_t erange,
+                       hipsolverFillMode_t uplo,
+                       int                 n,
+                       T*                  A,
+                       int                 lda,
+                       S                   vl,
+                       S                   vu,
+                       int                 il,
+                       int                 iu,
+                       S                   abstol,
+                       int*                nev,
+                       S*                  W,
+                       T*                  Z,
+                       int                 ldz,
+                       T*                  work,
+                       int                 lwork,
+                       S*                  rwork,
+                       int*                iwork,
+                       int*                ifail,
+                       int*                info);
+
+template <typename T, typename S>
+void cblas_sygvx_hegvx(hipsolverEigType_t  itype,
+                       hipsolverEigMode_t  evect,
+                       hipsolverEigRange_t erange,
+                       hipsolverFillMode_t uplo,
+                       int                 n,
+                       T*                  A,
+                       int                 lda,
+                       T*                  B,
+                       int                 ldb,
+                       S                   vl,
+                       S                   vu,
+                       int                 il,
+                       int                 iu,
+                       S                   abstol,
+                       int*                nev,
+                       S*                  W,
+                       T*                  Z,
+                       int                 ldz,
+                       T*                  work,
+                       int                 lwork,
+                       S*                  rwork,
+                       int*                iwork,
+                       int*                ifail,
+                       int*                info);
+
 template <typename T, typename S>
 void cblas_sytrd_hetrd(
     hipsolverFillMode_t uplo, int n, T* A, int lda, S* D, S* E, T* tau, T* work, int size_w);
+
+template <typename T>
+void cblas_sytrf(
+    hipsolverFillMode_t uplo, int n, T* A, int lda, int* ipiv, T* work, int lwork, int* info);
+
+template <typename T>
+void cblas_sytrs(
+    hipsolverFillMode_t uplo, int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb);
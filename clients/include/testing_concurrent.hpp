@@ -0,0 +1,557 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+#include "testing_getrf.hpp"
+#include "testing_potrf.hpp"
+#include "testing_syevd_heevd.hpp"
+
+/*
+ * ===========================================================================
+ *    Concurrent benchmarks. max(streams, handles) independent problems are
+ *    submitted round-robin, problem p running on handle p % handles and
+ *    stream p % streams. Each timed round submits every problem once and
+ *    waits for the whole device, so the reported throughput includes the
+ *    overlap between streams. In e2e mode, every problem also copies its
+ *    input to the device and its results back on its own stream, so the
+ *    copies of one problem overlap with the computations of the others.
+ * ===========================================================================
+ */
+
+class concurrent_context
+{
+    std::vector<hipsolverHandle_t> m_handles;
+    std::vector<hipStream_t>       m_streams;
+
+public:
+    concurrent_context(int handles, int streams)
+        : m_handles(handles)
+        , m_streams(streams)
+    {
+        for(auto& h : m_handles)
+            hipsolverCreate(&h);
+        for(auto& s : m_streams)
+            hipStreamCreateWithFlags(&s, hipStreamNonBlocking);
+    }
+    ~concurrent_context()
+    {
+        for(auto& h : m_handles)
+            hipsolverDestroy(h);
+        for(auto& s : m_streams)
+            hipStreamDestroy(s);
+    }
+
+    concurrent_context(const concurrent_context&) = delete;
+    concurrent_context& operator=(const concurrent_context&) = delete;
+
+    int problems() const
+    {
+        return int(std::max(m_handles.size(), m_streams.size()));
+    }
+
+    hipsolverHandle_t handle(int p) const
+    {
+        return m_handles[p % m_handles.size()];
+    }
+
+    hipStream_t stream(int p) const
+    {
+        return m_streams[p % m_streams.size()];
+    }
+
+    // returns the handle of problem p, bound to the stream of problem p
+    hipsolverHandle_t bind(int p) const
+    {
+        hipsolverHandle_t h = handle(p);
+        CHECK_ROCBLAS_ERROR(hipsolverSetStream(h, stream(p)));
+        return h;
+    }
+};
+
+template <typename Init, typename Solve>
+void concurrent_getPerfData(const concurrent_context& ctx,
+                            Init                      init,
+                            Solve                     solve,
+                            double*                   gpu_time_used,
+                            const int                 hot_calls)
+{
+    int problems = ctx.problems();
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        init();
+        for(int p = 0; p < problems; p++)
+            CHECK_ROCBLAS_ERROR(solve(ctx.bind(p), p));
+    }
+
+    // gpu-lapack performance
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        init();
+
+        start = get_time_us();
+        for(int p = 0; p < problems; p++)
+            solve(ctx.bind(p), p);
+        double elapsed = get_time_us() - start;
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+// e2e mode: copy_in(p, stream) and copy_out(p, stream) enqueue the host-device copies of
+// problem p, which are timed together with the computations
+template <typename CopyIn, typename Solve, typename CopyOut>
+void concurrent_getPerfData(const concurrent_context& ctx,
+                            CopyIn                    copy_in,
+                            Solve                     solve,
+                            CopyOut                   copy_out,
+                            double*                   gpu_time_used,
+                            const int                 hot_calls)
+{
+    int problems = ctx.problems();
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        for(int p = 0; p < problems; p++)
+        {
+            copy_in(p, ctx.stream(p));
+            CHECK_ROCBLAS_ERROR(solve(ctx.bind(p), p));
+            copy_out(p, ctx.stream(p));
+        }
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+    }
+
+    // gpu-lapack performance
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        start = get_time_us();
+        for(int p = 0; p < problems; p++)
+        {
+            copy_in(p, ctx.stream(p));
+            solve(ctx.bind(p), p);
+            copy_out(p, ctx.stream(p));
+        }
+        double elapsed = get_time_us() - start;
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+inline void concurrent_output(Arguments& argus, const int problems, const double gpu_time_used)
+{
+    double solves = (gpu_time_used > 0) ? problems * 1e6 / gpu_time_used : 0;
+
+    if(!argus.perf)
+    {
+        std::cerr << "\n============================================\n";
+        std::cerr << "Concurrency:\n";
+        std::cerr << "============================================\n";
+        rocsolver_bench_output("streams", "handles", "problems");
+        rocsolver_bench_output(argus.streams, argus.handles, problems);
+        std::cerr << "\n============================================\n";
+        std::cerr << "Results:\n";
+        std::cerr << "============================================\n";
+        rocsolver_bench_output("gpu_time", "solves_per_s");
+        rocsolver_bench_output(gpu_time_used, solves);
+        std::cerr << std::endl;
+    }
+    else
+        rocsolver_bench_output(gpu_time_used, solves);
+}
+
+template <typename T>
+void testing_concurrent_potrf(Arguments& argus)
+{
+    // get arguments
+    char uploC = argus.get<char>("uplo");
+    int  n     = argus.get<int>("n");
+    int  lda   = argus.get<int>("lda", n);
+
+    // algorithm hints
+    int alg            = argus.get<int>("alg", 0);
+    int unblocked_size = argus.get<int>("unblocked_size", 0);
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || argus.streams < 1 || argus.handles < 1);
+    if(invalid_size)
+    {
+        ROCSOLVER_BENCH_INFORM(1);
+        return;
+    }
+
+    concurrent_context ctx(argus.handles, argus.streams);
+    int                problems = ctx.problems();
+
+    // every handle gets the same hints
+    for(int p = 0; p < problems; p++)
+    {
+        if(hipsolver_set_adv_options(ctx.handle(p), HIPSOLVERDN_POTRF, alg, 1, unblocked_size)
+           != HIPSOLVER_STATUS_SUCCESS)
+        {
+            ROCSOLVER_BENCH_INFORM(2);
+            return;
+        }
+    }
+
+    // determine sizes
+    size_t size_A        = size_t(lda) * n;
+    int    stA           = size_A;
+    double gpu_time_used = 0;
+
+    host_memory mem = argus.pinned ? host_memory::pinned : host_memory::pageable;
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, stA, problems, mem);
+    host_strided_batch_vector<T>     hATmp(size_A, 1, stA, problems, mem);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, problems, mem);
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, problems);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, problems);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_potrf_bufferSize(false, ctx.handle(0), uplo, n, dA.data(), lda, &size_W, 1);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, problems);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // collect performance data
+    potrf_initData<true, false, T>(
+        ctx.handle(0), uplo, n, dA, lda, stA, dInfo, problems, hA, hATmp, hInfo);
+    auto solve = [&](hipsolverHandle_t handle, int p) {
+        return hipsolver_potrf(
+            false, handle, uplo, n, dA[p], lda, stA, dWork[p], size_W, dInfo[p], 1);
+    };
+    if(argus.e2e)
+        concurrent_getPerfData(
+            ctx,
+            [&](int p, hipStream_t stream) {
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    dA[p], hA[p], sizeof(T) * size_A, hipMemcpyHostToDevice, stream));
+            },
+            solve,
+            [&](int p, hipStream_t stream) {
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hATmp[p], dA[p], sizeof(T) * size_A, hipMemcpyDeviceToHost, stream));
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hInfo[p], dInfo[p], sizeof(int), hipMemcpyDeviceToHost, stream));
+            },
+            &gpu_time_used,
+            hot_calls);
+    else
+        concurrent_getPerfData(
+            ctx,
+            [&] {
+                potrf_initData<false, true, T>(
+                    ctx.handle(0), uplo, n, dA, lda, stA, dInfo, problems, hA, hATmp, hInfo);
+            },
+            solve,
+            &gpu_time_used,
+            hot_calls);
+
+    // output results for rocsolver-bench
+    if(!argus.perf)
+    {
+        std::cerr << "\n============================================\n";
+        std::cerr << "Arguments:\n";
+        std::cerr << "============================================\n";
+        rocsolver_bench_output("uplo", "n", "lda");
+        rocsolver_bench_output(uploC, n, lda);
+    }
+    concurrent_output(argus, problems, gpu_time_used);
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+template <typename T>
+void testing_concurrent_getrf(Arguments& argus)
+{
+    // get arguments
+    int m   = argus.get<int>("m");
+    int n   = argus.get<int>("n", m);
+    int lda = argus.get<int>("lda", m);
+
+    // algorithm hints
+    int alg            = argus.get<int>("alg", 0);
+    int pivot          = argus.get<int>("pivot", 1);
+    int unblocked_size = argus.get<int>("unblocked_size", 0);
+
+    int hot_calls = argus.iters;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || argus.streams < 1 || argus.handles < 1);
+    if(invalid_size)
+    {
+        ROCSOLVER_BENCH_INFORM(1);
+        return;
+    }
+
+    concurrent_context ctx(argus.handles, argus.streams);
+    int                problems = ctx.problems();
+
+    // every handle gets the same hints
+    for(int p = 0; p < problems; p++)
+    {
+        if(hipsolver_set_adv_options(ctx.handle(p), HIPSOLVERDN_GETRF, alg, pivot, unblocked_size)
+           != HIPSOLVER_STATUS_SUCCESS)
+        {
+            ROCSOLVER_BENCH_INFORM(2);
+            return;
+        }
+    }
+
+    // determine sizes
+    size_t size_A        = size_t(lda) * n;
+    size_t size_P        = size_t(std::min(m, n));
+    int    stA           = size_A;
+    int    stP           = size_P;
+    double gpu_time_used = 0;
+
+    host_memory mem      = argus.pinned ? host_memory::pinned : host_memory::pageable;
+    size_t      size_Res = argus.e2e ? size_A : 0;
+    int         stRes    = argus.e2e ? stA : 0;
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, stA, problems, mem);
+    host_strided_batch_vector<T>     hARes(size_Res, 1, stRes, problems, mem);
+    host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, problems, mem);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, problems, mem);
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, problems);
+    device_strided_batch_vector<int> dIpiv(size_P, 1, stP, problems);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, problems);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_getrf_bufferSize(false, false, ctx.handle(0), m, n, dA.data(), lda, stA, &size_W, 1);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, problems);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // collect performance data
+    getrf_initData<true, false, T>(
+        ctx.handle(0), m, n, dA, lda, stA, dIpiv, stP, dInfo, problems, hA, hIpiv, hInfo);
+    auto solve = [&](hipsolverHandle_t handle, int p) {
+        return hipsolver_getrf(false,
+                               false,
+                               false,
+                               handle,
+                               m,
+                               n,
+                               dA[p],
+                               lda,
+                               stA,
+                               dWork[p],
+                               size_W,
+                               dIpiv[p],
+                               stP,
+                               dInfo[p],
+                               1);
+    };
+    if(argus.e2e)
+        concurrent_getPerfData(
+            ctx,
+            [&](int p, hipStream_t stream) {
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    dA[p], hA[p], sizeof(T) * size_A, hipMemcpyHostToDevice, stream));
+            },
+            solve,
+            [&](int p, hipStream_t stream) {
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hARes[p], dA[p], sizeof(T) * size_A, hipMemcpyDeviceToHost, stream));
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hIpiv[p], dIpiv[p], sizeof(int) * size_P, hipMemcpyDeviceToHost, stream));
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hInfo[p], dInfo[p], sizeof(int), hipMemcpyDeviceToHost, stream));
+            },
+            &gpu_time_used,
+            hot_calls);
+    else
+        concurrent_getPerfData(
+            ctx,
+            [&] {
+                getrf_initData<false, true, T>(ctx.handle(0),
+                                               m,
+                                               n,
+                                               dA,
+                                               lda,
+                                               stA,
+                                               dIpiv,
+                                               stP,
+                                               dInfo,
+                                               problems,
+                                               hA,
+                                               hIpiv,
+                                               hInfo);
+            },
+            solve,
+            &gpu_time_used,
+            hot_calls);
+
+    // output results for rocsolver-bench
+    if(!argus.perf)
+    {
+        std::cerr << "\n============================================\n";
+        std::cerr << "Arguments:\n";
+        std::cerr << "============================================\n";
+        rocsolver_bench_output("m", "n", "lda");
+        rocsolver_bench_output(m, n, lda);
+    }
+    concurrent_output(argus, problems, gpu_time_used);
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+template <typename T>
+void testing_concurrent_syevd_heevd(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    char evectC = argus.get<char>("jobz");
+    char uploC  = argus.get<char>("uplo");
+    int  n      = argus.get<int>("n");
+    int  lda    = argus.get<int>("lda", n);
+
+    hipsolverEigMode_t  evect     = char2hipsolver_evect(evectC);
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || argus.streams < 1 || argus.handles < 1);
+    if(invalid_size)
+    {
+        ROCSOLVER_BENCH_INFORM(1);
+        return;
+    }
+
+    concurrent_context ctx(argus.handles, argus.streams);
+    int                problems = ctx.problems();
+
+    // determine sizes
+    size_t size_A        = size_t(lda) * n;
+    size_t size_D        = n;
+    int    stA           = size_A;
+    int    stD           = size_D;
+    double gpu_time_used = 0;
+
+    host_memory mem      = argus.pinned ? host_memory::pinned : host_memory::pageable;
+    size_t      size_Res = argus.e2e ? size_A : 0;
+    int         stRes    = argus.e2e ? stA : 0;
+
+    // memory allocations
+    std::vector<T>                   A;
+    host_strided_batch_vector<T>     hA(size_A, 1, stA, problems, mem);
+    host_strided_batch_vector<T>     hARes(size_Res, 1, stRes, problems, mem);
+    host_strided_batch_vector<S>     hD(size_D, 1, stD, problems, mem);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, problems, mem);
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, problems);
+    device_strided_batch_vector<S>   dD(size_D, 1, stD, problems);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, problems);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_syevd_heevd_bufferSize(false,
+                                     false,
+                                     ctx.handle(0),
+                                     evect,
+                                     uplo,
+                                     n,
+                                     dA.data(),
+                                     lda,
+                                     stA,
+                                     dD.data(),
+                                     stD,
+                                     &size_W,
+                                     1);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, problems);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // collect performance data
+    syevd_heevd_initData<true, false, T>(
+        ctx.handle(0), evect, n, dA, lda, problems, hA, A, false);
+    auto solve = [&](hipsolverHandle_t handle, int p) {
+        return hipsolver_syevd_heevd(false,
+                                     false,
+                                     handle,
+                                     evect,
+                                     uplo,
+                                     n,
+                                     dA[p],
+                                     lda,
+                                     stA,
+                                     dD[p],
+                                     stD,
+                                     dWork[p],
+                                     size_W,
+                                     dInfo[p],
+                                     1);
+    };
+    if(argus.e2e)
+        concurrent_getPerfData(
+            ctx,
+            [&](int p, hipStream_t stream) {
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    dA[p], hA[p], sizeof(T) * size_A, hipMemcpyHostToDevice, stream));
+            },
+            solve,
+            [&](int p, hipStream_t stream) {
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hARes[p], dA[p], sizeof(T) * size_A, hipMemcpyDeviceToHost, stream));
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hD[p], dD[p], sizeof(S) * size_D, hipMemcpyDeviceToHost, stream));
+                CHECK_HIP_ERROR(hipMemcpyAsync(
+                    hInfo[p], dInfo[p], sizeof(int), hipMemcpyDeviceToHost, stream));
+            },
+            &gpu_time_used,
+            hot_calls);
+    else
+        concurrent_getPerfData(
+            ctx,
+            [&] {
+                syevd_heevd_initData<false, true, T>(
+                    ctx.handle(0), evect, n, dA, lda, problems, hA, A, false);
+            },
+            solve,
+            &gpu_time_used,
+            hot_calls);
+
+    // output results for rocsolver-bench
+    if(!argus.perf)
+    {
+        std::cerr << "\n============================================\n";
+        std::cerr << "Arguments:\n";
+        std::cerr << "============================================\n";
+        rocsolver_bench_output("jobz", "uplo", "n", "lda");
+        rocsolver_bench_output(evectC, uploC, n, lda);
+    }
+    concurrent_output(argus, problems, gpu_time_used);
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename S, typename T, typename U, typename V>
+template <bool FORTRAN, bool STRIDED, typename S, typename T, typename U, typename V>
 void gebrd_checkBadArgs(const hipsolverHandle_t handle,
                         const int               m,
                         const int               n,
@@ -28,6 +28,7 @@ void gebrd_checkBadArgs(const hipsolverHandle_t handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                          STRIDED,
                                           nullptr,
                                           m,
                                           n,
@@ -54,6 +55,7 @@ void gebrd_checkBadArgs(const hipsolverHandle_t handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           m,
                                           n,
@@ -74,6 +76,7 @@ void gebrd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           m,
                                           n,
@@ -94,6 +97,7 @@ void gebrd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           m,
                                           n,
@@ -114,6 +118,7 @@ void gebrd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           m,
                                           n,
@@ -134,6 +139,7 @@ void gebrd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           m,
                                           n,
@@ -175,45 +181,54 @@ void testing_gebrd_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<S>   dD(1, 1, 1, 1);
-        // device_strided_batch_vector<S>   dE(1, 1, 1, 1);
-        // device_strided_batch_vector<T>   dTauq(1, 1, 1, 1);
-        // device_strided_batch_vector<T>   dTaup(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dD.memcheck());
-        // CHECK_HIP_ERROR(dE.memcheck());
-        // CHECK_HIP_ERROR(dTauq.memcheck());
-        // CHECK_HIP_ERROR(dTaup.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<S>   dD(1, 1, 1, 1);
+        device_strided_batch_vector<S>   dE(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dTauq(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dTaup(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dTauq.memcheck());
+        CHECK_HIP_ERROR(dTaup.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
 
-        // int size_W;
-        // hipsolver_gebrd_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
+        int size_W;
+        hipsolver_gebrd_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   m,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
 
-        // // check bad arguments
-        // gebrd_checkBadArgs<FORTRAN>(handle,
-        //                             m,
-        //                             n,
-        //                             dA.data(),
-        //                             lda,
-        //                             stA,
-        //                             dD.data(),
-        //                             stD,
-        //                             dE.data(),
-        //                             stE,
-        //                             dTauq.data(),
-        //                             stQ,
-        //                             dTaup.data(),
-        //                             stP,
-        //                             dWork.data(),
-        //                             size_W,
-        //                             dInfo.data(),
-        //                             bc);
+        // check bad arguments
+        gebrd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dD.data(),
+                                             stD,
+                                             dE.data(),
+                                             stE,
+                                             dTauq.data(),
+                                             stQ,
+                                             dTaup.data(),
+                                             stP,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
     }
     else
     {
@@ -232,30 +247,39 @@ void testing_gebrd_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_gebrd_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_gebrd_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   m,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   &size_W,
+                                   bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        gebrd_checkBadArgs<FORTRAN>(handle,
-                                    m,
-                                    n,
-                                    dA.data(),
-                                    lda,
-                                    stA,
-                                    dD.data(),
-                                    stD,
-                                    dE.data(),
-                                    stE,
-                                    dTauq.data(),
-                                    stQ,
-                                    dTaup.data(),
-                                    stP,
-                                    dWork.data(),
-                                    size_W,
-                                    dInfo.data(),
-                                    bc);
+        gebrd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dD.data(),
+                                             stD,
+                                             dE.data(),
+                                             stE,
+                                             dTauq.data(),
+                                             stQ,
+                                             dTaup.data(),
+                                             stP,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
     }
 }
 
@@ -317,6 +341,7 @@ void gebrd_initData(const hipsolverHandle_t handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
@@ -387,6 +412,7 @@ void gebrd_getError(const hipsolverHandle_t handle,
     {
         // GPU lapack
         CHECK_ROCBLAS_ERROR(hipsolver_gebrd(FORTRAN,
+                                            STRIDED,
                                             handle,
                                             m,
                                             n,
@@ -533,6 +559,7 @@ void gebrd_getError(const hipsolverHandle_t handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
@@ -650,6 +677,7 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
                                        hTaup);
 
         CHECK_ROCBLAS_ERROR(hipsolver_gebrd(FORTRAN,
+                                            STRIDED,
                                             handle,
                                             m,
                                             n,
@@ -673,7 +701,7 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
@@ -698,8 +726,9 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
                                        hTauq,
                                        hTaup);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_gebrd(FORTRAN,
+                        STRIDED,
                         handle,
                         m,
                         n,
@@ -718,7 +747,9 @@ void gebrd_getPerfData(const hipsolverHandle_t handle,
                         lwork,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -763,30 +794,32 @@ void testing_gebrd(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
-            //                                       handle,
-            //                                       m,
-            //                                       n,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (S*)nullptr,
-            //                                       stD,
-            //                                       (S*)nullptr,
-            //                                       stE,
-            //                                       (T*)nullptr,
-            //                                       stQ,
-            //                                       (T*)nullptr,
-            //                                       stP,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  m,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (S*)nullptr,
+                                                  stD,
+                                                  (S*)nullptr,
+                                                  stE,
+                                                  (T*)nullptr,
+                                                  stQ,
+                                                  (T*)nullptr,
+                                                  stP,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gebrd(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   m,
                                                   n,
@@ -816,97 +849,106 @@ void testing_gebrd(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>             hA(size_A, 1, bc);
-        // host_batch_vector<T>             hARes(size_ARes, 1, bc);
-        // host_strided_batch_vector<S>     hD(size_D, 1, stD, bc);
-        // host_strided_batch_vector<S>     hE(size_E, 1, stE, bc);
-        // host_strided_batch_vector<T>     hTaup(size_P, 1, stP, bc);
-        // host_strided_batch_vector<T>     hTauq(size_Q, 1, stQ, bc);
-        // host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
-        // device_batch_vector<T>           dA(size_A, 1, bc);
-        // device_strided_batch_vector<S>   dD(size_D, 1, stD, bc);
-        // device_strided_batch_vector<S>   dE(size_E, 1, stE, bc);
-        // device_strided_batch_vector<T>   dTauq(size_Q, 1, stQ, bc);
-        // device_strided_batch_vector<T>   dTaup(size_P, 1, stP, bc);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-        // if(size_D)
-        //     CHECK_HIP_ERROR(dD.memcheck());
-        // if(size_E)
-        //     CHECK_HIP_ERROR(dE.memcheck());
-        // if(size_Q)
-        //     CHECK_HIP_ERROR(dTauq.memcheck());
-        // if(size_P)
-        //     CHECK_HIP_ERROR(dTaup.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc);
+        host_strided_batch_vector<S>     hD(size_D, 1, stD, bc);
+        host_strided_batch_vector<S>     hE(size_E, 1, stE, bc);
+        host_strided_batch_vector<T>     hTaup(size_P, 1, stP, bc);
+        host_strided_batch_vector<T>     hTauq(size_Q, 1, stQ, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_strided_batch_vector<S>   dD(size_D, 1, stD, bc);
+        device_strided_batch_vector<S>   dE(size_E, 1, stE, bc);
+        device_strided_batch_vector<T>   dTauq(size_Q, 1, stQ, bc);
+        device_strided_batch_vector<T>   dTaup(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+        if(size_E)
+            CHECK_HIP_ERROR(dE.memcheck());
+        if(size_Q)
+            CHECK_HIP_ERROR(dTauq.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dTaup.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
 
-        // int size_W;
-        // hipsolver_gebrd_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
+        int size_W;
+        hipsolver_gebrd_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   m,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
 
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     gebrd_getError<FORTRAN, T>(handle,
-        //                                m,
-        //                                n,
-        //                                dA,
-        //                                lda,
-        //                                stA,
-        //                                dD,
-        //                                stD,
-        //                                dE,
-        //                                stE,
-        //                                dTauq,
-        //                                stQ,
-        //                                dTaup,
-        //                                stP,
-        //                                dWork,
-        //                                size_W,
-        //                                dInfo,
-        //                                bc,
-        //                                hA,
-        //                                hARes,
-        //                                hD,
-        //                                hE,
-        //                                hTauq,
-        //                                hTaup,
-        //                                hInfo,
-        //                                &max_error);
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gebrd_getError<FORTRAN, STRIDED, T>(handle,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dD,
+                                                stD,
+                                                dE,
+                                                stE,
+                                                dTauq,
+                                                stQ,
+                                                dTaup,
+                                                stP,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hARes,
+                                                hD,
+                                                hE,
+                                                hTauq,
+                                                hTaup,
+                                                hInfo,
+                                                &max_error);
 
-        // // collect performance data
-        // if(argus.timing)
-        //     gebrd_getPerfData<FORTRAN, T>(handle,
-        //                                   m,
-        //                                   n,
-        //                                   dA,
-        //                                   lda,
-        //                                   stA,
-        //                                   dD,
-        //                                   stD,
-        //                                   dE,
-        //                                   stE,
-        //                                   dTauq,
-        //                                   stQ,
-        //                                   dTaup,
-        //                                   stP,
-        //                                   dWork,
-        //                                   size_W,
-        //                                   dInfo,
-        //                                   bc,
-        //                                   hA,
-        //                                   hD,
-        //                                   hE,
-        //                                   hTauq,
-        //                                   hTaup,
-        //                                   hInfo,
-        //                                   &gpu_time_used,
-        //                                   &cpu_time_used,
-        //                                   hot_calls,
-        //                                   argus.perf);
+        // collect performance data
+        if(argus.timing)
+            gebrd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dD,
+                                                   stD,
+                                                   dE,
+                                                   stE,
+                                                   dTauq,
+                                                   stQ,
+                                                   dTaup,
+                                                   stP,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hD,
+                                                   hE,
+                                                   hTauq,
+                                                   hTaup,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
     }
 
     else
@@ -938,70 +980,79 @@ void testing_gebrd(Arguments& argus)
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_gebrd_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_gebrd_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   m,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   &size_W,
+                                   bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            gebrd_getError<FORTRAN, T>(handle,
-                                       m,
-                                       n,
-                                       dA,
-                                       lda,
-                                       stA,
-                                       dD,
-                                       stD,
-                                       dE,
-                                       stE,
-                                       dTauq,
-                                       stQ,
-                                       dTaup,
-                                       stP,
-                                       dWork,
-                                       size_W,
-                                       dInfo,
-                                       bc,
-                                       hA,
-                                       hARes,
-                                       hD,
-                                       hE,
-                                       hTauq,
-                                       hTaup,
-                                       hInfo,
-                                       &max_error);
+            gebrd_getError<FORTRAN, STRIDED, T>(handle,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dD,
+                                                stD,
+                                                dE,
+                                                stE,
+                                                dTauq,
+                                                stQ,
+                                                dTaup,
+                                                stP,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hARes,
+                                                hD,
+                                                hE,
+                                                hTauq,
+                                                hTaup,
+                                                hInfo,
+                                                &max_error);
 
         // collect performance data
         if(argus.timing)
-            gebrd_getPerfData<FORTRAN, T>(handle,
-                                          m,
-                                          n,
-                                          dA,
-                                          lda,
-                                          stA,
-                                          dD,
-                                          stD,
-                                          dE,
-                                          stE,
-                                          dTauq,
-                                          stQ,
-                                          dTaup,
-                                          stP,
-                                          dWork,
-                                          size_W,
-                                          dInfo,
-                                          bc,
-                                          hA,
-                                          hD,
-                                          hE,
-                                          hTauq,
-                                          hTaup,
-                                          hInfo,
-                                          &gpu_time_used,
-                                          &cpu_time_used,
-                                          hot_calls,
-                                          argus.perf);
+            gebrd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dD,
+                                                   stD,
+                                                   dE,
+                                                   stE,
+                                                   dTauq,
+                                                   stQ,
+                                                   dTaup,
+                                                   stP,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hD,
+                                                   hE,
+                                                   hTauq,
+                                                   hTaup,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -0,0 +1,704 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, bool STRIDED, typename T, typename U>
+void gels_checkBadArgs(const hipsolverHandle_t handle,
+                       const int               m,
+                       const int               n,
+                       const int               nrhs,
+                       T                       dA,
+                       const int               lda,
+                       const int               stA,
+                       T                       dB,
+                       const int               ldb,
+                       const int               stB,
+                       T                       dX,
+                       const int               ldx,
+                       void*                   dWork,
+                       const size_t            lwork,
+                       int*                    niters,
+                       U                       dInfo,
+                       const int               bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         STRIDED,
+                                         nullptr,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+    // pointers
+#if defined(__HIP_PLATFORM_NVCC__) || defined(__HIP_PLATFORM_NVIDIA__)
+    // cuBLAS does not check the matrices of a batch
+    if(STRIDED)
+        return;
+#endif
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         (T) nullptr,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         (T) nullptr,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         (U) nullptr,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // the strided batched functions solve in place, and do not iterate
+    if(STRIDED)
+        return;
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         (T) nullptr,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         m,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         stA,
+                                         dB,
+                                         ldb,
+                                         stB,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         (int*)nullptr,
+                                         dInfo,
+                                         bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <bool FORTRAN, bool STRIDED, typename T>
+void testing_gels_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    m      = 1;
+    int                    n      = 1;
+    int                    nrhs   = 1;
+    int                    lda    = 1;
+    int                    ldb    = 1;
+    int                    ldx    = 1;
+    int                    stA    = 1;
+    int                    stB    = 1;
+    int                    bc     = 1;
+    int                    niters = 0;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dX(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    size_t size_W;
+    CHECK_ROCBLAS_ERROR(hipsolver_gels_bufferSize(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  m,
+                                                  n,
+                                                  nrhs,
+                                                  dA.data(),
+                                                  lda,
+                                                  stA,
+                                                  dB.data(),
+                                                  ldb,
+                                                  stB,
+                                                  dX.data(),
+                                                  ldx,
+                                                  &size_W,
+                                                  bc));
+    device_strided_batch_vector<unsigned char> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gels_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                        m,
+                                        n,
+                                        nrhs,
+                                        dA.data(),
+                                        lda,
+                                        stA,
+                                        dB.data(),
+                                        ldb,
+                                        stB,
+                                        dX.data(),
+                                        ldx,
+                                        dWork.data(),
+                                        size_W,
+                                        &niters,
+                                        dInfo.data(),
+                                        bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gels_initData(const hipsolverHandle_t handle,
+                   const int               m,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dA,
+                   const int               lda,
+                   Td&                     dB,
+                   const int               ldb,
+                   const int               bc,
+                   Th&                     hA,
+                   Th&                     hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // scale A to make it well conditioned and of full rank
+        for(int b = 0; b < bc; ++b)
+        {
+            for(int i = 0; i < m; i++)
+            {
+                for(int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void gels_getError(const hipsolverHandle_t handle,
+                   const int               m,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dA,
+                   const int               lda,
+                   const int               stA,
+                   Td&                     dB,
+                   const int               ldb,
+                   const int               stB,
+                   Td&                     dX,
+                   const int               ldx,
+                   Vd&                     dWork,
+                   const size_t            lwork,
+                   Ud&                     dInfo,
+                   const int               bc,
+                   Th&                     hA,
+                   Th&                     hB,
+                   Th&                     hX,
+                   Th&                     hXRes,
+                   const int               ldr,
+                   Uh&                     hInfo,
+                   Uh&                     hInfoRes,
+                   int*                    niters,
+                   double*                 max_err)
+{
+    int            size_W = max(1, min(m, n) + max(min(m, n), nrhs));
+    std::vector<T> hW(size_W);
+
+    // input data initialization
+    gels_initData<true, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, bc, hA, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gels(FORTRAN,
+                                       STRIDED,
+                                       handle,
+                                       m,
+                                       n,
+                                       nrhs,
+                                       dA.data(),
+                                       lda,
+                                       stA,
+                                       dB.data(),
+                                       ldb,
+                                       stB,
+                                       dX.data(),
+                                       ldx,
+                                       dWork.data(),
+                                       lwork,
+                                       niters,
+                                       dInfo.data(),
+                                       bc));
+    if(STRIDED)
+        CHECK_HIP_ERROR(hXRes.transfer_from(dB));
+    else
+        CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+#pragma omp parallel for if(bc > 1) firstprivate(hW)
+    for(int b = 0; b < bc; ++b)
+    {
+        cblas_gels<T>(
+            HIPSOLVER_OP_N, m, n, nrhs, hA[b], lda, hB[b], ldb, hW.data(), size_W, hInfo[b]);
+        for(int j = 0; j < nrhs; j++)
+            for(int i = 0; i < n; i++)
+                hX[b][i + j * ldr] = hB[b][i + j * ldb];
+    }
+
+    // error is ||hX - hXRes|| / ||hX||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('I', n, nrhs, ldr, hX[b], hXRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // check info
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    *max_err += err;
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void gels_getPerfData(const hipsolverHandle_t handle,
+                      const int               m,
+                      const int               n,
+                      const int               nrhs,
+                      Td&                     dA,
+                      const int               lda,
+                      const int               stA,
+                      Td&                     dB,
+                      const int               ldb,
+                      const int               stB,
+                      Td&                     dX,
+                      const int               ldx,
+                      Vd&                     dWork,
+                      const size_t            lwork,
+                      Ud&                     dInfo,
+                      const int               bc,
+                      Th&                     hA,
+                      Th&                     hB,
+                      Uh&                     hInfo,
+                      int*                    niters,
+                      double*                 gpu_time_used,
+                      double*                 cpu_time_used,
+                      const int               hot_calls,
+                      const bool              perf)
+{
+    int                          size_W = max(1, min(m, n) + max(min(m, n), nrhs));
+    host_strided_batch_vector<T> hW(size_W, 1, size_W, 1);
+
+    if(!perf)
+    {
+        gels_initData<true, false, T>(handle, m, n, nrhs, dA, lda, dB, ldb, bc, hA, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+            cblas_gels<T>(
+                HIPSOLVER_OP_N, m, n, nrhs, hA[b], lda, hB[b], ldb, hW[0], size_W, hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gels_initData<true, false, T>(handle, m, n, nrhs, dA, lda, dB, ldb, bc, hA, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gels_initData<false, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, bc, hA, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gels(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           m,
+                                           n,
+                                           nrhs,
+                                           dA.data(),
+                                           lda,
+                                           stA,
+                                           dB.data(),
+                                           ldb,
+                                           stB,
+                                           dX.data(),
+                                           ldx,
+                                           dWork.data(),
+                                           lwork,
+                                           niters,
+                                           dInfo.data(),
+                                           bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gels_initData<false, true, T>(handle, m, n, nrhs, dA, lda, dB, ldb, bc, hA, hB);
+
+        timer.start();
+        hipsolver_gels(FORTRAN,
+                       STRIDED,
+                       handle,
+                       m,
+                       n,
+                       nrhs,
+                       dA.data(),
+                       lda,
+                       stA,
+                       dB.data(),
+                       ldb,
+                       stB,
+                       dX.data(),
+                       ldx,
+                       dWork.data(),
+                       lwork,
+                       niters,
+                       dInfo.data(),
+                       bc);
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool STRIDED, typename T>
+void testing_gels(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    m    = argus.get<int>("m");
+    int                    n    = argus.get<int>("n", m);
+    int                    nrhs = argus.get<int>("nrhs", n);
+    int                    lda  = argus.get<int>("lda", m);
+    int                    ldb  = argus.get<int>("ldb", max(m, n));
+    int                    ldx  = argus.get<int>("ldx", n);
+    int                    stA  = argus.get<int>("strideA", lda * n);
+    int                    stB  = argus.get<int>("strideB", ldb * nrhs);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+    int niters    = 0;
+
+    // the strided batched functions return the solution in B
+    int ldr = STRIDED ? ldb : ldx;
+    int stR = STRIDED ? stB : ldx * nrhs;
+
+    // check non-supported values
+#if defined(__HIP_PLATFORM_NVCC__) || defined(__HIP_PLATFORM_NVIDIA__)
+    // cuBLAS only solves the square and overdetermined systems of a batch
+    if(STRIDED && m < n)
+    {
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+#endif
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_B    = size_t(ldb) * nrhs;
+    size_t size_X    = STRIDED ? 1 : size_t(ldx) * nrhs;
+    size_t size_R    = size_t(ldr) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_RRes = (argus.unit_check || argus.norm_check) ? size_R : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < max(m, n) || bc < 0
+                         || (!STRIDED && (m < n || ldx < n)));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gels(FORTRAN,
+                                             STRIDED,
+                                             handle,
+                                             m,
+                                             n,
+                                             nrhs,
+                                             (T*)nullptr,
+                                             lda,
+                                             stA,
+                                             (T*)nullptr,
+                                             ldb,
+                                             stB,
+                                             (T*)nullptr,
+                                             ldx,
+                                             nullptr,
+                                             0,
+                                             &niters,
+                                             (int*)nullptr,
+                                             bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, stA, bc);
+    host_strided_batch_vector<T>     hB(size_B, 1, stB, bc);
+    host_strided_batch_vector<T>     hX(size_R, 1, stR, bc);
+    host_strided_batch_vector<T>     hXRes(size_RRes, 1, stR, bc);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+    device_strided_batch_vector<T>   dB(size_B, 1, stB, bc);
+    device_strided_batch_vector<T>   dX(size_X, 1, size_X, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(size_X)
+        CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    size_t size_W;
+    CHECK_ROCBLAS_ERROR(hipsolver_gels_bufferSize(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  m,
+                                                  n,
+                                                  nrhs,
+                                                  dA.data(),
+                                                  lda,
+                                                  stA,
+                                                  dB.data(),
+                                                  ldb,
+                                                  stB,
+                                                  dX.data(),
+                                                  ldx,
+                                                  &size_W,
+                                                  bc));
+    device_strided_batch_vector<unsigned char> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gels_getError<FORTRAN, STRIDED, T>(handle,
+                                           m,
+                                           n,
+                                           nrhs,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dB,
+                                           ldb,
+                                           stB,
+                                           dX,
+                                           ldx,
+                                           dWork,
+                                           size_W,
+                                           dInfo,
+                                           bc,
+                                           hA,
+                                           hB,
+                                           hX,
+                                           hXRes,
+                                           ldr,
+                                           hInfo,
+                                           hInfoRes,
+                                           &niters,
+                                           &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        gels_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                              m,
+                                              n,
+                                              nrhs,
+                                              dA,
+                                              lda,
+                                              stA,
+                                              dB,
+                                              ldb,
+                                              stB,
+                                              dX,
+                                              ldx,
+                                              dWork,
+                                              size_W,
+                                              dInfo,
+                                              bc,
+                                              hA,
+                                              hB,
+                                              hInfo,
+                                              &niters,
+                                              &gpu_time_used,
+                                              &cpu_time_used,
+                                              hot_calls,
+                                              argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(STRIDED)
+            {
+                rocsolver_bench_output(
+                    "m", "n", "nrhs", "lda", "strideA", "ldb", "strideB", "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, stA, ldb, stB, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "ldx");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, ldx);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "iters", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, niters, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "iters");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, niters);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U, typename V>
+template <bool FORTRAN, bool STRIDED, typename T, typename U, typename V>
 void geqrf_checkBadArgs(const hipsolverHandle_t handle,
                         const int               m,
                         const int               n,
@@ -22,7 +22,8 @@ void geqrf_checkBadArgs(const hipsolverHandle_t handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(
-        hipsolver_geqrf(FORTRAN, nullptr, m, n, dA, lda, stA, dIpiv, stP, dWork, lwork, dInfo, bc),
+        hipsolver_geqrf(
+            FORTRAN, STRIDED, nullptr, m, n, dA, lda, stA, dIpiv, stP, dWork, lwork, dInfo, bc),
         HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
@@ -30,14 +31,36 @@ void geqrf_checkBadArgs(const hipsolverHandle_t handle,
 
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_geqrf(
-            FORTRAN, handle, m, n, (T) nullptr, lda, stA, dIpiv, stP, dWork, lwork, dInfo, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_geqrf(
-            FORTRAN, handle, m, n, dA, lda, stA, (U) nullptr, stP, dWork, lwork, dInfo, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(FORTRAN,
+                                          STRIDED,
+                                          handle,
+                                          m,
+                                          n,
+                                          (T) nullptr,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(FORTRAN,
+                                          STRIDED,
+                                          handle,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          (U) nullptr,
+                                          stP,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
@@ -55,33 +78,34 @@ void testing_geqrf_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_geqrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // geqrf_checkBadArgs<FORTRAN>(handle,
-        //                             m,
-        //                             n,
-        //                             dA.data(),
-        //                             lda,
-        //                             stA,
-        //                             dIpiv.data(),
-        //                             stP,
-        //                             dWork.data(),
-        //                             size_W,
-        //                             dInfo.data(),
-        //                             bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_geqrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, stP, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        geqrf_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dIpiv.data(),
+                                             stP,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
     }
     else
     {
@@ -94,24 +118,25 @@ void testing_geqrf_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_geqrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_geqrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, stP, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        geqrf_checkBadArgs<FORTRAN>(handle,
-                                    m,
-                                    n,
-                                    dA.data(),
-                                    lda,
-                                    stA,
-                                    dIpiv.data(),
-                                    stP,
-                                    dWork.data(),
-                                    size_W,
-                                    dInfo.data(),
-                                    bc);
+        geqrf_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dIpiv.data(),
+                                             stP,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
     }
 }
 
@@ -156,6 +181,7 @@ void geqrf_initData(const hipsolverHandle_t handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -189,6 +215,7 @@ void geqrf_getError(const hipsolverHandle_t handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_geqrf(FORTRAN,
+                                        STRIDED,
                                         handle,
                                         m,
                                         n,
@@ -204,6 +231,7 @@ void geqrf_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hARes.transfer_from(dA));
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1) firstprivate(hW)
     for(int b = 0; b < bc; ++b)
         cblas_geqrf<T>(m, n, hA[b], lda, hIpiv[b], hW.data(), n);
 
@@ -221,6 +249,7 @@ void geqrf_getError(const hipsolverHandle_t handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -269,6 +298,7 @@ void geqrf_getPerfData(const hipsolverHandle_t handle,
         geqrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
         CHECK_ROCBLAS_ERROR(hipsolver_geqrf(FORTRAN,
+                                            STRIDED,
                                             handle,
                                             m,
                                             n,
@@ -286,14 +316,15 @@ void geqrf_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         geqrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_geqrf(FORTRAN,
+                        STRIDED,
                         handle,
                         m,
                         n,
@@ -306,7 +337,9 @@ void geqrf_getPerfData(const hipsolverHandle_t handle,
                         lwork,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -343,24 +376,26 @@ void testing_geqrf(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(FORTRAN,
-            //                                       handle,
-            //                                       m,
-            //                                       n,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (T*)nullptr,
-            //                                       stP,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  m,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (T*)nullptr,
+                                                  stP,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_geqrf(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   m,
                                                   n,
@@ -384,67 +419,68 @@ void testing_geqrf(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>             hA(size_A, 1, bc);
-        // host_batch_vector<T>             hARes(size_ARes, 1, bc);
-        // host_strided_batch_vector<T>     hIpiv(size_P, 1, stP, bc);
-        // host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
-        // device_batch_vector<T>           dA(size_A, 1, bc);
-        // device_strided_batch_vector<T>   dIpiv(size_P, 1, stP, bc);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-        // if(size_P)
-        //     CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_geqrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     geqrf_getError<FORTRAN, T>(handle,
-        //                                m,
-        //                                n,
-        //                                dA,
-        //                                lda,
-        //                                stA,
-        //                                dIpiv,
-        //                                stP,
-        //                                dWork,
-        //                                size_W,
-        //                                dInfo,
-        //                                bc,
-        //                                hA,
-        //                                hARes,
-        //                                hIpiv,
-        //                                hInfo,
-        //                                &max_error);
-
-        // // collect performance data
-        // if(argus.timing)
-        //     geqrf_getPerfData<FORTRAN, T>(handle,
-        //                                   m,
-        //                                   n,
-        //                                   dA,
-        //                                   lda,
-        //                                   stA,
-        //                                   dIpiv,
-        //                                   stP,
-        //                                   dWork,
-        //                                   size_W,
-        //                                   dInfo,
-        //                                   bc,
-        //                                   hA,
-        //                                   hIpiv,
-        //                                   hInfo,
-        //                                   &gpu_time_used,
-        //                                   &cpu_time_used,
-        //                                   hot_calls,
-        //                                   argus.perf);
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc);
+        host_strided_batch_vector<T>     hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_strided_batch_vector<T>   dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_geqrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, stP, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrf_getError<FORTRAN, STRIDED, T>(handle,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hARes,
+                                                hIpiv,
+                                                hInfo,
+                                                &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqrf_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dIpiv,
+                                                   stP,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hIpiv,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
     }
 
     else
@@ -464,52 +500,53 @@ void testing_geqrf(Arguments& argus)
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_geqrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_geqrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, stP, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            geqrf_getError<FORTRAN, T>(handle,
-                                       m,
-                                       n,
-                                       dA,
-                                       lda,
-                                       stA,
-                                       dIpiv,
-                                       stP,
-                                       dWork,
-                                       size_W,
-                                       dInfo,
-                                       bc,
-                                       hA,
-                                       hARes,
-                                       hIpiv,
-                                       hInfo,
-                                       &max_error);
+            geqrf_getError<FORTRAN, STRIDED, T>(handle,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hARes,
+                                                hIpiv,
+                                                hInfo,
+                                                &max_error);
 
         // collect performance data
         if(argus.timing)
-            geqrf_getPerfData<FORTRAN, T>(handle,
-                                          m,
-                                          n,
-                                          dA,
-                                          lda,
-                                          stA,
-                                          dIpiv,
-                                          stP,
-                                          dWork,
-                                          size_W,
-                                          dInfo,
-                                          bc,
-                                          hA,
-                                          hIpiv,
-                                          hInfo,
-                                          &gpu_time_used,
-                                          &cpu_time_used,
-                                          hot_calls,
-                                          argus.perf);
+            geqrf_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dIpiv,
+                                                   stP,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hIpiv,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -0,0 +1,582 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, typename T, typename U>
+void gesv_checkBadArgs(const hipsolverHandle_t handle,
+                       const int               n,
+                       const int               nrhs,
+                       T                       dA,
+                       const int               lda,
+                       U                       dIpiv,
+                       T                       dB,
+                       const int               ldb,
+                       T                       dX,
+                       const int               ldx,
+                       void*                   dWork,
+                       const size_t            lwork,
+                       int*                    niters,
+                       U                       dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesv(FORTRAN,
+                                         nullptr,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         dIpiv,
+                                         dB,
+                                         ldb,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesv(FORTRAN,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         (T) nullptr,
+                                         lda,
+                                         dIpiv,
+                                         dB,
+                                         ldb,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesv(FORTRAN,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         (U) nullptr,
+                                         dB,
+                                         ldb,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesv(FORTRAN,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         dIpiv,
+                                         (T) nullptr,
+                                         ldb,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesv(FORTRAN,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         dIpiv,
+                                         dB,
+                                         ldb,
+                                         (T) nullptr,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesv(FORTRAN,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         dIpiv,
+                                         dB,
+                                         ldb,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         (int*)nullptr,
+                                         dInfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesv(FORTRAN,
+                                         handle,
+                                         n,
+                                         nrhs,
+                                         dA,
+                                         lda,
+                                         dIpiv,
+                                         dB,
+                                         ldb,
+                                         dX,
+                                         ldx,
+                                         dWork,
+                                         lwork,
+                                         niters,
+                                         (U) nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+template <bool FORTRAN, typename T>
+void testing_gesv_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    n      = 1;
+    int                    nrhs   = 1;
+    int                    lda    = 1;
+    int                    ldb    = 1;
+    int                    ldx    = 1;
+    int                    niters = 0;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dX(1, 1, 1, 1);
+    device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    size_t size_W;
+    CHECK_ROCBLAS_ERROR(hipsolver_gesv_bufferSize(FORTRAN,
+                                                  handle,
+                                                  n,
+                                                  nrhs,
+                                                  dA.data(),
+                                                  lda,
+                                                  dIpiv.data(),
+                                                  dB.data(),
+                                                  ldb,
+                                                  dX.data(),
+                                                  ldx,
+                                                  &size_W));
+    device_strided_batch_vector<unsigned char> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gesv_checkBadArgs<FORTRAN>(handle,
+                               n,
+                               nrhs,
+                               dA.data(),
+                               lda,
+                               dIpiv.data(),
+                               dB.data(),
+                               ldb,
+                               dX.data(),
+                               ldx,
+                               dWork.data(),
+                               size_W,
+                               &niters,
+                               dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesv_initData(const hipsolverHandle_t handle,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dA,
+                   const int               lda,
+                   Td&                     dB,
+                   const int               ldb,
+                   Th&                     hA,
+                   Th&                     hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh>
+void gesv_getError(const hipsolverHandle_t handle,
+                   const int               n,
+                   const int               nrhs,
+                   Td&                     dA,
+                   const int               lda,
+                   Ud&                     dIpiv,
+                   Td&                     dB,
+                   const int               ldb,
+                   Td&                     dX,
+                   const int               ldx,
+                   Vd&                     dWork,
+                   const size_t            lwork,
+                   Ud&                     dInfo,
+                   Th&                     hA,
+                   Uh&                     hIpiv,
+                   Th&                     hB,
+                   Th&                     hX,
+                   Th&                     hXRes,
+                   Uh&                     hInfo,
+                   Uh&                     hInfoRes,
+                   int*                    niters,
+                   double*                 max_err)
+{
+    // input data initialization
+    gesv_initData<true, true, T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gesv(FORTRAN,
+                                       handle,
+                                       n,
+                                       nrhs,
+                                       dA.data(),
+                                       lda,
+                                       dIpiv.data(),
+                                       dB.data(),
+                                       ldb,
+                                       dX.data(),
+                                       ldx,
+                                       dWork.data(),
+                                       lwork,
+                                       niters,
+                                       dInfo.data()));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(int j = 0; j < nrhs; j++)
+        for(int i = 0; i < n; i++)
+            hX[0][i + j * ldx] = hB[0][i + j * ldb];
+    cblas_getrf<T>(n, n, hA[0], lda, hIpiv[0], hInfo[0]);
+    cblas_getrs<T>(HIPSOLVER_OP_N, n, nrhs, hA[0], lda, hIpiv[0], hX[0], ldx);
+
+    // error is ||hX - hXRes|| / ||hX||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    *max_err = norm_error('I', n, nrhs, ldx, hX[0], hXRes[0]);
+
+    // check info
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err += 1;
+
+    // the test matrices are well conditioned, so the refinement must converge
+    if(*niters < 0)
+        *max_err += 1;
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh>
+void gesv_getPerfData(const hipsolverHandle_t handle,
+                      const int               n,
+                      const int               nrhs,
+                      Td&                     dA,
+                      const int               lda,
+                      Ud&                     dIpiv,
+                      Td&                     dB,
+                      const int               ldb,
+                      Td&                     dX,
+                      const int               ldx,
+                      Vd&                     dWork,
+                      const size_t            lwork,
+                      Ud&                     dInfo,
+                      Th&                     hA,
+                      Uh&                     hIpiv,
+                      Th&                     hB,
+                      Uh&                     hInfo,
+                      int*                    niters,
+                      double*                 gpu_time_used,
+                      double*                 cpu_time_used,
+                      const int               hot_calls,
+                      const bool              perf)
+{
+    if(!perf)
+    {
+        gesv_initData<true, false, T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_getrf<T>(n, n, hA[0], lda, hIpiv[0], hInfo[0]);
+        cblas_getrs<T>(HIPSOLVER_OP_N, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesv_initData<true, false, T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesv_initData<false, true, T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gesv(FORTRAN,
+                                           handle,
+                                           n,
+                                           nrhs,
+                                           dA.data(),
+                                           lda,
+                                           dIpiv.data(),
+                                           dB.data(),
+                                           ldb,
+                                           dX.data(),
+                                           ldx,
+                                           dWork.data(),
+                                           lwork,
+                                           niters,
+                                           dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gesv_initData<false, true, T>(handle, n, nrhs, dA, lda, dB, ldb, hA, hB);
+
+        timer.start();
+        hipsolver_gesv(FORTRAN,
+                       handle,
+                       n,
+                       nrhs,
+                       dA.data(),
+                       lda,
+                       dIpiv.data(),
+                       dB.data(),
+                       ldb,
+                       dX.data(),
+                       ldx,
+                       dWork.data(),
+                       lwork,
+                       niters,
+                       dInfo.data());
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, typename T>
+void testing_gesv(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    n    = argus.get<int>("n");
+    int                    nrhs = argus.get<int>("nrhs", n);
+    int                    lda  = argus.get<int>("lda", n);
+    int                    ldb  = argus.get<int>("ldb", n);
+    int                    ldx  = argus.get<int>("ldx", n);
+
+    int hot_calls = argus.iters;
+    int niters    = 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_B    = size_t(ldb) * nrhs;
+    size_t size_X    = size_t(ldx) * nrhs;
+    size_t size_P    = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_XRes = (argus.unit_check || argus.norm_check) ? size_X : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n);
+    if(invalid_size)
+    {
+        size_t size_W;
+        EXPECT_ROCBLAS_STATUS(hipsolver_gesv_bufferSize(FORTRAN,
+                                                        handle,
+                                                        n,
+                                                        nrhs,
+                                                        (T*)nullptr,
+                                                        lda,
+                                                        (int*)nullptr,
+                                                        (T*)nullptr,
+                                                        ldb,
+                                                        (T*)nullptr,
+                                                        ldx,
+                                                        &size_W),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T>     hX(size_X, 1, size_X, 1);
+    host_strided_batch_vector<T>     hXRes(size_XRes, 1, size_XRes, 1);
+    host_strided_batch_vector<int>   hIpiv(size_P, 1, size_P, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T>   dB(size_B, 1, size_B, 1);
+    device_strided_batch_vector<T>   dX(size_X, 1, size_X, 1);
+    device_strided_batch_vector<int> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(size_X)
+        CHECK_HIP_ERROR(dX.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    size_t size_W;
+    CHECK_ROCBLAS_ERROR(hipsolver_gesv_bufferSize(FORTRAN,
+                                                  handle,
+                                                  n,
+                                                  nrhs,
+                                                  dA.data(),
+                                                  lda,
+                                                  dIpiv.data(),
+                                                  dB.data(),
+                                                  ldb,
+                                                  dX.data(),
+                                                  ldx,
+                                                  &size_W));
+    device_strided_batch_vector<unsigned char> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gesv_getError<FORTRAN, T>(handle,
+                                  n,
+                                  nrhs,
+                                  dA,
+                                  lda,
+                                  dIpiv,
+                                  dB,
+                                  ldb,
+                                  dX,
+                                  ldx,
+                                  dWork,
+                                  size_W,
+                                  dInfo,
+                                  hA,
+                                  hIpiv,
+                                  hB,
+                                  hX,
+                                  hXRes,
+                                  hInfo,
+                                  hInfoRes,
+                                  &niters,
+                                  &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        gesv_getPerfData<FORTRAN, T>(handle,
+                                     n,
+                                     nrhs,
+                                     dA,
+                                     lda,
+                                     dIpiv,
+                                     dB,
+                                     ldb,
+                                     dX,
+                                     ldx,
+                                     dWork,
+                                     size_W,
+                                     dInfo,
+                                     hA,
+                                     hIpiv,
+                                     hB,
+                                     hInfo,
+                                     &niters,
+                                     &gpu_time_used,
+                                     &cpu_time_used,
+                                     hot_calls,
+                                     argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("n", "nrhs", "lda", "ldb", "ldx");
+            rocsolver_bench_output(n, nrhs, lda, ldb, ldx);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "iters", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, niters, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "iters");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, niters);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename TT, typename W, typename U>
+template <bool FORTRAN, bool STRIDED, typename T, typename TT, typename W, typename U>
 void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                         const char              left_svect,
                         const char              right_svect,
@@ -32,6 +32,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           nullptr,
                                           left_svect,
                                           right_svect,
@@ -58,6 +59,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           '\0',
                                           right_svect,
@@ -82,6 +84,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           '\0',
@@ -106,6 +109,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           'O',
                                           'O',
@@ -133,6 +137,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -157,6 +162,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -181,6 +187,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -205,6 +212,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -229,6 +237,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -253,6 +262,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           left_svect,
                                           right_svect,
@@ -317,13 +327,13 @@ void testing_gesvd_bad_arg()
         // CHECK_HIP_ERROR(dinfo.memcheck());
 
         // int size_W;
-        // hipsolver_gesvd_bufferSize(FORTRAN, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W);
+        // hipsolver_gesvd_bufferSize(FORTRAN, STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W, bc);
         // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         // if(size_W)
         //     CHECK_HIP_ERROR(dWork.memcheck());
 
         // // check bad arguments
-        // gesvd_checkBadArgs<FORTRAN>(handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
+        // gesvd_checkBadArgs<FORTRAN, STRIDED>(handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
         //                             dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
         //                             dWork.data(), size_W, dE.data(), stE, dinfo.data(), bc);
     }
@@ -345,34 +355,34 @@ void testing_gesvd_bad_arg()
 
         int size_W;
         hipsolver_gesvd_bufferSize(
-            FORTRAN, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W);
+            FORTRAN, STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        gesvd_checkBadArgs<FORTRAN>(handle,
-                                    left_svect,
-                                    right_svect,
-                                    m,
-                                    n,
-                                    dA.data(),
-                                    lda,
-                                    stA,
-                                    dS.data(),
-                                    stS,
-                                    dU.data(),
-                                    ldu,
-                                    stU,
-                                    dV.data(),
-                                    ldv,
-                                    stV,
-                                    dWork.data(),
-                                    size_W,
-                                    dE.data(),
-                                    stE,
-                                    dinfo.data(),
-                                    bc);
+        gesvd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             left_svect,
+                                             right_svect,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dS.data(),
+                                             stS,
+                                             dU.data(),
+                                             ldu,
+                                             stU,
+                                             dV.data(),
+                                             ldv,
+                                             stV,
+                                             dWork.data(),
+                                             size_W,
+                                             dE.data(),
+                                             stE,
+                                             dinfo.data(),
+                                             bc);
     }
 }
 
@@ -427,6 +437,7 @@ void gesvd_initData(const hipsolverHandle_t handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Wd,
           typename Td,
@@ -495,6 +506,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
     // complementary execution to compute all singular vectors if needed (always in-place to ensure
     // we don't combine results computed by gemm_batched with results computed by gemm_strided_batched)
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(FORTRAN,
+                                        STRIDED,
                                         handle,
                                         left_svectT,
                                         right_svectT,
@@ -526,6 +538,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
     gesvd_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A);
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1) firstprivate(hWork)
     for(int b = 0; b < bc; ++b)
         cblas_gesvd<T>(left_svect,
                        right_svect,
@@ -545,6 +558,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
 
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(FORTRAN,
+                                        STRIDED,
                                         handle,
                                         left_svect,
                                         right_svect,
@@ -644,6 +658,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Wd,
           typename Td,
@@ -725,6 +740,7 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
             handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
         CHECK_ROCBLAS_ERROR(hipsolver_gesvd(FORTRAN,
+                                            STRIDED,
                                             handle,
                                             left_svect,
                                             right_svect,
@@ -752,15 +768,16 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         gesvd_initData<false, true, T>(
             handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_gesvd(FORTRAN,
+                        STRIDED,
                         handle,
                         left_svect,
                         right_svect,
@@ -783,7 +800,9 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
                         stE,
                         dinfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -817,6 +836,7 @@ void testing_gesvd(Arguments& argus)
         if(BATCHED)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+            //                                       STRIDED,
             //                                       handle,
             //                                       leftv,
             //                                       rightv,
@@ -844,6 +864,7 @@ void testing_gesvd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   leftv,
                                                   rightv,
@@ -982,6 +1003,7 @@ void testing_gesvd(Arguments& argus)
         if(BATCHED)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+            //                                       STRIDED,
             //                                       handle,
             //                                       leftv,
             //                                       rightv,
@@ -1009,6 +1031,7 @@ void testing_gesvd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   leftv,
                                                   rightv,
@@ -1083,8 +1106,8 @@ void testing_gesvd(Arguments& argus)
         //     CHECK_HIP_ERROR(dA.memcheck());
 
         // int w1, w2;
-        // hipsolver_gesvd_bufferSize(FORTRAN, handle, leftv, rightv, m, n, dA.data(), lda, &w1);
-        // hipsolver_gesvd_bufferSize(FORTRAN, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2);
+        // hipsolver_gesvd_bufferSize(FORTRAN, STRIDED, handle, leftv, rightv, m, n, dA.data(), lda, &w1, bc);
+        // hipsolver_gesvd_bufferSize(FORTRAN, STRIDED, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2, bc);
         // int size_W = max(w1, w2);
         // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         // if(size_W)
@@ -1093,90 +1116,90 @@ void testing_gesvd(Arguments& argus)
         // // check computations
         // if(argus.unit_check || argus.norm_check)
         // {
-        //     gesvd_getError<FORTRAN, T>(handle,
-        //                                leftv,
-        //                                rightv,
-        //                                m,
-        //                                n,
-        //                                dA,
-        //                                lda,
-        //                                stA,
-        //                                dS,
-        //                                stS,
-        //                                dU,
-        //                                ldu,
-        //                                stU,
-        //                                dV,
-        //                                ldv,
-        //                                stV,
-        //                                dWork,
-        //                                size_W,
-        //                                dE,
-        //                                stE,
-        //                                dinfo,
-        //                                bc,
-        //                                leftvT,
-        //                                rightvT,
-        //                                mT,
-        //                                nT,
-        //                                dUT,
-        //                                lduT,
-        //                                stUT,
-        //                                dVT,
-        //                                ldvT,
-        //                                stVT,
-        //                                hA,
-        //                                hS,
-        //                                hSres,
-        //                                hU,
-        //                                Ures,
-        //                                ldures,
-        //                                hV,
-        //                                Vres,
-        //                                ldvres,
-        //                                hE,
-        //                                hEres,
-        //                                hinfo,
-        //                                hinfoRes,
-        //                                &max_error,
-        //                                &max_errorv);
+        //     gesvd_getError<FORTRAN, STRIDED, T>(handle,
+        //                                         leftv,
+        //                                         rightv,
+        //                                         m,
+        //                                         n,
+        //                                         dA,
+        //                                         lda,
+        //                                         stA,
+        //                                         dS,
+        //                                         stS,
+        //                                         dU,
+        //                                         ldu,
+        //                                         stU,
+        //                                         dV,
+        //                                         ldv,
+        //                                         stV,
+        //                                         dWork,
+        //                                         size_W,
+        //                                         dE,
+        //                                         stE,
+        //                                         dinfo,
+        //                                         bc,
+        //                                         leftvT,
+        //                                         rightvT,
+        //                                         mT,
+        //                                         nT,
+        //                                         dUT,
+        //                                         lduT,
+        //                                         stUT,
+        //                                         dVT,
+        //                                         ldvT,
+        //                                         stVT,
+        //                                         hA,
+        //                                         hS,
+        //                                         hSres,
+        //                                         hU,
+        //                                         Ures,
+        //                                         ldures,
+        //                                         hV,
+        //                                         Vres,
+        //                                         ldvres,
+        //                                         hE,
+        //                                         hEres,
+        //                                         hinfo,
+        //                                         hinfoRes,
+        //                                         &max_error,
+        //                                         &max_errorv);
         // }
 
         // // collect performance data
         // if(argus.timing)
         // {
-        //     gesvd_getPerfData<FORTRAN, T>(handle,
-        //                                   leftv,
-        //                                   rightv,
-        //                                   m,
-        //                                   n,
-        //                                   dA,
-        //                                   lda,
-        //                                   stA,
-        //                                   dS,
-        //                                   stS,
-        //                                   dU,
-        //                                   ldu,
-        //                                   stU,
-        //                                   dV,
-        //                                   ldv,
-        //                                   stV,
-        //                                   dWork,
-        //                                   size_W,
-        //                                   dE,
-        //                                   stE,
-        //                                   dinfo,
-        //                                   bc,
-        //                                   hA,
-        //                                   hS,
-        //                                   hU,
-        //                                   hV,
-        //                                   hE,
-        //                                   hinfo,
-        //                                   &gpu_time_used,
-        //                                   &cpu_time_used,
-        //                                   hot_calls,
-        //                                   argus.perf);
+        //     gesvd_getPerfData<FORTRAN, STRIDED, T>(handle,
+        //                                            leftv,
+        //                                            rightv,
+        //                                            m,
+        //                                            n,
+        //                                            dA,
+        //                                            lda,
+        //                                            stA,
+        //                                            dS,
+        //                                            stS,
+        //                                            dU,
+        //                                            ldu,
+        //                                            stU,
+        //                                            dV,
+        //                                            ldv,
+        //                                            stV,
+        //                                            dWork,
+        //                                            size_W,
+        //                                            dE,
+        //                                            stE,
+        //                                            dinfo,
+        //                                            bc,
+        //                                            hA,
+        //                                            hS,
+        //                                            hU,
+        //                                            hV,
+        //                                            hE,
+        //                                            hinfo,
+        //                                            &gpu_time_used,
+        //                                            &cpu_time_used,
+        //                                            hot_calls,
+        //                                            argus.perf);
         // }
     }
 
@@ -1189,8 +1212,10 @@ void testing_gesvd(Arguments& argus)
             CHECK_HIP_ERROR(dA.memcheck());
 
         int w1, w2;
-        hipsolver_gesvd_bufferSize(FORTRAN, handle, leftv, rightv, m, n, dA.data(), lda, &w1);
-        hipsolver_gesvd_bufferSize(FORTRAN, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2);
+        hipsolver_gesvd_bufferSize(
+            FORTRAN, STRIDED, handle, leftv, rightv, m, n, dA.data(), lda, &w1, bc);
+        hipsolver_gesvd_bufferSize(
+            FORTRAN, STRIDED, handle, leftvT, rightvT, mT, nT, dA.data(), lda, &w2, bc);
         int                            size_W = max(w1, w2);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
@@ -1199,90 +1224,90 @@ void testing_gesvd(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            gesvd_getError<FORTRAN, T>(handle,
-                                       leftv,
-                                       rightv,
-                                       m,
-                                       n,
-                                       dA,
-                                       lda,
-                                       stA,
-                                       dS,
-                                       stS,
-                                       dU,
-                                       ldu,
-                                       stU,
-                                       dV,
-                                       ldv,
-                                       stV,
-                                       dWork,
-                                       size_W,
-                                       dE,
-                                       stE,
-                                       dinfo,
-                                       bc,
-                                       leftvT,
-                                       rightvT,
-                                       mT,
-                                       nT,
-                                       dUT,
-                                       lduT,
-                                       stUT,
-                                       dVT,
-                                       ldvT,
-                                       stVT,
-                                       hA,
-                                       hS,
-                                       hSres,
-                                       hU,
-                                       Ures,
-                                       ldures,
-                                       hV,
-                                       Vres,
-                                       ldvres,
-                                       hE,
-                                       hEres,
-                                       hinfo,
-                                       hinfoRes,
-                                       &max_error,
-                                       &max_errorv);
+            gesvd_getError<FORTRAN, STRIDED, T>(handle,
+                                                leftv,
+                                                rightv,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dS,
+                                                stS,
+                                                dU,
+                                                ldu,
+                                                stU,
+                                                dV,
+                                                ldv,
+                                                stV,
+                                                dWork,
+                                                size_W,
+                                                dE,
+                                                stE,
+                                                dinfo,
+                                                bc,
+                                                leftvT,
+                                                rightvT,
+                                                mT,
+                                                nT,
+                                                dUT,
+                                                lduT,
+                                                stUT,
+                                                dVT,
+                                                ldvT,
+                                                stVT,
+                                                hA,
+                                                hS,
+                                                hSres,
+                                                hU,
+                                                Ures,
+                                                ldures,
+                                                hV,
+                                                Vres,
+                                                ldvres,
+                                                hE,
+                                                hEres,
+                                                hinfo,
+                                                hinfoRes,
+                                                &max_error,
+                                                &max_errorv);
         }
 
         // collect performance data
         if(argus.timing)
         {
-            gesvd_getPerfData<FORTRAN, T>(handle,
-                                          leftv,
-                                          rightv,
-                                          m,
-                                          n,
-                                          dA,
-                                          lda,
-                                          stA,
-                                          dS,
-                                          stS,
-                                          dU,
-                                          ldu,
-                                          stU,
-                                          dV,
-                                          ldv,
-                                          stV,
-                                          dWork,
-                                          size_W,
-                                          dE,
-                                          stE,
-                                          dinfo,
-                                          bc,
-                                          hA,
-                                          hS,
-                                          hU,
-                                          hV,
-                                          hE,
-                                          hinfo,
-                                          &gpu_time_used,
-                                          &cpu_time_used,
-                                          hot_calls,
-                                          argus.perf);
+            gesvd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   leftv,
+                                                   rightv,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dS,
+                                                   stS,
+                                                   dU,
+                                                   ldu,
+                                                   stU,
+                                                   dV,
+                                                   ldv,
+                                                   stV,
+                                                   dWork,
+                                                   size_W,
+                                                   dE,
+                                                   stE,
+                                                   dinfo,
+                                                   bc,
+                                                   hA,
+                                                   hS,
+                                                   hU,
+                                                   hV,
+                                                   hE,
+                                                   hinfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
         }
     }
 
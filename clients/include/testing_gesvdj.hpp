@@ -0,0 +1,921 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, bool STRIDED, typename T, typename S, typename U>
+void gesvdj_checkBadArgs(const hipsolverHandle_t     handle,
+                         const hipsolverEigMode_t    jobz,
+                         const int                   econ,
+                         const int                   m,
+                         const int                   n,
+                         T                           dA,
+                         const int                   lda,
+                         const int                   stA,
+                         S                           dS,
+                         const int                   stS,
+                         T                           dU,
+                         const int                   ldu,
+                         const int                   stU,
+                         T                           dV,
+                         const int                   ldv,
+                         const int                   stV,
+                         T                           dWork,
+                         const int                   lwork,
+                         U                           dinfo,
+                         const hipsolverGesvdjInfo_t params,
+                         const int                   bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           nullptr,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           dinfo,
+                                           params,
+                                           bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           hipsolverEigMode_t(-1),
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           dinfo,
+                                           params,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           (T) nullptr,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           dinfo,
+                                           params,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           (S) nullptr,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           dinfo,
+                                           params,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           (T) nullptr,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           dinfo,
+                                           params,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           (T) nullptr,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           dinfo,
+                                           params,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           (U) nullptr,
+                                           params,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                           STRIDED,
+                                           handle,
+                                           jobz,
+                                           econ,
+                                           m,
+                                           n,
+                                           dA,
+                                           lda,
+                                           stA,
+                                           dS,
+                                           stS,
+                                           dU,
+                                           ldu,
+                                           stU,
+                                           dV,
+                                           ldv,
+                                           stV,
+                                           dWork,
+                                           lwork,
+                                           dinfo,
+                                           nullptr,
+                                           bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
+void testing_gesvdj_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle      handle;
+    hipsolver_local_gesvdj_info params;
+    hipsolverEigMode_t          jobz = HIPSOLVER_EIG_MODE_VECTOR;
+    int                         econ = 0;
+    int                         m    = 2;
+    int                         n    = 2;
+    int                         lda  = 2;
+    int                         ldu  = 2;
+    int                         ldv  = 2;
+    int                         stA  = 4;
+    int                         stS  = 2;
+    int                         stU  = 4;
+    int                         stV  = 4;
+    int                         bc   = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<S>   dS(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dU(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dV(1, 1, 1, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int size_W;
+    hipsolver_gesvdj_bufferSize(FORTRAN,
+                                STRIDED,
+                                handle,
+                                jobz,
+                                econ,
+                                m,
+                                n,
+                                dA.data(),
+                                lda,
+                                stA,
+                                dS.data(),
+                                stS,
+                                dU.data(),
+                                ldu,
+                                stU,
+                                dV.data(),
+                                ldv,
+                                stV,
+                                &size_W,
+                                params,
+                                bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gesvdj_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                          jobz,
+                                          econ,
+                                          m,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          stA,
+                                          dS.data(),
+                                          stS,
+                                          dU.data(),
+                                          ldu,
+                                          stU,
+                                          dV.data(),
+                                          ldv,
+                                          stV,
+                                          dWork.data(),
+                                          size_W,
+                                          dinfo.data(),
+                                          params,
+                                          bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesvdj_initData(const hipsolverHandle_t  handle,
+                     const hipsolverEigMode_t jobz,
+                     const int                m,
+                     const int                n,
+                     Td&                      dA,
+                     const int                lda,
+                     const int                bc,
+                     Th&                      hA,
+                     std::vector<T>&          A,
+                     bool                     test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(int i = 0; i < m; i++)
+            {
+                for(int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // make copy of original data to test vectors if required
+            if(test && jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            {
+                for(int i = 0; i < m; i++)
+                {
+                    for(int j = 0; j < n; j++)
+                        A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Sd,
+          typename Id,
+          typename Th,
+          typename Sh,
+          typename Ih>
+void gesvdj_getError(const hipsolverHandle_t     handle,
+                     const hipsolverEigMode_t    jobz,
+                     const int                   econ,
+                     const int                   m,
+                     const int                   n,
+                     Td&                         dA,
+                     const int                   lda,
+                     const int                   stA,
+                     Sd&                         dS,
+                     const int                   stS,
+                     Td&                         dU,
+                     const int                   ldu,
+                     const int                   stU,
+                     Td&                         dV,
+                     const int                   ldv,
+                     const int                   stV,
+                     Td&                         dWork,
+                     const int                   lwork,
+                     Id&                         dinfo,
+                     const hipsolverGesvdjInfo_t params,
+                     const int                   bc,
+                     Th&                         hA,
+                     Sh&                         hS,
+                     Sh&                         hSres,
+                     Th&                         Ures,
+                     Th&                         Vres,
+                     Ih&                         hinfo,
+                     Ih&                         hinfoRes,
+                     double*                     max_err,
+                     double*                     max_errv)
+{
+    using S = decltype(std::real(T{}));
+
+    int            size_W = 5 * max(m, n);
+    std::vector<T> hWork(size_W);
+    std::vector<S> hE(5 * max(m, n));
+    std::vector<T> hU(1), hV(1);
+    std::vector<T> A(lda * n * bc);
+
+    // input data initialization
+    gesvdj_initData<true, true, T>(handle, jobz, m, n, dA, lda, bc, hA, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gesvdj(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         jobz,
+                                         econ,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dS.data(),
+                                         stS,
+                                         dU.data(),
+                                         ldu,
+                                         stU,
+                                         dV.data(),
+                                         ldv,
+                                         stV,
+                                         dWork.data(),
+                                         lwork,
+                                         dinfo.data(),
+                                         params,
+                                         bc));
+
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+    {
+        CHECK_HIP_ERROR(Ures.transfer_from(dU));
+        CHECK_HIP_ERROR(Vres.transfer_from(dV));
+    }
+
+    // CPU lapack
+    // (only the singular values are compared with LAPACK; the singular vectors are checked
+    // implicitly below)
+#pragma omp parallel for if(bc > 1) firstprivate(hWork, hE, hU, hV)
+    for(int b = 0; b < bc; ++b)
+        cblas_gesvd<T>('N',
+                       'N',
+                       m,
+                       n,
+                       hA[b],
+                       lda,
+                       hS[b],
+                       hU.data(),
+                       1,
+                       hV.data(),
+                       1,
+                       hWork.data(),
+                       size_W,
+                       hE.data(),
+                       hinfo[b]);
+
+    // Check info for non-convergence
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+
+    double err;
+    *max_errv = 0;
+
+    for(int b = 0; b < bc; ++b)
+    {
+        // error is ||hS - hSres||
+        err      = norm_error('F', 1, min(m, n), 1, hS[b], hSres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // Check the singular vectors if required
+        if(hinfoRes[b][0] == 0 && jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        {
+            err = 0;
+            // check singular vectors implicitly (A*v_k = s_k*u_k)
+            // V is returned without being transposed
+            for(int k = 0; k < min(m, n); ++k)
+            {
+                for(int i = 0; i < m; ++i)
+                {
+                    T tmp = 0;
+                    for(int j = 0; j < n; ++j)
+                        tmp += A[b * lda * n + i + j * lda] * Vres[b][j + k * ldv];
+                    tmp -= hSres[b][k] * Ures[b][i + k * ldu];
+                    err += std::abs(tmp) * std::abs(tmp);
+                }
+            }
+            err       = std::sqrt(err) / double(snorm('F', m, n, A.data() + b * lda * n, lda));
+            *max_errv = err > *max_errv ? err : *max_errv;
+        }
+    }
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Sd,
+          typename Id,
+          typename Th,
+          typename Sh,
+          typename Ih>
+void gesvdj_getPerfData(const hipsolverHandle_t     handle,
+                        const hipsolverEigMode_t    jobz,
+                        const int                   econ,
+                        const int                   m,
+                        const int                   n,
+                        Td&                         dA,
+                        const int                   lda,
+                        const int                   stA,
+                        Sd&                         dS,
+                        const int                   stS,
+                        Td&                         dU,
+                        const int                   ldu,
+                        const int                   stU,
+                        Td&                         dV,
+                        const int                   ldv,
+                        const int                   stV,
+                        Td&                         dWork,
+                        const int                   lwork,
+                        Id&                         dinfo,
+                        const hipsolverGesvdjInfo_t params,
+                        const int                   bc,
+                        Th&                         hA,
+                        Sh&                         hS,
+                        Th&                         hU,
+                        Th&                         hV,
+                        Ih&                         hinfo,
+                        double*                     gpu_time_used,
+                        double*                     cpu_time_used,
+                        const int                   hot_calls,
+                        const bool                  perf)
+{
+    using S = decltype(std::real(T{}));
+
+    char svect = 'N';
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        svect = econ ? 'S' : 'A';
+
+    int            size_W = 5 * max(m, n);
+    std::vector<T> hWork(size_W);
+    std::vector<S> hE(5 * max(m, n));
+    std::vector<T> A;
+
+    if(!perf)
+    {
+        gesvdj_initData<true, false, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+            cblas_gesvd<T>(svect,
+                           svect,
+                           m,
+                           n,
+                           hA[b],
+                           lda,
+                           hS[b],
+                           hU[b],
+                           ldu,
+                           hV[b],
+                           ldv,
+                           hWork.data(),
+                           size_W,
+                           hE.data(),
+                           hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesvdj_initData<true, false, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvdj_initData<false, true, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gesvdj(FORTRAN,
+                                             STRIDED,
+                                             handle,
+                                             jobz,
+                                             econ,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dS.data(),
+                                             stS,
+                                             dU.data(),
+                                             ldu,
+                                             stU,
+                                             dV.data(),
+                                             ldv,
+                                             stV,
+                                             dWork.data(),
+                                             lwork,
+                                             dinfo.data(),
+                                             params,
+                                             bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvdj_initData<false, true, T>(handle, jobz, m, n, dA, lda, bc, hA, A, 0);
+
+        timer.start();
+        hipsolver_gesvdj(FORTRAN,
+                         STRIDED,
+                         handle,
+                         jobz,
+                         econ,
+                         m,
+                         n,
+                         dA.data(),
+                         lda,
+                         stA,
+                         dS.data(),
+                         stS,
+                         dU.data(),
+                         ldu,
+                         stU,
+                         dV.data(),
+                         ldv,
+                         stV,
+                         dWork.data(),
+                         lwork,
+                         dinfo.data(),
+                         params,
+                         bc);
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
+void testing_gesvdj(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle      handle;
+    hipsolver_local_gesvdj_info params;
+    char                        jobzC      = argus.get<char>("jobz");
+    int                         econ       = argus.get<int>("econ", 0);
+    int                         m          = argus.get<int>("m");
+    int                         n          = argus.get<int>("n", m);
+    int                         lda        = argus.get<int>("lda", m);
+    int                         ldu        = argus.get<int>("ldu", m);
+    int                         ldv        = argus.get<int>("ldv", n);
+    int                         max_sweeps = argus.get<int>("max_sweeps", 100);
+    double                      tolerance  = argus.get<double>("tolerance", 0);
+
+    // the batched functions always compute all the singular vectors
+    if(STRIDED)
+        econ = 0;
+
+    hipsolverEigMode_t jobz  = char2hipsolver_evect(jobzC);
+    int                ucols = econ ? min(m, n) : m;
+    int                vcols = econ ? min(m, n) : n;
+
+    // the strides of the batched functions are implied by the sizes
+    int stA = argus.get<int>("strideA", lda * n);
+    int stS = argus.get<int>("strideS", min(m, n));
+    int stU = argus.get<int>("strideU", ldu * m);
+    int stV = argus.get<int>("strideV", ldv * n);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_S    = size_t(min(m, n));
+    size_t size_U    = size_t(ldu) * ucols;
+    size_t size_V    = size_t(ldv) * vcols;
+    size_t size_Sres = (argus.unit_check || argus.norm_check) ? size_S : 0;
+    size_t size_Ures = (argus.unit_check || argus.norm_check) ? size_U : 0;
+    size_t size_Vres = (argus.unit_check || argus.norm_check) ? size_V : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || m < 0 || lda < m || ldu < 1 || ldv < 1 || bc < 0)
+                        || (jobz == HIPSOLVER_EIG_MODE_VECTOR && (ldu < m || ldv < n));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(FORTRAN,
+                                               STRIDED,
+                                               handle,
+                                               jobz,
+                                               econ,
+                                               m,
+                                               n,
+                                               (T*)nullptr,
+                                               lda,
+                                               stA,
+                                               (S*)nullptr,
+                                               stS,
+                                               (T*)nullptr,
+                                               ldu,
+                                               stU,
+                                               (T*)nullptr,
+                                               ldv,
+                                               stV,
+                                               (T*)nullptr,
+                                               0,
+                                               (int*)nullptr,
+                                               params,
+                                               bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    CHECK_ROCBLAS_ERROR(hipsolverXgesvdjSetMaxSweeps(params, max_sweeps));
+    CHECK_ROCBLAS_ERROR(hipsolverXgesvdjSetTolerance(params, tolerance));
+
+    // memory allocations
+    // host
+    host_strided_batch_vector<T>   hA(size_A, 1, stA, bc);
+    host_strided_batch_vector<S>   hS(size_S, 1, stS, bc);
+    host_strided_batch_vector<T>   hU(size_U, 1, stU, bc);
+    host_strided_batch_vector<T>   hV(size_V, 1, stV, bc);
+    host_strided_batch_vector<int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<S>   hSres(size_Sres, 1, stS, bc);
+    host_strided_batch_vector<T>   Ures(size_Ures, 1, stU, bc);
+    host_strided_batch_vector<T>   Vres(size_Vres, 1, stV, bc);
+    host_strided_batch_vector<int> hinfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+    device_strided_batch_vector<S>   dS(size_S, 1, stS, bc);
+    device_strided_batch_vector<T>   dU(size_U, 1, stU, bc);
+    device_strided_batch_vector<T>   dV(size_V, 1, stV, bc);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int size_W;
+    hipsolver_gesvdj_bufferSize(FORTRAN,
+                                STRIDED,
+                                handle,
+                                jobz,
+                                econ,
+                                m,
+                                n,
+                                dA.data(),
+                                lda,
+                                stA,
+                                dS.data(),
+                                stS,
+                                dU.data(),
+                                ldu,
+                                stU,
+                                dV.data(),
+                                ldv,
+                                stV,
+                                &size_W,
+                                params,
+                                bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+    {
+        gesvdj_getError<FORTRAN, STRIDED, T>(handle,
+                                             jobz,
+                                             econ,
+                                             m,
+                                             n,
+                                             dA,
+                                             lda,
+                                             stA,
+                                             dS,
+                                             stS,
+                                             dU,
+                                             ldu,
+                                             stU,
+                                             dV,
+                                             ldv,
+                                             stV,
+                                             dWork,
+                                             size_W,
+                                             dinfo,
+                                             params,
+                                             bc,
+                                             hA,
+                                             hS,
+                                             hSres,
+                                             Ures,
+                                             Vres,
+                                             hinfo,
+                                             hinfoRes,
+                                             &max_error,
+                                             &max_errorv);
+    }
+
+    // collect performance data
+    if(argus.timing)
+    {
+        gesvdj_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                jobz,
+                                                econ,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dS,
+                                                stS,
+                                                dU,
+                                                ldu,
+                                                stU,
+                                                dV,
+                                                ldv,
+                                                stV,
+                                                dWork,
+                                                size_W,
+                                                dinfo,
+                                                params,
+                                                bc,
+                                                hA,
+                                                hS,
+                                                hU,
+                                                hV,
+                                                hinfo,
+                                                &gpu_time_used,
+                                                &cpu_time_used,
+                                                hot_calls,
+                                                argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using 2 * min(m, n) * machine_precision as tolerance
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * min(m, n));
+        if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            ROCSOLVER_TEST_CHECK(T, max_errorv, 2 * min(m, n));
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(STRIDED)
+            {
+                rocsolver_bench_output("jobz", "m", "n", "lda", "ldu", "ldv", "batch_c");
+                rocsolver_bench_output(jobzC, m, n, lda, ldu, ldv, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("jobz", "econ", "m", "n", "lda", "ldu", "ldv");
+                rocsolver_bench_output(jobzC, econ, m, n, lda, ldu, ldv);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -2,9 +2,11 @@
  * Copyright 2020-2021 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#pragma once
+
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U, typename V>
+template <bool FORTRAN, bool STRIDED, typename T, typename U, typename V>
 void getrf_checkBadArgs(const hipsolverHandle_t handle,
                         const int               m,
                         const int               n,
@@ -20,16 +22,29 @@ void getrf_checkBadArgs(const hipsolverHandle_t handle,
 {
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_getrf(
-            FORTRAN, false, nullptr, m, n, dA, lda, stA, dWork, lwork, dIpiv, stP, dinfo, bc),
-        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                          STRIDED,
+                                          false,
+                                          nullptr,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dWork,
+                                          lwork,
+                                          dIpiv,
+                                          stP,
+                                          dinfo,
+                                          bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
     // N/A
 
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                          STRIDED,
                                           false,
                                           handle,
                                           m,
@@ -44,10 +59,22 @@ void getrf_checkBadArgs(const hipsolverHandle_t handle,
                                           dinfo,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_getrf(
-            FORTRAN, false, handle, m, n, dA, lda, stA, dWork, lwork, dIpiv, stP, (V) nullptr, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                          STRIDED,
+                                          false,
+                                          handle,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dWork,
+                                          lwork,
+                                          dIpiv,
+                                          stP,
+                                          (V) nullptr,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
@@ -65,23 +92,34 @@ void testing_getrf_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // getrf_checkBadArgs<FORTRAN>(
-        //     handle, m, n, dA.data(), lda, stA, dWork.data(), size_W, dIpiv.data(), stP, dInfo.data(), bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getrf_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dWork.data(),
+                                             size_W,
+                                             dIpiv.data(),
+                                             stP,
+                                             dInfo.data(),
+                                             bc);
     }
     else
     {
@@ -94,24 +132,25 @@ void testing_getrf_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        getrf_checkBadArgs<FORTRAN>(handle,
-                                    m,
-                                    n,
-                                    dA.data(),
-                                    lda,
-                                    stA,
-                                    dWork.data(),
-                                    size_W,
-                                    dIpiv.data(),
-                                    stP,
-                                    dInfo.data(),
-                                    bc);
+        getrf_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             m,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dWork.data(),
+                                             size_W,
+                                             dIpiv.data(),
+                                             stP,
+                                             dInfo.data(),
+                                             bc);
     }
 }
 
@@ -170,14 +209,36 @@ void getrf_initData(const hipsolverHandle_t handle,
     }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <typename T, typename Td>
+void getrf_initDeviceData(const hipsolverHandle_t handle,
+                          const int               m,
+                          const int               n,
+                          Td&                     dA,
+                          const int               lda,
+                          const int               bc)
+{
+    // generate the matrices directly on the device;
+    // the dominant diagonal avoids singularities, and the rows are reversed to test pivoting
+    device_rand_generator rng(handle);
+    for(int b = 0; b < bc; ++b)
+        rocblas_init_device_diag_dominant<T>(rng, dA[b], m, n, lda, 0, 1, true);
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
 void getrf_getError(const hipsolverHandle_t handle,
                     const int               m,
                     const int               n,
                     Td&                     dA,
                     const int               lda,
                     const int               stA,
-                    Td&                     dWork,
+                    Vd&                     dWork,
                     const int               lwork,
                     Ud&                     dIpiv,
                     const int               stP,
@@ -198,6 +259,7 @@ void getrf_getError(const hipsolverHandle_t handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_getrf(FORTRAN,
+                                        STRIDED,
                                         false,
                                         handle,
                                         m,
@@ -216,6 +278,7 @@ void getrf_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1)
     for(int b = 0; b < bc; ++b)
         cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]);
 
@@ -247,26 +310,114 @@ void getrf_getError(const hipsolverHandle_t handle,
     *max_err += err;
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Uh>
+void getrf_getDeviceError(const hipsolverHandle_t handle,
+                          const int               n,
+                          Td&                     dA,
+                          const int               lda,
+                          const int               stA,
+                          Vd&                     dWork,
+                          const int               lwork,
+                          Ud&                     dIpiv,
+                          const int               stP,
+                          Ud&                     dInfo,
+                          const int               bc,
+                          Uh&                     hIpivRes,
+                          Uh&                     hInfoRes,
+                          double*                 max_err)
+{
+    // input data initialization
+    getrf_initDeviceData<T>(handle, n, n, dA, lda, bc);
+
+    // keep the original matrices on the device
+    size_t                         size_A = size_t(lda) * n;
+    device_strided_batch_vector<T> dA0(size_A, 1, size_A, bc);
+    device_strided_batch_vector<T> dTmp(2 * size_t(n) * n, 1, 2 * size_t(n) * n, 1);
+    if(size_A)
+    {
+        CHECK_HIP_ERROR(dA0.memcheck());
+        CHECK_HIP_ERROR(dTmp.memcheck());
+    }
+    for(int b = 0; b < bc; ++b)
+        CHECK_HIP_ERROR(hipMemcpy(dA0[b], dA[b], sizeof(T) * size_A, hipMemcpyDeviceToDevice));
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_getrf(FORTRAN,
+                                        STRIDED,
+                                        false,
+                                        handle,
+                                        n,
+                                        n,
+                                        dA.data(),
+                                        lda,
+                                        stA,
+                                        dWork.data(),
+                                        lwork,
+                                        dIpiv.data(),
+                                        stP,
+                                        dInfo.data(),
+                                        bc));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // expecting original matrix to be non-singular
+    // error is ||PA - LU|| / ||A||, computed on the device
+    // using frobenius norm
+    device_blas_handle blas(handle);
+    double             err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        if(n == 0 || hInfoRes[b][0] != 0)
+            continue;
+        device_getrf_residual<T>(blas, n, dA0[b], lda, dA[b], lda, hIpivRes[b], dTmp.data(), &err);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfoRes[b][0] != 0)
+            err++;
+    *max_err += err;
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
 void getrf_getPerfData(const hipsolverHandle_t handle,
                        const int               m,
                        const int               n,
                        Td&                     dA,
                        const int               lda,
                        const int               stA,
-                       Td&                     dWork,
+                       Vd&                     dWork,
                        const int               lwork,
                        Ud&                     dIpiv,
                        const int               stP,
                        Ud&                     dInfo,
                        const int               bc,
                        Th&                     hA,
+                       Th&                     hARes,
                        Uh&                     hIpiv,
                        Uh&                     hInfo,
                        double*                 gpu_time_used,
                        double*                 cpu_time_used,
                        const int               hot_calls,
-                       const bool              perf)
+                       const bool              perf,
+                       const bool              e2e)
 {
     if(!perf)
     {
@@ -280,16 +431,28 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    getrf_initData<true, false, T>(
-        handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+    // in perf mode, the matrices are generated on the device; in e2e mode, every call copies the
+    // host matrices to the device and the results back
+    if(!perf || e2e)
+        getrf_initData<true, false, T>(
+            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
-        getrf_initData<false, true, T>(
-            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+        if(e2e)
+            CHECK_HIP_ERROR(dA.transfer_from_async(hA, stream));
+        else if(perf)
+            getrf_initDeviceData<T>(handle, m, n, dA, lda, bc);
+        else
+            getrf_initData<false, true, T>(
+                handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrf(FORTRAN,
+                                            STRIDED,
                                             false,
                                             handle,
                                             m,
@@ -303,20 +466,31 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
                                             stP,
                                             dInfo.data(),
                                             bc));
+
+        if(e2e)
+        {
+            CHECK_HIP_ERROR(hARes.transfer_from_async(dA, stream));
+            CHECK_HIP_ERROR(hIpiv.transfer_from_async(dIpiv, stream));
+            CHECK_HIP_ERROR(hInfo.transfer_from_async(dInfo, stream));
+        }
     }
 
     // gpu-lapack performance
-    hipStream_t stream;
-    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
-        getrf_initData<false, true, T>(
-            handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
-
-        start = get_time_us_sync(stream);
+        if(!e2e && perf)
+            getrf_initDeviceData<T>(handle, m, n, dA, lda, bc);
+        else if(!e2e)
+            getrf_initData<false, true, T>(
+                handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA, hIpiv, hInfo);
+
+        timer.start();
+        if(e2e)
+            CHECK_HIP_ERROR(dA.transfer_from_async(hA, stream));
         hipsolver_getrf(FORTRAN,
+                        STRIDED,
                         false,
                         handle,
                         m,
@@ -330,7 +504,15 @@ void getrf_getPerfData(const hipsolverHandle_t handle,
                         stP,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        if(e2e)
+        {
+            CHECK_HIP_ERROR(hARes.transfer_from_async(dA, stream));
+            CHECK_HIP_ERROR(hIpiv.transfer_from_async(dIpiv, stream));
+            CHECK_HIP_ERROR(hInfo.transfer_from_async(dInfo, stream));
+        }
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -346,21 +528,57 @@ void testing_getrf(Arguments& argus)
     int                    stA = argus.get<int>("strideA", lda * n);
     int                    stP = argus.get<int>("strideP", min(m, n));
 
+    // algorithm hints
+    int alg            = argus.get<int>("alg", 0);
+    int pivot          = argus.get<int>("pivot", 1);
+    int unblocked_size = argus.get<int>("unblocked_size", 0);
+
     int bc        = argus.batch_count;
     int hot_calls = argus.iters;
 
-    int stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    // the host matrices are only needed to check the results against the host reference, to
+    // measure the cpu-lapack performance, or to time the host-device copies; otherwise, the input
+    // is generated on the device
+    bool host_check = (argus.unit_check || argus.norm_check) && !(argus.device_verify && m == n);
+    bool host_data  = host_check || (argus.timing && (!argus.perf || argus.e2e));
+    bool host_res   = host_check || (argus.timing && argus.e2e);
+
+    host_memory mem = argus.pinned ? host_memory::pinned : host_memory::pageable;
+
+    int stAh   = host_data ? stA : 0;
+    int stARes = host_res ? stA : 0;
     int stPRes = (argus.unit_check || argus.norm_check) ? stP : 0;
 
     // check non-supported values
-    // N/A
+#if defined(__HIP_PLATFORM_NVCC__) || defined(__HIP_PLATFORM_NVIDIA__)
+    // the batched LU factorization of cuBLAS only supports square matrices
+    if((BATCHED || STRIDED) && m != n && m > 0 && n > 0)
+    {
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+#endif
+
+    // the references pivot, so the results without pivoting cannot be verified
+    if(hipsolver_set_adv_options(handle, HIPSOLVERDN_GETRF, alg, pivot, unblocked_size)
+           != HIPSOLVER_STATUS_SUCCESS
+       || (!pivot && (argus.unit_check || argus.norm_check)))
+    {
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
 
     // determine sizes
     size_t size_A    = size_t(lda) * n;
     size_t size_P    = size_t(min(m, n));
     double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
 
-    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_Ah   = host_data ? size_A : 0;
+    size_t size_ARes = host_res ? size_A : 0;
     size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
 
     // check invalid sizes
@@ -369,25 +587,27 @@ void testing_getrf(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
-            //                                       true,
-            //                                       handle,
-            //                                       m,
-            //                                       n,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       stP,
-            //                                       (int*)nullptr,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                                  STRIDED,
+                                                  true,
+                                                  handle,
+                                                  m,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  stP,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                                  STRIDED,
                                                   true,
                                                   handle,
                                                   m,
@@ -412,78 +632,96 @@ void testing_getrf(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>             hA(size_A, 1, bc);
-        // host_batch_vector<T>             hARes(size_ARes, 1, bc);
-        // host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
-        // host_strided_batch_vector<int>   hIpivRes(size_PRes, 1, stPRes, bc);
-        // host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
-        // host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
-        // device_batch_vector<T>           dA(size_A, 1, bc);
-        // device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-        // if(size_P)
-        //     CHECK_HIP_ERROR(dIpiv.memcheck());
-
-        // int size_W;
-        // hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     getrf_getError<FORTRAN, T>(handle,
-        //                                m,
-        //                                n,
-        //                                dA,
-        //                                lda,
-        //                                stA,
-        //                                dWork,
-        //                                size_W,
-        //                                dIpiv,
-        //                                stP,
-        //                                dInfo,
-        //                                bc,
-        //                                hA,
-        //                                hARes,
-        //                                hIpiv,
-        //                                hIpivRes,
-        //                                hInfo,
-        //                                hInfoRes,
-        //                                &max_error);
-
-        // // collect performance data
-        // if(argus.timing)
-        //     getrf_getPerfData<FORTRAN, T>(handle,
-        //                                   m,
-        //                                   n,
-        //                                   dA,
-        //                                   lda,
-        //                                   stA,
-        //                                   dWork,
-        //                                   size_W,
-        //                                   dIpiv,
-        //                                   stP,
-        //                                   dInfo,
-        //                                   bc,
-        //                                   hA,
-        //                                   hIpiv,
-        //                                   hInfo,
-        //                                   &gpu_time_used,
-        //                                   &cpu_time_used,
-        //                                   hot_calls,
-        //                                   argus.perf);
+        // memory allocations
+        host_batch_vector<T>             hA(size_Ah, 1, bc, mem);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc, mem);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hIpivRes(size_PRes, 1, stPRes, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        int size_W;
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if((argus.unit_check || argus.norm_check) && argus.device_verify && m == n)
+            getrf_getDeviceError<FORTRAN, STRIDED, T>(handle,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dWork,
+                                                      size_W,
+                                                      dIpiv,
+                                                      stP,
+                                                      dInfo,
+                                                      bc,
+                                                      hIpivRes,
+                                                      hInfoRes,
+                                                      &max_error);
+        else if(argus.unit_check || argus.norm_check)
+            getrf_getError<FORTRAN, STRIDED, T>(handle,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dWork,
+                                                size_W,
+                                                dIpiv,
+                                                stP,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hARes,
+                                                hIpiv,
+                                                hIpivRes,
+                                                hInfo,
+                                                hInfoRes,
+                                                &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dWork,
+                                                   size_W,
+                                                   dIpiv,
+                                                   stP,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hARes,
+                                                   hIpiv,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf,
+                                                   argus.e2e);
     }
 
     else
     {
         // memory allocations
-        host_strided_batch_vector<T>     hA(size_A, 1, stA, bc);
-        host_strided_batch_vector<T>     hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T>     hA(size_Ah, 1, stAh, bc, mem);
+        host_strided_batch_vector<T>     hARes(size_ARes, 1, stARes, bc, mem);
         host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
         host_strided_batch_vector<int>   hIpivRes(size_PRes, 1, stPRes, bc);
         host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
@@ -498,54 +736,72 @@ void testing_getrf(Arguments& argus)
             CHECK_HIP_ERROR(dIpiv.memcheck());
 
         int size_W;
-        hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
-        if(argus.unit_check || argus.norm_check)
-            getrf_getError<FORTRAN, T>(handle,
-                                       m,
-                                       n,
-                                       dA,
-                                       lda,
-                                       stA,
-                                       dWork,
-                                       size_W,
-                                       dIpiv,
-                                       stP,
-                                       dInfo,
-                                       bc,
-                                       hA,
-                                       hARes,
-                                       hIpiv,
-                                       hIpivRes,
-                                       hInfo,
-                                       hInfoRes,
-                                       &max_error);
+        if((argus.unit_check || argus.norm_check) && argus.device_verify && m == n)
+            getrf_getDeviceError<FORTRAN, STRIDED, T>(handle,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dWork,
+                                                      size_W,
+                                                      dIpiv,
+                                                      stP,
+                                                      dInfo,
+                                                      bc,
+                                                      hIpivRes,
+                                                      hInfoRes,
+                                                      &max_error);
+        else if(argus.unit_check || argus.norm_check)
+            getrf_getError<FORTRAN, STRIDED, T>(handle,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dWork,
+                                                size_W,
+                                                dIpiv,
+                                                stP,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hARes,
+                                                hIpiv,
+                                                hIpivRes,
+                                                hInfo,
+                                                hInfoRes,
+                                                &max_error);
 
         // collect performance data
         if(argus.timing)
-            getrf_getPerfData<FORTRAN, T>(handle,
-                                          m,
-                                          n,
-                                          dA,
-                                          lda,
-                                          stA,
-                                          dWork,
-                                          size_W,
-                                          dIpiv,
-                                          stP,
-                                          dInfo,
-                                          bc,
-                                          hA,
-                                          hIpiv,
-                                          hInfo,
-                                          &gpu_time_used,
-                                          &cpu_time_used,
-                                          hot_calls,
-                                          argus.perf);
+            getrf_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dWork,
+                                                   size_W,
+                                                   dIpiv,
+                                                   stP,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hARes,
+                                                   hIpiv,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf,
+                                                   argus.e2e);
     }
 
     // validate results for rocsolver-test
@@ -2,9 +2,11 @@
  * Copyright 2020-2021 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
+#pragma once
+
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U, typename V>
+template <bool FORTRAN, bool STRIDED, typename T, typename U, typename V>
 void getrf_npvt_checkBadArgs(const hipsolverHandle_t handle,
                              const int               m,
                              const int               n,
@@ -20,16 +22,29 @@ void getrf_npvt_checkBadArgs(const hipsolverHandle_t handle,
 {
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_getrf(
-            FORTRAN, true, nullptr, m, n, dA, lda, stA, dWork, lwork, dIpiv, stP, dinfo, bc),
-        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                          STRIDED,
+                                          true,
+                                          nullptr,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dWork,
+                                          lwork,
+                                          dIpiv,
+                                          stP,
+                                          dinfo,
+                                          bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
     // N/A
 
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                          STRIDED,
                                           true,
                                           handle,
                                           m,
@@ -44,10 +59,22 @@ void getrf_npvt_checkBadArgs(const hipsolverHandle_t handle,
                                           dinfo,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_getrf(
-            FORTRAN, true, handle, m, n, dA, lda, stA, dWork, lwork, dIpiv, stP, (V) nullptr, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                          STRIDED,
+                                          true,
+                                          handle,
+                                          m,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dWork,
+                                          lwork,
+                                          dIpiv,
+                                          stP,
+                                          (V) nullptr,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
@@ -65,23 +92,34 @@ void testing_getrf_npvt_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // getrf_npvt_checkBadArgs<FORTRAN>(
-        //     handle, m, n, dA.data(), lda, stA, dWork.data(), size_W, dIpiv.data(), stP, dInfo.data(), bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getrf_npvt_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                  m,
+                                                  n,
+                                                  dA.data(),
+                                                  lda,
+                                                  stA,
+                                                  dWork.data(),
+                                                  size_W,
+                                                  dIpiv.data(),
+                                                  stP,
+                                                  dInfo.data(),
+                                                  bc);
     }
     else
     {
@@ -94,24 +132,25 @@ void testing_getrf_npvt_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        getrf_npvt_checkBadArgs<FORTRAN>(handle,
-                                         m,
-                                         n,
-                                         dA.data(),
-                                         lda,
-                                         stA,
-                                         dWork.data(),
-                                         size_W,
-                                         dIpiv.data(),
-                                         stP,
-                                         dInfo.data(),
-                                         bc);
+        getrf_npvt_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                  m,
+                                                  n,
+                                                  dA.data(),
+                                                  lda,
+                                                  stA,
+                                                  dWork.data(),
+                                                  size_W,
+                                                  dIpiv.data(),
+                                                  stP,
+                                                  dInfo.data(),
+                                                  bc);
     }
 }
 
@@ -155,14 +194,21 @@ void getrf_npvt_initData(const hipsolverHandle_t handle,
     }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
 void getrf_npvt_getError(const hipsolverHandle_t handle,
                          const int               m,
                          const int               n,
                          Td&                     dA,
                          const int               lda,
                          const int               stA,
-                         Td&                     dWork,
+                         Vd&                     dWork,
                          const int               lwork,
                          Ud&                     dInfo,
                          const int               bc,
@@ -179,6 +225,7 @@ void getrf_npvt_getError(const hipsolverHandle_t handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_getrf(FORTRAN,
+                                        STRIDED,
                                         true,
                                         handle,
                                         m,
@@ -196,6 +243,7 @@ void getrf_npvt_getError(const hipsolverHandle_t handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1)
     for(int b = 0; b < bc; ++b)
         cblas_getrf<T>(m, n, hA[b], lda, hIpiv[b], hInfo[b]);
 
@@ -220,14 +268,21 @@ void getrf_npvt_getError(const hipsolverHandle_t handle,
     *max_err += err;
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
 void getrf_npvt_getPerfData(const hipsolverHandle_t handle,
                             const int               m,
                             const int               n,
                             Td&                     dA,
                             const int               lda,
                             const int               stA,
-                            Td&                     dWork,
+                            Vd&                     dWork,
                             const int               lwork,
                             Ud&                     dInfo,
                             const int               bc,
@@ -258,6 +313,7 @@ void getrf_npvt_getPerfData(const hipsolverHandle_t handle,
         getrf_npvt_initData<false, true, T>(handle, m, n, dA, lda, stA, dInfo, bc, hA, hInfo);
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrf(FORTRAN,
+                                            STRIDED,
                                             true,
                                             handle,
                                             m,
@@ -276,14 +332,15 @@ void getrf_npvt_getPerfData(const hipsolverHandle_t handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         getrf_npvt_initData<false, true, T>(handle, m, n, dA, lda, stA, dInfo, bc, hA, hInfo);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_getrf(FORTRAN,
+                        STRIDED,
                         true,
                         handle,
                         m,
@@ -297,7 +354,9 @@ void getrf_npvt_getPerfData(const hipsolverHandle_t handle,
                         0,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -319,7 +378,16 @@ void testing_getrf_npvt(Arguments& argus)
     int stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
 
     // check non-supported values
-    // N/A
+#if defined(__HIP_PLATFORM_NVCC__) || defined(__HIP_PLATFORM_NVIDIA__)
+    // the batched LU factorization of cuBLAS only supports square matrices
+    if((BATCHED || STRIDED) && m != n && m > 0 && n > 0)
+    {
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+#endif
 
     // determine sizes
     size_t size_A    = size_t(lda) * n;
@@ -334,25 +402,27 @@ void testing_getrf_npvt(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
-            //                                       true,
-            //                                       handle,
-            //                                       m,
-            //                                       n,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                                  STRIDED,
+                                                  true,
+                                                  handle,
+                                                  m,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_getrf(FORTRAN,
+                                                  STRIDED,
                                                   true,
                                                   handle,
                                                   m,
@@ -377,62 +447,63 @@ void testing_getrf_npvt(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>             hA(size_A, 1, bc);
-        // host_batch_vector<T>             hARes(size_ARes, 1, bc);
-        // host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
-        // host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
-        // host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
-        // device_batch_vector<T>           dA(size_A, 1, bc);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     getrf_npvt_getError<FORTRAN, T>(handle,
-        //                                     m,
-        //                                     n,
-        //                                     dA,
-        //                                     lda,
-        //                                     stA,
-        //                                     dWork,
-        //                                     size_W,
-        //                                     dInfo,
-        //                                     bc,
-        //                                     hA,
-        //                                     hARes,
-        //                                     hIpiv,
-        //                                     hInfo,
-        //                                     hInfoRes,
-        //                                     &max_error);
-
-        // // collect performance data
-        // if(argus.timing)
-        //     getrf_npvt_getPerfData<FORTRAN, T>(handle,
-        //                                        m,
-        //                                        n,
-        //                                        dA,
-        //                                        lda,
-        //                                        stA,
-        //                                        dWork,
-        //                                        size_W,
-        //                                        dInfo,
-        //                                        bc,
-        //                                        hA,
-        //                                        hIpiv,
-        //                                        hInfo,
-        //                                        &gpu_time_used,
-        //                                        &cpu_time_used,
-        //                                        hot_calls,
-        //                                        argus.perf);
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_npvt_getError<FORTRAN, STRIDED, T>(handle,
+                                                     m,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dWork,
+                                                     size_W,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hARes,
+                                                     hIpiv,
+                                                     hInfo,
+                                                     hInfoRes,
+                                                     &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_npvt_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                        m,
+                                                        n,
+                                                        dA,
+                                                        lda,
+                                                        stA,
+                                                        dWork,
+                                                        size_W,
+                                                        dInfo,
+                                                        bc,
+                                                        hA,
+                                                        hIpiv,
+                                                        hInfo,
+                                                        &gpu_time_used,
+                                                        &cpu_time_used,
+                                                        hot_calls,
+                                                        argus.perf);
     }
 
     else
@@ -450,49 +521,50 @@ void testing_getrf_npvt(Arguments& argus)
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_getrf_bufferSize(FORTRAN, handle, m, n, dA.data(), lda, &size_W);
+        hipsolver_getrf_bufferSize(
+            FORTRAN, STRIDED, handle, m, n, dA.data(), lda, stA, &size_W, bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            getrf_npvt_getError<FORTRAN, T>(handle,
-                                            m,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dWork,
-                                            size_W,
-                                            dInfo,
-                                            bc,
-                                            hA,
-                                            hARes,
-                                            hIpiv,
-                                            hInfo,
-                                            hInfoRes,
-                                            &max_error);
+            getrf_npvt_getError<FORTRAN, STRIDED, T>(handle,
+                                                     m,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dWork,
+                                                     size_W,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hARes,
+                                                     hIpiv,
+                                                     hInfo,
+                                                     hInfoRes,
+                                                     &max_error);
 
         // collect performance data
         if(argus.timing)
-            getrf_npvt_getPerfData<FORTRAN, T>(handle,
-                                               m,
-                                               n,
-                                               dA,
-                                               lda,
-                                               stA,
-                                               dWork,
-                                               size_W,
-                                               dInfo,
-                                               bc,
-                                               hA,
-                                               hIpiv,
-                                               hInfo,
-                                               &gpu_time_used,
-                                               &cpu_time_used,
-                                               hot_calls,
-                                               argus.perf);
+            getrf_npvt_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                        m,
+                                                        n,
+                                                        dA,
+                                                        lda,
+                                                        stA,
+                                                        dWork,
+                                                        size_W,
+                                                        dInfo,
+                                                        bc,
+                                                        hA,
+                                                        hIpiv,
+                                                        hInfo,
+                                                        &gpu_time_used,
+                                                        &cpu_time_used,
+                                                        hot_calls,
+                                                        argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -0,0 +1,750 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, bool STRIDED, typename T, typename U, typename V>
+void getri_checkBadArgs(const hipsolverHandle_t handle,
+                        const int               n,
+                        T                       dA,
+                        const int               lda,
+                        const int               stA,
+                        U                       dIpiv,
+                        const int               stP,
+                        T                       dC,
+                        const int               ldc,
+                        const int               stC,
+                        V                       dWork,
+                        const int               lwork,
+                        U                       dInfo,
+                        const int               bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(FORTRAN,
+                                          STRIDED,
+                                          nullptr,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    // N/A
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(FORTRAN,
+                                          STRIDED,
+                                          handle,
+                                          n,
+                                          (T) nullptr,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(FORTRAN,
+                                          STRIDED,
+                                          handle,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          (U) nullptr,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
+void testing_getri_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    n   = 1;
+    int                    lda = 1;
+    int                    ldc = 1;
+    int                    stA = 1;
+    int                    stP = 1;
+    int                    stC = 1;
+    int                    bc  = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_batch_vector<T>           dC(1, 1, 1);
+        device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getri_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dC.data(),
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getri_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dIpiv.data(),
+                                             stP,
+                                             dC.data(),
+                                             ldc,
+                                             stC,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dC(1, 1, 1, 1);
+        device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getri_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dC.data(),
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getri_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             n,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dIpiv.data(),
+                                             stP,
+                                             dC.data(),
+                                             ldc,
+                                             stC,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getri_initData(const hipsolverHandle_t handle,
+                    const int               n,
+                    Td&                     dA,
+                    const int               lda,
+                    const int               stA,
+                    Ud&                     dIpiv,
+                    const int               stP,
+                    const int               bc,
+                    Th&                     hA,
+                    Uh&                     hIpiv)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(int b = 0; b < bc; ++b)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                for(int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+
+        // do the LU decomposition of matrix A w/ the reference LAPACK routine
+        for(int b = 0; b < bc; ++b)
+        {
+            int info;
+            cblas_getrf<T>(n, n, hA[b], lda, hIpiv[b], &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    }
+}
+
+template <bool FORTRAN,
+          bool BATCHED,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void getri_getError(const hipsolverHandle_t handle,
+                    const int               n,
+                    Td&                     dA,
+                    const int               lda,
+                    const int               stA,
+                    Ud&                     dIpiv,
+                    const int               stP,
+                    Td&                     dC,
+                    const int               ldc,
+                    const int               stC,
+                    Vd&                     dWork,
+                    const int               lwork,
+                    Ud&                     dInfo,
+                    const int               bc,
+                    Th&                     hA,
+                    Uh&                     hIpiv,
+                    Th&                     hCRes,
+                    Uh&                     hInfo,
+                    double*                 max_err)
+{
+    // the inverse overwrites A unless it is computed out of place
+    const bool inplace = !BATCHED && !STRIDED;
+    const int  ldr     = inplace ? lda : ldc;
+
+    int            size_W = std::max(1, 64 * n);
+    std::vector<T> hW(size_W);
+
+    // input data initialization
+    getri_initData<true, true, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_getri(FORTRAN,
+                                        STRIDED,
+                                        handle,
+                                        n,
+                                        dA.data(),
+                                        lda,
+                                        stA,
+                                        dIpiv.data(),
+                                        stP,
+                                        dC.data(),
+                                        ldc,
+                                        stC,
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data(),
+                                        bc));
+    if(inplace)
+        CHECK_HIP_ERROR(hCRes.transfer_from(dA));
+    else
+        CHECK_HIP_ERROR(hCRes.transfer_from(dC));
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+    // CPU lapack
+#pragma omp parallel for if(bc > 1) firstprivate(hW)
+    for(int b = 0; b < bc; ++b)
+    {
+        int info;
+        cblas_getri<T>(n, hA[b], lda, hIpiv[b], hW.data(), size_W, &info);
+    }
+
+    // error is ||hA - hCRes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double         err;
+    std::vector<T> hG(size_t(ldr) * n);
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        // the reference inverse is laid out with the leading dimension of the result
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                hG[i + size_t(j) * ldr] = hA[b][i + j * lda];
+
+        err      = norm_error('F', n, n, ldr, hG.data(), hCRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfo[b][0] != 0)
+            err++;
+    *max_err += err;
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void getri_getPerfData(const hipsolverHandle_t handle,
+                       const int               n,
+                       Td&                     dA,
+                       const int               lda,
+                       const int               stA,
+                       Ud&                     dIpiv,
+                       const int               stP,
+                       Td&                     dC,
+                       const int               ldc,
+                       const int               stC,
+                       Vd&                     dWork,
+                       const int               lwork,
+                       Ud&                     dInfo,
+                       const int               bc,
+                       Th&                     hA,
+                       Uh&                     hIpiv,
+                       Uh&                     hInfo,
+                       double*                 gpu_time_used,
+                       double*                 cpu_time_used,
+                       const int               hot_calls,
+                       const bool              perf)
+{
+    int            size_W = std::max(1, 64 * n);
+    std::vector<T> hW(size_W);
+
+    if(!perf)
+    {
+        getri_initData<true, false, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+        {
+            int info;
+            cblas_getri<T>(n, hA[b], lda, hIpiv[b], hW.data(), size_W, &info);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getri_initData<true, false, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getri_initData<false, true, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getri(FORTRAN,
+                                            STRIDED,
+                                            handle,
+                                            n,
+                                            dA.data(),
+                                            lda,
+                                            stA,
+                                            dIpiv.data(),
+                                            stP,
+                                            dC.data(),
+                                            ldc,
+                                            stC,
+                                            dWork.data(),
+                                            lwork,
+                                            dInfo.data(),
+                                            bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        getri_initData<false, true, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+        timer.start();
+        hipsolver_getri(FORTRAN,
+                        STRIDED,
+                        handle,
+                        n,
+                        dA.data(),
+                        lda,
+                        stA,
+                        dIpiv.data(),
+                        stP,
+                        dC.data(),
+                        ldc,
+                        stC,
+                        dWork.data(),
+                        lwork,
+                        dInfo.data(),
+                        bc);
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
+void testing_getri(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    n   = argus.get<int>("n");
+    int                    lda = argus.get<int>("lda", n);
+    int                    ldc = argus.get<int>("ldc", n);
+    int                    stA = argus.get<int>("strideA", lda * n);
+    int                    stP = argus.get<int>("strideP", n);
+    int                    stC = argus.get<int>("strideC", ldc * n);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // the inverse overwrites A unless it is computed out of place
+    bool inplace = !BATCHED && !STRIDED;
+    int  stCRes  = (argus.unit_check || argus.norm_check) ? (inplace ? stA : stC) : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_C    = inplace ? 0 : size_t(ldc) * n;
+    size_t size_P    = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_CRes = (argus.unit_check || argus.norm_check) ? (inplace ? size_A : size_C) : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || (!inplace && ldc < n) || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_getri(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (int*)nullptr,
+                                                  stP,
+                                                  (T**)nullptr,
+                                                  ldc,
+                                                  stC,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_getri(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  n,
+                                                  (T*)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (int*)nullptr,
+                                                  stP,
+                                                  (T*)nullptr,
+                                                  ldc,
+                                                  stC,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hCRes(size_CRes, 1, bc);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_batch_vector<T>           dC(size_C, 1, bc);
+        device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getri_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dC.data(),
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getri_getError<FORTRAN, BATCHED, STRIDED, T>(handle,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dC,
+                                                         ldc,
+                                                         stC,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hCRes,
+                                                         hInfo,
+                                                         &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getri_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dIpiv,
+                                                   stP,
+                                                   dC,
+                                                   ldc,
+                                                   stC,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hIpiv,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T>     hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>     hCRes(size_CRes, 1, stCRes, bc);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T>   dC(size_C, 1, stC, bc);
+        device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getri_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dC.data(),
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getri_getError<FORTRAN, BATCHED, STRIDED, T>(handle,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dC,
+                                                         ldc,
+                                                         stC,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hCRes,
+                                                         hInfo,
+                                                         &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getri_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dIpiv,
+                                                   stP,
+                                                   dC,
+                                                   ldc,
+                                                   stC,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hIpiv,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("n", "lda", "strideP", "ldc", "batch_c");
+                rocsolver_bench_output(n, lda, stP, ldc, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output(
+                    "n", "lda", "strideA", "strideP", "ldc", "strideC", "batch_c");
+                rocsolver_bench_output(n, lda, stA, stP, ldc, stC, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "lda");
+                rocsolver_bench_output(n, lda);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
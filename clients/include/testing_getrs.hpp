@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U>
+template <bool FORTRAN, bool STRIDED, typename T, typename U, typename V>
 void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                         const hipsolverOperation_t trans,
                         const int                  m,
@@ -19,13 +19,14 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                         T                          dB,
                         const int                  ldb,
                         const int                  stB,
-                        T                          dWork,
+                        V                          dWork,
                         const int                  lwork,
                         U                          dInfo,
                         const int                  bc)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
+                                          STRIDED,
                                           nullptr,
                                           trans,
                                           m,
@@ -46,6 +47,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           hipsolverOperation_t(-1),
                                           m,
@@ -67,6 +69,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           trans,
                                           m,
@@ -85,6 +88,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           trans,
                                           m,
@@ -103,6 +107,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
+                                          STRIDED,
                                           handle,
                                           trans,
                                           m,
@@ -140,37 +145,54 @@ void testing_getrs_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_batch_vector<T>           dB(1, 1, 1);
-        // device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dB.memcheck());
-        // CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_getrs_bufferSize(FORTRAN, handle, trans, m, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // getrs_checkBadArgs<FORTRAN>(handle,
-        //                             trans,
-        //                             m,
-        //                             nrhs,
-        //                             dA.data(),
-        //                             lda,
-        //                             stA,
-        //                             dIpiv.data(),
-        //                             stP,
-        //                             dB.data(),
-        //                             ldb,
-        //                             stB,
-        //                             dInfo.data(),
-        //                             bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_batch_vector<T>           dB(1, 1, 1);
+        device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getrs_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   trans,
+                                   m,
+                                   nrhs,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dB.data(),
+                                   ldb,
+                                   stB,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getrs_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             trans,
+                                             m,
+                                             nrhs,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dIpiv.data(),
+                                             stP,
+                                             dB.data(),
+                                             ldb,
+                                             stB,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
     }
     else
     {
@@ -185,29 +207,43 @@ void testing_getrs_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_getrs_bufferSize(
-            FORTRAN, handle, trans, m, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, &size_W);
+        hipsolver_getrs_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   trans,
+                                   m,
+                                   nrhs,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dB.data(),
+                                   ldb,
+                                   stB,
+                                   &size_W,
+                                   bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        getrs_checkBadArgs<FORTRAN>(handle,
-                                    trans,
-                                    m,
-                                    nrhs,
-                                    dA.data(),
-                                    lda,
-                                    stA,
-                                    dIpiv.data(),
-                                    stP,
-                                    dB.data(),
-                                    ldb,
-                                    stB,
-                                    dWork.data(),
-                                    size_W,
-                                    dInfo.data(),
-                                    bc);
+        getrs_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                             trans,
+                                             m,
+                                             nrhs,
+                                             dA.data(),
+                                             lda,
+                                             stA,
+                                             dIpiv.data(),
+                                             stP,
+                                             dB.data(),
+                                             ldb,
+                                             stB,
+                                             dWork.data(),
+                                             size_W,
+                                             dInfo.data(),
+                                             bc);
     }
 }
 
@@ -266,7 +302,14 @@ void getrs_initData(const hipsolverHandle_t    handle,
     }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
 void getrs_getError(const hipsolverHandle_t    handle,
                     const hipsolverOperation_t trans,
                     const int                  m,
@@ -279,7 +322,7 @@ void getrs_getError(const hipsolverHandle_t    handle,
                     Td&                        dB,
                     const int                  ldb,
                     const int                  stB,
-                    Td&                        dWork,
+                    Vd&                        dWork,
                     const int                  lwork,
                     Ud&                        dInfo,
                     const int                  bc,
@@ -297,6 +340,7 @@ void getrs_getError(const hipsolverHandle_t    handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_getrs(FORTRAN,
+                                        STRIDED,
                                         handle,
                                         trans,
                                         m,
@@ -316,6 +360,7 @@ void getrs_getError(const hipsolverHandle_t    handle,
     CHECK_HIP_ERROR(hBRes.transfer_from(dB));
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1)
     for(int b = 0; b < bc; ++b)
     {
         cblas_getrs<T>(trans, m, nrhs, hA[b], lda, hIpiv[b], hB[b], ldb);
@@ -334,7 +379,14 @@ void getrs_getError(const hipsolverHandle_t    handle,
     }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
 void getrs_getPerfData(const hipsolverHandle_t    handle,
                        const hipsolverOperation_t trans,
                        const int                  m,
@@ -347,7 +399,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
                        Td&                        dB,
                        const int                  ldb,
                        const int                  stB,
-                       Td&                        dWork,
+                       Vd&                        dWork,
                        const int                  lwork,
                        Ud&                        dInfo,
                        const int                  bc,
@@ -384,6 +436,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
             handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrs(FORTRAN,
+                                            STRIDED,
                                             handle,
                                             trans,
                                             m,
@@ -405,15 +458,16 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         getrs_initData<false, true, T>(
             handle, trans, m, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB, bc, hA, hIpiv, hB);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_getrs(FORTRAN,
+                        STRIDED,
                         handle,
                         trans,
                         m,
@@ -430,7 +484,9 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
                         lwork,
                         dInfo.data(),
                         bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -472,28 +528,30 @@ void testing_getrs(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
-            //                                       handle,
-            //                                       trans,
-            //                                       m,
-            //                                       nrhs,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (int*)nullptr,
-            //                                       stP,
-            //                                       (T* const*)nullptr,
-            //                                       ldb,
-            //                                       stB,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  trans,
+                                                  m,
+                                                  nrhs,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (int*)nullptr,
+                                                  stP,
+                                                  (T**)nullptr,
+                                                  ldb,
+                                                  stB,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_getrs(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   trans,
                                                   m,
@@ -521,82 +579,96 @@ void testing_getrs(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>             hA(size_A, 1, bc);
-        // host_batch_vector<T>             hB(size_B, 1, bc);
-        // host_batch_vector<T>             hBRes(size_BRes, 1, bc);
-        // host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
-        // host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
-        // device_batch_vector<T>           dA(size_A, 1, bc);
-        // device_batch_vector<T>           dB(size_B, 1, bc);
-        // device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-        // if(size_B)
-        //     CHECK_HIP_ERROR(dB.memcheck());
-        // if(size_P)
-        //     CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_getrs_bufferSize(
-        //    FORTRAN, handle, trans, m, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     getrs_getError<FORTRAN, T>(handle,
-        //                                trans,
-        //                                m,
-        //                                nrhs,
-        //                                dA,
-        //                                lda,
-        //                                stA,
-        //                                dIpiv,
-        //                                stP,
-        //                                dB,
-        //                                ldb,
-        //                                stB,
-        //                                dWork,
-        //                                size_W,
-        //                                dInfo,
-        //                                bc,
-        //                                hA,
-        //                                hIpiv,
-        //                                hB,
-        //                                hBRes,
-        //                                hInfo,
-        //                                &max_error);
-
-        // // collect performance data
-        // if(argus.timing)
-        //     getrs_getPerfData<FORTRAN, T>(handle,
-        //                                   trans,
-        //                                   m,
-        //                                   nrhs,
-        //                                   dA,
-        //                                   lda,
-        //                                   stA,
-        //                                   dIpiv,
-        //                                   stP,
-        //                                   dB,
-        //                                   ldb,
-        //                                   stB,
-        //                                   dWork,
-        //                                   size_W,
-        //                                   dInfo,
-        //                                   bc,
-        //                                   hA,
-        //                                   hIpiv,
-        //                                   hB,
-        //                                   hInfo,
-        //                                   &gpu_time_used,
-        //                                   &cpu_time_used,
-        //                                   hot_calls,
-        //                                   argus.perf);
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hB(size_B, 1, bc);
+        host_batch_vector<T>             hBRes(size_BRes, 1, bc);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_batch_vector<T>           dB(size_B, 1, bc);
+        device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getrs_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   trans,
+                                   m,
+                                   nrhs,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dB.data(),
+                                   ldb,
+                                   stB,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrs_getError<FORTRAN, STRIDED, T>(handle,
+                                                trans,
+                                                m,
+                                                nrhs,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dB,
+                                                ldb,
+                                                stB,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hIpiv,
+                                                hB,
+                                                hBRes,
+                                                hInfo,
+                                                &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrs_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   trans,
+                                                   m,
+                                                   nrhs,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dIpiv,
+                                                   stP,
+                                                   dB,
+                                                   ldb,
+                                                   stB,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hIpiv,
+                                                   hB,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
     }
 
     else
@@ -620,63 +692,77 @@ void testing_getrs(Arguments& argus)
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_getrs_bufferSize(
-            FORTRAN, handle, trans, m, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, &size_W);
+        hipsolver_getrs_bufferSize(FORTRAN,
+                                   STRIDED,
+                                   handle,
+                                   trans,
+                                   m,
+                                   nrhs,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dB.data(),
+                                   ldb,
+                                   stB,
+                                   &size_W,
+                                   bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            getrs_getError<FORTRAN, T>(handle,
-                                       trans,
-                                       m,
-                                       nrhs,
-                                       dA,
-                                       lda,
-                                       stA,
-                                       dIpiv,
-                                       stP,
-                                       dB,
-                                       ldb,
-                                       stB,
-                                       dWork,
-                                       size_W,
-                                       dInfo,
-                                       bc,
-                                       hA,
-                                       hIpiv,
-                                       hB,
-                                       hBRes,
-                                       hInfo,
-                                       &max_error);
+            getrs_getError<FORTRAN, STRIDED, T>(handle,
+                                                trans,
+                                                m,
+                                                nrhs,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dB,
+                                                ldb,
+                                                stB,
+                                                dWork,
+                                                size_W,
+                                                dInfo,
+                                                bc,
+                                                hA,
+                                                hIpiv,
+                                                hB,
+                                                hBRes,
+                                                hInfo,
+                                                &max_error);
 
         // collect performance data
         if(argus.timing)
-            getrs_getPerfData<FORTRAN, T>(handle,
-                                          trans,
-                                          m,
-                                          nrhs,
-                                          dA,
-                                          lda,
-                                          stA,
-                                          dIpiv,
-                                          stP,
-                                          dB,
-                                          ldb,
-                                          stB,
-                                          dWork,
-                                          size_W,
-                                          dInfo,
-                                          bc,
-                                          hA,
-                                          hIpiv,
-                                          hB,
-                                          hInfo,
-                                          &gpu_time_used,
-                                          &cpu_time_used,
-                                          hot_calls,
-                                          argus.perf);
+            getrs_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                   trans,
+                                                   m,
+                                                   nrhs,
+                                                   dA,
+                                                   lda,
+                                                   stA,
+                                                   dIpiv,
+                                                   stP,
+                                                   dB,
+                                                   ldb,
+                                                   stB,
+                                                   dWork,
+                                                   size_W,
+                                                   dInfo,
+                                                   bc,
+                                                   hA,
+                                                   hIpiv,
+                                                   hB,
+                                                   hInfo,
+                                                   &gpu_time_used,
+                                                   &cpu_time_used,
+                                                   hot_calls,
+                                                   argus.perf);
     }
 
     // validate results for rocsolver-test
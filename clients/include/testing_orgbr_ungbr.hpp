@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U>
+template <bool FORTRAN, bool STRIDED, typename T, typename U, typename V>
 void orgbr_ungbr_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverSideMode_t side,
                               const int                 m,
@@ -14,36 +14,92 @@ void orgbr_ungbr_checkBadArgs(const hipsolverHandle_t   handle,
                               const int                 k,
                               T                         dA,
                               const int                 lda,
-                              T                         dIpiv,
-                              T                         dWork,
+                              const int                 stA,
+                              U                         dIpiv,
+                              const int                 stP,
+                              U                         dWork,
                               const int                 lwork,
-                              U                         dInfo)
+                              V                         dInfo,
+                              const int                 bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgbr_ungbr(FORTRAN, nullptr, side, m, n, k, dA, lda, dIpiv, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgbr_ungbr(FORTRAN,
+                                                STRIDED,
+                                                nullptr,
+                                                side,
+                                                m,
+                                                n,
+                                                k,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgbr_ungbr(
-            FORTRAN, handle, hipsolverSideMode_t(-1), m, n, k, dA, lda, dIpiv, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgbr_ungbr(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                hipsolverSideMode_t(-1),
+                                                m,
+                                                n,
+                                                k,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
 
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgbr_ungbr(
-            FORTRAN, handle, side, m, n, k, (T) nullptr, lda, dIpiv, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgbr_ungbr(
-            FORTRAN, handle, side, m, n, k, dA, lda, (T) nullptr, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgbr_ungbr(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                side,
+                                                m,
+                                                n,
+                                                k,
+                                                (T) nullptr,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgbr_ungbr(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                side,
+                                                m,
+                                                n,
+                                                k,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                (U) nullptr,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
-template <bool FORTRAN, typename T>
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
 void testing_orgbr_ungbr_bad_arg()
 {
     // safe arguments
@@ -53,28 +109,103 @@ void testing_orgbr_ungbr_bad_arg()
     int                    m    = 1;
     int                    n    = 1;
     int                    lda  = 1;
+    int                    stA  = 1;
+    int                    stP  = 1;
+    int                    bc   = 1;
 
-    // memory allocation
-    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
-    device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
-    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-    CHECK_HIP_ERROR(dA.memcheck());
-    CHECK_HIP_ERROR(dIpiv.memcheck());
-    CHECK_HIP_ERROR(dInfo.memcheck());
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
 
-    int size_W;
-    hipsolver_orgbr_ungbr_bufferSize(
-        FORTRAN, handle, side, m, n, k, dA.data(), lda, dIpiv.data(), &size_W);
-    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-    if(size_W)
-        CHECK_HIP_ERROR(dWork.memcheck());
+        int size_W;
+        hipsolver_orgbr_ungbr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         side,
+                                         m,
+                                         n,
+                                         k,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        orgbr_ungbr_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   side,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dIpiv.data(),
+                                                   stP,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
 
-    // check bad arguments
-    orgbr_ungbr_checkBadArgs<FORTRAN>(
-        handle, side, m, n, k, dA.data(), lda, dIpiv.data(), dWork.data(), size_W, dInfo.data());
+        int size_W;
+        hipsolver_orgbr_ungbr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         side,
+                                         m,
+                                         n,
+                                         k,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        orgbr_ungbr_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   side,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dIpiv.data(),
+                                                   stP,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
+    }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void orgbr_ungbr_initData(const hipsolverHandle_t   handle,
                           const hipsolverSideMode_t side,
                           const int                 m,
@@ -82,9 +213,10 @@ void orgbr_ungbr_initData(const hipsolverHandle_t   handle,
                           const int                 k,
                           Td&                       dA,
                           const int                 lda,
-                          Td&                       dIpiv,
+                          Ud&                       dIpiv,
+                          const int                 bc,
                           Th&                       hA,
-                          Th&                       hIpiv,
+                          Uh&                       hIpiv,
                           std::vector<T>&           hW,
                           size_t                    size_W)
 {
@@ -101,35 +233,38 @@ void orgbr_ungbr_initData(const hipsolverHandle_t   handle,
 
         // scale to avoid singularities
         // and compute gebrd
-        if(side == HIPSOLVER_SIDE_LEFT)
+        for(int b = 0; b < bc; ++b)
         {
-            for(int i = 0; i < m; ++i)
+            if(side == HIPSOLVER_SIDE_LEFT)
             {
-                for(int j = 0; j < k; ++j)
+                for(int i = 0; i < m; ++i)
                 {
-                    if(i == j)
-                        hA[0][i + j * lda] += 400;
-                    else
-                        hA[0][i + j * lda] -= 4;
+                    for(int j = 0; j < k; ++j)
+                    {
+                        if(i == j)
+                            hA[b][i + j * lda] += 400;
+                        else
+                            hA[b][i + j * lda] -= 4;
+                    }
                 }
+                cblas_gebrd<T>(
+                    m, k, hA[b], lda, D.data(), E.data(), hIpiv[b], P.data(), hW.data(), size_W);
             }
-            cblas_gebrd<T>(
-                m, k, hA[0], lda, D.data(), E.data(), hIpiv[0], P.data(), hW.data(), size_W);
-        }
-        else
-        {
-            for(int i = 0; i < k; ++i)
+            else
             {
-                for(int j = 0; j < n; ++j)
+                for(int i = 0; i < k; ++i)
                 {
-                    if(i == j)
-                        hA[0][i + j * lda] += 400;
-                    else
-                        hA[0][i + j * lda] -= 4;
+                    for(int j = 0; j < n; ++j)
+                    {
+                        if(i == j)
+                            hA[b][i + j * lda] += 400;
+                        else
+                            hA[b][i + j * lda] -= 4;
+                    }
                 }
+                cblas_gebrd<T>(
+                    k, n, hA[b], lda, D.data(), E.data(), P.data(), hIpiv[b], hW.data(), size_W);
             }
-            cblas_gebrd<T>(
-                k, n, hA[0], lda, D.data(), E.data(), P.data(), hIpiv[0], hW.data(), size_W);
         }
     }
 
@@ -141,7 +276,15 @@ void orgbr_ungbr_initData(const hipsolverHandle_t   handle,
     }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
 void orgbr_ungbr_getError(const hipsolverHandle_t   handle,
                           const hipsolverSideMode_t side,
                           const int                 m,
@@ -149,14 +292,17 @@ void orgbr_ungbr_getError(const hipsolverHandle_t   handle,
                           const int                 k,
                           Td&                       dA,
                           const int                 lda,
-                          Td&                       dIpiv,
-                          Td&                       dWork,
+                          const int                 stA,
+                          Ud&                       dIpiv,
+                          const int                 stP,
+                          Ud&                       dWork,
                           const int                 lwork,
-                          Ud&                       dInfo,
+                          Vd&                       dInfo,
+                          const int                 bc,
                           Th&                       hA,
                           Th&                       hAr,
-                          Th&                       hIpiv,
-                          Uh&                       hInfo,
+                          Uh&                       hIpiv,
+                          Vh&                       hInfo,
                           double*                   max_err)
 {
     size_t         size_W = max(max(m, n), k);
@@ -164,11 +310,12 @@ void orgbr_ungbr_getError(const hipsolverHandle_t   handle,
 
     // initialize data
     orgbr_ungbr_initData<true, true, T>(
-        handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+        handle, side, m, n, k, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_orgbr_ungbr(FORTRAN,
+                                              STRIDED,
                                               handle,
                                               side,
                                               m,
@@ -176,23 +323,41 @@ void orgbr_ungbr_getError(const hipsolverHandle_t   handle,
                                               k,
                                               dA.data(),
                                               lda,
+                                              stA,
                                               dIpiv.data(),
+                                              stP,
                                               dWork.data(),
                                               lwork,
-                                              dInfo.data()));
+                                              dInfo.data(),
+                                              bc));
     CHECK_HIP_ERROR(hAr.transfer_from(dA));
 
     // CPU lapack
-    cblas_orgbr_ungbr<T>(side, m, n, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
+    for(int b = 0; b < bc; ++b)
+        cblas_orgbr_ungbr<T>(side, m, n, k, hA[b], lda, hIpiv[b], hW.data(), size_W);
 
     // error is ||hA - hAr|| / ||hA||
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
     // IT MIGHT BE REVISITED IN THE FUTURE)
     // using frobenius norm
-    *max_err = norm_error('F', m, n, lda, hA[0], hAr[0]);
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('F', m, n, lda, hA[b], hAr[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
 void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
                              const hipsolverSideMode_t side,
                              const int                 m,
@@ -200,13 +365,16 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
                              const int                 k,
                              Td&                       dA,
                              const int                 lda,
-                             Td&                       dIpiv,
-                             Td&                       dWork,
+                             const int                 stA,
+                             Ud&                       dIpiv,
+                             const int                 stP,
+                             Ud&                       dWork,
                              const int                 lwork,
-                             Ud&                       dInfo,
+                             Vd&                       dInfo,
+                             const int                 bc,
                              Th&                       hA,
-                             Th&                       hIpiv,
-                             Uh&                       hInfo,
+                             Uh&                       hIpiv,
+                             Vh&                       hInfo,
                              double*                   gpu_time_used,
                              double*                   cpu_time_used,
                              const int                 hot_calls,
@@ -218,24 +386,26 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
     if(!perf)
     {
         orgbr_ungbr_initData<true, false, T>(
-            handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+            handle, side, m, n, k, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
-        cblas_orgbr_ungbr<T>(side, m, n, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
+        for(int b = 0; b < bc; ++b)
+            cblas_orgbr_ungbr<T>(side, m, n, k, hA[b], lda, hIpiv[b], hW.data(), size_W);
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
     orgbr_ungbr_initData<true, false, T>(
-        handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+        handle, side, m, n, k, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
         orgbr_ungbr_initData<false, true, T>(
-            handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+            handle, side, m, n, k, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
         CHECK_ROCBLAS_ERROR(hipsolver_orgbr_ungbr(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   side,
                                                   m,
@@ -243,24 +413,28 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
                                                   k,
                                                   dA.data(),
                                                   lda,
+                                                  stA,
                                                   dIpiv.data(),
+                                                  stP,
                                                   dWork.data(),
                                                   lwork,
-                                                  dInfo.data()));
+                                                  dInfo.data(),
+                                                  bc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         orgbr_ungbr_initData<false, true, T>(
-            handle, side, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+            handle, side, m, n, k, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_orgbr_ungbr(FORTRAN,
+                              STRIDED,
                               handle,
                               side,
                               m,
@@ -268,16 +442,21 @@ void orgbr_ungbr_getPerfData(const hipsolverHandle_t   handle,
                               k,
                               dA.data(),
                               lda,
+                              stA,
                               dIpiv.data(),
+                              stP,
                               dWork.data(),
                               lwork,
-                              dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+                              dInfo.data(),
+                              bc);
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <bool FORTRAN, typename T>
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
 void testing_orgbr_ungbr(Arguments& argus)
 {
     // get arguments
@@ -298,6 +477,7 @@ void testing_orgbr_ungbr(Arguments& argus)
     int lda = argus.get<int>("lda", m);
 
     hipsolverSideMode_t side      = char2hipsolver_side(sideC);
+    int                 bc        = argus.batch_count;
     int                 hot_calls = argus.iters;
 
     // check non-supported values
@@ -311,28 +491,60 @@ void testing_orgbr_ungbr(Arguments& argus)
     size_t size_A = row ? size_t(lda) * n : size_t(lda) * max(n, k);
     size_t size_P = row ? max(min(n, k), 1) : max(min(m, k), 1);
 
+    int stA    = argus.get<int>("strideA", size_A);
+    int stP    = argus.get<int>("strideP", size_P);
+    int stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
     double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
 
     size_t size_Ar = (argus.unit_check || argus.norm_check) ? size_A : 0;
 
     // check invalid sizes
-    bool invalid_size = ((m < 0 || n < 0 || k < 0 || lda < m) || (row && (m > n || m < min(n, k)))
+    bool invalid_size = ((m < 0 || n < 0 || k < 0 || lda < m || bc < 0)
+                         || (row && (m > n || m < min(n, k)))
                          || (!row && (n > m || n < min(m, k))));
     if(invalid_size)
     {
-        EXPECT_ROCBLAS_STATUS(hipsolver_orgbr_ungbr(FORTRAN,
-                                                    handle,
-                                                    side,
-                                                    m,
-                                                    n,
-                                                    k,
-                                                    (T*)nullptr,
-                                                    lda,
-                                                    (T*)nullptr,
-                                                    (T*)nullptr,
-                                                    0,
-                                                    (int*)nullptr),
-                              HIPSOLVER_STATUS_INVALID_VALUE);
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_orgbr_ungbr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        side,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_orgbr_ungbr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        side,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        (T*)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
 
         if(argus.timing)
             ROCSOLVER_BENCH_INFORM(1);
@@ -340,66 +552,166 @@ void testing_orgbr_ungbr(Arguments& argus)
         return;
     }
 
-    // memory allocations
-    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
-    host_strided_batch_vector<T>     hAr(size_Ar, 1, size_Ar, 1);
-    host_strided_batch_vector<T>     hIpiv(size_P, 1, size_P, 1);
-    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
-    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
-    device_strided_batch_vector<T>   dIpiv(size_P, 1, size_P, 1);
-    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-    if(size_A)
-        CHECK_HIP_ERROR(dA.memcheck());
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<T>   hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<int> hInfo(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<T>   dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
     if(size_P)
         CHECK_HIP_ERROR(dIpiv.memcheck());
     CHECK_HIP_ERROR(dInfo.memcheck());
 
-    int size_W;
-    hipsolver_orgbr_ungbr_bufferSize(
-        FORTRAN, handle, side, m, n, k, dA.data(), lda, dIpiv.data(), &size_W);
-    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-    if(size_W)
-        CHECK_HIP_ERROR(dWork.memcheck());
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T>   hA(size_A, 1, bc);
+        host_batch_vector<T>   hAr(size_Ar, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        int size_W;
+        hipsolver_orgbr_ungbr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         side,
+                                         m,
+                                         n,
+                                         k,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            orgbr_ungbr_getError<FORTRAN, STRIDED, T>(handle,
+                                                      side,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dIpiv,
+                                                      stP,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hAr,
+                                                      hIpiv,
+                                                      hInfo,
+                                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            orgbr_ungbr_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         side,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
+    }
 
-    // check computations
-    if(argus.unit_check || argus.norm_check)
-        orgbr_ungbr_getError<FORTRAN, T>(handle,
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T>   hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>   hAr(size_Ar, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        int size_W;
+        hipsolver_orgbr_ungbr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
                                          side,
                                          m,
                                          n,
                                          k,
-                                         dA,
+                                         dA.data(),
                                          lda,
-                                         dIpiv,
-                                         dWork,
-                                         size_W,
-                                         dInfo,
-                                         hA,
-                                         hAr,
-                                         hIpiv,
-                                         hInfo,
-                                         &max_error);
-
-    // collect performance data
-    if(argus.timing)
-        orgbr_ungbr_getPerfData<FORTRAN, T>(handle,
-                                            side,
-                                            m,
-                                            n,
-                                            k,
-                                            dA,
-                                            lda,
-                                            dIpiv,
-                                            dWork,
-                                            size_W,
-                                            dInfo,
-                                            hA,
-                                            hIpiv,
-                                            hInfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            orgbr_ungbr_getError<FORTRAN, STRIDED, T>(handle,
+                                                      side,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dIpiv,
+                                                      stP,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hAr,
+                                                      hIpiv,
+                                                      hInfo,
+                                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            orgbr_ungbr_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         side,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
+    }
 
     // validate results for rocsolver-test
     // using s * machine_precision as tolerance
@@ -415,9 +727,22 @@ void testing_orgbr_ungbr(Arguments& argus)
             std::cerr << "\n============================================\n";
             std::cerr << "Arguments:\n";
             std::cerr << "============================================\n";
-            rocsolver_bench_output("side", "m", "n", "k", "lda");
-            rocsolver_bench_output(sideC, m, n, k, lda);
-
+            if(BATCHED)
+            {
+                rocsolver_bench_output("side", "m", "n", "k", "lda", "strideP", "batch_c");
+                rocsolver_bench_output(sideC, m, n, k, lda, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output(
+                    "side", "m", "n", "k", "lda", "strideA", "strideP", "batch_c");
+                rocsolver_bench_output(sideC, m, n, k, lda, stA, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("side", "m", "n", "k", "lda");
+                rocsolver_bench_output(sideC, m, n, k, lda);
+            }
             std::cerr << "\n============================================\n";
             std::cerr << "Results:\n";
             std::cerr << "============================================\n";
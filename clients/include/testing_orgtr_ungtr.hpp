@@ -6,41 +6,90 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U>
+template <bool FORTRAN, bool STRIDED, typename T, typename U, typename V>
 void orgtr_ungtr_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverFillMode_t uplo,
                               const int                 n,
                               T                         dA,
                               const int                 lda,
-                              T                         dIpiv,
-                              T                         dWork,
+                              const int                 stA,
+                              U                         dIpiv,
+                              const int                 stP,
+                              U                         dWork,
                               const int                 lwork,
-                              U                         dInfo)
+                              V                         dInfo,
+                              const int                 bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgtr_ungtr(FORTRAN, nullptr, uplo, n, dA, lda, dIpiv, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgtr_ungtr(FORTRAN,
+                                                STRIDED,
+                                                nullptr,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgtr_ungtr(
-            FORTRAN, handle, hipsolverFillMode_t(-1), n, dA, lda, dIpiv, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgtr_ungtr(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                hipsolverFillMode_t(-1),
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
 
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgtr_ungtr(
-            FORTRAN, handle, uplo, n, (T) nullptr, lda, dIpiv, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_orgtr_ungtr(FORTRAN, handle, uplo, n, dA, lda, (T) nullptr, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgtr_ungtr(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                uplo,
+                                                n,
+                                                (T) nullptr,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_orgtr_ungtr(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                (U) nullptr,
+                                                stP,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
-template <bool FORTRAN, typename T>
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
 void testing_orgtr_ungtr_bad_arg()
 {
     // safe arguments
@@ -48,36 +97,84 @@ void testing_orgtr_ungtr_bad_arg()
     hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
     int                    n    = 1;
     int                    lda  = 1;
+    int                    stA  = 1;
+    int                    stP  = 1;
+    int                    bc   = 1;
 
-    // memory allocation
-    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
-    device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
-    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-    CHECK_HIP_ERROR(dA.memcheck());
-    CHECK_HIP_ERROR(dIpiv.memcheck());
-    CHECK_HIP_ERROR(dInfo.memcheck());
-
-    int size_W;
-    hipsolver_orgtr_ungtr_bufferSize(
-        FORTRAN, handle, uplo, n, dA.data(), lda, dIpiv.data(), &size_W);
-    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-    if(size_W)
-        CHECK_HIP_ERROR(dWork.memcheck());
-
-    // check bad arguments
-    orgtr_ungtr_checkBadArgs<FORTRAN>(
-        handle, uplo, n, dA.data(), lda, dIpiv.data(), dWork.data(), size_W, dInfo.data());
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_orgtr_ungtr_bufferSize(
+            FORTRAN, STRIDED, handle, uplo, n, dA.data(), lda, stA, dIpiv.data(), stP, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        orgtr_ungtr_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dIpiv.data(),
+                                                   stP,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_orgtr_ungtr_bufferSize(
+            FORTRAN, STRIDED, handle, uplo, n, dA.data(), lda, stA, dIpiv.data(), stP, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        orgtr_ungtr_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dIpiv.data(),
+                                                   stP,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
+    }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void orgtr_ungtr_initData(const hipsolverHandle_t   handle,
                           const hipsolverFillMode_t uplo,
                           const int                 n,
                           Td&                       dA,
                           const int                 lda,
-                          Td&                       dIpiv,
+                          Ud&                       dIpiv,
+                          const int                 bc,
                           Th&                       hA,
-                          Th&                       hIpiv,
+                          Uh&                       hIpiv,
                           std::vector<T>&           hW,
                           size_t                    size_W)
 {
@@ -91,20 +188,24 @@ void orgtr_ungtr_initData(const hipsolverHandle_t   handle,
         rocblas_init<T>(hA, true);
         rocblas_init<T>(hIpiv, true);
 
-        // scale to avoid singularities
-        for(int i = 0; i < n; ++i)
+        for(int b = 0; b < bc; ++b)
         {
-            for(int j = 0; j < n; ++j)
+            // scale to avoid singularities
+            for(int i = 0; i < n; ++i)
             {
-                if(i == j)
-                    hA[0][i + j * lda] += 400;
-                else
-                    hA[0][i + j * lda] -= 4;
+                for(int j = 0; j < n; ++j)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
             }
-        }
 
-        // compute sytrd/hetrd
-        cblas_sytrd_hetrd<T>(uplo, n, hA[0], lda, D.data(), E.data(), hIpiv[0], hW.data(), size_W);
+            // compute sytrd/hetrd
+            cblas_sytrd_hetrd<T>(
+                uplo, n, hA[b], lda, D.data(), E.data(), hIpiv[b], hW.data(), size_W);
+        }
     }
 
     if(GPU)
@@ -115,57 +216,98 @@ void orgtr_ungtr_initData(const hipsolverHandle_t   handle,
     }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
 void orgtr_ungtr_getError(const hipsolverHandle_t   handle,
                           const hipsolverFillMode_t uplo,
                           const int                 n,
                           Td&                       dA,
                           const int                 lda,
-                          Td&                       dIpiv,
-                          Td&                       dWork,
+                          const int                 stA,
+                          Ud&                       dIpiv,
+                          const int                 stP,
+                          Ud&                       dWork,
                           const int                 lwork,
-                          Ud&                       dInfo,
+                          Vd&                       dInfo,
+                          const int                 bc,
                           Th&                       hA,
                           Th&                       hAr,
-                          Th&                       hIpiv,
-                          Uh&                       hInfo,
+                          Uh&                       hIpiv,
+                          Vh&                       hInfo,
                           double*                   max_err)
 {
     size_t         size_W = n * 32;
     std::vector<T> hW(size_W);
 
     // initialize data
-    orgtr_ungtr_initData<true, true, T>(handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+    orgtr_ungtr_initData<true, true, T>(handle, uplo, n, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
     // execute computations
     // GPU lapack
-    CHECK_ROCBLAS_ERROR(hipsolver_orgtr_ungtr(
-        FORTRAN, handle, uplo, n, dA.data(), lda, dIpiv.data(), dWork.data(), lwork, dInfo.data()));
+    CHECK_ROCBLAS_ERROR(hipsolver_orgtr_ungtr(FORTRAN,
+                                              STRIDED,
+                                              handle,
+                                              uplo,
+                                              n,
+                                              dA.data(),
+                                              lda,
+                                              stA,
+                                              dIpiv.data(),
+                                              stP,
+                                              dWork.data(),
+                                              lwork,
+                                              dInfo.data(),
+                                              bc));
     CHECK_HIP_ERROR(hAr.transfer_from(dA));
 
     // CPU lapack
-    cblas_orgtr_ungtr<T>(uplo, n, hA[0], lda, hIpiv[0], hW.data(), size_W);
+    for(int b = 0; b < bc; ++b)
+        cblas_orgtr_ungtr<T>(uplo, n, hA[b], lda, hIpiv[b], hW.data(), size_W);
 
     // error is ||hA - hAr|| / ||hA||
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
     // IT MIGHT BE REVISITED IN THE FUTURE)
     // using frobenius norm
-    *max_err = norm_error('F', n, n, lda, hA[0], hAr[0]);
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('F', n, n, lda, hA[b], hAr[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
 void orgtr_ungtr_getPerfData(const hipsolverHandle_t   handle,
                              const hipsolverFillMode_t uplo,
                              const int                 n,
                              Td&                       dA,
                              const int                 lda,
-                             Td&                       dIpiv,
-                             Td&                       dWork,
+                             const int                 stA,
+                             Ud&                       dIpiv,
+                             const int                 stP,
+                             Ud&                       dWork,
                              const int                 lwork,
-                             Ud&                       dInfo,
+                             Vd&                       dInfo,
+                             const int                 bc,
                              Th&                       hA,
-                             Th&                       hIpiv,
-                             Uh&                       hInfo,
+                             Uh&                       hIpiv,
+                             Vh&                       hInfo,
                              double*                   gpu_time_used,
                              double*                   cpu_time_used,
                              const int                 hot_calls,
@@ -177,61 +319,73 @@ void orgtr_ungtr_getPerfData(const hipsolverHandle_t   handle,
     if(!perf)
     {
         orgtr_ungtr_initData<true, false, T>(
-            handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+            handle, uplo, n, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
-        cblas_orgtr_ungtr<T>(uplo, n, hA[0], lda, hIpiv[0], hW.data(), size_W);
+        for(int b = 0; b < bc; ++b)
+            cblas_orgtr_ungtr<T>(uplo, n, hA[b], lda, hIpiv[b], hW.data(), size_W);
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    orgtr_ungtr_initData<true, false, T>(handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+    orgtr_ungtr_initData<true, false, T>(
+        handle, uplo, n, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
         orgtr_ungtr_initData<false, true, T>(
-            handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+            handle, uplo, n, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
         CHECK_ROCBLAS_ERROR(hipsolver_orgtr_ungtr(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   uplo,
                                                   n,
                                                   dA.data(),
                                                   lda,
+                                                  stA,
                                                   dIpiv.data(),
+                                                  stP,
                                                   dWork.data(),
                                                   lwork,
-                                                  dInfo.data()));
+                                                  dInfo.data(),
+                                                  bc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         orgtr_ungtr_initData<false, true, T>(
-            handle, uplo, n, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+            handle, uplo, n, dA, lda, dIpiv, bc, hA, hIpiv, hW, size_W);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_orgtr_ungtr(FORTRAN,
+                              STRIDED,
                               handle,
                               uplo,
                               n,
                               dA.data(),
                               lda,
+                              stA,
                               dIpiv.data(),
+                              stP,
                               dWork.data(),
                               lwork,
-                              dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+                              dInfo.data(),
+                              bc);
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <bool FORTRAN, typename T>
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T>
 void testing_orgtr_ungtr(Arguments& argus)
 {
     // get arguments
@@ -239,10 +393,15 @@ void testing_orgtr_ungtr(Arguments& argus)
     char                   uploC = argus.get<char>("uplo");
     int                    n     = argus.get<int>("n");
     int                    lda   = argus.get<int>("lda", n);
+    int                    stA   = argus.get<int>("strideA", lda * n);
+    int                    stP   = argus.get<int>("strideP", n);
 
     hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 bc        = argus.batch_count;
     int                 hot_calls = argus.iters;
 
+    int stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
     // check non-supported values
     // N/A
 
@@ -258,20 +417,45 @@ void testing_orgtr_ungtr(Arguments& argus)
     size_t size_Ar = (argus.unit_check || argus.norm_check) ? size_A : 0;
 
     // check invalid sizes
-    bool invalid_size = (n < 0 || lda < n);
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
     if(invalid_size)
     {
-        EXPECT_ROCBLAS_STATUS(hipsolver_orgtr_ungtr(FORTRAN,
-                                                    handle,
-                                                    uplo,
-                                                    n,
-                                                    (T*)nullptr,
-                                                    lda,
-                                                    (T*)nullptr,
-                                                    (T*)nullptr,
-                                                    0,
-                                                    (int*)nullptr),
-                              HIPSOLVER_STATUS_INVALID_VALUE);
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_orgtr_ungtr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        uplo,
+                                                        n,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_orgtr_ungtr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        uplo,
+                                                        n,
+                                                        (T*)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
 
         if(argus.timing)
             ROCSOLVER_BENCH_INFORM(1);
@@ -279,62 +463,134 @@ void testing_orgtr_ungtr(Arguments& argus)
         return;
     }
 
-    // memory allocations
-    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
-    host_strided_batch_vector<T>     hAr(size_Ar, 1, size_Ar, 1);
-    host_strided_batch_vector<T>     hIpiv(size_P, 1, size_P, 1);
-    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
-    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
-    device_strided_batch_vector<T>   dIpiv(size_P, 1, size_P, 1);
-    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-    if(size_A)
-        CHECK_HIP_ERROR(dA.memcheck());
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<T>   hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<int> hInfo(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<T>   dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
     if(size_P)
         CHECK_HIP_ERROR(dIpiv.memcheck());
     CHECK_HIP_ERROR(dInfo.memcheck());
 
-    int size_W;
-    hipsolver_orgtr_ungtr_bufferSize(
-        FORTRAN, handle, uplo, n, dA.data(), lda, dIpiv.data(), &size_W);
-    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-    if(size_W)
-        CHECK_HIP_ERROR(dWork.memcheck());
-
-    // check computations
-    if(argus.unit_check || argus.norm_check)
-        orgtr_ungtr_getError<FORTRAN, T>(handle,
-                                         uplo,
-                                         n,
-                                         dA,
-                                         lda,
-                                         dIpiv,
-                                         dWork,
-                                         size_W,
-                                         dInfo,
-                                         hA,
-                                         hAr,
-                                         hIpiv,
-                                         hInfo,
-                                         &max_error);
-
-    // collect performance data
-    if(argus.timing)
-        orgtr_ungtr_getPerfData<FORTRAN, T>(handle,
-                                            uplo,
-                                            n,
-                                            dA,
-                                            lda,
-                                            dIpiv,
-                                            dWork,
-                                            size_W,
-                                            dInfo,
-                                            hA,
-                                            hIpiv,
-                                            hInfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T>   hA(size_A, 1, bc);
+        host_batch_vector<T>   hAr(size_Ar, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        int size_W;
+        hipsolver_orgtr_ungtr_bufferSize(
+            FORTRAN, STRIDED, handle, uplo, n, dA.data(), lda, stA, dIpiv.data(), stP, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            orgtr_ungtr_getError<FORTRAN, STRIDED, T>(handle,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dIpiv,
+                                                      stP,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hAr,
+                                                      hIpiv,
+                                                      hInfo,
+                                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            orgtr_ungtr_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T>   hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>   hAr(size_Ar, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        int size_W;
+        hipsolver_orgtr_ungtr_bufferSize(
+            FORTRAN, STRIDED, handle, uplo, n, dA.data(), lda, stA, dIpiv.data(), stP, &size_W, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            orgtr_ungtr_getError<FORTRAN, STRIDED, T>(handle,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dIpiv,
+                                                      stP,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hAr,
+                                                      hIpiv,
+                                                      hInfo,
+                                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            orgtr_ungtr_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
+    }
 
     // validate results for rocsolver-test
     // using n * machine_precision as tolerance
@@ -349,9 +605,21 @@ void testing_orgtr_ungtr(Arguments& argus)
             std::cerr << "\n============================================\n";
             std::cerr << "Arguments:\n";
             std::cerr << "============================================\n";
-            rocsolver_bench_output("uplo", "n", "lda");
-            rocsolver_bench_output(uploC, n, lda);
-
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideP", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "lda", "strideA", "strideP", "batch_c");
+                rocsolver_bench_output(uploC, n, lda, stA, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "lda");
+                rocsolver_bench_output(uploC, n, lda);
+            }
             std::cerr << "\n============================================\n";
             std::cerr << "Results:\n";
             std::cerr << "============================================\n";
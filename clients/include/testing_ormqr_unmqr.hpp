@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, bool COMPLEX, typename T, typename U>
+template <bool FORTRAN, bool STRIDED, bool COMPLEX, typename T, typename U, typename V>
 void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                               const hipsolverSideMode_t  side,
                               const hipsolverOperation_t trans,
@@ -15,21 +15,43 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                               const int                  k,
                               T                          dA,
                               const int                  lda,
-                              T                          dIpiv,
+                              const int                  stA,
+                              U                          dIpiv,
+                              const int                  stP,
                               T                          dC,
                               const int                  ldc,
-                              T                          dWork,
+                              const int                  stC,
+                              U                          dWork,
                               const int                  lwork,
-                              U                          dInfo)
+                              V                          dInfo,
+                              const int                  bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_ormqr_unmqr(
-            FORTRAN, nullptr, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, dWork, lwork, dInfo),
-        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                STRIDED,
+                                                nullptr,
+                                                side,
+                                                trans,
+                                                m,
+                                                n,
+                                                k,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dIpiv,
+                                                stP,
+                                                dC,
+                                                ldc,
+                                                stC,
+                                                dWork,
+                                                lwork,
+                                                dInfo,
+                                                bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 hipsolverSideMode_t(-1),
                                                 trans,
@@ -38,14 +60,19 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                                                 k,
                                                 dA,
                                                 lda,
+                                                stA,
                                                 dIpiv,
+                                                stP,
                                                 dC,
                                                 ldc,
+                                                stC,
                                                 dWork,
                                                 lwork,
-                                                dInfo),
+                                                dInfo,
+                                                bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 side,
                                                 hipsolverOperation_t(-1),
@@ -54,15 +81,20 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                                                 k,
                                                 dA,
                                                 lda,
+                                                stA,
                                                 dIpiv,
+                                                stP,
                                                 dC,
                                                 ldc,
+                                                stC,
                                                 dWork,
                                                 lwork,
-                                                dInfo),
+                                                dInfo,
+                                                bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     if(COMPLEX)
         EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                    STRIDED,
                                                     handle,
                                                     side,
                                                     HIPSOLVER_OP_T,
@@ -71,15 +103,20 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                                                     k,
                                                     dA,
                                                     lda,
+                                                    stA,
                                                     dIpiv,
+                                                    stP,
                                                     dC,
                                                     ldc,
+                                                    stC,
                                                     dWork,
                                                     lwork,
-                                                    dInfo),
+                                                    dInfo,
+                                                    bc),
                               HIPSOLVER_STATUS_INVALID_VALUE);
     else
         EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                    STRIDED,
                                                     handle,
                                                     side,
                                                     HIPSOLVER_OP_C,
@@ -88,17 +125,22 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                                                     k,
                                                     dA,
                                                     lda,
+                                                    stA,
                                                     dIpiv,
+                                                    stP,
                                                     dC,
                                                     ldc,
+                                                    stC,
                                                     dWork,
                                                     lwork,
-                                                    dInfo),
+                                                    dInfo,
+                                                    bc),
                               HIPSOLVER_STATUS_INVALID_VALUE);
 
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 side,
                                                 trans,
@@ -107,14 +149,19 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                                                 k,
                                                 (T) nullptr,
                                                 lda,
+                                                stA,
                                                 dIpiv,
+                                                stP,
                                                 dC,
                                                 ldc,
+                                                stC,
                                                 dWork,
                                                 lwork,
-                                                dInfo),
+                                                dInfo,
+                                                bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 side,
                                                 trans,
@@ -123,14 +170,19 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                                                 k,
                                                 dA,
                                                 lda,
-                                                (T) nullptr,
+                                                stA,
+                                                (U) nullptr,
+                                                stP,
                                                 dC,
                                                 ldc,
+                                                stC,
                                                 dWork,
                                                 lwork,
-                                                dInfo),
+                                                dInfo,
+                                                bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 side,
                                                 trans,
@@ -139,17 +191,21 @@ void ormqr_unmqr_checkBadArgs(const hipsolverHandle_t    handle,
                                                 k,
                                                 dA,
                                                 lda,
+                                                stA,
                                                 dIpiv,
+                                                stP,
                                                 (T) nullptr,
                                                 ldc,
+                                                stC,
                                                 dWork,
                                                 lwork,
-                                                dInfo),
+                                                dInfo,
+                                                bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
-template <bool FORTRAN, typename T, bool COMPLEX = is_complex<T>>
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T, bool COMPLEX = is_complex<T>>
 void testing_ormqr_unmqr_bad_arg()
 {
     // safe arguments
@@ -161,53 +217,124 @@ void testing_ormqr_unmqr_bad_arg()
     int                    n     = 1;
     int                    lda   = 1;
     int                    ldc   = 1;
+    int                    stA   = 1;
+    int                    stP   = 1;
+    int                    stC   = 1;
+    int                    bc    = 1;
 
-    // memory allocation
-    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
-    device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
-    device_strided_batch_vector<T>   dC(1, 1, 1, 1);
-    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-    CHECK_HIP_ERROR(dA.memcheck());
-    CHECK_HIP_ERROR(dIpiv.memcheck());
-    CHECK_HIP_ERROR(dC.memcheck());
-    CHECK_HIP_ERROR(dInfo.memcheck());
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
+        device_batch_vector<T>           dC(1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
 
-    int size_W;
-    hipsolver_ormqr_unmqr_bufferSize(FORTRAN,
-                                     handle,
-                                     side,
-                                     trans,
-                                     m,
-                                     n,
-                                     k,
-                                     dA.data(),
-                                     lda,
-                                     dIpiv.data(),
-                                     dC.data(),
-                                     ldc,
-                                     &size_W);
-    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-    if(size_W)
-        CHECK_HIP_ERROR(dWork.memcheck());
-
-    // check bad arguments
-    ormqr_unmqr_checkBadArgs<FORTRAN, COMPLEX>(handle,
-                                               side,
-                                               trans,
-                                               m,
-                                               n,
-                                               k,
-                                               dA.data(),
-                                               lda,
-                                               dIpiv.data(),
-                                               dC.data(),
-                                               ldc,
-                                               dWork.data(),
-                                               size_W,
-                                               dInfo.data());
+        int size_W;
+        hipsolver_ormqr_unmqr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         side,
+                                         trans,
+                                         m,
+                                         n,
+                                         k,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dC.data(),
+                                         ldc,
+                                         stC,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        ormqr_unmqr_checkBadArgs<FORTRAN, STRIDED, COMPLEX>(handle,
+                                                            side,
+                                                            trans,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            dA.data(),
+                                                            lda,
+                                                            stA,
+                                                            dIpiv.data(),
+                                                            stP,
+                                                            dC.data(),
+                                                            ldc,
+                                                            stC,
+                                                            dWork.data(),
+                                                            size_W,
+                                                            dInfo.data(),
+                                                            bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dC(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_ormqr_unmqr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         side,
+                                         trans,
+                                         m,
+                                         n,
+                                         k,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dC.data(),
+                                         ldc,
+                                         stC,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        ormqr_unmqr_checkBadArgs<FORTRAN, STRIDED, COMPLEX>(handle,
+                                                            side,
+                                                            trans,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            dA.data(),
+                                                            lda,
+                                                            stA,
+                                                            dIpiv.data(),
+                                                            stP,
+                                                            dC.data(),
+                                                            ldc,
+                                                            stC,
+                                                            dWork.data(),
+                                                            size_W,
+                                                            dInfo.data(),
+                                                            bc);
+    }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void ormqr_unmqr_initData(const hipsolverHandle_t    handle,
                           const hipsolverSideMode_t  side,
                           const hipsolverOperation_t trans,
@@ -216,11 +343,12 @@ void ormqr_unmqr_initData(const hipsolverHandle_t    handle,
                           const int                  k,
                           Td&                        dA,
                           const int                  lda,
-                          Td&                        dIpiv,
+                          Ud&                        dIpiv,
                           Td&                        dC,
                           const int                  ldc,
+                          const int                  bc,
                           Th&                        hA,
-                          Th&                        hIpiv,
+                          Uh&                        hIpiv,
                           Th&                        hC,
                           std::vector<T>&            hW,
                           size_t                     size_W)
@@ -233,20 +361,23 @@ void ormqr_unmqr_initData(const hipsolverHandle_t    handle,
         rocblas_init<T>(hIpiv, true);
         rocblas_init<T>(hC, true);
 
-        // scale to avoid singularities
-        for(int i = 0; i < nq; ++i)
+        for(int b = 0; b < bc; ++b)
         {
-            for(int j = 0; j < k; ++j)
+            // scale to avoid singularities
+            for(int i = 0; i < nq; ++i)
             {
-                if(i == j)
-                    hA[0][i + j * lda] += 400;
-                else
-                    hA[0][i + j * lda] -= 4;
+                for(int j = 0; j < k; ++j)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
             }
-        }
 
-        // compute QR factorization
-        cblas_geqrf<T>(nq, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
+            // compute QR factorization
+            cblas_geqrf<T>(nq, k, hA[b], lda, hIpiv[b], hW.data(), size_W);
+        }
     }
 
     if(GPU)
@@ -258,7 +389,15 @@ void ormqr_unmqr_initData(const hipsolverHandle_t    handle,
     }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
 void ormqr_unmqr_getError(const hipsolverHandle_t    handle,
                           const hipsolverSideMode_t  side,
                           const hipsolverOperation_t trans,
@@ -267,17 +406,21 @@ void ormqr_unmqr_getError(const hipsolverHandle_t    handle,
                           const int                  k,
                           Td&                        dA,
                           const int                  lda,
-                          Td&                        dIpiv,
+                          const int                  stA,
+                          Ud&                        dIpiv,
+                          const int                  stP,
                           Td&                        dC,
                           const int                  ldc,
-                          Td&                        dWork,
+                          const int                  stC,
+                          Ud&                        dWork,
                           const int                  lwork,
-                          Ud&                        dInfo,
+                          Vd&                        dInfo,
+                          const int                  bc,
                           Th&                        hA,
-                          Th&                        hIpiv,
+                          Uh&                        hIpiv,
                           Th&                        hC,
                           Th&                        hCr,
-                          Uh&                        hInfo,
+                          Vh&                        hInfo,
                           double*                    max_err)
 {
     size_t         size_W = max(max(m, n), k);
@@ -285,11 +428,12 @@ void ormqr_unmqr_getError(const hipsolverHandle_t    handle,
 
     // initialize data
     ormqr_unmqr_initData<true, true, T>(
-        handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, hA, hIpiv, hC, hW, size_W);
+        handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, bc, hA, hIpiv, hC, hW, size_W);
 
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_ormqr_unmqr(FORTRAN,
+                                              STRIDED,
                                               handle,
                                               side,
                                               trans,
@@ -298,25 +442,45 @@ void ormqr_unmqr_getError(const hipsolverHandle_t    handle,
                                               k,
                                               dA.data(),
                                               lda,
+                                              stA,
                                               dIpiv.data(),
+                                              stP,
                                               dC.data(),
                                               ldc,
+                                              stC,
                                               dWork.data(),
                                               lwork,
-                                              dInfo.data()));
+                                              dInfo.data(),
+                                              bc));
     CHECK_HIP_ERROR(hCr.transfer_from(dC));
 
     // CPU lapack
-    cblas_ormqr_unmqr<T>(side, trans, m, n, k, hA[0], lda, hIpiv[0], hC[0], ldc, hW.data(), size_W);
+    for(int b = 0; b < bc; ++b)
+        cblas_ormqr_unmqr<T>(
+            side, trans, m, n, k, hA[b], lda, hIpiv[b], hC[b], ldc, hW.data(), size_W);
 
     // error is ||hC - hCr|| / ||hC||
     // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
     // IT MIGHT BE REVISITED IN THE FUTURE)
     // using frobenius norm
-    *max_err = norm_error('F', m, n, ldc, hC[0], hCr[0]);
+    double err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        err      = norm_error('F', m, n, ldc, hC[b], hCr[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
 }
 
-template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
 void ormqr_unmqr_getPerfData(const hipsolverHandle_t    handle,
                              const hipsolverSideMode_t  side,
                              const hipsolverOperation_t trans,
@@ -325,16 +489,20 @@ void ormqr_unmqr_getPerfData(const hipsolverHandle_t    handle,
                              const int                  k,
                              Td&                        dA,
                              const int                  lda,
-                             Td&                        dIpiv,
+                             const int                  stA,
+                             Ud&                        dIpiv,
+                             const int                  stP,
                              Td&                        dC,
                              const int                  ldc,
-                             Td&                        dWork,
+                             const int                  stC,
+                             Ud&                        dWork,
                              const int                  lwork,
-                             Ud&                        dInfo,
+                             Vd&                        dInfo,
+                             const int                  bc,
                              Th&                        hA,
-                             Th&                        hIpiv,
+                             Uh&                        hIpiv,
                              Th&                        hC,
-                             Uh&                        hInfo,
+                             Vh&                        hInfo,
                              double*                    gpu_time_used,
                              double*                    cpu_time_used,
                              const int                  hot_calls,
@@ -346,25 +514,27 @@ void ormqr_unmqr_getPerfData(const hipsolverHandle_t    handle,
     if(!perf)
     {
         ormqr_unmqr_initData<true, false, T>(
-            handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, hA, hIpiv, hC, hW, size_W);
+            handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, bc, hA, hIpiv, hC, hW, size_W);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
-        cblas_ormqr_unmqr<T>(
-            side, trans, m, n, k, hA[0], lda, hIpiv[0], hC[0], ldc, hW.data(), size_W);
+        for(int b = 0; b < bc; ++b)
+            cblas_ormqr_unmqr<T>(
+                side, trans, m, n, k, hA[b], lda, hIpiv[b], hC[b], ldc, hW.data(), size_W);
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
     ormqr_unmqr_initData<true, false, T>(
-        handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, hA, hIpiv, hC, hW, size_W);
+        handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, bc, hA, hIpiv, hC, hW, size_W);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
         ormqr_unmqr_initData<false, true, T>(
-            handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, hA, hIpiv, hC, hW, size_W);
+            handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, bc, hA, hIpiv, hC, hW, size_W);
 
         CHECK_ROCBLAS_ERROR(hipsolver_ormqr_unmqr(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   side,
                                                   trans,
@@ -373,26 +543,31 @@ void ormqr_unmqr_getPerfData(const hipsolverHandle_t    handle,
                                                   k,
                                                   dA.data(),
                                                   lda,
+                                                  stA,
                                                   dIpiv.data(),
+                                                  stP,
                                                   dC.data(),
                                                   ldc,
+                                                  stC,
                                                   dWork.data(),
                                                   lwork,
-                                                  dInfo.data()));
+                                                  dInfo.data(),
+                                                  bc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         ormqr_unmqr_initData<false, true, T>(
-            handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, hA, hIpiv, hC, hW, size_W);
+            handle, side, trans, m, n, k, dA, lda, dIpiv, dC, ldc, bc, hA, hIpiv, hC, hW, size_W);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_ormqr_unmqr(FORTRAN,
+                              STRIDED,
                               handle,
                               side,
                               trans,
@@ -401,18 +576,24 @@ void ormqr_unmqr_getPerfData(const hipsolverHandle_t    handle,
                               k,
                               dA.data(),
                               lda,
+                              stA,
                               dIpiv.data(),
+                              stP,
                               dC.data(),
                               ldc,
+                              stC,
                               dWork.data(),
                               lwork,
-                              dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+                              dInfo.data(),
+                              bc);
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <bool FORTRAN, typename T, bool COMPLEX = is_complex<T>>
+template <bool FORTRAN, bool BATCHED, bool STRIDED, typename T, bool COMPLEX = is_complex<T>>
 void testing_ormqr_unmqr(Arguments& argus)
 {
     // get arguments
@@ -434,32 +615,70 @@ void testing_ormqr_unmqr(Arguments& argus)
     }
     int lda = argus.get<int>("lda", sideC == 'L' ? m : n);
     int ldc = argus.get<int>("ldc", m);
+    int stA = argus.get<int>("strideA", lda * k);
+    int stP = argus.get<int>("strideP", k);
+    int stC = argus.get<int>("strideC", ldc * n);
 
     hipsolverSideMode_t  side      = char2hipsolver_side(sideC);
     hipsolverOperation_t trans     = char2hipsolver_operation(transC);
+    int                  bc        = argus.batch_count;
     int                  hot_calls = argus.iters;
 
+    int stCRes = (argus.unit_check || argus.norm_check) ? stC : 0;
+
     // check non-supported values
     bool invalid_value
         = ((COMPLEX && trans == HIPSOLVER_OP_T) || (!COMPLEX && trans == HIPSOLVER_OP_C));
     if(invalid_value)
     {
-        EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
-                                                    handle,
-                                                    side,
-                                                    trans,
-                                                    m,
-                                                    n,
-                                                    k,
-                                                    (T*)nullptr,
-                                                    lda,
-                                                    (T*)nullptr,
-                                                    (T*)nullptr,
-                                                    ldc,
-                                                    (T*)nullptr,
-                                                    0,
-                                                    (int*)nullptr),
-                              HIPSOLVER_STATUS_INVALID_VALUE);
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        side,
+                                                        trans,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T**)nullptr,
+                                                        ldc,
+                                                        stC,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        side,
+                                                        trans,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        (T*)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        ldc,
+                                                        stC,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
 
         if(argus.timing)
             ROCSOLVER_BENCH_INFORM(2);
@@ -477,26 +696,58 @@ void testing_ormqr_unmqr(Arguments& argus)
     size_t size_Cr = (argus.unit_check || argus.norm_check) ? size_C : 0;
 
     // check invalid sizes
-    bool invalid_size = ((m < 0 || n < 0 || k < 0 || ldc < m) || (left && (lda < m || k > m))
-                         || (!left && (lda < n || k > n)));
+    bool invalid_size = ((m < 0 || n < 0 || k < 0 || ldc < m || bc < 0)
+                         || (left && (lda < m || k > m)) || (!left && (lda < n || k > n)));
     if(invalid_size)
     {
-        EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
-                                                    handle,
-                                                    side,
-                                                    trans,
-                                                    m,
-                                                    n,
-                                                    k,
-                                                    (T*)nullptr,
-                                                    lda,
-                                                    (T*)nullptr,
-                                                    (T*)nullptr,
-                                                    ldc,
-                                                    (T*)nullptr,
-                                                    0,
-                                                    (int*)nullptr),
-                              HIPSOLVER_STATUS_INVALID_VALUE);
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        side,
+                                                        trans,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T**)nullptr,
+                                                        ldc,
+                                                        stC,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_ormqr_unmqr(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        side,
+                                                        trans,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        (T*)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        ldc,
+                                                        stC,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
 
         if(argus.timing)
             ROCSOLVER_BENCH_INFORM(1);
@@ -504,89 +755,202 @@ void testing_ormqr_unmqr(Arguments& argus)
         return;
     }
 
-    // memory allocations
-    host_strided_batch_vector<T>     hC(size_C, 1, size_C, 1);
-    host_strided_batch_vector<T>     hCr(size_Cr, 1, size_Cr, 1);
-    host_strided_batch_vector<T>     hIpiv(size_P, 1, size_P, 1);
-    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
-    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
-    device_strided_batch_vector<T>   dC(size_C, 1, size_C, 1);
-    device_strided_batch_vector<T>   dIpiv(size_P, 1, size_P, 1);
-    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
-    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-    if(size_A)
-        CHECK_HIP_ERROR(dA.memcheck());
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<T>   hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<int> hInfo(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<T>   dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
     if(size_P)
         CHECK_HIP_ERROR(dIpiv.memcheck());
-    if(size_C)
-        CHECK_HIP_ERROR(dC.memcheck());
     CHECK_HIP_ERROR(dInfo.memcheck());
 
-    int size_W;
-    hipsolver_ormqr_unmqr_bufferSize(FORTRAN,
-                                     handle,
-                                     side,
-                                     trans,
-                                     m,
-                                     n,
-                                     k,
-                                     dA.data(),
-                                     lda,
-                                     dIpiv.data(),
-                                     dC.data(),
-                                     ldc,
-                                     &size_W);
-    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-    if(size_W)
-        CHECK_HIP_ERROR(dWork.memcheck());
-
-    // check computations
-    if(argus.unit_check || argus.norm_check)
-        ormqr_unmqr_getError<FORTRAN, T>(handle,
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T>   hA(size_A, 1, bc);
+        host_batch_vector<T>   hC(size_C, 1, bc);
+        host_batch_vector<T>   hCr(size_Cr, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dC(size_C, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+
+        int size_W;
+        hipsolver_ormqr_unmqr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
                                          side,
                                          trans,
                                          m,
                                          n,
                                          k,
-                                         dA,
+                                         dA.data(),
                                          lda,
-                                         dIpiv,
-                                         dC,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dC.data(),
                                          ldc,
-                                         dWork,
-                                         size_W,
-                                         dInfo,
-                                         hA,
-                                         hIpiv,
-                                         hC,
-                                         hCr,
-                                         hInfo,
-                                         &max_error);
-
-    // collect performance data
-    if(argus.timing)
-        ormqr_unmqr_getPerfData<FORTRAN, T>(handle,
-                                            side,
-                                            trans,
-                                            m,
-                                            n,
-                                            k,
-                                            dA,
-                                            lda,
-                                            dIpiv,
-                                            dC,
-                                            ldc,
-                                            dWork,
-                                            size_W,
-                                            dInfo,
-                                            hA,
-                                            hIpiv,
-                                            hC,
-                                            hInfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+                                         stC,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            ormqr_unmqr_getError<FORTRAN, STRIDED, T>(handle,
+                                                      side,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dIpiv,
+                                                      stP,
+                                                      dC,
+                                                      ldc,
+                                                      stC,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hIpiv,
+                                                      hC,
+                                                      hCr,
+                                                      hInfo,
+                                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            ormqr_unmqr_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         side,
+                                                         trans,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dC,
+                                                         ldc,
+                                                         stC,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hC,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T>   hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>   hC(size_C, 1, stC, bc);
+        host_strided_batch_vector<T>   hCr(size_Cr, 1, stCRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dC(size_C, 1, stC, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+
+        int size_W;
+        hipsolver_ormqr_unmqr_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         side,
+                                         trans,
+                                         m,
+                                         n,
+                                         k,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dC.data(),
+                                         ldc,
+                                         stC,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            ormqr_unmqr_getError<FORTRAN, STRIDED, T>(handle,
+                                                      side,
+                                                      trans,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dIpiv,
+                                                      stP,
+                                                      dC,
+                                                      ldc,
+                                                      stC,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hIpiv,
+                                                      hC,
+                                                      hCr,
+                                                      hInfo,
+                                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            ormqr_unmqr_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         side,
+                                                         trans,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dIpiv,
+                                                         stP,
+                                                         dC,
+                                                         ldc,
+                                                         stC,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hIpiv,
+                                                         hC,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
+    }
 
     // validate results for rocsolver-test
     // using s * machine_precision as tolerance
@@ -602,9 +966,32 @@ void testing_ormqr_unmqr(Arguments& argus)
             std::cerr << "\n============================================\n";
             std::cerr << "Arguments:\n";
             std::cerr << "============================================\n";
-            rocsolver_bench_output("side", "trans", "m", "n", "k", "lda", "ldc");
-            rocsolver_bench_output(sideC, transC, m, n, k, lda, ldc);
-
+            if(BATCHED)
+            {
+                rocsolver_bench_output(
+                    "side", "trans", "m", "n", "k", "lda", "strideP", "ldc", "batch_c");
+                rocsolver_bench_output(sideC, transC, m, n, k, lda, stP, ldc, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("side",
+                                       "trans",
+                                       "m",
+                                       "n",
+                                       "k",
+                                       "lda",
+                                       "strideA",
+                                       "strideP",
+                                       "ldc",
+                                       "strideC",
+                                       "batch_c");
+                rocsolver_bench_output(sideC, transC, m, n, k, lda, stA, stP, ldc, stC, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("side", "trans", "m", "n", "k", "lda", "ldc");
+                rocsolver_bench_output(sideC, transC, m, n, k, lda, ldc);
+            }
             std::cerr << "\n============================================\n";
             std::cerr << "Results:\n";
             std::cerr << "============================================\n";
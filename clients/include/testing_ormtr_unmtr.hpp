@@ -416,14 +416,14 @@ void ormtr_unmtr_getPerfData(const hipsolverHandle_t    handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         ormtr_unmtr_initData<false, true, T>(
             handle, side, uplo, trans, m, n, dA, lda, dIpiv, dC, ldc, hA, hIpiv, hC, hW, size_W);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_ormtr_unmtr(FORTRAN,
                               handle,
                               side,
@@ -439,7 +439,9 @@ void ormtr_unmtr_getPerfData(const hipsolverHandle_t    handle,
                               dWork.data(),
                               lwork,
                               dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
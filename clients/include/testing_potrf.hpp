@@ -135,6 +135,20 @@ void potrf_initData(const hipsolverHandle_t   handle,
     }
 }
 
+template <typename T, typename Td>
+void potrf_initDeviceData(const hipsolverHandle_t handle,
+                          const int               n,
+                          Td&                     dA,
+                          const int               lda,
+                          const int               bc)
+{
+    // generate the matrices directly on the device;
+    // the dominant diagonal ensures positive definiteness
+    device_rand_generator rng(handle);
+    for(int b = 0; b < bc; ++b)
+        rocblas_init_device_diag_dominant<T>(rng, dA[b], n, n, lda);
+}
+
 template <bool FORTRAN, typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh>
 void potrf_getError(const hipsolverHandle_t   handle,
                     const hipsolverFillMode_t uplo,
@@ -163,6 +177,7 @@ void potrf_getError(const hipsolverHandle_t   handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1)
     for(int b = 0; b < bc; ++b)
         cblas_potrf<T>(uplo, n, hA[b], lda, hInfo[b]);
 
@@ -194,6 +209,62 @@ void potrf_getError(const hipsolverHandle_t   handle,
     *max_err += err;
 }
 
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Vd, typename Uh>
+void potrf_getDeviceError(const hipsolverHandle_t   handle,
+                          const hipsolverFillMode_t uplo,
+                          const int                 n,
+                          Td&                       dA,
+                          const int                 lda,
+                          const int                 stA,
+                          Vd&                       dWork,
+                          const int                 lwork,
+                          Ud&                       dInfo,
+                          const int                 bc,
+                          Uh&                       hInfoRes,
+                          double*                   max_err)
+{
+    // input data initialization
+    potrf_initDeviceData<T>(handle, n, dA, lda, bc);
+
+    // keep the original matrices on the device
+    size_t                         size_A = size_t(lda) * n;
+    device_strided_batch_vector<T> dA0(size_A, 1, size_A, bc);
+    device_strided_batch_vector<T> dTmp(size_t(n) * n, 1, size_t(n) * n, 1);
+    if(size_A)
+    {
+        CHECK_HIP_ERROR(dA0.memcheck());
+        CHECK_HIP_ERROR(dTmp.memcheck());
+    }
+    for(int b = 0; b < bc; ++b)
+        CHECK_HIP_ERROR(hipMemcpy(dA0[b], dA[b], sizeof(T) * size_A, hipMemcpyDeviceToDevice));
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_potrf(
+        FORTRAN, handle, uplo, n, dA.data(), lda, stA, dWork.data(), lwork, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // error is ||A - LL'|| / ||A||, computed on the device
+    // using frobenius norm
+    device_blas_handle blas(handle);
+    double             err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        if(n == 0 || hInfoRes[b][0] != 0)
+            continue;
+        device_potrf_residual<T>(blas, uplo, n, dA0[b], lda, dA[b], lda, dTmp.data(), &err);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // the matrices are positive definite, so also check info
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hInfoRes[b][0] != 0)
+            err++;
+    *max_err += err;
+}
+
 template <bool FORTRAN, typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh>
 void potrf_getPerfData(const hipsolverHandle_t   handle,
                        const hipsolverFillMode_t uplo,
@@ -211,7 +282,8 @@ void potrf_getPerfData(const hipsolverHandle_t   handle,
                        double*                   gpu_time_used,
                        double*                   cpu_time_used,
                        const int                 hot_calls,
-                       const bool                perf)
+                       const bool                perf,
+                       const bool                e2e)
 {
     if(!perf)
     {
@@ -224,30 +296,59 @@ void potrf_getPerfData(const hipsolverHandle_t   handle,
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    potrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+    // in perf mode, the matrices are generated on the device; in e2e mode, every call copies the
+    // host matrices to the device and the results back
+    if(!perf || e2e)
+        potrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
-        potrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+        if(e2e)
+            CHECK_HIP_ERROR(dA.transfer_from_async(hA, stream));
+        else if(perf)
+            potrf_initDeviceData<T>(handle, n, dA, lda, bc);
+        else
+            potrf_initData<false, true, T>(
+                handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
 
         CHECK_ROCBLAS_ERROR(hipsolver_potrf(
             FORTRAN, handle, uplo, n, dA.data(), lda, stA, dWork.data(), lwork, dInfo.data(), bc));
+
+        if(e2e)
+        {
+            CHECK_HIP_ERROR(hATmp.transfer_from_async(dA, stream));
+            CHECK_HIP_ERROR(hInfo.transfer_from_async(dInfo, stream));
+        }
     }
 
     // gpu-lapack performance
-    hipStream_t stream;
-    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
-        potrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
-
-        start = get_time_us_sync(stream);
+        if(!e2e && perf)
+            potrf_initDeviceData<T>(handle, n, dA, lda, bc);
+        else if(!e2e)
+            potrf_initData<false, true, T>(
+                handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hATmp, hInfo);
+
+        timer.start();
+        if(e2e)
+            CHECK_HIP_ERROR(dA.transfer_from_async(hA, stream));
         hipsolver_potrf(
             FORTRAN, handle, uplo, n, dA.data(), lda, stA, dWork.data(), lwork, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        if(e2e)
+        {
+            CHECK_HIP_ERROR(hATmp.transfer_from_async(dA, stream));
+            CHECK_HIP_ERROR(hInfo.transfer_from_async(dInfo, stream));
+        }
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -263,11 +364,23 @@ void testing_potrf(Arguments& argus)
     int                    stA   = argus.get<int>("strideA", lda * n);
     int                    bc    = argus.batch_count;
 
+    // algorithm hints
+    int alg            = argus.get<int>("alg", 0);
+    int unblocked_size = argus.get<int>("unblocked_size", 0);
+
     hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
     int                 hot_calls = argus.iters;
 
-    // hARes should always be allocated (used in initData)
-    size_t stARes = stA;
+    // the host matrices are only needed to check the results against the host reference, to
+    // measure the cpu-lapack performance, or to time the host-device copies; otherwise, the input
+    // is generated on the device
+    bool host_data = ((argus.unit_check || argus.norm_check) && !argus.device_verify)
+                     || (argus.timing && (!argus.perf || argus.e2e));
+    host_memory mem = argus.pinned ? host_memory::pinned : host_memory::pageable;
+
+    // hA and hARes are used together by initData, so both are allocated when there is host data
+    size_t stARes = host_data ? stA : 0;
+    size_t stAh   = host_data ? stA : 0;
 
     // check non-supported values
     if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
@@ -309,12 +422,22 @@ void testing_potrf(Arguments& argus)
         return;
     }
 
+    if(hipsolver_set_adv_options(handle, HIPSOLVERDN_POTRF, alg, 1, unblocked_size)
+       != HIPSOLVER_STATUS_SUCCESS)
+    {
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
     // determine sizes
     size_t size_A    = size_t(lda) * n;
     double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
 
-    // hARes should always be allocated (used in initData)
-    size_t size_ARes = size_A;
+    // hA and hARes are used together by initData, so both are allocated when there is host data
+    size_t size_ARes = host_data ? size_A : 0;
+    size_t size_Ah   = host_data ? size_A : 0;
 
     // check invalid sizes
     bool invalid_size = (n < 0 || lda < n || bc < 0);
@@ -360,8 +483,8 @@ void testing_potrf(Arguments& argus)
     if(BATCHED)
     {
         // memory allocations
-        host_batch_vector<T>             hA(size_A, 1, bc);
-        host_batch_vector<T>             hARes(size_ARes, 1, bc);
+        host_batch_vector<T>             hA(size_Ah, 1, bc, mem);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc, mem);
         host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
         host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
         device_batch_vector<T>           dA(size_A, 1, bc);
@@ -377,7 +500,20 @@ void testing_potrf(Arguments& argus)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
-        if(argus.unit_check || argus.norm_check)
+        if((argus.unit_check || argus.norm_check) && argus.device_verify)
+            potrf_getDeviceError<FORTRAN, T>(handle,
+                                             uplo,
+                                             n,
+                                             dA,
+                                             lda,
+                                             stA,
+                                             dWork,
+                                             size_W,
+                                             dInfo,
+                                             bc,
+                                             hInfoRes,
+                                             &max_error);
+        else if(argus.unit_check || argus.norm_check)
             potrf_getError<FORTRAN, T>(handle,
                                        uplo,
                                        n,
@@ -412,14 +548,15 @@ void testing_potrf(Arguments& argus)
                                           &gpu_time_used,
                                           &cpu_time_used,
                                           hot_calls,
-                                          argus.perf);
+                                          argus.perf,
+                                          argus.e2e);
     }
 
     else
     {
         // memory allocations
-        host_strided_batch_vector<T>     hA(size_A, 1, stA, bc);
-        host_strided_batch_vector<T>     hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T>     hA(size_Ah, 1, stAh, bc, mem);
+        host_strided_batch_vector<T>     hARes(size_ARes, 1, stARes, bc, mem);
         host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
         host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
         device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
@@ -435,7 +572,20 @@ void testing_potrf(Arguments& argus)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
-        if(argus.unit_check || argus.norm_check)
+        if((argus.unit_check || argus.norm_check) && argus.device_verify)
+            potrf_getDeviceError<FORTRAN, T>(handle,
+                                             uplo,
+                                             n,
+                                             dA,
+                                             lda,
+                                             stA,
+                                             dWork,
+                                             size_W,
+                                             dInfo,
+                                             bc,
+                                             hInfoRes,
+                                             &max_error);
+        else if(argus.unit_check || argus.norm_check)
             potrf_getError<FORTRAN, T>(handle,
                                        uplo,
                                        n,
@@ -470,7 +620,8 @@ void testing_potrf(Arguments& argus)
                                           &gpu_time_used,
                                           &cpu_time_used,
                                           hot_calls,
-                                          argus.perf);
+                                          argus.perf,
+                                          argus.e2e);
     }
 
     // validate results for rocsolver-test
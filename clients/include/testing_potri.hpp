@@ -0,0 +1,348 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, typename T>
+void potri_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        T*                        dA,
+                        const int                 lda,
+                        T*                        dWork,
+                        const int                 lwork,
+                        int*                      dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_potri(FORTRAN, nullptr, uplo, n, dA, lda, dWork, lwork, dInfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potri(
+            FORTRAN, handle, hipsolverFillMode_t(-1), n, dA, lda, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potri(FORTRAN, handle, uplo, n, (T*)nullptr, lda, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_potri(FORTRAN, handle, uplo, n, dA, lda, dWork, lwork, (int*)nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <bool FORTRAN, typename T>
+void testing_potri_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    n    = 1;
+    int                    lda  = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_potri_bufferSize(FORTRAN, handle, uplo, n, dA.data(), lda, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    potri_checkBadArgs<FORTRAN>(
+        handle, uplo, n, dA.data(), lda, dWork.data(), size_W, dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void potri_initData(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    Td&                       dA,
+                    const int                 lda,
+                    Th&                       hA,
+                    Th&                       hATmp)
+{
+    if(CPU)
+    {
+        int info;
+        rocblas_init<T>(hATmp, true);
+
+        // make A hermitian and scale to ensure positive definiteness
+        cblas_gemm(HIPSOLVER_OP_N,
+                   HIPSOLVER_OP_C,
+                   n,
+                   n,
+                   n,
+                   (T)1.0,
+                   hATmp[0],
+                   lda,
+                   hATmp[0],
+                   lda,
+                   (T)0.0,
+                   hA[0],
+                   lda);
+
+        for(int i = 0; i < n; i++)
+            hA[0][i + i * lda] += 400;
+
+        // do the Cholesky factorization of matrix A w/ the reference LAPACK routine
+        cblas_potrf<T>(uplo, n, hA[0], lda, &info);
+    }
+
+    if(GPU)
+    {
+        // now copy the factorization to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potri_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    Td&                       dA,
+                    const int                 lda,
+                    Td&                       dWork,
+                    const int                 lwork,
+                    Ud&                       dInfo,
+                    Th&                       hA,
+                    Th&                       hARes,
+                    Uh&                       hInfo,
+                    Uh&                       hInfoRes,
+                    double*                   max_err)
+{
+    // input data initialization
+    potri_initData<true, true, T>(handle, uplo, n, dA, lda, hA, hARes);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_potri(
+        FORTRAN, handle, uplo, n, dA.data(), lda, dWork.data(), lwork, dInfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cblas_potri<T>(uplo, n, hA[0], lda, hInfo[0]);
+
+    // error is ||hA - hARes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm over the referenced triangle
+    if(uplo == HIPSOLVER_FILL_MODE_UPPER)
+        *max_err = norm_error_upperTr('F', n, n, lda, hA[0], hARes[0]);
+    else
+        *max_err = norm_error_lowerTr('F', n, n, lda, hA[0], hARes[0]);
+
+    // also check info
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err += 1;
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potri_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const int                 n,
+                       Td&                       dA,
+                       const int                 lda,
+                       Td&                       dWork,
+                       const int                 lwork,
+                       Ud&                       dInfo,
+                       Th&                       hA,
+                       Th&                       hATmp,
+                       Uh&                       hInfo,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf)
+{
+    if(!perf)
+    {
+        potri_initData<true, false, T>(handle, uplo, n, dA, lda, hA, hATmp);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_potri<T>(uplo, n, hA[0], lda, hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potri_initData<true, false, T>(handle, uplo, n, dA, lda, hA, hATmp);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potri_initData<false, true, T>(handle, uplo, n, dA, lda, hA, hATmp);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_potri(
+            FORTRAN, handle, uplo, n, dA.data(), lda, dWork.data(), lwork, dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        potri_initData<false, true, T>(handle, uplo, n, dA, lda, hA, hATmp);
+
+        timer.start();
+        hipsolver_potri(
+            FORTRAN, handle, uplo, n, dA.data(), lda, dWork.data(), lwork, dInfo.data());
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, typename T>
+void testing_potri(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    lda   = argus.get<int>("lda", n);
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_potri(
+                FORTRAN, handle, uplo, n, (T*)nullptr, lda, (T*)nullptr, 0, (int*)nullptr),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // hARes should always be allocated (used in initData)
+    size_t size_ARes = size_A;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            hipsolver_potri(
+                FORTRAN, handle, uplo, n, (T*)nullptr, lda, (T*)nullptr, 0, (int*)nullptr),
+            HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_potri_bufferSize(FORTRAN, handle, uplo, n, dA.data(), lda, &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potri_getError<FORTRAN, T>(handle,
+                                   uplo,
+                                   n,
+                                   dA,
+                                   lda,
+                                   dWork,
+                                   size_W,
+                                   dInfo,
+                                   hA,
+                                   hARes,
+                                   hInfo,
+                                   hInfoRes,
+                                   &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        potri_getPerfData<FORTRAN, T>(handle,
+                                      uplo,
+                                      n,
+                                      dA,
+                                      lda,
+                                      dWork,
+                                      size_W,
+                                      dInfo,
+                                      hA,
+                                      hARes,
+                                      hInfo,
+                                      &gpu_time_used,
+                                      &cpu_time_used,
+                                      hot_calls,
+                                      argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "n", "lda");
+            rocsolver_bench_output(uploC, n, lda);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
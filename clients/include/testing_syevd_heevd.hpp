@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename S, typename U>
+template <bool FORTRAN, bool STRIDED, typename T, typename S, typename U, typename V>
 void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverEigMode_t  evect,
                               const hipsolverFillMode_t uplo,
@@ -16,19 +16,19 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                               const int                 stA,
                               S                         dD,
                               const int                 stD,
-                              T                         dWork,
+                              V                         dWork,
                               const int                 lwork,
                               U                         dinfo,
                               const int                 bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            FORTRAN, nullptr, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, dinfo, bc),
-        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(
+        FORTRAN, STRIDED, nullptr, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, dinfo, bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 hipsolverEigMode_t(-1),
                                                 uplo,
@@ -44,6 +44,7 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 evect,
                                                 hipsolverFillMode_t(-1),
@@ -62,6 +63,7 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 evect,
                                                 uplo,
@@ -77,6 +79,7 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 evect,
                                                 uplo,
@@ -91,10 +94,22 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 dinfo,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            FORTRAN, handle, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, (U) nullptr, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dD,
+                                                stD,
+                                                dWork,
+                                                lwork,
+                                                (U) nullptr,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
@@ -115,35 +130,46 @@ void testing_syevd_heevd_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<S>   dD(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dD.memcheck());
-        // CHECK_HIP_ERROR(dinfo.memcheck());
-
-        // int size_W;
-        // hipsolver_syevd_heevd_bufferSize(
-        //     FORTRAN, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // syevd_heevd_checkBadArgs<FORTRAN>(handle,
-        //                                   evect,
-        //                                   uplo,
-        //                                   n,
-        //                                   dA.data(),
-        //                                   lda,
-        //                                   stA,
-        //                                   dD.data(),
-        //                                   stD,
-        //                                   dWork.data(),
-        //                                   size_W,
-        //                                   dinfo.data(),
-        //                                   bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<S>   dD(1, 1, 1, 1);
+        device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        int size_W;
+        hipsolver_syevd_heevd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        syevd_heevd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   evect,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dD.data(),
+                                                   stD,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dinfo.data(),
+                                                   bc);
     }
     else
     {
@@ -156,26 +182,37 @@ void testing_syevd_heevd_bad_arg()
         CHECK_HIP_ERROR(dinfo.memcheck());
 
         int size_W;
-        hipsolver_syevd_heevd_bufferSize(
-            FORTRAN, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W);
+        hipsolver_syevd_heevd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        syevd_heevd_checkBadArgs<FORTRAN>(handle,
-                                          evect,
-                                          uplo,
-                                          n,
-                                          dA.data(),
-                                          lda,
-                                          stA,
-                                          dD.data(),
-                                          stD,
-                                          dWork.data(),
-                                          size_W,
-                                          dinfo.data(),
-                                          bc);
+        syevd_heevd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   evect,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dD.data(),
+                                                   stD,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dinfo.data(),
+                                                   bc);
     }
 }
 
@@ -227,11 +264,27 @@ void syevd_heevd_initData(const hipsolverHandle_t  handle,
     }
 }
 
+template <typename T, typename Td>
+void syevd_heevd_initDeviceData(const hipsolverHandle_t handle,
+                                const int               n,
+                                Td&                     dA,
+                                const int               lda,
+                                const int               bc)
+{
+    // generate the matrices directly on the device;
+    // the dominant diagonal avoids singularities, as for the host data
+    device_rand_generator rng(handle);
+    for(int b = 0; b < bc; ++b)
+        rocblas_init_device_diag_dominant<T>(rng, dA[b], n, n, lda);
+}
+
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
           typename Id,
+          typename Vd,
           typename Sh,
           typename Th,
           typename Ih>
@@ -244,7 +297,7 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
                           const int                 stA,
                           Sd&                       dD,
                           const int                 stD,
-                          Td&                       dWork,
+                          Vd&                       dWork,
                           const int                 lwork,
                           Id&                       dinfo,
                           const int                 bc,
@@ -283,6 +336,7 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(FORTRAN,
+                                              STRIDED,
                                               handle,
                                               evect,
                                               uplo,
@@ -303,6 +357,7 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hAres.transfer_from(dA));
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1) firstprivate(work, hE, iwork)
     for(int b = 0; b < bc; ++b)
         cblas_syevd_heevd<T>(evect,
                              uplo,
@@ -377,10 +432,92 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Vd,
+          typename Sh,
+          typename Ih>
+void syevd_heevd_getDeviceError(const hipsolverHandle_t   handle,
+                                const hipsolverFillMode_t uplo,
+                                const int                 n,
+                                Td&                       dA,
+                                const int                 lda,
+                                const int                 stA,
+                                Sd&                       dD,
+                                const int                 stD,
+                                Vd&                       dWork,
+                                const int                 lwork,
+                                Id&                       dinfo,
+                                const int                 bc,
+                                Sh&                       hDres,
+                                Ih&                       hinfoRes,
+                                double*                   max_err)
+{
+    // input data initialization
+    syevd_heevd_initDeviceData<T>(handle, n, dA, lda, bc);
+
+    // keep the original matrices on the device
+    size_t                         size_A = size_t(lda) * n;
+    device_strided_batch_vector<T> dA0(size_A, 1, size_A, bc);
+    device_strided_batch_vector<T> dTmp(2 * size_t(n) * n, 1, 2 * size_t(n) * n, 1);
+    if(size_A)
+    {
+        CHECK_HIP_ERROR(dA0.memcheck());
+        CHECK_HIP_ERROR(dTmp.memcheck());
+    }
+    for(int b = 0; b < bc; ++b)
+        CHECK_HIP_ERROR(hipMemcpy(dA0[b], dA[b], sizeof(T) * size_A, hipMemcpyDeviceToDevice));
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(FORTRAN,
+                                              STRIDED,
+                                              handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              uplo,
+                                              n,
+                                              dA.data(),
+                                              lda,
+                                              stA,
+                                              dD.data(),
+                                              stD,
+                                              dWork.data(),
+                                              lwork,
+                                              dinfo.data(),
+                                              bc));
+
+    CHECK_HIP_ERROR(hDres.transfer_from(dD));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // error is ||AV - VD|| / ||A||, computed on the device
+    // using frobenius norm
+    device_blas_handle blas(handle);
+    double             err;
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        if(n == 0)
+            continue;
+        if(hinfoRes[b][0] != 0)
+        {
+            *max_err += 1;
+            continue;
+        }
+        device_eig_residual<T>(blas, uplo, n, dA0[b], lda, dA[b], lda, hDres[b], dTmp.data(), &err);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
           typename Id,
+          typename Vd,
           typename Sh,
           typename Th,
           typename Ih>
@@ -393,17 +530,19 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
                              const int                 stA,
                              Sd&                       dD,
                              const int                 stD,
-                             Td&                       dWork,
+                             Vd&                       dWork,
                              const int                 lwork,
                              Id&                       dinfo,
                              const int                 bc,
                              Th&                       hA,
+                             Th&                       hAres,
                              Sh&                       hD,
                              Ih&                       hinfo,
                              double*                   gpu_time_used,
                              double*                   cpu_time_used,
                              const int                 hot_calls,
-                             const bool                perf)
+                             const bool                perf,
+                             const bool                e2e)
 {
     constexpr bool COMPLEX = is_complex<T>;
     using S                = decltype(std::real(T{}));
@@ -449,14 +588,26 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
 
-    syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+    // in perf mode, the matrices are generated on the device; in e2e mode, every call copies the
+    // host matrices to the device and the results back
+    if(!perf || e2e)
+        syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
-        syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+        if(e2e)
+            CHECK_HIP_ERROR(dA.transfer_from_async(hA, stream));
+        else if(perf)
+            syevd_heevd_initDeviceData<T>(handle, n, dA, lda, bc);
+        else
+            syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
         CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   evect,
                                                   uplo,
@@ -470,19 +621,30 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
                                                   lwork,
                                                   dinfo.data(),
                                                   bc));
+
+        if(e2e)
+        {
+            CHECK_HIP_ERROR(hAres.transfer_from_async(dA, stream));
+            CHECK_HIP_ERROR(hD.transfer_from_async(dD, stream));
+            CHECK_HIP_ERROR(hinfo.transfer_from_async(dinfo, stream));
+        }
     }
 
     // gpu-lapack performance
-    hipStream_t stream;
-    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
-        syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+        if(!e2e && perf)
+            syevd_heevd_initDeviceData<T>(handle, n, dA, lda, bc);
+        else if(!e2e)
+            syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start();
+        if(e2e)
+            CHECK_HIP_ERROR(dA.transfer_from_async(hA, stream));
         hipsolver_syevd_heevd(FORTRAN,
+                              STRIDED,
                               handle,
                               evect,
                               uplo,
@@ -496,7 +658,15 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
                               lwork,
                               dinfo.data(),
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        if(e2e)
+        {
+            CHECK_HIP_ERROR(hAres.transfer_from_async(dA, stream));
+            CHECK_HIP_ERROR(hD.transfer_from_async(dD, stream));
+            CHECK_HIP_ERROR(hinfo.transfer_from_async(dinfo, stream));
+        }
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -520,11 +690,24 @@ void testing_syevd_heevd(Arguments& argus)
     int                 bc        = argus.batch_count;
     int                 hot_calls = argus.iters;
 
+    // the host matrices are only needed to check the results against the host reference, to
+    // measure the cpu-lapack performance, or to time the host-device copies; otherwise, the input
+    // is generated on the device
+    bool host_check = (argus.unit_check || argus.norm_check)
+                      && !(argus.device_verify && evect == HIPSOLVER_EIG_MODE_VECTOR);
+    bool host_data  = host_check || (argus.timing && (!argus.perf || argus.e2e));
+    bool host_res   = host_check || (argus.timing && argus.e2e);
+
+    host_memory mem = argus.pinned ? host_memory::pinned : host_memory::pageable;
+
     // determine sizes
     size_t size_A    = size_t(lda) * n;
     size_t size_D    = n;
-    size_t size_Ares = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_Ah   = host_data ? size_A : 0;
+    size_t size_Ares = host_res ? size_A : 0;
     size_t size_Dres = (argus.unit_check || argus.norm_check) ? size_D : 0;
+    int    stAh      = host_data ? stA : 0;
+    int    stAres    = host_res ? stA : 0;
 
     double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
 
@@ -534,25 +717,27 @@ void testing_syevd_heevd(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
-            //                                             handle,
-            //                                             evect,
-            //                                             uplo,
-            //                                             n,
-            //                                             (T* const*)nullptr,
-            //                                             lda,
-            //                                             stA,
-            //                                             (S*)nullptr,
-            //                                             stD,
-            //                                             (T*)nullptr,
-            //                                             0,
-            //                                             (int*)nullptr,
-            //                                             bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        evect,
+                                                        uplo,
+                                                        n,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (S*)nullptr,
+                                                        stD,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(FORTRAN,
+                                                        STRIDED,
                                                         handle,
                                                         evect,
                                                         uplo,
@@ -590,135 +775,199 @@ void testing_syevd_heevd(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>   hA(size_A, 1, bc);
-        // host_batch_vector<T>   hAres(size_Ares, 1, bc);
-        // device_batch_vector<T> dA(size_A, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-
-        // int size_W;
-        // hipsolver_syevd_heevd_bufferSize(
-        //     FORTRAN, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        // {
-        //     syevd_heevd_getError<FORTRAN, T>(handle,
-        //                                      evect,
-        //                                      uplo,
-        //                                      n,
-        //                                      dA,
-        //                                      lda,
-        //                                      stA,
-        //                                      dD,
-        //                                      stD,
-        //                                      dWork,
-        //                                      size_W,
-        //                                      dinfo,
-        //                                      bc,
-        //                                      hA,
-        //                                      hAres,
-        //                                      hD,
-        //                                      hDres,
-        //                                      hinfo,
-        //                                      hinfoRes,
-        //                                      &max_error);
-        // }
-
-        // // collect performance data
-        // if(argus.timing)
-        // {
-        //     syevd_heevd_getPerfData<FORTRAN, T>(handle,
-        //                                         evect,
-        //                                         uplo,
-        //                                         n,
-        //                                         dA,
-        //                                         lda,
-        //                                         stA,
-        //                                         dD,
-        //                                         stD,
-        //                                         dWork,
-        //                                         size_W,
-        //                                         dinfo,
-        //                                         bc,
-        //                                         hA,
-        //                                         hD,
-        //                                         hinfo,
-        //                                         &gpu_time_used,
-        //                                         &cpu_time_used,
-        //                                         hot_calls,
-        //                                         argus.perf);
-        // }
+        // memory allocations
+        host_batch_vector<T>   hA(size_Ah, 1, bc, mem);
+        host_batch_vector<T>   hAres(size_Ares, 1, bc, mem);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        int size_W;
+        hipsolver_syevd_heevd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if((argus.unit_check || argus.norm_check) && argus.device_verify
+           && evect == HIPSOLVER_EIG_MODE_VECTOR)
+        {
+            syevd_heevd_getDeviceError<FORTRAN, STRIDED, T>(handle,
+                                                            uplo,
+                                                            n,
+                                                            dA,
+                                                            lda,
+                                                            stA,
+                                                            dD,
+                                                            stD,
+                                                            dWork,
+                                                            size_W,
+                                                            dinfo,
+                                                            bc,
+                                                            hDres,
+                                                            hinfoRes,
+                                                            &max_error);
+        }
+        else if(argus.unit_check || argus.norm_check)
+        {
+            syevd_heevd_getError<FORTRAN, STRIDED, T>(handle,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dD,
+                                                      stD,
+                                                      dWork,
+                                                      size_W,
+                                                      dinfo,
+                                                      bc,
+                                                      hA,
+                                                      hAres,
+                                                      hD,
+                                                      hDres,
+                                                      hinfo,
+                                                      hinfoRes,
+                                                      &max_error);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            syevd_heevd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         evect,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dD,
+                                                         stD,
+                                                         dWork,
+                                                         size_W,
+                                                         dinfo,
+                                                         bc,
+                                                         hA,
+                                                         hAres,
+                                                         hD,
+                                                         hinfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf,
+                                                         argus.e2e);
+        }
     }
 
     else
     {
         // memory allocations
-        host_strided_batch_vector<T>   hA(size_A, 1, stA, bc);
-        host_strided_batch_vector<T>   hAres(size_Ares, 1, stA, bc);
+        host_strided_batch_vector<T>   hA(size_Ah, 1, stAh, bc, mem);
+        host_strided_batch_vector<T>   hAres(size_Ares, 1, stAres, bc, mem);
         device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
         if(size_A)
             CHECK_HIP_ERROR(dA.memcheck());
 
         int size_W;
-        hipsolver_syevd_heevd_bufferSize(
-            FORTRAN, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W);
+        hipsolver_syevd_heevd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
-        if(argus.unit_check || argus.norm_check)
+        if((argus.unit_check || argus.norm_check) && argus.device_verify
+           && evect == HIPSOLVER_EIG_MODE_VECTOR)
         {
-            syevd_heevd_getError<FORTRAN, T>(handle,
-                                             evect,
-                                             uplo,
-                                             n,
-                                             dA,
-                                             lda,
-                                             stA,
-                                             dD,
-                                             stD,
-                                             dWork,
-                                             size_W,
-                                             dinfo,
-                                             bc,
-                                             hA,
-                                             hAres,
-                                             hD,
-                                             hDres,
-                                             hinfo,
-                                             hinfoRes,
-                                             &max_error);
+            syevd_heevd_getDeviceError<FORTRAN, STRIDED, T>(handle,
+                                                            uplo,
+                                                            n,
+                                                            dA,
+                                                            lda,
+                                                            stA,
+                                                            dD,
+                                                            stD,
+                                                            dWork,
+                                                            size_W,
+                                                            dinfo,
+                                                            bc,
+                                                            hDres,
+                                                            hinfoRes,
+                                                            &max_error);
+        }
+        else if(argus.unit_check || argus.norm_check)
+        {
+            syevd_heevd_getError<FORTRAN, STRIDED, T>(handle,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dD,
+                                                      stD,
+                                                      dWork,
+                                                      size_W,
+                                                      dinfo,
+                                                      bc,
+                                                      hA,
+                                                      hAres,
+                                                      hD,
+                                                      hDres,
+                                                      hinfo,
+                                                      hinfoRes,
+                                                      &max_error);
         }
 
         // collect performance data
         if(argus.timing)
         {
-            syevd_heevd_getPerfData<FORTRAN, T>(handle,
-                                                evect,
-                                                uplo,
-                                                n,
-                                                dA,
-                                                lda,
-                                                stA,
-                                                dD,
-                                                stD,
-                                                dWork,
-                                                size_W,
-                                                dinfo,
-                                                bc,
-                                                hA,
-                                                hD,
-                                                hinfo,
-                                                &gpu_time_used,
-                                                &cpu_time_used,
-                                                hot_calls,
-                                                argus.perf);
+            syevd_heevd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         evect,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dD,
+                                                         stD,
+                                                         dWork,
+                                                         size_W,
+                                                         dinfo,
+                                                         bc,
+                                                         hA,
+                                                         hAres,
+                                                         hD,
+                                                         hinfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf,
+                                                         argus.e2e);
         }
     }
 
@@ -0,0 +1,764 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, typename T, typename S>
+void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
+                                const hipsolverEigMode_t  evect,
+                                const hipsolverEigRange_t erange,
+                                const hipsolverFillMode_t uplo,
+                                const int                 n,
+                                T*                        dA,
+                                const int                 lda,
+                                const S                   vl,
+                                const S                   vu,
+                                const int                 il,
+                                const int                 iu,
+                                int*                      hNev,
+                                S*                        dW,
+                                T*                        dWork,
+                                const int                 lwork,
+                                int*                      dinfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  nullptr,
+                                                  evect,
+                                                  erange,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  hNev,
+                                                  dW,
+                                                  dWork,
+                                                  lwork,
+                                                  dinfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  handle,
+                                                  hipsolverEigMode_t(-1),
+                                                  erange,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  hNev,
+                                                  dW,
+                                                  dWork,
+                                                  lwork,
+                                                  dinfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  handle,
+                                                  evect,
+                                                  hipsolverEigRange_t(-1),
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  hNev,
+                                                  dW,
+                                                  dWork,
+                                                  lwork,
+                                                  dinfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  handle,
+                                                  evect,
+                                                  erange,
+                                                  hipsolverFillMode_t(-1),
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  hNev,
+                                                  dW,
+                                                  dWork,
+                                                  lwork,
+                                                  dinfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  handle,
+                                                  evect,
+                                                  erange,
+                                                  uplo,
+                                                  n,
+                                                  (T*)nullptr,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  hNev,
+                                                  dW,
+                                                  dWork,
+                                                  lwork,
+                                                  dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  handle,
+                                                  evect,
+                                                  erange,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  (int*)nullptr,
+                                                  dW,
+                                                  dWork,
+                                                  lwork,
+                                                  dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  handle,
+                                                  evect,
+                                                  erange,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  hNev,
+                                                  (S*)nullptr,
+                                                  dWork,
+                                                  lwork,
+                                                  dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                  handle,
+                                                  evect,
+                                                  erange,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  vl,
+                                                  vu,
+                                                  il,
+                                                  iu,
+                                                  hNev,
+                                                  dW,
+                                                  dWork,
+                                                  lwork,
+                                                  (int*)nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <bool FORTRAN, typename T>
+void testing_syevdx_heevdx_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    n      = 1;
+    int                    lda    = 1;
+    S                      vl     = 0;
+    S                      vu     = 1;
+    int                    il     = 1;
+    int                    iu     = 1;
+    int                    hNev;
+    hipsolverEigMode_t     evect  = HIPSOLVER_EIG_MODE_NOVECTOR;
+    hipsolverEigRange_t    erange = HIPSOLVER_EIG_RANGE_ALL;
+    hipsolverFillMode_t    uplo   = HIPSOLVER_FILL_MODE_UPPER;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<S>   dW(1, 1, 1, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int size_W;
+    hipsolver_syevdx_heevdx_bufferSize(FORTRAN,
+                                       handle,
+                                       evect,
+                                       erange,
+                                       uplo,
+                                       n,
+                                       dA.data(),
+                                       lda,
+                                       vl,
+                                       vu,
+                                       il,
+                                       iu,
+                                       &hNev,
+                                       dW.data(),
+                                       &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    syevdx_heevdx_checkBadArgs<FORTRAN>(handle,
+                                        evect,
+                                        erange,
+                                        uplo,
+                                        n,
+                                        dA.data(),
+                                        lda,
+                                        vl,
+                                        vu,
+                                        il,
+                                        iu,
+                                        &hNev,
+                                        dW.data(),
+                                        dWork.data(),
+                                        size_W,
+                                        dinfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void syevdx_heevdx_initData(const hipsolverHandle_t  handle,
+                            const hipsolverEigMode_t evect,
+                            const int                n,
+                            Td&                      dA,
+                            const int                lda,
+                            Th&                      hA,
+                            std::vector<T>&          A,
+                            bool                     test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+
+        // make copy of original data to test vectors if required
+        if(test && evect == HIPSOLVER_EIG_MODE_VECTOR)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                for(int j = 0; j < n; j++)
+                    A[i + j * lda] = hA[0][i + j * lda];
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool FORTRAN,
+          typename T,
+          typename S,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void syevdx_heevdx_getError(const hipsolverHandle_t   handle,
+                            const hipsolverEigMode_t  evect,
+                            const hipsolverEigRange_t erange,
+                            const hipsolverFillMode_t uplo,
+                            const int                 n,
+                            Td&                       dA,
+                            const int                 lda,
+                            const S                   vl,
+                            const S                   vu,
+                            const int                 il,
+                            const int                 iu,
+                            Sd&                       dW,
+                            Td&                       dWork,
+                            const int                 lwork,
+                            Id&                       dinfo,
+                            Th&                       hA,
+                            Th&                       hAres,
+                            int*                      hNev,
+                            int*                      hNevRes,
+                            Sh&                       hW,
+                            Sh&                       hWres,
+                            Ih&                       hinfo,
+                            Ih&                       hinfoRes,
+                            double*                   max_err)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+
+    int              ltwork = (COMPLEX ? 2 * n : 8 * n);
+    std::vector<T>   work(std::max(ltwork, 1));
+    std::vector<S>   rwork(7 * n);
+    std::vector<int> iwork(5 * n);
+    std::vector<int> ifail(n);
+    std::vector<T>   Z(lda * n);
+    std::vector<T>   A(lda * n);
+
+    // input data initialization
+    syevdx_heevdx_initData<true, true, T>(handle, evect, n, dA, lda, hA, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_syevdx_heevdx(FORTRAN,
+                                                handle,
+                                                evect,
+                                                erange,
+                                                uplo,
+                                                n,
+                                                dA.data(),
+                                                lda,
+                                                vl,
+                                                vu,
+                                                il,
+                                                iu,
+                                                hNevRes,
+                                                dW.data(),
+                                                dWork.data(),
+                                                lwork,
+                                                dinfo.data()));
+
+    CHECK_HIP_ERROR(hWres.transfer_from(dW));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(evect == HIPSOLVER_EIG_MODE_VECTOR)
+        CHECK_HIP_ERROR(hAres.transfer_from(dA));
+
+    // CPU lapack
+    cblas_syevx_heevx<T>(evect,
+                         erange,
+                         uplo,
+                         n,
+                         hA[0],
+                         lda,
+                         vl,
+                         vu,
+                         il,
+                         iu,
+                         S(0),
+                         hNev,
+                         hW[0],
+                         Z.data(),
+                         lda,
+                         work.data(),
+                         ltwork,
+                         rwork.data(),
+                         iwork.data(),
+                         ifail.data(),
+                         hinfo[0]);
+
+    // check info and the number of eigenvalues found
+    *max_err = 0;
+    if(hinfo[0][0] != hinfoRes[0][0])
+        *max_err += 1;
+    if(*hNev != *hNevRes)
+    {
+        *max_err += 1;
+        return;
+    }
+
+    // (We expect the used input matrices to always converge. Testing
+    // implicitly the equivalent non-converged matrix is very complicated and it boils
+    // down to essentially run the algorithm again and until convergence is achieved).
+
+    double err;
+    int    nev = *hNev;
+
+    if(hinfo[0][0] == 0 && nev > 0)
+    {
+        // error of the selected eigenvalues is ||hW - hWRes|| / ||hW||
+        // using frobenius norm
+        err      = norm_error('F', 1, nev, 1, hW[0], hWres[0]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        if(evect == HIPSOLVER_EIG_MODE_VECTOR)
+        {
+            // the eigenvectors are not unique under scaling, so they are tested implicitly.
+            // hAres contains the nev selected eigenvectors x
+            T alpha;
+            T beta = 0;
+            for(int j = 0; j < nev; j++)
+            {
+                // compute (1/lambda)*A*x and store in Z
+                alpha = T(1) / hWres[0][j];
+                cblas_symv_hemv(uplo,
+                                n,
+                                alpha,
+                                A.data(),
+                                lda,
+                                hAres[0] + j * lda,
+                                1,
+                                beta,
+                                Z.data() + j * lda,
+                                1);
+            }
+
+            // error is ||Z - hARes|| / ||Z||
+            // using frobenius norm
+            err      = norm_error('F', n, nev, lda, Z.data(), hAres[0]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool FORTRAN,
+          typename T,
+          typename S,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void syevdx_heevdx_getPerfData(const hipsolverHandle_t   handle,
+                               const hipsolverEigMode_t  evect,
+                               const hipsolverEigRange_t erange,
+                               const hipsolverFillMode_t uplo,
+                               const int                 n,
+                               Td&                       dA,
+                               const int                 lda,
+                               const S                   vl,
+                               const S                   vu,
+                               const int                 il,
+                               const int                 iu,
+                               Sd&                       dW,
+                               Td&                       dWork,
+                               const int                 lwork,
+                               Id&                       dinfo,
+                               Th&                       hA,
+                               int*                      hNev,
+                               Sh&                       hW,
+                               Ih&                       hinfo,
+                               double*                   gpu_time_used,
+                               double*                   cpu_time_used,
+                               const int                 hot_calls,
+                               const bool                perf)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+
+    int              ltwork = (COMPLEX ? 2 * n : 8 * n);
+    std::vector<T>   work(std::max(ltwork, 1));
+    std::vector<S>   rwork(7 * n);
+    std::vector<int> iwork(5 * n);
+    std::vector<int> ifail(n);
+    std::vector<T>   Z(lda * n);
+    std::vector<T>   A;
+
+    if(!perf)
+    {
+        syevdx_heevdx_initData<true, false, T>(handle, evect, n, dA, lda, hA, A, false);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_syevx_heevx<T>(evect,
+                             erange,
+                             uplo,
+                             n,
+                             hA[0],
+                             lda,
+                             vl,
+                             vu,
+                             il,
+                             iu,
+                             S(0),
+                             hNev,
+                             hW[0],
+                             Z.data(),
+                             lda,
+                             work.data(),
+                             ltwork,
+                             rwork.data(),
+                             iwork.data(),
+                             ifail.data(),
+                             hinfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    syevdx_heevdx_initData<true, false, T>(handle, evect, n, dA, lda, hA, A, false);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        syevdx_heevdx_initData<false, true, T>(handle, evect, n, dA, lda, hA, A, false);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_syevdx_heevdx(FORTRAN,
+                                                    handle,
+                                                    evect,
+                                                    erange,
+                                                    uplo,
+                                                    n,
+                                                    dA.data(),
+                                                    lda,
+                                                    vl,
+                                                    vu,
+                                                    il,
+                                                    iu,
+                                                    hNev,
+                                                    dW.data(),
+                                                    dWork.data(),
+                                                    lwork,
+                                                    dinfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        syevdx_heevdx_initData<false, true, T>(handle, evect, n, dA, lda, hA, A, false);
+
+        timer.start();
+        hipsolver_syevdx_heevdx(FORTRAN,
+                                handle,
+                                evect,
+                                erange,
+                                uplo,
+                                n,
+                                dA.data(),
+                                lda,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                hNev,
+                                dW.data(),
+                                dWork.data(),
+                                lwork,
+                                dinfo.data());
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, typename T>
+void testing_syevdx_heevdx(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   evectC  = argus.get<char>("jobz");
+    char                   erangeC = argus.get<char>("range");
+    char                   uploC   = argus.get<char>("uplo");
+    int                    n       = argus.get<int>("n");
+    int                    lda     = argus.get<int>("lda", n);
+    S                      vl      = S(argus.get<double>("vl", 0));
+    S                      vu      = S(argus.get<double>("vu", 0));
+    int                    il      = argus.get<int>("il", 1);
+    int                    iu      = argus.get<int>("iu", n);
+
+    hipsolverEigMode_t  evect     = char2hipsolver_evect(evectC);
+    hipsolverEigRange_t erange    = char2hipsolver_erange(erangeC);
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_W    = n;
+    size_t size_Ares = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_Wres = (argus.unit_check || argus.norm_check) ? size_W : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n
+                         || (erange == HIPSOLVER_EIG_RANGE_V && vl >= vu)
+                         || (erange == HIPSOLVER_EIG_RANGE_I && n > 0
+                             && (il < 1 || iu < il || iu > n)));
+    if(invalid_size)
+    {
+        int hNev;
+        EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(FORTRAN,
+                                                      handle,
+                                                      evect,
+                                                      erange,
+                                                      uplo,
+                                                      n,
+                                                      (T*)nullptr,
+                                                      lda,
+                                                      vl,
+                                                      vu,
+                                                      il,
+                                                      iu,
+                                                      &hNev,
+                                                      (S*)nullptr,
+                                                      (T*)nullptr,
+                                                      0,
+                                                      (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hAres(size_Ares, 1, size_Ares, 1);
+    host_strided_batch_vector<S>     hW(size_W, 1, size_W, 1);
+    host_strided_batch_vector<S>     hWres(size_Wres, 1, size_Wres, 1);
+    host_strided_batch_vector<int>   hinfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hinfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<S>   dW(size_W, 1, size_W, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_W)
+        CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int hNev, hNevRes, size_work;
+    hipsolver_syevdx_heevdx_bufferSize(FORTRAN,
+                                       handle,
+                                       evect,
+                                       erange,
+                                       uplo,
+                                       n,
+                                       dA.data(),
+                                       lda,
+                                       vl,
+                                       vu,
+                                       il,
+                                       iu,
+                                       &hNevRes,
+                                       dW.data(),
+                                       &size_work);
+    device_strided_batch_vector<T> dWork(size_work, 1, size_work, 1);
+    if(size_work)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        syevdx_heevdx_getError<FORTRAN, T>(handle,
+                                           evect,
+                                           erange,
+                                           uplo,
+                                           n,
+                                           dA,
+                                           lda,
+                                           vl,
+                                           vu,
+                                           il,
+                                           iu,
+                                           dW,
+                                           dWork,
+                                           size_work,
+                                           dinfo,
+                                           hA,
+                                           hAres,
+                                           &hNev,
+                                           &hNevRes,
+                                           hW,
+                                           hWres,
+                                           hinfo,
+                                           hinfoRes,
+                                           &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        syevdx_heevdx_getPerfData<FORTRAN, T>(handle,
+                                              evect,
+                                              erange,
+                                              uplo,
+                                              n,
+                                              dA,
+                                              lda,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              dW,
+                                              dWork,
+                                              size_work,
+                                              dinfo,
+                                              hA,
+                                              &hNevRes,
+                                              hW,
+                                              hinfo,
+                                              &gpu_time_used,
+                                              &cpu_time_used,
+                                              hot_calls,
+                                              argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("jobz", "range", "uplo", "n", "lda", "vl", "vu", "il", "iu");
+            rocsolver_bench_output(evectC, erangeC, uploC, n, lda, vl, vu, il, iu);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -0,0 +1,765 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, bool STRIDED, typename T, typename S, typename U>
+void syevj_heevj_checkBadArgs(const hipsolverHandle_t    handle,
+                              const hipsolverEigMode_t   evect,
+                              const hipsolverFillMode_t  uplo,
+                              const int                  n,
+                              T                          dA,
+                              const int                  lda,
+                              const int                  stA,
+                              S                          dW,
+                              const int                  stW,
+                              T                          dWork,
+                              const int                  lwork,
+                              U                          dinfo,
+                              const hipsolverSyevjInfo_t params,
+                              const int                  bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                STRIDED,
+                                                nullptr,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dW,
+                                                stW,
+                                                dWork,
+                                                lwork,
+                                                dinfo,
+                                                params,
+                                                bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                hipsolverEigMode_t(-1),
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dW,
+                                                stW,
+                                                dWork,
+                                                lwork,
+                                                dinfo,
+                                                params,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                evect,
+                                                hipsolverFillMode_t(-1),
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dW,
+                                                stW,
+                                                dWork,
+                                                lwork,
+                                                dinfo,
+                                                params,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                (T) nullptr,
+                                                lda,
+                                                stA,
+                                                dW,
+                                                stW,
+                                                dWork,
+                                                lwork,
+                                                dinfo,
+                                                params,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                (S) nullptr,
+                                                stW,
+                                                dWork,
+                                                lwork,
+                                                dinfo,
+                                                params,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dW,
+                                                stW,
+                                                dWork,
+                                                lwork,
+                                                (U) nullptr,
+                                                params,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                STRIDED,
+                                                handle,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dW,
+                                                stW,
+                                                dWork,
+                                                lwork,
+                                                dinfo,
+                                                nullptr,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <bool FORTRAN, bool STRIDED, typename T>
+void testing_syevj_heevj_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle     handle;
+    hipsolver_local_syevj_info params;
+    hipsolverEigMode_t         evect = HIPSOLVER_EIG_MODE_NOVECTOR;
+    hipsolverFillMode_t        uplo  = HIPSOLVER_FILL_MODE_LOWER;
+    int                        n     = 1;
+    int                        lda   = 1;
+    int                        stA   = 1;
+    int                        stW   = 1;
+    int                        bc    = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<S>   dW(1, 1, 1, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int size_W;
+    hipsolver_syevj_heevj_bufferSize(FORTRAN,
+                                     STRIDED,
+                                     handle,
+                                     evect,
+                                     uplo,
+                                     n,
+                                     dA.data(),
+                                     lda,
+                                     stA,
+                                     dW.data(),
+                                     stW,
+                                     &size_W,
+                                     params,
+                                     bc);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    syevj_heevj_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                               evect,
+                                               uplo,
+                                               n,
+                                               dA.data(),
+                                               lda,
+                                               stA,
+                                               dW.data(),
+                                               stW,
+                                               dWork.data(),
+                                               size_W,
+                                               dinfo.data(),
+                                               params,
+                                               bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void syevj_heevj_initData(const hipsolverHandle_t  handle,
+                          const hipsolverEigMode_t evect,
+                          const int                n,
+                          Td&                      dA,
+                          const int                lda,
+                          const int                bc,
+                          Th&                      hA,
+                          std::vector<T>&          A,
+                          bool                     test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(int b = 0; b < bc; ++b)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                for(int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // make copy of original data to test vectors if required
+            if(test && evect == HIPSOLVER_EIG_MODE_VECTOR)
+            {
+                for(int i = 0; i < n; i++)
+                {
+                    for(int j = 0; j < n; j++)
+                        A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void syevj_heevj_getError(const hipsolverHandle_t    handle,
+                          const hipsolverEigMode_t   evect,
+                          const hipsolverFillMode_t  uplo,
+                          const int                  n,
+                          Td&                        dA,
+                          const int                  lda,
+                          const int                  stA,
+                          Sd&                        dW,
+                          const int                  stW,
+                          Td&                        dWork,
+                          const int                  lwork,
+                          Id&                        dinfo,
+                          const hipsolverSyevjInfo_t params,
+                          const int                  bc,
+                          Th&                        hA,
+                          Th&                        hAres,
+                          Sh&                        hW,
+                          Sh&                        hWres,
+                          Ih&                        hinfo,
+                          Ih&                        hinfoRes,
+                          const int                  sort_eig,
+                          const int                  max_sweeps,
+                          double*                    max_err)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+    using S                = decltype(std::real(T{}));
+
+    int sizeE, ltwork;
+    if(!COMPLEX)
+    {
+        sizeE  = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 2 * n + 1 : 1 + 6 * n + 2 * n * n);
+        ltwork = 0;
+    }
+    else
+    {
+        sizeE  = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? n : 1 + 5 * n + 2 * n * n);
+        ltwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? n + 1 : 2 * n + n * n);
+    }
+    int liwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 1 : 3 + 5 * n);
+
+    std::vector<T>   work(ltwork);
+    std::vector<S>   hE(sizeE);
+    std::vector<int> iwork(liwork);
+    std::vector<T>   A(lda * n * bc);
+
+    // input data initialization
+    syevj_heevj_initData<true, true, T>(handle, evect, n, dA, lda, bc, hA, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_syevj_heevj(FORTRAN,
+                                              STRIDED,
+                                              handle,
+                                              evect,
+                                              uplo,
+                                              n,
+                                              dA.data(),
+                                              lda,
+                                              stA,
+                                              dW.data(),
+                                              stW,
+                                              dWork.data(),
+                                              lwork,
+                                              dinfo.data(),
+                                              params,
+                                              bc));
+
+    CHECK_HIP_ERROR(hWres.transfer_from(dW));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(evect == HIPSOLVER_EIG_MODE_VECTOR)
+        CHECK_HIP_ERROR(hAres.transfer_from(dA));
+
+    // the residual and sweep count are not reported by cuSOLVER for batched problems
+    if(!STRIDED)
+    {
+        double residual;
+        int    executed_sweeps;
+        CHECK_ROCBLAS_ERROR(hipsolverXsyevjGetResidual(handle, params, &residual));
+        CHECK_ROCBLAS_ERROR(hipsolverXsyevjGetSweeps(handle, params, &executed_sweeps));
+        EXPECT_GE(residual, 0);
+        EXPECT_LE(executed_sweeps, max_sweeps);
+    }
+
+    // CPU lapack
+#pragma omp parallel for if(bc > 1) firstprivate(work, hE, iwork)
+    for(int b = 0; b < bc; ++b)
+        cblas_syevd_heevd<T>(evect,
+                             uplo,
+                             n,
+                             hA[b],
+                             lda,
+                             hW[b],
+                             work.data(),
+                             ltwork,
+                             hE.data(),
+                             sizeE,
+                             iwork.data(),
+                             liwork,
+                             hinfo[b]);
+
+    // Check info for non-convergence
+    *max_err = 0;
+    for(int b = 0; b < bc; ++b)
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+
+    // (We expect the used input matrices to always converge. Testing
+    // implicitly the equivalent non-converged matrix is very complicated and it boils
+    // down to essentially run the algorithm again and until convergence is achieved).
+
+    double         err = 0;
+    std::vector<S> sorted(n);
+
+    for(int b = 0; b < bc; ++b)
+    {
+        if(hinfo[b][0] != 0)
+            continue;
+
+        // the eigenvalues from LAPACK are in ascending order; unsorted results are compared
+        // after sorting them
+        for(int j = 0; j < n; j++)
+            sorted[j] = hWres[b][j];
+        if(!sort_eig)
+            std::sort(sorted.begin(), sorted.end());
+
+        // error is ||hW - hWRes|| / ||hW||
+        // using frobenius norm
+        err      = norm_error('F', 1, n, 1, hW[b], sorted.data());
+        *max_err = err > *max_err ? err : *max_err;
+
+        if(evect == HIPSOLVER_EIG_MODE_VECTOR)
+        {
+            // the eigenvectors are not unique under scaling, so they are tested implicitly:
+            // multiply A with each of the n eigenvectors and divide by corresponding
+            // eigenvalues
+            T alpha;
+            T beta = 0;
+            for(int j = 0; j < n; j++)
+            {
+                alpha = T(1) / hWres[b][j];
+                cblas_symv_hemv(uplo,
+                                n,
+                                alpha,
+                                A.data() + b * lda * n,
+                                lda,
+                                hAres[b] + j * lda,
+                                1,
+                                beta,
+                                hA[b] + j * lda,
+                                1);
+            }
+
+            // error is ||hA - hARes|| / ||hA||
+            // using frobenius norm
+            err      = norm_error('F', n, n, lda, hA[b], hAres[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool FORTRAN,
+          bool STRIDED,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Id,
+          typename Sh,
+          typename Th,
+          typename Ih>
+void syevj_heevj_getPerfData(const hipsolverHandle_t    handle,
+                             const hipsolverEigMode_t   evect,
+                             const hipsolverFillMode_t  uplo,
+                             const int                  n,
+                             Td&                        dA,
+                             const int                  lda,
+                             const int                  stA,
+                             Sd&                        dW,
+                             const int                  stW,
+                             Td&                        dWork,
+                             const int                  lwork,
+                             Id&                        dinfo,
+                             const hipsolverSyevjInfo_t params,
+                             const int                  bc,
+                             Th&                        hA,
+                             Sh&                        hW,
+                             Ih&                        hinfo,
+                             double*                    gpu_time_used,
+                             double*                    cpu_time_used,
+                             const int                  hot_calls,
+                             const bool                 perf)
+{
+    constexpr bool COMPLEX = is_complex<T>;
+    using S                = decltype(std::real(T{}));
+
+    int sizeE, ltwork;
+    if(!COMPLEX)
+    {
+        sizeE  = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 2 * n + 1 : 1 + 6 * n + 2 * n * n);
+        ltwork = 0;
+    }
+    else
+    {
+        sizeE  = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? n : 1 + 5 * n + 2 * n * n);
+        ltwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? n + 1 : 2 * n + n * n);
+    }
+    int liwork = (evect == HIPSOLVER_EIG_MODE_NOVECTOR ? 1 : 3 + 5 * n);
+
+    std::vector<T>   work(ltwork);
+    std::vector<S>   hE(sizeE);
+    std::vector<int> iwork(liwork);
+    std::vector<T>   A;
+
+    if(!perf)
+    {
+        syevj_heevj_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+            cblas_syevd_heevd<T>(evect,
+                                 uplo,
+                                 n,
+                                 hA[b],
+                                 lda,
+                                 hW[b],
+                                 work.data(),
+                                 ltwork,
+                                 hE.data(),
+                                 sizeE,
+                                 iwork.data(),
+                                 liwork,
+                                 hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    syevj_heevj_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_syevj_heevj(FORTRAN,
+                                                  STRIDED,
+                                                  handle,
+                                                  evect,
+                                                  uplo,
+                                                  n,
+                                                  dA.data(),
+                                                  lda,
+                                                  stA,
+                                                  dW.data(),
+                                                  stW,
+                                                  dWork.data(),
+                                                  lwork,
+                                                  dinfo.data(),
+                                                  params,
+                                                  bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
+
+        timer.start();
+        hipsolver_syevj_heevj(FORTRAN,
+                              STRIDED,
+                              handle,
+                              evect,
+                              uplo,
+                              n,
+                              dA.data(),
+                              lda,
+                              stA,
+                              dW.data(),
+                              stW,
+                              dWork.data(),
+                              lwork,
+                              dinfo.data(),
+                              params,
+                              bc);
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, bool STRIDED, typename T>
+void testing_syevj_heevj(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle     handle;
+    hipsolver_local_syevj_info params;
+    char                       evectC     = argus.get<char>("jobz");
+    char                       uploC      = argus.get<char>("uplo");
+    int                        n          = argus.get<int>("n");
+    int                        lda        = argus.get<int>("lda", n);
+    int                        max_sweeps = argus.get<int>("max_sweeps", 100);
+    double                     tolerance  = argus.get<double>("tolerance", 0);
+    int                        sort_eig   = argus.get<int>("sort_eig", 1);
+
+    hipsolverEigMode_t  evect = char2hipsolver_evect(evectC);
+    hipsolverFillMode_t uplo  = char2hipsolver_fill(uploC);
+
+    // the strides of the batched functions are implied by the sizes
+    int stA = argus.get<int>("strideA", lda * n);
+    int stW = argus.get<int>("strideD", n);
+
+    int bc        = argus.batch_count;
+    int hot_calls = argus.iters;
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_W    = size_t(n);
+    size_t size_Ares = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_Wres = (argus.unit_check || argus.norm_check) ? size_W : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(FORTRAN,
+                                                    STRIDED,
+                                                    handle,
+                                                    evect,
+                                                    uplo,
+                                                    n,
+                                                    (T*)nullptr,
+                                                    lda,
+                                                    stA,
+                                                    (S*)nullptr,
+                                                    stW,
+                                                    (T*)nullptr,
+                                                    0,
+                                                    (int*)nullptr,
+                                                    params,
+                                                    bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    CHECK_ROCBLAS_ERROR(hipsolverXsyevjSetMaxSweeps(params, max_sweeps));
+    CHECK_ROCBLAS_ERROR(hipsolverXsyevjSetTolerance(params, tolerance));
+    CHECK_ROCBLAS_ERROR(hipsolverXsyevjSetSortEig(params, sort_eig));
+
+    // memory allocations
+    // host
+    host_strided_batch_vector<T>   hA(size_A, 1, stA, bc);
+    host_strided_batch_vector<T>   hAres(size_Ares, 1, stA, bc);
+    host_strided_batch_vector<S>   hW(size_W, 1, stW, bc);
+    host_strided_batch_vector<S>   hWres(size_Wres, 1, stW, bc);
+    host_strided_batch_vector<int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<int> hinfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+    device_strided_batch_vector<S>   dW(size_W, 1, stW, bc);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_W)
+        CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    int size_Work;
+    hipsolver_syevj_heevj_bufferSize(FORTRAN,
+                                     STRIDED,
+                                     handle,
+                                     evect,
+                                     uplo,
+                                     n,
+                                     dA.data(),
+                                     lda,
+                                     stA,
+                                     dW.data(),
+                                     stW,
+                                     &size_Work,
+                                     params,
+                                     bc);
+    device_strided_batch_vector<T> dWork(size_Work, 1, size_Work, 1);
+    if(size_Work)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        syevj_heevj_getError<FORTRAN, STRIDED, T>(handle,
+                                                  evect,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dW,
+                                                  stW,
+                                                  dWork,
+                                                  size_Work,
+                                                  dinfo,
+                                                  params,
+                                                  bc,
+                                                  hA,
+                                                  hAres,
+                                                  hW,
+                                                  hWres,
+                                                  hinfo,
+                                                  hinfoRes,
+                                                  sort_eig,
+                                                  max_sweeps,
+                                                  &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        syevj_heevj_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                     evect,
+                                                     uplo,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dW,
+                                                     stW,
+                                                     dWork,
+                                                     size_Work,
+                                                     dinfo,
+                                                     params,
+                                                     bc,
+                                                     hA,
+                                                     hW,
+                                                     hinfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(STRIDED)
+            {
+                rocsolver_bench_output("jobz", "uplo", "n", "lda", "max_sweeps", "batch_c");
+                rocsolver_bench_output(evectC, uploC, n, lda, max_sweeps, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("jobz", "uplo", "n", "lda", "max_sweeps", "sort_eig");
+                rocsolver_bench_output(evectC, uploC, n, lda, max_sweeps, sort_eig);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
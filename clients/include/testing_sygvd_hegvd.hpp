@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename T, typename U>
+template <bool FORTRAN, bool STRIDED, typename T, typename U>
 void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverEigType_t  itype,
                               const hipsolverEigMode_t  evect,
@@ -27,6 +27,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 nullptr,
                                                 itype,
                                                 evect,
@@ -48,6 +50,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 handle,
                                                 hipsolverEigType_t(-1),
                                                 evect,
@@ -67,6 +71,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 handle,
                                                 itype,
                                                 hipsolverEigMode_t(-1),
@@ -86,6 +92,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -108,6 +116,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -127,6 +137,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -146,6 +158,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -165,6 +179,8 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                STRIDED,
+                                                false,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -267,6 +283,8 @@ void testing_sygvd_hegvd_bad_arg()
 
         int size_W;
         hipsolver_sygvd_hegvd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         false,
                                          handle,
                                          itype,
                                          evect,
@@ -274,32 +292,36 @@ void testing_sygvd_hegvd_bad_arg()
                                          n,
                                          dA.data(),
                                          lda,
+                                         stA,
                                          dB.data(),
                                          ldb,
+                                         stB,
                                          dD.data(),
-                                         &size_W);
+                                         stD,
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        sygvd_hegvd_checkBadArgs<FORTRAN>(handle,
-                                          itype,
-                                          evect,
-                                          uplo,
-                                          n,
-                                          dA.data(),
-                                          lda,
-                                          stA,
-                                          dB.data(),
-                                          ldb,
-                                          stB,
-                                          dD.data(),
-                                          stD,
-                                          dWork.data(),
-                                          size_W,
-                                          dInfo.data(),
-                                          bc);
+        sygvd_hegvd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   itype,
+                                                   evect,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dB.data(),
+                                                   ldb,
+                                                   stB,
+                                                   dD.data(),
+                                                   stD,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
     }
 }
 
@@ -378,6 +400,7 @@ void sygvd_hegvd_initData(const hipsolverHandle_t       handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -441,6 +464,8 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_sygvd_hegvd(FORTRAN,
+                                              STRIDED,
+                                              false,
                                               handle,
                                               itype,
                                               evect,
@@ -465,6 +490,7 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
         CHECK_HIP_ERROR(hARes.transfer_from(dA));
 
     // CPU lapack
+#pragma omp parallel for if(bc > 1) firstprivate(work, rwork, iwork)
     for(int b = 0; b < bc; ++b)
     {
         cblas_sygvd_hegvd(itype,
@@ -596,6 +622,7 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -691,6 +718,8 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
         CHECK_ROCBLAS_ERROR(hipsolver_sygvd_hegvd(FORTRAN,
+                                                  STRIDED,
+                                                  false,
                                                   handle,
                                                   itype,
                                                   evect,
@@ -713,15 +742,17 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         sygvd_hegvd_initData<false, true, T>(
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_sygvd_hegvd(FORTRAN,
+                              STRIDED,
+                              false,
                               handle,
                               itype,
                               evect,
@@ -739,7 +770,9 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
                               lwork,
                               dInfo.data(),
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -808,6 +841,8 @@ void testing_sygvd_hegvd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(FORTRAN,
+                                                        STRIDED,
+                                                        false,
                                                         handle,
                                                         itype,
                                                         evect,
@@ -875,61 +910,61 @@ void testing_sygvd_hegvd(Arguments& argus)
 
         // // check computations
         // if(argus.unit_check || argus.norm_check)
-        //     sygvd_hegvd_getError<FORTRAN, T>(handle,
-        //                                      itype,
-        //                                      evect,
-        //                                      uplo,
-        //                                      n,
-        //                                      dA,
-        //                                      lda,
-        //                                      stA,
-        //                                      dB,
-        //                                      ldb,
-        //                                      stB,
-        //                                      dD,
-        //                                      stD,
-        //                                      dWork,
-        //                                      size_W,
-        //                                      dInfo,
-        //                                      bc,
-        //                                      hA,
-        //                                      hARes,
-        //                                      hB,
-        //                                      hD,
-        //                                      hDRes,
-        //                                      hInfo,
-        //                                      hInfoRes,
-        //                                      &max_error,
-        //                                      argus.singular);
+        //     sygvd_hegvd_getError<FORTRAN, STRIDED, T>(handle,
+        //                                               itype,
+        //                                               evect,
+        //                                               uplo,
+        //                                               n,
+        //                                               dA,
+        //                                               lda,
+        //                                               stA,
+        //                                               dB,
+        //                                               ldb,
+        //                                               stB,
+        //                                               dD,
+        //                                               stD,
+        //                                               dWork,
+        //                                               size_W,
+        //                                               dInfo,
+        //                                               bc,
+        //                                               hA,
+        //                                               hARes,
+        //                                               hB,
+        //                                               hD,
+        //                                               hDRes,
+        //                                               hInfo,
+        //                                               hInfoRes,
+        //                                               &max_error,
+        //                                               argus.singular);
 
         // // collect performance data
         // if(argus.timing)
-        //     sygvd_hegvd_getPerfData<FORTRAN, T>(handle,
-        //                                         itype,
-        //                                         evect,
-        //                                         uplo,
-        //                                         n,
-        //                                         dA,
-        //                                         lda,
-        //                                         stA,
-        //                                         dB,
-        //                                         ldb,
-        //                                         stB,
-        //                                         dD,
-        //                                         stD,
-        //                                         dWork,
-        //                                         size_W,
-        //                                         dInfo,
-        //                                         bc,
-        //                                         hA,
-        //                                         hB,
-        //                                         hD,
-        //                                         hInfo,
-        //                                         &gpu_time_used,
-        //                                         &cpu_time_used,
-        //                                         hot_calls,
-        //                                         argus.perf,
-        //                                         argus.singular);
+        //     sygvd_hegvd_getPerfData<FORTRAN, STRIDED, T>(handle,
+        //                                                  itype,
+        //                                                  evect,
+        //                                                  uplo,
+        //                                                  n,
+        //                                                  dA,
+        //                                                  lda,
+        //                                                  stA,
+        //                                                  dB,
+        //                                                  ldb,
+        //                                                  stB,
+        //                                                  dD,
+        //                                                  stD,
+        //                                                  dWork,
+        //                                                  size_W,
+        //                                                  dInfo,
+        //                                                  bc,
+        //                                                  hA,
+        //                                                  hB,
+        //                                                  hD,
+        //                                                  hInfo,
+        //                                                  &gpu_time_used,
+        //                                                  &cpu_time_used,
+        //                                                  hot_calls,
+        //                                                  argus.perf,
+        //                                                  argus.singular);
     }
 
     else
@@ -956,6 +991,8 @@ void testing_sygvd_hegvd(Arguments& argus)
 
         int size_W;
         hipsolver_sygvd_hegvd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         false,
                                          handle,
                                          itype,
                                          evect,
@@ -963,71 +1000,75 @@ void testing_sygvd_hegvd(Arguments& argus)
                                          n,
                                          dA.data(),
                                          lda,
+                                         stA,
                                          dB.data(),
                                          ldb,
+                                         stB,
                                          dD.data(),
-                                         &size_W);
+                                         stD,
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            sygvd_hegvd_getError<FORTRAN, T>(handle,
-                                             itype,
-                                             evect,
-                                             uplo,
-                                             n,
-                                             dA,
-                                             lda,
-                                             stA,
-                                             dB,
-                                             ldb,
-                                             stB,
-                                             dD,
-                                             stD,
-                                             dWork,
-                                             size_W,
-                                             dInfo,
-                                             bc,
-                                             hA,
-                                             hARes,
-                                             hB,
-                                             hD,
-                                             hDRes,
-                                             hInfo,
-                                             hInfoRes,
-                                             &max_error,
-                                             argus.singular);
+            sygvd_hegvd_getError<FORTRAN, STRIDED, T>(handle,
+                                                      itype,
+                                                      evect,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dB,
+                                                      ldb,
+                                                      stB,
+                                                      dD,
+                                                      stD,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hARes,
+                                                      hB,
+                                                      hD,
+                                                      hDRes,
+                                                      hInfo,
+                                                      hInfoRes,
+                                                      &max_error,
+                                                      argus.singular);
 
         // collect performance data
         if(argus.timing)
-            sygvd_hegvd_getPerfData<FORTRAN, T>(handle,
-                                                itype,
-                                                evect,
-                                                uplo,
-                                                n,
-                                                dA,
-                                                lda,
-                                                stA,
-                                                dB,
-                                                ldb,
-                                                stB,
-                                                dD,
-                                                stD,
-                                                dWork,
-                                                size_W,
-                                                dInfo,
-                                                bc,
-                                                hA,
-                                                hB,
-                                                hD,
-                                                hInfo,
-                                                &gpu_time_used,
-                                                &cpu_time_used,
-                                                hot_calls,
-                                                argus.perf,
-                                                argus.singular);
+            sygvd_hegvd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         itype,
+                                                         evect,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dB,
+                                                         ldb,
+                                                         stB,
+                                                         dD,
+                                                         stD,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hB,
+                                                         hD,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf,
+                                                         argus.singular);
     }
 
     // validate results for rocsolver-test
@@ -6,7 +6,7 @@
 
 #include "clientcommon.hpp"
 
-template <bool FORTRAN, typename S, typename T, typename U, typename V>
+template <bool FORTRAN, bool STRIDED, typename S, typename T, typename U, typename V>
 void sytrd_hetrd_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverFillMode_t uplo,
                               const int                 n,
@@ -26,6 +26,7 @@ void sytrd_hetrd_checkBadArgs(const hipsolverHandle_t   handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                STRIDED,
                                                 nullptr,
                                                 uplo,
                                                 n,
@@ -46,6 +47,7 @@ void sytrd_hetrd_checkBadArgs(const hipsolverHandle_t   handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 hipsolverFillMode_t(-1),
                                                 n,
@@ -67,6 +69,7 @@ void sytrd_hetrd_checkBadArgs(const hipsolverHandle_t   handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 uplo,
                                                 n,
@@ -85,6 +88,7 @@ void sytrd_hetrd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 uplo,
                                                 n,
@@ -103,6 +107,7 @@ void sytrd_hetrd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 uplo,
                                                 n,
@@ -121,6 +126,7 @@ void sytrd_hetrd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                STRIDED,
                                                 handle,
                                                 uplo,
                                                 n,
@@ -159,42 +165,56 @@ void testing_sytrd_hetrd_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<S>   dD(1, 1, 1, 1);
-        // device_strided_batch_vector<S>   dE(1, 1, 1, 1);
-        // device_strided_batch_vector<T>   dTau(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dD.memcheck());
-        // CHECK_HIP_ERROR(dE.memcheck());
-        // CHECK_HIP_ERROR(dTau.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // int size_W;
-        // hipsolver_sytrd_hetrd_bufferSize(
-        //     FORTRAN, handle, uplo, n, dA.data(), lda, dD.data(), dE.data(), dTau.data(), &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // sytrd_hetrd_checkBadArgs<FORTRAN>(handle,
-        //                                   uplo,
-        //                                   n,
-        //                                   dA.data(),
-        //                                   lda,
-        //                                   stA,
-        //                                   dD.data(),
-        //                                   stD,
-        //                                   dE.data(),
-        //                                   stE,
-        //                                   dTau.data(),
-        //                                   stP,
-        //                                   dWork.data(),
-        //                                   size_W,
-        //                                   dInfo.data(),
-        //                                   bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<S>   dD(1, 1, 1, 1);
+        device_strided_batch_vector<S>   dE(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dTau(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dE.memcheck());
+        CHECK_HIP_ERROR(dTau.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_sytrd_hetrd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         dE.data(),
+                                         stE,
+                                         dTau.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        sytrd_hetrd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dD.data(),
+                                                   stD,
+                                                   dE.data(),
+                                                   stE,
+                                                   dTau.data(),
+                                                   stP,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
     }
     else
     {
@@ -211,29 +231,43 @@ void testing_sytrd_hetrd_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_sytrd_hetrd_bufferSize(
-            FORTRAN, handle, uplo, n, dA.data(), lda, dD.data(), dE.data(), dTau.data(), &size_W);
+        hipsolver_sytrd_hetrd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         dE.data(),
+                                         stE,
+                                         dTau.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        sytrd_hetrd_checkBadArgs<FORTRAN>(handle,
-                                          uplo,
-                                          n,
-                                          dA.data(),
-                                          lda,
-                                          stA,
-                                          dD.data(),
-                                          stD,
-                                          dE.data(),
-                                          stE,
-                                          dTau.data(),
-                                          stP,
-                                          dWork.data(),
-                                          size_W,
-                                          dInfo.data(),
-                                          bc);
+        sytrd_hetrd_checkBadArgs<FORTRAN, STRIDED>(handle,
+                                                   uplo,
+                                                   n,
+                                                   dA.data(),
+                                                   lda,
+                                                   stA,
+                                                   dD.data(),
+                                                   stD,
+                                                   dE.data(),
+                                                   stE,
+                                                   dTau.data(),
+                                                   stP,
+                                                   dWork.data(),
+                                                   size_W,
+                                                   dInfo.data(),
+                                                   bc);
     }
 }
 
@@ -312,6 +346,7 @@ void sytrd_hetrd_initData(
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
@@ -356,6 +391,7 @@ void sytrd_hetrd_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_sytrd_hetrd(FORTRAN,
+                                              STRIDED,
                                               handle,
                                               uplo,
                                               n,
@@ -467,13 +503,15 @@ void sytrd_hetrd_getError(const hipsolverHandle_t   handle,
     *max_err = 0;
     for(int b = 0; b < bc; ++b)
     {
-        *max_err = (uplo == HIPSOLVER_FILL_MODE_LOWER)
-                       ? norm_error_lowerTr('F', n, n, lda, hA[b], hARes[b])
-                       : norm_error_upperTr('F', n, n, lda, hA[b], hARes[b]);
+        err = (uplo == HIPSOLVER_FILL_MODE_LOWER)
+                  ? norm_error_lowerTr('F', n, n, lda, hA[b], hARes[b])
+                  : norm_error_upperTr('F', n, n, lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
     }
 }
 
 template <bool FORTRAN,
+          bool STRIDED,
           typename T,
           typename Sd,
           typename Td,
@@ -532,6 +570,7 @@ void sytrd_hetrd_getPerfData(const hipsolverHandle_t   handle,
         sytrd_hetrd_initData<false, true, T>(handle, n, dA, lda, bc, hA);
 
         CHECK_ROCBLAS_ERROR(hipsolver_sytrd_hetrd(FORTRAN,
+                                                  STRIDED,
                                                   handle,
                                                   uplo,
                                                   n,
@@ -553,14 +592,15 @@ void sytrd_hetrd_getPerfData(const hipsolverHandle_t   handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
-    double start;
+    hipsolver_bench_timer timer(stream);
 
     for(int iter = 0; iter < hot_calls; iter++)
     {
         sytrd_hetrd_initData<false, true, T>(handle, n, dA, lda, bc, hA);
 
-        start = get_time_us_sync(stream);
+        timer.start();
         hipsolver_sytrd_hetrd(FORTRAN,
+                              STRIDED,
                               handle,
                               uplo,
                               n,
@@ -577,7 +617,9 @@ void sytrd_hetrd_getPerfData(const hipsolverHandle_t   handle,
                               lwork,
                               dInfo.data(),
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
     }
     *gpu_time_used /= hot_calls;
 }
@@ -608,28 +650,30 @@ void testing_sytrd_hetrd(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
-            //                                             handle,
-            //                                             uplo,
-            //                                             n,
-            //                                             (T* const*)nullptr,
-            //                                             lda,
-            //                                             stA,
-            //                                             (S*)nullptr,
-            //                                             stD,
-            //                                             (S*)nullptr,
-            //                                             stE,
-            //                                             (T*)nullptr,
-            //                                             stP,
-            //                                             (T*)nullptr,
-            //                                             0,
-            //                                             (int*)nullptr,
-            //                                             bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        uplo,
+                                                        n,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (S*)nullptr,
+                                                        stD,
+                                                        (S*)nullptr,
+                                                        stE,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                        STRIDED,
                                                         handle,
                                                         uplo,
                                                         n,
@@ -670,28 +714,30 @@ void testing_sytrd_hetrd(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
-            //                                             handle,
-            //                                             uplo,
-            //                                             n,
-            //                                             (T* const*)nullptr,
-            //                                             lda,
-            //                                             stA,
-            //                                             (S*)nullptr,
-            //                                             stD,
-            //                                             (S*)nullptr,
-            //                                             stE,
-            //                                             (T*)nullptr,
-            //                                             stP,
-            //                                             (T*)nullptr,
-            //                                             0,
-            //                                             (int*)nullptr,
-            //                                             bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                        STRIDED,
+                                                        handle,
+                                                        uplo,
+                                                        n,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (S*)nullptr,
+                                                        stD,
+                                                        (S*)nullptr,
+                                                        stE,
+                                                        (T*)nullptr,
+                                                        stP,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_sytrd_hetrd(FORTRAN,
+                                                        STRIDED,
                                                         handle,
                                                         uplo,
                                                         n,
@@ -738,73 +784,87 @@ void testing_sytrd_hetrd(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>   hA(size_A, 1, bc);
-        // host_batch_vector<T>   hARes(size_ARes, 1, bc);
-        // device_batch_vector<T> dA(size_A, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-
-        // int size_W;
-        // hipsolver_sytrd_hetrd_bufferSize(
-        //     FORTRAN, handle, uplo, n, dA.data(), lda, dD.data(), dE.data(), dTau.data(), &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     sytrd_hetrd_getError<FORTRAN, T>(handle,
-        //                                      uplo,
-        //                                      n,
-        //                                      dA,
-        //                                      lda,
-        //                                      stA,
-        //                                      dD,
-        //                                      stD,
-        //                                      dE,
-        //                                      stE,
-        //                                      dTau,
-        //                                      stP,
-        //                                      dWork,
-        //                                      size_W,
-        //                                      dInfo,
-        //                                      bc,
-        //                                      hA,
-        //                                      hARes,
-        //                                      hD,
-        //                                      hE,
-        //                                      hTau,
-        //                                      hInfo,
-        //                                      &max_error);
-
-        // // collect performance data
-        // if(argus.timing)
-        //     sytrd_hetrd_getPerfData<FORTRAN, T>(handle,
-        //                                         uplo,
-        //                                         n,
-        //                                         dA,
-        //                                         lda,
-        //                                         stA,
-        //                                         dD,
-        //                                         stD,
-        //                                         dE,
-        //                                         stE,
-        //                                         dTau,
-        //                                         stP,
-        //                                         dWork,
-        //                                         size_W,
-        //                                         dInfo,
-        //                                         bc,
-        //                                         hA,
-        //                                         hD,
-        //                                         hE,
-        //                                         hTau,
-        //                                         hInfo,
-        //                                         &gpu_time_used,
-        //                                         &cpu_time_used,
-        //                                         hot_calls,
-        //                                         argus.perf);
+        // memory allocations
+        host_batch_vector<T>   hA(size_A, 1, bc);
+        host_batch_vector<T>   hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        int size_W;
+        hipsolver_sytrd_hetrd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         dE.data(),
+                                         stE,
+                                         dTau.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            sytrd_hetrd_getError<FORTRAN, STRIDED, T>(handle,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dD,
+                                                      stD,
+                                                      dE,
+                                                      stE,
+                                                      dTau,
+                                                      stP,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hARes,
+                                                      hD,
+                                                      hE,
+                                                      hTau,
+                                                      hInfo,
+                                                      &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            sytrd_hetrd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dD,
+                                                         stD,
+                                                         dE,
+                                                         stE,
+                                                         dTau,
+                                                         stP,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hD,
+                                                         hE,
+                                                         hTau,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
     }
 
     else
@@ -817,65 +877,79 @@ void testing_sytrd_hetrd(Arguments& argus)
             CHECK_HIP_ERROR(dA.memcheck());
 
         int size_W;
-        hipsolver_sytrd_hetrd_bufferSize(
-            FORTRAN, handle, uplo, n, dA.data(), lda, dD.data(), dE.data(), dTau.data(), &size_W);
+        hipsolver_sytrd_hetrd_bufferSize(FORTRAN,
+                                         STRIDED,
+                                         handle,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         dE.data(),
+                                         stE,
+                                         dTau.data(),
+                                         stP,
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, bc);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            sytrd_hetrd_getError<FORTRAN, T>(handle,
-                                             uplo,
-                                             n,
-                                             dA,
-                                             lda,
-                                             stA,
-                                             dD,
-                                             stD,
-                                             dE,
-                                             stE,
-                                             dTau,
-                                             stP,
-                                             dWork,
-                                             size_W,
-                                             dInfo,
-                                             bc,
-                                             hA,
-                                             hARes,
-                                             hD,
-                                             hE,
-                                             hTau,
-                                             hInfo,
-                                             &max_error);
+            sytrd_hetrd_getError<FORTRAN, STRIDED, T>(handle,
+                                                      uplo,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dD,
+                                                      stD,
+                                                      dE,
+                                                      stE,
+                                                      dTau,
+                                                      stP,
+                                                      dWork,
+                                                      size_W,
+                                                      dInfo,
+                                                      bc,
+                                                      hA,
+                                                      hARes,
+                                                      hD,
+                                                      hE,
+                                                      hTau,
+                                                      hInfo,
+                                                      &max_error);
 
         // collect performance data
         if(argus.timing)
-            sytrd_hetrd_getPerfData<FORTRAN, T>(handle,
-                                                uplo,
-                                                n,
-                                                dA,
-                                                lda,
-                                                stA,
-                                                dD,
-                                                stD,
-                                                dE,
-                                                stE,
-                                                dTau,
-                                                stP,
-                                                dWork,
-                                                size_W,
-                                                dInfo,
-                                                bc,
-                                                hA,
-                                                hD,
-                                                hE,
-                                                hTau,
-                                                hInfo,
-                                                &gpu_time_used,
-                                                &cpu_time_used,
-                                                hot_calls,
-                                                argus.perf);
+            sytrd_hetrd_getPerfData<FORTRAN, STRIDED, T>(handle,
+                                                         uplo,
+                                                         n,
+                                                         dA,
+                                                         lda,
+                                                         stA,
+                                                         dD,
+                                                         stD,
+                                                         dE,
+                                                         stE,
+                                                         dTau,
+                                                         stP,
+                                                         dWork,
+                                                         size_W,
+                                                         dInfo,
+                                                         bc,
+                                                         hA,
+                                                         hD,
+                                                         hE,
+                                                         hTau,
+                                                         hInfo,
+                                                         &gpu_time_used,
+                                                         &cpu_time_used,
+                                                         hot_calls,
+                                                         argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -0,0 +1,496 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <bool FORTRAN, typename T, typename U>
+void sytrs_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const int                 n,
+                        const int                 nrhs,
+                        T                         dA,
+                        const int                 lda,
+                        U                         dIpiv,
+                        T                         dB,
+                        const int                 ldb,
+                        T                         dWork,
+                        const int                 lwork,
+                        U                         dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_sytrs(
+            FORTRAN, nullptr, uplo, n, nrhs, dA, lda, dIpiv, dB, ldb, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_sytrs(FORTRAN,
+                                          handle,
+                                          hipsolverFillMode_t(-1),
+                                          n,
+                                          nrhs,
+                                          dA,
+                                          lda,
+                                          dIpiv,
+                                          dB,
+                                          ldb,
+                                          dWork,
+                                          lwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_sytrs(
+            FORTRAN, handle, uplo, n, nrhs, (T) nullptr, lda, dIpiv, dB, ldb, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_sytrs(
+            FORTRAN, handle, uplo, n, nrhs, dA, lda, (U) nullptr, dB, ldb, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_sytrs(
+            FORTRAN, handle, uplo, n, nrhs, dA, lda, dIpiv, (T) nullptr, ldb, dWork, lwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_sytrs(
+            FORTRAN, handle, uplo, n, nrhs, dA, lda, dIpiv, dB, ldb, dWork, lwork, (U) nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <bool FORTRAN, typename T>
+void testing_sytrs_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    int                    n    = 1;
+    int                    nrhs = 1;
+    int                    lda  = 1;
+    int                    ldb  = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dB(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_sytrs_bufferSize(FORTRAN,
+                               handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               dA.data(),
+                               lda,
+                               dIpiv.data(),
+                               dB.data(),
+                               ldb,
+                               &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    sytrs_checkBadArgs<FORTRAN>(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                dA.data(),
+                                lda,
+                                dIpiv.data(),
+                                dB.data(),
+                                ldb,
+                                dWork.data(),
+                                size_W,
+                                dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void sytrs_initData(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 nrhs,
+                    Td&                       dA,
+                    const int                 lda,
+                    Ud&                       dIpiv,
+                    Td&                       dB,
+                    const int                 ldb,
+                    Th&                       hA,
+                    Uh&                       hIpiv,
+                    Th&                       hB)
+{
+    if(CPU)
+    {
+        int            info;
+        int            size_W = max(1, 64 * n);
+        std::vector<T> hW(size_W);
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // make A symmetric, with a diagonal that is large only on every third row, so that both
+        // 1 x 1 and 2 x 2 pivots are chosen
+        for(int i = 0; i < n; i++)
+        {
+            for(int j = 0; j < i; j++)
+            {
+                hA[0][i + j * lda] -= 4;
+                hA[0][j + i * lda] = hA[0][i + j * lda];
+            }
+            if(i % 3 == 0)
+                hA[0][i + i * lda] += 400;
+        }
+
+        // do the Bunch-Kaufman factorization of matrix A w/ the reference LAPACK routine
+        cblas_sytrf<T>(uplo, n, hA[0], lda, hIpiv[0], hW.data(), size_W, &info);
+    }
+
+    if(GPU)
+    {
+        // now copy the factorization, pivots and right-hand sides to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void sytrs_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const int                 n,
+                    const int                 nrhs,
+                    Td&                       dA,
+                    const int                 lda,
+                    Ud&                       dIpiv,
+                    Td&                       dB,
+                    const int                 ldb,
+                    Td&                       dWork,
+                    const int                 lwork,
+                    Ud&                       dInfo,
+                    Th&                       hA,
+                    Uh&                       hIpiv,
+                    Th&                       hB,
+                    Th&                       hBRes,
+                    Uh&                       hInfoRes,
+                    double*                   max_err)
+{
+    // input data initialization
+    sytrs_initData<true, true, T>(handle, uplo, n, nrhs, dA, lda, dIpiv, dB, ldb, hA, hIpiv, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_sytrs(FORTRAN,
+                                        handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        dA.data(),
+                                        lda,
+                                        dIpiv.data(),
+                                        dB.data(),
+                                        ldb,
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data()));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cblas_sytrs<T>(uplo, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    *max_err = norm_error('I', n, nrhs, ldb, hB[0], hBRes[0]);
+
+    // also check info
+    if(hInfoRes[0][0] != 0)
+        *max_err += 1;
+}
+
+template <bool FORTRAN, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void sytrs_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const int                 n,
+                       const int                 nrhs,
+                       Td&                       dA,
+                       const int                 lda,
+                       Ud&                       dIpiv,
+                       Td&                       dB,
+                       const int                 ldb,
+                       Td&                       dWork,
+                       const int                 lwork,
+                       Ud&                       dInfo,
+                       Th&                       hA,
+                       Uh&                       hIpiv,
+                       Th&                       hB,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf)
+{
+    if(!perf)
+    {
+        sytrs_initData<true, false, T>(
+            handle, uplo, n, nrhs, dA, lda, dIpiv, dB, ldb, hA, hIpiv, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cblas_sytrs<T>(uplo, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    sytrs_initData<true, false, T>(handle, uplo, n, nrhs, dA, lda, dIpiv, dB, ldb, hA, hIpiv, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        sytrs_initData<false, true, T>(
+            handle, uplo, n, nrhs, dA, lda, dIpiv, dB, ldb, hA, hIpiv, hB);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_sytrs(FORTRAN,
+                                            handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            dA.data(),
+                                            lda,
+                                            dIpiv.data(),
+                                            dB.data(),
+                                            ldb,
+                                            dWork.data(),
+                                            lwork,
+                                            dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    hipsolver_bench_timer timer(stream);
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        sytrs_initData<false, true, T>(
+            handle, uplo, n, nrhs, dA, lda, dIpiv, dB, ldb, hA, hIpiv, hB);
+
+        timer.start();
+        hipsolver_sytrs(FORTRAN,
+                        handle,
+                        uplo,
+                        n,
+                        nrhs,
+                        dA.data(),
+                        lda,
+                        dIpiv.data(),
+                        dB.data(),
+                        ldb,
+                        dWork.data(),
+                        lwork,
+                        dInfo.data());
+        double elapsed = timer.stop();
+        hipsolver_bench_samples().push_back(elapsed);
+        *gpu_time_used += elapsed;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool FORTRAN, typename T>
+void testing_sytrs(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    int                    n     = argus.get<int>("n");
+    int                    nrhs  = argus.get<int>("nrhs", n);
+    int                    lda   = argus.get<int>("lda", n);
+    int                    ldb   = argus.get<int>("ldb", n);
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    int                 hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_sytrs(FORTRAN,
+                                              handle,
+                                              uplo,
+                                              n,
+                                              nrhs,
+                                              (T*)nullptr,
+                                              lda,
+                                              (int*)nullptr,
+                                              (T*)nullptr,
+                                              ldb,
+                                              (T*)nullptr,
+                                              0,
+                                              (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(2);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_P    = size_t(n);
+    size_t size_B    = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_sytrs(FORTRAN,
+                                              handle,
+                                              uplo,
+                                              n,
+                                              nrhs,
+                                              (T*)nullptr,
+                                              lda,
+                                              (int*)nullptr,
+                                              (T*)nullptr,
+                                              ldb,
+                                              (T*)nullptr,
+                                              0,
+                                              (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            ROCSOLVER_BENCH_INFORM(1);
+
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<int>   hIpiv(size_P, 1, size_P, 1);
+    host_strided_batch_vector<T>     hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T>     hBRes(size_BRes, 1, size_BRes, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<int> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T>   dB(size_B, 1, size_B, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    int size_W;
+    hipsolver_sytrs_bufferSize(FORTRAN,
+                               handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               dA.data(),
+                               lda,
+                               dIpiv.data(),
+                               dB.data(),
+                               ldb,
+                               &size_W);
+    device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+    if(size_W)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        sytrs_getError<FORTRAN, T>(handle,
+                                   uplo,
+                                   n,
+                                   nrhs,
+                                   dA,
+                                   lda,
+                                   dIpiv,
+                                   dB,
+                                   ldb,
+                                   dWork,
+                                   size_W,
+                                   dInfo,
+                                   hA,
+                                   hIpiv,
+                                   hB,
+                                   hBRes,
+                                   hInfoRes,
+                                   &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        sytrs_getPerfData<FORTRAN, T>(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      dA,
+                                      lda,
+                                      dIpiv,
+                                      dB,
+                                      ldb,
+                                      dWork,
+                                      size_W,
+                                      dInfo,
+                                      hA,
+                                      hIpiv,
+                                      hB,
+                                      &gpu_time_used,
+                                      &cpu_time_used,
+                                      hot_calls,
+                                      argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "n", "nrhs", "lda", "ldb");
+            rocsolver_bench_output(uploC, n, nrhs, lda, ldb);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -78,19 +78,38 @@ inline void hipsolver_expect_status(hipsolverStatus_t status, hipsolverStatus_t
 
 /* ============================================================================================
  */
-/*! \brief  local handle which is automatically created and destroyed  */
+/*! \brief  local handle which is automatically created and destroyed, unless it is shared  */
 class hipsolver_local_handle
 {
     hipsolverHandle_t m_handle;
+    bool              m_owner;
+
+    static hipsolverHandle_t& shared_handle()
+    {
+        static hipsolverHandle_t handle = nullptr;
+        return handle;
+    }
 
 public:
     hipsolver_local_handle()
+        : m_owner(shared_handle() == nullptr)
     {
-        hipsolverCreate(&m_handle);
+        if(m_owner)
+            hipsolverCreate(&m_handle);
+        else
+            m_handle = shared_handle();
     }
     ~hipsolver_local_handle()
     {
-        hipsolverDestroy(m_handle);
+        if(m_owner)
+            hipsolverDestroy(m_handle);
+    }
+
+    // While a shared handle is set, new local handles borrow it instead of creating their own.
+    // The benchmark client uses this to run many cases with a single handle.
+    static void set_shared(hipsolverHandle_t handle)
+    {
+        shared_handle() = handle;
     }
 
     hipsolver_local_handle(const hipsolver_local_handle&) = delete;
@@ -109,6 +128,67 @@ public:
     }
 };
 
+/*! \brief  local gesvdj info which is automatically created and destroyed  */
+class hipsolver_local_gesvdj_info
+{
+    hipsolverGesvdjInfo_t m_info;
+
+public:
+    hipsolver_local_gesvdj_info()
+    {
+        hipsolverCreateGesvdjInfo(&m_info);
+    }
+    ~hipsolver_local_gesvdj_info()
+    {
+        hipsolverDestroyGesvdjInfo(m_info);
+    }
+
+    hipsolver_local_gesvdj_info(const hipsolver_local_gesvdj_info&) = delete;
+    hipsolver_local_gesvdj_info(hipsolver_local_gesvdj_info&&)      = delete;
+    hipsolver_local_gesvdj_info& operator=(const hipsolver_local_gesvdj_info&) = delete;
+    hipsolver_local_gesvdj_info& operator=(hipsolver_local_gesvdj_info&&) = delete;
+
+    // Allow hipsolver_local_gesvdj_info to be used anywhere hipsolverGesvdjInfo_t is expected
+    operator hipsolverGesvdjInfo_t&()
+    {
+        return m_info;
+    }
+    operator const hipsolverGesvdjInfo_t&() const
+    {
+        return m_info;
+    }
+};
+
+class hipsolver_local_syevj_info
+{
+    hipsolverSyevjInfo_t m_info;
+
+public:
+    hipsolver_local_syevj_info()
+    {
+        hipsolverCreateSyevjInfo(&m_info);
+    }
+    ~hipsolver_local_syevj_info()
+    {
+        hipsolverDestroySyevjInfo(m_info);
+    }
+
+    hipsolver_local_syevj_info(const hipsolver_local_syevj_info&) = delete;
+    hipsolver_local_syevj_info(hipsolver_local_syevj_info&&)      = delete;
+    hipsolver_local_syevj_info& operator=(const hipsolver_local_syevj_info&) = delete;
+    hipsolver_local_syevj_info& operator=(hipsolver_local_syevj_info&&) = delete;
+
+    // Allow hipsolver_local_syevj_info to be used anywhere hipsolverSyevjInfo_t is expected
+    operator hipsolverSyevjInfo_t&()
+    {
+        return m_info;
+    }
+    operator const hipsolverSyevjInfo_t&() const
+    {
+        return m_info;
+    }
+};
+
 /* ============================================================================================
  */
 
@@ -376,4 +456,58 @@ double get_time_us_no_sync();
 }
 #endif
 
+#ifdef __cplusplus
+/*! \brief Timer of the hot calls of the benchmarks. In wall mode, the time between start and stop
+ *  is the host wall time between two synchronizations of the stream, as with get_time_us_sync. In
+ *  event mode, it is the device time between two events recorded on the stream, which excludes the
+ *  latency of the synchronization and the host jitter, but not the gaps between the kernels.
+ *
+ *  When the clients are built with HIPSOLVER_BENCH_TRACE, the kernel launches and the memory
+ *  copies that the host issues between start and stop are also counted, through roctracer (AMD)
+ *  or CUPTI (CUDA) callbacks. */
+class hipsolver_bench_timer
+{
+    hipStream_t stream;
+    hipEvent_t  start_event = nullptr;
+    hipEvent_t  stop_event  = nullptr;
+    double      start_us    = 0;
+    int64_t     launches0   = 0;
+    int64_t     memcpys0    = 0;
+
+public:
+    enum mode_t
+    {
+        wall,
+        event
+    };
+
+    // activity counted by all the timers since the last reset
+    struct totals_t
+    {
+        int64_t calls    = 0;
+        int64_t launches = 0;
+        int64_t memcpys  = 0;
+    };
+
+    // the mode of the timers created from now on; wall by default
+    static mode_t& mode();
+
+    // returns true if the launches and copies are counted
+    static bool tracing();
+
+    static totals_t& totals();
+
+    explicit hipsolver_bench_timer(hipStream_t stream);
+    ~hipsolver_bench_timer();
+
+    hipsolver_bench_timer(const hipsolver_bench_timer&) = delete;
+    hipsolver_bench_timer& operator=(const hipsolver_bench_timer&) = delete;
+
+    void start();
+
+    // returns the time in microseconds since the last start
+    double stop();
+};
+#endif
+
 /* ============================================================================================ */
@@ -8,13 +8,130 @@
 //#include "rocblas_test.hpp"
 #include <cinttypes>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 using rocblas_int    = int;
 using rocblas_stride = ptrdiff_t;
 
 /* ============================================================================================
  */
-/*! \brief  base-class to allocate/deallocate device memory */
+/*! \brief  memory of the host containers: pageable memory, or pinned (page-locked) memory
+ *          allocated with hipHostMalloc, which lets the asynchronous copies overlap with the
+ *          computations */
+enum class host_memory
+{
+    pageable,
+    pinned
+};
+
+/*! \brief  allocates nmemb zero-initialized elements of the given size, or returns nullptr */
+inline void* host_memory_alloc(size_t nmemb, size_t size, host_memory mem)
+{
+    if(mem == host_memory::pageable)
+        return calloc(nmemb, size);
+
+    void* p;
+    if(hipHostMalloc(&p, nmemb ? nmemb * size : size) != hipSuccess)
+        return nullptr;
+    memset(p, 0, nmemb * size);
+    return p;
+}
+
+inline void host_memory_free(void* p, host_memory mem)
+{
+    if(mem == host_memory::pageable)
+        free(p);
+    else
+        hipHostFree(p);
+}
+
+/* ============================================================================================
+ */
+/*! \brief  caching allocator for the device memory of the test containers. Freed blocks are kept
+ *          in power-of-two size buckets and handed out again to later allocations of the same
+ *          bucket, so that the thousands of test cases do not pay for a hipMalloc/hipFree pair per
+ *          container. */
+class device_memory_pool
+{
+    // blocks are cached while the pool holds less than this many bytes
+    static constexpr size_t max_cached = size_t(1) << 30;
+
+    std::mutex                                     m_mutex;
+    std::unordered_map<size_t, std::vector<void*>> m_free;
+    size_t                                         m_cached = 0;
+
+    static size_t bucket(size_t bytes)
+    {
+        size_t b = 256;
+        while(b < bytes)
+            b <<= 1;
+        return b;
+    }
+
+public:
+    static device_memory_pool& instance()
+    {
+        static device_memory_pool pool;
+        return pool;
+    }
+
+    hipError_t allocate(void** p, size_t bytes)
+    {
+        size_t b = bucket(bytes);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto&                       blocks = m_free[b];
+            if(!blocks.empty())
+            {
+                *p = blocks.back();
+                blocks.pop_back();
+                m_cached -= b;
+                return hipSuccess;
+            }
+        }
+
+        // on failure, return the cached blocks to the device and try again
+        if((hipMalloc)(p, b) == hipSuccess)
+            return hipSuccess;
+        release();
+        return (hipMalloc)(p, b);
+    }
+
+    hipError_t deallocate(void* p, size_t bytes)
+    {
+        size_t b = bucket(bytes);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_cached + b <= max_cached)
+            {
+                m_free[b].push_back(p);
+                m_cached += b;
+                return hipSuccess;
+            }
+        }
+        return (hipFree)(p);
+    }
+
+    //! @brief Frees the cached blocks.
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(auto& blocks : m_free)
+            for(void* p : blocks.second)
+                (hipFree)(p);
+        m_free.clear();
+        m_cached = 0;
+    }
+};
+
+/* ============================================================================================
+ */
+/*! \brief  base-class to allocate/deallocate device memory; the test clients allocate from the
+ *          device_memory_pool */
 template <typename T, size_t PAD, typename U>
 class d_vector
 {
@@ -50,7 +167,11 @@ public:
     T* device_vector_setup()
     {
         T* d;
+#ifdef GOOGLE_TEST
+        if(device_memory_pool::instance().allocate((void**)&d, bytes) != hipSuccess)
+#else
         if((hipMalloc)(&d, bytes) != hipSuccess)
+#endif
         {
             static char* lc = setlocale(LC_NUMERIC, "");
             fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", bytes, bytes >> 30);
@@ -126,7 +247,11 @@ public:
             }
 #endif
             // Free device memory
+#ifdef GOOGLE_TEST
+            CHECK_HIP_ERROR(device_memory_pool::instance().deallocate(d, bytes));
+#else
             CHECK_HIP_ERROR((hipFree)(d));
+#endif
         }
     }
 };
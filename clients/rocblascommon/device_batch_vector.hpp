@@ -216,6 +216,30 @@ public:
         return hipSuccess;
     }
 
+    //!
+    //! @brief Asynchronous transfer from a host batched vector.
+    //! @param that The host_batch_vector to copy.
+    //! @param stream The stream the copies are enqueued on.
+    //!
+    hipError_t transfer_from_async(const host_batch_vector<T>& that, hipStream_t stream)
+    {
+        hipError_t hip_err;
+        for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+        {
+            if(hipSuccess
+               != (hip_err = hipMemcpyAsync((*this)[batch_index],
+                                            that[batch_index],
+                                            sizeof(T) * this->nmemb(),
+                                            hipMemcpyHostToDevice,
+                                            stream)))
+            {
+                return hip_err;
+            }
+        }
+
+        return hipSuccess;
+    }
+
     //!
     //! @brief Check if memory exists.
     //! @return hipSuccess if memory exists, hipErrorOutOfMemory otherwise.
@@ -207,6 +207,21 @@ public:
             this->data(), that.data(), sizeof(T) * this->nmemb(), hipMemcpyHostToDevice);
     }
 
+    //!
+    //! @brief Asynchronous transfer data from a strided batched vector on host.
+    //! @param that That strided batched vector on host.
+    //! @param stream The stream the copy is enqueued on.
+    //! @return The hip error.
+    //!
+    hipError_t transfer_from_async(const host_strided_batch_vector<T>& that, hipStream_t stream)
+    {
+        return hipMemcpyAsync(this->data(),
+                              that.data(),
+                              sizeof(T) * this->nmemb(),
+                              hipMemcpyHostToDevice,
+                              stream);
+    }
+
     //!
     //! @brief Check if memory exists.
     //! @return hipSuccess if memory exists, hipErrorOutOfMemory otherwise.
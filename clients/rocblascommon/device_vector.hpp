@@ -152,6 +152,15 @@ public:
             this->m_data, (const T*)that, this->nmemb() * sizeof(T), hipMemcpyHostToDevice);
     }
 
+    hipError_t transfer_from_async(const host_vector<T>& that, hipStream_t stream)
+    {
+        return hipMemcpyAsync(this->m_data,
+                              (const T*)that,
+                              this->nmemb() * sizeof(T),
+                              hipMemcpyHostToDevice,
+                              stream);
+    }
+
     hipError_t memcheck() const
     {
         if(*this)
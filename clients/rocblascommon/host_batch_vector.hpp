@@ -34,11 +34,16 @@ public:
     //! @param n           The length of the vector.
     //! @param inc         The increment.
     //! @param batch_count The batch count.
+    //! @param mem         The host memory to allocate.
     //!
-    explicit host_batch_vector(rocblas_int n, rocblas_int inc, rocblas_int batch_count)
+    explicit host_batch_vector(rocblas_int n,
+                               rocblas_int inc,
+                               rocblas_int batch_count,
+                               host_memory mem = host_memory::pageable)
         : m_n(n)
         , m_inc(inc)
         , m_batch_count(batch_count)
+        , m_mem(mem)
     {
         if(false == this->try_initialize_memory())
         {
@@ -52,12 +57,14 @@ public:
     //! @param inc         The increment.
     //! @param stride      (UNUSED) The stride.
     //! @param batch_count The batch count.
+    //! @param mem         The host memory to allocate.
     //!
     explicit host_batch_vector(rocblas_int    n,
                                rocblas_int    inc,
                                rocblas_stride stride,
-                               rocblas_int    batch_count)
-        : host_batch_vector(n, inc, batch_count)
+                               rocblas_int    batch_count,
+                               host_memory    mem = host_memory::pageable)
+        : host_batch_vector(n, inc, batch_count, mem)
     {
     }
 
@@ -183,6 +190,32 @@ public:
         return hipSuccess;
     }
 
+    //!
+    //! @brief Asynchronous transfer from a device batched vector.
+    //! @param that the vector the data is copied from.
+    //! @param stream the stream the copies are enqueued on; they only overlap with other work
+    //! when the memory is pinned.
+    //! @return the hip error.
+    //!
+    hipError_t transfer_from_async(const device_batch_vector<T>& that, hipStream_t stream)
+    {
+        hipError_t hip_err;
+        size_t     num_bytes = size_t(this->m_n) * std::abs(this->m_inc) * sizeof(T);
+        for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+        {
+            if(hipSuccess
+               != (hip_err = hipMemcpyAsync((*this)[batch_index],
+                                            that[batch_index],
+                                            num_bytes,
+                                            hipMemcpyDeviceToHost,
+                                            stream)))
+            {
+                return hip_err;
+            }
+        }
+        return hipSuccess;
+    }
+
     //!
     //! @brief Check if memory exists.
     //! @return hipSuccess if memory exists, hipErrorOutOfMemory otherwise.
@@ -196,6 +229,7 @@ private:
     rocblas_int m_n{};
     rocblas_int m_inc{};
     rocblas_int m_batch_count{};
+    host_memory m_mem{host_memory::pageable};
     T**         m_data{};
 
     bool try_initialize_memory()
@@ -206,7 +240,9 @@ private:
             size_t nmemb = size_t(this->m_n) * std::abs(this->m_inc);
             for(rocblas_int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
             {
-                success = (nullptr != (this->m_data[batch_index] = (T*)calloc(nmemb, sizeof(T))));
+                success = (nullptr
+                           != (this->m_data[batch_index]
+                               = (T*)host_memory_alloc(nmemb, sizeof(T), this->m_mem)));
                 if(false == success)
                 {
                     break;
@@ -224,7 +260,7 @@ private:
             {
                 if(nullptr != this->m_data[batch_index])
                 {
-                    free(this->m_data[batch_index]);
+                    host_memory_free(this->m_data[batch_index], this->m_mem);
                     this->m_data[batch_index] = nullptr;
                 }
             }
@@ -45,13 +45,16 @@ public:
     //! @param stride The stride.
     //! @param batch_count The batch count.
     //! @param stg The storage format to use.
+    //! @param mem The host memory to allocate.
     //!
     explicit host_strided_batch_vector(rocblas_int    n,
                                        rocblas_int    inc,
                                        rocblas_stride stride,
                                        rocblas_int    batch_count,
-                                       storage        stg = storage::block)
+                                       storage        stg = storage::block,
+                                       host_memory    mem = host_memory::pageable)
         : m_storage(stg)
+        , m_mem(mem)
         , m_n(n)
         , m_inc(inc)
         , m_stride(stride)
@@ -83,11 +86,32 @@ public:
 
             if(valid_parameters)
             {
-                this->m_data = new T[this->m_nmemb];
+                if(this->m_mem == host_memory::pageable)
+                    this->m_data = new T[this->m_nmemb];
+                else
+                    this->m_data
+                        = (T*)host_memory_alloc(this->m_nmemb, sizeof(T), host_memory::pinned);
             }
         }
     }
 
+    //!
+    //! @brief Constructor with block storage.
+    //! @param n   The length of the vector.
+    //! @param inc The increment.
+    //! @param stride The stride.
+    //! @param batch_count The batch count.
+    //! @param mem The host memory to allocate.
+    //!
+    explicit host_strided_batch_vector(rocblas_int    n,
+                                       rocblas_int    inc,
+                                       rocblas_stride stride,
+                                       rocblas_int    batch_count,
+                                       host_memory    mem)
+        : host_strided_batch_vector(n, inc, stride, batch_count, storage::block, mem)
+    {
+    }
+
     //!
     //! @brief Destructor.
     //!
@@ -95,7 +119,10 @@ public:
     {
         if(nullptr != this->m_data)
         {
-            delete[] this->m_data;
+            if(this->m_mem == host_memory::pageable)
+                delete[] this->m_data;
+            else
+                host_memory_free(this->m_data, this->m_mem);
             this->m_data = nullptr;
         }
     }
@@ -229,6 +256,24 @@ public:
             this->m_data, that.data(), sizeof(T) * this->m_nmemb, hipMemcpyDeviceToHost);
     }
 
+    //!
+    //! @brief Asynchronous transfer of data from a strided batched vector on device.
+    //! @param that That strided batched vector on device.
+    //! @param stream The stream the copy is enqueued on; it only overlaps with other work when
+    //! the memory is pinned.
+    //! @return The hip error.
+    //!
+    template <size_t PAD, typename U>
+    hipError_t transfer_from_async(const device_strided_batch_vector<T, PAD, U>& that,
+                                   hipStream_t                                   stream)
+    {
+        return hipMemcpyAsync(this->m_data,
+                              that.data(),
+                              sizeof(T) * this->m_nmemb,
+                              hipMemcpyDeviceToHost,
+                              stream);
+    }
+
     //!
     //! @brief Check if memory exists.
     //! @return hipSuccess if memory exists, hipErrorOutOfMemory otherwise.
@@ -240,6 +285,7 @@ public:
 
 private:
     storage        m_storage{storage::block};
+    host_memory    m_mem{host_memory::pageable};
     rocblas_int    m_n{};
     rocblas_int    m_inc{};
     rocblas_stride m_stride{};
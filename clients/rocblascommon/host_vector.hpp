@@ -65,6 +65,12 @@ struct host_vector : std::vector<T>
         return hipMemcpy(*this, that, sizeof(T) * this->size(), hipMemcpyDeviceToHost);
     }
 
+    hipError_t transfer_from_async(const device_vector<T>& that, hipStream_t stream)
+    {
+        return hipMemcpyAsync(
+            *this, that, sizeof(T) * this->size(), hipMemcpyDeviceToHost, stream);
+    }
+
     //!
     //! @brief Returns the length of the vector.
     //!
@@ -9,6 +9,7 @@
 // #include "rocblas_math.hpp"
 // #include "rocblas_random.hpp"
 #include "../include/utility.hpp"
+#include <algorithm>
 #include <cinttypes>
 #include <iostream>
 #include <vector>
@@ -199,6 +200,89 @@ void rocblas_init_nan(
                 A[i + j * lda + i_batch * stride] = T(hipsolver_nan_rng());
 }
 
+/* ============================================================================================
+ */
+/*! \brief  device matrix initialization: */
+// the data is generated by rocRAND (AMD) or cuRAND (NVIDIA) directly in device memory, so that
+// large problems are not staged on the host; for complex numbers, the real and imaginary parts
+// are generated independently
+
+/*! \brief  pseudo-random generator of device data that is automatically created and destroyed,
+ *          and that runs on the stream of the given hipSOLVER handle */
+class device_rand_generator
+{
+    void*       m_gen;
+    hipStream_t m_stream;
+
+public:
+    explicit device_rand_generator(hipsolverHandle_t handle);
+    ~device_rand_generator();
+
+    device_rand_generator(const device_rand_generator&) = delete;
+    device_rand_generator& operator=(const device_rand_generator&) = delete;
+
+    void* get() const
+    {
+        return m_gen;
+    }
+
+    hipStream_t stream() const
+    {
+        return m_stream;
+    }
+};
+
+// Initialize device matrix with random values in (0, 1]
+// (the generator is seeded from hipsolver_rng, so hipsolver_seedrand also repeats the device data)
+template <typename T>
+hipsolverStatus_t rocblas_init_device(const device_rand_generator& rng,
+                                      T*                           A,
+                                      size_t                       M,
+                                      size_t                       N,
+                                      size_t                       lda,
+                                      size_t                       stride      = 0,
+                                      size_t                       batch_count = 1);
+
+/*! \brief  diagonally dominant device matrix initialization: */
+// random values in (0, 1] with real diagonal elements in [2k+1, 2k+10], k = max(M, N), so
+// the matrix is non-singular, and also positive definite when only one triangle is referenced.
+// With reverse_rows, the dominant elements are placed as if the rows were shuffled in reverse
+// order, as done for the host data, so that the factorizations have to pivot
+template <typename T>
+void rocblas_init_device_diag_dominant(const device_rand_generator& rng,
+                                       T*                           A,
+                                       size_t                       M,
+                                       size_t                       N,
+                                       size_t                       lda,
+                                       size_t                       stride       = 0,
+                                       size_t                       batch_count  = 1,
+                                       bool                         reverse_rows = false)
+{
+    size_t         K = std::min(M, N);
+    std::vector<T> diag(K * batch_count);
+
+    CHECK_ROCBLAS_ERROR(rocblas_init_device<T>(rng, A, M, N, lda, stride, batch_count));
+    if(K == 0)
+        return;
+
+    for(size_t i = 0; i < diag.size(); ++i)
+        diag[i] = T(2 * std::max(M, N) + random_generator<double>());
+
+    // the k-th dominant element is at (k, k), or at (M-1-k, k) when the rows are reversed
+    size_t offset = reverse_rows ? M - 1 : 0;
+    size_t pitch  = (reverse_rows ? lda - 1 : lda + 1) * sizeof(T);
+    for(size_t b = 0; b < batch_count; ++b)
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(A + offset + b * stride,
+                                         K > 1 ? pitch : sizeof(T),
+                                         diag.data() + b * K,
+                                         sizeof(T),
+                                         sizeof(T),
+                                         K,
+                                         hipMemcpyHostToDevice,
+                                         rng.stream()));
+    CHECK_HIP_ERROR(hipStreamSynchronize(rng.stream()));
+}
+
 /* ============================================================================================
  */
 /*! \brief  Packs strided_batched matricies into groups of 4 in N */
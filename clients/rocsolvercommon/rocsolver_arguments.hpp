@@ -22,13 +22,18 @@ class Arguments : private std::map<std::string, variable_value>
 
 public:
     // test options
-    rocblas_int norm_check  = 0;
-    rocblas_int unit_check  = 1;
-    rocblas_int timing      = 0;
-    rocblas_int perf        = 0;
-    rocblas_int singular    = 0;
-    rocblas_int iters       = 5;
-    rocblas_int batch_count = 1;
+    rocblas_int norm_check    = 0;
+    rocblas_int unit_check    = 1;
+    rocblas_int device_verify = 0;
+    rocblas_int timing        = 0;
+    rocblas_int perf          = 0;
+    rocblas_int singular      = 0;
+    rocblas_int iters         = 5;
+    rocblas_int batch_count   = 1;
+    rocblas_int streams       = 1;
+    rocblas_int handles       = 1;
+    rocblas_int pinned        = 0;
+    rocblas_int e2e           = 0;
 
     // get and set function arguments
     template <typename T>
@@ -82,10 +87,18 @@ public:
         to_consume.erase("precision");
         to_consume.erase("batch_count");
         to_consume.erase("verify");
+        to_consume.erase("device_verify");
         to_consume.erase("iters");
         to_consume.erase("perf");
         to_consume.erase("singular");
         to_consume.erase("device");
+        to_consume.erase("output");
+        to_consume.erase("sweep");
+        to_consume.erase("file");
+        to_consume.erase("streams");
+        to_consume.erase("handles");
+        to_consume.erase("pinned");
+        to_consume.erase("e2e");
     }
 
     void clear()
@@ -205,6 +218,17 @@ public:
             throw std::invalid_argument("Invalid value for " + name);
     }
 
+    void validate_erange(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char range = val->second.as<char>();
+        if(range != 'A' && range != 'V' && range != 'I')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
     void validate_consumed() const
     {
         if(to_consume.size() > 0)
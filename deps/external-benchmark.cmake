@@ -0,0 +1,40 @@
+# ########################################################################
+# Copyright 2021 Advanced Micro Devices, Inc.
+# ########################################################################
+
+message( STATUS "Configuring google benchmark external dependency" )
+include( ExternalProject )
+
+set( PREFIX_BENCHMARK ${CMAKE_INSTALL_PREFIX} CACHE PATH "Location where google benchmark should install, defaults to /usr/local" )
+set( benchmark_cmake_args -DCMAKE_INSTALL_PREFIX=${PREFIX_BENCHMARK} )
+append_cmake_cli_arguments( benchmark_cmake_args benchmark_cmake_args )
+
+set( benchmark_git_repository "https://github.com/google/benchmark.git" CACHE STRING "URL to download google benchmark from" )
+set( benchmark_git_tag "v1.6.0" CACHE STRING "git branch" )
+
+include( GNUInstallDirs )
+
+# The clients find the library through its cmake exports; the same debian lib/<machine> paths
+# issue as for lapack applies
+if( ${CMAKE_INSTALL_LIBDIR} MATCHES "lib/.*" )
+  list( APPEND benchmark_cmake_args "-DCMAKE_INSTALL_LIBDIR=lib" )
+endif( )
+
+ExternalProject_Add(
+  benchmark
+  PREFIX ${CMAKE_BINARY_DIR}/benchmark
+  GIT_REPOSITORY ${benchmark_git_repository}
+  GIT_TAG ${benchmark_git_tag}
+  CMAKE_ARGS ${benchmark_cmake_args} -DCMAKE_BUILD_TYPE=Release -DBENCHMARK_ENABLE_TESTING=OFF
+  LOG_BUILD 1
+  INSTALL_COMMAND ""
+  LOG_INSTALL 1
+)
+
+set_property( TARGET benchmark PROPERTY FOLDER "extern" )
+ExternalProject_Get_Property( benchmark install_dir )
+ExternalProject_Get_Property( benchmark binary_dir )
+
+# For use by the user of external-benchmark.cmake
+set( BENCHMARK_INSTALL_ROOT ${install_dir} )
+set( BENCHMARK_BINARY_ROOT ${binary_dir} )
@@ -189,6 +189,12 @@ install_packages( )
         library_dependencies_sles+=( "${custom_rocsolver}" )
       fi
     fi
+
+    # The sparse solvers need rocsparse
+    library_dependencies_ubuntu+=( "rocsparse" )
+    library_dependencies_centos+=( "rocsparse" )
+    library_dependencies_fedora+=( "rocsparse" )
+    library_dependencies_sles+=( "rocsparse" )
   fi
 
   local client_dependencies_ubuntu=( "gfortran" )
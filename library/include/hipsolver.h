@@ -40,6 +40,18 @@
 #endif
 
 typedef void* hipsolverHandle_t;
+typedef void* hipsolverHandlePool_t;
+typedef void* hipsolverGesvdjInfo_t;
+typedef void* hipsolverSyevjInfo_t;
+typedef void* hipsolverPlan_t;
+typedef void* hipsolverMgHandle_t;
+typedef void* hipsolverMgMatrixDesc_t;
+typedef void* hipsolverSpHandle_t;
+typedef void* hipsolverSpMatDescr_t;
+typedef void* hipsolverSpCsrcholInfo_t;
+typedef void* hipsolverSpCsrqrInfo_t;
+typedef void* hipsolverRfHandle_t;
+typedef void* hipsolverDnParams_t;
 
 typedef struct hipsolverComplex
 {
@@ -161,6 +173,8 @@ typedef enum
     HIPSOLVER_STATUS_HANDLE_IS_NULLPTR = 9, // hipSOLVER handle is null pointer
     HIPSOLVER_STATUS_INVALID_ENUM      = 10, // unsupported enum value was passed to function
     HIPSOLVER_STATUS_UNKNOWN           = 11, // back-end returned an unsupported status code
+    HIPSOLVER_STATUS_CAPTURE_UNSAFE    = 12, // operation cannot be recorded by a stream capture
+    HIPSOLVER_STATUS_ZERO_PIVOT        = 13, // a zero pivot was encountered by a refactorization
 } hipsolverStatus_t;
 
 // set the values of enum constants to be the same as those used in cblas
@@ -196,10 +210,137 @@ typedef enum
     HIPSOLVER_EIG_TYPE_3 = 213,
 } hipsolverEigType_t;
 
+typedef enum
+{
+    HIPSOLVER_EIG_RANGE_ALL = 231,
+    HIPSOLVER_EIG_RANGE_V   = 232,
+    HIPSOLVER_EIG_RANGE_I   = 233,
+} hipsolverEigRange_t;
+
+typedef enum
+{
+    HIPSOLVER_WORKSPACE_CACHE_OFF = 0, // bufferSize functions always query the back-end
+    HIPSOLVER_WORKSPACE_CACHE_ON  = 1, // bufferSize results are reused for repeated arguments
+} hipsolverWorkspaceCacheMode_t;
+
+typedef enum
+{
+    HIPSOLVER_WORKSPACE_ALLOC_DEFAULT        = 0, // hipMalloc; growth synchronizes the device
+    HIPSOLVER_WORKSPACE_ALLOC_STREAM_ORDERED = 1, // hipMallocAsync on the stream of the handle
+} hipsolverWorkspaceAllocMode_t;
+
+typedef enum
+{
+    HIPSOLVER_MANAGED_MEMORY_OFF             = 0, // managed arguments migrate on demand
+    HIPSOLVER_MANAGED_MEMORY_PREFETCH        = 1, // managed arguments are prefetched to the device
+    HIPSOLVER_MANAGED_MEMORY_PREFETCH_RETURN = 2, // and the results are prefetched back to the host
+} hipsolverManagedMemoryMode_t;
+
+typedef enum
+{
+    HIPSOLVER_INFO_MODE_DEFAULT   = 0, // info is only written to the devInfo arrays
+    HIPSOLVER_INFO_MODE_AGGREGATE = 1, // info is also accumulated on the device for later summary
+} hipsolverInfoMode_t;
+
+typedef enum
+{
+    HIPSOLVER_COMPLETION_MODE_DEFAULT = 0, // nothing is enqueued after the solver functions
+    HIPSOLVER_COMPLETION_MODE_EVENT   = 1, // the completion event of the handle is recorded after
+                                           // each solver function
+} hipsolverCompletionMode_t;
+
+typedef enum
+{
+    HIPSOLVER_ALG_0 = 0, // default algorithm of the back-end
+    HIPSOLVER_ALG_1 = 1, // alternative algorithm, where the back-end provides one
+} hipsolverAlgMode_t;
+
+typedef enum
+{
+    HIPSOLVER_NORM_ONE = 0, // 1-norm, the largest column sum of absolute values
+    HIPSOLVER_NORM_INF = 1, // infinity-norm, the largest row sum of absolute values
+} hipsolverNormType_t;
+
+typedef enum
+{
+    HIPSOLVERDN_GETRF = 0,
+    HIPSOLVERDN_POTRF = 1,
+    HIPSOLVERDN_SYEVD = 2,
+} hipsolverDnFunction_t;
+
+typedef enum
+{
+    HIPSOLVER_ADV_ALGORITHM      = 0, // a hipsolverAlgMode_t value
+    HIPSOLVER_ADV_PIVOTING       = 1, // nonzero for partial pivoting (default), zero for none
+    HIPSOLVER_ADV_UNBLOCKED_SIZE = 2, // problems up to this size use the unblocked algorithm
+    HIPSOLVER_ADV_HOST_SIZE      = 3, // problems up to this size in host-accessible memory are
+                                      // solved on the host; zero (default) disables it
+} hipsolverAdvOption_t;
+
+typedef enum
+{
+    HIPSOLVER_AUTOTUNE_OFF = 0, // algorithms are chosen by the hints of the handle
+    HIPSOLVER_AUTOTUNE_ON  = 1, // functions without hints take the fastest measured algorithm
+} hipsolverAutotuneMode_t;
+
+typedef enum
+{
+    HIPSOLVER_INDEX_BASE_ZERO = 0, // CSR indices start at zero (default)
+    HIPSOLVER_INDEX_BASE_ONE  = 1, // CSR indices start at one
+} hipsolverIndexBase_t;
+
+typedef struct hipsolverInfoSummary_t
+{
+    int info_count;    // number of info values accumulated since the previous summary
+    int any_failure;   // nonzero if any of the info values was nonzero
+    int failure_count; // number of nonzero info values, or -1 if they could not be read
+    int first_failure; // position of the first nonzero info value, or -1 if there was none
+} hipsolverInfoSummary_t;
+
+typedef struct hipsolverWorkspaceStats_t
+{
+    size_t  current_size;  // bytes of device memory held by the workspace of the handle
+    size_t  peak_size;     // largest current_size
+    size_t  peak_request;  // largest workspace requested by a function
+    int64_t growth_count;  // number of times the workspace was reallocated to grow
+    int     routine_count; // number of functions that requested workspace
+} hipsolverWorkspaceStats_t;
+
+typedef struct hipsolverRoutineWorkspace_t
+{
+    const char* routine;      // name of the function, such as "hipsolverDgetrf"
+    size_t      peak_request; // largest workspace requested by the function
+    int64_t     calls;        // number of calls that requested workspace
+} hipsolverRoutineWorkspace_t;
+
+// called by a function whose workspace request grew the workspace of handle from old_size to
+// new_size bytes, before the function is enqueued; routine is null for a growth that is not
+// requested by a function. The callback must not call hipSOLVER on handle
+typedef void (*hipsolverWorkspaceGrowthCallback_t)(hipsolverHandle_t handle,
+                                                   const char*       routine,
+                                                   size_t            old_size,
+                                                   size_t            new_size,
+                                                   void*             user_data);
+
+// called from a host thread of the runtime once a solver function called on handle has completed
+// on the device, with the name of the function and the count values of its devInfo array copied
+// to the host, or a null info if the stream failed before they could be copied. The values are
+// only valid during the call. The callback must not call hipSOLVER or enqueue work on a stream
+typedef void (*hipsolverCompletionCallback_t)(hipsolverHandle_t handle,
+                                              const char*       routine,
+                                              const int*        info,
+                                              int               count,
+                                              void*             user_data);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// creates a handle. A hipSOLVER handle is the rocBLAS or cuSOLVER handle itself, so the back-end
+// handle is always created here, with whatever rocblas_create_handle or cusolverDnCreate does
+// eagerly; only the hipSOLVER state of the handle, such as its workspace and autotuning cache, is
+// allocated on first use. The kernels the functions need are loaded by their first call, or
+// ahead of it by hipsolverPreload
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreate(hipsolverHandle_t* handle);
 
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroy(hipsolverHandle_t handle);
@@ -210,6 +351,1330 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetStream(hipsolverHandle_t handle,
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetStream(hipsolverHandle_t handle,
                                                       hipStream_t*      streamId);
 
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSetWorkspaceCacheMode(hipsolverHandle_t handle, hipsolverWorkspaceCacheMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverGetWorkspaceCacheMode(hipsolverHandle_t handle, hipsolverWorkspaceCacheMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverClearWorkspaceCache(hipsolverHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t handle,
+                                                             size_t            bytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSetWorkspaceAllocMode(hipsolverHandle_t handle, hipsolverWorkspaceAllocMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverGetWorkspaceAllocMode(hipsolverHandle_t handle, hipsolverWorkspaceAllocMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetWorkspaceMemPool(hipsolverHandle_t handle,
+                                                                hipMemPool_t      pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetWorkspaceMemPool(hipsolverHandle_t handle,
+                                                                hipMemPool_t*     pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSetManagedMemoryMode(hipsolverHandle_t handle, hipsolverManagedMemoryMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverGetManagedMemoryMode(hipsolverHandle_t handle, hipsolverManagedMemoryMode_t* mode);
+
+// batched functions called on handle split their batch over the devices selected on the
+// hipsolverMg handle group, or run on the device of handle if group is null. The group must
+// outlive its use by handle, and is set while the device of handle is current.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetDeviceGroup(hipsolverHandle_t   handle,
+                                                           hipsolverMgHandle_t group);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetDeviceGroup(hipsolverHandle_t    handle,
+                                                           hipsolverMgHandle_t* group);
+
+// potrfBatched and getrfBatched solve a batch whose workspace exceeds bytes, or the largest lwork
+// that fits in an int, in chunks of consecutive problems that reuse the workspace of one chunk,
+// and their bufferSize functions return the workspace of a chunk. Zero (default) sets no limit.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetBatchWorkspaceLimit(hipsolverHandle_t handle,
+                                                                   size_t            bytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetBatchWorkspaceLimit(hipsolverHandle_t handle,
+                                                                   size_t*           bytes);
+
+// number of problems per chunk of the last chunked batched function called on handle
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetBatchChunkSize(hipsolverHandle_t handle,
+                                                              int*              chunk_size);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetInfoMode(hipsolverHandle_t   handle,
+                                                        hipsolverInfoMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetInfoMode(hipsolverHandle_t    handle,
+                                                        hipsolverInfoMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetInfoAsync(hipsolverHandle_t       handle,
+                                                         hipsolverInfoSummary_t* summary,
+                                                         hipEvent_t              event);
+
+// in HIPSOLVER_COMPLETION_MODE_EVENT, the completion event of handle is recorded on its stream
+// after every solver function called on handle. The event belongs to the handle and is recorded
+// again by the next solver function, so it is to be queried or waited for, with
+// hipStreamWaitEvent for instance, before that; each handle of a pool can hold a solve in flight
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetCompletionMode(hipsolverHandle_t         handle,
+                                                              hipsolverCompletionMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetCompletionMode(hipsolverHandle_t          handle,
+                                                              hipsolverCompletionMode_t* mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetCompletionEvent(hipsolverHandle_t handle,
+                                                               hipEvent_t*       event);
+
+// the callback is made after every solver function called on handle, in stream order, until it
+// is set to null, and the completion event, if recorded, completes after the callback returns.
+// Solver functions cannot be captured into a graph while a callback is set, and destroying the
+// handle waits for the device if any callback is still pending
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetCompletionCallback(
+    hipsolverHandle_t handle, hipsolverCompletionCallback_t callback, void* user_data);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetAdvOptions(hipsolverHandle_t     handle,
+                                                          hipsolverDnFunction_t function,
+                                                          hipsolverAdvOption_t  option,
+                                                          int                   value);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetAdvOptions(hipsolverHandle_t     handle,
+                                                          hipsolverDnFunction_t function,
+                                                          hipsolverAdvOption_t  option,
+                                                          int*                  value);
+
+// while enabled, the first call of getrf or potrf without algorithm hints on an unseen shape
+// times the candidate algorithms and caches the fastest per device architecture, precision and
+// shape bucket. HIPSOLVER_AUTOTUNE_PATH names a file from which hipsolverCreate loads the cache,
+// and to which new selections are saved; handles created while it is set start enabled
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetAutotuneMode(hipsolverHandle_t       handle,
+                                                            hipsolverAutotuneMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetAutotuneMode(hipsolverHandle_t        handle,
+                                                            hipsolverAutotuneMode_t* mode);
+
+// numbers of calls of function solved on the host and on the device while its host size was
+// nonzero, since the handle was created or the statistics were reset
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetHostDispatchStats(hipsolverHandle_t     handle,
+                                                                 hipsolverDnFunction_t function,
+                                                                 int64_t*              hostCalls,
+                                                                 int64_t*              deviceCalls);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverResetHostDispatchStats(hipsolverHandle_t handle);
+
+// statistics of the workspace that functions called without a work array take from handle, since
+// the handle was created or the statistics were reset. hipsolverGetWorkspaceRoutineStats copies
+// the statistics of up to capacity functions, in decreasing order of their largest request, and
+// the total number of functions is the routine_count of hipsolverGetWorkspaceStats. Resetting
+// keeps the workspace, and the growth callback of the handle
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetWorkspaceStats(hipsolverHandle_t          handle,
+                                                              hipsolverWorkspaceStats_t* stats);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverGetWorkspaceRoutineStats(hipsolverHandle_t            handle,
+                                      hipsolverRoutineWorkspace_t* routines,
+                                      int                          capacity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverResetWorkspaceStats(hipsolverHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetWorkspaceGrowthCallback(
+    hipsolverHandle_t handle, hipsolverWorkspaceGrowthCallback_t callback, void* user_data);
+
+// runs each function once on a problem of order n and the given precision, so that the back-end
+// loads what the function needs before its first use. It does not make hipsolverCreate cheaper,
+// as the back-end handle is created by hipsolverCreate
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverPreload(hipsolverHandle_t            handle,
+                                                    const hipsolverDnFunction_t* functions,
+                                                    int                          count,
+                                                    hipDataType                  dataType,
+                                                    int                          n);
+
+// handle pools
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateHandlePool(hipsolverHandlePool_t* pool,
+                                                             int                    handles,
+                                                             size_t                 workspace);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroyHandlePool(hipsolverHandlePool_t pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolAcquire(hipsolverHandlePool_t pool,
+                                                              hipsolverHandle_t*    handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolRelease(hipsolverHandlePool_t pool,
+                                                              hipsolverHandle_t     handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolGetCount(hipsolverHandlePool_t pool,
+                                                               int*                  handles,
+                                                               int*                  idle);
+
+// plans
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroyPlan(hipsolverPlan_t plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_execPlan(hipsolverPlan_t plan,
+                                                            float*          A,
+                                                            int*            devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf_execPlan(hipsolverPlan_t plan,
+                                                            double*         A,
+                                                            int*            devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf_execPlan(hipsolverPlan_t   plan,
+                                                            hipsolverComplex* A,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf_execPlan(hipsolverPlan_t         plan,
+                                                            hipsolverDoubleComplex* A,
+                                                            int*                    devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_createPlan(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               lda,
+                                                              hipsolverPlan_t*  plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrf_createPlan(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               lda,
+                                                              hipsolverPlan_t*  plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrf_createPlan(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               lda,
+                                                              hipsolverPlan_t*  plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf_createPlan(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               lda,
+                                                              hipsolverPlan_t*  plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_execPlan(hipsolverPlan_t plan,
+                                                            float*          A,
+                                                            int*            devIpiv,
+                                                            int*            devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrf_execPlan(hipsolverPlan_t plan,
+                                                            double*         A,
+                                                            int*            devIpiv,
+                                                            int*            devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrf_execPlan(hipsolverPlan_t   plan,
+                                                            hipsolverComplex* A,
+                                                            int*              devIpiv,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf_execPlan(hipsolverPlan_t         plan,
+                                                            hipsolverDoubleComplex* A,
+                                                            int*                    devIpiv,
+                                                            int*                    devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevd_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevd_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd_createPlan(hipsolverHandle_t   handle,
+                                                              hipsolverEigMode_t  jobz,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 lda,
+                                                              hipsolverPlan_t*    plan);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_execPlan(hipsolverPlan_t plan,
+                                                            float*          A,
+                                                            float*          D,
+                                                            int*            devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevd_execPlan(hipsolverPlan_t plan,
+                                                            double*         A,
+                                                            double*         D,
+                                                            int*            devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevd_execPlan(hipsolverPlan_t   plan,
+                                                            hipsolverComplex* A,
+                                                            float*            D,
+                                                            int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd_execPlan(hipsolverPlan_t         plan,
+                                                            hipsolverDoubleComplex* A,
+                                                            double*                 D,
+                                                            int*                    devInfo);
+
+// multi-GPU
+// On AMD, potrf accepts both fill modes, getrs all three operations, and syevd gathers the matrix
+// on the first device of the handle to solve it there. On NVIDIA, the solvers forward to
+// cuSOLVERMg and support what it supports; a library built without cuSOLVERMg returns
+// HIPSOLVER_STATUS_NOT_SUPPORTED from them.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCreate(hipsolverMgHandle_t* handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDestroy(hipsolverMgHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDeviceSelect(hipsolverMgHandle_t handle,
+                                                           int                 nbDevices,
+                                                           const int*          deviceId);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverMgCreateMatrixDesc(hipsolverMgHandle_t      handle,
+                                hipsolverMgMatrixDesc_t* desc,
+                                int64_t                  numRows,
+                                int64_t                  numCols,
+                                int64_t                  colBlockSize);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDestroyMatrixDesc(hipsolverMgMatrixDesc_t desc);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                float*                  A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                double*                 A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipsolverComplex*       A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZpotrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipsolverDoubleComplex* A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     float*                  A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     float*                  work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     double*                 A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     double*                 work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipsolverComplex*       A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     hipsolverComplex*       work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZpotrf(hipsolverMgHandle_t     handle,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     hipsolverDoubleComplex* work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                float*                  A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                double*                 A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                hipsolverComplex*       A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZgetrf_bufferSize(hipsolverMgHandle_t     handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                hipsolverDoubleComplex* A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     float*                  A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     float*                  work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     double*                 A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     double*                 work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipsolverComplex*       A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     hipsolverComplex*       work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZgetrf(hipsolverMgHandle_t     handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     hipsolverDoubleComplex* work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSgetrs_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverOperation_t    trans,
+                                                                int                     n,
+                                                                int                     nrhs,
+                                                                float*                  A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                float*                  B[],
+                                                                hipsolverMgMatrixDesc_t descB,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDgetrs_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverOperation_t    trans,
+                                                                int                     n,
+                                                                int                     nrhs,
+                                                                double*                 A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                double*                 B[],
+                                                                hipsolverMgMatrixDesc_t descB,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCgetrs_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverOperation_t    trans,
+                                                                int                     n,
+                                                                int                     nrhs,
+                                                                hipsolverComplex*       A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                hipsolverComplex*       B[],
+                                                                hipsolverMgMatrixDesc_t descB,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZgetrs_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverOperation_t    trans,
+                                                                int                     n,
+                                                                int                     nrhs,
+                                                                hipsolverDoubleComplex* A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                int*                    ipiv[],
+                                                                hipsolverDoubleComplex* B[],
+                                                                hipsolverMgMatrixDesc_t descB,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSgetrs(hipsolverMgHandle_t     handle,
+                                                     hipsolverOperation_t    trans,
+                                                     int                     n,
+                                                     int                     nrhs,
+                                                     float*                  A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     float*                  B[],
+                                                     hipsolverMgMatrixDesc_t descB,
+                                                     float*                  work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDgetrs(hipsolverMgHandle_t     handle,
+                                                     hipsolverOperation_t    trans,
+                                                     int                     n,
+                                                     int                     nrhs,
+                                                     double*                 A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     double*                 B[],
+                                                     hipsolverMgMatrixDesc_t descB,
+                                                     double*                 work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCgetrs(hipsolverMgHandle_t     handle,
+                                                     hipsolverOperation_t    trans,
+                                                     int                     n,
+                                                     int                     nrhs,
+                                                     hipsolverComplex*       A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     hipsolverComplex*       B[],
+                                                     hipsolverMgMatrixDesc_t descB,
+                                                     hipsolverComplex*       work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZgetrs(hipsolverMgHandle_t     handle,
+                                                     hipsolverOperation_t    trans,
+                                                     int                     n,
+                                                     int                     nrhs,
+                                                     hipsolverDoubleComplex* A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     int*                    ipiv[],
+                                                     hipsolverDoubleComplex* B[],
+                                                     hipsolverMgMatrixDesc_t descB,
+                                                     hipsolverDoubleComplex* work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                float*                  A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                float*                  W,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDsyevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                double*                 A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                double*                 W,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipsolverComplex*       A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                float*                  W,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZheevd_bufferSize(hipsolverMgHandle_t     handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipsolverDoubleComplex* A[],
+                                                                hipsolverMgMatrixDesc_t descA,
+                                                                double*                 W,
+                                                                int64_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgSsyevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     float*                  A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     float*                  W,
+                                                     float*                  work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgDsyevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     double*                 A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     double*                 W,
+                                                     double*                 work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgCheevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipsolverComplex*       A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     float*                  W,
+                                                     hipsolverComplex*       work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverMgZheevd(hipsolverMgHandle_t     handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A[],
+                                                     hipsolverMgMatrixDesc_t descA,
+                                                     double*                 W,
+                                                     hipsolverDoubleComplex* work[],
+                                                     int64_t                 lwork,
+                                                     int*                    info);
+
+// sparse: matrices are in CSR format with 32-bit indices, described by a hipsolverSpMatDescr_t.
+// Only general matrices are supported; the Cholesky solvers use their lower triangle.
+// On AMD, rocSOLVER has no sparse factorizations: the matrices are expanded to dense storage and
+// solved with the dense factorizations, so memory and time grow with the square and cube of the
+// order whatever the number of nonzeros. The reorder argument of csrlsvchol and csrlsvqr is
+// ignored, and orders above 8192 (512 MB of dense doubles) return HIPSOLVER_STATUS_NOT_SUPPORTED.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCreate(hipsolverSpHandle_t* handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDestroy(hipsolverSpHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpSetStream(hipsolverSpHandle_t handle,
+                                                        hipStream_t         streamId);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpGetStream(hipsolverSpHandle_t handle,
+                                                        hipStream_t*        streamId);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCreateMatDescr(hipsolverSpMatDescr_t* descrA);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDestroyMatDescr(hipsolverSpMatDescr_t descrA);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpSetMatIndexBase(hipsolverSpMatDescr_t descrA,
+                                                              hipsolverIndexBase_t  base);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpGetMatIndexBase(hipsolverSpMatDescr_t descrA,
+                                                              hipsolverIndexBase_t* base);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCreateCsrcholInfo(hipsolverSpCsrcholInfo_t* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDestroyCsrcholInfo(hipsolverSpCsrcholInfo_t info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCreateCsrqrInfo(hipsolverSpCsrqrInfo_t* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDestroyCsrqrInfo(hipsolverSpCsrqrInfo_t info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpXcsrcholAnalysis(hipsolverSpHandle_t      handle,
+                                                               int                      n,
+                                                               int                      nnzA,
+                                                               hipsolverSpMatDescr_t    descrA,
+                                                               const int*               csrRowPtrA,
+                                                               const int*               csrColIndA,
+                                                               hipsolverSpCsrcholInfo_t info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpXcsrqrAnalysisBatched(hipsolverSpHandle_t    handle,
+                                     int                    m,
+                                     int                    n,
+                                     int                    nnzA,
+                                     hipsolverSpMatDescr_t  descrA,
+                                     const int*             csrRowPtrA,
+                                     const int*             csrColIndA,
+                                     hipsolverSpCsrqrInfo_t info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrlsvchol(hipsolverSpHandle_t   handle,
+                                                          int                   m,
+                                                          int                   nnz,
+                                                          hipsolverSpMatDescr_t descrA,
+                                                          const float*          csrVal,
+                                                          const int*            csrRowPtr,
+                                                          const int*            csrColInd,
+                                                          const float*          b,
+                                                          float                 tol,
+                                                          int                   reorder,
+                                                          float*                x,
+                                                          int*                  singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvchol(hipsolverSpHandle_t   handle,
+                                                          int                   m,
+                                                          int                   nnz,
+                                                          hipsolverSpMatDescr_t descrA,
+                                                          const double*         csrVal,
+                                                          const int*            csrRowPtr,
+                                                          const int*            csrColInd,
+                                                          const double*         b,
+                                                          double                tol,
+                                                          int                   reorder,
+                                                          double*               x,
+                                                          int*                  singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCcsrlsvchol(hipsolverSpHandle_t     handle,
+                                                          int                     m,
+                                                          int                     nnz,
+                                                          hipsolverSpMatDescr_t   descrA,
+                                                          const hipsolverComplex* csrVal,
+                                                          const int*              csrRowPtr,
+                                                          const int*              csrColInd,
+                                                          const hipsolverComplex* b,
+                                                          float                   tol,
+                                                          int                     reorder,
+                                                          hipsolverComplex*       x,
+                                                          int*                    singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpZcsrlsvchol(hipsolverSpHandle_t           handle,
+                           int                           m,
+                           int                           nnz,
+                           hipsolverSpMatDescr_t         descrA,
+                           const hipsolverDoubleComplex* csrVal,
+                           const int*                    csrRowPtr,
+                           const int*                    csrColInd,
+                           const hipsolverDoubleComplex* b,
+                           double                        tol,
+                           int                           reorder,
+                           hipsolverDoubleComplex*       x,
+                           int*                          singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrlsvqr(hipsolverSpHandle_t   handle,
+                                                        int                   m,
+                                                        int                   nnz,
+                                                        hipsolverSpMatDescr_t descrA,
+                                                        const float*          csrVal,
+                                                        const int*            csrRowPtr,
+                                                        const int*            csrColInd,
+                                                        const float*          b,
+                                                        float                 tol,
+                                                        int                   reorder,
+                                                        float*                x,
+                                                        int*                  singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrlsvqr(hipsolverSpHandle_t   handle,
+                                                        int                   m,
+                                                        int                   nnz,
+                                                        hipsolverSpMatDescr_t descrA,
+                                                        const double*         csrVal,
+                                                        const int*            csrRowPtr,
+                                                        const int*            csrColInd,
+                                                        const double*         b,
+                                                        double                tol,
+                                                        int                   reorder,
+                                                        double*               x,
+                                                        int*                  singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCcsrlsvqr(hipsolverSpHandle_t     handle,
+                                                        int                     m,
+                                                        int                     nnz,
+                                                        hipsolverSpMatDescr_t   descrA,
+                                                        const hipsolverComplex* csrVal,
+                                                        const int*              csrRowPtr,
+                                                        const int*              csrColInd,
+                                                        const hipsolverComplex* b,
+                                                        float                   tol,
+                                                        int                     reorder,
+                                                        hipsolverComplex*       x,
+                                                        int*                    singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpZcsrlsvqr(hipsolverSpHandle_t           handle,
+                                                        int                           m,
+                                                        int                           nnz,
+                                                        hipsolverSpMatDescr_t         descrA,
+                                                        const hipsolverDoubleComplex* csrVal,
+                                                        const int*                    csrRowPtr,
+                                                        const int*                    csrColInd,
+                                                        const hipsolverDoubleComplex* b,
+                                                        double                        tol,
+                                                        int                           reorder,
+                                                        hipsolverDoubleComplex*       x,
+                                                        int*                          singularity);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpScsrcholBufferInfo(hipsolverSpHandle_t      handle,
+                                  int                      n,
+                                  int                      nnzA,
+                                  hipsolverSpMatDescr_t    descrA,
+                                  const float*             csrValA,
+                                  const int*               csrRowPtrA,
+                                  const int*               csrColIndA,
+                                  hipsolverSpCsrcholInfo_t info,
+                                  size_t*                  internalDataInBytes,
+                                  size_t*                  workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpDcsrcholBufferInfo(hipsolverSpHandle_t      handle,
+                                  int                      n,
+                                  int                      nnzA,
+                                  hipsolverSpMatDescr_t    descrA,
+                                  const double*            csrValA,
+                                  const int*               csrRowPtrA,
+                                  const int*               csrColIndA,
+                                  hipsolverSpCsrcholInfo_t info,
+                                  size_t*                  internalDataInBytes,
+                                  size_t*                  workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpCcsrcholBufferInfo(hipsolverSpHandle_t      handle,
+                                  int                      n,
+                                  int                      nnzA,
+                                  hipsolverSpMatDescr_t    descrA,
+                                  const hipsolverComplex*  csrValA,
+                                  const int*               csrRowPtrA,
+                                  const int*               csrColIndA,
+                                  hipsolverSpCsrcholInfo_t info,
+                                  size_t*                  internalDataInBytes,
+                                  size_t*                  workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpZcsrcholBufferInfo(hipsolverSpHandle_t           handle,
+                                  int                           n,
+                                  int                           nnzA,
+                                  hipsolverSpMatDescr_t         descrA,
+                                  const hipsolverDoubleComplex* csrValA,
+                                  const int*                    csrRowPtrA,
+                                  const int*                    csrColIndA,
+                                  hipsolverSpCsrcholInfo_t      info,
+                                  size_t*                       internalDataInBytes,
+                                  size_t*                       workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrcholFactor(hipsolverSpHandle_t      handle,
+                                                             int                      n,
+                                                             int                      nnzA,
+                                                             hipsolverSpMatDescr_t    descrA,
+                                                             const float*             csrValA,
+                                                             const int*               csrRowPtrA,
+                                                             const int*               csrColIndA,
+                                                             hipsolverSpCsrcholInfo_t info,
+                                                             void*                    pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrcholFactor(hipsolverSpHandle_t      handle,
+                                                             int                      n,
+                                                             int                      nnzA,
+                                                             hipsolverSpMatDescr_t    descrA,
+                                                             const double*            csrValA,
+                                                             const int*               csrRowPtrA,
+                                                             const int*               csrColIndA,
+                                                             hipsolverSpCsrcholInfo_t info,
+                                                             void*                    pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCcsrcholFactor(hipsolverSpHandle_t      handle,
+                                                             int                      n,
+                                                             int                      nnzA,
+                                                             hipsolverSpMatDescr_t    descrA,
+                                                             const hipsolverComplex*  csrValA,
+                                                             const int*               csrRowPtrA,
+                                                             const int*               csrColIndA,
+                                                             hipsolverSpCsrcholInfo_t info,
+                                                             void*                    pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpZcsrcholFactor(hipsolverSpHandle_t           handle,
+                              int                           n,
+                              int                           nnzA,
+                              hipsolverSpMatDescr_t         descrA,
+                              const hipsolverDoubleComplex* csrValA,
+                              const int*                    csrRowPtrA,
+                              const int*                    csrColIndA,
+                              hipsolverSpCsrcholInfo_t      info,
+                              void*                         pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrcholZeroPivot(
+    hipsolverSpHandle_t handle, hipsolverSpCsrcholInfo_t info, float tol, int* position);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrcholZeroPivot(
+    hipsolverSpHandle_t handle, hipsolverSpCsrcholInfo_t info, double tol, int* position);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCcsrcholZeroPivot(
+    hipsolverSpHandle_t handle, hipsolverSpCsrcholInfo_t info, float tol, int* position);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpZcsrcholZeroPivot(
+    hipsolverSpHandle_t handle, hipsolverSpCsrcholInfo_t info, double tol, int* position);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrcholSolve(hipsolverSpHandle_t      handle,
+                                                            int                      n,
+                                                            const float*             b,
+                                                            float*                   x,
+                                                            hipsolverSpCsrcholInfo_t info,
+                                                            void*                    pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrcholSolve(hipsolverSpHandle_t      handle,
+                                                            int                      n,
+                                                            const double*            b,
+                                                            double*                  x,
+                                                            hipsolverSpCsrcholInfo_t info,
+                                                            void*                    pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCcsrcholSolve(hipsolverSpHandle_t      handle,
+                                                            int                      n,
+                                                            const hipsolverComplex*  b,
+                                                            hipsolverComplex*        x,
+                                                            hipsolverSpCsrcholInfo_t info,
+                                                            void*                    pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpZcsrcholSolve(hipsolverSpHandle_t           handle,
+                                                            int                           n,
+                                                            const hipsolverDoubleComplex* b,
+                                                            hipsolverDoubleComplex*       x,
+                                                            hipsolverSpCsrcholInfo_t      info,
+                                                            void*                         pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpScsrqrBufferInfoBatched(hipsolverSpHandle_t    handle,
+                                       int                    m,
+                                       int                    n,
+                                       int                    nnzA,
+                                       hipsolverSpMatDescr_t  descrA,
+                                       const float*           csrValA,
+                                       const int*             csrRowPtrA,
+                                       const int*             csrColIndA,
+                                       int                    batchSize,
+                                       hipsolverSpCsrqrInfo_t info,
+                                       size_t*                internalDataInBytes,
+                                       size_t*                workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpDcsrqrBufferInfoBatched(hipsolverSpHandle_t    handle,
+                                       int                    m,
+                                       int                    n,
+                                       int                    nnzA,
+                                       hipsolverSpMatDescr_t  descrA,
+                                       const double*          csrValA,
+                                       const int*             csrRowPtrA,
+                                       const int*             csrColIndA,
+                                       int                    batchSize,
+                                       hipsolverSpCsrqrInfo_t info,
+                                       size_t*                internalDataInBytes,
+                                       size_t*                workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpCcsrqrBufferInfoBatched(hipsolverSpHandle_t     handle,
+                                       int                     m,
+                                       int                     n,
+                                       int                     nnzA,
+                                       hipsolverSpMatDescr_t   descrA,
+                                       const hipsolverComplex* csrValA,
+                                       const int*              csrRowPtrA,
+                                       const int*              csrColIndA,
+                                       int                     batchSize,
+                                       hipsolverSpCsrqrInfo_t  info,
+                                       size_t*                 internalDataInBytes,
+                                       size_t*                 workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpZcsrqrBufferInfoBatched(hipsolverSpHandle_t           handle,
+                                       int                           m,
+                                       int                           n,
+                                       int                           nnzA,
+                                       hipsolverSpMatDescr_t         descrA,
+                                       const hipsolverDoubleComplex* csrValA,
+                                       const int*                    csrRowPtrA,
+                                       const int*                    csrColIndA,
+                                       int                           batchSize,
+                                       hipsolverSpCsrqrInfo_t        info,
+                                       size_t*                       internalDataInBytes,
+                                       size_t*                       workspaceInBytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpScsrqrsvBatched(hipsolverSpHandle_t    handle,
+                                                              int                    m,
+                                                              int                    n,
+                                                              int                    nnzA,
+                                                              hipsolverSpMatDescr_t  descrA,
+                                                              const float*           csrValA,
+                                                              const int*             csrRowPtrA,
+                                                              const int*             csrColIndA,
+                                                              const float*           b,
+                                                              float*                 x,
+                                                              int                    batchSize,
+                                                              hipsolverSpCsrqrInfo_t info,
+                                                              void*                  pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpDcsrqrsvBatched(hipsolverSpHandle_t    handle,
+                                                              int                    m,
+                                                              int                    n,
+                                                              int                    nnzA,
+                                                              hipsolverSpMatDescr_t  descrA,
+                                                              const double*          csrValA,
+                                                              const int*             csrRowPtrA,
+                                                              const int*             csrColIndA,
+                                                              const double*          b,
+                                                              double*                x,
+                                                              int                    batchSize,
+                                                              hipsolverSpCsrqrInfo_t info,
+                                                              void*                  pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpCcsrqrsvBatched(hipsolverSpHandle_t     handle,
+                                                              int                     m,
+                                                              int                     n,
+                                                              int                     nnzA,
+                                                              hipsolverSpMatDescr_t   descrA,
+                                                              const hipsolverComplex* csrValA,
+                                                              const int*              csrRowPtrA,
+                                                              const int*              csrColIndA,
+                                                              const hipsolverComplex* b,
+                                                              hipsolverComplex*       x,
+                                                              int                     batchSize,
+                                                              hipsolverSpCsrqrInfo_t  info,
+                                                              void*                   pBuffer);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpZcsrqrsvBatched(hipsolverSpHandle_t           handle,
+                               int                           m,
+                               int                           n,
+                               int                           nnzA,
+                               hipsolverSpMatDescr_t         descrA,
+                               const hipsolverDoubleComplex* csrValA,
+                               const int*                    csrRowPtrA,
+                               const int*                    csrColIndA,
+                               const hipsolverDoubleComplex* b,
+                               hipsolverDoubleComplex*       x,
+                               int                           batchSize,
+                               hipsolverSpCsrqrInfo_t        info,
+                               void*                         pBuffer);
+
+// sparse refactorization: matrices are in CSR format with zero-based 32-bit indices and double
+// precision values. L holds its unit diagonal explicitly. The batched functions share the
+// sparsity pattern and the permutations among all the matrices, and solve one right-hand side each.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfCreate(hipsolverRfHandle_t* handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfDestroy(hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfSetNumericProperties(
+    hipsolverRfHandle_t handle, double zero, double boost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfGetNumericProperties(
+    hipsolverRfHandle_t handle, double* zero, double* boost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfSetupHost(int                 n,
+                                                        int                 nnzA,
+                                                        int*                h_csrRowPtrA,
+                                                        int*                h_csrColIndA,
+                                                        double*             h_csrValA,
+                                                        int                 nnzL,
+                                                        int*                h_csrRowPtrL,
+                                                        int*                h_csrColIndL,
+                                                        double*             h_csrValL,
+                                                        int                 nnzU,
+                                                        int*                h_csrRowPtrU,
+                                                        int*                h_csrColIndU,
+                                                        double*             h_csrValU,
+                                                        int*                h_P,
+                                                        int*                h_Q,
+                                                        hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfSetupDevice(int                 n,
+                                                          int                 nnzA,
+                                                          int*                csrRowPtrA,
+                                                          int*                csrColIndA,
+                                                          double*             csrValA,
+                                                          int                 nnzL,
+                                                          int*                csrRowPtrL,
+                                                          int*                csrColIndL,
+                                                          double*             csrValL,
+                                                          int                 nnzU,
+                                                          int*                csrRowPtrU,
+                                                          int*                csrColIndU,
+                                                          double*             csrValU,
+                                                          int*                P,
+                                                          int*                Q,
+                                                          hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfAnalyze(hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfResetValues(int                 n,
+                                                          int                 nnzA,
+                                                          int*                csrRowPtrA,
+                                                          int*                csrColIndA,
+                                                          double*             csrValA,
+                                                          int*                P,
+                                                          int*                Q,
+                                                          hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfRefactor(hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfSolve(hipsolverRfHandle_t handle,
+                                                    int*                P,
+                                                    int*                Q,
+                                                    int                 nrhs,
+                                                    double*             Temp,
+                                                    int                 ldt,
+                                                    double*             XF,
+                                                    int                 ldxf);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfAccessBundledFactorsDevice(
+    hipsolverRfHandle_t handle, int* nnzM, int** Mp, int** Mi, double** Mx);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfBatchSetupHost(int                 batchSize,
+                                                             int                 n,
+                                                             int                 nnzA,
+                                                             int*                h_csrRowPtrA,
+                                                             int*                h_csrColIndA,
+                                                             double*             h_csrValA_array[],
+                                                             int                 nnzL,
+                                                             int*                h_csrRowPtrL,
+                                                             int*                h_csrColIndL,
+                                                             double*             h_csrValL,
+                                                             int                 nnzU,
+                                                             int*                h_csrRowPtrU,
+                                                             int*                h_csrColIndU,
+                                                             double*             h_csrValU,
+                                                             int*                h_P,
+                                                             int*                h_Q,
+                                                             hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfBatchAnalyze(hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfBatchResetValues(int                 batchSize,
+                                                               int                 n,
+                                                               int                 nnzA,
+                                                               int*                csrRowPtrA,
+                                                               int*                csrColIndA,
+                                                               double*             csrValA_array[],
+                                                               int*                P,
+                                                               int*                Q,
+                                                               hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfBatchRefactor(hipsolverRfHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfBatchSolve(hipsolverRfHandle_t handle,
+                                                         int*                P,
+                                                         int*                Q,
+                                                         int                 nrhs,
+                                                         double*             Temp,
+                                                         int                 ldt,
+                                                         double*             XF_array[],
+                                                         int                 ldxf);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverRfBatchZeroPivot(
+    hipsolverRfHandle_t handle, int* position);
+
+// generic API: the precision of every matrix is given by a hipDataType, sizes are 64-bit, and the
+// workspace sizes are in bytes. The options of a hipsolverDnParams_t select the algorithms; a null
+// params uses the default ones. Combinations of data and compute types that the back-end does not
+// provide return HIPSOLVER_STATUS_NOT_SUPPORTED.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnCreateParams(hipsolverDnParams_t* params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDestroyParams(hipsolverDnParams_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSetAdvOptions(hipsolverDnParams_t   params,
+                                                            hipsolverDnFunction_t function,
+                                                            hipsolverAlgMode_t    algo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXgetrf_bufferSize(hipsolverHandle_t   handle,
+                                 hipsolverDnParams_t params,
+                                 int64_t             m,
+                                 int64_t             n,
+                                 hipDataType         dataTypeA,
+                                 const void*         A,
+                                 int64_t             lda,
+                                 hipDataType         computeType,
+                                 size_t*             workspaceInBytesOnDevice,
+                                 size_t*             workspaceInBytesOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgetrf(hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     int64_t*            ipiv,
+                                                     hipDataType         computeType,
+                                                     void*               bufferOnDevice,
+                                                     size_t              workspaceInBytesOnDevice,
+                                                     void*               bufferOnHost,
+                                                     size_t              workspaceInBytesOnHost,
+                                                     int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXpotrf_bufferSize(hipsolverHandle_t   handle,
+                                 hipsolverDnParams_t params,
+                                 hipsolverFillMode_t uplo,
+                                 int64_t             n,
+                                 hipDataType         dataTypeA,
+                                 const void*         A,
+                                 int64_t             lda,
+                                 hipDataType         computeType,
+                                 size_t*             workspaceInBytesOnDevice,
+                                 size_t*             workspaceInBytesOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrf(hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     hipDataType         computeType,
+                                                     void*               bufferOnDevice,
+                                                     size_t              workspaceInBytesOnDevice,
+                                                     void*               bufferOnHost,
+                                                     size_t              workspaceInBytesOnHost,
+                                                     int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDnXsyevd_bufferSize(hipsolverHandle_t   handle,
+                                 hipsolverDnParams_t params,
+                                 hipsolverEigMode_t  jobz,
+                                 hipsolverFillMode_t uplo,
+                                 int64_t             n,
+                                 hipDataType         dataTypeA,
+                                 const void*         A,
+                                 int64_t             lda,
+                                 hipDataType         dataTypeW,
+                                 const void*         W,
+                                 hipDataType         computeType,
+                                 size_t*             workspaceInBytesOnDevice,
+                                 size_t*             workspaceInBytesOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevd(hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverEigMode_t  jobz,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     hipDataType         dataTypeW,
+                                                     void*               W,
+                                                     hipDataType         computeType,
+                                                     void*               bufferOnDevice,
+                                                     size_t              workspaceInBytesOnDevice,
+                                                     void*               bufferOnHost,
+                                                     size_t              workspaceInBytesOnHost,
+                                                     int*                info);
+
+// interleaved layout: entry (i, j) of matrix b of a batch is at A[b + (i + j * lda) *
+// batch_count], so that the entries (i, j) of all the matrices are contiguous. The vectors of the
+// interleaved batched functions are laid out the same way, entry i of matrix b at
+// ipiv[b + i * batch_count], and their infos are one per matrix. The conversion functions copy
+// the m-by-n matrices of an interleaved batch to a strided batch, and back.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSinterleavedToStrided(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const float*      A,
+                                                                  int               lda,
+                                                                  float*            B,
+                                                                  int               ldb,
+                                                                  int               strideB,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSstridedToInterleaved(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const float*      A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  float*            B,
+                                                                  int               ldb,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDinterleavedToStrided(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const double*     A,
+                                                                  int               lda,
+                                                                  double*           B,
+                                                                  int               ldb,
+                                                                  int               strideB,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDstridedToInterleaved(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  const double*     A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  double*           B,
+                                                                  int               ldb,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCinterleavedToStrided(hipsolverHandle_t       handle,
+                                   int                     m,
+                                   int                     n,
+                                   const hipsolverComplex* A,
+                                   int                     lda,
+                                   hipsolverComplex*       B,
+                                   int                     ldb,
+                                   int                     strideB,
+                                   int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCstridedToInterleaved(hipsolverHandle_t       handle,
+                                   int                     m,
+                                   int                     n,
+                                   const hipsolverComplex* A,
+                                   int                     lda,
+                                   int                     strideA,
+                                   hipsolverComplex*       B,
+                                   int                     ldb,
+                                   int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZinterleavedToStrided(hipsolverHandle_t             handle,
+                                   int                           m,
+                                   int                           n,
+                                   const hipsolverDoubleComplex* A,
+                                   int                           lda,
+                                   hipsolverDoubleComplex*       B,
+                                   int                           ldb,
+                                   int                           strideB,
+                                   int                           batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZstridedToInterleaved(hipsolverHandle_t             handle,
+                                   int                           m,
+                                   int                           n,
+                                   const hipsolverDoubleComplex* A,
+                                   int                           lda,
+                                   int                           strideA,
+                                   hipsolverDoubleComplex*       B,
+                                   int                           ldb,
+                                   int                           batch_count);
+
 // orgbr/ungbr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverSideMode_t side,
@@ -299,6 +1764,233 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// orgbr_batched/ungbr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgbrBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverSideMode_t side,
+                                      int                 m,
+                                      int                 n,
+                                      int                 k,
+                                      float*              A[],
+                                      int                 lda,
+                                      float*              tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgbrBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverSideMode_t side,
+                                      int                 m,
+                                      int                 n,
+                                      int                 k,
+                                      double*             A[],
+                                      int                 lda,
+                                      double*             tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungbrBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverSideMode_t side,
+                                      int                 m,
+                                      int                 n,
+                                      int                 k,
+                                      hipsolverComplex*   A[],
+                                      int                 lda,
+                                      hipsolverComplex*   tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungbrBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverSideMode_t     side,
+                                      int                     m,
+                                      int                     n,
+                                      int                     k,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      hipsolverDoubleComplex* tau,
+                                      int                     strideP,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbrBatched(hipsolverHandle_t   handle,
+                                                          hipsolverSideMode_t side,
+                                                          int                 m,
+                                                          int                 n,
+                                                          int                 k,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              tau,
+                                                          int                 strideP,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgbrBatched(hipsolverHandle_t   handle,
+                                                          hipsolverSideMode_t side,
+                                                          int                 m,
+                                                          int                 n,
+                                                          int                 k,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             tau,
+                                                          int                 strideP,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungbrBatched(hipsolverHandle_t   handle,
+                                                          hipsolverSideMode_t side,
+                                                          int                 m,
+                                                          int                 n,
+                                                          int                 k,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          hipsolverComplex*   tau,
+                                                          int                 strideP,
+                                                          hipsolverComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungbrBatched(hipsolverHandle_t       handle,
+                                                          hipsolverSideMode_t     side,
+                                                          int                     m,
+                                                          int                     n,
+                                                          int                     k,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// orgbr_strided_batched/ungbr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgbrStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgbrStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungbrStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverSideMode_t side,
+                                             int                 m,
+                                             int                 n,
+                                             int                 k,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             hipsolverComplex*   tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungbrStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverSideMode_t     side,
+                                             int                     m,
+                                             int                     n,
+                                             int                     k,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbrStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              tau,
+                                                                 int                 strideP,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgbrStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             tau,
+                                                                 int                 strideP,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungbrStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipsolverComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipsolverComplex*   tau,
+                                                                 int                 strideP,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungbrStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverSideMode_t     side,
+                                  int                     m,
+                                  int                     n,
+                                  int                     k,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
 // orgqr/ungqr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqr_bufferSize(
     hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork);
@@ -368,6 +2060,214 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// orgqr_batched/ungqr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqrBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               k,
+                                                                     float*            A[],
+                                                                     int               lda,
+                                                                     float*            tau,
+                                                                     int               strideP,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgqrBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               k,
+                                                                     double*           A[],
+                                                                     int               lda,
+                                                                     double*           tau,
+                                                                     int               strideP,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungqrBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     int               k,
+                                                                     hipsolverComplex* A[],
+                                                                     int               lda,
+                                                                     hipsolverComplex* tau,
+                                                                     int               strideP,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungqrBatched_bufferSize(hipsolverHandle_t       handle,
+                                      int                     m,
+                                      int                     n,
+                                      int                     k,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      hipsolverDoubleComplex* tau,
+                                      int                     strideP,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqrBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          float*            tau,
+                                                          int               strideP,
+                                                          float*            work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgqrBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          double*           tau,
+                                                          int               strideP,
+                                                          double*           work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungqrBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          int               k,
+                                                          hipsolverComplex* A[],
+                                                          int               lda,
+                                                          hipsolverComplex* tau,
+                                                          int               strideP,
+                                                          hipsolverComplex* work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungqrBatched(hipsolverHandle_t       handle,
+                                                          int                     m,
+                                                          int                     n,
+                                                          int                     k,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// orgqr_strided_batched/ungqr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgqrStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             float*            A,
+                                             int               lda,
+                                             int               strideA,
+                                             float*            tau,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgqrStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             double*           A,
+                                             int               lda,
+                                             int               strideA,
+                                             double*           tau,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungqrStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               k,
+                                             hipsolverComplex* A,
+                                             int               lda,
+                                             int               strideA,
+                                             hipsolverComplex* tau,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungqrStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             int                     k,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqrStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            tau,
+                                                                 int               strideP,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgqrStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           tau,
+                                                                 int               strideP,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungqrStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 hipsolverComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 hipsolverComplex* tau,
+                                                                 int               strideP,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungqrStridedBatched(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  int                     k,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
 // orgtr/ungtr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverFillMode_t uplo,
@@ -441,6 +2341,201 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// orgtr_batched/ungtr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgtrBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      float*              A[],
+                                      int                 lda,
+                                      float*              tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgtrBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      double*             A[],
+                                      int                 lda,
+                                      double*             tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungtrBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipsolverComplex*   A[],
+                                      int                 lda,
+                                      hipsolverComplex*   tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungtrBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      hipsolverDoubleComplex* tau,
+                                      int                     strideP,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtrBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              tau,
+                                                          int                 strideP,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgtrBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             tau,
+                                                          int                 strideP,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungtrBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          hipsolverComplex*   tau,
+                                                          int                 strideP,
+                                                          hipsolverComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungtrBatched(hipsolverHandle_t       handle,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// orgtr_strided_batched/ungtr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSorgtrStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDorgtrStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCungtrStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             hipsolverComplex*   tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungtrStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtrStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              tau,
+                                                                 int                 strideP,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgtrStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             tau,
+                                                                 int                 strideP,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungtrStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipsolverComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipsolverComplex*   tau,
+                                                                 int                 strideP,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZungtrStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
 // ormqr/unmqr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverSideMode_t  side,
@@ -554,6 +2649,289 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// ormqr_batched/unmqr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSormqrBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverSideMode_t  side,
+                                      hipsolverOperation_t trans,
+                                      int                  m,
+                                      int                  n,
+                                      int                  k,
+                                      float*               A[],
+                                      int                  lda,
+                                      float*               tau,
+                                      int                  strideP,
+                                      float*               C[],
+                                      int                  ldc,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDormqrBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverSideMode_t  side,
+                                      hipsolverOperation_t trans,
+                                      int                  m,
+                                      int                  n,
+                                      int                  k,
+                                      double*              A[],
+                                      int                  lda,
+                                      double*              tau,
+                                      int                  strideP,
+                                      double*              C[],
+                                      int                  ldc,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCunmqrBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverSideMode_t  side,
+                                      hipsolverOperation_t trans,
+                                      int                  m,
+                                      int                  n,
+                                      int                  k,
+                                      hipsolverComplex*    A[],
+                                      int                  lda,
+                                      hipsolverComplex*    tau,
+                                      int                  strideP,
+                                      hipsolverComplex*    C[],
+                                      int                  ldc,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunmqrBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverSideMode_t     side,
+                                      hipsolverOperation_t    trans,
+                                      int                     m,
+                                      int                     n,
+                                      int                     k,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      hipsolverDoubleComplex* tau,
+                                      int                     strideP,
+                                      hipsolverDoubleComplex* C[],
+                                      int                     ldc,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqrBatched(hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          float*               A[],
+                                                          int                  lda,
+                                                          float*               tau,
+                                                          int                  strideP,
+                                                          float*               C[],
+                                                          int                  ldc,
+                                                          float*               work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDormqrBatched(hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          double*              A[],
+                                                          int                  lda,
+                                                          double*              tau,
+                                                          int                  strideP,
+                                                          double*              C[],
+                                                          int                  ldc,
+                                                          double*              work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunmqrBatched(hipsolverHandle_t    handle,
+                                                          hipsolverSideMode_t  side,
+                                                          hipsolverOperation_t trans,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          hipsolverComplex*    A[],
+                                                          int                  lda,
+                                                          hipsolverComplex*    tau,
+                                                          int                  strideP,
+                                                          hipsolverComplex*    C[],
+                                                          int                  ldc,
+                                                          hipsolverComplex*    work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmqrBatched(hipsolverHandle_t       handle,
+                                                          hipsolverSideMode_t     side,
+                                                          hipsolverOperation_t    trans,
+                                                          int                     m,
+                                                          int                     n,
+                                                          int                     k,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* C[],
+                                                          int                     ldc,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// ormqr_strided_batched/unmqr_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSormqrStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             float*               A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             float*               tau,
+                                             int                  strideP,
+                                             float*               C,
+                                             int                  ldc,
+                                             int                  strideC,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDormqrStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             double*              A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             double*              tau,
+                                             int                  strideP,
+                                             double*              C,
+                                             int                  ldc,
+                                             int                  strideC,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCunmqrStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverSideMode_t  side,
+                                             hipsolverOperation_t trans,
+                                             int                  m,
+                                             int                  n,
+                                             int                  k,
+                                             hipsolverComplex*    A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             hipsolverComplex*    tau,
+                                             int                  strideP,
+                                             hipsolverComplex*    C,
+                                             int                  ldc,
+                                             int                  strideC,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunmqrStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverSideMode_t     side,
+                                             hipsolverOperation_t    trans,
+                                             int                     m,
+                                             int                     n,
+                                             int                     k,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             hipsolverDoubleComplex* C,
+                                             int                     ldc,
+                                             int                     strideC,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqrStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 float*               tau,
+                                                                 int                  strideP,
+                                                                 float*               C,
+                                                                 int                  ldc,
+                                                                 int                  strideC,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDormqrStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 double*              tau,
+                                                                 int                  strideP,
+                                                                 double*              C,
+                                                                 int                  ldc,
+                                                                 int                  strideC,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunmqrStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 hipsolverComplex*    A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 hipsolverComplex*    tau,
+                                                                 int                  strideP,
+                                                                 hipsolverComplex*    C,
+                                                                 int                  ldc,
+                                                                 int                  strideC,
+                                                                 hipsolverComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZunmqrStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverSideMode_t     side,
+                                  hipsolverOperation_t    trans,
+                                  int                     m,
+                                  int                     n,
+                                  int                     k,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* C,
+                                  int                     ldc,
+                                  int                     strideC,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
 // ormtr/unmtr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverSideMode_t  side,
@@ -740,22 +3118,607 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
-// geqrf
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+// gebrd_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrdBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgebrdBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgebrdBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipsolverComplex* A[],
+                                                                     int               lda,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgebrdBatched_bufferSize(hipsolverHandle_t       handle,
+                                      int                     m,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrdBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          float*            D,
+                                                          int               strideD,
+                                                          float*            E,
+                                                          int               strideE,
+                                                          float*            tauq,
+                                                          int               strideQ,
+                                                          float*            taup,
+                                                          int               strideP,
+                                                          float*            work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgebrdBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          double*           D,
+                                                          int               strideD,
+                                                          double*           E,
+                                                          int               strideE,
+                                                          double*           tauq,
+                                                          int               strideQ,
+                                                          double*           taup,
+                                                          int               strideP,
+                                                          double*           work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgebrdBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          hipsolverComplex* A[],
+                                                          int               lda,
+                                                          float*            D,
+                                                          int               strideD,
+                                                          float*            E,
+                                                          int               strideE,
+                                                          hipsolverComplex* tauq,
+                                                          int               strideQ,
+                                                          hipsolverComplex* taup,
+                                                          int               strideP,
+                                                          hipsolverComplex* work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrdBatched(hipsolverHandle_t       handle,
+                                                          int                     m,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          double*                 D,
+                                                          int                     strideD,
+                                                          double*                 E,
+                                                          int                     strideE,
+                                                          hipsolverDoubleComplex* tauq,
+                                                          int                     strideQ,
+                                                          hipsolverDoubleComplex* taup,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+// gebrd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgebrdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgebrdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgebrdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipsolverComplex* A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgebrdStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrdStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            D,
+                                                                 int               strideD,
+                                                                 float*            E,
+                                                                 int               strideE,
+                                                                 float*            tauq,
+                                                                 int               strideQ,
+                                                                 float*            taup,
+                                                                 int               strideP,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgebrdStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           D,
+                                                                 int               strideD,
+                                                                 double*           E,
+                                                                 int               strideE,
+                                                                 double*           tauq,
+                                                                 int               strideQ,
+                                                                 double*           taup,
+                                                                 int               strideP,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgebrdStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            D,
+                                                                 int               strideD,
+                                                                 float*            E,
+                                                                 int               strideE,
+                                                                 hipsolverComplex* tauq,
+                                                                 int               strideQ,
+                                                                 hipsolverComplex* taup,
+                                                                 int               strideP,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgebrdStridedBatched(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  double*                 D,
+                                  int                     strideD,
+                                  double*                 E,
+                                  int                     strideE,
+                                  hipsolverDoubleComplex* tauq,
+                                  int                     strideQ,
+                                  hipsolverDoubleComplex* taup,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// gecon: A holds the LU factors computed by getrf, and rcond is set to an estimate of the
+// reciprocal condition number of A in the norm of norm, given the norm anorm of A before
+// factorization. anorm and rcond are in host memory, and the call synchronizes with the stream
+// of handle.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgecon_bufferSize(
+    hipsolverHandle_t handle, hipsolverNormType_t norm, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgecon(hipsolverHandle_t   handle,
+                                                   hipsolverNormType_t norm,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float               anorm,
+                                                   float*              rcond,
+                                                   float*              work,
+                                                   int                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeconBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverNormType_t norm,
+                                      int                 n,
+                                      float*              A[],
+                                      int                 lda,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeconBatched(hipsolverHandle_t   handle,
+                                                          hipsolverNormType_t norm,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          const float*        anorm,
+                                                          float*              rcond,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int                 batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgecon_bufferSize(
+    hipsolverHandle_t handle, hipsolverNormType_t norm, int n, double* A, int lda, int* lwork);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipsolverDoubleComplex* A, int lda, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgecon(hipsolverHandle_t   handle,
+                                                   hipsolverNormType_t norm,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double              anorm,
+                                                   double*             rcond,
+                                                   double*             work,
+                                                   int                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeconBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverNormType_t norm,
+                                      int                 n,
+                                      double*             A[],
+                                      int                 lda,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeconBatched(hipsolverHandle_t   handle,
+                                                          hipsolverNormType_t norm,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          const double*       anorm,
+                                                          double*             rcond,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int                 batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
-                                                   int               m,
-                                                   int               n,
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgecon_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverNormType_t norm,
+                                                              int                 n,
+                                                              hipsolverComplex*   A,
+                                                              int                 lda,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgecon(hipsolverHandle_t   handle,
+                                                   hipsolverNormType_t norm,
+                                                   int                 n,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   float               anorm,
+                                                   float*              rcond,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeconBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverNormType_t norm,
+                                      int                 n,
+                                      hipsolverComplex*   A[],
+                                      int                 lda,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeconBatched(hipsolverHandle_t   handle,
+                                                          hipsolverNormType_t norm,
+                                                          int                 n,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          const float*        anorm,
+                                                          float*              rcond,
+                                                          hipsolverComplex*   work,
+                                                          int                 lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgecon_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverNormType_t     norm,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgecon(hipsolverHandle_t       handle,
+                                                   hipsolverNormType_t     norm,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   double                  anorm,
+                                                   double*                 rcond,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeconBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverNormType_t     norm,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeconBatched(hipsolverHandle_t       handle,
+                                                          hipsolverNormType_t     norm,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          const double*           anorm,
+                                                          double*                 rcond,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int                     batch_count);
+
+// gels
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              float*            A,
+                                                              int               lda,
+                                                              float*            B,
+                                                              int               ldb,
+                                                              float*            X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipsolverComplex* A,
+                                                              int               lda,
+                                                              hipsolverComplex* B,
+                                                              int               ldb,
+                                                              hipsolverComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t       handle,
+                                                              int                     m,
+                                                              int                     n,
+                                                              int                     nrhs,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              hipsolverDoubleComplex* B,
+                                                              int                     ldb,
+                                                              hipsolverDoubleComplex* X,
+                                                              int                     ldx,
+                                                              size_t*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   float*            A,
+                                                   int               lda,
+                                                   float*            B,
+                                                   int               ldb,
+                                                   float*            X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDDgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCCgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipsolverComplex* A,
+                                                   int               lda,
+                                                   hipsolverComplex* B,
+                                                   int               ldb,
+                                                   hipsolverComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t       handle,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* X,
+                                                   int                     ldx,
+                                                   void*                   work,
+                                                   size_t                  lwork,
+                                                   int*                    niters,
+                                                   int*                    devInfo);
+
+// gels_strided_batched: B is overwritten by the solution, as in LAPACK
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgelsStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                            int               m,
+                                            int               n,
+                                            int               nrhs,
+                                            float*            A,
+                                            int               lda,
+                                            int               strideA,
+                                            float*            B,
+                                            int               ldb,
+                                            int               strideB,
+                                            int*              lwork,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgelsStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                            int               m,
+                                            int               n,
+                                            int               nrhs,
+                                            double*           A,
+                                            int               lda,
+                                            int               strideA,
+                                            double*           B,
+                                            int               ldb,
+                                            int               strideB,
+                                            int*              lwork,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgelsStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                            int               m,
+                                            int               n,
+                                            int               nrhs,
+                                            hipsolverComplex* A,
+                                            int               lda,
+                                            int               strideA,
+                                            hipsolverComplex* B,
+                                            int               ldb,
+                                            int               strideB,
+                                            int*              lwork,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgelsStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                            int                     m,
+                                            int                     n,
+                                            int                     nrhs,
+                                            hipsolverDoubleComplex* A,
+                                            int                     lda,
+                                            int                     strideA,
+                                            hipsolverDoubleComplex* B,
+                                            int                     ldb,
+                                            int                     strideB,
+                                            int*                    lwork,
+                                            int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgelsStridedBatched(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                float*            A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                float*            B,
+                                                                int               ldb,
+                                                                int               strideB,
+                                                                float*            work,
+                                                                int               lwork,
+                                                                int*              devInfo,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgelsStridedBatched(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                int               strideB,
+                                                                double*           work,
+                                                                int               lwork,
+                                                                int*              devInfo,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgelsStridedBatched(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipsolverComplex* A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                hipsolverComplex* B,
+                                                                int               ldb,
+                                                                int               strideB,
+                                                                hipsolverComplex* work,
+                                                                int               lwork,
+                                                                int*              devInfo,
+                                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgelsStridedBatched(hipsolverHandle_t       handle,
+                                 int                     m,
+                                 int                     n,
+                                 int                     nrhs,
+                                 hipsolverDoubleComplex* A,
+                                 int                     lda,
+                                 int                     strideA,
+                                 hipsolverDoubleComplex* B,
+                                 int                     ldb,
+                                 int                     strideB,
+                                 hipsolverDoubleComplex* work,
+                                 int                     lwork,
+                                 int*                    devInfo,
+                                 int                     batch_count);
+
+// geqrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipsolverDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
                                                    float*            A,
                                                    int               lda,
                                                    float*            tau,
@@ -793,6 +3756,245 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// geqrf_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     float*            A[],
+                                                                     int               lda,
+                                                                     int               strideP,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     double*           A[],
+                                                                     int               lda,
+                                                                     int               strideP,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipsolverComplex* A[],
+                                                                     int               lda,
+                                                                     int               strideP,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfBatched_bufferSize(hipsolverHandle_t       handle,
+                                      int                     m,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      int                     strideP,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          float*            tau,
+                                                          int               strideP,
+                                                          float*            work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          double*           tau,
+                                                          int               strideP,
+                                                          double*           work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          hipsolverComplex* A[],
+                                                          int               lda,
+                                                          hipsolverComplex* tau,
+                                                          int               strideP,
+                                                          hipsolverComplex* work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfBatched(hipsolverHandle_t       handle,
+                                                          int                     m,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// geqrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             int               strideA,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             int               strideA,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeqrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipsolverComplex* A,
+                                             int               lda,
+                                             int               strideA,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            tau,
+                                                                 int               strideP,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           tau,
+                                                                 int               strideP,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 hipsolverComplex* tau,
+                                                                 int               strideP,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqrfStridedBatched(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// gesv
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv_bufferSize(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             int               nrhs,
+                                                             double*           A,
+                                                             int               lda,
+                                                             int*              devIpiv,
+                                                             double*           B,
+                                                             int               ldb,
+                                                             double*           X,
+                                                             int               ldx,
+                                                             size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv_bufferSize(hipsolverHandle_t       handle,
+                                                             int                     n,
+                                                             int                     nrhs,
+                                                             hipsolverDoubleComplex* A,
+                                                             int                     lda,
+                                                             int*                    devIpiv,
+                                                             hipsolverDoubleComplex* B,
+                                                             int                     ldb,
+                                                             hipsolverDoubleComplex* X,
+                                                             int                     ldx,
+                                                             size_t*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv(hipsolverHandle_t handle,
+                                                  int               n,
+                                                  int               nrhs,
+                                                  double*           A,
+                                                  int               lda,
+                                                  int*              devIpiv,
+                                                  double*           B,
+                                                  int               ldb,
+                                                  double*           X,
+                                                  int               ldx,
+                                                  void*             work,
+                                                  size_t            lwork,
+                                                  int*              niters,
+                                                  int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv(hipsolverHandle_t       handle,
+                                                  int                     n,
+                                                  int                     nrhs,
+                                                  hipsolverDoubleComplex* A,
+                                                  int                     lda,
+                                                  int*                    devIpiv,
+                                                  hipsolverDoubleComplex* B,
+                                                  int                     ldb,
+                                                  hipsolverDoubleComplex* X,
+                                                  int                     ldx,
+                                                  void*                   work,
+                                                  size_t                  lwork,
+                                                  int*                    niters,
+                                                  int*                    devInfo);
+
 // gesvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_bufferSize(
     hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
@@ -874,6 +4076,993 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t       handl
                                                    double*                 rwork,
                                                    int*                    devInfo);
 
+// gesvd_64
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_64_bufferSize(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int64_t           m,
+                                                                 int64_t           n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvd_64_bufferSize(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int64_t           m,
+                                                                 int64_t           n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvd_64_bufferSize(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int64_t           m,
+                                                                 int64_t           n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvd_64_bufferSize(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int64_t           m,
+                                                                 int64_t           n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_64(hipsolverHandle_t handle,
+                                                      signed char       jobu,
+                                                      signed char       jobv,
+                                                      int64_t           m,
+                                                      int64_t           n,
+                                                      float*            A,
+                                                      int64_t           lda,
+                                                      float*            S,
+                                                      float*            U,
+                                                      int64_t           ldu,
+                                                      float*            V,
+                                                      int64_t           ldv,
+                                                      float*            work,
+                                                      size_t            lwork,
+                                                      float*            rwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvd_64(hipsolverHandle_t handle,
+                                                      signed char       jobu,
+                                                      signed char       jobv,
+                                                      int64_t           m,
+                                                      int64_t           n,
+                                                      double*           A,
+                                                      int64_t           lda,
+                                                      double*           S,
+                                                      double*           U,
+                                                      int64_t           ldu,
+                                                      double*           V,
+                                                      int64_t           ldv,
+                                                      double*           work,
+                                                      size_t            lwork,
+                                                      double*           rwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvd_64(hipsolverHandle_t handle,
+                                                      signed char       jobu,
+                                                      signed char       jobv,
+                                                      int64_t           m,
+                                                      int64_t           n,
+                                                      hipsolverComplex* A,
+                                                      int64_t           lda,
+                                                      float*            S,
+                                                      hipsolverComplex* U,
+                                                      int64_t           ldu,
+                                                      hipsolverComplex* V,
+                                                      int64_t           ldv,
+                                                      hipsolverComplex* work,
+                                                      size_t            lwork,
+                                                      float*            rwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvd_64(hipsolverHandle_t       handle,
+                                                      signed char             jobu,
+                                                      signed char             jobv,
+                                                      int64_t                 m,
+                                                      int64_t                 n,
+                                                      hipsolverDoubleComplex* A,
+                                                      int64_t                 lda,
+                                                      double*                 S,
+                                                      hipsolverDoubleComplex* U,
+                                                      int64_t                 ldu,
+                                                      hipsolverDoubleComplex* V,
+                                                      int64_t                 ldv,
+                                                      hipsolverDoubleComplex* work,
+                                                      size_t                  lwork,
+                                                      double*                 rwork,
+                                                      int*                    devInfo);
+
+// gesvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             signed char       jobu,
+                                             signed char       jobv,
+                                             int               m,
+                                             int               n,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            S,
+                                                                 int               strideS,
+                                                                 float*            U,
+                                                                 int               ldu,
+                                                                 int               strideU,
+                                                                 float*            V,
+                                                                 int               ldv,
+                                                                 int               strideV,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 float*            rwork,
+                                                                 int               strideRwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           S,
+                                                                 int               strideS,
+                                                                 double*           U,
+                                                                 int               ldu,
+                                                                 int               strideU,
+                                                                 double*           V,
+                                                                 int               ldv,
+                                                                 int               strideV,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 double*           rwork,
+                                                                 int               strideRwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdStridedBatched(hipsolverHandle_t handle,
+                                                                 signed char       jobu,
+                                                                 signed char       jobv,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            S,
+                                                                 int               strideS,
+                                                                 hipsolverComplex* U,
+                                                                 int               ldu,
+                                                                 int               strideU,
+                                                                 hipsolverComplex* V,
+                                                                 int               ldv,
+                                                                 int               strideV,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 float*            rwork,
+                                                                 int               strideRwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdStridedBatched(hipsolverHandle_t       handle,
+                                  signed char             jobu,
+                                  signed char             jobv,
+                                  int                     m,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  double*                 S,
+                                  int                     strideS,
+                                  hipsolverDoubleComplex* U,
+                                  int                     ldu,
+                                  int                     strideU,
+                                  hipsolverDoubleComplex* V,
+                                  int                     ldv,
+                                  int                     strideV,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  double*                 rwork,
+                                  int                     strideRwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// gesvdr: randomized truncated SVD of the m-by-n matrix A. S receives approximations of the k
+// largest singular values of A, and if jobu and jobv are 'S', the m-by-k matrix U and the n-by-k
+// matrix V receive the corresponding left and right singular vectors in their columns; if they
+// are 'N', U and V are not referenced. The range of A is sampled with k + p random vectors, where
+// p is the oversampling, k + p <= min(m, n), and niters power iterations refine the sample when
+// the singular values of A decay slowly. A is not modified, and the test matrix is drawn with a
+// fixed seed, so that repeated calls give the same result. devInfo receives the info of gesvd.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdr_bufferSize(hipsolverHandle_t handle,
+                                                               signed char       jobu,
+                                                               signed char       jobv,
+                                                               int               m,
+                                                               int               n,
+                                                               int               k,
+                                                               int               p,
+                                                               int               niters,
+                                                               int               lda,
+                                                               int               ldu,
+                                                               int               ldv,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdr(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int               k,
+                                                    int               p,
+                                                    int               niters,
+                                                    float*            A,
+                                                    int               lda,
+                                                    float*            S,
+                                                    float*            U,
+                                                    int               ldu,
+                                                    float*            V,
+                                                    int               ldv,
+                                                    float*            work,
+                                                    int               lwork,
+                                                    int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdr_bufferSize(hipsolverHandle_t handle,
+                                                               signed char       jobu,
+                                                               signed char       jobv,
+                                                               int               m,
+                                                               int               n,
+                                                               int               k,
+                                                               int               p,
+                                                               int               niters,
+                                                               int               lda,
+                                                               int               ldu,
+                                                               int               ldv,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdr(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int               k,
+                                                    int               p,
+                                                    int               niters,
+                                                    double*           A,
+                                                    int               lda,
+                                                    double*           S,
+                                                    double*           U,
+                                                    int               ldu,
+                                                    double*           V,
+                                                    int               ldv,
+                                                    double*           work,
+                                                    int               lwork,
+                                                    int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdr_bufferSize(hipsolverHandle_t handle,
+                                                               signed char       jobu,
+                                                               signed char       jobv,
+                                                               int               m,
+                                                               int               n,
+                                                               int               k,
+                                                               int               p,
+                                                               int               niters,
+                                                               int               lda,
+                                                               int               ldu,
+                                                               int               ldv,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdr(hipsolverHandle_t handle,
+                                                    signed char       jobu,
+                                                    signed char       jobv,
+                                                    int               m,
+                                                    int               n,
+                                                    int               k,
+                                                    int               p,
+                                                    int               niters,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    float*            S,
+                                                    hipsolverComplex* U,
+                                                    int               ldu,
+                                                    hipsolverComplex* V,
+                                                    int               ldv,
+                                                    hipsolverComplex* work,
+                                                    int               lwork,
+                                                    int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdr_bufferSize(hipsolverHandle_t handle,
+                                                               signed char       jobu,
+                                                               signed char       jobv,
+                                                               int               m,
+                                                               int               n,
+                                                               int               k,
+                                                               int               p,
+                                                               int               niters,
+                                                               int               lda,
+                                                               int               ldu,
+                                                               int               ldv,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdr(hipsolverHandle_t       handle,
+                                                    signed char             jobu,
+                                                    signed char             jobv,
+                                                    int                     m,
+                                                    int                     n,
+                                                    int                     k,
+                                                    int                     p,
+                                                    int                     niters,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    double*                 S,
+                                                    hipsolverDoubleComplex* U,
+                                                    int                     ldu,
+                                                    hipsolverDoubleComplex* V,
+                                                    int                     ldv,
+                                                    hipsolverDoubleComplex* work,
+                                                    int                     lwork,
+                                                    int*                    devInfo);
+
+// geqdwh: polar decomposition A = U * H of the m-by-n matrix A, m >= n, of full column rank, by the
+// QDWH iteration. A is overwritten by the factor U, whose columns are orthonormal, and if H is not
+// null, the n-by-n Hermitian positive semidefinite factor H is written to H, in both triangles;
+// ldh must be at least n in any case. The number of iterations is fixed by the precision, and
+// enough for a condition number of A up to about 1 / (sqrt(n) * eps). devInfo receives 0, or the
+// first iteration whose Cholesky factorization failed, when A is numerically rank deficient, in
+// which case A and H are unchanged. The call synchronizes with the stream of the handle.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqdwh_bufferSize(hipsolverHandle_t handle,
+                                                               int               m,
+                                                               int               n,
+                                                               int               lda,
+                                                               int               ldh,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqdwh(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    float*            H,
+                                                    int               ldh,
+                                                    float*            work,
+                                                    int               lwork,
+                                                    int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqdwh_bufferSize(hipsolverHandle_t handle,
+                                                               int               m,
+                                                               int               n,
+                                                               int               lda,
+                                                               int               ldh,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqdwh(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    double*           H,
+                                                    int               ldh,
+                                                    double*           work,
+                                                    int               lwork,
+                                                    int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqdwh_bufferSize(hipsolverHandle_t handle,
+                                                               int               m,
+                                                               int               n,
+                                                               int               lda,
+                                                               int               ldh,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqdwh(hipsolverHandle_t handle,
+                                                    int               m,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    hipsolverComplex* H,
+                                                    int               ldh,
+                                                    hipsolverComplex* work,
+                                                    int               lwork,
+                                                    int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqdwh_bufferSize(hipsolverHandle_t handle,
+                                                               int               m,
+                                                               int               n,
+                                                               int               lda,
+                                                               int               ldh,
+                                                               int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqdwh(hipsolverHandle_t       handle,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* H,
+                                                    int                     ldh,
+                                                    hipsolverDoubleComplex* work,
+                                                    int                     lwork,
+                                                    int*                    devInfo);
+
+// geqdwhStridedBatched: geqdwh of each of the batch_count m-by-n matrices A of the batch, stored
+// strideA apart, with their Hermitian factors strideH apart. devInfo receives batch_count infos.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgeqdwhStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              int               lda,
+                                              int               strideA,
+                                              int               ldh,
+                                              int               strideH,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqdwhStridedBatched(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  float*            A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  float*            H,
+                                                                  int               ldh,
+                                                                  int               strideH,
+                                                                  float*            work,
+                                                                  int               lwork,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgeqdwhStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              int               lda,
+                                              int               strideA,
+                                              int               ldh,
+                                              int               strideH,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqdwhStridedBatched(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  double*           A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  double*           H,
+                                                                  int               ldh,
+                                                                  int               strideH,
+                                                                  double*           work,
+                                                                  int               lwork,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgeqdwhStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              int               lda,
+                                              int               strideA,
+                                              int               ldh,
+                                              int               strideH,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqdwhStridedBatched(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  int               n,
+                                                                  hipsolverComplex* A,
+                                                                  int               lda,
+                                                                  int               strideA,
+                                                                  hipsolverComplex* H,
+                                                                  int               ldh,
+                                                                  int               strideH,
+                                                                  hipsolverComplex* work,
+                                                                  int               lwork,
+                                                                  int*              devInfo,
+                                                                  int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqdwhStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              int               lda,
+                                              int               strideA,
+                                              int               ldh,
+                                              int               strideH,
+                                              int*              lwork,
+                                              int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgeqdwhStridedBatched(hipsolverHandle_t       handle,
+                                   int                     m,
+                                   int                     n,
+                                   hipsolverDoubleComplex* A,
+                                   int                     lda,
+                                   int                     strideA,
+                                   hipsolverDoubleComplex* H,
+                                   int                     ldh,
+                                   int                     strideH,
+                                   hipsolverDoubleComplex* work,
+                                   int                     lwork,
+                                   int*                    devInfo,
+                                   int                     batch_count);
+
+// posqrt: square root of the Hermitian positive definite matrix A of order n, given by its
+// triangle uplo, if job is 'S', or the inverse of its square root if job is 'I'. With the Cholesky
+// factorization A = R^H * R and the polar decomposition R = U * H of geqdwh, the square root is H
+// and its inverse R^-1 * U. A is overwritten by the result in both triangles. devInfo receives 0,
+// or i > 0 if the leading minor of order i of A is not positive definite, or n if A is
+// numerically singular, in which case A is unchanged.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposqrt_bufferSize(hipsolverHandle_t   handle,
+                                                               signed char         job,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               int                 lda,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposqrt(hipsolverHandle_t   handle,
+                                                    signed char         job,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposqrt_bufferSize(hipsolverHandle_t   handle,
+                                                               signed char         job,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               int                 lda,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposqrt(hipsolverHandle_t   handle,
+                                                    signed char         job,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposqrt_bufferSize(hipsolverHandle_t   handle,
+                                                               signed char         job,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               int                 lda,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposqrt(hipsolverHandle_t   handle,
+                                                    signed char         job,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    hipsolverComplex*   work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposqrt_bufferSize(hipsolverHandle_t   handle,
+                                                               signed char         job,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               int                 lda,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposqrt(hipsolverHandle_t       handle,
+                                                    signed char             job,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* work,
+                                                    int                     lwork,
+                                                    int*                    devInfo);
+
+// posqrtStridedBatched: posqrt of each of the batch_count matrices A of the batch, stored strideA
+// apart. devInfo receives batch_count infos.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSposqrtStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                              signed char         job,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 lda,
+                                              int                 strideA,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposqrtStridedBatched(hipsolverHandle_t   handle,
+                                                                  signed char         job,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  float*              A,
+                                                                  int                 lda,
+                                                                  int                 strideA,
+                                                                  float*              work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDposqrtStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                              signed char         job,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 lda,
+                                              int                 strideA,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposqrtStridedBatched(hipsolverHandle_t   handle,
+                                                                  signed char         job,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  double*             A,
+                                                                  int                 lda,
+                                                                  int                 strideA,
+                                                                  double*             work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCposqrtStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                              signed char         job,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 lda,
+                                              int                 strideA,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposqrtStridedBatched(hipsolverHandle_t   handle,
+                                                                  signed char         job,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  hipsolverComplex*   A,
+                                                                  int                 lda,
+                                                                  int                 strideA,
+                                                                  hipsolverComplex*   work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposqrtStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                              signed char         job,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 lda,
+                                              int                 strideA,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposqrtStridedBatched(hipsolverHandle_t       handle,
+                                   signed char             job,
+                                   hipsolverFillMode_t     uplo,
+                                   int                     n,
+                                   hipsolverDoubleComplex* A,
+                                   int                     lda,
+                                   int                     strideA,
+                                   hipsolverDoubleComplex* work,
+                                   int                     lwork,
+                                   int*                    devInfo,
+                                   int                     batch_count);
+
+// gesvdj
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateGesvdjInfo(hipsolverGesvdjInfo_t* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroyGesvdjInfo(hipsolverGesvdjInfo_t info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjSetTolerance(
+    hipsolverGesvdjInfo_t info, double tolerance);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjSetMaxSweeps(
+    hipsolverGesvdjInfo_t info, int max_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetResidual(
+    hipsolverHandle_t handle, hipsolverGesvdjInfo_t info, double* residual);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetSweeps(
+    hipsolverHandle_t handle, hipsolverGesvdjInfo_t info, int* executed_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdj_bufferSize(hipsolverHandle_t     handle,
+                                                               hipsolverEigMode_t    jobz,
+                                                               int                   econ,
+                                                               int                   m,
+                                                               int                   n,
+                                                               float*                A,
+                                                               int                   lda,
+                                                               float*                S,
+                                                               float*                U,
+                                                               int                   ldu,
+                                                               float*                V,
+                                                               int                   ldv,
+                                                               int*                  lwork,
+                                                               hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdj_bufferSize(hipsolverHandle_t     handle,
+                                                               hipsolverEigMode_t    jobz,
+                                                               int                   econ,
+                                                               int                   m,
+                                                               int                   n,
+                                                               double*               A,
+                                                               int                   lda,
+                                                               double*               S,
+                                                               double*               U,
+                                                               int                   ldu,
+                                                               double*               V,
+                                                               int                   ldv,
+                                                               int*                  lwork,
+                                                               hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdj_bufferSize(hipsolverHandle_t     handle,
+                                                               hipsolverEigMode_t    jobz,
+                                                               int                   econ,
+                                                               int                   m,
+                                                               int                   n,
+                                                               hipsolverComplex*     A,
+                                                               int                   lda,
+                                                               float*                S,
+                                                               hipsolverComplex*     U,
+                                                               int                   ldu,
+                                                               hipsolverComplex*     V,
+                                                               int                   ldv,
+                                                               int*                  lwork,
+                                                               hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdj_bufferSize(hipsolverHandle_t       handle,
+                                                               hipsolverEigMode_t      jobz,
+                                                               int                     econ,
+                                                               int                     m,
+                                                               int                     n,
+                                                               hipsolverDoubleComplex* A,
+                                                               int                     lda,
+                                                               double*                 S,
+                                                               hipsolverDoubleComplex* U,
+                                                               int                     ldu,
+                                                               hipsolverDoubleComplex* V,
+                                                               int                     ldv,
+                                                               int*                    lwork,
+                                                               hipsolverGesvdjInfo_t   params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdj(hipsolverHandle_t     handle,
+                                                    hipsolverEigMode_t    jobz,
+                                                    int                   econ,
+                                                    int                   m,
+                                                    int                   n,
+                                                    float*                A,
+                                                    int                   lda,
+                                                    float*                S,
+                                                    float*                U,
+                                                    int                   ldu,
+                                                    float*                V,
+                                                    int                   ldv,
+                                                    float*                work,
+                                                    int                   lwork,
+                                                    int*                  devInfo,
+                                                    hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdj(hipsolverHandle_t     handle,
+                                                    hipsolverEigMode_t    jobz,
+                                                    int                   econ,
+                                                    int                   m,
+                                                    int                   n,
+                                                    double*               A,
+                                                    int                   lda,
+                                                    double*               S,
+                                                    double*               U,
+                                                    int                   ldu,
+                                                    double*               V,
+                                                    int                   ldv,
+                                                    double*               work,
+                                                    int                   lwork,
+                                                    int*                  devInfo,
+                                                    hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdj(hipsolverHandle_t     handle,
+                                                    hipsolverEigMode_t    jobz,
+                                                    int                   econ,
+                                                    int                   m,
+                                                    int                   n,
+                                                    hipsolverComplex*     A,
+                                                    int                   lda,
+                                                    float*                S,
+                                                    hipsolverComplex*     U,
+                                                    int                   ldu,
+                                                    hipsolverComplex*     V,
+                                                    int                   ldv,
+                                                    hipsolverComplex*     work,
+                                                    int                   lwork,
+                                                    int*                  devInfo,
+                                                    hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdj(hipsolverHandle_t       handle,
+                                                    hipsolverEigMode_t      jobz,
+                                                    int                     econ,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    double*                 S,
+                                                    hipsolverDoubleComplex* U,
+                                                    int                     ldu,
+                                                    hipsolverDoubleComplex* V,
+                                                    int                     ldv,
+                                                    hipsolverDoubleComplex* work,
+                                                    int                     lwork,
+                                                    int*                    devInfo,
+                                                    hipsolverGesvdjInfo_t   params);
+
+// gesvdj_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdjBatched_bufferSize(hipsolverHandle_t     handle,
+                                       hipsolverEigMode_t    jobz,
+                                       int                   m,
+                                       int                   n,
+                                       float*                A,
+                                       int                   lda,
+                                       float*                S,
+                                       float*                U,
+                                       int                   ldu,
+                                       float*                V,
+                                       int                   ldv,
+                                       int*                  lwork,
+                                       hipsolverGesvdjInfo_t params,
+                                       int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdjBatched_bufferSize(hipsolverHandle_t     handle,
+                                       hipsolverEigMode_t    jobz,
+                                       int                   m,
+                                       int                   n,
+                                       double*               A,
+                                       int                   lda,
+                                       double*               S,
+                                       double*               U,
+                                       int                   ldu,
+                                       double*               V,
+                                       int                   ldv,
+                                       int*                  lwork,
+                                       hipsolverGesvdjInfo_t params,
+                                       int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdjBatched_bufferSize(hipsolverHandle_t     handle,
+                                       hipsolverEigMode_t    jobz,
+                                       int                   m,
+                                       int                   n,
+                                       hipsolverComplex*     A,
+                                       int                   lda,
+                                       float*                S,
+                                       hipsolverComplex*     U,
+                                       int                   ldu,
+                                       hipsolverComplex*     V,
+                                       int                   ldv,
+                                       int*                  lwork,
+                                       hipsolverGesvdjInfo_t params,
+                                       int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdjBatched_bufferSize(hipsolverHandle_t       handle,
+                                       hipsolverEigMode_t      jobz,
+                                       int                     m,
+                                       int                     n,
+                                       hipsolverDoubleComplex* A,
+                                       int                     lda,
+                                       double*                 S,
+                                       hipsolverDoubleComplex* U,
+                                       int                     ldu,
+                                       hipsolverDoubleComplex* V,
+                                       int                     ldv,
+                                       int*                    lwork,
+                                       hipsolverGesvdjInfo_t   params,
+                                       int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdjBatched(hipsolverHandle_t     handle,
+                                                           hipsolverEigMode_t    jobz,
+                                                           int                   m,
+                                                           int                   n,
+                                                           float*                A,
+                                                           int                   lda,
+                                                           float*                S,
+                                                           float*                U,
+                                                           int                   ldu,
+                                                           float*                V,
+                                                           int                   ldv,
+                                                           float*                work,
+                                                           int                   lwork,
+                                                           int*                  devInfo,
+                                                           hipsolverGesvdjInfo_t params,
+                                                           int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdjBatched(hipsolverHandle_t     handle,
+                                                           hipsolverEigMode_t    jobz,
+                                                           int                   m,
+                                                           int                   n,
+                                                           double*               A,
+                                                           int                   lda,
+                                                           double*               S,
+                                                           double*               U,
+                                                           int                   ldu,
+                                                           double*               V,
+                                                           int                   ldv,
+                                                           double*               work,
+                                                           int                   lwork,
+                                                           int*                  devInfo,
+                                                           hipsolverGesvdjInfo_t params,
+                                                           int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdjBatched(hipsolverHandle_t     handle,
+                                                           hipsolverEigMode_t    jobz,
+                                                           int                   m,
+                                                           int                   n,
+                                                           hipsolverComplex*     A,
+                                                           int                   lda,
+                                                           float*                S,
+                                                           hipsolverComplex*     U,
+                                                           int                   ldu,
+                                                           hipsolverComplex*     V,
+                                                           int                   ldv,
+                                                           hipsolverComplex*     work,
+                                                           int                   lwork,
+                                                           int*                  devInfo,
+                                                           hipsolverGesvdjInfo_t params,
+                                                           int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdjBatched(hipsolverHandle_t       handle,
+                                                           hipsolverEigMode_t      jobz,
+                                                           int                     m,
+                                                           int                     n,
+                                                           hipsolverDoubleComplex* A,
+                                                           int                     lda,
+                                                           double*                 S,
+                                                           hipsolverDoubleComplex* U,
+                                                           int                     ldu,
+                                                           hipsolverDoubleComplex* V,
+                                                           int                     ldv,
+                                                           hipsolverDoubleComplex* work,
+                                                           int                     lwork,
+                                                           int*                    devInfo,
+                                                           hipsolverGesvdjInfo_t   params,
+                                                           int                     batch_count);
+
 // getrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -927,6 +5116,653 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t       handl
                                                    int*                    devIpiv,
                                                    int*                    devInfo);
 
+// getrf_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipsolverComplex* A[],
+                                                                     int               lda,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfBatched_bufferSize(hipsolverHandle_t       handle,
+                                      int                     m,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          float*            work,
+                                                          int               lwork,
+                                                          int*              devIpiv,
+                                                          int               strideP,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          double*           work,
+                                                          int               lwork,
+                                                          int*              devIpiv,
+                                                          int               strideP,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          hipsolverComplex* A[],
+                                                          int               lda,
+                                                          hipsolverComplex* work,
+                                                          int               lwork,
+                                                          int*              devIpiv,
+                                                          int               strideP,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfBatched(hipsolverHandle_t       handle,
+                                                          int                     m,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devIpiv,
+                                                          int                     strideP,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// getrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipsolverComplex* A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfStridedBatched(hipsolverHandle_t       handle,
+                                  int                     m,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devIpiv,
+                                  int                     strideP,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// getrf_interleaved_batched: A and devIpiv are in the interleaved layout (see above), and devIpiv
+// is null for factorizations without pivoting. On AMD, real square matrices of order up to 32 are
+// factorized in place; otherwise the batch is converted to the strided layout in the workspace and
+// factorized by getrfStridedBatched. On AMD, work may be null, and the workspace is then taken
+// from the handle.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfInterleavedBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfInterleavedBatched(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     float*            A,
+                                                                     int               lda,
+                                                                     float*            work,
+                                                                     int               lwork,
+                                                                     int*              devIpiv,
+                                                                     int*              devInfo,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfInterleavedBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfInterleavedBatched(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     double*           A,
+                                                                     int               lda,
+                                                                     double*           work,
+                                                                     int               lwork,
+                                                                     int*              devIpiv,
+                                                                     int*              devInfo,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfInterleavedBatched_bufferSize(hipsolverHandle_t handle,
+                                                 int               m,
+                                                 int               n,
+                                                 hipsolverComplex* A,
+                                                 int               lda,
+                                                 int*              lwork,
+                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfInterleavedBatched(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipsolverComplex* A,
+                                                                     int               lda,
+                                                                     hipsolverComplex* work,
+                                                                     int               lwork,
+                                                                     int*              devIpiv,
+                                                                     int*              devInfo,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfInterleavedBatched_bufferSize(hipsolverHandle_t       handle,
+                                                 int                     m,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int*                    lwork,
+                                                 int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfInterleavedBatched(hipsolverHandle_t       handle,
+                                      int                     m,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A,
+                                      int                     lda,
+                                      hipsolverDoubleComplex* work,
+                                      int                     lwork,
+                                      int*                    devIpiv,
+                                      int*                    devInfo,
+                                      int                     batch_count);
+
+// getrf_vbatched: n and lda are device arrays of the orders and leading dimensions of the
+// batch_count square matrices, which may all differ. devIpiv holds the pivots of the matrices
+// one after the other, n[b] for matrix b, or is null for factorizations without pivoting. A
+// matrix of invalid sizes is not factorized, and devInfo[b] is set to -1 if its order is
+// negative, or to -3 if its leading dimension is smaller than max(1, n[b]).
+// On AMD, the batch is solved by a single kernel, one block per matrix, without reading back the
+// sizes, and the workspace only depends on batch_count. Otherwise, or if hipSOLVER was built
+// without a HIP compiler, the sizes are copied to the host, which synchronizes with the stream of
+// the handle, and the matrices of equal shapes are solved together by one batched call.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                       const int*        n,
+                                       float*            A[],
+                                       const int*        lda,
+                                       int*              lwork,
+                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        n,
+                                                           float*            A[],
+                                                           const int*        lda,
+                                                           float*            work,
+                                                           int               lwork,
+                                                           int*              devIpiv,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                       const int*        n,
+                                       double*           A[],
+                                       const int*        lda,
+                                       int*              lwork,
+                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        n,
+                                                           double*           A[],
+                                                           const int*        lda,
+                                                           double*           work,
+                                                           int               lwork,
+                                                           int*              devIpiv,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfVbatched_bufferSize(hipsolverHandle_t handle,
+                                       const int*        n,
+                                       hipsolverComplex* A[],
+                                       const int*        lda,
+                                       int*              lwork,
+                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfVbatched(hipsolverHandle_t handle,
+                                                           const int*        n,
+                                                           hipsolverComplex* A[],
+                                                           const int*        lda,
+                                                           hipsolverComplex* work,
+                                                           int               lwork,
+                                                           int*              devIpiv,
+                                                           int*              devInfo,
+                                                           int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfVbatched_bufferSize(hipsolverHandle_t       handle,
+                                       const int*              n,
+                                       hipsolverDoubleComplex* A[],
+                                       const int*              lda,
+                                       int*                    lwork,
+                                       int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfVbatched(hipsolverHandle_t       handle,
+                                                           const int*              n,
+                                                           hipsolverDoubleComplex* A[],
+                                                           const int*              lda,
+                                                           hipsolverDoubleComplex* work,
+                                                           int                     lwork,
+                                                           int*                    devIpiv,
+                                                           int*                    devInfo,
+                                                           int                     batch_count);
+
+// getrf_out_of_core: A and ipiv are in host memory, and the factorization uses at most
+// deviceMemory bytes of device memory. The call returns once A, ipiv and info are written.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfOutOfCore(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            float*            A,
+                                                            int               lda,
+                                                            int*              ipiv,
+                                                            size_t            deviceMemory,
+                                                            int*              info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfOutOfCore(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            double*           A,
+                                                            int               lda,
+                                                            int*              ipiv,
+                                                            size_t            deviceMemory,
+                                                            int*              info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfOutOfCore(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            hipsolverComplex* A,
+                                                            int               lda,
+                                                            int*              ipiv,
+                                                            size_t            deviceMemory,
+                                                            int*              info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfOutOfCore(hipsolverHandle_t       handle,
+                                                            int                     m,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            int*                    ipiv,
+                                                            size_t                  deviceMemory,
+                                                            int*                    info);
+
+// getri
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetri_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              float*            A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetri_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetri_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              hipsolverComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetri_bufferSize(hipsolverHandle_t       handle,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int*                    devIpiv,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetri(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   float*            A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   float*            work,
+                                                   int               lwork,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetri(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           work,
+                                                   int               lwork,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetri(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   hipsolverComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipsolverComplex* work,
+                                                   int               lwork,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetri(hipsolverHandle_t       handle,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int*                    devIpiv,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// getri_outofplace_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriOutOfPlaceBatched_bufferSize(hipsolverHandle_t handle,
+                                                int               n,
+                                                float*            A[],
+                                                int               lda,
+                                                int*              devIpiv,
+                                                int               strideP,
+                                                float*            C[],
+                                                int               ldc,
+                                                int*              lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriOutOfPlaceBatched_bufferSize(hipsolverHandle_t handle,
+                                                int               n,
+                                                double*           A[],
+                                                int               lda,
+                                                int*              devIpiv,
+                                                int               strideP,
+                                                double*           C[],
+                                                int               ldc,
+                                                int*              lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriOutOfPlaceBatched_bufferSize(hipsolverHandle_t handle,
+                                                int               n,
+                                                hipsolverComplex* A[],
+                                                int               lda,
+                                                int*              devIpiv,
+                                                int               strideP,
+                                                hipsolverComplex* C[],
+                                                int               ldc,
+                                                int*              lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceBatched_bufferSize(hipsolverHandle_t       handle,
+                                                int                     n,
+                                                hipsolverDoubleComplex* A[],
+                                                int                     lda,
+                                                int*                    devIpiv,
+                                                int                     strideP,
+                                                hipsolverDoubleComplex* C[],
+                                                int                     ldc,
+                                                int*                    lwork,
+                                                int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetriOutOfPlaceBatched(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    float*            A[],
+                                                                    int               lda,
+                                                                    int*              devIpiv,
+                                                                    int               strideP,
+                                                                    float*            C[],
+                                                                    int               ldc,
+                                                                    float*            work,
+                                                                    int               lwork,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetriOutOfPlaceBatched(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    double*           A[],
+                                                                    int               lda,
+                                                                    int*              devIpiv,
+                                                                    int               strideP,
+                                                                    double*           C[],
+                                                                    int               ldc,
+                                                                    double*           work,
+                                                                    int               lwork,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetriOutOfPlaceBatched(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    hipsolverComplex* A[],
+                                                                    int               lda,
+                                                                    int*              devIpiv,
+                                                                    int               strideP,
+                                                                    hipsolverComplex* C[],
+                                                                    int               ldc,
+                                                                    hipsolverComplex* work,
+                                                                    int               lwork,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceBatched(hipsolverHandle_t       handle,
+                                     int                     n,
+                                     hipsolverDoubleComplex* A[],
+                                     int                     lda,
+                                     int*                    devIpiv,
+                                     int                     strideP,
+                                     hipsolverDoubleComplex* C[],
+                                     int                     ldc,
+                                     hipsolverDoubleComplex* work,
+                                     int                     lwork,
+                                     int*                    devInfo,
+                                     int                     batch_count);
+
+// getri_outofplace_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriOutOfPlaceStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                       int               n,
+                                                       float*            A,
+                                                       int               lda,
+                                                       int               strideA,
+                                                       int*              devIpiv,
+                                                       int               strideP,
+                                                       float*            C,
+                                                       int               ldc,
+                                                       int               strideC,
+                                                       int*              lwork,
+                                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriOutOfPlaceStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                       int               n,
+                                                       double*           A,
+                                                       int               lda,
+                                                       int               strideA,
+                                                       int*              devIpiv,
+                                                       int               strideP,
+                                                       double*           C,
+                                                       int               ldc,
+                                                       int               strideC,
+                                                       int*              lwork,
+                                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriOutOfPlaceStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                                       int               n,
+                                                       hipsolverComplex* A,
+                                                       int               lda,
+                                                       int               strideA,
+                                                       int*              devIpiv,
+                                                       int               strideP,
+                                                       hipsolverComplex* C,
+                                                       int               ldc,
+                                                       int               strideC,
+                                                       int*              lwork,
+                                                       int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                                       int                     n,
+                                                       hipsolverDoubleComplex* A,
+                                                       int                     lda,
+                                                       int                     strideA,
+                                                       int*                    devIpiv,
+                                                       int                     strideP,
+                                                       hipsolverDoubleComplex* C,
+                                                       int                     ldc,
+                                                       int                     strideC,
+                                                       int*                    lwork,
+                                                       int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriOutOfPlaceStridedBatched(hipsolverHandle_t handle,
+                                            int               n,
+                                            float*            A,
+                                            int               lda,
+                                            int               strideA,
+                                            int*              devIpiv,
+                                            int               strideP,
+                                            float*            C,
+                                            int               ldc,
+                                            int               strideC,
+                                            float*            work,
+                                            int               lwork,
+                                            int*              devInfo,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriOutOfPlaceStridedBatched(hipsolverHandle_t handle,
+                                            int               n,
+                                            double*           A,
+                                            int               lda,
+                                            int               strideA,
+                                            int*              devIpiv,
+                                            int               strideP,
+                                            double*           C,
+                                            int               ldc,
+                                            int               strideC,
+                                            double*           work,
+                                            int               lwork,
+                                            int*              devInfo,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriOutOfPlaceStridedBatched(hipsolverHandle_t handle,
+                                            int               n,
+                                            hipsolverComplex* A,
+                                            int               lda,
+                                            int               strideA,
+                                            int*              devIpiv,
+                                            int               strideP,
+                                            hipsolverComplex* C,
+                                            int               ldc,
+                                            int               strideC,
+                                            hipsolverComplex* work,
+                                            int               lwork,
+                                            int*              devInfo,
+                                            int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriOutOfPlaceStridedBatched(hipsolverHandle_t       handle,
+                                            int                     n,
+                                            hipsolverDoubleComplex* A,
+                                            int                     lda,
+                                            int                     strideA,
+                                            int*                    devIpiv,
+                                            int                     strideP,
+                                            hipsolverDoubleComplex* C,
+                                            int                     ldc,
+                                            int                     strideC,
+                                            hipsolverDoubleComplex* work,
+                                            int                     lwork,
+                                            int*                    devInfo,
+                                            int                     batch_count);
+
 // getrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverOperation_t trans,
@@ -1024,73 +5860,1731 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
-// potrf
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
+// getrs_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      float*               A[],
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      int                  strideP,
+                                      float*               B[],
+                                      int                  ldb,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      double*              A[],
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      int                  strideP,
+                                      double*              B[],
+                                      int                  ldb,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      hipsolverComplex*    A[],
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      int                  strideP,
+                                      hipsolverComplex*    B[],
+                                      int                  ldb,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverOperation_t    trans,
+                                      int                     n,
+                                      int                     nrhs,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      int*                    devIpiv,
+                                      int                     strideP,
+                                      hipsolverDoubleComplex* B[],
+                                      int                     ldb,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsBatched(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          float*               A[],
+                                                          int                  lda,
+                                                          int*                 devIpiv,
+                                                          int                  strideP,
+                                                          float*               B[],
+                                                          int                  ldb,
+                                                          float*               work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsBatched(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          double*              A[],
+                                                          int                  lda,
+                                                          int*                 devIpiv,
+                                                          int                  strideP,
+                                                          double*              B[],
+                                                          int                  ldb,
+                                                          double*              work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsBatched(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          hipsolverComplex*    A[],
+                                                          int                  lda,
+                                                          int*                 devIpiv,
+                                                          int                  strideP,
+                                                          hipsolverComplex*    B[],
+                                                          int                  ldb,
+                                                          hipsolverComplex*    work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsBatched(hipsolverHandle_t       handle,
+                                                          hipsolverOperation_t    trans,
+                                                          int                     n,
+                                                          int                     nrhs,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          int*                    devIpiv,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* B[],
+                                                          int                     ldb,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf_bufferSize(
-    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork);
+// getrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             float*               B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             double*              B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipsolverComplex*    A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             hipsolverComplex*    B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverOperation_t    trans,
+                                             int                     n,
+                                             int                     nrhs,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             int*                    devIpiv,
+                                             int                     strideP,
+                                             hipsolverDoubleComplex* B,
+                                             int                     ldb,
+                                             int                     strideB,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 float*               B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 double*              B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipsolverComplex*    A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 hipsolverComplex*    B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 hipsolverComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverOperation_t    trans,
+                                  int                     n,
+                                  int                     nrhs,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  int*                    devIpiv,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* B,
+                                  int                     ldb,
+                                  int                     strideB,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// getrs_interleaved_batched: A, devIpiv and B are in the interleaved layout, as computed by
+// getrf_interleaved_batched. On AMD, real systems of order up to 32 are solved in place;
+// otherwise the batch is converted to the strided layout in the workspace and solved by
+// getrsStridedBatched. On AMD, work may be null, and the workspace is then taken from the handle.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsInterleavedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                 hipsolverOperation_t trans,
+                                                 int                  n,
+                                                 int                  nrhs,
+                                                 float*               A,
+                                                 int                  lda,
+                                                 int*                 devIpiv,
+                                                 float*               B,
+                                                 int                  ldb,
+                                                 int*                 lwork,
+                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsInterleavedBatched(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      float*               A,
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      float*               B,
+                                      int                  ldb,
+                                      float*               work,
+                                      int                  lwork,
+                                      int*                 devInfo,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsInterleavedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                 hipsolverOperation_t trans,
+                                                 int                  n,
+                                                 int                  nrhs,
+                                                 double*              A,
+                                                 int                  lda,
+                                                 int*                 devIpiv,
+                                                 double*              B,
+                                                 int                  ldb,
+                                                 int*                 lwork,
+                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsInterleavedBatched(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      double*              A,
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      double*              B,
+                                      int                  ldb,
+                                      double*              work,
+                                      int                  lwork,
+                                      int*                 devInfo,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsInterleavedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                 hipsolverOperation_t trans,
+                                                 int                  n,
+                                                 int                  nrhs,
+                                                 hipsolverComplex*    A,
+                                                 int                  lda,
+                                                 int*                 devIpiv,
+                                                 hipsolverComplex*    B,
+                                                 int                  ldb,
+                                                 int*                 lwork,
+                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsInterleavedBatched(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      hipsolverComplex*    A,
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      hipsolverComplex*    B,
+                                      int                  ldb,
+                                      hipsolverComplex*    work,
+                                      int                  lwork,
+                                      int*                 devInfo,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsInterleavedBatched_bufferSize(hipsolverHandle_t       handle,
+                                                 hipsolverOperation_t    trans,
+                                                 int                     n,
+                                                 int                     nrhs,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int*                    devIpiv,
+                                                 hipsolverDoubleComplex* B,
+                                                 int                     ldb,
+                                                 int*                    lwork,
+                                                 int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsInterleavedBatched(hipsolverHandle_t       handle,
+                                      hipsolverOperation_t    trans,
+                                      int                     n,
+                                      int                     nrhs,
+                                      hipsolverDoubleComplex* A,
+                                      int                     lda,
+                                      int*                    devIpiv,
+                                      hipsolverDoubleComplex* B,
+                                      int                     ldb,
+                                      hipsolverDoubleComplex* work,
+                                      int                     lwork,
+                                      int*                    devInfo,
+                                      int                     batch_count);
+
+// getrs_vbatched: n, nrhs, lda and ldb are device arrays of the sizes of the batch_count systems,
+// and devIpiv holds the pivots computed by getrf_vbatched. A system of invalid sizes is not
+// solved, and devInfo[b] is set to minus the position of its first invalid size: -2 for n, -3
+// for nrhs, -5 for lda and -8 for ldb; it is set to 0 otherwise.
+// On AMD, the batch is solved by a single kernel, one block per system, without reading back the
+// sizes, and the workspace only depends on batch_count. Otherwise, or if hipSOLVER was built
+// without a HIP compiler, the sizes are copied to the host, which synchronizes with the stream of
+// the handle, and the systems of equal shapes are solved together by one batched call.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsVbatched_bufferSize(hipsolverHandle_t    handle,
+                                       hipsolverOperation_t trans,
+                                       const int*           n,
+                                       const int*           nrhs,
+                                       float*               A[],
+                                       const int*           lda,
+                                       int*                 devIpiv,
+                                       float*               B[],
+                                       const int*           ldb,
+                                       int*                 lwork,
+                                       int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsVbatched(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           const int*           n,
+                                                           const int*           nrhs,
+                                                           float*               A[],
+                                                           const int*           lda,
+                                                           int*                 devIpiv,
+                                                           float*               B[],
+                                                           const int*           ldb,
+                                                           float*               work,
+                                                           int                  lwork,
+                                                           int*                 devInfo,
+                                                           int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsVbatched_bufferSize(hipsolverHandle_t    handle,
+                                       hipsolverOperation_t trans,
+                                       const int*           n,
+                                       const int*           nrhs,
+                                       double*              A[],
+                                       const int*           lda,
+                                       int*                 devIpiv,
+                                       double*              B[],
+                                       const int*           ldb,
+                                       int*                 lwork,
+                                       int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsVbatched(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           const int*           n,
+                                                           const int*           nrhs,
+                                                           double*              A[],
+                                                           const int*           lda,
+                                                           int*                 devIpiv,
+                                                           double*              B[],
+                                                           const int*           ldb,
+                                                           double*              work,
+                                                           int                  lwork,
+                                                           int*                 devInfo,
+                                                           int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsVbatched_bufferSize(hipsolverHandle_t    handle,
+                                       hipsolverOperation_t trans,
+                                       const int*           n,
+                                       const int*           nrhs,
+                                       hipsolverComplex*    A[],
+                                       const int*           lda,
+                                       int*                 devIpiv,
+                                       hipsolverComplex*    B[],
+                                       const int*           ldb,
+                                       int*                 lwork,
+                                       int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsVbatched(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           const int*           n,
+                                                           const int*           nrhs,
+                                                           hipsolverComplex*    A[],
+                                                           const int*           lda,
+                                                           int*                 devIpiv,
+                                                           hipsolverComplex*    B[],
+                                                           const int*           ldb,
+                                                           hipsolverComplex*    work,
+                                                           int                  lwork,
+                                                           int*                 devInfo,
+                                                           int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsVbatched_bufferSize(hipsolverHandle_t       handle,
+                                       hipsolverOperation_t    trans,
+                                       const int*              n,
+                                       const int*              nrhs,
+                                       hipsolverDoubleComplex* A[],
+                                       const int*              lda,
+                                       int*                    devIpiv,
+                                       hipsolverDoubleComplex* B[],
+                                       const int*              ldb,
+                                       int*                    lwork,
+                                       int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsVbatched(hipsolverHandle_t       handle,
+                                                           hipsolverOperation_t    trans,
+                                                           const int*              n,
+                                                           const int*              nrhs,
+                                                           hipsolverDoubleComplex* A[],
+                                                           const int*              lda,
+                                                           int*                    devIpiv,
+                                                           hipsolverDoubleComplex* B[],
+                                                           const int*              ldb,
+                                                           hipsolverDoubleComplex* work,
+                                                           int                     lwork,
+                                                           int*                    devInfo,
+                                                           int                     batch_count);
+
+// gtsv: solves the tridiagonal systems A * X = B of order m with n right-hand sides, where the
+// subdiagonal, diagonal and superdiagonal of A are dl, d and du, with dl[0] = du[m - 1] = 0. B is
+// overwritten with X. The systems are solved with partial pivoting.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsv_bufferSize(hipsolverHandle_t handle,
+                                                             int               m,
+                                                             int               n,
+                                                             const float*      dl,
+                                                             const float*      d,
+                                                             const float*      du,
+                                                             const float*      B,
+                                                             int               ldb,
+                                                             int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsv(hipsolverHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  const float*      dl,
+                                                  const float*      d,
+                                                  const float*      du,
+                                                  float*            B,
+                                                  int               ldb,
+                                                  float*            work,
+                                                  int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsv_bufferSize(hipsolverHandle_t handle,
+                                                             int               m,
+                                                             int               n,
+                                                             const double*     dl,
+                                                             const double*     d,
+                                                             const double*     du,
+                                                             const double*     B,
+                                                             int               ldb,
+                                                             int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsv(hipsolverHandle_t handle,
+                                                  int               m,
+                                                  int               n,
+                                                  const double*     dl,
+                                                  const double*     d,
+                                                  const double*     du,
+                                                  double*           B,
+                                                  int               ldb,
+                                                  double*           work,
+                                                  int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsv_bufferSize(hipsolverHandle_t       handle,
+                                                             int                     m,
+                                                             int                     n,
+                                                             const hipsolverComplex* dl,
+                                                             const hipsolverComplex* d,
+                                                             const hipsolverComplex* du,
+                                                             const hipsolverComplex* B,
+                                                             int                     ldb,
+                                                             int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsv(hipsolverHandle_t       handle,
+                                                  int                     m,
+                                                  int                     n,
+                                                  const hipsolverComplex* dl,
+                                                  const hipsolverComplex* d,
+                                                  const hipsolverComplex* du,
+                                                  hipsolverComplex*       B,
+                                                  int                     ldb,
+                                                  hipsolverComplex*       work,
+                                                  int                     lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsv_bufferSize(hipsolverHandle_t             handle,
+                                                             int                           m,
+                                                             int                           n,
+                                                             const hipsolverDoubleComplex* dl,
+                                                             const hipsolverDoubleComplex* d,
+                                                             const hipsolverDoubleComplex* du,
+                                                             const hipsolverDoubleComplex* B,
+                                                             int                           ldb,
+                                                             int*                          lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgtsv(hipsolverHandle_t             handle,
+                                                  int                           m,
+                                                  int                           n,
+                                                  const hipsolverDoubleComplex* dl,
+                                                  const hipsolverDoubleComplex* d,
+                                                  const hipsolverDoubleComplex* du,
+                                                  hipsolverDoubleComplex*       B,
+                                                  int                           ldb,
+                                                  hipsolverDoubleComplex*       work,
+                                                  int                           lwork);
+
+// gtsv_strided_batch: solves the batch of batch_count tridiagonal systems A * x = b of order m,
+// where the diagonals of system i start at dl + i * strideX, d + i * strideX and du + i * strideX,
+// and its right-hand side at x + i * strideX. x is overwritten with the solutions. The systems are
+// solved without pivoting, so A should be diagonally dominant or positive definite.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgtsvStridedBatch_bufferSize(hipsolverHandle_t handle,
+                                          int               m,
+                                          const float*      dl,
+                                          const float*      d,
+                                          const float*      du,
+                                          const float*      x,
+                                          int               batch_count,
+                                          int               strideX,
+                                          int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgtsvStridedBatch(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              const float*      dl,
+                                                              const float*      d,
+                                                              const float*      du,
+                                                              float*            x,
+                                                              int               batch_count,
+                                                              int               strideX,
+                                                              float*            work,
+                                                              int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgtsvStridedBatch_bufferSize(hipsolverHandle_t handle,
+                                          int               m,
+                                          const double*     dl,
+                                          const double*     d,
+                                          const double*     du,
+                                          const double*     x,
+                                          int               batch_count,
+                                          int               strideX,
+                                          int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgtsvStridedBatch(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              const double*     dl,
+                                                              const double*     d,
+                                                              const double*     du,
+                                                              double*           x,
+                                                              int               batch_count,
+                                                              int               strideX,
+                                                              double*           work,
+                                                              int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgtsvStridedBatch_bufferSize(hipsolverHandle_t       handle,
+                                          int                     m,
+                                          const hipsolverComplex* dl,
+                                          const hipsolverComplex* d,
+                                          const hipsolverComplex* du,
+                                          const hipsolverComplex* x,
+                                          int                     batch_count,
+                                          int                     strideX,
+                                          int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgtsvStridedBatch(hipsolverHandle_t       handle,
+                                                              int                     m,
+                                                              const hipsolverComplex* dl,
+                                                              const hipsolverComplex* d,
+                                                              const hipsolverComplex* du,
+                                                              hipsolverComplex*       x,
+                                                              int                     batch_count,
+                                                              int                     strideX,
+                                                              hipsolverComplex*       work,
+                                                              int                     lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgtsvStridedBatch_bufferSize(hipsolverHandle_t             handle,
+                                          int                           m,
+                                          const hipsolverDoubleComplex* dl,
+                                          const hipsolverDoubleComplex* d,
+                                          const hipsolverDoubleComplex* du,
+                                          const hipsolverDoubleComplex* x,
+                                          int                           batch_count,
+                                          int                           strideX,
+                                          int*                          lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgtsvStridedBatch(hipsolverHandle_t             handle,
+                               int                           m,
+                               const hipsolverDoubleComplex* dl,
+                               const hipsolverDoubleComplex* d,
+                               const hipsolverDoubleComplex* du,
+                               hipsolverDoubleComplex*       x,
+                               int                           batch_count,
+                               int                           strideX,
+                               hipsolverDoubleComplex*       work,
+                               int                           lwork);
+
+// gpsv_interleaved_batch: solves the batch of batch_count pentadiagonal systems A * x = b of
+// order m, where ds, dl, d, du and dw are the second subdiagonal, subdiagonal, diagonal,
+// superdiagonal and second superdiagonal of A. The diagonals and x are in the interleaved layout:
+// entry i of system b is at x[b + i * batch_count]. x is overwritten with the solutions, and the
+// diagonals with intermediate values. The systems are solved by QR factorization.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgpsvInterleavedBatch_bufferSize(hipsolverHandle_t handle,
+                                              int               m,
+                                              const float*      ds,
+                                              const float*      dl,
+                                              const float*      d,
+                                              const float*      du,
+                                              const float*      dw,
+                                              const float*      x,
+                                              int               batch_count,
+                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgpsvInterleavedBatch(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  float*            ds,
+                                                                  float*            dl,
+                                                                  float*            d,
+                                                                  float*            du,
+                                                                  float*            dw,
+                                                                  float*            x,
+                                                                  int               batch_count,
+                                                                  float*            work,
+                                                                  int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgpsvInterleavedBatch_bufferSize(hipsolverHandle_t handle,
+                                              int               m,
+                                              const double*     ds,
+                                              const double*     dl,
+                                              const double*     d,
+                                              const double*     du,
+                                              const double*     dw,
+                                              const double*     x,
+                                              int               batch_count,
+                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgpsvInterleavedBatch(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  double*           ds,
+                                                                  double*           dl,
+                                                                  double*           d,
+                                                                  double*           du,
+                                                                  double*           dw,
+                                                                  double*           x,
+                                                                  int               batch_count,
+                                                                  double*           work,
+                                                                  int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgpsvInterleavedBatch_bufferSize(hipsolverHandle_t       handle,
+                                              int                     m,
+                                              const hipsolverComplex* ds,
+                                              const hipsolverComplex* dl,
+                                              const hipsolverComplex* d,
+                                              const hipsolverComplex* du,
+                                              const hipsolverComplex* dw,
+                                              const hipsolverComplex* x,
+                                              int                     batch_count,
+                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgpsvInterleavedBatch(hipsolverHandle_t handle,
+                                                                  int               m,
+                                                                  hipsolverComplex* ds,
+                                                                  hipsolverComplex* dl,
+                                                                  hipsolverComplex* d,
+                                                                  hipsolverComplex* du,
+                                                                  hipsolverComplex* dw,
+                                                                  hipsolverComplex* x,
+                                                                  int               batch_count,
+                                                                  hipsolverComplex* work,
+                                                                  int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgpsvInterleavedBatch_bufferSize(hipsolverHandle_t             handle,
+                                              int                           m,
+                                              const hipsolverDoubleComplex* ds,
+                                              const hipsolverDoubleComplex* dl,
+                                              const hipsolverDoubleComplex* d,
+                                              const hipsolverDoubleComplex* du,
+                                              const hipsolverDoubleComplex* dw,
+                                              const hipsolverDoubleComplex* x,
+                                              int                           batch_count,
+                                              int*                          lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgpsvInterleavedBatch(hipsolverHandle_t       handle,
+                                   int                     m,
+                                   hipsolverDoubleComplex* ds,
+                                   hipsolverDoubleComplex* dl,
+                                   hipsolverDoubleComplex* d,
+                                   hipsolverDoubleComplex* du,
+                                   hipsolverDoubleComplex* dw,
+                                   hipsolverDoubleComplex* x,
+                                   int                     batch_count,
+                                   hipsolverDoubleComplex* work,
+                                   int                     lwork);
+
+// gbtrf: LU factorization with partial pivoting of the band matrix A of order n with kl
+// subdiagonals and ku superdiagonals, in the band storage of LAPACK: entry (i, j) of A is at
+// AB[kl + ku + i - j + j * ldab], with ldab >= 2 * kl + ku + 1. The first kl rows of AB receive
+// the fill-in of the factorization and need not be set on entry. The factors use O(n * (kl + ku))
+// memory and are computed by blocks in O(n * (kl + ku) * kl) operations.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgbtrf_bufferSize(
+    hipsolverHandle_t handle, int n, int kl, int ku, float* AB, int ldab, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgbtrf(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               kl,
+                                                   int               ku,
+                                                   float*            AB,
+                                                   int               ldab,
+                                                   float*            work,
+                                                   int               lwork,
+                                                   int*              devIpiv,
+                                                   int*              devInfo);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
-                                                              hipsolverFillMode_t uplo,
-                                                              int                 n,
-                                                              hipsolverComplex*   A,
-                                                              int                 lda,
-                                                              int*                lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgbtrf_bufferSize(
+    hipsolverHandle_t handle, int n, int kl, int ku, double* AB, int ldab, int* lwork);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t       handle,
-                                                              hipsolverFillMode_t     uplo,
-                                                              int                     n,
-                                                              hipsolverDoubleComplex* A,
-                                                              int                     lda,
-                                                              int*                    lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgbtrf(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               kl,
+                                                   int               ku,
+                                                   double*           AB,
+                                                   int               ldab,
+                                                   double*           work,
+                                                   int               lwork,
+                                                   int*              devIpiv,
+                                                   int*              devInfo);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   float*              A,
-                                                   int                 lda,
-                                                   float*              work,
-                                                   int                 lwork,
-                                                   int*                devInfo);
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgbtrf_bufferSize(
+    hipsolverHandle_t handle, int n, int kl, int ku, hipsolverComplex* AB, int ldab, int* lwork);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   double*             A,
-                                                   int                 lda,
-                                                   double*             work,
-                                                   int                 lwork,
-                                                   int*                devInfo);
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgbtrf(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               kl,
+                                                   int               ku,
+                                                   hipsolverComplex* AB,
+                                                   int               ldab,
+                                                   hipsolverComplex* work,
+                                                   int               lwork,
+                                                   int*              devIpiv,
+                                                   int*              devInfo);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
-                                                   hipsolverFillMode_t uplo,
-                                                   int                 n,
-                                                   hipsolverComplex*   A,
-                                                   int                 lda,
-                                                   hipsolverComplex*   work,
-                                                   int                 lwork,
-                                                   int*                devInfo);
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgbtrf_bufferSize(hipsolverHandle_t       handle,
+                                                              int                     n,
+                                                              int                     kl,
+                                                              int                     ku,
+                                                              hipsolverDoubleComplex* AB,
+                                                              int                     ldab,
+                                                              int*                    lwork);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t       handle,
-                                                   hipsolverFillMode_t     uplo,
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgbtrf(hipsolverHandle_t       handle,
                                                    int                     n,
-                                                   hipsolverDoubleComplex* A,
-                                                   int                     lda,
+                                                   int                     kl,
+                                                   int                     ku,
+                                                   hipsolverDoubleComplex* AB,
+                                                   int                     ldab,
                                                    hipsolverDoubleComplex* work,
                                                    int                     lwork,
+                                                   int*                    devIpiv,
                                                    int*                    devInfo);
 
-// potrf_batched
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
-                                                                     hipsolverFillMode_t uplo,
-                                                                     int                 n,
-                                                                     float*              A[],
-                                                                     int                 lda,
-                                                                     int*                lwork,
-                                                                     int batch_count);
+// gbtrs: solves op(A) * X = B with the LU factorization of the band matrix A computed by gbtrf.
+// B is overwritten with X.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgbtrs_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  kl,
+                                                              int                  ku,
+                                                              int                  nrhs,
+                                                              float*               AB,
+                                                              int                  ldab,
+                                                              int*                 devIpiv,
+                                                              float*               B,
+                                                              int                  ldb,
+                                                              int*                 lwork);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgbtrs(hipsolverHandle_t    handle,
+                                                   hipsolverOperation_t trans,
+                                                   int                  n,
+                                                   int                  kl,
+                                                   int                  ku,
+                                                   int                  nrhs,
+                                                   float*               AB,
+                                                   int                  ldab,
+                                                   int*                 devIpiv,
+                                                   float*               B,
+                                                   int                  ldb,
+                                                   float*               work,
+                                                   int                  lwork,
+                                                   int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgbtrs_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  kl,
+                                                              int                  ku,
+                                                              int                  nrhs,
+                                                              double*              AB,
+                                                              int                  ldab,
+                                                              int*                 devIpiv,
+                                                              double*              B,
+                                                              int                  ldb,
+                                                              int*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgbtrs(hipsolverHandle_t    handle,
+                                                   hipsolverOperation_t trans,
+                                                   int                  n,
+                                                   int                  kl,
+                                                   int                  ku,
+                                                   int                  nrhs,
+                                                   double*              AB,
+                                                   int                  ldab,
+                                                   int*                 devIpiv,
+                                                   double*              B,
+                                                   int                  ldb,
+                                                   double*              work,
+                                                   int                  lwork,
+                                                   int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgbtrs_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverOperation_t trans,
+                                                              int                  n,
+                                                              int                  kl,
+                                                              int                  ku,
+                                                              int                  nrhs,
+                                                              hipsolverComplex*    AB,
+                                                              int                  ldab,
+                                                              int*                 devIpiv,
+                                                              hipsolverComplex*    B,
+                                                              int                  ldb,
+                                                              int*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgbtrs(hipsolverHandle_t    handle,
+                                                   hipsolverOperation_t trans,
+                                                   int                  n,
+                                                   int                  kl,
+                                                   int                  ku,
+                                                   int                  nrhs,
+                                                   hipsolverComplex*    AB,
+                                                   int                  ldab,
+                                                   int*                 devIpiv,
+                                                   hipsolverComplex*    B,
+                                                   int                  ldb,
+                                                   hipsolverComplex*    work,
+                                                   int                  lwork,
+                                                   int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgbtrs_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverOperation_t    trans,
+                                                              int                     n,
+                                                              int                     kl,
+                                                              int                     ku,
+                                                              int                     nrhs,
+                                                              hipsolverDoubleComplex* AB,
+                                                              int                     ldab,
+                                                              int*                    devIpiv,
+                                                              hipsolverDoubleComplex* B,
+                                                              int                     ldb,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgbtrs(hipsolverHandle_t       handle,
+                                                   hipsolverOperation_t    trans,
+                                                   int                     n,
+                                                   int                     kl,
+                                                   int                     ku,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* AB,
+                                                   int                     ldab,
+                                                   int*                    devIpiv,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// gbtrf_strided_batched: gbtrf for a batch of batch_count band matrices, strideAB apart, whose
+// pivots are strideP apart.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgbtrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             int               kl,
+                                             int               ku,
+                                             float*            AB,
+                                             int               ldab,
+                                             int               strideAB,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgbtrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               kl,
+                                                                 int               ku,
+                                                                 float*            AB,
+                                                                 int               ldab,
+                                                                 int               strideAB,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgbtrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             int               kl,
+                                             int               ku,
+                                             double*           AB,
+                                             int               ldab,
+                                             int               strideAB,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgbtrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               kl,
+                                                                 int               ku,
+                                                                 double*           AB,
+                                                                 int               ldab,
+                                                                 int               strideAB,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgbtrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             int               kl,
+                                             int               ku,
+                                             hipsolverComplex* AB,
+                                             int               ldab,
+                                             int               strideAB,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgbtrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 int               kl,
+                                                                 int               ku,
+                                                                 hipsolverComplex* AB,
+                                                                 int               ldab,
+                                                                 int               strideAB,
+                                                                 hipsolverComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgbtrfStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             int                     n,
+                                             int                     kl,
+                                             int                     ku,
+                                             hipsolverDoubleComplex* AB,
+                                             int                     ldab,
+                                             int                     strideAB,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgbtrfStridedBatched(hipsolverHandle_t       handle,
+                                  int                     n,
+                                  int                     kl,
+                                  int                     ku,
+                                  hipsolverDoubleComplex* AB,
+                                  int                     ldab,
+                                  int                     strideAB,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devIpiv,
+                                  int                     strideP,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// gbtrs_strided_batched: gbtrs for a batch of batch_count systems.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgbtrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  kl,
+                                             int                  ku,
+                                             int                  nrhs,
+                                             float*               AB,
+                                             int                  ldab,
+                                             int                  strideAB,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             float*               B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgbtrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  kl,
+                                                                 int                  ku,
+                                                                 int                  nrhs,
+                                                                 float*               AB,
+                                                                 int                  ldab,
+                                                                 int                  strideAB,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 float*               B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgbtrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  kl,
+                                             int                  ku,
+                                             int                  nrhs,
+                                             double*              AB,
+                                             int                  ldab,
+                                             int                  strideAB,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             double*              B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgbtrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  kl,
+                                                                 int                  ku,
+                                                                 int                  nrhs,
+                                                                 double*              AB,
+                                                                 int                  ldab,
+                                                                 int                  strideAB,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 double*              B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgbtrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  kl,
+                                             int                  ku,
+                                             int                  nrhs,
+                                             hipsolverComplex*    AB,
+                                             int                  ldab,
+                                             int                  strideAB,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             hipsolverComplex*    B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgbtrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  kl,
+                                                                 int                  ku,
+                                                                 int                  nrhs,
+                                                                 hipsolverComplex*    AB,
+                                                                 int                  ldab,
+                                                                 int                  strideAB,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 hipsolverComplex*    B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 hipsolverComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgbtrsStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverOperation_t    trans,
+                                             int                     n,
+                                             int                     kl,
+                                             int                     ku,
+                                             int                     nrhs,
+                                             hipsolverDoubleComplex* AB,
+                                             int                     ldab,
+                                             int                     strideAB,
+                                             int*                    devIpiv,
+                                             int                     strideP,
+                                             hipsolverDoubleComplex* B,
+                                             int                     ldb,
+                                             int                     strideB,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgbtrsStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverOperation_t    trans,
+                                  int                     n,
+                                  int                     kl,
+                                  int                     ku,
+                                  int                     nrhs,
+                                  hipsolverDoubleComplex* AB,
+                                  int                     ldab,
+                                  int                     strideAB,
+                                  int*                    devIpiv,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* B,
+                                  int                     ldb,
+                                  int                     strideB,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// pbtrf: Cholesky factorization of the Hermitian positive definite band matrix A of order n with
+// kd subdiagonals or superdiagonals, in the band storage of LAPACK: entry (i, j) of the uplo
+// triangle of A is at AB[i - j + j * ldab] for the lower triangle and at AB[kd + i - j + j * ldab]
+// for the upper triangle, with ldab >= kd + 1. When devInfo is i > 0, the leading minor of order i
+// is not positive definite and the rest of AB is not meaningful.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              float*              AB,
+                                                              int                 ldab,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   float*              AB,
+                                                   int                 ldab,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              double*             AB,
+                                                              int                 ldab,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   double*             AB,
+                                                   int                 ldab,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              hipsolverComplex*   AB,
+                                                              int                 ldab,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   hipsolverComplex*   AB,
+                                                   int                 ldab,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrf_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              int                     kd,
+                                                              hipsolverDoubleComplex* AB,
+                                                              int                     ldab,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrf(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     kd,
+                                                   hipsolverDoubleComplex* AB,
+                                                   int                     ldab,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// pbtrs: solves A * X = B with the Cholesky factorization of the band matrix A computed by
+// pbtrf. B is overwritten with X.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              int                 nrhs,
+                                                              float*              AB,
+                                                              int                 ldab,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   int                 nrhs,
+                                                   float*              AB,
+                                                   int                 ldab,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              int                 nrhs,
+                                                              double*             AB,
+                                                              int                 ldab,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   int                 nrhs,
+                                                   double*             AB,
+                                                   int                 ldab,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 kd,
+                                                              int                 nrhs,
+                                                              hipsolverComplex*   AB,
+                                                              int                 ldab,
+                                                              hipsolverComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 kd,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   AB,
+                                                   int                 ldab,
+                                                   hipsolverComplex*   B,
+                                                   int                 ldb,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrs_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              int                     kd,
+                                                              int                     nrhs,
+                                                              hipsolverDoubleComplex* AB,
+                                                              int                     ldab,
+                                                              hipsolverDoubleComplex* B,
+                                                              int                     ldb,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpbtrs(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     kd,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* AB,
+                                                   int                     ldab,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// pbtrf_strided_batched: pbtrf for a batch of batch_count band matrices, strideAB apart.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             float*              AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 float*              AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             double*             AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 double*             AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpbtrfStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             hipsolverComplex*   AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrfStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 hipsolverComplex*   AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrfStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             int                     kd,
+                                             hipsolverDoubleComplex* AB,
+                                             int                     ldab,
+                                             int                     strideAB,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrfStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  int                     kd,
+                                  hipsolverDoubleComplex* AB,
+                                  int                     ldab,
+                                  int                     strideAB,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// pbtrs_strided_batched: pbtrs for a batch of batch_count systems.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             float*              AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             float*              B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 int                 nrhs,
+                                                                 float*              AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             double*             AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             double*             B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 int                 nrhs,
+                                                                 double*             AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpbtrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             hipsolverComplex*   AB,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             hipsolverComplex*   B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpbtrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 kd,
+                                                                 int                 nrhs,
+                                                                 hipsolverComplex*   AB,
+                                                                 int                 ldab,
+                                                                 int                 strideAB,
+                                                                 hipsolverComplex*   B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrsStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             int                     kd,
+                                             int                     nrhs,
+                                             hipsolverDoubleComplex* AB,
+                                             int                     ldab,
+                                             int                     strideAB,
+                                             hipsolverDoubleComplex* B,
+                                             int                     ldb,
+                                             int                     strideB,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpbtrsStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  int                     kd,
+                                  int                     nrhs,
+                                  hipsolverDoubleComplex* AB,
+                                  int                     ldab,
+                                  int                     strideAB,
+                                  hipsolverDoubleComplex* B,
+                                  int                     ldb,
+                                  int                     strideB,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// potrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipsolverComplex*   A,
+                                                              int                 lda,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// potrf_64
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_64_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 float*              A,
+                                                                 int64_t             lda,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf_64_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 double*             A,
+                                                                 int64_t             lda,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf_64_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 hipsolverComplex*   A,
+                                                                 int64_t             lda,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf_64_bufferSize(hipsolverHandle_t       handle,
+                                                                 hipsolverFillMode_t     uplo,
+                                                                 int64_t                 n,
+                                                                 hipsolverDoubleComplex* A,
+                                                                 int64_t                 lda,
+                                                                 size_t*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_64(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      float*              A,
+                                                      int64_t             lda,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrf_64(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      double*             A,
+                                                      int64_t             lda,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrf_64(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      hipsolverComplex*   A,
+                                                      int64_t             lda,
+                                                      hipsolverComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf_64(hipsolverHandle_t       handle,
+                                                      hipsolverFillMode_t     uplo,
+                                                      int64_t                 n,
+                                                      hipsolverDoubleComplex* A,
+                                                      int64_t                 lda,
+                                                      hipsolverDoubleComplex* work,
+                                                      size_t                  lwork,
+                                                      int*                    devInfo);
+
+// potrf_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
+                                                                     hipsolverFillMode_t uplo,
+                                                                     int                 n,
+                                                                     float*              A[],
+                                                                     int                 lda,
+                                                                     int*                lwork,
+                                                                     int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfBatched_bufferSize(hipsolverHandle_t   handle,
                                                                      hipsolverFillMode_t uplo,
                                                                      int                 n,
                                                                      double*             A[],
@@ -1144,11 +7638,1110 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfBatched(hipsolverHandle_t   ha
                                                           int*                devInfo,
                                                           int                 batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t       handle,
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t       handle,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// potrf_interleaved_batched: A is in the interleaved layout. On AMD, real matrices of order up to
+// 32 are factorized in place; otherwise the batch is converted to the strided layout in the
+// workspace and factorized by potrfBatched. On AMD, work may be null, and the workspace is then
+// taken from the handle.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfInterleavedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int*                lwork,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfInterleavedBatched(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      float*              A,
+                                      int                 lda,
+                                      float*              work,
+                                      int                 lwork,
+                                      int*                devInfo,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfInterleavedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int*                lwork,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfInterleavedBatched(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      double*             A,
+                                      int                 lda,
+                                      double*             work,
+                                      int                 lwork,
+                                      int*                devInfo,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfInterleavedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 int*                lwork,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfInterleavedBatched(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipsolverComplex*   A,
+                                      int                 lda,
+                                      hipsolverComplex*   work,
+                                      int                 lwork,
+                                      int*                devInfo,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfInterleavedBatched_bufferSize(hipsolverHandle_t       handle,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int*                    lwork,
+                                                 int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfInterleavedBatched(hipsolverHandle_t       handle,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A,
+                                      int                     lda,
+                                      hipsolverDoubleComplex* work,
+                                      int                     lwork,
+                                      int*                    devInfo,
+                                      int                     batch_count);
+
+// potrf_vbatched: n and lda are device arrays of the orders and leading dimensions of the
+// batch_count matrices, which may all differ. A matrix of invalid sizes is not factorized, and
+// devInfo[b] is set to -2 if its order is negative, or to -4 if its leading dimension is smaller
+// than max(1, n[b]).
+// On AMD, the batch is solved by a single kernel, one block per matrix, without reading back the
+// sizes, and the workspace only depends on batch_count. Otherwise, or if hipSOLVER was built
+// without a HIP compiler, the sizes are copied to the host, which synchronizes with the stream of
+// the handle, and the matrices of equal shapes are solved together by one batched call.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                       hipsolverFillMode_t uplo,
+                                       const int*          n,
+                                       float*              A[],
+                                       const int*          lda,
+                                       int*                lwork,
+                                       int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           float*              A[],
+                                                           const int*          lda,
+                                                           float*              work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                       hipsolverFillMode_t uplo,
+                                       const int*          n,
+                                       double*             A[],
+                                       const int*          lda,
+                                       int*                lwork,
+                                       int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           double*             A[],
+                                                           const int*          lda,
+                                                           double*             work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfVbatched_bufferSize(hipsolverHandle_t   handle,
+                                       hipsolverFillMode_t uplo,
+                                       const int*          n,
+                                       hipsolverComplex*   A[],
+                                       const int*          lda,
+                                       int*                lwork,
+                                       int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfVbatched(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           const int*          n,
+                                                           hipsolverComplex*   A[],
+                                                           const int*          lda,
+                                                           hipsolverComplex*   work,
+                                                           int                 lwork,
+                                                           int*                devInfo,
+                                                           int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfVbatched_bufferSize(hipsolverHandle_t       handle,
+                                       hipsolverFillMode_t     uplo,
+                                       const int*              n,
+                                       hipsolverDoubleComplex* A[],
+                                       const int*              lda,
+                                       int*                    lwork,
+                                       int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfVbatched(hipsolverHandle_t       handle,
+                                                           hipsolverFillMode_t     uplo,
+                                                           const int*              n,
+                                                           hipsolverDoubleComplex* A[],
+                                                           const int*              lda,
+                                                           hipsolverDoubleComplex* work,
+                                                           int                     lwork,
+                                                           int*                    devInfo,
+                                                           int                     batch_count);
+
+// potrf_out_of_core: A is in host memory, and the factorization uses at most deviceMemory bytes
+// of device memory. The call returns once A and info are written.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            size_t              deviceMemory,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            size_t              deviceMemory,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfOutOfCore(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            size_t              deviceMemory,
+                                                            int*                info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfOutOfCore(hipsolverHandle_t       handle,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            size_t                  deviceMemory,
+                                                            int*                    info);
+
+// potrf_update: A holds the Cholesky factor of uplo, which is overwritten with the factor of
+// A + V * V^H (Update) or A - V * V^H (Downdate), where V is n-by-k and is overwritten. The
+// call synchronizes with the stream of handle. The bufferSize functions serve both.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 k,
+                                                                    float*              A,
+                                                                    int                 lda,
+                                                                    float*              V,
+                                                                    int                 ldv,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdate(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 k,
+                                                         float*              A,
+                                                         int                 lda,
+                                                         float*              V,
+                                                         int                 ldv,
+                                                         float*              work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfDowndate(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           float*              A,
+                                                           int                 lda,
+                                                           float*              V,
+                                                           int                 ldv,
+                                                           float*              work,
+                                                           int                 lwork,
+                                                           int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 k,
+                                                                    double*             A,
+                                                                    int                 lda,
+                                                                    double*             V,
+                                                                    int                 ldv,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdate(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 k,
+                                                         double*             A,
+                                                         int                 lda,
+                                                         double*             V,
+                                                         int                 ldv,
+                                                         double*             work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfDowndate(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           double*             A,
+                                                           int                 lda,
+                                                           double*             V,
+                                                           int                 ldv,
+                                                           double*             work,
+                                                           int                 lwork,
+                                                           int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdate_bufferSize(hipsolverHandle_t   handle,
+                                                                    hipsolverFillMode_t uplo,
+                                                                    int                 n,
+                                                                    int                 k,
+                                                                    hipsolverComplex*   A,
+                                                                    int                 lda,
+                                                                    hipsolverComplex*   V,
+                                                                    int                 ldv,
+                                                                    int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdate(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 k,
+                                                         hipsolverComplex*   A,
+                                                         int                 lda,
+                                                         hipsolverComplex*   V,
+                                                         int                 ldv,
+                                                         hipsolverComplex*   work,
+                                                         int                 lwork,
+                                                         int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfDowndate(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           int                 k,
+                                                           hipsolverComplex*   A,
+                                                           int                 lda,
+                                                           hipsolverComplex*   V,
+                                                           int                 ldv,
+                                                           hipsolverComplex*   work,
+                                                           int                 lwork,
+                                                           int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfUpdate_bufferSize(hipsolverHandle_t       handle,
+                                                                    hipsolverFillMode_t     uplo,
+                                                                    int                     n,
+                                                                    int                     k,
+                                                                    hipsolverDoubleComplex* A,
+                                                                    int                     lda,
+                                                                    hipsolverDoubleComplex* V,
+                                                                    int                     ldv,
+                                                                    int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfUpdate(hipsolverHandle_t       handle,
+                                                         hipsolverFillMode_t     uplo,
+                                                         int                     n,
+                                                         int                     k,
+                                                         hipsolverDoubleComplex* A,
+                                                         int                     lda,
+                                                         hipsolverDoubleComplex* V,
+                                                         int                     ldv,
+                                                         hipsolverDoubleComplex* work,
+                                                         int                     lwork,
+                                                         int*                    devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfDowndate(hipsolverHandle_t       handle,
+                                                           hipsolverFillMode_t     uplo,
+                                                           int                     n,
+                                                           int                     k,
+                                                           hipsolverDoubleComplex* A,
+                                                           int                     lda,
+                                                           hipsolverDoubleComplex* V,
+                                                           int                     ldv,
+                                                           hipsolverDoubleComplex* work,
+                                                           int                     lwork,
+                                                           int*                    devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            float*              A[],
+                                            int                 lda,
+                                            float*              V[],
+                                            int                 ldv,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                float*              A[],
+                                                                int                 lda,
+                                                                float*              V[],
+                                                                int                 ldv,
+                                                                float*              work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  float*              A[],
+                                                                  int                 lda,
+                                                                  float*              V[],
+                                                                  int                 ldv,
+                                                                  float*              work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            double*             A[],
+                                            int                 lda,
+                                            double*             V[],
+                                            int                 ldv,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                double*             A[],
+                                                                int                 lda,
+                                                                double*             V[],
+                                                                int                 ldv,
+                                                                double*             work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  double*             A[],
+                                                                  int                 lda,
+                                                                  double*             V[],
+                                                                  int                 ldv,
+                                                                  double*             work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfUpdateBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 k,
+                                            hipsolverComplex*   A[],
+                                            int                 lda,
+                                            hipsolverComplex*   V[],
+                                            int                 ldv,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfUpdateBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 k,
+                                                                hipsolverComplex*   A[],
+                                                                int                 lda,
+                                                                hipsolverComplex*   V[],
+                                                                int                 ldv,
+                                                                hipsolverComplex*   work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfDowndateBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  int                 k,
+                                                                  hipsolverComplex*   A[],
+                                                                  int                 lda,
+                                                                  hipsolverComplex*   V[],
+                                                                  int                 ldv,
+                                                                  hipsolverComplex*   work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateBatched_bufferSize(hipsolverHandle_t       handle,
+                                            hipsolverFillMode_t     uplo,
+                                            int                     n,
+                                            int                     k,
+                                            hipsolverDoubleComplex* A[],
+                                            int                     lda,
+                                            hipsolverDoubleComplex* V[],
+                                            int                     ldv,
+                                            int*                    lwork,
+                                            int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfUpdateBatched(hipsolverHandle_t       handle,
+                                 hipsolverFillMode_t     uplo,
+                                 int                     n,
+                                 int                     k,
+                                 hipsolverDoubleComplex* A[],
+                                 int                     lda,
+                                 hipsolverDoubleComplex* V[],
+                                 int                     ldv,
+                                 hipsolverDoubleComplex* work,
+                                 int                     lwork,
+                                 int*                    devInfo,
+                                 int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfDowndateBatched(hipsolverHandle_t       handle,
+                                   hipsolverFillMode_t     uplo,
+                                   int                     n,
+                                   int                     k,
+                                   hipsolverDoubleComplex* A[],
+                                   int                     lda,
+                                   hipsolverDoubleComplex* V[],
+                                   int                     ldv,
+                                   hipsolverDoubleComplex* work,
+                                   int                     lwork,
+                                   int*                    devInfo,
+                                   int                     batch_count);
+
+// qr_update: Q of m-by-n with orthonormal columns and R upper triangular of order n hold the
+// thin QR factorization of a matrix A, which is overwritten with the factorization of A with
+// column j inserted or deleted, or with row i inserted or deleted. Q and R must have room for
+// an inserted column or row, and the result must have full column rank. The functions do not
+// synchronize. The bufferSize functions serve all of them, with the sizes before the update.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSqrUpdate_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* Q, int ldq, float* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSqrInsertColumn(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            int               j,
+                                                            float*            Q,
+                                                            int               ldq,
+                                                            float*            R,
+                                                            int               ldr,
+                                                            float*            u,
+                                                            float*            work,
+                                                            int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSqrDeleteColumn(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            int               j,
+                                                            float*            Q,
+                                                            int               ldq,
+                                                            float*            R,
+                                                            int               ldr,
+                                                            float*            work,
+                                                            int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSqrInsertRow(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         int               i,
+                                                         float*            Q,
+                                                         int               ldq,
+                                                         float*            R,
+                                                         int               ldr,
+                                                         float*            v,
+                                                         float*            work,
+                                                         int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSqrDeleteRow(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         int               i,
+                                                         float*            Q,
+                                                         int               ldq,
+                                                         float*            R,
+                                                         int               ldr,
+                                                         float*            work,
+                                                         int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDqrUpdate_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* Q, int ldq, double* R, int ldr, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDqrInsertColumn(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            int               j,
+                                                            double*           Q,
+                                                            int               ldq,
+                                                            double*           R,
+                                                            int               ldr,
+                                                            double*           u,
+                                                            double*           work,
+                                                            int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDqrDeleteColumn(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            int               j,
+                                                            double*           Q,
+                                                            int               ldq,
+                                                            double*           R,
+                                                            int               ldr,
+                                                            double*           work,
+                                                            int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDqrInsertRow(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         int               i,
+                                                         double*           Q,
+                                                         int               ldq,
+                                                         double*           R,
+                                                         int               ldr,
+                                                         double*           v,
+                                                         double*           work,
+                                                         int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDqrDeleteRow(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         int               i,
+                                                         double*           Q,
+                                                         int               ldq,
+                                                         double*           R,
+                                                         int               ldr,
+                                                         double*           work,
+                                                         int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCqrUpdate_bufferSize(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipsolverComplex* Q,
+                                                                 int               ldq,
+                                                                 hipsolverComplex* R,
+                                                                 int               ldr,
+                                                                 int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCqrInsertColumn(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            int               j,
+                                                            hipsolverComplex* Q,
+                                                            int               ldq,
+                                                            hipsolverComplex* R,
+                                                            int               ldr,
+                                                            hipsolverComplex* u,
+                                                            hipsolverComplex* work,
+                                                            int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCqrDeleteColumn(hipsolverHandle_t handle,
+                                                            int               m,
+                                                            int               n,
+                                                            int               j,
+                                                            hipsolverComplex* Q,
+                                                            int               ldq,
+                                                            hipsolverComplex* R,
+                                                            int               ldr,
+                                                            hipsolverComplex* work,
+                                                            int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCqrInsertRow(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         int               i,
+                                                         hipsolverComplex* Q,
+                                                         int               ldq,
+                                                         hipsolverComplex* R,
+                                                         int               ldr,
+                                                         hipsolverComplex* v,
+                                                         hipsolverComplex* work,
+                                                         int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCqrDeleteRow(hipsolverHandle_t handle,
+                                                         int               m,
+                                                         int               n,
+                                                         int               i,
+                                                         hipsolverComplex* Q,
+                                                         int               ldq,
+                                                         hipsolverComplex* R,
+                                                         int               ldr,
+                                                         hipsolverComplex* work,
+                                                         int               lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZqrUpdate_bufferSize(hipsolverHandle_t       handle,
+                                                                 int                     m,
+                                                                 int                     n,
+                                                                 hipsolverDoubleComplex* Q,
+                                                                 int                     ldq,
+                                                                 hipsolverDoubleComplex* R,
+                                                                 int                     ldr,
+                                                                 int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZqrInsertColumn(hipsolverHandle_t       handle,
+                                                            int                     m,
+                                                            int                     n,
+                                                            int                     j,
+                                                            hipsolverDoubleComplex* Q,
+                                                            int                     ldq,
+                                                            hipsolverDoubleComplex* R,
+                                                            int                     ldr,
+                                                            hipsolverDoubleComplex* u,
+                                                            hipsolverDoubleComplex* work,
+                                                            int                     lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZqrDeleteColumn(hipsolverHandle_t       handle,
+                                                            int                     m,
+                                                            int                     n,
+                                                            int                     j,
+                                                            hipsolverDoubleComplex* Q,
+                                                            int                     ldq,
+                                                            hipsolverDoubleComplex* R,
+                                                            int                     ldr,
+                                                            hipsolverDoubleComplex* work,
+                                                            int                     lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZqrInsertRow(hipsolverHandle_t       handle,
+                                                         int                     m,
+                                                         int                     n,
+                                                         int                     i,
+                                                         hipsolverDoubleComplex* Q,
+                                                         int                     ldq,
+                                                         hipsolverDoubleComplex* R,
+                                                         int                     ldr,
+                                                         hipsolverDoubleComplex* v,
+                                                         hipsolverDoubleComplex* work,
+                                                         int                     lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZqrDeleteRow(hipsolverHandle_t       handle,
+                                                         int                     m,
+                                                         int                     n,
+                                                         int                     i,
+                                                         hipsolverDoubleComplex* Q,
+                                                         int                     ldq,
+                                                         hipsolverDoubleComplex* R,
+                                                         int                     ldr,
+                                                         hipsolverDoubleComplex* work,
+                                                         int                     lwork);
+
+// pocon: A holds the Cholesky factor of uplo computed by potrf, and rcond is set to an
+// estimate of the reciprocal condition number of A in the 1-norm, given the 1-norm anorm of A
+// before factorization. anorm and rcond are in host memory, and the call synchronizes with the
+// stream of handle.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpocon_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpocon(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float               anorm,
+                                                   float*              rcond,
+                                                   float*              work,
+                                                   int                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpoconBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      float*              A[],
+                                      int                 lda,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpoconBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          const float*        anorm,
+                                                          float*              rcond,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpocon_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpocon(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double              anorm,
+                                                   double*             rcond,
+                                                   double*             work,
+                                                   int                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpoconBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      double*             A[],
+                                      int                 lda,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpoconBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          const double*       anorm,
+                                                          double*             rcond,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpocon_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipsolverComplex*   A,
+                                                              int                 lda,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpocon(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   float               anorm,
+                                                   float*              rcond,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpoconBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipsolverComplex*   A[],
+                                      int                 lda,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpoconBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          const float*        anorm,
+                                                          float*              rcond,
+                                                          hipsolverComplex*   work,
+                                                          int                 lwork,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpocon_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpocon(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   double                  anorm,
+                                                   double*                 rcond,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpoconBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpoconBatched(hipsolverHandle_t       handle,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          const double*           anorm,
+                                                          double*                 rcond,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int                     batch_count);
+
+// potri
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotri_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotri_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              hipsolverComplex*   A,
+                                                              int                 lda,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotri_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotri(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotri(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotri(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// potrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipsolverComplex*   A,
+                                                              int                 lda,
+                                                              hipsolverComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrs_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              int                     nrhs,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              hipsolverDoubleComplex* B,
+                                                              int                     ldb,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   hipsolverComplex*   B,
+                                                   int                 ldb,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// potrs_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      int                 nrhs,
+                                      float*              A[],
+                                      int                 lda,
+                                      float*              B[],
+                                      int                 ldb,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      int                 nrhs,
+                                      double*             A[],
+                                      int                 lda,
+                                      double*             B[],
+                                      int                 ldb,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrsBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      int                 nrhs,
+                                      hipsolverComplex*   A[],
+                                      int                 lda,
+                                      hipsolverComplex*   B[],
+                                      int                 ldb,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrsBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      int                     nrhs,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      hipsolverDoubleComplex* B[],
+                                      int                     ldb,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              B[],
+                                                          int                 ldb,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             B[],
+                                                          int                 ldb,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          int                 nrhs,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          hipsolverComplex*   B[],
+                                                          int                 ldb,
+                                                          hipsolverComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t       handle,
                                                           hipsolverFillMode_t     uplo,
                                                           int                     n,
+                                                          int                     nrhs,
                                                           hipsolverDoubleComplex* A[],
                                                           int                     lda,
+                                                          hipsolverDoubleComplex* B[],
+                                                          int                     ldb,
                                                           hipsolverDoubleComplex* work,
                                                           int                     lwork,
                                                           int*                    devInfo,
@@ -1235,6 +8828,743 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// syevd_64/heevd_64
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_64_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 float*              A,
+                                                                 int64_t             lda,
+                                                                 float*              D,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevd_64_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 double*             A,
+                                                                 int64_t             lda,
+                                                                 double*             D,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevd_64_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 hipsolverComplex*   A,
+                                                                 int64_t             lda,
+                                                                 float*              D,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd_64_bufferSize(hipsolverHandle_t       handle,
+                                                                 hipsolverEigMode_t      jobz,
+                                                                 hipsolverFillMode_t     uplo,
+                                                                 int64_t                 n,
+                                                                 hipsolverDoubleComplex* A,
+                                                                 int64_t                 lda,
+                                                                 double*                 D,
+                                                                 size_t*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_64(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      float*              A,
+                                                      int64_t             lda,
+                                                      float*              D,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevd_64(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      double*             A,
+                                                      int64_t             lda,
+                                                      double*             D,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevd_64(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      hipsolverComplex*   A,
+                                                      int64_t             lda,
+                                                      float*              D,
+                                                      hipsolverComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd_64(hipsolverHandle_t       handle,
+                                                      hipsolverEigMode_t      jobz,
+                                                      hipsolverFillMode_t     uplo,
+                                                      int64_t                 n,
+                                                      hipsolverDoubleComplex* A,
+                                                      int64_t                 lda,
+                                                      double*                 D,
+                                                      hipsolverDoubleComplex* work,
+                                                      size_t                  lwork,
+                                                      int*                    devInfo);
+
+// syevd_batched/heevd_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverEigMode_t  jobz,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      float*              A[],
+                                      int                 lda,
+                                      float*              D,
+                                      int                 strideD,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverEigMode_t  jobz,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      double*             A[],
+                                      int                 lda,
+                                      double*             D,
+                                      int                 strideD,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverEigMode_t  jobz,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipsolverComplex*   A[],
+                                      int                 lda,
+                                      float*              D,
+                                      int                 strideD,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverEigMode_t      jobz,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      double*                 D,
+                                      int                     strideD,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdBatched(hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              D,
+                                                          int                 strideD,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdBatched(hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             D,
+                                                          int                 strideD,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdBatched(hipsolverHandle_t   handle,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          float*              D,
+                                                          int                 strideD,
+                                                          hipsolverComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdBatched(hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          double*                 D,
+                                                          int                     strideD,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// syevd_strided_batched/heevd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverEigMode_t      jobz,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             double*                 D,
+                                             int                     strideD,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             D,
+                                                                 int                 strideD,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipsolverComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverEigMode_t      jobz,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  double*                 D,
+                                  int                     strideD,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// syevdx/heevdx
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdx_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverEigRange_t range,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               float*              A,
+                                                               int                 lda,
+                                                               float               vl,
+                                                               float               vu,
+                                                               int                 il,
+                                                               int                 iu,
+                                                               int*                nev,
+                                                               float*              W,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdx_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverEigRange_t range,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               double*             A,
+                                                               int                 lda,
+                                                               double              vl,
+                                                               double              vu,
+                                                               int                 il,
+                                                               int                 iu,
+                                                               int*                nev,
+                                                               double*             W,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdx_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverEigRange_t range,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               hipsolverComplex*   A,
+                                                               int                 lda,
+                                                               float               vl,
+                                                               float               vu,
+                                                               int                 il,
+                                                               int                 iu,
+                                                               int*                nev,
+                                                               float*              W,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdx_bufferSize(hipsolverHandle_t       handle,
+                                                               hipsolverEigMode_t      jobz,
+                                                               hipsolverEigRange_t     range,
+                                                               hipsolverFillMode_t     uplo,
+                                                               int                     n,
+                                                               hipsolverDoubleComplex* A,
+                                                               int                     lda,
+                                                               double                  vl,
+                                                               double                  vu,
+                                                               int                     il,
+                                                               int                     iu,
+                                                               int*                    nev,
+                                                               double*                 W,
+                                                               int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdx(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverEigRange_t range,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float               vl,
+                                                    float               vu,
+                                                    int                 il,
+                                                    int                 iu,
+                                                    int*                nev,
+                                                    float*              W,
+                                                    float*              work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdx(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverEigRange_t range,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double              vl,
+                                                    double              vu,
+                                                    int                 il,
+                                                    int                 iu,
+                                                    int*                nev,
+                                                    double*             W,
+                                                    double*             work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdx(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverEigRange_t range,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    float               vl,
+                                                    float               vu,
+                                                    int                 il,
+                                                    int                 iu,
+                                                    int*                nev,
+                                                    float*              W,
+                                                    hipsolverComplex*   work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdx(hipsolverHandle_t       handle,
+                                                    hipsolverEigMode_t      jobz,
+                                                    hipsolverEigRange_t     range,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    double                  vl,
+                                                    double                  vu,
+                                                    int                     il,
+                                                    int                     iu,
+                                                    int*                    nev,
+                                                    double*                 W,
+                                                    hipsolverDoubleComplex* work,
+                                                    int                     lwork,
+                                                    int*                    devInfo);
+
+// syevj/heevj
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateSyevjInfo(hipsolverSyevjInfo_t* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDestroySyevjInfo(hipsolverSyevjInfo_t info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjSetTolerance(
+    hipsolverSyevjInfo_t info, double tolerance);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjSetMaxSweeps(
+    hipsolverSyevjInfo_t info, int max_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjSetSortEig(
+    hipsolverSyevjInfo_t info, int sort_eig);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetResidual(
+    hipsolverHandle_t handle, hipsolverSyevjInfo_t info, double* residual);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetSweeps(
+    hipsolverHandle_t handle, hipsolverSyevjInfo_t info, int* executed_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevj_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverEigMode_t   jobz,
+                                                              hipsolverFillMode_t  uplo,
+                                                              int                  n,
+                                                              float*               A,
+                                                              int                  lda,
+                                                              float*               W,
+                                                              int*                 lwork,
+                                                              hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevj_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverEigMode_t   jobz,
+                                                              hipsolverFillMode_t  uplo,
+                                                              int                  n,
+                                                              double*              A,
+                                                              int                  lda,
+                                                              double*              W,
+                                                              int*                 lwork,
+                                                              hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevj_bufferSize(hipsolverHandle_t    handle,
+                                                              hipsolverEigMode_t   jobz,
+                                                              hipsolverFillMode_t  uplo,
+                                                              int                  n,
+                                                              hipsolverComplex*    A,
+                                                              int                  lda,
+                                                              float*               W,
+                                                              int*                 lwork,
+                                                              hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevj_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverEigMode_t      jobz,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              double*                 W,
+                                                              int*                    lwork,
+                                                              hipsolverSyevjInfo_t    params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevj(hipsolverHandle_t    handle,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   float*               A,
+                                                   int                  lda,
+                                                   float*               W,
+                                                   float*               work,
+                                                   int                  lwork,
+                                                   int*                 devInfo,
+                                                   hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevj(hipsolverHandle_t    handle,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   double*              A,
+                                                   int                  lda,
+                                                   double*              W,
+                                                   double*              work,
+                                                   int                  lwork,
+                                                   int*                 devInfo,
+                                                   hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevj(hipsolverHandle_t    handle,
+                                                   hipsolverEigMode_t   jobz,
+                                                   hipsolverFillMode_t  uplo,
+                                                   int                  n,
+                                                   hipsolverComplex*    A,
+                                                   int                  lda,
+                                                   float*               W,
+                                                   hipsolverComplex*    work,
+                                                   int                  lwork,
+                                                   int*                 devInfo,
+                                                   hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevj(hipsolverHandle_t       handle,
+                                                   hipsolverEigMode_t      jobz,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   double*                 W,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo,
+                                                   hipsolverSyevjInfo_t    params);
+
+// syevj_batched/heevj_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevjBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverEigMode_t   jobz,
+                                      hipsolverFillMode_t  uplo,
+                                      int                  n,
+                                      float*               A,
+                                      int                  lda,
+                                      float*               W,
+                                      int*                 lwork,
+                                      hipsolverSyevjInfo_t params,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevjBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverEigMode_t   jobz,
+                                      hipsolverFillMode_t  uplo,
+                                      int                  n,
+                                      double*              A,
+                                      int                  lda,
+                                      double*              W,
+                                      int*                 lwork,
+                                      hipsolverSyevjInfo_t params,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevjBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverEigMode_t   jobz,
+                                      hipsolverFillMode_t  uplo,
+                                      int                  n,
+                                      hipsolverComplex*    A,
+                                      int                  lda,
+                                      float*               W,
+                                      int*                 lwork,
+                                      hipsolverSyevjInfo_t params,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverEigMode_t      jobz,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A,
+                                      int                     lda,
+                                      double*                 W,
+                                      int*                    lwork,
+                                      hipsolverSyevjInfo_t    params,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjBatched(hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          float*               W,
+                                                          float*               work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjBatched(hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          double*              W,
+                                                          double*              work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjBatched(hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          float*               W,
+                                                          hipsolverComplex*    work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjBatched(hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          double*                 W,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          hipsolverSyevjInfo_t    params,
+                                                          int                     batch_count);
+
+// syevj_interleaved_batched/heevj_interleaved_batched: A and W are in the interleaved layout.
+// The batch is converted to the strided layout in the workspace and solved by syevjBatched. On
+// AMD, work may be null, and the workspace is then taken from the handle.
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevjInterleavedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                 hipsolverEigMode_t   jobz,
+                                                 hipsolverFillMode_t  uplo,
+                                                 int                  n,
+                                                 float*               A,
+                                                 int                  lda,
+                                                 float*               W,
+                                                 int*                 lwork,
+                                                 hipsolverSyevjInfo_t params,
+                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevjInterleavedBatched(hipsolverHandle_t    handle,
+                                      hipsolverEigMode_t   jobz,
+                                      hipsolverFillMode_t  uplo,
+                                      int                  n,
+                                      float*               A,
+                                      int                  lda,
+                                      float*               W,
+                                      float*               work,
+                                      int                  lwork,
+                                      int*                 devInfo,
+                                      hipsolverSyevjInfo_t params,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevjInterleavedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                 hipsolverEigMode_t   jobz,
+                                                 hipsolverFillMode_t  uplo,
+                                                 int                  n,
+                                                 double*              A,
+                                                 int                  lda,
+                                                 double*              W,
+                                                 int*                 lwork,
+                                                 hipsolverSyevjInfo_t params,
+                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevjInterleavedBatched(hipsolverHandle_t    handle,
+                                      hipsolverEigMode_t   jobz,
+                                      hipsolverFillMode_t  uplo,
+                                      int                  n,
+                                      double*              A,
+                                      int                  lda,
+                                      double*              W,
+                                      double*              work,
+                                      int                  lwork,
+                                      int*                 devInfo,
+                                      hipsolverSyevjInfo_t params,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevjInterleavedBatched_bufferSize(hipsolverHandle_t    handle,
+                                                 hipsolverEigMode_t   jobz,
+                                                 hipsolverFillMode_t  uplo,
+                                                 int                  n,
+                                                 hipsolverComplex*    A,
+                                                 int                  lda,
+                                                 float*               W,
+                                                 int*                 lwork,
+                                                 hipsolverSyevjInfo_t params,
+                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevjInterleavedBatched(hipsolverHandle_t    handle,
+                                      hipsolverEigMode_t   jobz,
+                                      hipsolverFillMode_t  uplo,
+                                      int                  n,
+                                      hipsolverComplex*    A,
+                                      int                  lda,
+                                      float*               W,
+                                      hipsolverComplex*    work,
+                                      int                  lwork,
+                                      int*                 devInfo,
+                                      hipsolverSyevjInfo_t params,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjInterleavedBatched_bufferSize(hipsolverHandle_t       handle,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 double*                 W,
+                                                 int*                    lwork,
+                                                 hipsolverSyevjInfo_t    params,
+                                                 int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjInterleavedBatched(hipsolverHandle_t       handle,
+                                      hipsolverEigMode_t      jobz,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A,
+                                      int                     lda,
+                                      double*                 W,
+                                      hipsolverDoubleComplex* work,
+                                      int                     lwork,
+                                      int*                    devInfo,
+                                      hipsolverSyevjInfo_t    params,
+                                      int                     batch_count);
+
 // sygvd/hegvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverEigType_t  itype,
@@ -1340,6 +9670,446 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// sygvd_strided_batched/hegvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             float*              D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             double*             D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             hipsolverComplex*   B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             float*              D,
+                                             int                 strideD,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverEigType_t      itype,
+                                             hipsolverEigMode_t      jobz,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             hipsolverDoubleComplex* B,
+                                             int                     ldb,
+                                             int                     strideB,
+                                             double*                 D,
+                                             int                     strideD,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 double*             D,
+                                                                 int                 strideD,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipsolverComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipsolverComplex*   B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverEigType_t      itype,
+                                  hipsolverEigMode_t      jobz,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  hipsolverDoubleComplex* B,
+                                  int                     ldb,
+                                  int                     strideB,
+                                  double*                 D,
+                                  int                     strideD,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// sygvd_factored/hegvd_factored: B holds its Cholesky factor, as computed by potrf
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdFactoredStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverEigType_t  itype,
+                                                     hipsolverEigMode_t  jobz,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     int                 strideA,
+                                                     float*              B,
+                                                     int                 ldb,
+                                                     int                 strideB,
+                                                     float*              D,
+                                                     int                 strideD,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdFactoredStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverEigType_t  itype,
+                                                     hipsolverEigMode_t  jobz,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     int                 strideA,
+                                                     double*             B,
+                                                     int                 ldb,
+                                                     int                 strideB,
+                                                     double*             D,
+                                                     int                 strideD,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdFactoredStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                                     hipsolverEigType_t  itype,
+                                                     hipsolverEigMode_t  jobz,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     hipsolverComplex*   A,
+                                                     int                 lda,
+                                                     int                 strideA,
+                                                     hipsolverComplex*   B,
+                                                     int                 ldb,
+                                                     int                 strideB,
+                                                     float*              D,
+                                                     int                 strideD,
+                                                     int*                lwork,
+                                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdFactoredStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                                     hipsolverEigType_t      itype,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     int                     strideA,
+                                                     hipsolverDoubleComplex* B,
+                                                     int                     ldb,
+                                                     int                     strideB,
+                                                     double*                 D,
+                                                     int                     strideD,
+                                                     int*                    lwork,
+                                                     int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdFactoredStridedBatched(hipsolverHandle_t   handle,
+                                          hipsolverEigType_t  itype,
+                                          hipsolverEigMode_t  jobz,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          float*              A,
+                                          int                 lda,
+                                          int                 strideA,
+                                          float*              B,
+                                          int                 ldb,
+                                          int                 strideB,
+                                          float*              D,
+                                          int                 strideD,
+                                          float*              work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdFactoredStridedBatched(hipsolverHandle_t   handle,
+                                          hipsolverEigType_t  itype,
+                                          hipsolverEigMode_t  jobz,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          double*             A,
+                                          int                 lda,
+                                          int                 strideA,
+                                          double*             B,
+                                          int                 ldb,
+                                          int                 strideB,
+                                          double*             D,
+                                          int                 strideD,
+                                          double*             work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdFactoredStridedBatched(hipsolverHandle_t   handle,
+                                          hipsolverEigType_t  itype,
+                                          hipsolverEigMode_t  jobz,
+                                          hipsolverFillMode_t uplo,
+                                          int                 n,
+                                          hipsolverComplex*   A,
+                                          int                 lda,
+                                          int                 strideA,
+                                          hipsolverComplex*   B,
+                                          int                 ldb,
+                                          int                 strideB,
+                                          float*              D,
+                                          int                 strideD,
+                                          hipsolverComplex*   work,
+                                          int                 lwork,
+                                          int*                devInfo,
+                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdFactoredStridedBatched(hipsolverHandle_t       handle,
+                                          hipsolverEigType_t      itype,
+                                          hipsolverEigMode_t      jobz,
+                                          hipsolverFillMode_t     uplo,
+                                          int                     n,
+                                          hipsolverDoubleComplex* A,
+                                          int                     lda,
+                                          int                     strideA,
+                                          hipsolverDoubleComplex* B,
+                                          int                     ldb,
+                                          int                     strideB,
+                                          double*                 D,
+                                          int                     strideD,
+                                          hipsolverDoubleComplex* work,
+                                          int                     lwork,
+                                          int*                    devInfo,
+                                          int                     batch_count);
+
+// sygvdx/hegvdx
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdx_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigType_t  itype,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverEigRange_t range,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               float*              A,
+                                                               int                 lda,
+                                                               float*              B,
+                                                               int                 ldb,
+                                                               float               vl,
+                                                               float               vu,
+                                                               int                 il,
+                                                               int                 iu,
+                                                               int*                nev,
+                                                               float*              W,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdx_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigType_t  itype,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverEigRange_t range,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               double*             A,
+                                                               int                 lda,
+                                                               double*             B,
+                                                               int                 ldb,
+                                                               double              vl,
+                                                               double              vu,
+                                                               int                 il,
+                                                               int                 iu,
+                                                               int*                nev,
+                                                               double*             W,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdx_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigType_t  itype,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverEigRange_t range,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               hipsolverComplex*   A,
+                                                               int                 lda,
+                                                               hipsolverComplex*   B,
+                                                               int                 ldb,
+                                                               float               vl,
+                                                               float               vu,
+                                                               int                 il,
+                                                               int                 iu,
+                                                               int*                nev,
+                                                               float*              W,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdx_bufferSize(hipsolverHandle_t       handle,
+                                                               hipsolverEigType_t      itype,
+                                                               hipsolverEigMode_t      jobz,
+                                                               hipsolverEigRange_t     range,
+                                                               hipsolverFillMode_t     uplo,
+                                                               int                     n,
+                                                               hipsolverDoubleComplex* A,
+                                                               int                     lda,
+                                                               hipsolverDoubleComplex* B,
+                                                               int                     ldb,
+                                                               double                  vl,
+                                                               double                  vu,
+                                                               int                     il,
+                                                               int                     iu,
+                                                               int*                    nev,
+                                                               double*                 W,
+                                                               int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdx(hipsolverHandle_t   handle,
+                                                    hipsolverEigType_t  itype,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverEigRange_t range,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    float               vl,
+                                                    float               vu,
+                                                    int                 il,
+                                                    int                 iu,
+                                                    int*                nev,
+                                                    float*              W,
+                                                    float*              work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdx(hipsolverHandle_t   handle,
+                                                    hipsolverEigType_t  itype,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverEigRange_t range,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    double              vl,
+                                                    double              vu,
+                                                    int                 il,
+                                                    int                 iu,
+                                                    int*                nev,
+                                                    double*             W,
+                                                    double*             work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdx(hipsolverHandle_t   handle,
+                                                    hipsolverEigType_t  itype,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverEigRange_t range,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    float               vl,
+                                                    float               vu,
+                                                    int                 il,
+                                                    int                 iu,
+                                                    int*                nev,
+                                                    float*              W,
+                                                    hipsolverComplex*   work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdx(hipsolverHandle_t       handle,
+                                                    hipsolverEigType_t      itype,
+                                                    hipsolverEigMode_t      jobz,
+                                                    hipsolverEigRange_t     range,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    double                  vl,
+                                                    double                  vu,
+                                                    int                     il,
+                                                    int                     iu,
+                                                    int*                    nev,
+                                                    double*                 W,
+                                                    hipsolverDoubleComplex* work,
+                                                    int                     lwork,
+                                                    int*                    devInfo);
+
 // sytrd/hetrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverFillMode_t uplo,
@@ -1429,6 +10199,478 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t       handl
                                                    int                     lwork,
                                                    int*                    devInfo);
 
+// sytrd_batched/hetrd_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrdBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      float*              A[],
+                                      int                 lda,
+                                      float*              D,
+                                      int                 strideD,
+                                      float*              E,
+                                      int                 strideE,
+                                      float*              tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrdBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      double*             A[],
+                                      int                 lda,
+                                      double*             D,
+                                      int                 strideD,
+                                      double*             E,
+                                      int                 strideE,
+                                      double*             tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChetrdBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipsolverComplex*   A[],
+                                      int                 lda,
+                                      float*              D,
+                                      int                 strideD,
+                                      float*              E,
+                                      int                 strideE,
+                                      hipsolverComplex*   tau,
+                                      int                 strideP,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhetrdBatched_bufferSize(hipsolverHandle_t       handle,
+                                      hipsolverFillMode_t     uplo,
+                                      int                     n,
+                                      hipsolverDoubleComplex* A[],
+                                      int                     lda,
+                                      double*                 D,
+                                      int                     strideD,
+                                      double*                 E,
+                                      int                     strideE,
+                                      hipsolverDoubleComplex* tau,
+                                      int                     strideP,
+                                      int*                    lwork,
+                                      int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrdBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              D,
+                                                          int                 strideD,
+                                                          float*              E,
+                                                          int                 strideE,
+                                                          float*              tau,
+                                                          int                 strideP,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrdBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             D,
+                                                          int                 strideD,
+                                                          double*             E,
+                                                          int                 strideE,
+                                                          double*             tau,
+                                                          int                 strideP,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChetrdBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A[],
+                                                          int                 lda,
+                                                          float*              D,
+                                                          int                 strideD,
+                                                          float*              E,
+                                                          int                 strideE,
+                                                          hipsolverComplex*   tau,
+                                                          int                 strideP,
+                                                          hipsolverComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrdBatched(hipsolverHandle_t       handle,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          double*                 D,
+                                                          int                     strideD,
+                                                          double*                 E,
+                                                          int                     strideE,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int                     strideP,
+                                                          hipsolverDoubleComplex* work,
+                                                          int                     lwork,
+                                                          int*                    devInfo,
+                                                          int                     batch_count);
+
+// sytrd_strided_batched/hetrd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              D,
+                                             int                 strideD,
+                                             float*              E,
+                                             int                 strideE,
+                                             float*              tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             D,
+                                             int                 strideD,
+                                             double*             E,
+                                             int                 strideE,
+                                             double*             tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChetrdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              D,
+                                             int                 strideD,
+                                             float*              E,
+                                             int                 strideE,
+                                             hipsolverComplex*   tau,
+                                             int                 strideP,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhetrdStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             int                     strideA,
+                                             double*                 D,
+                                             int                     strideD,
+                                             double*                 E,
+                                             int                     strideE,
+                                             hipsolverDoubleComplex* tau,
+                                             int                     strideP,
+                                             int*                    lwork,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 float*              E,
+                                                                 int                 strideE,
+                                                                 float*              tau,
+                                                                 int                 strideP,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             D,
+                                                                 int                 strideD,
+                                                                 double*             E,
+                                                                 int                 strideE,
+                                                                 double*             tau,
+                                                                 int                 strideP,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChetrdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipsolverComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              D,
+                                                                 int                 strideD,
+                                                                 float*              E,
+                                                                 int                 strideE,
+                                                                 hipsolverComplex*   tau,
+                                                                 int                 strideP,
+                                                                 hipsolverComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhetrdStridedBatched(hipsolverHandle_t       handle,
+                                  hipsolverFillMode_t     uplo,
+                                  int                     n,
+                                  hipsolverDoubleComplex* A,
+                                  int                     lda,
+                                  int                     strideA,
+                                  double*                 D,
+                                  int                     strideD,
+                                  double*                 E,
+                                  int                     strideE,
+                                  hipsolverDoubleComplex* tau,
+                                  int                     strideP,
+                                  hipsolverDoubleComplex* work,
+                                  int                     lwork,
+                                  int*                    devInfo,
+                                  int                     batch_count);
+
+// sytrd2: two-stage reduction of the symmetric matrix A to the tridiagonal matrix T with
+// diagonal D and off-diagonal E, through a band of half-bandwidth up to 32. The reduction to
+// the band is made of matrix-matrix products, which makes it faster than sytrd for large n,
+// and the band is reduced to tridiagonal form on the host, so the call synchronizes the
+// stream. If jobz is HIPSOLVER_EIG_MODE_VECTOR, A is overwritten by the orthogonal matrix Q
+// with A = Q * T * Q^T, formed with blocked reflectors; otherwise A is not modified. devInfo
+// is set to zero.
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrd2_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               float*              A,
+                                                               int                 lda,
+                                                               float*              D,
+                                                               float*              E,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrd2(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              D,
+                                                    float*              E,
+                                                    float*              work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrd2_bufferSize(hipsolverHandle_t   handle,
+                                                               hipsolverEigMode_t  jobz,
+                                                               hipsolverFillMode_t uplo,
+                                                               int                 n,
+                                                               double*             A,
+                                                               int                 lda,
+                                                               double*             D,
+                                                               double*             E,
+                                                               int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrd2(hipsolverHandle_t   handle,
+                                                    hipsolverEigMode_t  jobz,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             D,
+                                                    double*             E,
+                                                    double*             work,
+                                                    int                 lwork,
+                                                    int*                devInfo);
+
+// sytrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrf_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              float*            A,
+                                                              int               lda,
+                                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrf_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrf_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              hipsolverComplex* A,
+                                                              int               lda,
+                                                              int*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrf_bufferSize(hipsolverHandle_t       handle,
+                                                              int                     n,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrf(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int*                    ipiv,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
+// sytrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipsolverComplex*   A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              hipsolverComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t       handle,
+                                                              hipsolverFillMode_t     uplo,
+                                                              int                     n,
+                                                              int                     nrhs,
+                                                              hipsolverDoubleComplex* A,
+                                                              int                     lda,
+                                                              int*                    ipiv,
+                                                              hipsolverDoubleComplex* B,
+                                                              int                     ldb,
+                                                              int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   hipsolverComplex*   B,
+                                                   int                 ldb,
+                                                   hipsolverComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int*                    ipiv,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipsolverDoubleComplex* work,
+                                                   int                     lwork,
+                                                   int*                    devInfo);
+
 #ifdef __cplusplus
 }
 #endif
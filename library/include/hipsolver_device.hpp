@@ -0,0 +1,424 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief hipsolver_device.hpp provides header-only solvers for small matrices whose order is
+ *  known at compile time, to be called by one thread on its own matrix from device code.
+ *
+ *  The functions take column-major real matrices with compile-time leading dimensions. All
+ *  their loops have compile-time bounds and all their indices are compile-time constants once
+ *  the loops are unrolled, pivoting included, so a matrix held in a local array of the calling
+ *  thread stays in registers. A matrix in shared or global memory is used in place. There is no
+ *  workspace, and nothing is launched: a kernel that assembles a batch of small matrices can
+ *  factorize and solve them before writing anything back to global memory.
+ *
+ *  The functions can also be called from host code, and return the info of the corresponding
+ *  LAPACK function instead of writing it to memory.
+ */
+
+#ifndef HIPSOLVER_DEVICE_HPP
+#define HIPSOLVER_DEVICE_HPP
+
+#include "hipsolver.h"
+
+#if defined(__HIPCC__) && !defined(__CUDACC__)
+#include <hip/hip_runtime.h>
+#endif
+
+#include <cmath>
+#include <limits>
+
+#if defined(__HIPCC__) || defined(__CUDACC__)
+#define HIPSOLVER_DEVICE_FUNC __host__ __device__ inline
+#define HIPSOLVER_DEVICE_UNROLL _Pragma("unroll")
+#else
+#define HIPSOLVER_DEVICE_FUNC inline
+#define HIPSOLVER_DEVICE_UNROLL
+#endif
+
+namespace hipsolver
+{
+    namespace device
+    {
+        namespace detail
+        {
+            template <typename T>
+            HIPSOLVER_DEVICE_FUNC T sqrt(T x)
+            {
+                using std::sqrt;
+                return sqrt(x);
+            }
+
+            template <typename T>
+            HIPSOLVER_DEVICE_FUNC T abs(T x)
+            {
+                return x < 0 ? -x : x;
+            }
+
+            // applies the row interchanges of ipiv to the N-by-NRHS matrix B, in order if
+            // forward is true and in reverse order otherwise
+            template <typename T, int N, int NRHS, int LDB>
+            HIPSOLVER_DEVICE_FUNC void laswp(const int* ipiv, T* B, bool forward)
+            {
+                HIPSOLVER_DEVICE_UNROLL
+                for(int c = 0; c < NRHS; c++)
+                {
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int t = 0; t < N; t++)
+                    {
+                        int j = forward ? t : N - 1 - t;
+                        HIPSOLVER_DEVICE_UNROLL
+                        for(int i = j + 1; i < N; i++)
+                        {
+                            bool swap      = ipiv[j] == i + 1;
+                            T    x         = B[j + c * LDB];
+                            T    y         = B[i + c * LDB];
+                            B[j + c * LDB] = swap ? y : x;
+                            B[i + c * LDB] = swap ? x : y;
+                        }
+                    }
+                }
+            }
+        }
+
+        /*! \brief Cholesky factorization of the symmetric positive definite matrix A of order N.
+         *
+         *  Only the triangle uplo of A is read and written. Returns 0, or j if the leading minor
+         *  of order j is not positive definite, as the info of potrf.
+         */
+        template <typename T, int N, int LDA = N>
+        HIPSOLVER_DEVICE_FUNC int potrf(hipsolverFillMode_t uplo, T* A)
+        {
+            static_assert(N >= 0 && LDA >= N, "invalid order or leading dimension");
+            bool lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+
+            HIPSOLVER_DEVICE_UNROLL
+            for(int j = 0; j < N; j++)
+            {
+                // A(j, k) of the lower triangle is A(k, j) of the upper one
+                T d = A[j + j * LDA];
+                HIPSOLVER_DEVICE_UNROLL
+                for(int k = 0; k < j; k++)
+                {
+                    T a = lower ? A[j + k * LDA] : A[k + j * LDA];
+                    d -= a * a;
+                }
+                if(!(d > 0))
+                    return j + 1;
+
+                d              = detail::sqrt(d);
+                A[j + j * LDA] = d;
+                HIPSOLVER_DEVICE_UNROLL
+                for(int i = j + 1; i < N; i++)
+                {
+                    T& aij = lower ? A[i + j * LDA] : A[j + i * LDA];
+                    T  s   = aij;
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int k = 0; k < j; k++)
+                        s -= lower ? A[i + k * LDA] * A[j + k * LDA]
+                                   : A[k + i * LDA] * A[k + j * LDA];
+                    aij = s / d;
+                }
+            }
+            return 0;
+        }
+
+        /*! \brief LU factorization with partial pivoting of the M-by-N matrix A, or without
+         *  pivoting if ipiv is null.
+         *
+         *  ipiv holds the min(M, N) one-based pivots. Returns 0, or j if U(j, j) is the first
+         *  exactly zero pivot, in which case the factorization is completed, as the info of
+         *  getrf. The rows are swapped by selects on every candidate row, so that no index
+         *  depends on the pivots.
+         */
+        template <typename T, int M, int N = M, int LDA = M>
+        HIPSOLVER_DEVICE_FUNC int getrf(T* A, int* ipiv)
+        {
+            static_assert(M >= 0 && N >= 0 && LDA >= M, "invalid sizes or leading dimension");
+            constexpr int K    = M < N ? M : N;
+            int           info = 0;
+
+            HIPSOLVER_DEVICE_UNROLL
+            for(int j = 0; j < K; j++)
+            {
+                if(ipiv)
+                {
+                    int p    = j;
+                    T   best = detail::abs(A[j + j * LDA]);
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int i = j + 1; i < M; i++)
+                    {
+                        T a = detail::abs(A[i + j * LDA]);
+                        if(a > best)
+                        {
+                            best = a;
+                            p    = i;
+                        }
+                    }
+                    ipiv[j] = p + 1;
+
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int i = j + 1; i < M; i++)
+                    {
+                        HIPSOLVER_DEVICE_UNROLL
+                        for(int c = 0; c < N; c++)
+                        {
+                            T x            = A[j + c * LDA];
+                            T y            = A[i + c * LDA];
+                            A[j + c * LDA] = i == p ? y : x;
+                            A[i + c * LDA] = i == p ? x : y;
+                        }
+                    }
+                }
+
+                T d = A[j + j * LDA];
+                if(d != T(0))
+                {
+                    T r = T(1) / d;
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int i = j + 1; i < M; i++)
+                        A[i + j * LDA] *= r;
+                }
+                else if(info == 0)
+                    info = j + 1;
+
+                HIPSOLVER_DEVICE_UNROLL
+                for(int c = j + 1; c < N; c++)
+                {
+                    T a = A[j + c * LDA];
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int i = j + 1; i < M; i++)
+                        A[i + c * LDA] -= A[i + j * LDA] * a;
+                }
+            }
+            return info;
+        }
+
+        /*! \brief Solves op(A) * X = B for the N-by-NRHS matrix X, which overwrites B, where A
+         *  is the triangle uplo of a matrix of order N, with a unit diagonal if unit is true.
+         *
+         *  op(A) is A if trans is HIPSOLVER_OP_N, and its transpose otherwise.
+         */
+        template <typename T, int N, int NRHS, int LDA = N, int LDB = N>
+        HIPSOLVER_DEVICE_FUNC void trsm(hipsolverFillMode_t  uplo,
+                                        hipsolverOperation_t trans,
+                                        bool                 unit,
+                                        const T*             A,
+                                        T*                   B)
+        {
+            static_assert(N >= 0 && NRHS >= 0 && LDA >= N && LDB >= N,
+                          "invalid sizes or leading dimensions");
+
+            // op(A) is lower triangular if A is lower and not transposed, or upper and
+            // transposed, and op(A)(i, k) is read from A(k, i) when transposed
+            bool transposed = trans != HIPSOLVER_OP_N;
+            bool forward    = (uplo == HIPSOLVER_FILL_MODE_LOWER) != transposed;
+
+            HIPSOLVER_DEVICE_UNROLL
+            for(int c = 0; c < NRHS; c++)
+            {
+                T* x = B + c * LDB;
+                HIPSOLVER_DEVICE_UNROLL
+                for(int t = 0; t < N; t++)
+                {
+                    int i = forward ? t : N - 1 - t;
+                    T   s = x[i];
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int u = 0; u < t; u++)
+                    {
+                        int k = forward ? u : N - 1 - u;
+                        s -= (transposed ? A[k + i * LDA] : A[i + k * LDA]) * x[k];
+                    }
+                    x[i] = unit ? s : s / A[i + i * LDA];
+                }
+            }
+        }
+
+        /*! \brief Solves A * X = B with the Cholesky factor of A computed by potrf. */
+        template <typename T, int N, int NRHS, int LDA = N, int LDB = N>
+        HIPSOLVER_DEVICE_FUNC void potrs(hipsolverFillMode_t uplo, const T* A, T* B)
+        {
+            // A = L * L^T or U^T * U
+            bool lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+            trsm<T, N, NRHS, LDA, LDB>(uplo, lower ? HIPSOLVER_OP_N : HIPSOLVER_OP_T, false, A, B);
+            trsm<T, N, NRHS, LDA, LDB>(uplo, lower ? HIPSOLVER_OP_T : HIPSOLVER_OP_N, false, A, B);
+        }
+
+        /*! \brief Solves op(A) * X = B with the LU factors and pivots of A computed by getrf,
+         *  where ipiv is null if A was factorized without pivoting. */
+        template <typename T, int N, int NRHS, int LDA = N, int LDB = N>
+        HIPSOLVER_DEVICE_FUNC void
+            getrs(hipsolverOperation_t trans, const T* A, const int* ipiv, T* B)
+        {
+            // P * A = L * U, so A^T = U^T * L^T * P
+            if(trans == HIPSOLVER_OP_N)
+            {
+                if(ipiv)
+                    detail::laswp<T, N, NRHS, LDB>(ipiv, B, true);
+                trsm<T, N, NRHS, LDA, LDB>(HIPSOLVER_FILL_MODE_LOWER, trans, true, A, B);
+                trsm<T, N, NRHS, LDA, LDB>(HIPSOLVER_FILL_MODE_UPPER, trans, false, A, B);
+            }
+            else
+            {
+                trsm<T, N, NRHS, LDA, LDB>(HIPSOLVER_FILL_MODE_UPPER, trans, false, A, B);
+                trsm<T, N, NRHS, LDA, LDB>(HIPSOLVER_FILL_MODE_LOWER, trans, true, A, B);
+                if(ipiv)
+                    detail::laswp<T, N, NRHS, LDB>(ipiv, B, false);
+            }
+        }
+
+        /*! \brief Eigenvalues W in ascending order, and eigenvectors if jobz is
+         *  HIPSOLVER_EIG_MODE_VECTOR, of the symmetric matrix A of order N, by the cyclic
+         *  Jacobi method.
+         *
+         *  Only the triangle uplo of A is read. The eigenvectors overwrite A, and A is left
+         *  unspecified otherwise. The sweeps stop when the off-diagonal part is below the
+         *  machine precision relative to the norm of A, or after max_sweeps sweeps. Returns 0,
+         *  or N + 1 if the method did not converge, as the info of syevj.
+         */
+        template <typename T, int N, int LDA = N>
+        HIPSOLVER_DEVICE_FUNC int syevj(hipsolverEigMode_t  jobz,
+                                        hipsolverFillMode_t uplo,
+                                        T*                  A,
+                                        T*                  W,
+                                        int                 max_sweeps = 100)
+        {
+            static_assert(N >= 0 && LDA >= N, "invalid order or leading dimension");
+            const T eps   = std::numeric_limits<T>::epsilon();
+            bool    lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+
+            // the full matrix, and the eigenvectors, are kept in local arrays
+            T M[N > 0 ? N * N : 1], V[N > 0 ? N * N : 1];
+            T norm = 0;
+            HIPSOLVER_DEVICE_UNROLL
+            for(int j = 0; j < N; j++)
+            {
+                HIPSOLVER_DEVICE_UNROLL
+                for(int i = j; i < N; i++)
+                {
+                    T a          = lower ? A[i + j * LDA] : A[j + i * LDA];
+                    M[i + j * N] = a;
+                    M[j + i * N] = a;
+                    norm += (i == j ? 1 : 2) * a * a;
+                }
+                HIPSOLVER_DEVICE_UNROLL
+                for(int i = 0; i < N; i++)
+                    V[i + j * N] = i == j ? T(1) : T(0);
+            }
+
+            T   off  = 0;
+            int info = 0;
+            for(int sweep = 0;; sweep++)
+            {
+                off = 0;
+                HIPSOLVER_DEVICE_UNROLL
+                for(int q = 1; q < N; q++)
+                {
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int p = 0; p < q; p++)
+                        off += M[p + q * N] * M[p + q * N];
+                }
+                if(2 * off <= eps * eps * norm)
+                    break;
+                if(sweep == max_sweeps)
+                {
+                    info = N + 1;
+                    break;
+                }
+
+                HIPSOLVER_DEVICE_UNROLL
+                for(int q = 1; q < N; q++)
+                {
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int p = 0; p < q; p++)
+                    {
+                        // the rotation [c s; -s c] annihilates M(p, q)
+                        T apq = M[p + q * N];
+                        if(apq == 0)
+                            continue;
+
+                        T app   = M[p + p * N];
+                        T aqq   = M[q + q * N];
+                        T theta = (aqq - app) / (2 * apq);
+                        T t     = (theta >= 0 ? T(1) : T(-1))
+                              / (detail::abs(theta) + detail::sqrt(theta * theta + 1));
+                        T c = 1 / detail::sqrt(t * t + 1);
+                        T s = t * c;
+
+                        HIPSOLVER_DEVICE_UNROLL
+                        for(int k = 0; k < N; k++)
+                        {
+                            T x          = M[k + p * N];
+                            T y          = M[k + q * N];
+                            M[k + p * N] = c * x - s * y;
+                            M[k + q * N] = s * x + c * y;
+
+                            x            = V[k + p * N];
+                            y            = V[k + q * N];
+                            V[k + p * N] = c * x - s * y;
+                            V[k + q * N] = s * x + c * y;
+                        }
+                        HIPSOLVER_DEVICE_UNROLL
+                        for(int k = 0; k < N; k++)
+                        {
+                            T x          = M[p + k * N];
+                            T y          = M[q + k * N];
+                            M[p + k * N] = c * x - s * y;
+                            M[q + k * N] = s * x + c * y;
+                        }
+
+                        M[p + q * N] = 0;
+                        M[q + p * N] = 0;
+                        M[p + p * N] = app - t * apq;
+                        M[q + q * N] = aqq + t * apq;
+                    }
+                }
+            }
+
+            HIPSOLVER_DEVICE_UNROLL
+            for(int j = 0; j < N; j++)
+                W[j] = M[j + j * N];
+
+            // bubble sort, whose exchanges are between adjacent, compile-time indices
+            HIPSOLVER_DEVICE_UNROLL
+            for(int t = 0; t < N - 1; t++)
+            {
+                HIPSOLVER_DEVICE_UNROLL
+                for(int j = 0; j < N - 1 - t; j++)
+                {
+                    bool swap = W[j + 1] < W[j];
+                    T    x    = W[j];
+                    T    y    = W[j + 1];
+                    W[j]      = swap ? y : x;
+                    W[j + 1]  = swap ? x : y;
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int k = 0; k < N; k++)
+                    {
+                        x                  = V[k + j * N];
+                        y                  = V[k + (j + 1) * N];
+                        V[k + j * N]       = swap ? y : x;
+                        V[k + (j + 1) * N] = swap ? x : y;
+                    }
+                }
+            }
+
+            if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            {
+                HIPSOLVER_DEVICE_UNROLL
+                for(int j = 0; j < N; j++)
+                {
+                    HIPSOLVER_DEVICE_UNROLL
+                    for(int i = 0; i < N; i++)
+                        A[i + j * LDA] = V[i + j * N];
+                }
+            }
+            return info;
+        }
+    }
+}
+
+#undef HIPSOLVER_DEVICE_UNROLL
+#undef HIPSOLVER_DEVICE_FUNC
+
+#endif // HIPSOLVER_DEVICE_HPP
@@ -0,0 +1,351 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Device code, included by the HIP sources of the library only
+
+#pragma once
+
+#include "hipsolver.h"
+#include <cmath>
+#include <cstdint>
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime.h>
+
+/*
+ * ===========================================================================
+ *    Block solvers. potrf, getrf and getrs of one matrix of runtime order n,
+ *    solved by the NT threads of a block, which must all call them. Every
+ *    step of the unblocked algorithms is spread over the threads, with a
+ *    barrier between steps. The matrix may be in shared memory or in global
+ *    memory, where it is used in place.
+ *
+ *    Unlike the solvers of hipsolver_device.hpp, which keep the matrix of each
+ *    thread in registers, nothing here depends on the order at compile time,
+ *    so large orders neither spill nor take one instantiation each. T is a
+ *    real type, hipFloatComplex or hipDoubleComplex.
+ * ===========================================================================
+ */
+
+template <typename T>
+__device__ inline T hipsolver_block_fms(T a, T b, T c)
+{
+    return a - b * c;
+}
+
+template <typename T>
+__device__ inline T hipsolver_block_div(T a, T b)
+{
+    return a / b;
+}
+
+template <typename T>
+__device__ inline T hipsolver_block_conj(T a)
+{
+    return a;
+}
+
+template <typename T>
+__device__ inline T hipsolver_block_real(T a)
+{
+    return a;
+}
+
+// magnitude used to choose the pivots, as in the iamax of BLAS
+template <typename T>
+__device__ inline T hipsolver_block_abs1(T a)
+{
+    return a < 0 ? -a : a;
+}
+
+template <typename T, typename R>
+__device__ inline T hipsolver_block_scalar(R a)
+{
+    return T(a);
+}
+
+// complex matrices are solved as hipFloatComplex and hipDoubleComplex, whose operations are
+// device functions, unlike those of hipsolverComplex and hipsolverDoubleComplex
+__device__ inline hipFloatComplex
+    hipsolver_block_fms(hipFloatComplex a, hipFloatComplex b, hipFloatComplex c)
+{
+    return hipCsubf(a, hipCmulf(b, c));
+}
+
+__device__ inline hipDoubleComplex
+    hipsolver_block_fms(hipDoubleComplex a, hipDoubleComplex b, hipDoubleComplex c)
+{
+    return hipCsub(a, hipCmul(b, c));
+}
+
+__device__ inline hipFloatComplex hipsolver_block_div(hipFloatComplex a, hipFloatComplex b)
+{
+    return hipCdivf(a, b);
+}
+
+__device__ inline hipDoubleComplex hipsolver_block_div(hipDoubleComplex a, hipDoubleComplex b)
+{
+    return hipCdiv(a, b);
+}
+
+__device__ inline hipFloatComplex hipsolver_block_conj(hipFloatComplex a)
+{
+    return hipConjf(a);
+}
+
+__device__ inline hipDoubleComplex hipsolver_block_conj(hipDoubleComplex a)
+{
+    return hipConj(a);
+}
+
+__device__ inline float hipsolver_block_real(hipFloatComplex a)
+{
+    return hipCrealf(a);
+}
+
+__device__ inline double hipsolver_block_real(hipDoubleComplex a)
+{
+    return hipCreal(a);
+}
+
+__device__ inline float hipsolver_block_abs1(hipFloatComplex a)
+{
+    return fabsf(hipCrealf(a)) + fabsf(hipCimagf(a));
+}
+
+__device__ inline double hipsolver_block_abs1(hipDoubleComplex a)
+{
+    return fabs(hipCreal(a)) + fabs(hipCimag(a));
+}
+
+template <>
+__device__ inline hipFloatComplex hipsolver_block_scalar<hipFloatComplex, float>(float a)
+{
+    return make_hipFloatComplex(a, 0);
+}
+
+template <>
+__device__ inline hipDoubleComplex hipsolver_block_scalar<hipDoubleComplex, double>(double a)
+{
+    return make_hipDoubleComplex(a, 0);
+}
+
+template <typename T>
+__device__ inline void hipsolver_block_swap(T& a, T& b)
+{
+    T t = a;
+    a   = b;
+    b   = t;
+}
+
+/*! \brief Cholesky factorization of A, of order n. Returns the info of potrf. */
+template <int NT, typename T>
+__device__ int hipsolver_block_potrf(hipsolverFillMode_t uplo, int n, T* A, int64_t lda)
+{
+    __shared__ int info;
+    bool           lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+    int            tid   = threadIdx.x;
+
+    for(int j = 0; j < n; j++)
+    {
+        if(tid == 0)
+        {
+            auto d = hipsolver_block_real(A[j + j * lda]);
+            info   = d > 0 ? 0 : j + 1;
+            if(d > 0)
+                A[j + j * lda] = hipsolver_block_scalar<T>(std::sqrt(d));
+        }
+        __syncthreads();
+        if(info)
+            return info;
+
+        // L(i, j) of the lower triangle is conj(U(j, i)) of the upper one, and the diagonal is
+        // real
+        T d = A[j + j * lda];
+        for(int i = j + 1 + tid; i < n; i += NT)
+        {
+            T& a = lower ? A[i + j * lda] : A[j + i * lda];
+            a    = hipsolver_block_div(a, d);
+        }
+        __syncthreads();
+
+        // A(i, k) -= L(i, j) * conj(L(k, j)) on the trailing triangle
+        int m = n - j - 1;
+        for(int t = tid; t < m * m; t += NT)
+        {
+            int i = j + 1 + t % m;
+            int k = j + 1 + t / m;
+            if(i < k)
+                continue;
+            if(lower)
+                A[i + k * lda] = hipsolver_block_fms(
+                    A[i + k * lda], A[i + j * lda], hipsolver_block_conj(A[k + j * lda]));
+            else
+                A[k + i * lda] = hipsolver_block_fms(
+                    A[k + i * lda], hipsolver_block_conj(A[j + k * lda]), A[j + i * lda]);
+        }
+        __syncthreads();
+    }
+    return 0;
+}
+
+/*! \brief LU factorization of A, of order n, with partial pivoting if ipiv is not null.
+ *  Returns the info of getrf; ipiv is written by thread 0. */
+template <int NT, typename T>
+__device__ int hipsolver_block_getrf(int n, T* A, int64_t lda, int* ipiv)
+{
+    using R = decltype(hipsolver_block_abs1(T()));
+
+    __shared__ R   best[NT];
+    __shared__ int where[NT];
+    __shared__ int info;
+    int            tid = threadIdx.x;
+
+    if(tid == 0)
+        info = 0;
+    __syncthreads();
+
+    for(int j = 0; j < n; j++)
+    {
+        // the first entry of largest magnitude of column j, at or below the diagonal
+        int p = j;
+        if(ipiv)
+        {
+            R   v = -1;
+            int w = n;
+            for(int i = j + tid; i < n; i += NT)
+            {
+                R a = hipsolver_block_abs1(A[i + j * lda]);
+                if(a > v)
+                {
+                    v = a;
+                    w = i;
+                }
+            }
+            best[tid]  = v;
+            where[tid] = w;
+            __syncthreads();
+            for(int s = NT / 2; s > 0; s /= 2)
+            {
+                if(tid < s
+                   && (best[tid + s] > best[tid]
+                       || (best[tid + s] == best[tid] && where[tid + s] < where[tid])))
+                {
+                    best[tid]  = best[tid + s];
+                    where[tid] = where[tid + s];
+                }
+                __syncthreads();
+            }
+            // a column of NaNs has no largest entry
+            p = where[0] < n ? where[0] : j;
+            if(tid == 0)
+                ipiv[j] = p + 1;
+
+            if(p != j)
+            {
+                for(int c = tid; c < n; c += NT)
+                    hipsolver_block_swap(A[j + c * lda], A[p + c * lda]);
+                __syncthreads();
+            }
+        }
+
+        T d = A[j + j * lda];
+        if(hipsolver_block_abs1(d) == 0)
+        {
+            if(tid == 0 && !info)
+                info = j + 1;
+        }
+        else
+        {
+            for(int i = j + 1 + tid; i < n; i += NT)
+                A[i + j * lda] = hipsolver_block_div(A[i + j * lda], d);
+        }
+        __syncthreads();
+
+        int m = n - j - 1;
+        for(int t = tid; t < m * m; t += NT)
+        {
+            int i          = j + 1 + t % m;
+            int k          = j + 1 + t / m;
+            A[i + k * lda] = hipsolver_block_fms(A[i + k * lda], A[i + j * lda], A[j + k * lda]);
+        }
+        __syncthreads();
+    }
+    return info;
+}
+
+/*! \brief Solves op(A) * X = B, with the nrhs columns of B, given the factors and pivots of
+ *  hipsolver_block_getrf. ipiv is null if A was factorized without pivoting. */
+template <int NT, typename T>
+__device__ void hipsolver_block_getrs(hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      const T*             A,
+                                      int64_t              lda,
+                                      const int*           ipiv,
+                                      T*                   B,
+                                      int64_t              ldb)
+{
+    int tid = threadIdx.x;
+
+    // every thread applies the interchanges to its own columns
+    auto laswp = [&](bool forward) {
+        if(!ipiv)
+            return;
+        for(int c = tid; c < nrhs; c += NT)
+            for(int t = 0; t < n; t++)
+            {
+                int j = forward ? t : n - 1 - t;
+                int p = ipiv[j] - 1;
+                if(p != j)
+                    hipsolver_block_swap(B[j + c * ldb], B[p + c * ldb]);
+            }
+        __syncthreads();
+    };
+
+    // B(i, c) -= a(i) * B(j, c) for the rows i of [first, first + m)
+    auto update = [&](int j, int first, int m, bool row, bool conj) {
+        for(int t = tid; t < m * nrhs; t += NT)
+        {
+            int i = first + t % m;
+            int c = t / m;
+            T   a = row ? A[j + i * lda] : A[i + j * lda];
+            if(conj)
+                a = hipsolver_block_conj(a);
+            B[i + c * ldb] = hipsolver_block_fms(B[i + c * ldb], a, B[j + c * ldb]);
+        }
+        __syncthreads();
+    };
+
+    auto diagonal = [&](int j, bool conj) {
+        T d = conj ? hipsolver_block_conj(A[j + j * lda]) : A[j + j * lda];
+        for(int c = tid; c < nrhs; c += NT)
+            B[j + c * ldb] = hipsolver_block_div(B[j + c * ldb], d);
+        __syncthreads();
+    };
+
+    if(trans == HIPSOLVER_OP_N)
+    {
+        laswp(true);
+        for(int j = 0; j < n; j++)
+            update(j, j + 1, n - j - 1, false, false);
+        for(int j = n - 1; j >= 0; j--)
+        {
+            diagonal(j, false);
+            update(j, 0, j, false, false);
+        }
+    }
+    else
+    {
+        // op(U) is lower triangular and op(L) unit upper triangular
+        bool conj = trans == HIPSOLVER_OP_C;
+        for(int j = 0; j < n; j++)
+        {
+            diagonal(j, conj);
+            update(j, j + 1, n - j - 1, true, conj);
+        }
+        for(int j = n - 1; j >= 0; j--)
+            update(j, 0, j, true, conj);
+        laswp(false);
+    }
+}
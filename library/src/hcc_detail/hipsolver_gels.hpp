@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_handle.hpp"
+#include "rocblas.h"
+#include "rocsolver.h"
+#include <algorithm>
+
+/*
+ * Least-squares solvers.
+ *
+ * rocSOLVER's gels overwrites the right-hand sides with the solution, whereas the hipSOLVER API
+ * follows cuSOLVER's gels and leaves B untouched, returning the solution in a separate X. The
+ * right-hand sides are therefore copied to temporary storage at the front of the workspace,
+ * solved in place there, and the leading n rows of the result are copied to X. Both copies are
+ * enqueued on the handle's stream, so the solver can be captured in a graph.
+ */
+
+/******************** ROCSOLVER DISPATCH ********************/
+inline rocblas_status hipsolver_gels_gels(
+    rocblas_handle handle, int m, int n, int nrhs, float* A, int lda, float* B, int ldb, int* info)
+{
+    return rocsolver_sgels(handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status hipsolver_gels_gels(rocblas_handle handle,
+                                          int            m,
+                                          int            n,
+                                          int            nrhs,
+                                          double*        A,
+                                          int            lda,
+                                          double*        B,
+                                          int            ldb,
+                                          int*           info)
+{
+    return rocsolver_dgels(handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status hipsolver_gels_gels(rocblas_handle         handle,
+                                          int                    m,
+                                          int                    n,
+                                          int                    nrhs,
+                                          rocblas_float_complex* A,
+                                          int                    lda,
+                                          rocblas_float_complex* B,
+                                          int                    ldb,
+                                          int*                   info)
+{
+    return rocsolver_cgels(handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status hipsolver_gels_gels(rocblas_handle          handle,
+                                          int                     m,
+                                          int                     n,
+                                          int                     nrhs,
+                                          rocblas_double_complex* A,
+                                          int                     lda,
+                                          rocblas_double_complex* B,
+                                          int                     ldb,
+                                          int*                    info)
+{
+    return rocsolver_zgels(handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+/******************** HELPERS ********************/
+inline bool hipsolver_gels_valid_size(int m, int n, int nrhs, int lda, int ldb, int ldx)
+{
+    // as with cuSOLVER, only square and overdetermined systems are supported
+    return m >= 0 && n >= 0 && nrhs >= 0 && m >= n && lda >= std::max(1, m)
+           && ldb >= std::max(1, m) && ldx >= std::max(1, n);
+}
+
+/*! \brief Bytes of temporary storage used by the least-squares solver, besides the rocSOLVER
+ *  workspace: a compact copy of the right-hand sides.
+ */
+template <typename T>
+inline size_t hipsolver_gels_tmp_size(int m, int nrhs)
+{
+    return hipsolver_handle_data::align(sizeof(T) * size_t(m) * nrhs);
+}
+
+/*! \brief Total workspace in bytes of the least-squares solver, including the temporary
+ *  storage at its front.
+ */
+template <typename T>
+inline rocblas_status hipsolver_gels_bufferSize(
+    rocblas_handle handle, int m, int n, int nrhs, int lda, int ldb, int ldx, size_t* lwork)
+{
+    if(!hipsolver_gels_valid_size(m, n, nrhs, lda, ldb, ldx))
+        return rocblas_status_invalid_size;
+
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle);
+    hipsolver_gels_gels(
+        handle, m, n, nrhs, (T*)nullptr, lda, (T*)nullptr, std::max(1, m), nullptr);
+    rocblas_status status = rocblas_stop_device_memory_size_query(handle, &sz);
+    if(status != rocblas_status_success)
+        return status;
+
+    *lwork = hipsolver_gels_tmp_size<T>(m, nrhs) + sz;
+    return rocblas_status_success;
+}
+
+/*! \brief Solves the least-squares problem min || A * X - B || with a QR factorization of A.
+ *
+ *  The rocSOLVER workspace of handle must already be set, and tmp must hold
+ *  hipsolver_gels_tmp_size<T>(m, nrhs) bytes. A is overwritten with its factorization and B is
+ *  left unchanged. There is no iterative refinement, so niters is always set to zero.
+ */
+template <typename T>
+rocblas_status hipsolver_gels(rocblas_handle handle,
+                              int            m,
+                              int            n,
+                              int            nrhs,
+                              T*             A,
+                              int            lda,
+                              T*             B,
+                              int            ldb,
+                              T*             X,
+                              int            ldx,
+                              void*          tmp,
+                              int*           niters,
+                              int*           devInfo)
+{
+    if(!hipsolver_gels_valid_size(m, n, nrhs, lda, ldb, ldx))
+        return rocblas_status_invalid_size;
+    if(!niters || !devInfo || (n && !A) || (n && nrhs && (!B || !X)))
+        return rocblas_status_invalid_pointer;
+
+    hipStream_t    stream;
+    rocblas_status status = rocblas_get_stream(handle, &stream);
+    if(status != rocblas_status_success)
+        return status;
+
+    *niters = 0;
+    if(n == 0 || nrhs == 0)
+        return hipMemsetAsync(devInfo, 0, sizeof(int), stream) == hipSuccess
+                   ? rocblas_status_success
+                   : rocblas_status_internal_error;
+
+    T* Bt = (T*)tmp;
+    if(hipMemcpy2DAsync(Bt,
+                        sizeof(T) * m,
+                        B,
+                        sizeof(T) * ldb,
+                        sizeof(T) * m,
+                        nrhs,
+                        hipMemcpyDeviceToDevice,
+                        stream)
+       != hipSuccess)
+        return rocblas_status_internal_error;
+
+    status = hipsolver_gels_gels(handle, m, n, nrhs, A, lda, Bt, m, devInfo);
+    if(status != rocblas_status_success)
+        return status;
+
+    if(hipMemcpy2DAsync(X,
+                        sizeof(T) * ldx,
+                        Bt,
+                        sizeof(T) * m,
+                        sizeof(T) * n,
+                        nrhs,
+                        hipMemcpyDeviceToDevice,
+                        stream)
+       != hipSuccess)
+        return rocblas_status_internal_error;
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,627 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_autotune.hpp"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_completion.hpp"
+#include "hipsolver_host.hpp"
+#include "hipsolver_info_log.hpp"
+#include "hipsolver_managed.hpp"
+#include "hipsolver_workspace_stats.hpp"
+#include "rocblas.h"
+#include "rocsparse.h"
+#include <hip/hip_runtime_api.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/*! \brief Identifies a workspace size query.
+ *
+ *  The routine is identified by the address of its bufferSize function, which encodes both
+ *  the LAPACK routine and the precision. The remaining entries are the size and enum arguments
+ *  of the query, in the order in which they appear in the function signature.
+ */
+struct hipsolver_workspace_key
+{
+    static constexpr int max_args = 12;
+
+    void (*routine)();
+    std::array<int64_t, max_args> args;
+
+    template <typename F, typename... Ts>
+    explicit hipsolver_workspace_key(F* func, Ts... ts)
+        : routine(reinterpret_cast<void (*)()>(func))
+        , args{{int64_t(ts)...}}
+    {
+        static_assert(sizeof...(Ts) <= max_args, "Too many arguments for workspace key");
+    }
+
+    bool operator==(const hipsolver_workspace_key& other) const
+    {
+        return routine == other.routine && args == other.args;
+    }
+};
+
+struct hipsolver_workspace_key_hash
+{
+    size_t operator()(const hipsolver_workspace_key& key) const
+    {
+        size_t seed = std::hash<void (*)()>{}(key.routine);
+        for(int64_t arg : key.args)
+            seed ^= std::hash<int64_t>{}(arg) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+/*! \brief Algorithm hints of one function, set by hipsolverSetAdvOptions.
+ *
+ *  rocSOLVER fixes its block sizes when it is built, so the hints choose between its blocked
+ *  and unblocked (getf2, potf2) algorithms, and between partial and no pivoting.
+ */
+struct hipsolver_adv_options
+{
+    hipsolverAlgMode_t      algo           = HIPSOLVER_ALG_0;
+    bool                    pivoting       = true;
+    int                     unblocked_size = 0;
+    hipsolver_host_dispatch host;
+
+    /*! \brief Returns true if a problem of size k is factored with the unblocked algorithm. */
+    bool unblocked(int k) const
+    {
+        return algo == HIPSOLVER_ALG_1 || k <= unblocked_size;
+    }
+};
+
+struct hipsolver_mg_handle;
+
+/*! \brief hipSOLVER state associated with a rocBLAS handle created by hipsolverCreate. */
+struct hipsolver_handle_data
+{
+    // alignment of the sub-allocations made from the workspace arena
+    static constexpr size_t arena_alignment = 256;
+
+    // cache of workspace sizes returned by the bufferSize functions
+    bool workspace_cache = true;
+    std::unordered_map<hipsolver_workspace_key, size_t, hipsolver_workspace_key_hash>
+        workspace_sizes;
+
+    // number of problems per chunk of the batched functions, cached with their workspace sizes
+    std::unordered_map<hipsolver_workspace_key, int, hipsolver_workspace_key_hash> batch_chunks;
+
+    // workspace budget of the batched functions that solve their batch in chunks, or zero for
+    // none, and the number of problems per chunk of the last of them
+    size_t batch_workspace_limit = 0;
+    int    batch_chunk           = 0;
+
+    // device memory backing the workspace of functions called without a work array
+    void*  arena            = nullptr;
+    size_t arena_size       = 0;
+    size_t arena_high_water = 0;
+
+    // requests and growths of the arena, and the callback notified of its growth
+    hipsolver_workspace_stats workspace_stats;
+
+    // a stream-ordered arena is allocated from mem_pool, or from the default pool of the device
+    // if it is null, and is resized on the stream of its last use
+    bool         stream_ordered = false;
+    hipMemPool_t mem_pool       = nullptr;
+    hipStream_t  arena_stream   = nullptr;
+
+    // info values accumulated while info aggregation is enabled
+    hipsolver_info_log info_log;
+
+    // completion event and callback of the solver functions
+    hipsolver_completion completion;
+
+    // algorithm hints of getrf, potrf and syevd
+    hipsolver_adv_options getrf_options;
+    hipsolver_adv_options potrf_options;
+    hipsolver_adv_options syevd_options;
+
+    // getrf and potrf without algorithm hints take the algorithm selected by the autotuner
+    hipsolver_autotune_setting autotune;
+
+    // prefetching of the managed arguments of each call
+    hipsolver_managed_setting managed_memory;
+
+    // devices over which the batched functions split their batch, if not null, and the event
+    // that orders them after the work enqueued on the stream of the handle
+    hipsolver_mg_handle* device_group = nullptr;
+    hipEvent_t           group_start  = nullptr;
+
+    // rocSPARSE handle used by the tridiagonal and pentadiagonal solvers, created on first use
+    rocsparse_handle sparse = nullptr;
+
+    hipsolver_handle_data() = default;
+
+    hipsolver_handle_data(const hipsolver_handle_data&) = delete;
+    hipsolver_handle_data& operator=(const hipsolver_handle_data&) = delete;
+
+    ~hipsolver_handle_data()
+    {
+        release();
+        if(group_start)
+            hipEventDestroy(group_start);
+        if(sparse)
+            rocsparse_destroy_handle(sparse);
+    }
+
+    /*! \brief Frees the arena; hipFree waits for any work still using it, even if it was
+     *  allocated in stream order. */
+    void release()
+    {
+        if(arena)
+            hipFree(arena);
+        arena      = nullptr;
+        arena_size = 0;
+    }
+
+    static size_t align(size_t size)
+    {
+        return (size + arena_alignment - 1) / arena_alignment * arena_alignment;
+    }
+
+    /*! \brief Returns true if size bytes can be taken from the arena without reallocating it. */
+    bool fits(size_t size) const
+    {
+        return align(size) <= arena_size;
+    }
+
+    /*! \brief Allocates size bytes for the arena, in stream order on stream if enabled. */
+    hipError_t allocate(size_t size, hipStream_t stream)
+    {
+        if(!stream_ordered)
+            return hipMalloc(&arena, size);
+        if(mem_pool)
+            return hipMallocFromPoolAsync(&arena, size, mem_pool, stream);
+        return hipMallocAsync(&arena, size, stream);
+    }
+
+    /*! \brief Ensures that the arena holds at least size bytes, for use on stream.
+     *
+     *  The arena never shrinks. When it must grow, it grows by at least half of its current
+     *  size, so that a workload with varying sizes settles on a single allocation after a few
+     *  calls. A stream-ordered arena is freed after the work already enqueued on the stream of
+     *  its last use, and reallocated on stream, so that its growth does not synchronize the
+     *  device.
+     */
+    hipError_t reserve(size_t size, hipStream_t stream)
+    {
+        size             = align(size);
+        arena_high_water = std::max(arena_high_water, size);
+        if(size <= arena_size)
+        {
+            arena_stream = stream;
+            return hipSuccess;
+        }
+
+        if(arena)
+        {
+            // hipFreeAsync is ordered after the work enqueued on the stream of the last use,
+            // and hipFree waits for any work still using the arena
+            if(stream_ordered)
+                hipFreeAsync(arena, arena_stream);
+            else
+                hipFree(arena);
+            arena      = nullptr;
+            arena_size = 0;
+        }
+
+        size_t     new_size = align(std::max(size, arena_high_water + arena_high_water / 2));
+        hipError_t err      = allocate(new_size, stream);
+        if(err != hipSuccess)
+        {
+            new_size = size;
+            err      = allocate(new_size, stream);
+        }
+        if(err != hipSuccess)
+        {
+            arena = nullptr;
+            return err;
+        }
+
+        arena_size   = new_size;
+        arena_stream = stream;
+        return hipSuccess;
+    }
+};
+
+/*! \brief State of a Jacobi SVD created by hipsolverCreateGesvdjInfo.
+ *
+ *  Holds the convergence criteria given to rocSOLVER and the device buffers that receive the
+ *  residual and the number of executed sweeps of each problem of the last computation.
+ */
+struct hipsolver_gesvdj_info
+{
+    // a tolerance of zero selects the machine precision
+    double tolerance  = 0;
+    int    max_sweeps = 100;
+
+    // sized for batch_count problems; the residual holds doubles even for single precision
+    void*  residual  = nullptr;
+    int*   n_sweeps  = nullptr;
+    int    capacity  = 0;
+    bool   is_double = false;
+
+    hipsolver_gesvdj_info() = default;
+
+    hipsolver_gesvdj_info(const hipsolver_gesvdj_info&) = delete;
+    hipsolver_gesvdj_info& operator=(const hipsolver_gesvdj_info&) = delete;
+
+    ~hipsolver_gesvdj_info()
+    {
+        if(residual)
+            hipFree(residual);
+        if(n_sweeps)
+            hipFree(n_sweeps);
+    }
+
+    /*! \brief Returns true if the result buffers can hold batch_count problems. */
+    bool fits(int batch_count) const
+    {
+        return std::max(batch_count, 1) <= capacity;
+    }
+
+    /*! \brief Ensures that the result buffers can hold batch_count problems. */
+    hipError_t reserve(int batch_count, bool double_precision)
+    {
+        is_double   = double_precision;
+        batch_count = std::max(batch_count, 1);
+        if(batch_count <= capacity)
+            return hipSuccess;
+
+        if(residual)
+            hipFree(residual);
+        if(n_sweeps)
+            hipFree(n_sweeps);
+        residual = nullptr;
+        n_sweeps = nullptr;
+        capacity = 0;
+
+        hipError_t err = hipMalloc(&residual, sizeof(double) * batch_count);
+        if(err == hipSuccess)
+            err = hipMalloc((void**)&n_sweeps, sizeof(int) * batch_count);
+        if(err != hipSuccess)
+        {
+            if(residual)
+                hipFree(residual);
+            residual = nullptr;
+            n_sweeps = nullptr;
+            return err;
+        }
+
+        capacity = batch_count;
+        return hipSuccess;
+    }
+};
+
+/*! \brief State of a Jacobi eigensolver created by hipsolverCreateSyevjInfo.
+ *
+ *  Shares the convergence criteria and result buffers of gesvdj, and adds the ordering of the
+ *  computed eigenvalues.
+ */
+struct hipsolver_syevj_info : hipsolver_gesvdj_info
+{
+    // nonzero sorts the eigenvalues, and their eigenvectors, in ascending order
+    int sort_eig = 1;
+};
+
+/*! \brief Fixed-shape call prepared by one of the createPlan functions.
+ *
+ *  Holds the translated arguments of the call and owns a workspace sized when the plan was
+ *  created, so that executing the plan only needs to set the workspace and launch rocSOLVER.
+ *  The routine is identified by the address of its createPlan function, which encodes both the
+ *  LAPACK routine and the precision.
+ */
+struct hipsolver_plan
+{
+    rocblas_handle handle;
+    void (*routine)();
+
+    rocblas_fill  uplo  = rocblas_fill_full;
+    rocblas_evect evect = rocblas_evect_none;
+    int           m     = 0;
+    int           n     = 0;
+    int           lda   = 0;
+
+    // algorithm hints of the handle when the plan was created
+    hipsolver_adv_options options;
+
+    // a single allocation holds the temporary arrays of the call followed by the workspace
+    void*  memory         = nullptr;
+    void*  tmp            = nullptr;
+    void*  workspace      = nullptr;
+    size_t workspace_size = 0;
+
+    template <typename F>
+    hipsolver_plan(rocblas_handle handle, F* func)
+        : handle(handle)
+        , routine(reinterpret_cast<void (*)()>(func))
+    {
+    }
+
+    hipsolver_plan(const hipsolver_plan&) = delete;
+    hipsolver_plan& operator=(const hipsolver_plan&) = delete;
+
+    ~hipsolver_plan()
+    {
+        if(memory)
+            hipFree(memory);
+    }
+
+    /*! \brief Returns true if the plan was created by func. */
+    template <typename F>
+    bool is(F* func) const
+    {
+        return routine == reinterpret_cast<void (*)()>(func);
+    }
+
+    /*! \brief Allocates tmp_size bytes of temporary storage and a workspace of size bytes. */
+    hipError_t allocate(size_t tmp_size, size_t size)
+    {
+        tmp_size       = hipsolver_handle_data::align(tmp_size);
+        hipError_t err = hipMalloc(&memory, std::max(tmp_size + size, size_t(1)));
+        if(err != hipSuccess)
+        {
+            memory = nullptr;
+            return err;
+        }
+
+        tmp            = memory;
+        workspace      = (char*)memory + tmp_size;
+        workspace_size = size;
+        return hipSuccess;
+    }
+};
+
+/*! \brief Maps rocBLAS handles to their hipSOLVER state.
+ *
+ *  hipsolverHandle_t is the rocBLAS handle itself, so any additional state is kept here and
+ *  looked up by handle. Handles that were not created by hipsolverCreate have no entry.
+ *
+ *  A wrapper looks up its handle several times per call, for the workspace cache, the algorithm
+ *  hints and the arena, so every thread remembers the last handle that it looked up. The
+ *  remembered entry is valid while the generation of the registry, which every create and
+ *  destroy advances, is unchanged, so repeated calls on the same handle take neither the mutex
+ *  nor a hash lookup.
+ */
+class hipsolver_handle_registry
+{
+    using map_t = std::unordered_map<rocblas_handle, std::unique_ptr<hipsolver_handle_data>>;
+
+    struct last_lookup
+    {
+        rocblas_handle         handle     = nullptr;
+        hipsolver_handle_data* data       = nullptr;
+        uint64_t               generation = 0;
+    };
+
+    static std::mutex& mutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+
+    static map_t& map()
+    {
+        static map_t m;
+        return m;
+    }
+
+    static std::atomic<uint64_t>& generation()
+    {
+        static std::atomic<uint64_t> g(1);
+        return g;
+    }
+
+    static last_lookup& last()
+    {
+        static thread_local last_lookup l;
+        return l;
+    }
+
+public:
+    /*! \brief Registers handle; its state is allocated by the first lookup. */
+    static void create(rocblas_handle handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        map()[handle].reset();
+        generation()++;
+    }
+
+    static void destroy(rocblas_handle handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        map().erase(handle);
+        generation()++;
+    }
+
+    static hipsolver_handle_data* get(rocblas_handle handle)
+    {
+        last_lookup& l = last();
+        uint64_t     g = generation().load(std::memory_order_acquire);
+        if(l.handle == handle && l.generation == g)
+            return l.data;
+
+        std::lock_guard<std::mutex> lock(mutex());
+        auto it = map().find(handle);
+        if(it != map().end() && !it->second)
+            it->second.reset(new hipsolver_handle_data);
+        l.handle     = handle;
+        l.data       = it != map().end() ? it->second.get() : nullptr;
+        l.generation = generation().load(std::memory_order_relaxed);
+        return l.data;
+    }
+};
+
+/*! \brief Returns true and sets lwork if the workspace size for key has been cached. */
+inline bool hipsolver_workspace_cache_find(rocblas_handle                 handle,
+                                           const hipsolver_workspace_key& key,
+                                           int*                           lwork)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data || !data->workspace_cache || !lwork)
+        return false;
+
+    auto it = data->workspace_sizes.find(key);
+    if(it == data->workspace_sizes.end())
+        return false;
+
+    *lwork = (int)it->second;
+    return true;
+}
+
+/*! \brief Returns true and sets lwork if the workspace size for key has been cached. */
+inline bool hipsolver_workspace_cache_find(rocblas_handle                 handle,
+                                           const hipsolver_workspace_key& key,
+                                           size_t*                        lwork)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data || !data->workspace_cache || !lwork)
+        return false;
+
+    auto it = data->workspace_sizes.find(key);
+    if(it == data->workspace_sizes.end())
+        return false;
+
+    *lwork = it->second;
+    return true;
+}
+
+/*! \brief Records the workspace size for key. */
+inline void hipsolver_workspace_cache_insert(rocblas_handle                 handle,
+                                             const hipsolver_workspace_key& key,
+                                             size_t                         size)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(data && data->workspace_cache)
+        data->workspace_sizes[key] = size;
+}
+
+/*! \brief Returns the algorithm hints of function in data, or null if function has none. */
+inline hipsolver_adv_options* hipsolver_find_adv_options(hipsolver_handle_data* data,
+                                                         hipsolverDnFunction_t  function)
+{
+    switch(function)
+    {
+    case HIPSOLVERDN_GETRF:
+        return &data->getrf_options;
+    case HIPSOLVERDN_POTRF:
+        return &data->potrf_options;
+    case HIPSOLVERDN_SYEVD:
+        return &data->syevd_options;
+    default:
+        return nullptr;
+    }
+}
+
+/*! \brief Returns the algorithm hints of function on handle, or the defaults if handle has no
+ *  hipSOLVER state. */
+inline hipsolver_adv_options hipsolver_get_adv_options(rocblas_handle        handle,
+                                                       hipsolverDnFunction_t function)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return hipsolver_adv_options();
+
+    hipsolver_adv_options* options = hipsolver_find_adv_options(data, function);
+    return options ? *options : hipsolver_adv_options();
+}
+
+/*! \brief Returns true if the algorithm of a function with the hints options is selected by the
+ *  autotuner of handle; hints set by the user are never overridden. */
+inline bool hipsolver_autotune_enabled(rocblas_handle handle, const hipsolver_adv_options& options)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    return data && options.algo == HIPSOLVER_ALG_0 && options.unblocked_size == 0
+           && data->autotune.get();
+}
+
+/*! \brief Returns the host dispatch state of function on handle, or null if handle has no
+ *  hipSOLVER state. */
+inline hipsolver_host_dispatch* hipsolver_get_host_dispatch(rocblas_handle        handle,
+                                                            hipsolverDnFunction_t function)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return nullptr;
+
+    hipsolver_adv_options* options = hipsolver_find_adv_options(data, function);
+    return options ? &options->host : nullptr;
+}
+
+/*! \brief Returns the rocSPARSE handle of handle, bound to the same stream as the rocBLAS handle.
+ *
+ *  Creating the rocSPARSE handle allocates device memory, so the first call cannot be made while
+ *  the stream is being captured.
+ */
+inline rocsparse_status hipsolver_rocsparse_handle(rocblas_handle handle, rocsparse_handle* sparse)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return rocsparse_status_invalid_handle;
+
+    hipStream_t stream;
+    if(rocblas_get_stream(handle, &stream) != rocblas_status_success)
+        return rocsparse_status_invalid_handle;
+
+    if(!data->sparse)
+    {
+        hipsolver_forbid_capture(stream);
+        rocsparse_status status = rocsparse_create_handle(&data->sparse);
+        if(status != rocsparse_status_success)
+        {
+            data->sparse = nullptr;
+            return status;
+        }
+    }
+
+    *sparse = data->sparse;
+    return rocsparse_set_stream(data->sparse, stream);
+}
+
+/*! \brief Returns true if all of the given 64-bit sizes can be passed to rocSOLVER. */
+inline bool hipsolver_fits_rocblas_int(int64_t n)
+{
+    return n >= std::numeric_limits<rocblas_int>::min()
+           && n <= std::numeric_limits<rocblas_int>::max();
+}
+
+template <typename... Ts>
+inline bool hipsolver_fits_rocblas_int(int64_t n, Ts... ns)
+{
+    return hipsolver_fits_rocblas_int(n) && hipsolver_fits_rocblas_int(ns...);
+}
+
+/*! \brief Copies the device array of matrix addresses Aarray to the host vector ptrs.
+ *
+ *  The copy is enqueued on stream, and the stream is synchronized before returning. It is used
+ *  by the batched functions that rocSOLVER only provides for a single matrix.
+ */
+template <typename T>
+inline hipError_t hipsolver_pointers_to_host(hipStream_t      stream,
+                                             T* const         Aarray[],
+                                             int              batch_count,
+                                             std::vector<T*>& ptrs)
+{
+    hipsolver_forbid_capture(stream);
+
+    ptrs.resize(batch_count);
+    if(batch_count == 0)
+        return hipSuccess;
+
+    hipError_t err = hipMemcpyAsync(
+        ptrs.data(), Aarray, sizeof(T*) * batch_count, hipMemcpyDeviceToHost, stream);
+    if(err != hipSuccess)
+        return err;
+
+    return hipStreamSynchronize(stream);
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Device code, built as a HIP source; see hipsolver_info_log.hpp
+
+#include "hipsolver_info_log.hpp"
+
+#ifdef HIPSOLVER_DEVICE_KERNELS
+
+#include <hip/hip_runtime.h>
+
+constexpr int hipsolver_info_threads = 256;
+
+// one thread per info value; the atomics are only taken by the failures, which are rare
+__global__ void __launch_bounds__(hipsolver_info_threads)
+    hipsolver_info_reduce_kernel(const int*            info,
+                                 int                   count,
+                                 int                   offset,
+                                 hipsolver_info_state* state)
+{
+    int i = blockIdx.x * hipsolver_info_threads + threadIdx.x;
+    if(i < count && info[i] != 0)
+    {
+        state->flag = 1;
+        atomicAdd(&state->count, 1);
+        atomicMin(&state->first, unsigned(offset + i));
+    }
+}
+
+hipError_t hipsolver_info_reduce_launch(hipStream_t           stream,
+                                        const int*            devInfo,
+                                        int                   count,
+                                        int                   offset,
+                                        hipsolver_info_state* state)
+{
+    if(count < 1)
+        return hipSuccess;
+    hipLaunchKernelGGL(hipsolver_info_reduce_kernel,
+                       dim3((count - 1) / hipsolver_info_threads + 1),
+                       dim3(hipsolver_info_threads),
+                       0,
+                       stream,
+                       devInfo,
+                       count,
+                       offset,
+                       state);
+    return hipGetLastError();
+}
+
+#endif // HIPSOLVER_DEVICE_KERNELS
@@ -0,0 +1,1659 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocsolver.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Multi-GPU solvers.
+ *
+ * Matrices are distributed over the devices of a hipsolverMg handle in a 1D block-cyclic column
+ * layout: column block b, made of columns b * nb to (b + 1) * nb - 1, is stored on device
+ * b % ndev as its local block b / ndev. Every device stores its local columns contiguously, with
+ * the number of rows of the matrix as leading dimension. Pivot vectors are distributed like the
+ * columns of their matrix.
+ *
+ * The factorizations are right-looking. The device that owns the current column panel factorizes
+ * it, and the other devices copy it through peer-to-peer transfers ordered by events before they
+ * update their own trailing columns. The host only waits for the final results. The Cholesky
+ * factorization of the upper triangle computes its row panels instead, each device the blocks of
+ * its own columns, so every device then gathers the whole row panel. The solves with the
+ * transposed factors of getrf are left-looking, so that each block of the solution is updated
+ * with a single column panel.
+ *
+ * rocSOLVER has no distributed eigensolver, so syevd gathers the matrix on the first device,
+ * solves it there, and distributes the eigenvectors back.
+ */
+
+#define HIPSOLVER_MG_CHECK(STATUS)                \
+    do                                            \
+    {                                             \
+        rocblas_status _status = (STATUS);        \
+        if(_status != rocblas_status_success)     \
+            return _status;                       \
+    } while(0)
+
+#define HIPSOLVER_MG_CHECK_HIP(ERROR)             \
+    do                                            \
+    {                                             \
+        if((ERROR) != hipSuccess)                 \
+            return rocblas_status_internal_error; \
+    } while(0)
+
+/******************** HANDLE AND DESCRIPTOR ********************/
+/*! \brief Restores the current device when it goes out of scope. */
+class hipsolver_mg_device_guard
+{
+    int device = 0;
+
+public:
+    hipsolver_mg_device_guard()
+    {
+        hipGetDevice(&device);
+    }
+    ~hipsolver_mg_device_guard()
+    {
+        hipSetDevice(device);
+    }
+
+    hipsolver_mg_device_guard(const hipsolver_mg_device_guard&) = delete;
+    hipsolver_mg_device_guard& operator=(const hipsolver_mg_device_guard&) = delete;
+};
+
+/*! \brief State of one of the devices selected by hipsolverMgDeviceSelect. */
+struct hipsolver_mg_device
+{
+    int            id     = 0;
+    rocblas_handle handle = nullptr;
+    hipStream_t    stream = nullptr;
+    hipEvent_t     ready  = nullptr; // recorded once a panel owned by the device is complete
+    hipEvent_t     done   = nullptr; // recorded once the device has copied a panel
+};
+
+struct hipsolver_mg_handle
+{
+    std::vector<hipsolver_mg_device> devices;
+
+    hipsolver_mg_handle() = default;
+    ~hipsolver_mg_handle()
+    {
+        release();
+    }
+
+    hipsolver_mg_handle(const hipsolver_mg_handle&) = delete;
+    hipsolver_mg_handle& operator=(const hipsolver_mg_handle&) = delete;
+
+    int count() const
+    {
+        return int(devices.size());
+    }
+
+    void release()
+    {
+        hipsolver_mg_device_guard guard;
+        for(hipsolver_mg_device& dev : devices)
+        {
+            hipSetDevice(dev.id);
+            if(dev.handle)
+                rocblas_destroy_handle(dev.handle);
+            if(dev.stream)
+                hipStreamDestroy(dev.stream);
+            if(dev.ready)
+                hipEventDestroy(dev.ready);
+            if(dev.done)
+                hipEventDestroy(dev.done);
+        }
+        devices.clear();
+    }
+
+    /*! \brief Creates a rocBLAS handle, a stream and the ordering events on each device. */
+    rocblas_status select(int n, const int* ids)
+    {
+        release();
+
+        hipsolver_mg_device_guard guard;
+        devices.resize(n);
+        rocblas_status status = rocblas_status_success;
+        for(int d = 0; d < n && status == rocblas_status_success; d++)
+        {
+            hipsolver_mg_device& dev = devices[d];
+            dev.id                   = ids[d];
+            if(hipSetDevice(dev.id) != hipSuccess
+               || hipStreamCreateWithFlags(&dev.stream, hipStreamNonBlocking) != hipSuccess
+               || hipEventCreateWithFlags(&dev.ready, hipEventDisableTiming) != hipSuccess
+               || hipEventCreateWithFlags(&dev.done, hipEventDisableTiming) != hipSuccess)
+                status = rocblas_status_internal_error;
+            else
+                status = rocblas_create_handle(&dev.handle);
+            if(status == rocblas_status_success)
+                status = rocblas_set_stream(dev.handle, dev.stream);
+
+            // peer access only speeds up the copies of the panels; they work without it
+            for(int e = 0; e < n && status == rocblas_status_success; e++)
+                if(ids[e] != dev.id)
+                    hipDeviceEnablePeerAccess(ids[e], 0);
+        }
+
+        if(status != rocblas_status_success)
+            release();
+        return status;
+    }
+
+    rocblas_status use(int d) const
+    {
+        return hipSetDevice(devices[d].id) == hipSuccess ? rocblas_status_success
+                                                         : rocblas_status_internal_error;
+    }
+
+    /*! \brief Waits for the work enqueued on all devices. */
+    rocblas_status synchronize() const
+    {
+        for(int d = 0; d < count(); d++)
+        {
+            HIPSOLVER_MG_CHECK(use(d));
+            HIPSOLVER_MG_CHECK_HIP(hipStreamSynchronize(devices[d].stream));
+        }
+        return rocblas_status_success;
+    }
+};
+
+struct hipsolver_mg_desc
+{
+    int64_t rows;
+    int64_t cols;
+    int64_t nb;
+    int     ndev;
+
+    int64_t blocks(int64_t n) const
+    {
+        return (n + nb - 1) / nb;
+    }
+
+    int owner(int64_t block) const
+    {
+        return int(block % ndev);
+    }
+
+    /*! \brief Local index of the first column of block. */
+    int64_t local_col(int64_t block) const
+    {
+        return block / ndev * nb;
+    }
+
+    /*! \brief Number of local columns of device d among the first n columns. */
+    int64_t local_cols(int d, int64_t n) const
+    {
+        int64_t nblocks = blocks(n);
+        if(d >= nblocks)
+            return 0;
+        int64_t count = ((nblocks - 1 - d) / ndev + 1) * nb;
+        if(owner(nblocks - 1) == d)
+            count -= nblocks * nb - n;
+        return count;
+    }
+
+    /*! \brief Local index of the first column of device d that belongs to a block >= block. */
+    int64_t local_start(int d, int64_t block) const
+    {
+        return block > d ? ((block - 1 - d) / ndev + 1) * nb : 0;
+    }
+
+    /*! \brief First block >= block owned by device d. */
+    int64_t next_block(int d, int64_t block) const
+    {
+        return block + ((d - block) % ndev + ndev) % ndev;
+    }
+};
+
+/******************** ROCSOLVER DISPATCH ********************/
+inline rocblas_status hipsolver_mg_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, float* A, int lda, int* info)
+{
+    return rocsolver_spotrf(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status hipsolver_mg_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, double* A, int lda, int* info)
+{
+    return rocsolver_dpotrf(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status hipsolver_mg_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, rocblas_float_complex* A, int lda, int* info)
+{
+    return rocsolver_cpotrf(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status hipsolver_mg_potrf(
+    rocblas_handle handle, rocblas_fill uplo, int n, rocblas_double_complex* A, int lda, int* info)
+{
+    return rocsolver_zpotrf(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status hipsolver_mg_getrf(
+    rocblas_handle handle, int m, int n, float* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_sgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_mg_getrf(
+    rocblas_handle handle, int m, int n, double* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_dgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_mg_getrf(
+    rocblas_handle handle, int m, int n, rocblas_float_complex* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_cgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_mg_getrf(
+    rocblas_handle handle, int m, int n, rocblas_double_complex* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_zgetrf(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_mg_laswp(
+    rocblas_handle handle, int n, float* A, int lda, int k2, const int* ipiv, int incx)
+{
+    return rocsolver_slaswp(handle, n, A, lda, 1, k2, ipiv, incx);
+}
+
+inline rocblas_status hipsolver_mg_laswp(
+    rocblas_handle handle, int n, double* A, int lda, int k2, const int* ipiv, int incx)
+{
+    return rocsolver_dlaswp(handle, n, A, lda, 1, k2, ipiv, incx);
+}
+
+inline rocblas_status hipsolver_mg_laswp(rocblas_handle         handle,
+                                         int                    n,
+                                         rocblas_float_complex* A,
+                                         int                    lda,
+                                         int                    k2,
+                                         const int*             ipiv,
+                                         int                    incx)
+{
+    return rocsolver_claswp(handle, n, A, lda, 1, k2, ipiv, incx);
+}
+
+inline rocblas_status hipsolver_mg_laswp(rocblas_handle          handle,
+                                         int                     n,
+                                         rocblas_double_complex* A,
+                                         int                     lda,
+                                         int                     k2,
+                                         const int*              ipiv,
+                                         int                     incx)
+{
+    return rocsolver_zlaswp(handle, n, A, lda, 1, k2, ipiv, incx);
+}
+
+inline rocblas_status hipsolver_mg_syevd(rocblas_handle handle,
+                                         rocblas_evect  evect,
+                                         rocblas_fill   uplo,
+                                         int            n,
+                                         float*         A,
+                                         int            lda,
+                                         float*         D,
+                                         float*         E,
+                                         int*           info)
+{
+    return rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status hipsolver_mg_syevd(rocblas_handle handle,
+                                         rocblas_evect  evect,
+                                         rocblas_fill   uplo,
+                                         int            n,
+                                         double*        A,
+                                         int            lda,
+                                         double*        D,
+                                         double*        E,
+                                         int*           info)
+{
+    return rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status hipsolver_mg_syevd(rocblas_handle         handle,
+                                         rocblas_evect          evect,
+                                         rocblas_fill           uplo,
+                                         int                    n,
+                                         rocblas_float_complex* A,
+                                         int                    lda,
+                                         float*                 D,
+                                         float*                 E,
+                                         int*                   info)
+{
+    return rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status hipsolver_mg_syevd(rocblas_handle          handle,
+                                         rocblas_evect           evect,
+                                         rocblas_fill            uplo,
+                                         int                     n,
+                                         rocblas_double_complex* A,
+                                         int                     lda,
+                                         double*                 D,
+                                         double*                 E,
+                                         int*                    info)
+{
+    return rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+/******************** ROCBLAS DISPATCH ********************/
+inline rocblas_status hipsolver_mg_trsm(rocblas_handle    handle,
+                                        rocblas_side      side,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation trans,
+                                        rocblas_diagonal  diag,
+                                        int               m,
+                                        int               n,
+                                        const float*      A,
+                                        int               lda,
+                                        float*            B,
+                                        int               ldb)
+{
+    float one = 1;
+    return rocblas_strsm(handle, side, uplo, trans, diag, m, n, &one, A, lda, B, ldb);
+}
+
+inline rocblas_status hipsolver_mg_trsm(rocblas_handle    handle,
+                                        rocblas_side      side,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation trans,
+                                        rocblas_diagonal  diag,
+                                        int               m,
+                                        int               n,
+                                        const double*     A,
+                                        int               lda,
+                                        double*           B,
+                                        int               ldb)
+{
+    double one = 1;
+    return rocblas_dtrsm(handle, side, uplo, trans, diag, m, n, &one, A, lda, B, ldb);
+}
+
+inline rocblas_status hipsolver_mg_trsm(rocblas_handle               handle,
+                                        rocblas_side                 side,
+                                        rocblas_fill                 uplo,
+                                        rocblas_operation            trans,
+                                        rocblas_diagonal             diag,
+                                        int                          m,
+                                        int                          n,
+                                        const rocblas_float_complex* A,
+                                        int                          lda,
+                                        rocblas_float_complex*       B,
+                                        int                          ldb)
+{
+    rocblas_float_complex one = {1, 0};
+    return rocblas_ctrsm(handle, side, uplo, trans, diag, m, n, &one, A, lda, B, ldb);
+}
+
+inline rocblas_status hipsolver_mg_trsm(rocblas_handle                handle,
+                                        rocblas_side                  side,
+                                        rocblas_fill                  uplo,
+                                        rocblas_operation             trans,
+                                        rocblas_diagonal              diag,
+                                        int                           m,
+                                        int                           n,
+                                        const rocblas_double_complex* A,
+                                        int                           lda,
+                                        rocblas_double_complex*       B,
+                                        int                           ldb)
+{
+    rocblas_double_complex one = {1, 0};
+    return rocblas_ztrsm(handle, side, uplo, trans, diag, m, n, &one, A, lda, B, ldb);
+}
+
+inline rocblas_status hipsolver_mg_gemm(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        rocblas_operation transB,
+                                        int               m,
+                                        int               n,
+                                        int               k,
+                                        const float*      A,
+                                        int               lda,
+                                        const float*      B,
+                                        int               ldb,
+                                        float*            C,
+                                        int               ldc)
+{
+    float one = 1, minus_one = -1;
+    return rocblas_sgemm(handle,
+                         transA,
+                         transB,
+                         m,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         &one,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status hipsolver_mg_gemm(rocblas_handle    handle,
+                                        rocblas_operation transA,
+                                        rocblas_operation transB,
+                                        int               m,
+                                        int               n,
+                                        int               k,
+                                        const double*     A,
+                                        int               lda,
+                                        const double*     B,
+                                        int               ldb,
+                                        double*           C,
+                                        int               ldc)
+{
+    double one = 1, minus_one = -1;
+    return rocblas_dgemm(handle,
+                         transA,
+                         transB,
+                         m,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         &one,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status hipsolver_mg_gemm(rocblas_handle               handle,
+                                        rocblas_operation            transA,
+                                        rocblas_operation            transB,
+                                        int                          m,
+                                        int                          n,
+                                        int                          k,
+                                        const rocblas_float_complex* A,
+                                        int                          lda,
+                                        const rocblas_float_complex* B,
+                                        int                          ldb,
+                                        rocblas_float_complex*       C,
+                                        int                          ldc)
+{
+    rocblas_float_complex one = {1, 0}, minus_one = {-1, 0};
+    return rocblas_cgemm(handle,
+                         transA,
+                         transB,
+                         m,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         &one,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status hipsolver_mg_gemm(rocblas_handle                handle,
+                                        rocblas_operation             transA,
+                                        rocblas_operation             transB,
+                                        int                           m,
+                                        int                           n,
+                                        int                           k,
+                                        const rocblas_double_complex* A,
+                                        int                           lda,
+                                        const rocblas_double_complex* B,
+                                        int                           ldb,
+                                        rocblas_double_complex*       C,
+                                        int                           ldc)
+{
+    rocblas_double_complex one = {1, 0}, minus_one = {-1, 0};
+    return rocblas_zgemm(handle,
+                         transA,
+                         transB,
+                         m,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         &one,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status hipsolver_mg_herk(rocblas_handle    handle,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation trans,
+                                        int               n,
+                                        int               k,
+                                        const float*      A,
+                                        int               lda,
+                                        float*            C,
+                                        int               ldc)
+{
+    float one = 1, minus_one = -1;
+    return rocblas_ssyrk(handle,
+                         uplo,
+                         trans,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         &one,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status hipsolver_mg_herk(rocblas_handle    handle,
+                                        rocblas_fill      uplo,
+                                        rocblas_operation trans,
+                                        int               n,
+                                        int               k,
+                                        const double*     A,
+                                        int               lda,
+                                        double*           C,
+                                        int               ldc)
+{
+    double one = 1, minus_one = -1;
+    return rocblas_dsyrk(handle,
+                         uplo,
+                         trans,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         &one,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status hipsolver_mg_herk(rocblas_handle               handle,
+                                        rocblas_fill                 uplo,
+                                        rocblas_operation            trans,
+                                        int                          n,
+                                        int                          k,
+                                        const rocblas_float_complex* A,
+                                        int                          lda,
+                                        rocblas_float_complex*       C,
+                                        int                          ldc)
+{
+    float one = 1, minus_one = -1;
+    return rocblas_cherk(handle,
+                         uplo,
+                         trans,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         &one,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status hipsolver_mg_herk(rocblas_handle                handle,
+                                        rocblas_fill                  uplo,
+                                        rocblas_operation             trans,
+                                        int                           n,
+                                        int                           k,
+                                        const rocblas_double_complex* A,
+                                        int                           lda,
+                                        rocblas_double_complex*       C,
+                                        int                           ldc)
+{
+    double one = 1, minus_one = -1;
+    return rocblas_zherk(handle,
+                         uplo,
+                         trans,
+                         n,
+                         k,
+                         &minus_one,
+                         A,
+                         lda,
+                         &one,
+                         C,
+                         ldc);
+}
+
+/******************** PANELS ********************/
+/*! \brief Number of elements of type T needed to store elems elements and ints integers. */
+template <typename T>
+int64_t hipsolver_mg_work_size(int64_t elems, int64_t ints)
+{
+    const int64_t size = sizeof(T);
+    return std::max(elems + (ints * int64_t(sizeof(int)) + size - 1) / size, int64_t(1));
+}
+
+template <typename T>
+hipError_t hipsolver_mg_copy_panel(
+    T* dst, int ldd, const T* src, int lds, int rows, int cols, hipStream_t stream)
+{
+    if(rows == 0 || cols == 0)
+        return hipSuccess;
+    return hipMemcpy2DAsync(dst,
+                            sizeof(T) * ldd,
+                            src,
+                            sizeof(T) * lds,
+                            sizeof(T) * rows,
+                            cols,
+                            hipMemcpyDeviceToDevice,
+                            stream);
+}
+
+/*! \brief Makes a panel of device owner available to the devices for which active is set.
+
+    copy(d, stream) enqueues the copy of the panel to device d. The copy runs after the work
+    already enqueued on the owner, which in turn waits for all the copies before it can modify
+    the panel again. */
+template <typename F>
+rocblas_status hipsolver_mg_broadcast(hipsolver_mg_handle&     mg,
+                                      int                      owner,
+                                      const std::vector<bool>& active,
+                                      F                        copy)
+{
+    const hipsolver_mg_device& src = mg.devices[owner];
+    HIPSOLVER_MG_CHECK(mg.use(owner));
+    HIPSOLVER_MG_CHECK_HIP(hipEventRecord(src.ready, src.stream));
+
+    for(int d = 0; d < mg.count(); d++)
+    {
+        if(d == owner || !active[d])
+            continue;
+
+        const hipsolver_mg_device& dst = mg.devices[d];
+        HIPSOLVER_MG_CHECK(mg.use(d));
+        HIPSOLVER_MG_CHECK_HIP(hipStreamWaitEvent(dst.stream, src.ready, 0));
+        HIPSOLVER_MG_CHECK_HIP(copy(d, dst.stream));
+        HIPSOLVER_MG_CHECK_HIP(hipEventRecord(dst.done, dst.stream));
+    }
+
+    HIPSOLVER_MG_CHECK(mg.use(owner));
+    for(int d = 0; d < mg.count(); d++)
+        if(d != owner && active[d])
+            HIPSOLVER_MG_CHECK_HIP(hipStreamWaitEvent(src.stream, mg.devices[d].done, 0));
+    return rocblas_status_success;
+}
+
+/*! \brief Sets info to the first non-zero info of the panels, offset by the first row of the
+    panel. infos[d] holds the infos of the panels owned by device d, indexed by panel. */
+inline rocblas_status hipsolver_mg_panel_info(const hipsolver_mg_handle& mg,
+                                              const hipsolver_mg_desc&   desc,
+                                              const std::vector<int*>&   infos,
+                                              int64_t                    npanels,
+                                              int*                       info)
+{
+    std::vector<int> panel(npanels), local(npanels);
+    for(int d = 0; d < mg.count() && d < npanels; d++)
+    {
+        HIPSOLVER_MG_CHECK(mg.use(d));
+        HIPSOLVER_MG_CHECK_HIP(
+            hipMemcpy(local.data(), infos[d], sizeof(int) * npanels, hipMemcpyDeviceToHost));
+        for(int64_t k = d; k < npanels; k += mg.count())
+            panel[k] = local[k];
+    }
+
+    *info = 0;
+    for(int64_t k = 0; k < npanels; k++)
+    {
+        if(panel[k] > 0)
+        {
+            *info = int(k * desc.nb) + panel[k];
+            break;
+        }
+    }
+    return rocblas_status_success;
+}
+
+/******************** POTRF ********************/
+template <typename T>
+rocblas_status hipsolver_mg_potrf_bufferSize(const hipsolver_mg_handle* mg,
+                                             rocblas_fill               uplo,
+                                             int                        n,
+                                             T*                         A[],
+                                             const hipsolver_mg_desc*   desc,
+                                             int64_t*                   lwork)
+{
+    if(!mg || mg->devices.empty())
+        return rocblas_status_invalid_handle;
+    if(!desc || !lwork)
+        return rocblas_status_invalid_pointer;
+    if(desc->ndev != mg->count())
+        return rocblas_status_invalid_value;
+    if(n < 0 || desc->rows < n || desc->cols < n)
+        return rocblas_status_invalid_size;
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_invalid_value;
+
+    // a copy of the current column panel, or of the whole row panel, and the info of every panel
+    *lwork = hipsolver_mg_work_size<T>(n * desc->nb, desc->blocks(n));
+    return rocblas_status_success;
+}
+
+/*! \brief Computes the Cholesky factorization A = L * L' of the lower triangle of A. */
+template <typename T>
+rocblas_status hipsolver_mg_potrf_lower(hipsolver_mg_handle*     mg,
+                                        int                      n,
+                                        T*                       A[],
+                                        const hipsolver_mg_desc* desc,
+                                        T*                       work[],
+                                        const std::vector<int*>& infos)
+{
+    const int     ndev    = mg->count();
+    const int     lda     = int(desc->rows);
+    const int64_t nblocks = desc->blocks(n);
+
+    std::vector<T*>   panel(ndev);
+    std::vector<int>  ldp(ndev);
+    std::vector<bool> active(ndev);
+
+    for(int64_t k = 0; k < nblocks; k++)
+    {
+        const int o     = desc->owner(k);
+        const int r0    = int(k * desc->nb);
+        const int kb    = int(std::min<int64_t>(desc->nb, n - r0));
+        const int below = n - r0 - kb;
+        T*        Akk   = A[o] + r0 + desc->local_col(k) * lda;
+
+        // factorize the diagonal block and compute the rest of the panel
+        rocblas_handle handle = mg->devices[o].handle;
+        HIPSOLVER_MG_CHECK(mg->use(o));
+        HIPSOLVER_MG_CHECK(
+            hipsolver_mg_potrf(handle, rocblas_fill_lower, kb, Akk, lda, infos[o] + k));
+        if(below == 0)
+            break;
+        HIPSOLVER_MG_CHECK(hipsolver_mg_trsm(handle,
+                                             rocblas_side_right,
+                                             rocblas_fill_lower,
+                                             rocblas_operation_conjugate_transpose,
+                                             rocblas_diagonal_non_unit,
+                                             below,
+                                             kb,
+                                             Akk,
+                                             lda,
+                                             Akk + kb,
+                                             lda));
+
+        // the devices with trailing columns need rows r0 to n - 1 of the panel
+        for(int d = 0; d < ndev; d++)
+        {
+            active[d] = desc->local_cols(d, n) > desc->local_start(d, k + 1);
+            panel[d]  = (d == o) ? Akk : work[d];
+            ldp[d]    = (d == o) ? lda : n;
+        }
+        HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, o, active, [&](int d, hipStream_t stream) {
+            return hipsolver_mg_copy_panel(work[d], n, Akk, lda, n - r0, kb, stream);
+        }));
+
+        // update the trailing blocks: A_jj -= L_j * L_j' and A_ij -= L_i * L_j'
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            rocblas_handle handle = mg->devices[d].handle;
+            HIPSOLVER_MG_CHECK(mg->use(d));
+            for(int64_t j = desc->next_block(d, k + 1); j < nblocks; j += ndev)
+            {
+                const int rj   = int(j * desc->nb);
+                const int jb   = int(std::min<int64_t>(desc->nb, n - rj));
+                const int rest = n - rj - jb;
+                const T*  Lj   = panel[d] + (rj - r0);
+                T*        Ajj  = A[d] + rj + desc->local_col(j) * lda;
+
+                HIPSOLVER_MG_CHECK(hipsolver_mg_herk(handle,
+                                                     rocblas_fill_lower,
+                                                     rocblas_operation_none,
+                                                     jb,
+                                                     kb,
+                                                     Lj,
+                                                     ldp[d],
+                                                     Ajj,
+                                                     lda));
+                if(rest > 0)
+                    HIPSOLVER_MG_CHECK(hipsolver_mg_gemm(handle,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_conjugate_transpose,
+                                                         rest,
+                                                         jb,
+                                                         kb,
+                                                         Lj + jb,
+                                                         ldp[d],
+                                                         Lj,
+                                                         ldp[d],
+                                                         Ajj + jb,
+                                                         lda));
+            }
+        }
+    }
+    return rocblas_status_success;
+}
+
+/*! \brief Computes the Cholesky factorization A = U' * U of the upper triangle of A.
+
+    Block row k of U is computed by the devices that own its columns, so every device with
+    trailing columns then gathers the whole block row, stored by global column in its workspace
+    with leading dimension nb, before it updates them. */
+template <typename T>
+rocblas_status hipsolver_mg_potrf_upper(hipsolver_mg_handle*     mg,
+                                        int                      n,
+                                        T*                       A[],
+                                        const hipsolver_mg_desc* desc,
+                                        T*                       work[],
+                                        const std::vector<int*>& infos)
+{
+    const int     ndev    = mg->count();
+    const int     lda     = int(desc->rows);
+    const int     ldr     = int(desc->nb);
+    const int64_t nblocks = desc->blocks(n);
+
+    std::vector<bool> active(ndev);
+
+    for(int64_t k = 0; k < nblocks; k++)
+    {
+        const int o   = desc->owner(k);
+        const int r0  = int(k * desc->nb);
+        const int kb  = int(std::min<int64_t>(desc->nb, n - r0));
+        T*        Akk = A[o] + r0 + desc->local_col(k) * lda;
+
+        // factorize the diagonal block
+        HIPSOLVER_MG_CHECK(mg->use(o));
+        HIPSOLVER_MG_CHECK(hipsolver_mg_potrf(
+            mg->devices[o].handle, rocblas_fill_upper, kb, Akk, lda, infos[o] + k));
+        if(r0 + kb == n)
+            break;
+
+        // the devices with trailing columns need the diagonal block
+        for(int d = 0; d < ndev; d++)
+            active[d] = desc->local_cols(d, n) > desc->local_start(d, k + 1);
+        HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, o, active, [&](int d, hipStream_t stream) {
+            return hipsolver_mg_copy_panel(work[d] + r0 * ldr, ldr, Akk, lda, kb, kb, stream);
+        }));
+
+        // compute the blocks U_kj = U_kk^-H * A_kj of the local trailing columns
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            const int64_t c1 = desc->local_start(d, k + 1);
+            HIPSOLVER_MG_CHECK(mg->use(d));
+            HIPSOLVER_MG_CHECK(hipsolver_mg_trsm(mg->devices[d].handle,
+                                                 rocblas_side_left,
+                                                 rocblas_fill_upper,
+                                                 rocblas_operation_conjugate_transpose,
+                                                 rocblas_diagonal_non_unit,
+                                                 kb,
+                                                 int(desc->local_cols(d, n) - c1),
+                                                 (d == o) ? Akk : work[d] + r0 * ldr,
+                                                 (d == o) ? lda : ldr,
+                                                 A[d] + r0 + c1 * lda,
+                                                 lda));
+        }
+
+        // gather the block row on every device with trailing columns
+        for(int e = 0; e < ndev; e++)
+        {
+            if(!active[e])
+                continue;
+
+            // copies the blocks of device e to the workspace of device d
+            auto copy = [&](int d, hipStream_t stream) {
+                hipError_t err = hipSuccess;
+                for(int64_t j = desc->next_block(e, k + 1); j < nblocks && err == hipSuccess;
+                    j += ndev)
+                {
+                    const int rj  = int(j * desc->nb);
+                    const int jb  = int(std::min<int64_t>(desc->nb, n - rj));
+                    const T*  src = A[e] + r0 + desc->local_col(j) * lda;
+                    err           = hipsolver_mg_copy_panel(work[d] + rj * ldr,
+                                                            ldr,
+                                                            src,
+                                                            lda,
+                                                            kb,
+                                                            jb,
+                                                            stream);
+                }
+                return err;
+            };
+            HIPSOLVER_MG_CHECK(mg->use(e));
+            HIPSOLVER_MG_CHECK_HIP(copy(e, mg->devices[e].stream));
+            HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, e, active, copy));
+        }
+
+        // update the trailing blocks: A_jj -= U_kj' * U_kj and A_ij -= U_ki' * U_kj
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            rocblas_handle handle = mg->devices[d].handle;
+            HIPSOLVER_MG_CHECK(mg->use(d));
+            for(int64_t j = desc->next_block(d, k + 1); j < nblocks; j += ndev)
+            {
+                const int rj    = int(j * desc->nb);
+                const int jb    = int(std::min<int64_t>(desc->nb, n - rj));
+                const int above = rj - r0 - kb;
+                const T*  Ukj   = work[d] + rj * ldr;
+                T*        Aj    = A[d] + desc->local_col(j) * lda;
+
+                HIPSOLVER_MG_CHECK(hipsolver_mg_herk(handle,
+                                                     rocblas_fill_upper,
+                                                     rocblas_operation_conjugate_transpose,
+                                                     jb,
+                                                     kb,
+                                                     Ukj,
+                                                     ldr,
+                                                     Aj + rj,
+                                                     lda));
+                if(above > 0)
+                    HIPSOLVER_MG_CHECK(hipsolver_mg_gemm(handle,
+                                                         rocblas_operation_conjugate_transpose,
+                                                         rocblas_operation_none,
+                                                         above,
+                                                         jb,
+                                                         kb,
+                                                         work[d] + (r0 + kb) * ldr,
+                                                         ldr,
+                                                         Ukj,
+                                                         ldr,
+                                                         Aj + r0 + kb,
+                                                         lda));
+            }
+        }
+    }
+    return rocblas_status_success;
+}
+
+/*! \brief Computes the Cholesky factorization A = L * L' of the lower triangle of A, or
+    A = U' * U of its upper triangle. */
+template <typename T>
+rocblas_status hipsolver_mg_potrf(hipsolver_mg_handle*     mg,
+                                  rocblas_fill             uplo,
+                                  int                      n,
+                                  T*                       A[],
+                                  const hipsolver_mg_desc* desc,
+                                  T*                       work[],
+                                  int64_t                  lwork,
+                                  int*                     info)
+{
+    int64_t size;
+    HIPSOLVER_MG_CHECK(hipsolver_mg_potrf_bufferSize(mg, uplo, n, A, desc, &size));
+    if(!A || !work || !info)
+        return rocblas_status_invalid_pointer;
+    if(lwork < size)
+        return rocblas_status_invalid_size;
+
+    *info = 0;
+    if(n == 0)
+        return rocblas_status_success;
+
+    hipsolver_mg_device_guard guard;
+    std::vector<int*>         infos(mg->count());
+    for(int d = 0; d < mg->count(); d++)
+        infos[d] = (int*)(work[d] + n * desc->nb);
+
+    if(uplo == rocblas_fill_lower)
+        HIPSOLVER_MG_CHECK(hipsolver_mg_potrf_lower(mg, n, A, desc, work, infos));
+    else
+        HIPSOLVER_MG_CHECK(hipsolver_mg_potrf_upper(mg, n, A, desc, work, infos));
+
+    HIPSOLVER_MG_CHECK(mg->synchronize());
+    return hipsolver_mg_panel_info(*mg, *desc, infos, desc->blocks(n), info);
+}
+
+/******************** GETRF ********************/
+template <typename T>
+rocblas_status hipsolver_mg_getrf_bufferSize(const hipsolver_mg_handle* mg,
+                                             int                        m,
+                                             int                        n,
+                                             T*                         A[],
+                                             const hipsolver_mg_desc*   desc,
+                                             int64_t*                   lwork)
+{
+    if(!mg || mg->devices.empty())
+        return rocblas_status_invalid_handle;
+    if(!desc || !lwork)
+        return rocblas_status_invalid_pointer;
+    if(desc->ndev != mg->count())
+        return rocblas_status_invalid_value;
+    if(m < 0 || n < 0 || desc->rows < m || desc->cols < n)
+        return rocblas_status_invalid_size;
+
+    // a copy of the current panel and its pivots, and the info of every panel
+    *lwork = hipsolver_mg_work_size<T>(m * desc->nb, desc->nb + desc->blocks(std::min(m, n)));
+    return rocblas_status_success;
+}
+
+/*! \brief Computes the LU factorization P * A = L * U with partial pivoting.
+
+    On exit, the pivots are global row indices, distributed like the columns of A. */
+template <typename T>
+rocblas_status hipsolver_mg_getrf(hipsolver_mg_handle*     mg,
+                                  int                      m,
+                                  int                      n,
+                                  T*                       A[],
+                                  const hipsolver_mg_desc* desc,
+                                  int*                     ipiv[],
+                                  T*                       work[],
+                                  int64_t                  lwork,
+                                  int*                     info)
+{
+    int64_t size;
+    HIPSOLVER_MG_CHECK(hipsolver_mg_getrf_bufferSize(mg, m, n, A, desc, &size));
+    if(!A || !ipiv || !work || !info)
+        return rocblas_status_invalid_pointer;
+    if(lwork < size)
+        return rocblas_status_invalid_size;
+
+    *info = 0;
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    hipsolver_mg_device_guard guard;
+    const int                 ndev    = mg->count();
+    const int                 lda     = int(desc->rows);
+    const int                 mn      = std::min(m, n);
+    const int64_t             npanels = desc->blocks(mn);
+
+    std::vector<int*> pivots(ndev), infos(ndev), piv(ndev);
+    std::vector<T*>   panel(ndev);
+    std::vector<int>  ldp(ndev);
+    std::vector<bool> active(ndev);
+    for(int d = 0; d < ndev; d++)
+    {
+        pivots[d] = (int*)(work[d] + m * desc->nb);
+        infos[d]  = pivots[d] + desc->nb;
+    }
+
+    for(int64_t k = 0; k < npanels; k++)
+    {
+        const int     o    = desc->owner(k);
+        const int     r0   = int(k * desc->nb);
+        const int     kb   = int(std::min<int64_t>(desc->nb, n - r0));
+        const int     rows = m - r0;
+        const int     kp   = std::min(rows, kb);
+        const int64_t c0   = desc->local_col(k);
+        T*            Ak   = A[o] + r0 + c0 * lda;
+        int*          ipk  = ipiv[o] + c0;
+
+        // factorize the panel; its pivots are relative to row r0
+        HIPSOLVER_MG_CHECK(mg->use(o));
+        HIPSOLVER_MG_CHECK(
+            hipsolver_mg_getrf(mg->devices[o].handle, rows, kb, Ak, lda, ipk, infos[o] + k));
+
+        // the devices with columns outside the panel need the panel and its pivots
+        for(int d = 0; d < ndev; d++)
+        {
+            active[d] = desc->local_cols(d, n) > (d == o ? kb : 0);
+            panel[d]  = (d == o) ? Ak : work[d];
+            ldp[d]    = (d == o) ? lda : m;
+            piv[d]    = (d == o) ? ipk : pivots[d];
+        }
+        HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, o, active, [&](int d, hipStream_t stream) {
+            hipError_t err = hipsolver_mg_copy_panel(work[d], m, Ak, lda, rows, kb, stream);
+            if(err == hipSuccess)
+                err = hipMemcpyAsync(
+                    pivots[d], ipk, sizeof(int) * kp, hipMemcpyDeviceToDevice, stream);
+            return err;
+        }));
+
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            rocblas_handle handle = mg->devices[d].handle;
+            const int64_t  ncols  = desc->local_cols(d, n);
+            const int64_t  c1     = desc->local_start(d, k + 1);
+            const int      nt     = int(ncols - c1);
+            T*             Ad     = A[d] + r0;
+            HIPSOLVER_MG_CHECK(mg->use(d));
+
+            // apply the interchanges to the columns on both sides of the panel
+            if(d != o)
+                HIPSOLVER_MG_CHECK(hipsolver_mg_laswp(handle, int(ncols), Ad, lda, kp, piv[d], 1));
+            else
+            {
+                if(c0 > 0)
+                    HIPSOLVER_MG_CHECK(hipsolver_mg_laswp(handle, int(c0), Ad, lda, kp, piv[d], 1));
+                if(nt > 0)
+                    HIPSOLVER_MG_CHECK(
+                        hipsolver_mg_laswp(handle, nt, Ad + c1 * lda, lda, kp, piv[d], 1));
+            }
+
+            // compute the block row of U and update the trailing columns
+            if(nt > 0)
+            {
+                HIPSOLVER_MG_CHECK(hipsolver_mg_trsm(handle,
+                                                     rocblas_side_left,
+                                                     rocblas_fill_lower,
+                                                     rocblas_operation_none,
+                                                     rocblas_diagonal_unit,
+                                                     kp,
+                                                     nt,
+                                                     panel[d],
+                                                     ldp[d],
+                                                     Ad + c1 * lda,
+                                                     lda));
+                if(rows > kp)
+                    HIPSOLVER_MG_CHECK(hipsolver_mg_gemm(handle,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_none,
+                                                         rows - kp,
+                                                         nt,
+                                                         kp,
+                                                         panel[d] + kp,
+                                                         ldp[d],
+                                                         Ad + c1 * lda,
+                                                         lda,
+                                                         Ad + kp + c1 * lda,
+                                                         lda));
+            }
+        }
+    }
+
+    HIPSOLVER_MG_CHECK(mg->synchronize());
+    HIPSOLVER_MG_CHECK(hipsolver_mg_panel_info(*mg, *desc, infos, npanels, info));
+
+    // make the pivots global
+    for(int d = 0; d < ndev; d++)
+    {
+        const int64_t count = desc->local_cols(d, mn);
+        if(count == 0)
+            continue;
+
+        std::vector<int> local(count);
+        HIPSOLVER_MG_CHECK(mg->use(d));
+        HIPSOLVER_MG_CHECK_HIP(
+            hipMemcpy(local.data(), ipiv[d], sizeof(int) * count, hipMemcpyDeviceToHost));
+        for(int64_t c = 0; c < count; c++)
+            local[c] += int((c / desc->nb * ndev + d) * desc->nb);
+        HIPSOLVER_MG_CHECK_HIP(
+            hipMemcpy(ipiv[d], local.data(), sizeof(int) * count, hipMemcpyHostToDevice));
+    }
+    return rocblas_status_success;
+}
+
+/******************** GETRS ********************/
+template <typename T>
+rocblas_status hipsolver_mg_getrs_bufferSize(const hipsolver_mg_handle* mg,
+                                             rocblas_operation          trans,
+                                             int                        n,
+                                             int                        nrhs,
+                                             T*                         A[],
+                                             const hipsolver_mg_desc*   descA,
+                                             const hipsolver_mg_desc*   descB,
+                                             int64_t*                   lwork)
+{
+    if(!mg || mg->devices.empty())
+        return rocblas_status_invalid_handle;
+    if(!descA || !descB || !lwork)
+        return rocblas_status_invalid_pointer;
+    if(descA->ndev != mg->count() || descB->ndev != mg->count())
+        return rocblas_status_invalid_value;
+    if(n < 0 || nrhs < 0 || descA->rows < n || descA->cols < n || descB->rows < n
+       || descB->cols < nrhs)
+        return rocblas_status_invalid_size;
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // a copy of the current panel of A and all the pivots
+    *lwork = hipsolver_mg_work_size<T>(n * descA->nb, n);
+    return rocblas_status_success;
+}
+
+/*! \brief Solves L * U * X = B, by forward substitution with L and back substitution with U.
+    Each column panel of the factors updates the blocks of B below or above it. */
+template <typename T>
+rocblas_status hipsolver_mg_getrs_none(hipsolver_mg_handle*     mg,
+                                       int                      n,
+                                       int                      nrhs,
+                                       T*                       A[],
+                                       const hipsolver_mg_desc* descA,
+                                       T*                       B[],
+                                       const hipsolver_mg_desc* descB,
+                                       T*                       work[],
+                                       const std::vector<bool>& active)
+{
+    const int     ndev    = mg->count();
+    const int     lda     = int(descA->rows);
+    const int     ldb     = int(descB->rows);
+    const int64_t nblocks = descA->blocks(n);
+
+    std::vector<T*>  panel(ndev);
+    std::vector<int> ldp(ndev);
+
+    // forward substitution with the unit lower triangular factor
+    for(int64_t k = 0; k < nblocks; k++)
+    {
+        const int o    = descA->owner(k);
+        const int r0   = int(k * descA->nb);
+        const int kb   = int(std::min<int64_t>(descA->nb, n - r0));
+        const int rest = n - r0 - kb;
+        T*        Ak   = A[o] + r0 + descA->local_col(k) * lda;
+
+        for(int d = 0; d < ndev; d++)
+        {
+            panel[d] = (d == o) ? Ak : work[d];
+            ldp[d]   = (d == o) ? lda : n;
+        }
+        HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, o, active, [&](int d, hipStream_t stream) {
+            return hipsolver_mg_copy_panel(work[d], n, Ak, lda, n - r0, kb, stream);
+        }));
+
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            rocblas_handle handle = mg->devices[d].handle;
+            const int      nloc   = int(descB->local_cols(d, nrhs));
+            T*             Bk     = B[d] + r0;
+            HIPSOLVER_MG_CHECK(mg->use(d));
+            HIPSOLVER_MG_CHECK(hipsolver_mg_trsm(handle,
+                                                 rocblas_side_left,
+                                                 rocblas_fill_lower,
+                                                 rocblas_operation_none,
+                                                 rocblas_diagonal_unit,
+                                                 kb,
+                                                 nloc,
+                                                 panel[d],
+                                                 ldp[d],
+                                                 Bk,
+                                                 ldb));
+            if(rest > 0)
+                HIPSOLVER_MG_CHECK(hipsolver_mg_gemm(handle,
+                                                     rocblas_operation_none,
+                                                     rocblas_operation_none,
+                                                     rest,
+                                                     nloc,
+                                                     kb,
+                                                     panel[d] + kb,
+                                                     ldp[d],
+                                                     Bk,
+                                                     ldb,
+                                                     Bk + kb,
+                                                     ldb));
+        }
+    }
+
+    // back substitution with the upper triangular factor
+    for(int64_t k = nblocks - 1; k >= 0; k--)
+    {
+        const int o  = descA->owner(k);
+        const int r0 = int(k * descA->nb);
+        const int kb = int(std::min<int64_t>(descA->nb, n - r0));
+        T*        Ak = A[o] + descA->local_col(k) * lda;
+
+        for(int d = 0; d < ndev; d++)
+        {
+            panel[d] = (d == o) ? Ak : work[d];
+            ldp[d]   = (d == o) ? lda : n;
+        }
+        HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, o, active, [&](int d, hipStream_t stream) {
+            return hipsolver_mg_copy_panel(work[d], n, Ak, lda, r0 + kb, kb, stream);
+        }));
+
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            rocblas_handle handle = mg->devices[d].handle;
+            const int      nloc   = int(descB->local_cols(d, nrhs));
+            T*             Bk     = B[d] + r0;
+            HIPSOLVER_MG_CHECK(mg->use(d));
+            HIPSOLVER_MG_CHECK(hipsolver_mg_trsm(handle,
+                                                 rocblas_side_left,
+                                                 rocblas_fill_upper,
+                                                 rocblas_operation_none,
+                                                 rocblas_diagonal_non_unit,
+                                                 kb,
+                                                 nloc,
+                                                 panel[d] + r0,
+                                                 ldp[d],
+                                                 Bk,
+                                                 ldb));
+            if(r0 > 0)
+                HIPSOLVER_MG_CHECK(hipsolver_mg_gemm(handle,
+                                                     rocblas_operation_none,
+                                                     rocblas_operation_none,
+                                                     r0,
+                                                     nloc,
+                                                     kb,
+                                                     panel[d],
+                                                     ldp[d],
+                                                     Bk,
+                                                     ldb,
+                                                     B[d],
+                                                     ldb));
+        }
+    }
+    return rocblas_status_success;
+}
+
+/*! \brief Solves op(U) * op(L) * X = B, for the transpose or conjugate transpose op, by forward
+    substitution with op(U) and back substitution with op(L). Block k of the solution is first
+    updated with the blocks already solved, which only needs column panel k of the factors. */
+template <typename T>
+rocblas_status hipsolver_mg_getrs_trans(hipsolver_mg_handle*     mg,
+                                        rocblas_operation        trans,
+                                        int                      n,
+                                        int                      nrhs,
+                                        T*                       A[],
+                                        const hipsolver_mg_desc* descA,
+                                        T*                       B[],
+                                        const hipsolver_mg_desc* descB,
+                                        T*                       work[],
+                                        const std::vector<bool>& active)
+{
+    const int     ndev    = mg->count();
+    const int     lda     = int(descA->rows);
+    const int     ldb     = int(descB->rows);
+    const int64_t nblocks = descA->blocks(n);
+
+    std::vector<T*>  panel(ndev);
+    std::vector<int> ldp(ndev);
+
+    // forward substitution with op(U), using rows 0 to r0 + kb - 1 of the panels
+    for(int64_t k = 0; k < nblocks; k++)
+    {
+        const int o  = descA->owner(k);
+        const int r0 = int(k * descA->nb);
+        const int kb = int(std::min<int64_t>(descA->nb, n - r0));
+        T*        Ak = A[o] + descA->local_col(k) * lda;
+
+        for(int d = 0; d < ndev; d++)
+        {
+            panel[d] = (d == o) ? Ak : work[d];
+            ldp[d]   = (d == o) ? lda : n;
+        }
+        HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, o, active, [&](int d, hipStream_t stream) {
+            return hipsolver_mg_copy_panel(work[d], n, Ak, lda, r0 + kb, kb, stream);
+        }));
+
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            rocblas_handle handle = mg->devices[d].handle;
+            const int      nloc   = int(descB->local_cols(d, nrhs));
+            T*             Bk     = B[d] + r0;
+            HIPSOLVER_MG_CHECK(mg->use(d));
+            if(r0 > 0)
+                HIPSOLVER_MG_CHECK(hipsolver_mg_gemm(handle,
+                                                     trans,
+                                                     rocblas_operation_none,
+                                                     kb,
+                                                     nloc,
+                                                     r0,
+                                                     panel[d],
+                                                     ldp[d],
+                                                     B[d],
+                                                     ldb,
+                                                     Bk,
+                                                     ldb));
+            HIPSOLVER_MG_CHECK(hipsolver_mg_trsm(handle,
+                                                 rocblas_side_left,
+                                                 rocblas_fill_upper,
+                                                 trans,
+                                                 rocblas_diagonal_non_unit,
+                                                 kb,
+                                                 nloc,
+                                                 panel[d] + r0,
+                                                 ldp[d],
+                                                 Bk,
+                                                 ldb));
+        }
+    }
+
+    // back substitution with op(L), using rows r0 to n - 1 of the panels
+    for(int64_t k = nblocks - 1; k >= 0; k--)
+    {
+        const int o    = descA->owner(k);
+        const int r0   = int(k * descA->nb);
+        const int kb   = int(std::min<int64_t>(descA->nb, n - r0));
+        const int rest = n - r0 - kb;
+        T*        Ak   = A[o] + r0 + descA->local_col(k) * lda;
+
+        for(int d = 0; d < ndev; d++)
+        {
+            panel[d] = (d == o) ? Ak : work[d];
+            ldp[d]   = (d == o) ? lda : n;
+        }
+        HIPSOLVER_MG_CHECK(hipsolver_mg_broadcast(*mg, o, active, [&](int d, hipStream_t stream) {
+            return hipsolver_mg_copy_panel(work[d], n, Ak, lda, n - r0, kb, stream);
+        }));
+
+        for(int d = 0; d < ndev; d++)
+        {
+            if(!active[d])
+                continue;
+
+            rocblas_handle handle = mg->devices[d].handle;
+            const int      nloc   = int(descB->local_cols(d, nrhs));
+            T*             Bk     = B[d] + r0;
+            HIPSOLVER_MG_CHECK(mg->use(d));
+            if(rest > 0)
+                HIPSOLVER_MG_CHECK(hipsolver_mg_gemm(handle,
+                                                     trans,
+                                                     rocblas_operation_none,
+                                                     kb,
+                                                     nloc,
+                                                     rest,
+                                                     panel[d] + kb,
+                                                     ldp[d],
+                                                     Bk + kb,
+                                                     ldb,
+                                                     Bk,
+                                                     ldb));
+            HIPSOLVER_MG_CHECK(hipsolver_mg_trsm(handle,
+                                                 rocblas_side_left,
+                                                 rocblas_fill_lower,
+                                                 trans,
+                                                 rocblas_diagonal_unit,
+                                                 kb,
+                                                 nloc,
+                                                 panel[d],
+                                                 ldp[d],
+                                                 Bk,
+                                                 ldb));
+        }
+    }
+    return rocblas_status_success;
+}
+
+/*! \brief Solves op(A) * X = B with the LU factorization computed by hipsolver_mg_getrf. */
+template <typename T>
+rocblas_status hipsolver_mg_getrs(hipsolver_mg_handle*     mg,
+                                  rocblas_operation        trans,
+                                  int                      n,
+                                  int                      nrhs,
+                                  T*                       A[],
+                                  const hipsolver_mg_desc* descA,
+                                  int*                     ipiv[],
+                                  T*                       B[],
+                                  const hipsolver_mg_desc* descB,
+                                  T*                       work[],
+                                  int64_t                  lwork,
+                                  int*                     info)
+{
+    int64_t size;
+    HIPSOLVER_MG_CHECK(
+        hipsolver_mg_getrs_bufferSize(mg, trans, n, nrhs, A, descA, descB, &size));
+    if(!A || !ipiv || !B || !work || !info)
+        return rocblas_status_invalid_pointer;
+    if(lwork < size)
+        return rocblas_status_invalid_size;
+
+    *info = 0;
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    hipsolver_mg_device_guard guard;
+    const int                 ndev = mg->count();
+    const int                 ldb  = int(descB->rows);
+
+    std::vector<int*> pivots(ndev);
+    std::vector<bool> active(ndev);
+    for(int d = 0; d < ndev; d++)
+    {
+        pivots[d] = (int*)(work[d] + n * descA->nb);
+        active[d] = descB->local_cols(d, nrhs) > 0;
+    }
+
+    // gather the pivots
+    std::vector<int> global(n);
+    for(int d = 0; d < ndev; d++)
+    {
+        const int64_t count = descA->local_cols(d, n);
+        if(count == 0)
+            continue;
+
+        std::vector<int> local(count);
+        HIPSOLVER_MG_CHECK(mg->use(d));
+        HIPSOLVER_MG_CHECK_HIP(
+            hipMemcpy(local.data(), ipiv[d], sizeof(int) * count, hipMemcpyDeviceToHost));
+        for(int64_t c = 0; c < count; c++)
+            global[(c / descA->nb * ndev + d) * descA->nb + c % descA->nb] = local[c];
+    }
+
+    // the interchanges are applied to B before solving A * X = B, and in reverse order to the
+    // solution of op(A) * X = B otherwise
+    const bool none = trans == rocblas_operation_none;
+    if(!none)
+        HIPSOLVER_MG_CHECK(
+            hipsolver_mg_getrs_trans(mg, trans, n, nrhs, A, descA, B, descB, work, active));
+    for(int d = 0; d < ndev; d++)
+    {
+        if(!active[d])
+            continue;
+
+        HIPSOLVER_MG_CHECK(mg->use(d));
+        HIPSOLVER_MG_CHECK_HIP(
+            hipMemcpy(pivots[d], global.data(), sizeof(int) * n, hipMemcpyHostToDevice));
+        HIPSOLVER_MG_CHECK(hipsolver_mg_laswp(mg->devices[d].handle,
+                                              int(descB->local_cols(d, nrhs)),
+                                              B[d],
+                                              ldb,
+                                              n,
+                                              pivots[d],
+                                              none ? 1 : -1));
+    }
+    if(none)
+        HIPSOLVER_MG_CHECK(hipsolver_mg_getrs_none(mg, n, nrhs, A, descA, B, descB, work, active));
+
+    return mg->synchronize();
+}
+
+/******************** SYEVD ********************/
+template <typename T, typename S>
+rocblas_status hipsolver_mg_syevd_bufferSize(const hipsolver_mg_handle* mg,
+                                             rocblas_evect              evect,
+                                             rocblas_fill               uplo,
+                                             int                        n,
+                                             T*                         A[],
+                                             const hipsolver_mg_desc*   desc,
+                                             S*                         W,
+                                             int64_t*                   lwork)
+{
+    if(!mg || mg->devices.empty())
+        return rocblas_status_invalid_handle;
+    if(!desc || !lwork)
+        return rocblas_status_invalid_pointer;
+    if(desc->ndev != mg->count())
+        return rocblas_status_invalid_value;
+    if(n < 0 || desc->rows < n || desc->cols < n)
+        return rocblas_status_invalid_size;
+    if((evect != rocblas_evect_none && evect != rocblas_evect_original)
+       || (uplo != rocblas_fill_lower && uplo != rocblas_fill_upper))
+        return rocblas_status_invalid_value;
+
+    // the whole matrix, its eigenvalues and the off-diagonal of its tridiagonal form, of the real
+    // type, and the info; only the workspace of the first device is used
+    *lwork = hipsolver_mg_work_size<T>(int64_t(n) * n + 2 * n, 1);
+    return rocblas_status_success;
+}
+
+/*! \brief Computes the eigenvalues W of the Hermitian matrix A, given by its triangle uplo, and
+    its eigenvectors in A if evect is rocblas_evect_original.
+
+    The matrix is gathered on the first device, unless it is the only one, and solved there by
+    rocSOLVER; the eigenvectors are then distributed back. */
+template <typename T, typename S>
+rocblas_status hipsolver_mg_syevd(hipsolver_mg_handle*     mg,
+                                  rocblas_evect            evect,
+                                  rocblas_fill             uplo,
+                                  int                      n,
+                                  T*                       A[],
+                                  const hipsolver_mg_desc* desc,
+                                  S*                       W,
+                                  T*                       work[],
+                                  int64_t                  lwork,
+                                  int*                     info)
+{
+    int64_t size;
+    HIPSOLVER_MG_CHECK(hipsolver_mg_syevd_bufferSize(mg, evect, uplo, n, A, desc, W, &size));
+    if(!A || !W || !work || !info)
+        return rocblas_status_invalid_pointer;
+    if(lwork < size)
+        return rocblas_status_invalid_size;
+
+    *info = 0;
+    if(n == 0)
+        return rocblas_status_success;
+
+    hipsolver_mg_device_guard  guard;
+    const hipsolver_mg_device& first   = mg->devices[0];
+    const int                  lda     = int(desc->rows);
+    const int64_t              nblocks = desc->blocks(n);
+    const bool                 gather  = mg->count() > 1;
+
+    // with a single device, the columns of A are already contiguous
+    T*   G     = gather ? work[0] : A[0];
+    int  ldg   = gather ? n : lda;
+    S*   D     = (S*)(work[0] + int64_t(n) * n);
+    S*   E     = D + n;
+    int* dinfo = (int*)(work[0] + int64_t(n) * n + 2 * n);
+
+    HIPSOLVER_MG_CHECK(mg->use(0));
+    for(int64_t k = 0; k < nblocks && gather; k++)
+    {
+        const int r0 = int(k * desc->nb);
+        const int kb = int(std::min<int64_t>(desc->nb, n - r0));
+        const T*  Ak = A[desc->owner(k)] + desc->local_col(k) * lda;
+        HIPSOLVER_MG_CHECK_HIP(
+            hipsolver_mg_copy_panel(G + r0 * int64_t(ldg), ldg, Ak, lda, n, kb, first.stream));
+    }
+
+    HIPSOLVER_MG_CHECK(hipsolver_mg_syevd(first.handle, evect, uplo, n, G, ldg, D, E, dinfo));
+
+    for(int64_t k = 0; k < nblocks && gather && evect == rocblas_evect_original; k++)
+    {
+        const int r0 = int(k * desc->nb);
+        const int kb = int(std::min<int64_t>(desc->nb, n - r0));
+        T*        Ak = A[desc->owner(k)] + desc->local_col(k) * lda;
+        HIPSOLVER_MG_CHECK_HIP(
+            hipsolver_mg_copy_panel(Ak, lda, G + r0 * int64_t(ldg), ldg, n, kb, first.stream));
+    }
+
+    HIPSOLVER_MG_CHECK_HIP(
+        hipMemcpyAsync(W, D, sizeof(S) * n, hipMemcpyDeviceToHost, first.stream));
+    HIPSOLVER_MG_CHECK_HIP(
+        hipMemcpyAsync(info, dinfo, sizeof(int), hipMemcpyDeviceToHost, first.stream));
+    return mg->synchronize();
+}
@@ -0,0 +1,452 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_capture.hpp"
+#include "hipsolver_handle.hpp"
+#include "rocblas.h"
+#include "rocsolver.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/*
+ * Mixed precision solvers.
+ *
+ * The matrix is factorized in the lower precision, and the solution is refined with residuals
+ * computed in the working precision, following LAPACK's dsgesv and zcgesv. rocSOLVER and rocBLAS
+ * provide no conversion between precisions, so the conversions are done on the host, and the
+ * refinement loop synchronizes the stream on every iteration. This costs O(n^2) transfers,
+ * against the O(n^3) factorization that is moved to the lower precision.
+ */
+
+// largest number of refinement steps before falling back to the working precision
+constexpr int hipsolver_refine_max_iters = 30;
+
+/******************** PRECISION TRAITS ********************/
+template <typename T>
+struct hipsolver_refine_traits;
+
+template <>
+struct hipsolver_refine_traits<double>
+{
+    using lower = float;
+    using real  = double;
+};
+
+template <>
+struct hipsolver_refine_traits<rocblas_double_complex>
+{
+    using lower = rocblas_float_complex;
+    using real  = double;
+};
+
+/******************** ROCSOLVER DISPATCH ********************/
+inline rocblas_status hipsolver_refine_getrf(
+    rocblas_handle handle, int n, float* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_sgetrf(handle, n, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_refine_getrf(
+    rocblas_handle handle, int n, double* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_dgetrf(handle, n, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_refine_getrf(
+    rocblas_handle handle, int n, rocblas_float_complex* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_cgetrf(handle, n, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_refine_getrf(
+    rocblas_handle handle, int n, rocblas_double_complex* A, int lda, int* ipiv, int* info)
+{
+    return rocsolver_zgetrf(handle, n, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status hipsolver_refine_getrs(
+    rocblas_handle handle, int n, int nrhs, float* A, int lda, int* ipiv, float* B, int ldb)
+{
+    return rocsolver_sgetrs(handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status hipsolver_refine_getrs(
+    rocblas_handle handle, int n, int nrhs, double* A, int lda, int* ipiv, double* B, int ldb)
+{
+    return rocsolver_dgetrs(handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status hipsolver_refine_getrs(rocblas_handle         handle,
+                                             int                    n,
+                                             int                    nrhs,
+                                             rocblas_float_complex* A,
+                                             int                    lda,
+                                             int*                   ipiv,
+                                             rocblas_float_complex* B,
+                                             int                    ldb)
+{
+    return rocsolver_cgetrs(handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status hipsolver_refine_getrs(rocblas_handle          handle,
+                                             int                     n,
+                                             int                     nrhs,
+                                             rocblas_double_complex* A,
+                                             int                     lda,
+                                             int*                    ipiv,
+                                             rocblas_double_complex* B,
+                                             int                     ldb)
+{
+    return rocsolver_zgetrs(handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+/*! \brief Computes R = R - A * X. */
+inline rocblas_status hipsolver_refine_residual(rocblas_handle handle,
+                                                int            n,
+                                                int            nrhs,
+                                                const double*  A,
+                                                int            lda,
+                                                const double*  X,
+                                                int            ldx,
+                                                double*        R,
+                                                int            ldr)
+{
+    double alpha = -1, beta = 1;
+    return rocblas_dgemm(handle,
+                         rocblas_operation_none,
+                         rocblas_operation_none,
+                         n,
+                         nrhs,
+                         n,
+                         &alpha,
+                         A,
+                         lda,
+                         X,
+                         ldx,
+                         &beta,
+                         R,
+                         ldr);
+}
+
+/*! \brief Computes R = R - A * X. */
+inline rocblas_status hipsolver_refine_residual(rocblas_handle                handle,
+                                                int                           n,
+                                                int                           nrhs,
+                                                const rocblas_double_complex* A,
+                                                int                           lda,
+                                                const rocblas_double_complex* X,
+                                                int                           ldx,
+                                                rocblas_double_complex*       R,
+                                                int                           ldr)
+{
+    rocblas_double_complex alpha = {-1, 0}, beta = {1, 0};
+    return rocblas_zgemm(handle,
+                         rocblas_operation_none,
+                         rocblas_operation_none,
+                         n,
+                         nrhs,
+                         n,
+                         &alpha,
+                         A,
+                         lda,
+                         X,
+                         ldx,
+                         &beta,
+                         R,
+                         ldr);
+}
+
+/******************** HOST CONVERSIONS ********************/
+// Complex values are handled as pairs of real values, which have the same layout.
+
+/*! \brief Rounds count real values to single precision; returns false if any would overflow. */
+inline bool hipsolver_refine_round(float* dst, const double* src, size_t count)
+{
+    const double big = std::numeric_limits<float>::max();
+    for(size_t i = 0; i < count; i++)
+    {
+        if(std::abs(src[i]) > big)
+            return false;
+        dst[i] = float(src[i]);
+    }
+    return true;
+}
+
+/*! \brief Largest |re| + |im| of the n values of src, each made of ncomp real components. */
+inline double hipsolver_refine_max_abs1(const double* src, int n, int ncomp)
+{
+    double result = 0;
+    for(int i = 0; i < n; i++)
+    {
+        double v = 0;
+        for(int k = 0; k < ncomp; k++)
+            v += std::abs(src[size_t(i) * ncomp + k]);
+        result = std::max(result, v);
+    }
+    return result;
+}
+
+/*! \brief Infinity norm of the compact n-by-n matrix A, each entry made of ncomp components. */
+inline double hipsolver_refine_norm_inf(const double* A, int n, int ncomp)
+{
+    std::vector<double> row_sums(n, 0);
+    for(size_t j = 0; j < size_t(n); j++)
+    {
+        for(int i = 0; i < n; i++)
+        {
+            double sq = 0;
+            for(int k = 0; k < ncomp; k++)
+            {
+                double v = A[(i + j * n) * ncomp + k];
+                sq += v * v;
+            }
+            row_sums[i] += std::sqrt(sq);
+        }
+    }
+    return n > 0 ? *std::max_element(row_sums.begin(), row_sums.end()) : 0;
+}
+
+/******************** GESV ********************/
+/*! \brief Bytes of temporary storage used by the mixed precision solver, besides the rocSOLVER
+ *  workspace: the lower precision matrix and right-hand sides and the working precision
+ *  residual.
+ */
+template <typename T>
+inline size_t hipsolver_refine_tmp_size(int n, int nrhs)
+{
+    using S = typename hipsolver_refine_traits<T>::lower;
+
+    size_t nn = size_t(n) * n, nr = size_t(n) * nrhs;
+    return hipsolver_handle_data::align(sizeof(S) * nn)
+           + hipsolver_handle_data::align(sizeof(S) * nr)
+           + hipsolver_handle_data::align(sizeof(T) * nr);
+}
+
+/*! \brief Total workspace in bytes of the mixed precision solver, including the temporary
+ *  storage at its front.
+ */
+template <typename T>
+inline rocblas_status hipsolver_refine_gesv_bufferSize(
+    rocblas_handle handle, int n, int nrhs, int lda, int ldx, size_t* lwork)
+{
+    using S = typename hipsolver_refine_traits<T>::lower;
+
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldx < std::max(1, n))
+        return rocblas_status_invalid_size;
+
+    // the lower precision matrix and right-hand sides are stored compactly
+    int    ldc = std::max(1, n);
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle);
+    hipsolver_refine_getrf(handle, n, (S*)nullptr, ldc, nullptr, nullptr);
+    hipsolver_refine_getrs(handle, n, nrhs, (S*)nullptr, ldc, nullptr, nullptr, ldc);
+    hipsolver_refine_getrf(handle, n, (T*)nullptr, lda, nullptr, nullptr);
+    hipsolver_refine_getrs(handle, n, nrhs, (T*)nullptr, lda, nullptr, nullptr, ldx);
+    rocblas_status status = rocblas_stop_device_memory_size_query(handle, &sz);
+    if(status != rocblas_status_success)
+        return status;
+
+    *lwork = hipsolver_refine_tmp_size<T>(n, nrhs) + sz;
+    return rocblas_status_success;
+}
+
+/*! \brief Solves A * X = B by factorizing A in the lower precision and refining X.
+ *
+ *  The rocSOLVER workspace of handle must already be set, and tmp must hold
+ *  hipsolver_refine_tmp_size<T>(n, nrhs) bytes. On return, niters is the number of refinement
+ *  steps if the refinement converged, or else a negative value indicating why the system was
+ *  solved in the working precision instead:
+ *  -2 if a value overflowed the lower precision, -3 if the lower precision factorization failed,
+ *  and -(hipsolver_refine_max_iters + 1) if the refinement did not converge. In the last two
+ *  cases, and only then, A is overwritten with its working precision factorization.
+ */
+template <typename T>
+rocblas_status hipsolver_refine_gesv(rocblas_handle handle,
+                                     int            n,
+                                     int            nrhs,
+                                     T*             A,
+                                     int            lda,
+                                     int*           ipiv,
+                                     T*             B,
+                                     int            ldb,
+                                     T*             X,
+                                     int            ldx,
+                                     void*          tmp,
+                                     int*           niters,
+                                     int*           devInfo)
+{
+    using S = typename hipsolver_refine_traits<T>::lower;
+    using R = typename hipsolver_refine_traits<T>::real;
+
+    // number of real components of each value
+    const int c = int(sizeof(T) / sizeof(R));
+
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || ldx < std::max(1, n))
+        return rocblas_status_invalid_size;
+    if(!niters || !devInfo || (n && (!A || !ipiv)) || (n && nrhs && (!B || !X)))
+        return rocblas_status_invalid_pointer;
+
+    hipStream_t stream;
+    rocblas_status status = rocblas_get_stream(handle, &stream);
+    if(status != rocblas_status_success)
+        return status;
+
+    // every refinement step waits for the device
+    hipsolver_forbid_capture(stream);
+
+    *niters = 0;
+    if(hipMemsetAsync(devInfo, 0, sizeof(int), stream) != hipSuccess)
+        return rocblas_status_internal_error;
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    size_t nn = size_t(n) * n, nr = size_t(n) * nrhs;
+    S*     As = (S*)tmp;
+    S*     Rs = (S*)((char*)As + hipsolver_handle_data::align(sizeof(S) * nn));
+    T*     Rd = (T*)((char*)Rs + hipsolver_handle_data::align(sizeof(S) * nr));
+
+    std::vector<R>     hA(c * nn), hX(c * nr), hR(c * nr);
+    std::vector<float> hS(c * std::max(nn, nr));
+    int                info = 0;
+
+    auto sync = [&]() { return hipStreamSynchronize(stream) == hipSuccess; };
+    auto copy2d = [&](void* dst, int ldd, const void* src, int lds, int cols, hipMemcpyKind kind) {
+        return hipMemcpy2DAsync(dst,
+                                sizeof(T) * ldd,
+                                src,
+                                sizeof(T) * lds,
+                                sizeof(T) * n,
+                                cols,
+                                kind,
+                                stream)
+               == hipSuccess;
+    };
+    auto upload_x = [&]() { return copy2d(X, ldx, hX.data(), n, nrhs, hipMemcpyHostToDevice); };
+    auto solve_lower = [&](const R* rhs, bool& overflow) {
+        // rounds rhs, solves with the lower precision factors, and returns the result in hS
+        overflow = !hipsolver_refine_round(hS.data(), rhs, c * nr);
+        if(overflow)
+            return true;
+        if(hipMemcpyAsync(Rs, hS.data(), sizeof(S) * nr, hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+            return false;
+        if(hipsolver_refine_getrs(handle, n, nrhs, As, n, ipiv, Rs, n) != rocblas_status_success)
+            return false;
+        if(hipMemcpyAsync(hS.data(), Rs, sizeof(S) * nr, hipMemcpyDeviceToHost, stream)
+           != hipSuccess)
+            return false;
+        return sync();
+    };
+
+    int  iter     = 0;
+    bool overflow = false;
+
+    // factorize A in the lower precision
+    if(!copy2d(hA.data(), n, A, lda, n, hipMemcpyDeviceToHost) || !sync())
+        return rocblas_status_internal_error;
+
+    const R anrm = hipsolver_refine_norm_inf(hA.data(), n, c);
+    const R cte  = anrm * std::numeric_limits<R>::epsilon() / 2 * std::sqrt(R(n));
+
+    if(!hipsolver_refine_round(hS.data(), hA.data(), c * nn))
+        iter = -2;
+    else
+    {
+        if(hipMemcpyAsync(As, hS.data(), sizeof(S) * nn, hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+            return rocblas_status_internal_error;
+        status = hipsolver_refine_getrf(handle, n, As, n, ipiv, devInfo);
+        if(status != rocblas_status_success)
+            return status;
+        if(hipMemcpyAsync(&info, devInfo, sizeof(int), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || !sync())
+            return rocblas_status_internal_error;
+        if(info != 0)
+            iter = -3;
+    }
+
+    // initial solution from the lower precision factors
+    if(iter == 0)
+    {
+        if(!copy2d(hR.data(), n, B, ldb, nrhs, hipMemcpyDeviceToHost) || !sync())
+            return rocblas_status_internal_error;
+        if(!solve_lower(hR.data(), overflow))
+            return rocblas_status_internal_error;
+        if(overflow)
+            iter = -2;
+        else
+        {
+            for(size_t i = 0; i < c * nr; i++)
+                hX[i] = R(hS[i]);
+            if(!upload_x())
+                return rocblas_status_internal_error;
+        }
+    }
+
+    // refine until the residual of every column is at the level of the working precision
+    for(int step = 0; iter == 0; step++)
+    {
+        if(!copy2d(Rd, n, B, ldb, nrhs, hipMemcpyDeviceToDevice))
+            return rocblas_status_internal_error;
+        status = hipsolver_refine_residual(handle, n, nrhs, A, lda, X, ldx, Rd, n);
+        if(status != rocblas_status_success)
+            return status;
+        if(hipMemcpyAsync(hR.data(), Rd, sizeof(T) * nr, hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || !sync())
+            return rocblas_status_internal_error;
+
+        bool converged = true;
+        for(int j = 0; j < nrhs && converged; j++)
+        {
+            R xnrm    = hipsolver_refine_max_abs1(hX.data() + size_t(j) * n * c, n, c);
+            R rnrm    = hipsolver_refine_max_abs1(hR.data() + size_t(j) * n * c, n, c);
+            converged = rnrm <= xnrm * cte;
+        }
+        if(converged)
+        {
+            *niters = step;
+            return rocblas_status_success;
+        }
+        if(step == hipsolver_refine_max_iters)
+        {
+            iter = -(hipsolver_refine_max_iters + 1);
+            break;
+        }
+
+        // X = X + A^-1 * R, with the correction computed in the lower precision
+        if(!solve_lower(hR.data(), overflow))
+            return rocblas_status_internal_error;
+        if(overflow)
+        {
+            iter = -2;
+            break;
+        }
+        for(size_t i = 0; i < c * nr; i++)
+            hX[i] += R(hS[i]);
+        if(!upload_x())
+            return rocblas_status_internal_error;
+    }
+
+    // fall back to the working precision
+    *niters = iter;
+    if(!copy2d(X, ldx, B, ldb, nrhs, hipMemcpyDeviceToDevice))
+        return rocblas_status_internal_error;
+    status = hipsolver_refine_getrf(handle, n, A, lda, ipiv, devInfo);
+    if(status != rocblas_status_success)
+        return status;
+    if(hipMemcpyAsync(&info, devInfo, sizeof(int), hipMemcpyDeviceToHost, stream) != hipSuccess
+       || !sync())
+        return rocblas_status_internal_error;
+
+    // as in LAPACK, no solution is computed if A is singular
+    if(info != 0)
+        return rocblas_status_success;
+    return hipsolver_refine_getrs(handle, n, nrhs, A, lda, ipiv, X, ldx);
+}
@@ -0,0 +1,556 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_sp.hpp"
+#include "rocblas.h"
+#include "rocsparse.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Sparse LU refactorization.
+ *
+ * The setup combines the L and U factors given by the user into a single bundled matrix
+ * M = L - I + U with the sparsity pattern of the factorization of P * A * Q, and records where
+ * every nonzero of A lands in M. The analysis of M is done once by rocSPARSE. A refactorization
+ * scatters the current values of A into M, which is zero elsewhere, and runs an incomplete LU
+ * factorization without fill-in on M; since the pattern of M already holds all the fill-in of
+ * the factorization, it computes the exact factors. A solve gathers the right-hand side through
+ * P, runs the two triangular solves on M, and scatters the result through Q.
+ *
+ * As in cuSOLVER, the indices are zero-based, the matrices are in double precision, and the
+ * batched functions share the pattern, the permutations and the analysis among all the
+ * matrices of the batch.
+ */
+
+#define HIPSOLVER_RF_CHECK(STATUS)                \
+    do                                            \
+    {                                             \
+        rocblas_status _status = (STATUS);        \
+        if(_status != rocblas_status_success)     \
+            return _status;                       \
+    } while(0)
+
+#define HIPSOLVER_RF_CHECK_HIP(ERROR)             \
+    do                                            \
+    {                                             \
+        if((ERROR) != hipSuccess)                 \
+            return rocblas_status_internal_error; \
+    } while(0)
+
+#define HIPSOLVER_RF_CHECK_ROCSPARSE(STATUS)                         \
+    do                                                               \
+    {                                                                \
+        rocblas_status _status = rocsparse2rocblas_status((STATUS)); \
+        if(_status != rocblas_status_success)                        \
+            return _status;                                          \
+    } while(0)
+
+struct hipsolver_rf_handle
+{
+    rocsparse_handle    sparse  = nullptr;
+    rocsparse_mat_descr descr_M = nullptr; // general, for the factorization
+    rocsparse_mat_descr descr_L = nullptr; // unit lower triangle of M
+    rocsparse_mat_descr descr_U = nullptr; // upper triangle of M
+    rocsparse_mat_info  info    = nullptr;
+
+    int  batch    = 0; // zero until the matrices have been set up
+    int  n        = 0;
+    int  nnzA     = 0;
+    int  nnzM     = 0;
+    bool analysed = false;
+
+    // numeric properties; zero pivots are replaced by boost when boost is positive
+    double zero  = 0;
+    double boost = 0;
+
+    hipsolver_sp_buffer Mp, Mi, Mx; // bundled factors, with batch sets of values
+    hipsolver_sp_buffer Ax; // values of A, batch sets
+    hipsolver_sp_buffer map; // position in M of each nonzero of A
+    hipsolver_sp_buffer temp; // second right-hand side of the non-batched solve
+    hipsolver_sp_buffer buffer; // rocSPARSE temporary storage
+
+    std::vector<int> positions; // zero pivot of each matrix after the last refactorization
+
+    hipsolver_rf_handle() = default;
+    ~hipsolver_rf_handle()
+    {
+        if(info)
+            rocsparse_destroy_mat_info(info);
+        if(descr_M)
+            rocsparse_destroy_mat_descr(descr_M);
+        if(descr_L)
+            rocsparse_destroy_mat_descr(descr_L);
+        if(descr_U)
+            rocsparse_destroy_mat_descr(descr_U);
+        if(sparse)
+            rocsparse_destroy_handle(sparse);
+    }
+
+    hipsolver_rf_handle(const hipsolver_rf_handle&) = delete;
+    hipsolver_rf_handle& operator=(const hipsolver_rf_handle&) = delete;
+
+    rocblas_status init()
+    {
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_create_handle(&sparse));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_create_mat_descr(&descr_M));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_create_mat_descr(&descr_L));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_create_mat_descr(&descr_U));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_create_mat_info(&info));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(
+            rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(
+            rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(
+            rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(
+            rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit));
+        return rocblas_status_success;
+    }
+
+    int* rowPtr() const
+    {
+        return (int*)Mp.data;
+    }
+    int* colInd() const
+    {
+        return (int*)Mi.data;
+    }
+    double* values(int b) const
+    {
+        return (double*)Mx.data + size_t(b) * nnzM;
+    }
+};
+
+/******************** SETUP ********************/
+/*! \brief Builds the bundled factors of the batch from the factors of the first matrix, given
+ *  on the host, and uploads them with the values of A. L must store its unit diagonal, which
+ *  is skipped, and every nonzero of P * A * Q must belong to the pattern of L + U.
+ */
+inline rocblas_status hipsolver_rf_setup(hipsolver_rf_handle* rf,
+                                         int                  batch,
+                                         int                  n,
+                                         int                  nnzA,
+                                         const int*           Ap,
+                                         const int*           Ai,
+                                         const double* const* Ax,
+                                         int                  nnzL,
+                                         const int*           Lp,
+                                         const int*           Li,
+                                         const double*        Lx,
+                                         int                  nnzU,
+                                         const int*           Up,
+                                         const int*           Ui,
+                                         const double*        Ux,
+                                         const int*           P,
+                                         const int*           Q)
+{
+    if(!rf)
+        return rocblas_status_invalid_handle;
+    if(batch < 1 || n < 0 || nnzA < 0 || nnzL < 0 || nnzU < 0)
+        return rocblas_status_invalid_size;
+    if(!Ap || !Lp || !Up || (n > 0 && (!P || !Q)) || (nnzA > 0 && (!Ai || !Ax))
+       || (nnzL > 0 && (!Li || !Lx)) || (nnzU > 0 && (!Ui || !Ux)))
+        return rocblas_status_invalid_pointer;
+    for(int b = 0; b < batch && nnzA > 0; b++)
+        if(!Ax[b])
+            return rocblas_status_invalid_pointer;
+    if(Ap[n] != nnzA || Lp[n] != nnzL || Up[n] != nnzU)
+        return rocblas_status_invalid_value;
+
+    // Q is inverted to find the column of M of every nonzero of A
+    std::vector<int>  Qinv(n, -1);
+    std::vector<bool> Pseen(n, false);
+    for(int j = 0; j < n; j++)
+    {
+        if(P[j] < 0 || P[j] >= n || Q[j] < 0 || Q[j] >= n || Pseen[P[j]] || Qinv[Q[j]] >= 0)
+            return rocblas_status_invalid_value;
+        Pseen[P[j]] = true;
+        Qinv[Q[j]]  = j;
+    }
+
+    // merge the strictly lower triangle of L with the upper triangle of U, row by row
+    std::vector<int>                    hMp(n + 1, 0), hMi;
+    std::vector<double>                 hMx;
+    std::vector<std::pair<int, double>> row;
+    for(int i = 0; i < n; i++)
+    {
+        row.clear();
+        for(int k = Lp[i]; k < Lp[i + 1]; k++)
+            if(Li[k] < i)
+                row.emplace_back(Li[k], Lx[k]);
+        for(int k = Up[i]; k < Up[i + 1]; k++)
+            if(Ui[k] >= i)
+                row.emplace_back(Ui[k], Ux[k]);
+        std::sort(row.begin(), row.end());
+        for(const auto& e : row)
+        {
+            hMi.push_back(e.first);
+            hMx.push_back(e.second);
+        }
+        hMp[i + 1] = int(hMi.size());
+    }
+    int nnzM = hMp[n];
+
+    // row i of M holds row P[i] of A
+    std::vector<int> hmap(nnzA);
+    for(int i = 0; i < n; i++)
+    {
+        const int* first = hMi.data() + hMp[i];
+        const int* last  = hMi.data() + hMp[i + 1];
+        for(int k = Ap[P[i]]; k < Ap[P[i] + 1]; k++)
+        {
+            const int* pos = std::lower_bound(first, last, Qinv[Ai[k]]);
+            if(pos == last || *pos != Qinv[Ai[k]])
+                return rocblas_status_invalid_value;
+            hmap[k] = int(pos - hMi.data());
+        }
+    }
+
+    rf->batch    = 0;
+    rf->analysed = false;
+    HIPSOLVER_RF_CHECK(rf->Mp.reserve(sizeof(int) * (size_t(n) + 1)));
+    HIPSOLVER_RF_CHECK(rf->Mi.reserve(sizeof(int) * std::max(nnzM, 1)));
+    HIPSOLVER_RF_CHECK(rf->Mx.reserve(sizeof(double) * std::max(nnzM, 1) * batch));
+    HIPSOLVER_RF_CHECK(rf->Ax.reserve(sizeof(double) * std::max(nnzA, 1) * batch));
+    HIPSOLVER_RF_CHECK(rf->map.reserve(sizeof(int) * std::max(nnzA, 1)));
+    HIPSOLVER_RF_CHECK(rf->temp.reserve(sizeof(double) * std::max(n, 1)));
+
+    HIPSOLVER_RF_CHECK_HIP(
+        hipMemcpy(rf->Mp.data, hMp.data(), sizeof(int) * (n + 1), hipMemcpyHostToDevice));
+    HIPSOLVER_RF_CHECK_HIP(
+        hipMemcpy(rf->Mi.data, hMi.data(), sizeof(int) * nnzM, hipMemcpyHostToDevice));
+    HIPSOLVER_RF_CHECK_HIP(
+        hipMemcpy(rf->map.data, hmap.data(), sizeof(int) * nnzA, hipMemcpyHostToDevice));
+    for(int b = 0; b < batch; b++)
+    {
+        HIPSOLVER_RF_CHECK_HIP(hipMemcpy((double*)rf->Mx.data + size_t(b) * nnzM,
+                                         hMx.data(),
+                                         sizeof(double) * nnzM,
+                                         hipMemcpyHostToDevice));
+        HIPSOLVER_RF_CHECK_HIP(hipMemcpy((double*)rf->Ax.data + size_t(b) * nnzA,
+                                         Ax[b],
+                                         sizeof(double) * nnzA,
+                                         hipMemcpyHostToDevice));
+    }
+
+    rf->n     = n;
+    rf->nnzA  = nnzA;
+    rf->nnzM  = nnzM;
+    rf->batch = batch;
+    rf->positions.assign(batch, -1);
+    return rocblas_status_success;
+}
+
+/*! \brief Copies count values from the device to a host vector. */
+template <typename T>
+inline rocblas_status hipsolver_rf_download(const T* src, int count, std::vector<T>& dst)
+{
+    dst.resize(std::max(count, 0));
+    if(count > 0)
+        HIPSOLVER_RF_CHECK_HIP(
+            hipMemcpy(dst.data(), src, sizeof(T) * count, hipMemcpyDeviceToHost));
+    return rocblas_status_success;
+}
+
+/*! \brief As hipsolver_rf_setup, for factors given on the device. */
+inline rocblas_status hipsolver_rf_setup_device(hipsolver_rf_handle* rf,
+                                                int                  n,
+                                                int                  nnzA,
+                                                const int*           Ap,
+                                                const int*           Ai,
+                                                const double*        Ax,
+                                                int                  nnzL,
+                                                const int*           Lp,
+                                                const int*           Li,
+                                                const double*        Lx,
+                                                int                  nnzU,
+                                                const int*           Up,
+                                                const int*           Ui,
+                                                const double*        Ux,
+                                                const int*           P,
+                                                const int*           Q)
+{
+    if(!rf)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || nnzA < 0 || nnzL < 0 || nnzU < 0)
+        return rocblas_status_invalid_size;
+    if(!Ap || !Lp || !Up || (n > 0 && (!P || !Q)) || (nnzA > 0 && (!Ai || !Ax))
+       || (nnzL > 0 && (!Li || !Lx)) || (nnzU > 0 && (!Ui || !Ux)))
+        return rocblas_status_invalid_pointer;
+
+    std::vector<int>    hAp, hAi, hLp, hLi, hUp, hUi, hP, hQ;
+    std::vector<double> hAx, hLx, hUx;
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Ap, n + 1, hAp));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Ai, nnzA, hAi));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Ax, nnzA, hAx));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Lp, n + 1, hLp));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Li, nnzL, hLi));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Lx, nnzL, hLx));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Up, n + 1, hUp));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Ui, nnzU, hUi));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Ux, nnzU, hUx));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(P, n, hP));
+    HIPSOLVER_RF_CHECK(hipsolver_rf_download(Q, n, hQ));
+
+    const double* hAx_array[] = {hAx.data()};
+    return hipsolver_rf_setup(rf,
+                              1,
+                              n,
+                              nnzA,
+                              hAp.data(),
+                              hAi.data(),
+                              hAx_array,
+                              nnzL,
+                              hLp.data(),
+                              hLi.data(),
+                              hLx.data(),
+                              nnzU,
+                              hUp.data(),
+                              hUi.data(),
+                              hUx.data(),
+                              hP.data(),
+                              hQ.data());
+}
+
+/******************** ANALYSIS AND REFACTORIZATION ********************/
+inline rocblas_status hipsolver_rf_analyze(hipsolver_rf_handle* rf)
+{
+    if(!rf)
+        return rocblas_status_invalid_handle;
+    if(!rf->batch)
+        return rocblas_status_invalid_value; // the matrices were not set up
+
+    int     n = rf->n, nnz = rf->nnzM;
+    size_t  size_M, size_L, size_U;
+    double* Mx = rf->values(0);
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrilu0_buffer_size(
+        rf->sparse, n, nnz, rf->descr_M, Mx, rf->rowPtr(), rf->colInd(), rf->info, &size_M));
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrsv_buffer_size(rf->sparse,
+                                                              rocsparse_operation_none,
+                                                              n,
+                                                              nnz,
+                                                              rf->descr_L,
+                                                              Mx,
+                                                              rf->rowPtr(),
+                                                              rf->colInd(),
+                                                              rf->info,
+                                                              &size_L));
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrsv_buffer_size(rf->sparse,
+                                                              rocsparse_operation_none,
+                                                              n,
+                                                              nnz,
+                                                              rf->descr_U,
+                                                              Mx,
+                                                              rf->rowPtr(),
+                                                              rf->colInd(),
+                                                              rf->info,
+                                                              &size_U));
+    HIPSOLVER_RF_CHECK(rf->buffer.reserve(std::max({size_M, size_L, size_U, size_t(1)})));
+
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrilu0_analysis(rf->sparse,
+                                                             n,
+                                                             nnz,
+                                                             rf->descr_M,
+                                                             Mx,
+                                                             rf->rowPtr(),
+                                                             rf->colInd(),
+                                                             rf->info,
+                                                             rocsparse_analysis_policy_reuse,
+                                                             rocsparse_solve_policy_auto,
+                                                             rf->buffer.data));
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrsv_analysis(rf->sparse,
+                                                           rocsparse_operation_none,
+                                                           n,
+                                                           nnz,
+                                                           rf->descr_L,
+                                                           Mx,
+                                                           rf->rowPtr(),
+                                                           rf->colInd(),
+                                                           rf->info,
+                                                           rocsparse_analysis_policy_reuse,
+                                                           rocsparse_solve_policy_auto,
+                                                           rf->buffer.data));
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrsv_analysis(rf->sparse,
+                                                           rocsparse_operation_none,
+                                                           n,
+                                                           nnz,
+                                                           rf->descr_U,
+                                                           Mx,
+                                                           rf->rowPtr(),
+                                                           rf->colInd(),
+                                                           rf->info,
+                                                           rocsparse_analysis_policy_reuse,
+                                                           rocsparse_solve_policy_auto,
+                                                           rf->buffer.data));
+
+    rf->analysed = true;
+    return rocblas_status_success;
+}
+
+/*! \brief Replaces the values of A for the matrices of the batch. The pattern and the
+ *  permutations must be the ones given to the setup; only the values are read.
+ */
+inline rocblas_status hipsolver_rf_reset_values(hipsolver_rf_handle* rf,
+                                                int                  batch,
+                                                int                  n,
+                                                int                  nnzA,
+                                                const double* const* Ax)
+{
+    if(!rf)
+        return rocblas_status_invalid_handle;
+    if(!rf->batch || batch != rf->batch || n != rf->n || nnzA != rf->nnzA)
+        return rocblas_status_invalid_value;
+    if(!Ax)
+        return rocblas_status_invalid_pointer;
+    for(int b = 0; b < batch && nnzA > 0; b++)
+        if(!Ax[b])
+            return rocblas_status_invalid_pointer;
+
+    hipStream_t stream;
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_get_stream(rf->sparse, &stream));
+    for(int b = 0; b < batch; b++)
+        HIPSOLVER_RF_CHECK_HIP(hipMemcpyAsync((double*)rf->Ax.data + size_t(b) * nnzA,
+                                              Ax[b],
+                                              sizeof(double) * nnzA,
+                                              hipMemcpyDeviceToDevice,
+                                              stream));
+    return rocblas_status_success;
+}
+
+/*! \brief Refactorizes every matrix of the batch with the current values of A. position is
+ *  set to the first matrix with a zero pivot, or to -1 if there is none; the zero pivot of
+ *  each matrix is kept in the handle.
+ */
+inline rocblas_status hipsolver_rf_refactor(hipsolver_rf_handle* rf, int* position)
+{
+    if(!rf)
+        return rocblas_status_invalid_handle;
+    if(!rf->analysed)
+        return rocblas_status_invalid_value;
+
+    hipStream_t stream;
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_get_stream(rf->sparse, &stream));
+
+    *position = -1;
+    int n = rf->n, nnz = rf->nnzM;
+    for(int b = 0; b < rf->batch; b++)
+    {
+        double* Mx = rf->values(b);
+        HIPSOLVER_RF_CHECK_HIP(hipMemsetAsync(Mx, 0, sizeof(double) * nnz, stream));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dsctr(rf->sparse,
+                                                     rf->nnzA,
+                                                     (double*)rf->Ax.data + size_t(b) * rf->nnzA,
+                                                     (int*)rf->map.data,
+                                                     Mx,
+                                                     rocsparse_index_base_zero));
+
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrilu0_numeric_boost(
+            rf->sparse, rf->info, rf->boost > 0, &rf->zero, &rf->boost));
+        HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrilu0(rf->sparse,
+                                                        n,
+                                                        nnz,
+                                                        rf->descr_M,
+                                                        Mx,
+                                                        rf->rowPtr(),
+                                                        rf->colInd(),
+                                                        rf->info,
+                                                        rocsparse_solve_policy_auto,
+                                                        rf->buffer.data));
+
+        // the zero pivot is only available until the next factorization
+        rocsparse_status status
+            = rocsparse_csrilu0_zero_pivot(rf->sparse, rf->info, &rf->positions[b]);
+        if(status == rocsparse_status_success)
+            rf->positions[b] = -1;
+        else if(status != rocsparse_status_zero_pivot)
+            return rocsparse2rocblas_status(status);
+        else if(*position < 0)
+            *position = b;
+    }
+    return rocblas_status_success;
+}
+
+/******************** SOLVE ********************/
+/*! \brief Solves A * x = f for the matrix b of the batch, overwriting f with x. T1 and T2 are
+ *  two temporary vectors of size n.
+ */
+inline rocblas_status hipsolver_rf_solve(
+    hipsolver_rf_handle* rf, int b, const int* P, const int* Q, double* T1, double* T2, double* XF)
+{
+    const double one = 1;
+    int          n = rf->n, nnz = rf->nnzM;
+    double*      Mx = rf->values(b);
+
+    HIPSOLVER_RF_CHECK_ROCSPARSE(
+        rocsparse_dgthr(rf->sparse, n, XF, T1, P, rocsparse_index_base_zero));
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrsv_solve(rf->sparse,
+                                                        rocsparse_operation_none,
+                                                        n,
+                                                        nnz,
+                                                        &one,
+                                                        rf->descr_L,
+                                                        Mx,
+                                                        rf->rowPtr(),
+                                                        rf->colInd(),
+                                                        rf->info,
+                                                        T1,
+                                                        T2,
+                                                        rocsparse_solve_policy_auto,
+                                                        rf->buffer.data));
+    HIPSOLVER_RF_CHECK_ROCSPARSE(rocsparse_dcsrsv_solve(rf->sparse,
+                                                        rocsparse_operation_none,
+                                                        n,
+                                                        nnz,
+                                                        &one,
+                                                        rf->descr_U,
+                                                        Mx,
+                                                        rf->rowPtr(),
+                                                        rf->colInd(),
+                                                        rf->info,
+                                                        T2,
+                                                        T1,
+                                                        rocsparse_solve_policy_auto,
+                                                        rf->buffer.data));
+    HIPSOLVER_RF_CHECK_ROCSPARSE(
+        rocsparse_dsctr(rf->sparse, n, T1, Q, XF, rocsparse_index_base_zero));
+    return rocblas_status_success;
+}
+
+/*! \brief Solves the systems of the batch, whose right-hand sides are overwritten with the
+ *  solutions. As in cuSOLVER, there must be a single right-hand side per matrix. Temp holds two
+ *  vectors of leading dimension ldt for the batched solve, and one for the non-batched one.
+ */
+inline rocblas_status hipsolver_rf_solve_batch(hipsolver_rf_handle* rf,
+                                               bool                 batched,
+                                               const int*           P,
+                                               const int*           Q,
+                                               int                  nrhs,
+                                               double*              Temp,
+                                               int                  ldt,
+                                               double* const*       XF,
+                                               int                  ldxf)
+{
+    if(!rf)
+        return rocblas_status_invalid_handle;
+    if(!rf->analysed || (!batched && rf->batch != 1))
+        return rocblas_status_invalid_value;
+    if(nrhs != 1 || ldt < std::max(1, rf->n) || ldxf < std::max(1, rf->n))
+        return rocblas_status_invalid_size;
+    if(rf->n == 0)
+        return rocblas_status_success;
+    if(!P || !Q || !Temp || !XF)
+        return rocblas_status_invalid_pointer;
+    for(int b = 0; b < rf->batch; b++)
+        if(!XF[b])
+            return rocblas_status_invalid_pointer;
+
+    double* T2 = batched ? Temp + ldt : (double*)rf->temp.data;
+    for(int b = 0; b < rf->batch; b++)
+        HIPSOLVER_RF_CHECK(hipsolver_rf_solve(rf, b, P, Q, Temp, T2, XF[b]));
+    return rocblas_status_success;
+}
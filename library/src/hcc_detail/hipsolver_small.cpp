@@ -0,0 +1,549 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Device code, built as a HIP source; see hipsolver_small.hpp
+
+#include "hipsolver_small.hpp"
+
+#ifdef HIPSOLVER_DEVICE_KERNELS
+
+#include "hipsolver_block.hpp"
+#include "hipsolver_device.hpp"
+#include <hip/hip_runtime.h>
+#include <utility>
+
+// threads of a block, each solving one matrix of the batch
+constexpr int hipsolver_small_threads = 64;
+
+// largest order solved by one thread per matrix, on a tile that stays in registers; the larger
+// orders are solved by one block per matrix, on a tile in shared memory
+constexpr int hipsolver_small_register_size = 8;
+
+// threads of a block solving one matrix
+constexpr int hipsolver_small_block_threads = 64;
+
+template <typename T>
+__device__ inline T* hipsolver_small_matrix(const hipsolver_small_batch<T>& A, int b)
+{
+    return A.ptrs ? A.ptrs[b] : A.base + b * A.stride;
+}
+
+template <typename T, int N, int C = N>
+__device__ inline void hipsolver_small_load(const hipsolver_small_batch<T>& A, const T* a, T* tile)
+{
+#pragma unroll
+    for(int j = 0; j < C; j++)
+#pragma unroll
+        for(int i = 0; i < N; i++)
+            tile[i + j * N] = a[(i + int64_t(j) * A.ld) * A.inc];
+}
+
+template <typename T, int N, int C = N>
+__device__ inline void hipsolver_small_store(const hipsolver_small_batch<T>& A, const T* tile, T* a)
+{
+#pragma unroll
+    for(int j = 0; j < C; j++)
+#pragma unroll
+        for(int i = 0; i < N; i++)
+            a[(i + int64_t(j) * A.ld) * A.inc] = tile[i + j * N];
+}
+
+/*! \brief Loads the first c columns of matrix a of batch A, of order n, to tile, whose leading
+ *  dimension is n, with the threads of the block. */
+template <typename T>
+__device__ inline void
+    hipsolver_small_block_load(const hipsolver_small_batch<T>& A, int n, int c, const T* a, T* tile)
+{
+    for(int t = threadIdx.x; t < n * c; t += hipsolver_small_block_threads)
+        tile[t] = a[(t % n + int64_t(t / n) * A.ld) * A.inc];
+    __syncthreads();
+}
+
+template <typename T>
+__device__ inline void hipsolver_small_block_store(
+    const hipsolver_small_batch<T>& A, int n, int c, const T* tile, T* a)
+{
+    __syncthreads();
+    for(int t = threadIdx.x; t < n * c; t += hipsolver_small_block_threads)
+        a[(t % n + int64_t(t / n) * A.ld) * A.inc] = tile[t];
+}
+
+template <typename T, int N>
+__global__ void __launch_bounds__(hipsolver_small_threads)
+    hipsolver_small_potrf_kernel(hipsolverFillMode_t      uplo,
+                                 hipsolver_small_batch<T> A,
+                                 int*                     info,
+                                 int                      batch_count)
+{
+    int b = blockIdx.x * blockDim.x + threadIdx.x;
+    if(b >= batch_count)
+        return;
+
+    T* a = hipsolver_small_matrix(A, b);
+    T  tile[N * N];
+    hipsolver_small_load<T, N>(A, a, tile);
+    info[b] = hipsolver::device::potrf<T, N>(uplo, tile);
+    hipsolver_small_store<T, N>(A, tile, a);
+}
+
+template <typename T, int N, bool PIVOT>
+__global__ void __launch_bounds__(hipsolver_small_threads)
+    hipsolver_small_getrf_kernel(hipsolver_small_batch<T>   A,
+                                 hipsolver_small_batch<int> ipiv,
+                                 int*                       info,
+                                 int                        batch_count)
+{
+    int b = blockIdx.x * blockDim.x + threadIdx.x;
+    if(b >= batch_count)
+        return;
+
+    T*  a = hipsolver_small_matrix(A, b);
+    T   tile[N * N];
+    int p[N];
+    hipsolver_small_load<T, N>(A, a, tile);
+    info[b] = hipsolver::device::getrf<T, N>(tile, PIVOT ? p : nullptr);
+    hipsolver_small_store<T, N>(A, tile, a);
+    if(PIVOT)
+        hipsolver_small_store<int, N, 1>(ipiv, p, hipsolver_small_matrix(ipiv, b));
+}
+
+template <typename T, int N, bool PIVOT>
+__global__ void __launch_bounds__(hipsolver_small_threads)
+    hipsolver_small_getrs_kernel(hipsolverOperation_t       trans,
+                                 int                        nrhs,
+                                 hipsolver_small_batch<T>   A,
+                                 hipsolver_small_batch<int> ipiv,
+                                 hipsolver_small_batch<T>   B,
+                                 int                        batch_count)
+{
+    int b = blockIdx.x * blockDim.x + threadIdx.x;
+    if(b >= batch_count)
+        return;
+
+    T   tile[N * N];
+    int p[N];
+    hipsolver_small_load<T, N>(A, hipsolver_small_matrix(A, b), tile);
+    if(PIVOT)
+        hipsolver_small_load<int, N, 1>(ipiv, hipsolver_small_matrix(ipiv, b), p);
+
+    // the right-hand sides are solved one at a time, so that the tile of B is one column
+    T* x = hipsolver_small_matrix(B, b);
+    for(int c = 0; c < nrhs; c++)
+    {
+        T y[N];
+        hipsolver_small_load<T, N, 1>(B, x, y);
+        hipsolver::device::getrs<T, N, 1>(trans, tile, PIVOT ? p : nullptr, y);
+        hipsolver_small_store<T, N, 1>(B, y, x);
+        x += int64_t(B.ld) * B.inc;
+    }
+}
+
+template <typename T>
+__global__ void __launch_bounds__(hipsolver_small_block_threads)
+    hipsolver_small_potrf_block_kernel(hipsolverFillMode_t      uplo,
+                                       int                      n,
+                                       hipsolver_small_batch<T> A,
+                                       int*                     info)
+{
+    __shared__ T tile[hipsolver_small_size * hipsolver_small_size];
+
+    int b = blockIdx.x;
+    T*  a = hipsolver_small_matrix(A, b);
+    hipsolver_small_block_load(A, n, n, a, tile);
+    int i = hipsolver_block_potrf<hipsolver_small_block_threads>(uplo, n, tile, n);
+    hipsolver_small_block_store(A, n, n, tile, a);
+    if(threadIdx.x == 0)
+        info[b] = i;
+}
+
+template <typename T, bool PIVOT>
+__global__ void __launch_bounds__(hipsolver_small_block_threads)
+    hipsolver_small_getrf_block_kernel(int                        n,
+                                       hipsolver_small_batch<T>   A,
+                                       hipsolver_small_batch<int> ipiv,
+                                       int*                       info)
+{
+    __shared__ T   tile[hipsolver_small_size * hipsolver_small_size];
+    __shared__ int p[hipsolver_small_size];
+
+    int b = blockIdx.x;
+    T*  a = hipsolver_small_matrix(A, b);
+    hipsolver_small_block_load(A, n, n, a, tile);
+    int i = hipsolver_block_getrf<hipsolver_small_block_threads>(n, tile, n, PIVOT ? p : nullptr);
+    hipsolver_small_block_store(A, n, n, tile, a);
+    if(PIVOT)
+        hipsolver_small_block_store(ipiv, n, 1, p, hipsolver_small_matrix(ipiv, b));
+    if(threadIdx.x == 0)
+        info[b] = i;
+}
+
+template <typename T, bool PIVOT>
+__global__ void __launch_bounds__(hipsolver_small_block_threads)
+    hipsolver_small_getrs_block_kernel(hipsolverOperation_t       trans,
+                                       int                        n,
+                                       int                        nrhs,
+                                       hipsolver_small_batch<T>   A,
+                                       hipsolver_small_batch<int> ipiv,
+                                       hipsolver_small_batch<T>   B)
+{
+    constexpr int S = hipsolver_small_size;
+    __shared__ T   tile[S * S];
+    __shared__ T   y[S * S];
+    __shared__ int p[S];
+
+    int b = blockIdx.x;
+    hipsolver_small_block_load(A, n, n, hipsolver_small_matrix(A, b), tile);
+    if(PIVOT)
+        hipsolver_small_block_load(ipiv, n, 1, hipsolver_small_matrix(ipiv, b), p);
+
+    // the right-hand sides are solved S at a time
+    T* x = hipsolver_small_matrix(B, b);
+    for(int c = 0; c < nrhs; c += S)
+    {
+        int k = nrhs - c < S ? nrhs - c : S;
+        hipsolver_small_block_load(B, n, k, x, y);
+        hipsolver_block_getrs<hipsolver_small_block_threads>(
+            trans, n, k, tile, n, PIVOT ? p : nullptr, y, n);
+        hipsolver_small_block_store(B, n, k, y, x);
+        x += int64_t(S) * B.ld * B.inc;
+    }
+}
+
+inline dim3 hipsolver_small_grid(int batch_count)
+{
+    return dim3((batch_count - 1) / hipsolver_small_threads + 1);
+}
+
+template <typename T>
+inline bool hipsolver_small_present(const hipsolver_small_batch<T>& A)
+{
+    return A.ptrs || A.base;
+}
+
+template <typename T, int N>
+hipError_t hipsolver_small_potrf_launch(hipStream_t              stream,
+                                        hipsolverFillMode_t      uplo,
+                                        hipsolver_small_batch<T> A,
+                                        int*                     info,
+                                        int                      batch_count)
+{
+    hipLaunchKernelGGL((hipsolver_small_potrf_kernel<T, N>),
+                       hipsolver_small_grid(batch_count),
+                       dim3(hipsolver_small_threads),
+                       0,
+                       stream,
+                       uplo,
+                       A,
+                       info,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T, int N>
+hipError_t hipsolver_small_getrf_launch(hipStream_t                stream,
+                                        hipsolver_small_batch<T>   A,
+                                        hipsolver_small_batch<int> ipiv,
+                                        int*                       info,
+                                        int                        batch_count)
+{
+    if(hipsolver_small_present(ipiv))
+        hipLaunchKernelGGL((hipsolver_small_getrf_kernel<T, N, true>),
+                           hipsolver_small_grid(batch_count),
+                           dim3(hipsolver_small_threads),
+                           0,
+                           stream,
+                           A,
+                           ipiv,
+                           info,
+                           batch_count);
+    else
+        hipLaunchKernelGGL((hipsolver_small_getrf_kernel<T, N, false>),
+                           hipsolver_small_grid(batch_count),
+                           dim3(hipsolver_small_threads),
+                           0,
+                           stream,
+                           A,
+                           ipiv,
+                           info,
+                           batch_count);
+    return hipGetLastError();
+}
+
+template <typename T, int N>
+hipError_t hipsolver_small_getrs_launch(hipStream_t                stream,
+                                        hipsolverOperation_t       trans,
+                                        int                        nrhs,
+                                        hipsolver_small_batch<T>   A,
+                                        hipsolver_small_batch<int> ipiv,
+                                        hipsolver_small_batch<T>   B,
+                                        int                        batch_count)
+{
+    if(hipsolver_small_present(ipiv))
+        hipLaunchKernelGGL((hipsolver_small_getrs_kernel<T, N, true>),
+                           hipsolver_small_grid(batch_count),
+                           dim3(hipsolver_small_threads),
+                           0,
+                           stream,
+                           trans,
+                           nrhs,
+                           A,
+                           ipiv,
+                           B,
+                           batch_count);
+    else
+        hipLaunchKernelGGL((hipsolver_small_getrs_kernel<T, N, false>),
+                           hipsolver_small_grid(batch_count),
+                           dim3(hipsolver_small_threads),
+                           0,
+                           stream,
+                           trans,
+                           nrhs,
+                           A,
+                           ipiv,
+                           B,
+                           batch_count);
+    return hipGetLastError();
+}
+
+__global__ void __launch_bounds__(hipsolver_small_threads)
+    hipsolver_small_pointers_kernel(void** array, char* base, int64_t stride, int count)
+{
+    int b = blockIdx.x * blockDim.x + threadIdx.x;
+    if(b < count)
+        array[b] = base + b * stride;
+}
+
+/*! \brief Launchers of the kernels for one order. */
+template <typename T>
+struct hipsolver_small_launchers
+{
+    hipError_t (*potrf)(hipStream_t, hipsolverFillMode_t, hipsolver_small_batch<T>, int*, int);
+    hipError_t (*getrf)(
+        hipStream_t, hipsolver_small_batch<T>, hipsolver_small_batch<int>, int*, int);
+    hipError_t (*getrs)(hipStream_t,
+                        hipsolverOperation_t,
+                        int,
+                        hipsolver_small_batch<T>,
+                        hipsolver_small_batch<int>,
+                        hipsolver_small_batch<T>,
+                        int);
+};
+
+template <typename T, int... N>
+inline const hipsolver_small_launchers<T>*
+    hipsolver_small_table(std::integer_sequence<int, N...>)
+{
+    static const hipsolver_small_launchers<T> table[]
+        = {{hipsolver_small_potrf_launch<T, N + 1>,
+            hipsolver_small_getrf_launch<T, N + 1>,
+            hipsolver_small_getrs_launch<T, N + 1>}...};
+    return table;
+}
+
+/*! \brief Launchers for order n, which is between 1 and hipsolver_small_register_size. */
+template <typename T>
+inline const hipsolver_small_launchers<T>& hipsolver_small_launch(int n)
+{
+    return hipsolver_small_table<T>(
+        std::make_integer_sequence<int, hipsolver_small_register_size>())[n - 1];
+}
+
+template <typename T>
+hipError_t hipsolver_small_potrf(hipStream_t              stream,
+                                 hipsolverFillMode_t      uplo,
+                                 int                      n,
+                                 hipsolver_small_batch<T> A,
+                                 int*                     info,
+                                 int                      batch_count)
+{
+    if(n < 1 || n > hipsolver_small_size || batch_count < 1)
+        return hipErrorInvalidValue;
+    if(n <= hipsolver_small_register_size)
+        return hipsolver_small_launch<T>(n).potrf(stream, uplo, A, info, batch_count);
+
+    hipLaunchKernelGGL(hipsolver_small_potrf_block_kernel<T>,
+                       dim3(batch_count),
+                       dim3(hipsolver_small_block_threads),
+                       0,
+                       stream,
+                       uplo,
+                       n,
+                       A,
+                       info);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipsolver_small_getrf(hipStream_t                stream,
+                                 int                        n,
+                                 hipsolver_small_batch<T>   A,
+                                 hipsolver_small_batch<int> ipiv,
+                                 int*                       info,
+                                 int                        batch_count)
+{
+    if(n < 1 || n > hipsolver_small_size || batch_count < 1)
+        return hipErrorInvalidValue;
+    if(n <= hipsolver_small_register_size)
+        return hipsolver_small_launch<T>(n).getrf(stream, A, ipiv, info, batch_count);
+
+    if(hipsolver_small_present(ipiv))
+        hipLaunchKernelGGL((hipsolver_small_getrf_block_kernel<T, true>),
+                           dim3(batch_count),
+                           dim3(hipsolver_small_block_threads),
+                           0,
+                           stream,
+                           n,
+                           A,
+                           ipiv,
+                           info);
+    else
+        hipLaunchKernelGGL((hipsolver_small_getrf_block_kernel<T, false>),
+                           dim3(batch_count),
+                           dim3(hipsolver_small_block_threads),
+                           0,
+                           stream,
+                           n,
+                           A,
+                           ipiv,
+                           info);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipsolver_small_getrs(hipStream_t                stream,
+                                 hipsolverOperation_t       trans,
+                                 int                        n,
+                                 int                        nrhs,
+                                 hipsolver_small_batch<T>   A,
+                                 hipsolver_small_batch<int> ipiv,
+                                 hipsolver_small_batch<T>   B,
+                                 int                        batch_count)
+{
+    if(n < 1 || n > hipsolver_small_size || batch_count < 1)
+        return hipErrorInvalidValue;
+    if(n <= hipsolver_small_register_size)
+        return hipsolver_small_launch<T>(n).getrs(stream, trans, nrhs, A, ipiv, B, batch_count);
+
+    if(hipsolver_small_present(ipiv))
+        hipLaunchKernelGGL((hipsolver_small_getrs_block_kernel<T, true>),
+                           dim3(batch_count),
+                           dim3(hipsolver_small_block_threads),
+                           0,
+                           stream,
+                           trans,
+                           n,
+                           nrhs,
+                           A,
+                           ipiv,
+                           B);
+    else
+        hipLaunchKernelGGL((hipsolver_small_getrs_block_kernel<T, false>),
+                           dim3(batch_count),
+                           dim3(hipsolver_small_block_threads),
+                           0,
+                           stream,
+                           trans,
+                           n,
+                           nrhs,
+                           A,
+                           ipiv,
+                           B);
+    return hipGetLastError();
+}
+
+hipError_t hipsolver_small_pointers(
+    hipStream_t stream, void** array, void* base, int64_t stride, int count)
+{
+    if(count < 1)
+        return hipSuccess;
+    hipLaunchKernelGGL(hipsolver_small_pointers_kernel,
+                       hipsolver_small_grid(count),
+                       dim3(hipsolver_small_threads),
+                       0,
+                       stream,
+                       array,
+                       (char*)base,
+                       stride,
+                       count);
+    return hipGetLastError();
+}
+
+#else // HIPSOLVER_DEVICE_KERNELS
+
+#include <vector>
+
+// Without the kernels, hipsolver_small_begin declines every batch, so only the addresses of
+// strided batches are needed; they are written from the host
+
+template <typename T>
+hipError_t hipsolver_small_potrf(
+    hipStream_t, hipsolverFillMode_t, int, hipsolver_small_batch<T>, int*, int)
+{
+    return hipErrorNotSupported;
+}
+
+template <typename T>
+hipError_t hipsolver_small_getrf(
+    hipStream_t, int, hipsolver_small_batch<T>, hipsolver_small_batch<int>, int*, int)
+{
+    return hipErrorNotSupported;
+}
+
+template <typename T>
+hipError_t hipsolver_small_getrs(hipStream_t,
+                                 hipsolverOperation_t,
+                                 int,
+                                 int,
+                                 hipsolver_small_batch<T>,
+                                 hipsolver_small_batch<int>,
+                                 hipsolver_small_batch<T>,
+                                 int)
+{
+    return hipErrorNotSupported;
+}
+
+hipError_t hipsolver_small_pointers(
+    hipStream_t stream, void** array, void* base, int64_t stride, int count)
+{
+    if(count < 1)
+        return hipSuccess;
+
+    std::vector<void*> host(count);
+    for(int b = 0; b < count; b++)
+        host[b] = (char*)base + b * stride;
+
+    // the host array is released on return, so the copy must be complete
+    hipError_t err = hipMemcpyAsync(
+        array, host.data(), sizeof(void*) * count, hipMemcpyHostToDevice, stream);
+    return err == hipSuccess ? hipStreamSynchronize(stream) : err;
+}
+
+#endif // HIPSOLVER_DEVICE_KERNELS
+
+template hipError_t hipsolver_small_potrf<float>(
+    hipStream_t, hipsolverFillMode_t, int, hipsolver_small_batch<float>, int*, int);
+template hipError_t hipsolver_small_potrf<double>(
+    hipStream_t, hipsolverFillMode_t, int, hipsolver_small_batch<double>, int*, int);
+
+template hipError_t hipsolver_small_getrf<float>(
+    hipStream_t, int, hipsolver_small_batch<float>, hipsolver_small_batch<int>, int*, int);
+template hipError_t hipsolver_small_getrf<double>(
+    hipStream_t, int, hipsolver_small_batch<double>, hipsolver_small_batch<int>, int*, int);
+
+template hipError_t hipsolver_small_getrs<float>(hipStream_t,
+                                                 hipsolverOperation_t,
+                                                 int,
+                                                 int,
+                                                 hipsolver_small_batch<float>,
+                                                 hipsolver_small_batch<int>,
+                                                 hipsolver_small_batch<float>,
+                                                 int);
+template hipError_t hipsolver_small_getrs<double>(hipStream_t,
+                                                  hipsolverOperation_t,
+                                                  int,
+                                                  int,
+                                                  hipsolver_small_batch<double>,
+                                                  hipsolver_small_batch<int>,
+                                                  hipsolver_small_batch<double>,
+                                                  int);
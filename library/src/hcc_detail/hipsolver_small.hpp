@@ -0,0 +1,220 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <initializer_list>
+
+/*
+ * ===========================================================================
+ *    Small batched solvers. The batched potrf, getrf and getrs of rocSOLVER
+ *    launch several kernels per call whatever the order of the matrices,
+ *    which dominates the time of batches of small matrices. Real matrices of
+ *    order up to hipsolver_small_size are instead solved by a single kernel.
+ *    Up to order 8, each thread loads one matrix of the batch to a local tile,
+ *    which stays in registers, solves it with the fixed-size solvers of
+ *    hipsolver_device.hpp instantiated for its order, and writes back the
+ *    result and its info. A larger tile would spill to scratch memory, so
+ *    each larger matrix is loaded to shared memory and solved by the threads
+ *    of one block (see hipsolver_block.hpp). No workspace is used.
+ *
+ *    The batch may also be interleaved, as for the interleaved batched
+ *    functions (see hipsolver_interleaved.hpp), which are then solved in place
+ *    without converting them to the strided layout.
+ *
+ *    The kernels are the HIP source hipsolver_small.cpp; this header only
+ *    declares their launchers, for float and double, along with the launcher
+ *    of the kernel that writes the addresses of a strided batch for the
+ *    batched functions. A library built without a HIP compiler has no
+ *    kernels: hipsolver_small_size is then 0, so that no batch is solved by
+ *    them, and the addresses are written from the host.
+ * ===========================================================================
+ */
+
+// largest order solved by the small batched kernels
+#ifdef HIPSOLVER_DEVICE_KERNELS
+constexpr int hipsolver_small_size = 32;
+#else
+constexpr int hipsolver_small_size = 0;
+#endif
+
+/*! \brief A batch of matrices on the device. Matrix b is ptrs[b], or base + b * stride if ptrs
+ *  is null, and its entry (i, j) is at offset (i + j * ld) * inc. A vector, as the pivots of a
+ *  matrix, is its column 0. A batch whose ptrs and base are both null is absent. */
+template <typename T>
+struct hipsolver_small_batch
+{
+    T* const* ptrs;
+    T*        base;
+    int64_t   stride;
+    int64_t   inc;
+    int       ld;
+};
+
+/*! \brief Batch given by an array of pointers. */
+template <typename T>
+inline hipsolver_small_batch<T> hipsolver_small_array(T* const* ptrs, int ld)
+{
+    return {ptrs, nullptr, 0, 1, ld};
+}
+
+/*! \brief Batch of matrices stride apart. */
+template <typename T>
+inline hipsolver_small_batch<T> hipsolver_small_strided(T* base, int64_t stride, int ld)
+{
+    return {nullptr, base, stride, 1, ld};
+}
+
+/*! \brief Interleaved batch, where entry (i, j) of matrix b is base[b + (i + j * ld) * bc]. */
+template <typename T>
+inline hipsolver_small_batch<T> hipsolver_small_interleaved(T* base, int ld, int bc)
+{
+    return {nullptr, base, 1, bc, ld};
+}
+
+/*! \brief Returns true if the batched problems of order n, with leading dimensions lds and
+ *  required pointers ptrs, are solved by the small batched kernels. Invalid arguments decline
+ *  the call, so that they are reported by the back-end. */
+inline bool hipsolver_small_begin(int                                 n,
+                                  std::initializer_list<int>          lds,
+                                  std::initializer_list<const void*> ptrs,
+                                  int                                 batch_count)
+{
+    bool small = n >= 1 && n <= hipsolver_small_size && batch_count >= 1;
+    for(int ld : lds)
+        small = small && ld >= n;
+    for(const void* p : ptrs)
+        small = small && p;
+    return small;
+}
+
+/*! \brief Cholesky factorizations of a batch of matrices of order n, with the info of matrix b
+ *  written to info[b]. */
+template <typename T>
+hipError_t hipsolver_small_potrf(hipStream_t              stream,
+                                 hipsolverFillMode_t      uplo,
+                                 int                      n,
+                                 hipsolver_small_batch<T> A,
+                                 int*                     info,
+                                 int                      batch_count);
+
+/*! \brief LU factorizations of a batch of matrices of order n, without pivoting if ipiv is
+ *  absent. */
+template <typename T>
+hipError_t hipsolver_small_getrf(hipStream_t                stream,
+                                 int                        n,
+                                 hipsolver_small_batch<T>   A,
+                                 hipsolver_small_batch<int> ipiv,
+                                 int*                       info,
+                                 int                        batch_count);
+
+/*! \brief Solves op(A) * X = B with the factors computed by hipsolver_small_getrf. */
+template <typename T>
+hipError_t hipsolver_small_getrs(hipStream_t                stream,
+                                 hipsolverOperation_t       trans,
+                                 int                        n,
+                                 int                        nrhs,
+                                 hipsolver_small_batch<T>   A,
+                                 hipsolver_small_batch<int> ipiv,
+                                 hipsolver_small_batch<T>   B,
+                                 int                        batch_count);
+
+/*! \brief Writes to array the addresses of the count matrices of a strided batch, stride bytes
+ *  apart from base. */
+hipError_t hipsolver_small_pointers(
+    hipStream_t stream, void** array, void* base, int64_t stride, int count);
+
+/*! \brief Interleaved potrf, getrf and getrs of the back-end (see hipsolver_interleaved.hpp),
+ *  solved in place by the small batched kernels. The arguments have been checked; batches the
+ *  kernels do not apply to return HIPSOLVER_STATUS_NOT_SUPPORTED without doing anything. */
+template <typename T>
+inline hipsolverStatus_t hipsolver_small_potrf_interleaved(hipsolverHandle_t   handle,
+                                                           hipsolverFillMode_t uplo,
+                                                           int                 n,
+                                                           T*                  A,
+                                                           int                 lda,
+                                                           int*                info,
+                                                           int                 batch_count)
+{
+    if(!hipsolver_small_begin(n, {lda}, {A, info}, batch_count)
+       || (uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(hipsolver_small_potrf(
+           stream, uplo, n, hipsolver_small_interleaved(A, lda, batch_count), info, batch_count)
+       != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipsolverStatus_t hipsolver_small_getrf_interleaved(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           T*                A,
+                                                           int               lda,
+                                                           int*              ipiv,
+                                                           int*              info,
+                                                           int               batch_count)
+{
+    if(!hipsolver_small_begin(n, {lda}, {A, info}, batch_count) || m != n)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(hipsolver_small_getrf(stream,
+                             n,
+                             hipsolver_small_interleaved(A, lda, batch_count),
+                             hipsolver_small_interleaved(ipiv, 1, batch_count),
+                             info,
+                             batch_count)
+       != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief getrs has no info to compute, so its infos are set to zero. */
+template <typename T>
+inline hipsolverStatus_t hipsolver_small_getrs_interleaved(hipsolverHandle_t    handle,
+                                                           hipsolverOperation_t trans,
+                                                           int                  n,
+                                                           int                  nrhs,
+                                                           T*                   A,
+                                                           int                  lda,
+                                                           int*                 ipiv,
+                                                           T*                   B,
+                                                           int                  ldb,
+                                                           int*                 info,
+                                                           int                  batch_count)
+{
+    if(!hipsolver_small_begin(n, {lda, ldb}, {A, ipiv, B, info}, batch_count) || nrhs < 0
+       || (trans != HIPSOLVER_OP_N && trans != HIPSOLVER_OP_T && trans != HIPSOLVER_OP_C))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) != hipSuccess
+       || hipsolver_small_getrs(stream,
+                                trans,
+                                n,
+                                nrhs,
+                                hipsolver_small_interleaved(A, lda, batch_count),
+                                hipsolver_small_interleaved(ipiv, 1, batch_count),
+                                hipsolver_small_interleaved(B, ldb, batch_count),
+                                batch_count)
+              != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
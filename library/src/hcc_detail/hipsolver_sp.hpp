@@ -0,0 +1,896 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_gels.hpp"
+#include "rocblas.h"
+#include "rocsolver.h"
+#include "rocsparse.h"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Sparse direct solvers.
+ *
+ * rocSOLVER has no sparse factorizations, so the CSR matrices are expanded with rocSPARSE into
+ * dense column-major storage on the stream of the hipsolverSp handle and solved with the dense
+ * rocSOLVER routines. This is only efficient for the small and moderately sized systems that fit
+ * in device memory once densified; it gives the sparse API a portable implementation rather than
+ * a fast one. Systems of order above hipsolver_sp_dense_limit, whose dense storage would take
+ * gigabytes, are rejected with rocblas_status_not_implemented (HIPSOLVER_STATUS_NOT_SUPPORTED)
+ * instead of exhausting the device memory. The fill-reducing reordering requested from the
+ * one-shot solvers is ignored, as dense factorizations have no fill-in.
+ *
+ * As in cuSOLVER, the one-shot solvers and the zero pivot queries return the singularity to the
+ * host, so they synchronize with the stream. The analysis, factorization and solve phases are
+ * asynchronous. Their internal data, which holds the dense factors, is owned by the info
+ * objects and allocated when the buffer sizes are queried, and the user buffer is lent to
+ * rocSOLVER as its workspace.
+ */
+
+// largest order of the sparse systems, which are solved as dense matrices
+constexpr int hipsolver_sp_dense_limit = 8192;
+
+#define HIPSOLVER_SP_CHECK(STATUS)                \
+    do                                            \
+    {                                             \
+        rocblas_status _status = (STATUS);        \
+        if(_status != rocblas_status_success)     \
+            return _status;                       \
+    } while(0)
+
+#define HIPSOLVER_SP_CHECK_HIP(ERROR)             \
+    do                                            \
+    {                                             \
+        if((ERROR) != hipSuccess)                 \
+            return rocblas_status_internal_error; \
+    } while(0)
+
+#define HIPSOLVER_SP_CHECK_ROCSPARSE(STATUS)                         \
+    do                                                               \
+    {                                                                \
+        rocblas_status _status = rocsparse2rocblas_status((STATUS)); \
+        if(_status != rocblas_status_success)                        \
+            return _status;                                          \
+    } while(0)
+
+inline rocblas_status rocsparse2rocblas_status(rocsparse_status status)
+{
+    switch(status)
+    {
+    case rocsparse_status_success:
+        return rocblas_status_success;
+    case rocsparse_status_invalid_handle:
+        return rocblas_status_invalid_handle;
+    case rocsparse_status_invalid_pointer:
+        return rocblas_status_invalid_pointer;
+    case rocsparse_status_invalid_size:
+        return rocblas_status_invalid_size;
+    case rocsparse_status_invalid_value:
+        return rocblas_status_invalid_value;
+    case rocsparse_status_memory_error:
+        return rocblas_status_memory_error;
+    case rocsparse_status_not_implemented:
+        return rocblas_status_not_implemented;
+    default:
+        return rocblas_status_internal_error;
+    }
+}
+
+/******************** HANDLE AND INFO OBJECTS ********************/
+/*! \brief Device memory that only grows, released with its owner. */
+struct hipsolver_sp_buffer
+{
+    void*  data = nullptr;
+    size_t size = 0;
+
+    hipsolver_sp_buffer() = default;
+    ~hipsolver_sp_buffer()
+    {
+        if(data)
+            hipFree(data);
+    }
+
+    hipsolver_sp_buffer(const hipsolver_sp_buffer&) = delete;
+    hipsolver_sp_buffer& operator=(const hipsolver_sp_buffer&) = delete;
+
+    rocblas_status reserve(size_t bytes)
+    {
+        if(bytes <= size)
+            return rocblas_status_success;
+
+        if(data)
+            HIPSOLVER_SP_CHECK_HIP(hipFree(data));
+        data = nullptr;
+        size = 0;
+        if(hipMalloc(&data, bytes) != hipSuccess)
+            return rocblas_status_memory_error;
+        size = bytes;
+        return rocblas_status_success;
+    }
+};
+
+struct hipsolver_sp_handle
+{
+    rocblas_handle      blas   = nullptr;
+    rocsparse_handle    sparse = nullptr;
+    hipsolver_sp_buffer buffer; // dense copies made by the one-shot solvers
+
+    hipsolver_sp_handle() = default;
+    ~hipsolver_sp_handle()
+    {
+        if(blas)
+            rocblas_destroy_handle(blas);
+        if(sparse)
+            rocsparse_destroy_handle(sparse);
+    }
+
+    hipsolver_sp_handle(const hipsolver_sp_handle&) = delete;
+    hipsolver_sp_handle& operator=(const hipsolver_sp_handle&) = delete;
+
+    rocblas_status init()
+    {
+        HIPSOLVER_SP_CHECK(rocblas_create_handle(&blas));
+        HIPSOLVER_SP_CHECK_ROCSPARSE(rocsparse_create_handle(&sparse));
+        return rocblas_status_success;
+    }
+
+    rocblas_status set_stream(hipStream_t stream)
+    {
+        HIPSOLVER_SP_CHECK(rocblas_set_stream(blas, stream));
+        HIPSOLVER_SP_CHECK_ROCSPARSE(rocsparse_set_stream(sparse, stream));
+        return rocblas_status_success;
+    }
+
+    hipStream_t stream() const
+    {
+        hipStream_t stream;
+        rocblas_get_stream(blas, &stream);
+        return stream;
+    }
+};
+
+struct hipsolver_sp_desc
+{
+    rocsparse_mat_descr descr = nullptr;
+
+    hipsolver_sp_desc() = default;
+    ~hipsolver_sp_desc()
+    {
+        if(descr)
+            rocsparse_destroy_mat_descr(descr);
+    }
+
+    hipsolver_sp_desc(const hipsolver_sp_desc&) = delete;
+    hipsolver_sp_desc& operator=(const hipsolver_sp_desc&) = delete;
+};
+
+/*! \brief State of the Cholesky factorization phases. The internal data holds the dense
+ *  factor followed by the info of the factorization.
+ */
+struct hipsolver_sp_chol_info
+{
+    int                 n        = 0;
+    int                 nnz      = 0;
+    bool                analysed = false;
+    hipsolver_sp_buffer data;
+};
+
+/*! \brief State of the batched QR phases. The internal data holds the dense matrices, then the
+ *  right-hand sides with m rows, then the info of each problem.
+ */
+struct hipsolver_sp_qr_info
+{
+    int                 m        = 0;
+    int                 n        = 0;
+    int                 nnz      = 0;
+    bool                analysed = false;
+    hipsolver_sp_buffer data;
+};
+
+/*! \brief Lends a user buffer to rocSOLVER as its workspace until it goes out of scope. */
+class hipsolver_sp_workspace_guard
+{
+    rocblas_handle handle;
+
+public:
+    hipsolver_sp_workspace_guard(rocblas_handle handle, void* buffer, size_t size)
+        : handle(handle)
+    {
+        rocblas_set_workspace(handle, buffer, size);
+    }
+    ~hipsolver_sp_workspace_guard()
+    {
+        rocblas_set_workspace(handle, nullptr, 0);
+    }
+
+    hipsolver_sp_workspace_guard(const hipsolver_sp_workspace_guard&) = delete;
+    hipsolver_sp_workspace_guard& operator=(const hipsolver_sp_workspace_guard&) = delete;
+};
+
+/******************** ROCSPARSE DISPATCH ********************/
+inline rocsparse_status hipsolver_sp_csr2dense(rocsparse_handle          handle,
+                                               int                       m,
+                                               int                       n,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csrVal,
+                                               const int*                csrRowPtr,
+                                               const int*                csrColInd,
+                                               float*                    A,
+                                               int                       lda)
+{
+    return rocsparse_scsr2dense(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, lda);
+}
+
+inline rocsparse_status hipsolver_sp_csr2dense(rocsparse_handle          handle,
+                                               int                       m,
+                                               int                       n,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csrVal,
+                                               const int*                csrRowPtr,
+                                               const int*                csrColInd,
+                                               double*                   A,
+                                               int                       lda)
+{
+    return rocsparse_dcsr2dense(handle, m, n, descr, csrVal, csrRowPtr, csrColInd, A, lda);
+}
+
+inline rocsparse_status hipsolver_sp_csr2dense(rocsparse_handle             handle,
+                                               int                          m,
+                                               int                          n,
+                                               const rocsparse_mat_descr    descr,
+                                               const rocblas_float_complex* csrVal,
+                                               const int*                   csrRowPtr,
+                                               const int*                   csrColInd,
+                                               rocblas_float_complex*       A,
+                                               int                          lda)
+{
+    return rocsparse_ccsr2dense(handle,
+                                m,
+                                n,
+                                descr,
+                                (const rocsparse_float_complex*)csrVal,
+                                csrRowPtr,
+                                csrColInd,
+                                (rocsparse_float_complex*)A,
+                                lda);
+}
+
+inline rocsparse_status hipsolver_sp_csr2dense(rocsparse_handle              handle,
+                                               int                           m,
+                                               int                           n,
+                                               const rocsparse_mat_descr     descr,
+                                               const rocblas_double_complex* csrVal,
+                                               const int*                    csrRowPtr,
+                                               const int*                    csrColInd,
+                                               rocblas_double_complex*       A,
+                                               int                           lda)
+{
+    return rocsparse_zcsr2dense(handle,
+                                m,
+                                n,
+                                descr,
+                                (const rocsparse_double_complex*)csrVal,
+                                csrRowPtr,
+                                csrColInd,
+                                (rocsparse_double_complex*)A,
+                                lda);
+}
+
+/******************** ROCSOLVER DISPATCH ********************/
+inline rocblas_status hipsolver_sp_potrf(rocblas_handle handle, int n, float* A, int lda, int* info)
+{
+    return rocsolver_spotrf(handle, rocblas_fill_lower, n, A, lda, info);
+}
+
+inline rocblas_status
+    hipsolver_sp_potrf(rocblas_handle handle, int n, double* A, int lda, int* info)
+{
+    return rocsolver_dpotrf(handle, rocblas_fill_lower, n, A, lda, info);
+}
+
+inline rocblas_status
+    hipsolver_sp_potrf(rocblas_handle handle, int n, rocblas_float_complex* A, int lda, int* info)
+{
+    return rocsolver_cpotrf(handle, rocblas_fill_lower, n, A, lda, info);
+}
+
+inline rocblas_status
+    hipsolver_sp_potrf(rocblas_handle handle, int n, rocblas_double_complex* A, int lda, int* info)
+{
+    return rocsolver_zpotrf(handle, rocblas_fill_lower, n, A, lda, info);
+}
+
+inline rocblas_status hipsolver_sp_potrs(rocblas_handle handle, int n, float* A, int lda, float* B)
+{
+    return rocsolver_spotrs(handle, rocblas_fill_lower, n, 1, A, lda, B, std::max(1, n));
+}
+
+inline rocblas_status
+    hipsolver_sp_potrs(rocblas_handle handle, int n, double* A, int lda, double* B)
+{
+    return rocsolver_dpotrs(handle, rocblas_fill_lower, n, 1, A, lda, B, std::max(1, n));
+}
+
+inline rocblas_status hipsolver_sp_potrs(
+    rocblas_handle handle, int n, rocblas_float_complex* A, int lda, rocblas_float_complex* B)
+{
+    return rocsolver_cpotrs(handle, rocblas_fill_lower, n, 1, A, lda, B, std::max(1, n));
+}
+
+inline rocblas_status hipsolver_sp_potrs(
+    rocblas_handle handle, int n, rocblas_double_complex* A, int lda, rocblas_double_complex* B)
+{
+    return rocsolver_zpotrs(handle, rocblas_fill_lower, n, 1, A, lda, B, std::max(1, n));
+}
+
+inline rocblas_status hipsolver_sp_gels_strided_batched(rocblas_handle handle,
+                                                        int            m,
+                                                        int            n,
+                                                        float*         A,
+                                                        float*         B,
+                                                        int*           info,
+                                                        int            batch_count)
+{
+    return rocsolver_sgels_strided_batched(handle,
+                                           rocblas_operation_none,
+                                           m,
+                                           n,
+                                           1,
+                                           A,
+                                           m,
+                                           rocblas_stride(m) * n,
+                                           B,
+                                           m,
+                                           m,
+                                           info,
+                                           batch_count);
+}
+
+inline rocblas_status hipsolver_sp_gels_strided_batched(rocblas_handle handle,
+                                                        int            m,
+                                                        int            n,
+                                                        double*        A,
+                                                        double*        B,
+                                                        int*           info,
+                                                        int            batch_count)
+{
+    return rocsolver_dgels_strided_batched(handle,
+                                           rocblas_operation_none,
+                                           m,
+                                           n,
+                                           1,
+                                           A,
+                                           m,
+                                           rocblas_stride(m) * n,
+                                           B,
+                                           m,
+                                           m,
+                                           info,
+                                           batch_count);
+}
+
+inline rocblas_status hipsolver_sp_gels_strided_batched(rocblas_handle         handle,
+                                                        int                    m,
+                                                        int                    n,
+                                                        rocblas_float_complex* A,
+                                                        rocblas_float_complex* B,
+                                                        int*                   info,
+                                                        int                    batch_count)
+{
+    return rocsolver_cgels_strided_batched(handle,
+                                           rocblas_operation_none,
+                                           m,
+                                           n,
+                                           1,
+                                           A,
+                                           m,
+                                           rocblas_stride(m) * n,
+                                           B,
+                                           m,
+                                           m,
+                                           info,
+                                           batch_count);
+}
+
+inline rocblas_status hipsolver_sp_gels_strided_batched(rocblas_handle          handle,
+                                                        int                     m,
+                                                        int                     n,
+                                                        rocblas_double_complex* A,
+                                                        rocblas_double_complex* B,
+                                                        int*                    info,
+                                                        int                     batch_count)
+{
+    return rocsolver_zgels_strided_batched(handle,
+                                           rocblas_operation_none,
+                                           m,
+                                           n,
+                                           1,
+                                           A,
+                                           m,
+                                           rocblas_stride(m) * n,
+                                           B,
+                                           m,
+                                           m,
+                                           info,
+                                           batch_count);
+}
+
+/******************** HELPERS ********************/
+inline float hipsolver_sp_abs(float x)
+{
+    return std::abs(x);
+}
+
+inline double hipsolver_sp_abs(double x)
+{
+    return std::abs(x);
+}
+
+inline float hipsolver_sp_abs(rocblas_float_complex x)
+{
+    return std::hypot(x.real(), x.imag());
+}
+
+inline double hipsolver_sp_abs(rocblas_double_complex x)
+{
+    return std::hypot(x.real(), x.imag());
+}
+
+inline bool hipsolver_sp_valid_csr(hipsolver_sp_desc* descr,
+                                   const void*        csrVal,
+                                   const int*         csrRowPtr,
+                                   const int*         csrColInd,
+                                   int                m,
+                                   int                nnz)
+{
+    return descr && (m == 0 || csrRowPtr) && (nnz == 0 || (csrVal && csrColInd));
+}
+
+/*! \brief Returns in position the first diagonal element of the dense n x n factor A whose
+ *  magnitude is at most tol, or -1 if there is none. info is the device info of the
+ *  factorization; a positive value already identifies the position.
+ */
+template <typename T, typename S>
+rocblas_status hipsolver_sp_singularity(
+    hipStream_t stream, int n, const T* A, const int* info, S tol, int* position)
+{
+    int hinfo = 0;
+    if(info)
+    {
+        HIPSOLVER_SP_CHECK_HIP(
+            hipMemcpyAsync(&hinfo, info, sizeof(int), hipMemcpyDeviceToHost, stream));
+    }
+
+    std::vector<T> diag(n);
+    HIPSOLVER_SP_CHECK_HIP(hipMemcpy2DAsync(diag.data(),
+                                            sizeof(T),
+                                            A,
+                                            sizeof(T) * (size_t(n) + 1),
+                                            sizeof(T),
+                                            n,
+                                            hipMemcpyDeviceToHost,
+                                            stream));
+    HIPSOLVER_SP_CHECK_HIP(hipStreamSynchronize(stream));
+
+    *position = hinfo > 0 ? hinfo - 1 : -1;
+    int end   = hinfo > 0 ? hinfo - 1 : n;
+    for(int j = 0; j < end; j++)
+    {
+        if(hipsolver_sp_abs(diag[j]) <= tol)
+        {
+            *position = j;
+            break;
+        }
+    }
+    return rocblas_status_success;
+}
+
+/******************** ONE-SHOT SOLVERS ********************/
+/*! \brief Solves A * x = b for the symmetric positive definite CSR matrix A, using its lower
+ *  triangle. singularity is set to -1, or to the first j for which the Cholesky factor has
+ *  |L(j, j)| <= tol, in which case x is not computed.
+ */
+template <typename T, typename S>
+rocblas_status hipsolver_sp_csrlsvchol(hipsolver_sp_handle* handle,
+                                       int                  m,
+                                       int                  nnz,
+                                       hipsolver_sp_desc*   descr,
+                                       const T*             csrVal,
+                                       const int*           csrRowPtr,
+                                       const int*           csrColInd,
+                                       const T*             b,
+                                       S                    tol,
+                                       T*                   x,
+                                       int*                 singularity)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || nnz < 0)
+        return rocblas_status_invalid_size;
+    if(!hipsolver_sp_valid_csr(descr, csrVal, csrRowPtr, csrColInd, m, nnz)
+       || (m > 0 && (!b || !x)) || !singularity)
+        return rocblas_status_invalid_pointer;
+    if(m > hipsolver_sp_dense_limit)
+        return rocblas_status_not_implemented;
+
+    *singularity = -1;
+    if(m == 0)
+        return rocblas_status_success;
+
+    size_t size_A = hipsolver_handle_data::align(sizeof(T) * size_t(m) * m);
+    HIPSOLVER_SP_CHECK(handle->buffer.reserve(size_A + sizeof(int)));
+    T*   A    = (T*)handle->buffer.data;
+    int* info = (int*)((char*)handle->buffer.data + size_A);
+
+    hipStream_t stream = handle->stream();
+    HIPSOLVER_SP_CHECK_ROCSPARSE(hipsolver_sp_csr2dense(
+        handle->sparse, m, m, descr->descr, csrVal, csrRowPtr, csrColInd, A, m));
+    HIPSOLVER_SP_CHECK(hipsolver_sp_potrf(handle->blas, m, A, m, info));
+    HIPSOLVER_SP_CHECK(hipsolver_sp_singularity(stream, m, A, info, tol, singularity));
+    if(*singularity >= 0)
+        return rocblas_status_success;
+
+    HIPSOLVER_SP_CHECK_HIP(
+        hipMemcpyAsync(x, b, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+    return hipsolver_sp_potrs(handle->blas, m, A, m, x);
+}
+
+/*! \brief Solves A * x = b for the square CSR matrix A with a QR factorization. singularity is
+ *  set to -1, or to the first j for which |R(j, j)| <= tol, in which case x is undefined.
+ */
+template <typename T, typename S>
+rocblas_status hipsolver_sp_csrlsvqr(hipsolver_sp_handle* handle,
+                                     int                  m,
+                                     int                  nnz,
+                                     hipsolver_sp_desc*   descr,
+                                     const T*             csrVal,
+                                     const int*           csrRowPtr,
+                                     const int*           csrColInd,
+                                     const T*             b,
+                                     S                    tol,
+                                     T*                   x,
+                                     int*                 singularity)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(m < 0 || nnz < 0)
+        return rocblas_status_invalid_size;
+    if(!hipsolver_sp_valid_csr(descr, csrVal, csrRowPtr, csrColInd, m, nnz)
+       || (m > 0 && (!b || !x)) || !singularity)
+        return rocblas_status_invalid_pointer;
+    if(m > hipsolver_sp_dense_limit)
+        return rocblas_status_not_implemented;
+
+    *singularity = -1;
+    if(m == 0)
+        return rocblas_status_success;
+
+    size_t size_A = hipsolver_handle_data::align(sizeof(T) * size_t(m) * m);
+    HIPSOLVER_SP_CHECK(handle->buffer.reserve(size_A + sizeof(int)));
+    T*   A    = (T*)handle->buffer.data;
+    int* info = (int*)((char*)handle->buffer.data + size_A);
+
+    hipStream_t stream = handle->stream();
+    HIPSOLVER_SP_CHECK_ROCSPARSE(hipsolver_sp_csr2dense(
+        handle->sparse, m, m, descr->descr, csrVal, csrRowPtr, csrColInd, A, m));
+    HIPSOLVER_SP_CHECK_HIP(
+        hipMemcpyAsync(x, b, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+    HIPSOLVER_SP_CHECK(hipsolver_gels_gels(handle->blas, m, m, 1, A, m, x, m, info));
+
+    // the upper triangle of A now holds R
+    return hipsolver_sp_singularity(stream, m, A, info, tol, singularity);
+}
+
+/******************** CHOLESKY PHASES ********************/
+inline rocblas_status hipsolver_sp_csrcholAnalysis(hipsolver_sp_handle*    handle,
+                                                   int                     n,
+                                                   int                     nnz,
+                                                   hipsolver_sp_desc*      descr,
+                                                   const int*              csrRowPtr,
+                                                   const int*              csrColInd,
+                                                   hipsolver_sp_chol_info* info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(n < 0 || nnz < 0)
+        return rocblas_status_invalid_size;
+    if(!descr || !info || (n > 0 && !csrRowPtr) || (nnz > 0 && !csrColInd))
+        return rocblas_status_invalid_pointer;
+    if(n > hipsolver_sp_dense_limit)
+        return rocblas_status_not_implemented;
+
+    // the dense factorization needs no symbolic analysis beyond the problem size
+    info->n        = n;
+    info->nnz      = nnz;
+    info->analysed = true;
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_sp_csrcholBufferInfo(hipsolver_sp_handle*    handle,
+                                              int                     n,
+                                              int                     nnz,
+                                              hipsolver_sp_desc*      descr,
+                                              const T*                csrVal,
+                                              const int*              csrRowPtr,
+                                              const int*              csrColInd,
+                                              hipsolver_sp_chol_info* info,
+                                              size_t*                 internalDataInBytes,
+                                              size_t*                 workspaceInBytes)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!descr || !info || !internalDataInBytes || !workspaceInBytes)
+        return rocblas_status_invalid_pointer;
+    if(!info->analysed || n != info->n || nnz != info->nnz)
+        return rocblas_status_invalid_value;
+
+    size_t internal = hipsolver_handle_data::align(sizeof(T) * size_t(n) * n) + sizeof(int);
+    HIPSOLVER_SP_CHECK(info->data.reserve(internal));
+
+    size_t sz_potrf, sz_potrs;
+    rocblas_start_device_memory_size_query(handle->blas);
+    hipsolver_sp_potrf(handle->blas, n, (T*)nullptr, std::max(1, n), nullptr);
+    HIPSOLVER_SP_CHECK(rocblas_stop_device_memory_size_query(handle->blas, &sz_potrf));
+    rocblas_start_device_memory_size_query(handle->blas);
+    hipsolver_sp_potrs(handle->blas, n, (T*)nullptr, std::max(1, n), (T*)nullptr);
+    HIPSOLVER_SP_CHECK(rocblas_stop_device_memory_size_query(handle->blas, &sz_potrs));
+
+    *internalDataInBytes = internal;
+    *workspaceInBytes    = std::max(sz_potrf, sz_potrs);
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status hipsolver_sp_csrcholFactor(hipsolver_sp_handle*    handle,
+                                          int                     n,
+                                          int                     nnz,
+                                          hipsolver_sp_desc*      descr,
+                                          const T*                csrVal,
+                                          const int*              csrRowPtr,
+                                          const int*              csrColInd,
+                                          hipsolver_sp_chol_info* info,
+                                          void*                   pBuffer)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!hipsolver_sp_valid_csr(descr, csrVal, csrRowPtr, csrColInd, n, nnz) || !info)
+        return rocblas_status_invalid_pointer;
+    if(!info->analysed || n != info->n || nnz != info->nnz)
+        return rocblas_status_invalid_value;
+    if(n == 0)
+        return rocblas_status_success;
+    if(!info->data.data)
+        return rocblas_status_invalid_value; // csrcholBufferInfo was not called
+    if(!pBuffer)
+        return rocblas_status_invalid_pointer;
+
+    size_t size_A = hipsolver_handle_data::align(sizeof(T) * size_t(n) * n);
+    T*     A      = (T*)info->data.data;
+    int*   dinfo  = (int*)((char*)info->data.data + size_A);
+
+    HIPSOLVER_SP_CHECK_ROCSPARSE(hipsolver_sp_csr2dense(
+        handle->sparse, n, n, descr->descr, csrVal, csrRowPtr, csrColInd, A, n));
+
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle->blas);
+    hipsolver_sp_potrf(handle->blas, n, (T*)nullptr, n, nullptr);
+    HIPSOLVER_SP_CHECK(rocblas_stop_device_memory_size_query(handle->blas, &sz));
+
+    hipsolver_sp_workspace_guard workspace(handle->blas, pBuffer, sz);
+    return hipsolver_sp_potrf(handle->blas, n, A, n, dinfo);
+}
+
+template <typename T, typename S>
+rocblas_status hipsolver_sp_csrcholZeroPivot(hipsolver_sp_handle*    handle,
+                                             hipsolver_sp_chol_info* info,
+                                             S                       tol,
+                                             int*                    position)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!info || !position)
+        return rocblas_status_invalid_pointer;
+    if(!info->analysed || (info->n > 0 && !info->data.data))
+        return rocblas_status_invalid_value;
+
+    *position = -1;
+    if(info->n == 0)
+        return rocblas_status_success;
+
+    int    n      = info->n;
+    size_t size_A = hipsolver_handle_data::align(sizeof(T) * size_t(n) * n);
+    T*     A      = (T*)info->data.data;
+    int*   dinfo  = (int*)((char*)info->data.data + size_A);
+    return hipsolver_sp_singularity(handle->stream(), n, A, dinfo, tol, position);
+}
+
+template <typename T>
+rocblas_status hipsolver_sp_csrcholSolve(hipsolver_sp_handle*    handle,
+                                         int                     n,
+                                         const T*                b,
+                                         T*                      x,
+                                         hipsolver_sp_chol_info* info,
+                                         void*                   pBuffer)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!info || (n > 0 && (!b || !x || !pBuffer)))
+        return rocblas_status_invalid_pointer;
+    if(!info->analysed || n != info->n || (n > 0 && !info->data.data))
+        return rocblas_status_invalid_value;
+    if(n == 0)
+        return rocblas_status_success;
+
+    T* A = (T*)info->data.data;
+    HIPSOLVER_SP_CHECK_HIP(
+        hipMemcpyAsync(x, b, sizeof(T) * n, hipMemcpyDeviceToDevice, handle->stream()));
+
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle->blas);
+    hipsolver_sp_potrs(handle->blas, n, (T*)nullptr, n, (T*)nullptr);
+    HIPSOLVER_SP_CHECK(rocblas_stop_device_memory_size_query(handle->blas, &sz));
+
+    hipsolver_sp_workspace_guard workspace(handle->blas, pBuffer, sz);
+    return hipsolver_sp_potrs(handle->blas, n, A, n, x);
+}
+
+/******************** BATCHED QR PHASES ********************/
+inline rocblas_status hipsolver_sp_csrqrAnalysisBatched(hipsolver_sp_handle*  handle,
+                                                        int                   m,
+                                                        int                   n,
+                                                        int                   nnz,
+                                                        hipsolver_sp_desc*    descr,
+                                                        const int*            csrRowPtr,
+                                                        const int*            csrColInd,
+                                                        hipsolver_sp_qr_info* info)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    // as with cuSOLVER, only square and overdetermined systems are supported
+    if(m < 0 || n < 0 || nnz < 0 || m < n)
+        return rocblas_status_invalid_size;
+    if(!descr || !info || (m > 0 && !csrRowPtr) || (nnz > 0 && !csrColInd))
+        return rocblas_status_invalid_pointer;
+    if(m > hipsolver_sp_dense_limit)
+        return rocblas_status_not_implemented;
+
+    info->m        = m;
+    info->n        = n;
+    info->nnz      = nnz;
+    info->analysed = true;
+    return rocblas_status_success;
+}
+
+/*! \brief Sizes in bytes of the dense matrices and of the right-hand sides in the internal
+ *  data of the batched QR.
+ */
+template <typename T>
+inline void hipsolver_sp_qr_sizes(int m, int n, int batchSize, size_t* size_A, size_t* size_B)
+{
+    *size_A = hipsolver_handle_data::align(sizeof(T) * size_t(m) * n * batchSize);
+    *size_B = hipsolver_handle_data::align(sizeof(T) * size_t(m) * batchSize);
+}
+
+template <typename T>
+rocblas_status hipsolver_sp_csrqrBufferInfoBatched(hipsolver_sp_handle*  handle,
+                                                   int                   m,
+                                                   int                   n,
+                                                   int                   nnz,
+                                                   hipsolver_sp_desc*    descr,
+                                                   const T*              csrVal,
+                                                   const int*            csrRowPtr,
+                                                   const int*            csrColInd,
+                                                   int                   batchSize,
+                                                   hipsolver_sp_qr_info* info,
+                                                   size_t*               internalDataInBytes,
+                                                   size_t*               workspaceInBytes)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(batchSize < 0)
+        return rocblas_status_invalid_size;
+    if(!descr || !info || !internalDataInBytes || !workspaceInBytes)
+        return rocblas_status_invalid_pointer;
+    if(!info->analysed || m != info->m || n != info->n || nnz != info->nnz)
+        return rocblas_status_invalid_value;
+
+    size_t size_A, size_B;
+    hipsolver_sp_qr_sizes<T>(m, n, batchSize, &size_A, &size_B);
+    size_t internal = size_A + size_B + sizeof(int) * size_t(batchSize);
+    HIPSOLVER_SP_CHECK(info->data.reserve(internal));
+
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle->blas);
+    hipsolver_sp_gels_strided_batched(
+        handle->blas, m, n, (T*)nullptr, (T*)nullptr, nullptr, batchSize);
+    HIPSOLVER_SP_CHECK(rocblas_stop_device_memory_size_query(handle->blas, &sz));
+
+    *internalDataInBytes = internal;
+    *workspaceInBytes    = sz;
+    return rocblas_status_success;
+}
+
+/*! \brief Solves the least-squares problems min || A_k * x_k - b_k || of a batch of CSR matrices
+ *  that share their sparsity pattern. The values, right-hand sides and solutions of the
+ *  problems are stored one after the other.
+ */
+template <typename T>
+rocblas_status hipsolver_sp_csrqrsvBatched(hipsolver_sp_handle*  handle,
+                                           int                   m,
+                                           int                   n,
+                                           int                   nnz,
+                                           hipsolver_sp_desc*    descr,
+                                           const T*              csrVal,
+                                           const int*            csrRowPtr,
+                                           const int*            csrColInd,
+                                           const T*              b,
+                                           T*                    x,
+                                           int                   batchSize,
+                                           hipsolver_sp_qr_info* info,
+                                           void*                 pBuffer)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(batchSize < 0)
+        return rocblas_status_invalid_size;
+    if(!hipsolver_sp_valid_csr(descr, csrVal, csrRowPtr, csrColInd, m, nnz) || !info)
+        return rocblas_status_invalid_pointer;
+    if(!info->analysed || m != info->m || n != info->n || nnz != info->nnz)
+        return rocblas_status_invalid_value;
+    if(m == 0 || n == 0 || batchSize == 0)
+        return rocblas_status_success;
+    if(!b || !x || !pBuffer)
+        return rocblas_status_invalid_pointer;
+
+    size_t size_A, size_B;
+    hipsolver_sp_qr_sizes<T>(m, n, batchSize, &size_A, &size_B);
+    if(info->data.size < size_A + size_B + sizeof(int) * size_t(batchSize))
+        return rocblas_status_invalid_value; // csrqrBufferInfoBatched was not called
+
+    T*   A     = (T*)info->data.data;
+    T*   B     = (T*)((char*)info->data.data + size_A);
+    int* dinfo = (int*)((char*)info->data.data + size_A + size_B);
+
+    hipStream_t stream = handle->stream();
+    for(int k = 0; k < batchSize; k++)
+        HIPSOLVER_SP_CHECK_ROCSPARSE(hipsolver_sp_csr2dense(handle->sparse,
+                                                            m,
+                                                            n,
+                                                            descr->descr,
+                                                            csrVal + size_t(k) * nnz,
+                                                            csrRowPtr,
+                                                            csrColInd,
+                                                            A + size_t(k) * m * n,
+                                                            m));
+    HIPSOLVER_SP_CHECK_HIP(hipMemcpyAsync(
+        B, b, sizeof(T) * size_t(m) * batchSize, hipMemcpyDeviceToDevice, stream));
+
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle->blas);
+    hipsolver_sp_gels_strided_batched(
+        handle->blas, m, n, (T*)nullptr, (T*)nullptr, nullptr, batchSize);
+    HIPSOLVER_SP_CHECK(rocblas_stop_device_memory_size_query(handle->blas, &sz));
+
+    {
+        hipsolver_sp_workspace_guard workspace(handle->blas, pBuffer, sz);
+        HIPSOLVER_SP_CHECK(
+            hipsolver_sp_gels_strided_batched(handle->blas, m, n, A, B, dinfo, batchSize));
+    }
+
+    // the leading n rows of each right-hand side hold the solution
+    HIPSOLVER_SP_CHECK_HIP(hipMemcpy2DAsync(x,
+                                            sizeof(T) * n,
+                                            B,
+                                            sizeof(T) * m,
+                                            sizeof(T) * n,
+                                            batchSize,
+                                            hipMemcpyDeviceToDevice,
+                                            stream));
+    return rocblas_status_success;
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocsolver.h"
+
+/*
+ * Two-stage symmetric eigensolver.
+ *
+ * With the HIPSOLVER_ALG_1 algorithm of HIPSOLVERDN_SYEVD, ssyevd/dsyevd reduce A to tridiagonal
+ * form with sytrd2 (see hipsolver_sytrd2.hpp), which forms Q in A when the eigenvectors are
+ * requested, and solve the tridiagonal problem here: stedc updates Q to the eigenvectors of A by
+ * divide and conquer, and sterf computes the eigenvalues only. The work array holds the
+ * off-diagonal E and the workspace of sytrd2, and the rest is given to rocBLAS for stedc.
+ */
+
+/******************** ROCSOLVER DISPATCH ********************/
+inline rocblas_status hipsolver_syevd2_stedc(
+    rocblas_handle handle, int n, float* D, float* E, float* C, int ldc, int* info)
+{
+    return rocsolver_sstedc(handle, rocblas_evect_original, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status hipsolver_syevd2_stedc(
+    rocblas_handle handle, int n, double* D, double* E, double* C, int ldc, int* info)
+{
+    return rocsolver_dstedc(handle, rocblas_evect_original, n, D, E, C, ldc, info);
+}
+
+inline rocblas_status
+    hipsolver_syevd2_sterf(rocblas_handle handle, int n, float* D, float* E, int* info)
+{
+    return rocsolver_ssterf(handle, n, D, E, info);
+}
+
+inline rocblas_status
+    hipsolver_syevd2_sterf(rocblas_handle handle, int n, double* D, double* E, int* info)
+{
+    return rocsolver_dsterf(handle, n, D, E, info);
+}
+
+/******************** SYEVD2 ********************/
+/*! \brief Computes the eigenvalues of the tridiagonal matrix with diagonal D and off-diagonal E
+ *  into D, and, if evect is rocblas_evect_original, updates the orthogonal C to the eigenvectors
+ *  of C * T * C^T. */
+template <typename T>
+rocblas_status hipsolver_syevd2_tridiag(
+    rocblas_handle handle, rocblas_evect evect, int n, T* D, T* E, T* C, int ldc, int* info)
+{
+    if(evect == rocblas_evect_original)
+        return hipsolver_syevd2_stedc(handle, n, D, E, C, ldc, info);
+    return hipsolver_syevd2_sterf(handle, n, D, E, info);
+}
+
+/*! \brief Sets size to the bytes of rocBLAS workspace taken by the tridiagonal eigensolver of
+ *  syevd2 for a matrix of order n, with eigenvectors in a matrix of leading dimension ldc if evect
+ *  is rocblas_evect_original. */
+template <typename T>
+rocblas_status hipsolver_syevd2_tridiag_size(
+    rocblas_handle handle, rocblas_evect evect, int n, int ldc, size_t* size)
+{
+    rocblas_start_device_memory_size_query(handle);
+    rocblas_status status = hipsolver_syevd2_tridiag(
+        handle, evect, n, (T*)nullptr, (T*)nullptr, (T*)nullptr, ldc, (int*)nullptr);
+    rocblas_stop_device_memory_size_query(handle, size);
+
+    if(status == rocblas_status_size_unchanged || status == rocblas_status_size_increased)
+        return rocblas_status_success;
+    return status;
+}
@@ -0,0 +1,657 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocsolver.h"
+#include <algorithm>
+
+/*
+ * Generalized eigensolvers with a factored B.
+ *
+ * sygvd/hegvd factorize B = L * L' (or U' * U) with potrf, reduce the problem to standard form
+ * with sygst/hegst, solve it with syevd/heevd and back-transform the eigenvectors with trsm or
+ * trmm. When B is fixed across calls its factorization can be computed once, and the functions
+ * here run only the last three steps. A single factor can be shared by all the problems in a
+ * batch by giving it a stride of zero.
+ */
+
+/******************** ROCSOLVER DISPATCH ********************/
+inline rocblas_status hipsolver_sygvd_sygst(rocblas_handle handle,
+                                            rocblas_eform  itype,
+                                            rocblas_fill   uplo,
+                                            int            n,
+                                            float*         A,
+                                            int            lda,
+                                            int            strideA,
+                                            float*         B,
+                                            int            ldb,
+                                            int            strideB,
+                                            int            batch_count)
+{
+    return rocsolver_ssygst_strided_batched(handle,
+                                            itype,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_sygst(rocblas_handle handle,
+                                            rocblas_eform  itype,
+                                            rocblas_fill   uplo,
+                                            int            n,
+                                            double*        A,
+                                            int            lda,
+                                            int            strideA,
+                                            double*        B,
+                                            int            ldb,
+                                            int            strideB,
+                                            int            batch_count)
+{
+    return rocsolver_dsygst_strided_batched(handle,
+                                            itype,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_sygst(rocblas_handle         handle,
+                                            rocblas_eform          itype,
+                                            rocblas_fill           uplo,
+                                            int                    n,
+                                            rocblas_float_complex* A,
+                                            int                    lda,
+                                            int                    strideA,
+                                            rocblas_float_complex* B,
+                                            int                    ldb,
+                                            int                    strideB,
+                                            int                    batch_count)
+{
+    return rocsolver_chegst_strided_batched(handle,
+                                            itype,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_sygst(rocblas_handle          handle,
+                                            rocblas_eform           itype,
+                                            rocblas_fill            uplo,
+                                            int                     n,
+                                            rocblas_double_complex* A,
+                                            int                     lda,
+                                            int                     strideA,
+                                            rocblas_double_complex* B,
+                                            int                     ldb,
+                                            int                     strideB,
+                                            int                     batch_count)
+{
+    return rocsolver_zhegst_strided_batched(handle,
+                                            itype,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            B,
+                                            ldb,
+                                            strideB,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_syevd(rocblas_handle handle,
+                                            rocblas_evect  evect,
+                                            rocblas_fill   uplo,
+                                            int            n,
+                                            float*         A,
+                                            int            lda,
+                                            int            strideA,
+                                            float*         D,
+                                            int            strideD,
+                                            float*         E,
+                                            int*           info,
+                                            int            batch_count)
+{
+    return rocsolver_ssyevd_strided_batched(handle,
+                                            evect,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            D,
+                                            strideD,
+                                            E,
+                                            n,
+                                            info,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_syevd(rocblas_handle handle,
+                                            rocblas_evect  evect,
+                                            rocblas_fill   uplo,
+                                            int            n,
+                                            double*        A,
+                                            int            lda,
+                                            int            strideA,
+                                            double*        D,
+                                            int            strideD,
+                                            double*        E,
+                                            int*           info,
+                                            int            batch_count)
+{
+    return rocsolver_dsyevd_strided_batched(handle,
+                                            evect,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            D,
+                                            strideD,
+                                            E,
+                                            n,
+                                            info,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_syevd(rocblas_handle         handle,
+                                            rocblas_evect          evect,
+                                            rocblas_fill           uplo,
+                                            int                    n,
+                                            rocblas_float_complex* A,
+                                            int                    lda,
+                                            int                    strideA,
+                                            float*                 D,
+                                            int                    strideD,
+                                            float*                 E,
+                                            int*                   info,
+                                            int                    batch_count)
+{
+    return rocsolver_cheevd_strided_batched(handle,
+                                            evect,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            D,
+                                            strideD,
+                                            E,
+                                            n,
+                                            info,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_syevd(rocblas_handle          handle,
+                                            rocblas_evect           evect,
+                                            rocblas_fill            uplo,
+                                            int                     n,
+                                            rocblas_double_complex* A,
+                                            int                     lda,
+                                            int                     strideA,
+                                            double*                 D,
+                                            int                     strideD,
+                                            double*                 E,
+                                            int*                    info,
+                                            int                     batch_count)
+{
+    return rocsolver_zheevd_strided_batched(handle,
+                                            evect,
+                                            uplo,
+                                            n,
+                                            A,
+                                            lda,
+                                            strideA,
+                                            D,
+                                            strideD,
+                                            E,
+                                            n,
+                                            info,
+                                            batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trsm(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation trans,
+                                           int               n,
+                                           const float*      B,
+                                           int               ldb,
+                                           int               strideB,
+                                           float*            A,
+                                           int               lda,
+                                           int               strideA,
+                                           int               batch_count)
+{
+    float one = 1;
+    return rocblas_strsm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trsm(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation trans,
+                                           int               n,
+                                           const double*     B,
+                                           int               ldb,
+                                           int               strideB,
+                                           double*           A,
+                                           int               lda,
+                                           int               strideA,
+                                           int               batch_count)
+{
+    double one = 1;
+    return rocblas_dtrsm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trsm(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_operation            trans,
+                                           int                          n,
+                                           const rocblas_float_complex* B,
+                                           int                          ldb,
+                                           int                          strideB,
+                                           rocblas_float_complex*       A,
+                                           int                          lda,
+                                           int                          strideA,
+                                           int                          batch_count)
+{
+    rocblas_float_complex one = {1, 0};
+    return rocblas_ctrsm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trsm(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_operation             trans,
+                                           int                           n,
+                                           const rocblas_double_complex* B,
+                                           int                           ldb,
+                                           int                           strideB,
+                                           rocblas_double_complex*       A,
+                                           int                           lda,
+                                           int                           strideA,
+                                           int                           batch_count)
+{
+    rocblas_double_complex one = {1, 0};
+    return rocblas_ztrsm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trmm(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation trans,
+                                           int               n,
+                                           const float*      B,
+                                           int               ldb,
+                                           int               strideB,
+                                           float*            A,
+                                           int               lda,
+                                           int               strideA,
+                                           int               batch_count)
+{
+    float one = 1;
+    return rocblas_strmm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trmm(rocblas_handle    handle,
+                                           rocblas_fill      uplo,
+                                           rocblas_operation trans,
+                                           int               n,
+                                           const double*     B,
+                                           int               ldb,
+                                           int               strideB,
+                                           double*           A,
+                                           int               lda,
+                                           int               strideA,
+                                           int               batch_count)
+{
+    double one = 1;
+    return rocblas_dtrmm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trmm(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_operation            trans,
+                                           int                          n,
+                                           const rocblas_float_complex* B,
+                                           int                          ldb,
+                                           int                          strideB,
+                                           rocblas_float_complex*       A,
+                                           int                          lda,
+                                           int                          strideA,
+                                           int                          batch_count)
+{
+    rocblas_float_complex one = {1, 0};
+    return rocblas_ctrmm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+
+inline rocblas_status hipsolver_sygvd_trmm(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_operation             trans,
+                                           int                           n,
+                                           const rocblas_double_complex* B,
+                                           int                           ldb,
+                                           int                           strideB,
+                                           rocblas_double_complex*       A,
+                                           int                           lda,
+                                           int                           strideA,
+                                           int                           batch_count)
+{
+    rocblas_double_complex one = {1, 0};
+    return rocblas_ztrmm_strided_batched(handle,
+                                         rocblas_side_left,
+                                         uplo,
+                                         trans,
+                                         rocblas_diagonal_non_unit,
+                                         n,
+                                         n,
+                                         &one,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         batch_count);
+}
+/******************** SYGVD_FACTORED ********************/
+/*! \brief Back-transform applied to the eigenvectors of the reduced problem.
+
+    Returns true if it is a triangular solve with the factor of B, and false if it is a
+    triangular product. */
+inline bool hipsolver_sygvd_back_solve(rocblas_eform itype)
+{
+    return itype != rocblas_eform_bax;
+}
+
+/*! \brief Operation applied to the factor of B by the back-transform. */
+inline rocblas_operation hipsolver_sygvd_back_op(rocblas_eform itype, rocblas_fill uplo)
+{
+    // X = inv(L') * Z or X = inv(U) * Z for itype 1 and 2, and X = L * Z or X = U' * Z for itype 3
+    bool lower = uplo == rocblas_fill_lower;
+    if(hipsolver_sygvd_back_solve(itype))
+        return lower ? rocblas_operation_conjugate_transpose : rocblas_operation_none;
+    else
+        return lower ? rocblas_operation_none : rocblas_operation_conjugate_transpose;
+}
+
+/*! \brief Workspace in bytes of hipsolver_sygvd_factored, not counting the E arrays. A and D
+    are only used to select the precision. */
+template <typename T, typename S>
+inline rocblas_status hipsolver_sygvd_factored_bufferSize(rocblas_handle handle,
+                                                          rocblas_eform  itype,
+                                                          rocblas_evect  evect,
+                                                          rocblas_fill   uplo,
+                                                          int            n,
+                                                          const T*       A,
+                                                          int            lda,
+                                                          int            strideA,
+                                                          int            ldb,
+                                                          int            strideB,
+                                                          const S*       D,
+                                                          int            strideD,
+                                                          int            batch_count,
+                                                          size_t*        lwork)
+{
+    if(n < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    rocblas_operation trans = hipsolver_sygvd_back_op(itype, uplo);
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolver_sygvd_sygst(handle,
+                          itype,
+                          uplo,
+                          n,
+                          (T*)nullptr,
+                          lda,
+                          strideA,
+                          (T*)nullptr,
+                          ldb,
+                          strideB,
+                          batch_count);
+    hipsolver_sygvd_syevd(handle,
+                          evect,
+                          uplo,
+                          n,
+                          (T*)nullptr,
+                          lda,
+                          strideA,
+                          (S*)nullptr,
+                          strideD,
+                          (S*)nullptr,
+                          nullptr,
+                          batch_count);
+    if(evect == rocblas_evect_original)
+    {
+        if(hipsolver_sygvd_back_solve(itype))
+            hipsolver_sygvd_trsm(handle,
+                                 uplo,
+                                 trans,
+                                 n,
+                                 (T*)nullptr,
+                                 ldb,
+                                 strideB,
+                                 (T*)nullptr,
+                                 lda,
+                                 strideA,
+                                 batch_count);
+        else
+            hipsolver_sygvd_trmm(handle,
+                                 uplo,
+                                 trans,
+                                 n,
+                                 (T*)nullptr,
+                                 ldb,
+                                 strideB,
+                                 (T*)nullptr,
+                                 lda,
+                                 strideA,
+                                 batch_count);
+    }
+    return rocblas_stop_device_memory_size_query(handle, lwork);
+}
+
+/*! \brief Solves the generalized eigenproblems of a strided batch given the Cholesky factors of
+    their B matrices, as computed by potrf with the same uplo.
+
+    The rocBLAS workspace of handle must already be set, and E must hold n * batch_count reals.
+    The factors are not modified. */
+template <typename T, typename S>
+rocblas_status hipsolver_sygvd_factored(rocblas_handle handle,
+                                        rocblas_eform  itype,
+                                        rocblas_evect  evect,
+                                        rocblas_fill   uplo,
+                                        int            n,
+                                        T*             A,
+                                        int            lda,
+                                        int            strideA,
+                                        T*             B,
+                                        int            ldb,
+                                        int            strideB,
+                                        S*             D,
+                                        int            strideD,
+                                        S*             E,
+                                        int*           info,
+                                        int            batch_count)
+{
+    if(n < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(n && batch_count && (!A || !B || !D || !E))
+        return rocblas_status_invalid_pointer;
+    if(batch_count && !info)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_status status = hipsolver_sygvd_sygst(handle,
+                                                  itype,
+                                                  uplo,
+                                                  n,
+                                                  A,
+                                                  lda,
+                                                  strideA,
+                                                  B,
+                                                  ldb,
+                                                  strideB,
+                                                  batch_count);
+    if(status != rocblas_status_success)
+        return status;
+
+    status = hipsolver_sygvd_syevd(handle,
+                                   evect,
+                                   uplo,
+                                   n,
+                                   A,
+                                   lda,
+                                   strideA,
+                                   D,
+                                   strideD,
+                                   E,
+                                   info,
+                                   batch_count);
+    if(status != rocblas_status_success || evect != rocblas_evect_original)
+        return status;
+
+    // the eigenvectors of the problems that failed to converge are transformed as well, as in
+    // sygvd; their info values tell them apart
+    rocblas_operation trans = hipsolver_sygvd_back_op(itype, uplo);
+    if(hipsolver_sygvd_back_solve(itype))
+        return hipsolver_sygvd_trsm(handle,
+                                    uplo,
+                                    trans,
+                                    n,
+                                    B,
+                                    ldb,
+                                    strideB,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    batch_count);
+    else
+        return hipsolver_sygvd_trmm(handle,
+                                    uplo,
+                                    trans,
+                                    n,
+                                    B,
+                                    ldb,
+                                    strideB,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    batch_count);
+}
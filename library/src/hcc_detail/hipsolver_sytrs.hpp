@@ -0,0 +1,484 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_capture.hpp"
+#include "hipsolver_handle.hpp"
+#include "rocblas.h"
+#include "rocsolver.h"
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+/*
+ * Symmetric indefinite solver.
+ *
+ * rocSOLVER provides the Bunch-Kaufman factorization (sytrf) but no solver using it, so sytrs is
+ * composed from rocBLAS level-1 and level-2 routines following LAPACK's unblocked xSYTRS. The
+ * pivots and the block diagonal D are copied to the host once, and the loop over the pivot
+ * blocks is driven from the host, so the solver cannot be captured in a graph. Complex matrices
+ * are symmetric rather than Hermitian, as in LAPACK's csytrs and zsytrs.
+ */
+
+#define HIPSOLVER_SYTRS_CHECK(STATUS)         \
+    do                                        \
+    {                                         \
+        rocblas_status _status = (STATUS);    \
+        if(_status != rocblas_status_success) \
+            return _status;                   \
+    } while(0)
+
+/******************** PRECISION TRAITS ********************/
+template <typename T>
+struct hipsolver_sytrs_traits
+{
+    using host = T;
+};
+
+template <>
+struct hipsolver_sytrs_traits<rocblas_float_complex>
+{
+    using host = std::complex<float>;
+};
+
+template <>
+struct hipsolver_sytrs_traits<rocblas_double_complex>
+{
+    using host = std::complex<double>;
+};
+
+/******************** ROCBLAS DISPATCH ********************/
+inline rocblas_status hipsolver_sytrs_swap(
+    rocblas_handle handle, int nrhs, float* x, float* y, int ldb)
+{
+    return rocblas_sswap(handle, nrhs, x, ldb, y, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_swap(
+    rocblas_handle handle, int nrhs, double* x, double* y, int ldb)
+{
+    return rocblas_dswap(handle, nrhs, x, ldb, y, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_swap(
+    rocblas_handle handle, int nrhs, rocblas_float_complex* x, rocblas_float_complex* y, int ldb)
+{
+    return rocblas_cswap(handle, nrhs, x, ldb, y, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_swap(
+    rocblas_handle handle, int nrhs, rocblas_double_complex* x, rocblas_double_complex* y, int ldb)
+{
+    return rocblas_zswap(handle, nrhs, x, ldb, y, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_scal(
+    rocblas_handle handle, int nrhs, float alpha, float* x, int incx)
+{
+    return rocblas_sscal(handle, nrhs, &alpha, x, incx);
+}
+
+inline rocblas_status hipsolver_sytrs_scal(
+    rocblas_handle handle, int nrhs, double alpha, double* x, int incx)
+{
+    return rocblas_dscal(handle, nrhs, &alpha, x, incx);
+}
+
+inline rocblas_status hipsolver_sytrs_scal(
+    rocblas_handle handle, int nrhs, std::complex<float> alpha, rocblas_float_complex* x, int incx)
+{
+    return rocblas_cscal(handle, nrhs, (rocblas_float_complex*)&alpha, x, incx);
+}
+
+inline rocblas_status hipsolver_sytrs_scal(rocblas_handle          handle,
+                                           int                     nrhs,
+                                           std::complex<double>    alpha,
+                                           rocblas_double_complex* x,
+                                           int                     incx)
+{
+    return rocblas_zscal(handle, nrhs, (rocblas_double_complex*)&alpha, x, incx);
+}
+
+inline rocblas_status hipsolver_sytrs_axpy(
+    rocblas_handle handle, int nrhs, float alpha, const float* x, int incx, float* y, int incy)
+{
+    return rocblas_saxpy(handle, nrhs, &alpha, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_axpy(
+    rocblas_handle handle, int nrhs, double alpha, const double* x, int incx, double* y, int incy)
+{
+    return rocblas_daxpy(handle, nrhs, &alpha, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_axpy(rocblas_handle               handle,
+                                           int                          nrhs,
+                                           std::complex<float>          alpha,
+                                           const rocblas_float_complex* x,
+                                           int                          incx,
+                                           rocblas_float_complex*       y,
+                                           int                          incy)
+{
+    return rocblas_caxpy(handle, nrhs, (rocblas_float_complex*)&alpha, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_axpy(rocblas_handle                handle,
+                                           int                           nrhs,
+                                           std::complex<double>          alpha,
+                                           const rocblas_double_complex* x,
+                                           int                           incx,
+                                           rocblas_double_complex*       y,
+                                           int                           incy)
+{
+    return rocblas_zaxpy(handle, nrhs, (rocblas_double_complex*)&alpha, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_copy(
+    rocblas_handle handle, int nrhs, const float* x, int incx, float* y, int incy)
+{
+    return rocblas_scopy(handle, nrhs, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_copy(
+    rocblas_handle handle, int nrhs, const double* x, int incx, double* y, int incy)
+{
+    return rocblas_dcopy(handle, nrhs, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_copy(rocblas_handle               handle,
+                                           int                          nrhs,
+                                           const rocblas_float_complex* x,
+                                           int                          incx,
+                                           rocblas_float_complex*       y,
+                                           int                          incy)
+{
+    return rocblas_ccopy(handle, nrhs, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_copy(rocblas_handle                handle,
+                                           int                           nrhs,
+                                           const rocblas_double_complex* x,
+                                           int                           incx,
+                                           rocblas_double_complex*       y,
+                                           int                           incy)
+{
+    return rocblas_zcopy(handle, nrhs, x, incx, y, incy);
+}
+
+inline rocblas_status hipsolver_sytrs_ger(
+    rocblas_handle handle, int m, int nrhs, const float* x, const float* y, float* B, int ldb)
+{
+    float alpha = -1;
+    return rocblas_sger(handle, m, nrhs, &alpha, x, 1, y, ldb, B, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_ger(
+    rocblas_handle handle, int m, int nrhs, const double* x, const double* y, double* B, int ldb)
+{
+    double alpha = -1;
+    return rocblas_dger(handle, m, nrhs, &alpha, x, 1, y, ldb, B, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_ger(rocblas_handle               handle,
+                                          int                          m,
+                                          int                          nrhs,
+                                          const rocblas_float_complex* x,
+                                          const rocblas_float_complex* y,
+                                          rocblas_float_complex*       B,
+                                          int                          ldb)
+{
+    std::complex<float> alpha = -1;
+    return rocblas_cgeru(handle, m, nrhs, (rocblas_float_complex*)&alpha, x, 1, y, ldb, B, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_ger(rocblas_handle                handle,
+                                          int                           m,
+                                          int                           nrhs,
+                                          const rocblas_double_complex* x,
+                                          const rocblas_double_complex* y,
+                                          rocblas_double_complex*       B,
+                                          int                           ldb)
+{
+    std::complex<double> alpha = -1;
+    return rocblas_zgeru(handle, m, nrhs, (rocblas_double_complex*)&alpha, x, 1, y, ldb, B, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_gemv(
+    rocblas_handle handle, int m, int nrhs, const float* B, int ldb, const float* x, float* y)
+{
+    float alpha = -1, beta = 1;
+    return rocblas_sgemv(
+        handle, rocblas_operation_transpose, m, nrhs, &alpha, B, ldb, x, 1, &beta, y, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_gemv(
+    rocblas_handle handle, int m, int nrhs, const double* B, int ldb, const double* x, double* y)
+{
+    double alpha = -1, beta = 1;
+    return rocblas_dgemv(
+        handle, rocblas_operation_transpose, m, nrhs, &alpha, B, ldb, x, 1, &beta, y, ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_gemv(rocblas_handle               handle,
+                                           int                          m,
+                                           int                          nrhs,
+                                           const rocblas_float_complex* B,
+                                           int                          ldb,
+                                           const rocblas_float_complex* x,
+                                           rocblas_float_complex*       y)
+{
+    std::complex<float> alpha = -1, beta = 1;
+    return rocblas_cgemv(handle,
+                         rocblas_operation_transpose,
+                         m,
+                         nrhs,
+                         (rocblas_float_complex*)&alpha,
+                         B,
+                         ldb,
+                         x,
+                         1,
+                         (rocblas_float_complex*)&beta,
+                         y,
+                         ldb);
+}
+
+inline rocblas_status hipsolver_sytrs_gemv(rocblas_handle                handle,
+                                           int                           m,
+                                           int                           nrhs,
+                                           const rocblas_double_complex* B,
+                                           int                           ldb,
+                                           const rocblas_double_complex* x,
+                                           rocblas_double_complex*       y)
+{
+    std::complex<double> alpha = -1, beta = 1;
+    return rocblas_zgemv(handle,
+                         rocblas_operation_transpose,
+                         m,
+                         nrhs,
+                         (rocblas_double_complex*)&alpha,
+                         B,
+                         ldb,
+                         x,
+                         1,
+                         (rocblas_double_complex*)&beta,
+                         y,
+                         ldb);
+}
+
+/******************** HELPERS ********************/
+/*! \brief Bytes of temporary storage used by the symmetric indefinite solver, besides the
+ *  rocBLAS workspace: one row of the right-hand sides.
+ */
+template <typename T>
+inline size_t hipsolver_sytrs_tmp_size(int nrhs)
+{
+    return hipsolver_handle_data::align(sizeof(T) * std::max(1, nrhs));
+}
+
+/*! \brief Total workspace in bytes of the symmetric indefinite solver, including the temporary
+ *  storage at its front.
+ */
+template <typename T>
+inline rocblas_status hipsolver_sytrs_bufferSize(
+    rocblas_handle handle, int n, int nrhs, int lda, int ldb, size_t* lwork)
+{
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n))
+        return rocblas_status_invalid_size;
+
+    size_t sz;
+    rocblas_start_device_memory_size_query(handle);
+    hipsolver_sytrs_gemv(handle, n, nrhs, (T*)nullptr, ldb, (T*)nullptr, (T*)nullptr);
+    rocblas_status status = rocblas_stop_device_memory_size_query(handle, &sz);
+    if(status != rocblas_status_success)
+        return status;
+
+    *lwork = hipsolver_sytrs_tmp_size<T>(nrhs) + sz;
+    return rocblas_status_success;
+}
+
+/*! \brief Solves A * X = B using the factorization A = U * D * U**T or A = L * D * L**T computed
+ *  by sytrf.
+ *
+ *  The rocBLAS workspace of handle must already be set, and tmp must hold
+ *  hipsolver_sytrs_tmp_size<T>(nrhs) bytes. B is overwritten with the solution.
+ */
+template <typename T>
+rocblas_status hipsolver_sytrs(rocblas_handle handle,
+                               rocblas_fill   uplo,
+                               int            n,
+                               int            nrhs,
+                               const T*       A,
+                               int            lda,
+                               const int*     ipiv,
+                               T*             B,
+                               int            ldb,
+                               void*          tmp,
+                               int*           devInfo)
+{
+    using H = typename hipsolver_sytrs_traits<T>::host;
+
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n))
+        return rocblas_status_invalid_size;
+    if(!devInfo || (n && (!A || !ipiv)) || (n && nrhs && !B))
+        return rocblas_status_invalid_pointer;
+
+    hipStream_t    stream;
+    rocblas_status status = rocblas_get_stream(handle, &stream);
+    if(status != rocblas_status_success)
+        return status;
+
+    // the loop over the pivot blocks is driven by pivots read back from the device
+    hipsolver_forbid_capture(stream);
+
+    if(hipMemsetAsync(devInfo, 0, sizeof(int), stream) != hipSuccess)
+        return rocblas_status_internal_error;
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // the diagonal of D, and its off-diagonal, where e[k] couples rows k and k + 1
+    std::vector<int> hipiv(n);
+    std::vector<H>   d(n), e(std::max(1, n - 1));
+    const T*         Ae = uplo == rocblas_fill_upper ? A + lda : A + 1;
+    if(hipMemcpyAsync(hipiv.data(), ipiv, sizeof(int) * n, hipMemcpyDeviceToHost, stream)
+       != hipSuccess)
+        return rocblas_status_internal_error;
+    if(hipMemcpy2DAsync(d.data(),
+                        sizeof(T),
+                        A,
+                        sizeof(T) * (lda + 1),
+                        sizeof(T),
+                        n,
+                        hipMemcpyDeviceToHost,
+                        stream)
+       != hipSuccess)
+        return rocblas_status_internal_error;
+    if(n > 1
+       && hipMemcpy2DAsync(e.data(),
+                           sizeof(T),
+                           Ae,
+                           sizeof(T) * (lda + 1),
+                           sizeof(T),
+                           n - 1,
+                           hipMemcpyDeviceToHost,
+                           stream)
+              != hipSuccess)
+        return rocblas_status_internal_error;
+    if(hipStreamSynchronize(stream) != hipSuccess)
+        return rocblas_status_internal_error;
+
+    T*   t   = (T*)tmp;
+    auto row = [&](int i) { return B + i; };
+    auto col = [&](int i, int j) { return A + i + size_t(j) * lda; };
+    auto swap = [&](int i, int j) {
+        return i == j ? rocblas_status_success
+                      : hipsolver_sytrs_swap(handle, nrhs, row(i), row(j), ldb);
+    };
+    auto solve1 = [&](int i) {
+        // applies the inverse of the 1 x 1 block D(i, i)
+        return hipsolver_sytrs_scal(handle, nrhs, H(1) / d[i], row(i), ldb);
+    };
+    auto solve2 = [&](int i) {
+        // applies the inverse of the 2 x 2 block D(i:i + 1, i:i + 1), as in xSYTRS
+        H akm1 = d[i] / e[i], ak = d[i + 1] / e[i], den = e[i] * (akm1 * ak - H(1));
+        HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_copy(handle, nrhs, row(i), ldb, t, 1));
+        HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_scal(handle, nrhs, ak / den, row(i), ldb));
+        HIPSOLVER_SYTRS_CHECK(
+            hipsolver_sytrs_axpy(handle, nrhs, H(-1) / den, row(i + 1), ldb, row(i), ldb));
+        HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_scal(handle, nrhs, akm1 / den, row(i + 1), ldb));
+        return hipsolver_sytrs_axpy(handle, nrhs, H(-1) / den, t, 1, row(i + 1), ldb);
+    };
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // solve U * D * Y = B, from the last pivot block to the first
+        for(int k = n - 1; k >= 0;)
+        {
+            if(hipiv[k] > 0)
+            {
+                HIPSOLVER_SYTRS_CHECK(swap(k, hipiv[k] - 1));
+                HIPSOLVER_SYTRS_CHECK(
+                    hipsolver_sytrs_ger(handle, k, nrhs, col(0, k), row(k), B, ldb));
+                HIPSOLVER_SYTRS_CHECK(solve1(k));
+                k -= 1;
+            }
+            else
+            {
+                HIPSOLVER_SYTRS_CHECK(swap(k - 1, -hipiv[k] - 1));
+                HIPSOLVER_SYTRS_CHECK(
+                    hipsolver_sytrs_ger(handle, k - 1, nrhs, col(0, k), row(k), B, ldb));
+                HIPSOLVER_SYTRS_CHECK(
+                    hipsolver_sytrs_ger(handle, k - 1, nrhs, col(0, k - 1), row(k - 1), B, ldb));
+                HIPSOLVER_SYTRS_CHECK(solve2(k - 1));
+                k -= 2;
+            }
+        }
+
+        // solve U**T * X = Y, from the first pivot block to the last
+        for(int k = 0; k < n;)
+        {
+            HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_gemv(handle, k, nrhs, B, ldb, col(0, k), row(k)));
+            if(hipiv[k] > 0)
+            {
+                HIPSOLVER_SYTRS_CHECK(swap(k, hipiv[k] - 1));
+                k += 1;
+            }
+            else
+            {
+                HIPSOLVER_SYTRS_CHECK(
+                    hipsolver_sytrs_gemv(handle, k, nrhs, B, ldb, col(0, k + 1), row(k + 1)));
+                HIPSOLVER_SYTRS_CHECK(swap(k, -hipiv[k] - 1));
+                k += 2;
+            }
+        }
+    }
+    else
+    {
+        // solve L * D * Y = B, from the first pivot block to the last
+        for(int k = 0; k < n;)
+        {
+            if(hipiv[k] > 0)
+            {
+                HIPSOLVER_SYTRS_CHECK(swap(k, hipiv[k] - 1));
+                HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_ger(
+                    handle, n - k - 1, nrhs, col(k + 1, k), row(k), row(k + 1), ldb));
+                HIPSOLVER_SYTRS_CHECK(solve1(k));
+                k += 1;
+            }
+            else
+            {
+                HIPSOLVER_SYTRS_CHECK(swap(k + 1, -hipiv[k] - 1));
+                HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_ger(
+                    handle, n - k - 2, nrhs, col(k + 2, k), row(k), row(k + 2), ldb));
+                HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_ger(
+                    handle, n - k - 2, nrhs, col(k + 2, k + 1), row(k + 1), row(k + 2), ldb));
+                HIPSOLVER_SYTRS_CHECK(solve2(k));
+                k += 2;
+            }
+        }
+
+        // solve L**T * X = Y, from the last pivot block to the first
+        for(int k = n - 1; k >= 0;)
+        {
+            HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_gemv(
+                handle, n - k - 1, nrhs, row(k + 1), ldb, col(k + 1, k), row(k)));
+            if(hipiv[k] > 0)
+            {
+                HIPSOLVER_SYTRS_CHECK(swap(k, hipiv[k] - 1));
+                k -= 1;
+            }
+            else
+            {
+                HIPSOLVER_SYTRS_CHECK(hipsolver_sytrs_gemv(
+                    handle, n - k - 1, nrhs, row(k + 1), ldb, col(k + 1, k - 1), row(k - 1)));
+                HIPSOLVER_SYTRS_CHECK(swap(k, -hipiv[k] - 1));
+                k -= 2;
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
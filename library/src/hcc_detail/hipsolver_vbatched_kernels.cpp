@@ -0,0 +1,369 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Device code, built as a HIP source; see hipsolver_vbatched_kernels.hpp
+
+#include "hipsolver_vbatched_kernels.hpp"
+
+#ifdef HIPSOLVER_DEVICE_KERNELS
+
+#include "hipsolver_block.hpp"
+#include <hip/hip_runtime.h>
+
+// threads of a block solving one problem
+constexpr int hipsolver_vbatched_threads = 256;
+
+/*! \brief Type of the entries of the matrices in device code. */
+template <typename T>
+struct hipsolver_vbatched_type
+{
+    using type = T;
+};
+
+template <>
+struct hipsolver_vbatched_type<hipsolverComplex>
+{
+    using type = hipFloatComplex;
+};
+
+template <>
+struct hipsolver_vbatched_type<hipsolverDoubleComplex>
+{
+    using type = hipDoubleComplex;
+};
+
+// a leading dimension is invalid below the order, or below 1
+__device__ inline bool hipsolver_vbatched_bad_ld(int ld, int n)
+{
+    return ld < (n > 1 ? n : 1);
+}
+
+/*! \brief Loads the c columns of a, of n rows, to tile, whose leading dimension is n, with the
+ *  threads of the block. */
+template <typename T>
+__device__ inline void hipsolver_vbatched_load(int n, int c, const T* a, int64_t lda, T* tile)
+{
+    for(int t = threadIdx.x; t < n * c; t += hipsolver_vbatched_threads)
+        tile[t] = a[t % n + (t / n) * lda];
+    __syncthreads();
+}
+
+template <typename T>
+__device__ inline void hipsolver_vbatched_store(int n, int c, const T* tile, T* a, int64_t lda)
+{
+    __syncthreads();
+    for(int t = threadIdx.x; t < n * c; t += hipsolver_vbatched_threads)
+        a[t % n + (t / n) * lda] = tile[t];
+}
+
+/*! \brief Writes to offset the exclusive prefix sums of the orders n, with a single block. Invalid
+ *  orders count as 0. */
+__global__ void __launch_bounds__(hipsolver_vbatched_threads)
+    hipsolver_vbatched_offsets_kernel(const int* n, int64_t* offset, int batch_count)
+{
+    __shared__ int64_t sum[hipsolver_vbatched_threads];
+
+    int     tid   = threadIdx.x;
+    int64_t carry = 0;
+    for(int first = 0; first < batch_count; first += hipsolver_vbatched_threads)
+    {
+        int     b = first + tid;
+        int64_t v = b < batch_count && n[b] > 0 ? n[b] : 0;
+        sum[tid]  = v;
+        __syncthreads();
+        for(int s = 1; s < hipsolver_vbatched_threads; s *= 2)
+        {
+            int64_t x = tid >= s ? sum[tid - s] : 0;
+            __syncthreads();
+            sum[tid] += x;
+            __syncthreads();
+        }
+        if(b < batch_count)
+            offset[b] = carry + sum[tid] - v;
+        carry += sum[hipsolver_vbatched_threads - 1];
+        __syncthreads();
+    }
+}
+
+template <typename T>
+__global__ void __launch_bounds__(hipsolver_vbatched_threads)
+    hipsolver_vbatched_potrf_kernel(
+        hipsolverFillMode_t uplo, const int* n, T* const* A, const int* lda, int* info)
+{
+    constexpr int S = hipsolver_vbatched_tile;
+    __shared__ T  tile[S * S];
+
+    int b  = blockIdx.x;
+    int nb = n[b];
+    int i  = nb < 0 ? -2 : hipsolver_vbatched_bad_ld(lda[b], nb) ? -4 : 0;
+    if(i == 0 && nb > 0)
+    {
+        T* a = A[b];
+        if(nb <= S)
+        {
+            hipsolver_vbatched_load(nb, nb, a, lda[b], tile);
+            i = hipsolver_block_potrf<hipsolver_vbatched_threads>(uplo, nb, tile, nb);
+            hipsolver_vbatched_store(nb, nb, tile, a, lda[b]);
+        }
+        else
+            i = hipsolver_block_potrf<hipsolver_vbatched_threads>(uplo, nb, a, lda[b]);
+    }
+    if(threadIdx.x == 0)
+        info[b] = i;
+}
+
+template <typename T>
+__global__ void __launch_bounds__(hipsolver_vbatched_threads)
+    hipsolver_vbatched_getrf_kernel(const int*     n,
+                                    T* const*      A,
+                                    const int*     lda,
+                                    const int64_t* offset,
+                                    int*           ipiv,
+                                    int*           info)
+{
+    constexpr int S = hipsolver_vbatched_tile;
+    __shared__ T  tile[S * S];
+
+    int b  = blockIdx.x;
+    int nb = n[b];
+    int i  = nb < 0 ? -1 : hipsolver_vbatched_bad_ld(lda[b], nb) ? -3 : 0;
+    if(i == 0 && nb > 0)
+    {
+        T*   a = A[b];
+        int* p = ipiv ? ipiv + offset[b] : nullptr;
+        if(nb <= S)
+        {
+            hipsolver_vbatched_load(nb, nb, a, lda[b], tile);
+            i = hipsolver_block_getrf<hipsolver_vbatched_threads>(nb, tile, nb, p);
+            hipsolver_vbatched_store(nb, nb, tile, a, lda[b]);
+        }
+        else
+            i = hipsolver_block_getrf<hipsolver_vbatched_threads>(nb, a, lda[b], p);
+    }
+    if(threadIdx.x == 0)
+        info[b] = i;
+}
+
+// the right-hand sides stay in global memory
+template <typename T>
+__global__ void __launch_bounds__(hipsolver_vbatched_threads)
+    hipsolver_vbatched_getrs_kernel(hipsolverOperation_t trans,
+                                    const int*           n,
+                                    const int*           nrhs,
+                                    T* const*            A,
+                                    const int*           lda,
+                                    const int64_t*       offset,
+                                    const int*           ipiv,
+                                    T* const*            B,
+                                    const int*           ldb,
+                                    int*                 info)
+{
+    constexpr int S = hipsolver_vbatched_tile;
+    __shared__ T  tile[S * S];
+
+    int b  = blockIdx.x;
+    int nb = n[b];
+    int kb = nrhs[b];
+    int i  = 0;
+    if(nb < 0)
+        i = -2;
+    else if(kb < 0)
+        i = -3;
+    else if(hipsolver_vbatched_bad_ld(lda[b], nb))
+        i = -5;
+    else if(hipsolver_vbatched_bad_ld(ldb[b], nb))
+        i = -8;
+    if(i == 0 && nb > 0 && kb > 0)
+    {
+        const int* p = ipiv ? ipiv + offset[b] : nullptr;
+        if(nb <= S)
+        {
+            hipsolver_vbatched_load(nb, nb, A[b], lda[b], tile);
+            hipsolver_block_getrs<hipsolver_vbatched_threads>(
+                trans, nb, kb, tile, nb, p, B[b], ldb[b]);
+        }
+        else
+            hipsolver_block_getrs<hipsolver_vbatched_threads>(
+                trans, nb, kb, A[b], lda[b], p, B[b], ldb[b]);
+    }
+    if(threadIdx.x == 0)
+        info[b] = i;
+}
+
+inline hipError_t
+    hipsolver_vbatched_offsets(hipStream_t stream, const int* n, int64_t* offset, int batch_count)
+{
+    hipLaunchKernelGGL(hipsolver_vbatched_offsets_kernel,
+                       dim3(1),
+                       dim3(hipsolver_vbatched_threads),
+                       0,
+                       stream,
+                       n,
+                       offset,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipsolver_vbatched_potrf_launch(hipStream_t         stream,
+                                           hipsolverFillMode_t uplo,
+                                           const int*          n,
+                                           T* const*           A,
+                                           const int*          lda,
+                                           int*                info,
+                                           int                 batch_count)
+{
+    using D = typename hipsolver_vbatched_type<T>::type;
+
+    if(batch_count < 1)
+        return hipSuccess;
+    hipLaunchKernelGGL(hipsolver_vbatched_potrf_kernel<D>,
+                       dim3(batch_count),
+                       dim3(hipsolver_vbatched_threads),
+                       0,
+                       stream,
+                       uplo,
+                       n,
+                       (D* const*)A,
+                       lda,
+                       info);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipsolver_vbatched_getrf_launch(hipStream_t stream,
+                                           const int*  n,
+                                           T* const*   A,
+                                           const int*  lda,
+                                           int64_t*    offset,
+                                           int*        ipiv,
+                                           int*        info,
+                                           int         batch_count)
+{
+    using D = typename hipsolver_vbatched_type<T>::type;
+
+    if(batch_count < 1)
+        return hipSuccess;
+    if(ipiv)
+    {
+        hipError_t err = hipsolver_vbatched_offsets(stream, n, offset, batch_count);
+        if(err != hipSuccess)
+            return err;
+    }
+    hipLaunchKernelGGL(hipsolver_vbatched_getrf_kernel<D>,
+                       dim3(batch_count),
+                       dim3(hipsolver_vbatched_threads),
+                       0,
+                       stream,
+                       n,
+                       (D* const*)A,
+                       lda,
+                       offset,
+                       ipiv,
+                       info);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipsolver_vbatched_getrs_launch(hipStream_t          stream,
+                                           hipsolverOperation_t trans,
+                                           const int*           n,
+                                           const int*           nrhs,
+                                           T* const*            A,
+                                           const int*           lda,
+                                           int64_t*             offset,
+                                           const int*           ipiv,
+                                           T* const*            B,
+                                           const int*           ldb,
+                                           int*                 info,
+                                           int                  batch_count)
+{
+    using D = typename hipsolver_vbatched_type<T>::type;
+
+    if(batch_count < 1)
+        return hipSuccess;
+    if(ipiv)
+    {
+        hipError_t err = hipsolver_vbatched_offsets(stream, n, offset, batch_count);
+        if(err != hipSuccess)
+            return err;
+    }
+    hipLaunchKernelGGL(hipsolver_vbatched_getrs_kernel<D>,
+                       dim3(batch_count),
+                       dim3(hipsolver_vbatched_threads),
+                       0,
+                       stream,
+                       trans,
+                       n,
+                       nrhs,
+                       (D* const*)A,
+                       lda,
+                       offset,
+                       ipiv,
+                       (D* const*)B,
+                       ldb,
+                       info);
+    return hipGetLastError();
+}
+
+#else // HIPSOLVER_DEVICE_KERNELS
+
+// Without the kernels, hipsolver_vbatched_kernels is false, so the variable-size batches are
+// solved by the batched functions instead
+
+template <typename T>
+hipError_t hipsolver_vbatched_potrf_launch(
+    hipStream_t, hipsolverFillMode_t, const int*, T* const*, const int*, int*, int)
+{
+    return hipErrorNotSupported;
+}
+
+template <typename T>
+hipError_t hipsolver_vbatched_getrf_launch(
+    hipStream_t, const int*, T* const*, const int*, int64_t*, int*, int*, int)
+{
+    return hipErrorNotSupported;
+}
+
+template <typename T>
+hipError_t hipsolver_vbatched_getrs_launch(hipStream_t,
+                                           hipsolverOperation_t,
+                                           const int*,
+                                           const int*,
+                                           T* const*,
+                                           const int*,
+                                           int64_t*,
+                                           const int*,
+                                           T* const*,
+                                           const int*,
+                                           int*,
+                                           int)
+{
+    return hipErrorNotSupported;
+}
+
+#endif // HIPSOLVER_DEVICE_KERNELS
+
+#define HIPSOLVER_VBATCHED_INSTANTIATE(T)                                                \
+    template hipError_t hipsolver_vbatched_potrf_launch<T>(                              \
+        hipStream_t, hipsolverFillMode_t, const int*, T* const*, const int*, int*, int); \
+    template hipError_t hipsolver_vbatched_getrf_launch<T>(                              \
+        hipStream_t, const int*, T* const*, const int*, int64_t*, int*, int*, int);      \
+    template hipError_t hipsolver_vbatched_getrs_launch<T>(hipStream_t,                  \
+                                                           hipsolverOperation_t,         \
+                                                           const int*,                   \
+                                                           const int*,                   \
+                                                           T* const*,                    \
+                                                           const int*,                   \
+                                                           int64_t*,                     \
+                                                           const int*,                   \
+                                                           T* const*,                    \
+                                                           const int*,                   \
+                                                           int*,                         \
+                                                           int)
+
+HIPSOLVER_VBATCHED_INSTANTIATE(float);
+HIPSOLVER_VBATCHED_INSTANTIATE(double);
+HIPSOLVER_VBATCHED_INSTANTIATE(hipsolverComplex);
+HIPSOLVER_VBATCHED_INSTANTIATE(hipsolverDoubleComplex);
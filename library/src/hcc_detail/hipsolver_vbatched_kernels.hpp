@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+/*
+ * ===========================================================================
+ *    Variable-size batched kernels. potrf, getrf and getrs of a batch whose
+ *    problems each have their own sizes, given in device arrays, solved by a
+ *    single kernel with one block per problem. Each block reads the sizes of
+ *    its problem, sets its info to minus the position of the first invalid
+ *    size in the arguments of the function (as for the argument checks of
+ *    LAPACK), and otherwise solves it with the block solvers of
+ *    hipsolver_block.hpp. A matrix of order up to hipsolver_vbatched_tile is
+ *    loaded to shared memory; a larger one is solved in place, in global
+ *    memory.
+ *
+ *    The pivots of the problems are stored one after the other, n[b] for
+ *    problem b. Their offsets, the prefix sums of n, are computed on the
+ *    device by a first kernel, to the workspace offset of batch_count entries.
+ *    The sizes are never read back to the host.
+ *
+ *    The kernels are the HIP source hipsolver_vbatched_kernels.cpp; this
+ *    header only declares their launchers, for float, double,
+ *    hipsolverComplex and hipsolverDoubleComplex. A library built without a
+ *    HIP compiler has no kernels: hipsolver_vbatched_kernels is then false,
+ *    and the launchers return hipErrorNotSupported.
+ * ===========================================================================
+ */
+
+// the variable-size batched kernels are built
+#ifdef HIPSOLVER_DEVICE_KERNELS
+constexpr bool hipsolver_vbatched_kernels = true;
+#else
+constexpr bool hipsolver_vbatched_kernels = false;
+#endif
+
+// largest order of the matrices loaded to shared memory
+constexpr int hipsolver_vbatched_tile = 32;
+
+/*! \brief Cholesky factorizations of the batch_count matrices A[b] of orders n[b]. */
+template <typename T>
+hipError_t hipsolver_vbatched_potrf_launch(hipStream_t         stream,
+                                           hipsolverFillMode_t uplo,
+                                           const int*          n,
+                                           T* const*           A,
+                                           const int*          lda,
+                                           int*                info,
+                                           int                 batch_count);
+
+/*! \brief LU factorizations of the batch_count matrices A[b] of orders n[b], without pivoting if
+ *  ipiv is null. offset is the workspace of the offsets of the pivots. */
+template <typename T>
+hipError_t hipsolver_vbatched_getrf_launch(hipStream_t stream,
+                                           const int*  n,
+                                           T* const*   A,
+                                           const int*  lda,
+                                           int64_t*    offset,
+                                           int*        ipiv,
+                                           int*        info,
+                                           int         batch_count);
+
+/*! \brief Solves op(A[b]) * X = B[b] with the factors computed by
+ *  hipsolver_vbatched_getrf_launch. */
+template <typename T>
+hipError_t hipsolver_vbatched_getrs_launch(hipStream_t          stream,
+                                           hipsolverOperation_t trans,
+                                           const int*           n,
+                                           const int*           nrhs,
+                                           T* const*            A,
+                                           const int*           lda,
+                                           int64_t*             offset,
+                                           const int*           ipiv,
+                                           T* const*            B,
+                                           const int*           ldb,
+                                           int*                 info,
+                                           int                  batch_count);
@@ -36,6 +36,11 @@ module hipsolver_enums
         enumerator :: HIPSOLVER_EIG_TYPE_3 = 213
     end enum
 
+    enum, bind(c)
+        enumerator :: HIPSOLVER_WORKSPACE_CACHE_OFF = 0
+        enumerator :: HIPSOLVER_WORKSPACE_CACHE_ON  = 1
+    end enum
+
     enum, bind(c)
         enumerator :: HIPSOLVER_STATUS_SUCCESS           = 0
         enumerator :: HIPSOLVER_STATUS_NOT_INITIALIZED   = 1
@@ -49,6 +54,8 @@ module hipsolver_enums
         enumerator :: HIPSOLVER_STATUS_HANDLE_IS_NULLPTR = 9
         enumerator :: HIPSOLVER_STATUS_INVALID_ENUM      = 10
         enumerator :: HIPSOLVER_STATUS_UNKNOWN           = 11
+        enumerator :: HIPSOLVER_STATUS_CAPTURE_UNSAFE    = 12
+        enumerator :: HIPSOLVER_STATUS_ZERO_PIVOT        = 13
     end enum
 
 end module hipsolver_enums
@@ -102,6 +109,193 @@ module hipsolver
         end function hipsolverGetStream
     end interface
 
+    interface
+        function hipsolverSetWorkspaceCacheMode(handle, mode) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSetWorkspaceCacheMode')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_WORKSPACE_CACHE_ON)), value :: mode
+        end function hipsolverSetWorkspaceCacheMode
+    end interface
+
+    interface
+        function hipsolverGetWorkspaceCacheMode(handle, mode) &
+                result(c_int) &
+                bind(c, name = 'hipsolverGetWorkspaceCacheMode')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: mode
+        end function hipsolverGetWorkspaceCacheMode
+    end interface
+
+    interface
+        function hipsolverClearWorkspaceCache(handle) &
+                result(c_int) &
+                bind(c, name = 'hipsolverClearWorkspaceCache')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+        end function hipsolverClearWorkspaceCache
+    end interface
+
+    interface
+        function hipsolverReserveWorkspace(handle, bytes) &
+                result(c_int) &
+                bind(c, name = 'hipsolverReserveWorkspace')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: bytes
+        end function hipsolverReserveWorkspace
+    end interface
+
+    interface
+        function hipsolverCreateGesvdjInfo(info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCreateGesvdjInfo')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+        end function hipsolverCreateGesvdjInfo
+    end interface
+
+    interface
+        function hipsolverDestroyGesvdjInfo(info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDestroyGesvdjInfo')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+        end function hipsolverDestroyGesvdjInfo
+    end interface
+
+    interface
+        function hipsolverXgesvdjSetTolerance(info, tolerance) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXgesvdjSetTolerance')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+            real(c_double), value :: tolerance
+        end function hipsolverXgesvdjSetTolerance
+    end interface
+
+    interface
+        function hipsolverXgesvdjSetMaxSweeps(info, max_sweeps) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXgesvdjSetMaxSweeps')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+            integer(c_int), value :: max_sweeps
+        end function hipsolverXgesvdjSetMaxSweeps
+    end interface
+
+    interface
+        function hipsolverXgesvdjGetResidual(handle, info, residual) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXgesvdjGetResidual')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: residual
+        end function hipsolverXgesvdjGetResidual
+    end interface
+
+    interface
+        function hipsolverXgesvdjGetSweeps(handle, info, executed_sweeps) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXgesvdjGetSweeps')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: executed_sweeps
+        end function hipsolverXgesvdjGetSweeps
+    end interface
+
+    interface
+        function hipsolverCreateSyevjInfo(info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCreateSyevjInfo')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+        end function hipsolverCreateSyevjInfo
+    end interface
+
+    interface
+        function hipsolverDestroySyevjInfo(info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDestroySyevjInfo')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+        end function hipsolverDestroySyevjInfo
+    end interface
+
+    interface
+        function hipsolverXsyevjSetTolerance(info, tolerance) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXsyevjSetTolerance')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+            real(c_double), value :: tolerance
+        end function hipsolverXsyevjSetTolerance
+    end interface
+
+    interface
+        function hipsolverXsyevjSetMaxSweeps(info, max_sweeps) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXsyevjSetMaxSweeps')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+            integer(c_int), value :: max_sweeps
+        end function hipsolverXsyevjSetMaxSweeps
+    end interface
+
+    interface
+        function hipsolverXsyevjSetSortEig(info, sort_eig) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXsyevjSetSortEig')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: info
+            integer(c_int), value :: sort_eig
+        end function hipsolverXsyevjSetSortEig
+    end interface
+
+    interface
+        function hipsolverXsyevjGetResidual(handle, info, residual) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXsyevjGetResidual')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: residual
+        end function hipsolverXsyevjGetResidual
+    end interface
+
+    interface
+        function hipsolverXsyevjGetSweeps(handle, info, executed_sweeps) &
+                result(c_int) &
+                bind(c, name = 'hipsolverXsyevjGetSweeps')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: executed_sweeps
+        end function hipsolverXsyevjGetSweeps
+    end interface
+
     !------------!
     !   LAPACK   !
     !------------!
@@ -267,893 +461,977 @@ module hipsolver
         end function hipsolverZungbr
     end interface
     
-    ! ******************** ORGQR/UNGQR ********************
+    ! ******************** ORGBR/UNGBR_BATCHED ********************
     interface
-        function hipsolverSorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
+        function hipsolverSorgbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSorgqr_bufferSize')
+                bind(c, name = 'hipsolverSorgbrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSorgqr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgbrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
+        function hipsolverDorgbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDorgqr_bufferSize')
+                bind(c, name = 'hipsolverDorgbrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverDorgqr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgbrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
+        function hipsolverCungbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCungqr_bufferSize')
+                bind(c, name = 'hipsolverCungbrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverCungqr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCungbrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
+        function hipsolverZungbrBatched_bufferSize(handle, side, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZungqr_bufferSize')
+                bind(c, name = 'hipsolverZungbrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverZungqr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZungbrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverSorgqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
+        function hipsolverSorgbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSorgqr')
+                bind(c, name = 'hipsolverSorgbrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSorgqr
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgbrBatched
     end interface
     
     interface
-        function hipsolverDorgqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
+        function hipsolverDorgbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDorgqr')
+                bind(c, name = 'hipsolverDorgbrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDorgqr
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgbrBatched
     end interface
     
     interface
-        function hipsolverCungqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
+        function hipsolverCungbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCungqr')
+                bind(c, name = 'hipsolverCungbrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCungqr
+            integer(c_int), value :: batch_count
+        end function hipsolverCungbrBatched
     end interface
     
     interface
-        function hipsolverZungqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
+        function hipsolverZungbrBatched(handle, side, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZungqr')
+                bind(c, name = 'hipsolverZungbrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZungqr
+            integer(c_int), value :: batch_count
+        end function hipsolverZungbrBatched
     end interface
-    
-    ! ******************** ORGTR/UNGTR ********************
+
+    ! ******************** ORGBR/UNGBR_STRIDED_BATCHED ********************
     interface
-        function hipsolverSorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
+        function hipsolverSorgbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSorgtr_bufferSize')
+                bind(c, name = 'hipsolverSorgbrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSorgtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgbrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
+        function hipsolverDorgbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDorgtr_bufferSize')
+                bind(c, name = 'hipsolverDorgbrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverDorgtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgbrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
+        function hipsolverCungbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCungtr_bufferSize')
+                bind(c, name = 'hipsolverCungbrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverCungtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCungbrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
+        function hipsolverZungbrStridedBatched_bufferSize(handle, side, m, n, k, A, lda, strideA, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZungtr_bufferSize')
+                bind(c, name = 'hipsolverZungbrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverZungtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZungbrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverSorgtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
+        function hipsolverSorgbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSorgtr')
+                bind(c, name = 'hipsolverSorgbrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSorgtr
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgbrStridedBatched
     end interface
     
     interface
-        function hipsolverDorgtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
+        function hipsolverDorgbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDorgtr')
+                bind(c, name = 'hipsolverDorgbrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDorgtr
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgbrStridedBatched
     end interface
     
     interface
-        function hipsolverCungtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
+        function hipsolverCungbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCungtr')
+                bind(c, name = 'hipsolverCungbrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCungtr
+            integer(c_int), value :: batch_count
+        end function hipsolverCungbrStridedBatched
     end interface
     
     interface
-        function hipsolverZungtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
+        function hipsolverZungbrStridedBatched(handle, side, m, n, k, A, lda, strideA, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZungtr')
+                bind(c, name = 'hipsolverZungbrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZungtr
+            integer(c_int), value :: batch_count
+        end function hipsolverZungbrStridedBatched
     end interface
-    
-    ! ******************** ORMQR/UNMQR ********************
+
+    ! ******************** ORGQR/UNGQR ********************
     interface
-        function hipsolverSormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+        function hipsolverSorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSormqr_bufferSize')
+                bind(c, name = 'hipsolverSorgqr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: lwork
-        end function hipsolverSormqr_bufferSize
+        end function hipsolverSorgqr_bufferSize
     end interface
     
     interface
-        function hipsolverDormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+        function hipsolverDorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDormqr_bufferSize')
+                bind(c, name = 'hipsolverDorgqr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: lwork
-        end function hipsolverDormqr_bufferSize
+        end function hipsolverDorgqr_bufferSize
     end interface
     
     interface
-        function hipsolverCunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+        function hipsolverCungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCunmqr_bufferSize')
+                bind(c, name = 'hipsolverCungqr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: lwork
-        end function hipsolverCunmqr_bufferSize
+        end function hipsolverCungqr_bufferSize
     end interface
     
     interface
-        function hipsolverZunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+        function hipsolverZungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZunmqr_bufferSize')
+                bind(c, name = 'hipsolverZungqr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: lwork
-        end function hipsolverZunmqr_bufferSize
+        end function hipsolverZungqr_bufferSize
     end interface
     
     interface
-        function hipsolverSormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverSorgqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSormqr')
+                bind(c, name = 'hipsolverSorgqr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSormqr
+        end function hipsolverSorgqr
     end interface
     
     interface
-        function hipsolverDormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverDorgqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDormqr')
+                bind(c, name = 'hipsolverDorgqr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDormqr
+        end function hipsolverDorgqr
     end interface
     
     interface
-        function hipsolverCunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverCungqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCunmqr')
+                bind(c, name = 'hipsolverCungqr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCunmqr
+        end function hipsolverCungqr
     end interface
     
     interface
-        function hipsolverZunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverZungqr(handle, m, n, k, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZunmqr')
+                bind(c, name = 'hipsolverZungqr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZunmqr
+        end function hipsolverZungqr
     end interface
     
-    ! ******************** ORMTR/UNMTR ********************
+    ! ******************** ORGQR/UNGQR_BATCHED ********************
     interface
-        function hipsolverSormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+        function hipsolverSorgqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSormtr_bufferSize')
+                bind(c, name = 'hipsolverSorgqrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSormtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgqrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+        function hipsolverDorgqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDormtr_bufferSize')
+                bind(c, name = 'hipsolverDorgqrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverDormtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgqrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+        function hipsolverCungqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCunmtr_bufferSize')
+                bind(c, name = 'hipsolverCungqrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverCunmtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCungqrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+        function hipsolverZungqrBatched_bufferSize(handle, m, n, k, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZunmtr_bufferSize')
+                bind(c, name = 'hipsolverZungqrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverZunmtr_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZungqrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverSormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverSorgqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSormtr')
+                bind(c, name = 'hipsolverSorgqrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSormtr
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgqrBatched
     end interface
     
     interface
-        function hipsolverDormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverDorgqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDormtr')
+                bind(c, name = 'hipsolverDorgqrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDormtr
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgqrBatched
     end interface
     
     interface
-        function hipsolverCunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverCungqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCunmtr')
+                bind(c, name = 'hipsolverCungqrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCunmtr
+            integer(c_int), value :: batch_count
+        end function hipsolverCungqrBatched
     end interface
     
     interface
-        function hipsolverZunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+        function hipsolverZungqrBatched(handle, m, n, k, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZunmtr')
+                bind(c, name = 'hipsolverZungqrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
-            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: tau
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZunmtr
+            integer(c_int), value :: batch_count
+        end function hipsolverZungqrBatched
     end interface
-    
-    ! ******************** GEBRD ********************
+
+    ! ******************** ORGQR/UNGQR_STRIDED_BATCHED ********************
     interface
-        function hipsolverSgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverSorgqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgebrd_bufferSize')
+                bind(c, name = 'hipsolverSorgqrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSgebrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgqrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverDorgqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgebrd_bufferSize')
+                bind(c, name = 'hipsolverDorgqrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverDgebrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgqrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverCungqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgebrd_bufferSize')
+                bind(c, name = 'hipsolverCungqrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverCgebrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCungqrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZgebrd_bufferSize(handle, m, n, lwork) &
+        function hipsolverZungqrStridedBatched_bufferSize(handle, m, n, k, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgebrd_bufferSize')
+                bind(c, name = 'hipsolverZungqrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverZgebrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZungqrStridedBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverSorgqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgebrd')
+                bind(c, name = 'hipsolverSorgqrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSgebrd
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgqrStridedBatched
     end interface
-
+    
     interface
-        function hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverDorgqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgebrd')
+                bind(c, name = 'hipsolverDorgqrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgebrd
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgqrStridedBatched
     end interface
-
+    
     interface
-        function hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverCungqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgebrd')
+                bind(c, name = 'hipsolverCungqrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCgebrd
+            integer(c_int), value :: batch_count
+        end function hipsolverCungqrStridedBatched
     end interface
-
+    
     interface
-        function hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+        function hipsolverZungqrStridedBatched(handle, m, n, k, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgebrd')
+                bind(c, name = 'hipsolverZungqrStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: D
-            type(c_ptr), value :: E
-            type(c_ptr), value :: tauq
-            type(c_ptr), value :: taup
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZgebrd
+            integer(c_int), value :: batch_count
+        end function hipsolverZungqrStridedBatched
     end interface
-    
-    ! ******************** GEQRF ********************
+
+    ! ******************** ORGTR/UNGTR ********************
     interface
-        function hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverSorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgeqrf_bufferSize')
+                bind(c, name = 'hipsolverSorgtr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverSgeqrf_bufferSize
+        end function hipsolverSorgtr_bufferSize
     end interface
-
+    
     interface
-        function hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverDorgtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgeqrf_bufferSize')
+                bind(c, name = 'hipsolverDorgtr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverDgeqrf_bufferSize
+        end function hipsolverDorgtr_bufferSize
     end interface
-
+    
     interface
-        function hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverCungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgeqrf_bufferSize')
+                bind(c, name = 'hipsolverCungtr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverCgeqrf_bufferSize
+        end function hipsolverCungtr_bufferSize
     end interface
-
+    
     interface
-        function hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverZungtr_bufferSize(handle, uplo, n, A, lda, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgeqrf_bufferSize')
+                bind(c, name = 'hipsolverZungtr_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverZgeqrf_bufferSize
+        end function hipsolverZungtr_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverSorgtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgeqrf')
+                bind(c, name = 'hipsolverSorgtr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -1161,18 +1439,18 @@ module hipsolver
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSgeqrf
+        end function hipsolverSorgtr
     end interface
-
+    
     interface
-        function hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverDorgtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgeqrf')
+                bind(c, name = 'hipsolverDorgtr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -1180,18 +1458,18 @@ module hipsolver
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgeqrf
+        end function hipsolverDorgtr
     end interface
-
+    
     interface
-        function hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverCungtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgeqrf')
+                bind(c, name = 'hipsolverCungtr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -1199,18 +1477,18 @@ module hipsolver
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCgeqrf
+        end function hipsolverCungtr
     end interface
-
+    
     interface
-        function hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+        function hipsolverZungtr(handle, uplo, n, A, lda, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgeqrf')
+                bind(c, name = 'hipsolverZungtr')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
@@ -1218,1105 +1496,6447 @@ module hipsolver
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZgeqrf
+        end function hipsolverZungtr
     end interface
     
-    ! ******************** GESVD ********************
+    ! ******************** ORGTR/UNGTR_BATCHED ********************
     interface
-        function hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverSorgtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgesvd_bufferSize')
+                bind(c, name = 'hipsolverSorgtrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSgesvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgtrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverDorgtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgesvd_bufferSize')
+                bind(c, name = 'hipsolverDorgtrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverDgesvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgtrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverCungtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgesvd_bufferSize')
+                bind(c, name = 'hipsolverCungtrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverCgesvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverCungtrBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+        function hipsolverZungtrBatched_bufferSize(handle, uplo, n, A, lda, tau, strideP, lwork, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgesvd_bufferSize')
+                bind(c, name = 'hipsolverZungtrBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverZgesvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZungtrBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverSorgtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgesvd')
+                bind(c, name = 'hipsolverSorgtrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverSgesvd
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgtrBatched
     end interface
-
+    
     interface
-        function hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverDorgtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgesvd')
+                bind(c, name = 'hipsolverDorgtrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverDgesvd
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgtrBatched
     end interface
-
+    
     interface
-        function hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverCungtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgesvd')
+                bind(c, name = 'hipsolverCungtrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverCgesvd
+            integer(c_int), value :: batch_count
+        end function hipsolverCungtrBatched
     end interface
-
+    
     interface
-        function hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+        function hipsolverZungtrBatched(handle, uplo, n, A, lda, tau, strideP, work, lwork, info, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgesvd')
+                bind(c, name = 'hipsolverZungtrBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_signed_char), value :: jobu
-            integer(c_signed_char), value :: jobv
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: S
-            type(c_ptr), value :: U
-            integer(c_int), value :: ldu
-            type(c_ptr), value :: V
-            integer(c_int), value :: ldv
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: rwork
             type(c_ptr), value :: info
-        end function hipsolverZgesvd
+            integer(c_int), value :: batch_count
+        end function hipsolverZungtrBatched
     end interface
 
-    ! ******************** GETRF ********************
+    ! ******************** ORGTR/UNGTR_STRIDED_BATCHED ********************
     interface
-        function hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverSorgtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrf_bufferSize')
+                bind(c, name = 'hipsolverSorgtrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSgetrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgtrStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverDorgtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrf_bufferSize')
+                bind(c, name = 'hipsolverDorgtrStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgtrStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCungtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCungtrStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCungtrStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZungtrStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, tau, strideP, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZungtrStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZungtrStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSorgtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSorgtrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSorgtrStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDorgtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDorgtrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDorgtrStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCungtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCungtrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCungtrStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZungtrStridedBatched(handle, uplo, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZungtrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZungtrStridedBatched
+    end interface
+
+    ! ******************** ORMQR/UNMQR ********************
+    interface
+        function hipsolverSormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverSormqr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDormqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverDormqr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverCunmqr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZunmqr_bufferSize(handle, side, trans, m, n, k, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmqr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverZunmqr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSormqr
+    end interface
+    
+    interface
+        function hipsolverDormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDormqr
+    end interface
+    
+    interface
+        function hipsolverCunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCunmqr
+    end interface
+    
+    interface
+        function hipsolverZunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmqr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZunmqr
+    end interface
+    
+    ! ******************** ORMQR/UNMQR_BATCHED ********************
+    interface
+        function hipsolverSormqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+                ldc, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormqrBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSormqrBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDormqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+                ldc, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormqrBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDormqrBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCunmqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+                ldc, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmqrBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCunmqrBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZunmqrBatched_bufferSize(handle, side, trans, m, n, k, A, lda, tau, strideP, C, &
+                ldc, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmqrBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZunmqrBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSormqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormqrBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSormqrBatched
+    end interface
+    
+    interface
+        function hipsolverDormqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormqrBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDormqrBatched
+    end interface
+    
+    interface
+        function hipsolverCunmqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmqrBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCunmqrBatched
+    end interface
+    
+    interface
+        function hipsolverZunmqrBatched(handle, side, trans, m, n, k, A, lda, tau, strideP, C, ldc, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmqrBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZunmqrBatched
+    end interface
+
+    ! ******************** ORMQR/UNMQR_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSormqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, &
+                tau, strideP, C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormqrStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSormqrStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDormqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, &
+                tau, strideP, C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormqrStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDormqrStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCunmqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, &
+                tau, strideP, C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmqrStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCunmqrStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZunmqrStridedBatched_bufferSize(handle, side, trans, m, n, k, A, lda, strideA, &
+                tau, strideP, C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmqrStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZunmqrStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, &
+                C, ldc, strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormqrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSormqrStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDormqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, &
+                C, ldc, strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormqrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDormqrStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, &
+                C, ldc, strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmqrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCunmqrStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZunmqrStridedBatched(handle, side, trans, m, n, k, A, lda, strideA, tau, strideP, &
+                C, ldc, strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmqrStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZunmqrStridedBatched
+    end interface
+
+    ! ******************** ORMTR/UNMTR ********************
+    interface
+        function hipsolverSormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormtr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverSormtr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDormtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormtr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverDormtr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmtr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverCunmtr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZunmtr_bufferSize(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmtr_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+        end function hipsolverZunmtr_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSormtr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSormtr
+    end interface
+    
+    interface
+        function hipsolverDormtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDormtr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDormtr
+    end interface
+    
+    interface
+        function hipsolverCunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCunmtr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCunmtr
+    end interface
+    
+    interface
+        function hipsolverZunmtr(handle, side, uplo, trans, m, n, A, lda, tau, C, ldc, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZunmtr')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_SIDE_LEFT)), value :: side
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZunmtr
+    end interface
+    
+    ! ******************** GEBRD ********************
+    interface
+        function hipsolverSgebrd_bufferSize(handle, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgebrd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverSgebrd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgebrd_bufferSize(handle, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgebrd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverDgebrd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgebrd_bufferSize(handle, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgebrd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverCgebrd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgebrd_bufferSize(handle, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgebrd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverZgebrd_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgebrd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgebrd
+    end interface
+
+    interface
+        function hipsolverDgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgebrd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgebrd
+    end interface
+
+    interface
+        function hipsolverCgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgebrd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgebrd
+    end interface
+
+    interface
+        function hipsolverZgebrd(handle, m, n, A, lda, D, E, tauq, taup, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgebrd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tauq
+            type(c_ptr), value :: taup
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgebrd
+    end interface
+    
+    ! ******************** GEBRD_BATCHED ********************
+    interface
+        function hipsolverSgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgebrdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgebrdBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgebrdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgebrdBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgebrdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgebrdBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgebrdBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgebrdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgebrdBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgebrdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgebrdBatched
+    end interface
+    
+    interface
+        function hipsolverDgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgebrdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgebrdBatched
+    end interface
+    
+    interface
+        function hipsolverCgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgebrdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgebrdBatched
+    end interface
+    
+    interface
+        function hipsolverZgebrdBatched(handle, m, n, A, lda, D, strideD, E, strideE, tauq, strideQ, taup, &
+                strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgebrdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgebrdBatched
+    end interface
+
+    ! ******************** GEBRD_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgebrdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgebrdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgebrdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgebrdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgebrdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgebrdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgebrdStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgebrdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgebrdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgebrdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgebrdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgebrdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgebrdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgebrdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgebrdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgebrdStridedBatched(handle, m, n, A, lda, strideA, D, strideD, E, strideE, tauq, &
+                strideQ, taup, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgebrdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tauq
+            integer(c_int), value :: strideQ
+            type(c_ptr), value :: taup
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgebrdStridedBatched
+    end interface
+
+    ! ******************** GEQRF ********************
+    interface
+        function hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSgeqrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDgeqrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCgeqrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZgeqrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgeqrf
+    end interface
+
+    interface
+        function hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgeqrf
+    end interface
+
+    interface
+        function hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgeqrf
+    end interface
+
+    interface
+        function hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgeqrf
+    end interface
+    
+    ! ******************** GEQRF_BATCHED ********************
+    interface
+        function hipsolverSgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgeqrfBatched_bufferSize(handle, m, n, A, lda, strideP, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfBatched
+    end interface
+    
+    interface
+        function hipsolverDgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfBatched
+    end interface
+    
+    interface
+        function hipsolverCgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfBatched
+    end interface
+    
+    interface
+        function hipsolverZgeqrfBatched(handle, m, n, A, lda, tau, strideP, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfBatched
+    end interface
+
+    ! ******************** GEQRF_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgeqrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, strideP, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverSgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgeqrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgeqrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgeqrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgeqrfStridedBatched(handle, m, n, A, lda, strideA, tau, strideP, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgeqrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgeqrfStridedBatched
+    end interface
+
+    ! ******************** GELS_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgelsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgelsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgelsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgelsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgelsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgelsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgelsStridedBatched_bufferSize(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgelsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgelsStridedBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgelsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgelsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgelsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgelsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgelsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgelsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgelsStridedBatched(handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgelsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgelsStridedBatched
+    end interface
+
+    ! ******************** GESVD ********************
+    interface
+        function hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverSgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverDgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverCgesvd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+        end function hipsolverZgesvd_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverSgesvd
+    end interface
+
+    interface
+        function hipsolverDgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverDgesvd
+    end interface
+
+    interface
+        function hipsolverCgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverCgesvd
+    end interface
+
+    interface
+        function hipsolverZgesvd(handle, jobu, jobv, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, rwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            type(c_ptr), value :: info
+        end function hipsolverZgesvd
+    end interface
+
+    ! ******************** GESVD_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgesvdStridedBatched_bufferSize(handle, jobu, jobv, m, n, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdStridedBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgesvdStridedBatched(handle, jobu, jobv, m, n, A, lda, strideA, S, strideS, U, ldu, &
+                strideU, V, ldv, strideV, work, lwork, rwork, strideRwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_signed_char), value :: jobu
+            integer(c_signed_char), value :: jobv
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: S
+            integer(c_int), value :: strideS
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            integer(c_int), value :: strideU
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            integer(c_int), value :: strideV
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: rwork
+            integer(c_int), value :: strideRwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdStridedBatched
+    end interface
+
+    ! ******************** GESVDJ_BATCHED ********************
+    interface
+        function hipsolverSgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvdjBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdjBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvdjBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdjBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvdjBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdjBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgesvdjBatched_bufferSize(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, lwork, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvdjBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdjBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgesvdjBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverSgesvdjBatched
+    end interface
+    
+    interface
+        function hipsolverDgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgesvdjBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverDgesvdjBatched
+    end interface
+    
+    interface
+        function hipsolverCgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgesvdjBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverCgesvdjBatched
+    end interface
+    
+    interface
+        function hipsolverZgesvdjBatched(handle, jobz, m, n, A, lda, S, U, ldu, V, ldv, work, lwork, info, &
+                params, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgesvdjBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: S
+            type(c_ptr), value :: U
+            integer(c_int), value :: ldu
+            type(c_ptr), value :: V
+            integer(c_int), value :: ldv
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverZgesvdjBatched
+    end interface
+
+    ! ******************** GETRF ********************
+    interface
+        function hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCgetrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZgetrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverSgetrf
+    end interface
+    
+    interface
+        function hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverDgetrf
+    end interface
+    
+    interface
+        function hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverCgetrf
+    end interface
+    
+    interface
+        function hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipsolverZgetrf
+    end interface
+
+    ! ******************** GETRF_BATCHED ********************
+    interface
+        function hipsolverSgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrfBatched_bufferSize(handle, m, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfBatched
+    end interface
+    
+    interface
+        function hipsolverDgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfBatched
+    end interface
+    
+    interface
+        function hipsolverCgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfBatched
+    end interface
+    
+    interface
+        function hipsolverZgetrfBatched(handle, m, n, A, lda, work, lwork, ipiv, strideP, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfBatched
+    end interface
+
+    ! ******************** GETRF_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrfStridedBatched_bufferSize(handle, m, n, A, lda, strideA, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfStridedBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrfStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgetrfStridedBatched(handle, m, n, A, lda, strideA, work, lwork, ipiv, strideP, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrfStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrfStridedBatched
+    end interface
+
+    ! ******************** GETRI_OUTOFPLACE_BATCHED ********************
+    interface
+        function hipsolverSgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetriOutOfPlaceBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetriOutOfPlaceBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetriOutOfPlaceBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetriOutOfPlaceBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetriOutOfPlaceBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetriOutOfPlaceBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetriOutOfPlaceBatched_bufferSize(handle, n, A, lda, ipiv, strideP, C, ldc, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetriOutOfPlaceBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetriOutOfPlaceBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetriOutOfPlaceBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetriOutOfPlaceBatched
+    end interface
+    
+    interface
+        function hipsolverDgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetriOutOfPlaceBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetriOutOfPlaceBatched
+    end interface
+    
+    interface
+        function hipsolverCgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetriOutOfPlaceBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetriOutOfPlaceBatched
+    end interface
+    
+    interface
+        function hipsolverZgetriOutOfPlaceBatched(handle, n, A, lda, ipiv, strideP, C, ldc, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetriOutOfPlaceBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetriOutOfPlaceBatched
+    end interface
+
+    ! ******************** GETRI_OUTOFPLACE_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, &
+                C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetriOutOfPlaceStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetriOutOfPlaceStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, &
+                C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetriOutOfPlaceStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetriOutOfPlaceStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, &
+                C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetriOutOfPlaceStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetriOutOfPlaceStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetriOutOfPlaceStridedBatched_bufferSize(handle, n, A, lda, strideA, ipiv, strideP, &
+                C, ldc, strideC, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetriOutOfPlaceStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetriOutOfPlaceStridedBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetriOutOfPlaceStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetriOutOfPlaceStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetriOutOfPlaceStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetriOutOfPlaceStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetriOutOfPlaceStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetriOutOfPlaceStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgetriOutOfPlaceStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, C, ldc, &
+                strideC, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetriOutOfPlaceStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: strideC
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetriOutOfPlaceStridedBatched
+    end interface
+
+    ! ******************** GETRS ********************
+    interface
+        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverSgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverDgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverCgetrs_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrs_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+        end function hipsolverZgetrs_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSgetrs
+    end interface
+    
+    interface
+        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDgetrs
+    end interface
+    
+    interface
+        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCgetrs
+    end interface
+    
+    interface
+        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrs')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZgetrs
+    end interface
+
+    ! ******************** GETRS_BATCHED ********************
+    interface
+        function hipsolverSgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrsBatched_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsBatched
+    end interface
+    
+    interface
+        function hipsolverDgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsBatched
+    end interface
+    
+    interface
+        function hipsolverCgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsBatched
+    end interface
+    
+    interface
+        function hipsolverZgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, work, lwork, &
+                info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsBatched
+    end interface
+
+    ! ******************** GETRS_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZgetrsStridedBatched_bufferSize(handle, trans, n, nrhs, A, lda, strideA, ipiv, &
+                strideP, B, ldb, strideB, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsStridedBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSgetrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDgetrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCgetrsStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZgetrsStridedBatched(handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, &
+                strideB, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZgetrsStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZgetrsStridedBatched
+    end interface
+
+    ! ******************** POTRF ********************
+    interface
+        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverSpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverDpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverCpotrf_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrf_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+        end function hipsolverZpotrf_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSpotrf
+    end interface
+
+    interface
+        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDpotrf
+    end interface
+
+    interface
+        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCpotrf
+    end interface
+
+    interface
+        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrf')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZpotrf
+    end interface
+    
+    ! ******************** POTRF_BATCHED ********************
+    interface
+        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrfBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrfBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrfBatched
+    end interface
+
+    ! ******************** POTRS_BATCHED ********************
+    interface
+        function hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrsBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSpotrsBatched
+    end interface
+    
+    interface
+        function hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDpotrsBatched
+    end interface
+    
+    interface
+        function hipsolverCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCpotrsBatched
+    end interface
+    
+    interface
+        function hipsolverZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZpotrsBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZpotrsBatched
+    end interface
+
+    ! ******************** SYEVD/HEEVD ********************
+    interface
+        function hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverSsyevd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverDsyevd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverCheevd_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevd_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: lwork
+        end function hipsolverZheevd_bufferSize
+    end interface
+
+    interface
+        function hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverSsyevd
+    end interface
+
+    interface
+        function hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverDsyevd
+    end interface
+
+    interface
+        function hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverCheevd
+    end interface
+
+    interface
+        function hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevd')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+        end function hipsolverZheevd
+    end interface
+
+    ! ******************** SYEVD/HEEVD_BATCHED ********************
+    interface
+        function hipsolverSsyevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevdBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDsyevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevdBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCheevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevdBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZheevdBatched_bufferSize(handle, jobz, uplo, n, A, lda, D, strideD, lwork, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevdBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevdBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSsyevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevdBatched
+    end interface
+    
+    interface
+        function hipsolverDsyevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevdBatched
+    end interface
+    
+    interface
+        function hipsolverCheevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevdBatched
+    end interface
+    
+    interface
+        function hipsolverZheevdBatched(handle, jobz, uplo, n, A, lda, D, strideD, work, lwork, info, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevdBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevdBatched
+    end interface
+
+    ! ******************** SYEVD/HEEVD_STRIDED_BATCHED ********************
+    interface
+        function hipsolverSsyevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDsyevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverCheevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevdStridedBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverZheevdStridedBatched_bufferSize(handle, jobz, uplo, n, A, lda, strideA, D, strideD, &
+                lwork, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevdStridedBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: lwork
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevdStridedBatched_bufferSize
+    end interface
+
+    interface
+        function hipsolverSsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverDsyevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverCheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverCheevdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevdStridedBatched
+    end interface
+    
+    interface
+        function hipsolverZheevdStridedBatched(handle, jobz, uplo, n, A, lda, strideA, D, strideD, work, &
+                lwork, info, batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverZheevdStridedBatched')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: work
+            integer(c_int), value :: lwork
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevdStridedBatched
+    end interface
+
+    ! ******************** SYEVJ/HEEVJ_BATCHED ********************
+    interface
+        function hipsolverSsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverSsyevjBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: W
+            type(c_ptr), value :: lwork
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevjBatched_bufferSize
+    end interface
+    
+    interface
+        function hipsolverDsyevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+                batch_count) &
+                result(c_int) &
+                bind(c, name = 'hipsolverDsyevjBatched_bufferSize')
+            use iso_c_binding
+            use hipsolver_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverDgetrf_bufferSize
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevjBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverCheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrf_bufferSize')
+                bind(c, name = 'hipsolverCheevjBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverCgetrf_bufferSize
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevjBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork) &
+        function hipsolverZheevjBatched_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrf_bufferSize')
+                bind(c, name = 'hipsolverZheevjBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: lwork
-        end function hipsolverZgetrf_bufferSize
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevjBatched_bufferSize
     end interface
 
     interface
-        function hipsolverSgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverSsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrf')
+                bind(c, name = 'hipsolverSsyevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: info
-        end function hipsolverSgetrf
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverSsyevjBatched
     end interface
     
     interface
-        function hipsolverDgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverDsyevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrf')
+                bind(c, name = 'hipsolverDsyevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: info
-        end function hipsolverDgetrf
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverDsyevjBatched
     end interface
     
     interface
-        function hipsolverCgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverCheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrf')
+                bind(c, name = 'hipsolverCheevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: info
-        end function hipsolverCgetrf
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverCheevjBatched
     end interface
     
     interface
-        function hipsolverZgetrf(handle, m, n, A, lda, work, lwork, ipiv, info) &
+        function hipsolverZheevjBatched(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, &
+                batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrf')
+                bind(c, name = 'hipsolverZheevjBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: W
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: info
-        end function hipsolverZgetrf
+            type(c_ptr), value :: params
+            integer(c_int), value :: batch_count
+        end function hipsolverZheevjBatched
     end interface
 
-    ! ******************** GETRS ********************
+    ! ******************** SYGVD/HEGVD ********************
     interface
-        function hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrs_bufferSize')
+                bind(c, name = 'hipsolverSsygvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverSgetrs_bufferSize
+        end function hipsolverSsygvd_bufferSize
     end interface
     
     interface
-        function hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrs_bufferSize')
+                bind(c, name = 'hipsolverDsygvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverDgetrs_bufferSize
+        end function hipsolverDsygvd_bufferSize
     end interface
     
     interface
-        function hipsolverCgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrs_bufferSize')
+                bind(c, name = 'hipsolverChegvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverCgetrs_bufferSize
+        end function hipsolverChegvd_bufferSize
     end interface
     
     interface
-        function hipsolverZgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork) &
+        function hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrs_bufferSize')
+                bind(c, name = 'hipsolverZhegvd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: lwork
-        end function hipsolverZgetrs_bufferSize
+        end function hipsolverZhegvd_bufferSize
     end interface
 
     interface
-        function hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSgetrs')
+                bind(c, name = 'hipsolverSsygvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSgetrs
+        end function hipsolverSsygvd
     end interface
-    
+
     interface
-        function hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDgetrs')
+                bind(c, name = 'hipsolverDsygvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDgetrs
+        end function hipsolverDsygvd
     end interface
-    
+
     interface
-        function hipsolverCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCgetrs')
+                bind(c, name = 'hipsolverChegvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCgetrs
+        end function hipsolverChegvd
     end interface
-    
+
     interface
-        function hipsolverZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info) &
+        function hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZgetrs')
+                bind(c, name = 'hipsolverZhegvd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_OP_N)), value :: trans
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
+            integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
-            integer(c_int), value :: nrhs
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: ipiv
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: D
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZgetrs
+        end function hipsolverZhegvd
     end interface
 
-    ! ******************** POTRF ********************
+    ! ******************** SYGVD/HEGVD_STRIDED_BATCHED ********************
     interface
-        function hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverSsygvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrf_bufferSize')
+                bind(c, name = 'hipsolverSsygvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
-        end function hipsolverSpotrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSsygvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverDsygvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrf_bufferSize')
+                bind(c, name = 'hipsolverDsygvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
-        end function hipsolverDpotrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDsygvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverChegvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrf_bufferSize')
+                bind(c, name = 'hipsolverChegvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
-        end function hipsolverCpotrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverChegvdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork) &
+        function hipsolverZhegvdStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, strideA, B, &
+                ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrf_bufferSize')
+                bind(c, name = 'hipsolverZhegvdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
-        end function hipsolverZpotrf_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZhegvdStridedBatched_bufferSize
     end interface
 
     interface
-        function hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverSsygvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, &
+                D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrf')
+                bind(c, name = 'hipsolverSsygvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSpotrf
+            integer(c_int), value :: batch_count
+        end function hipsolverSsygvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverDsygvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, &
+                D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrf')
+                bind(c, name = 'hipsolverDsygvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDpotrf
+            integer(c_int), value :: batch_count
+        end function hipsolverDsygvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverChegvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, &
+                D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrf')
+                bind(c, name = 'hipsolverChegvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCpotrf
+            integer(c_int), value :: batch_count
+        end function hipsolverChegvdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, info) &
+        function hipsolverZhegvdStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, strideB, &
+                D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrf')
+                bind(c, name = 'hipsolverZhegvdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZpotrf
+            integer(c_int), value :: batch_count
+        end function hipsolverZhegvdStridedBatched
     end interface
-    
-    ! ******************** POTRF_BATCHED ********************
+
+    ! ******************** SYGVD/HEGVD_FACTORED_STRIDED_BATCHED ********************
     interface
-        function hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverSsygvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverSsygvdFactoredStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched_bufferSize
+        end function hipsolverSsygvdFactoredStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverDsygvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverDsygvdFactoredStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched_bufferSize
+        end function hipsolverDsygvdFactoredStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverChegvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverChegvdFactoredStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched_bufferSize
+        end function hipsolverChegvdFactoredStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count) &
+        function hipsolverZhegvdFactoredStridedBatched_bufferSize(handle, itype, jobz, uplo, n, A, lda, &
+                strideA, B, ldb, strideB, D, strideD, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrfBatched_bufferSize')
+                bind(c, name = 'hipsolverZhegvdFactoredStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: lwork
             integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched_bufferSize
+        end function hipsolverZhegvdFactoredStridedBatched_bufferSize
     end interface
 
     interface
-        function hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverSsygvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSpotrfBatched')
+                bind(c, name = 'hipsolverSsygvdFactoredStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverSpotrfBatched
+        end function hipsolverSsygvdFactoredStridedBatched
     end interface
     
     interface
-        function hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverDsygvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDpotrfBatched')
+                bind(c, name = 'hipsolverDsygvdFactoredStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverDpotrfBatched
+        end function hipsolverDsygvdFactoredStridedBatched
     end interface
     
     interface
-        function hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverChegvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCpotrfBatched')
+                bind(c, name = 'hipsolverChegvdFactoredStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverCpotrfBatched
+        end function hipsolverChegvdFactoredStridedBatched
     end interface
     
     interface
-        function hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, batch_count) &
+        function hipsolverZhegvdFactoredStridedBatched(handle, itype, jobz, uplo, n, A, lda, strideA, B, ldb, &
+                strideB, D, strideD, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZpotrfBatched')
+                bind(c, name = 'hipsolverZhegvdFactoredStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
+            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
+            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: strideB
+            type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
             integer(c_int), value :: batch_count
-        end function hipsolverZpotrfBatched
+        end function hipsolverZhegvdFactoredStridedBatched
     end interface
 
-    ! ******************** SYEVD/HEEVD ********************
+    ! ******************** SYTRD/HETRD ********************
     interface
-        function hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsyevd_bufferSize')
+                bind(c, name = 'hipsolverSsytrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverSsyevd_bufferSize
+        end function hipsolverSsytrd_bufferSize
     end interface
     
     interface
-        function hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsyevd_bufferSize')
+                bind(c, name = 'hipsolverDsytrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverDsyevd_bufferSize
+        end function hipsolverDsytrd_bufferSize
     end interface
     
     interface
-        function hipsolverCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCheevd_bufferSize')
+                bind(c, name = 'hipsolverChetrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverCheevd_bufferSize
+        end function hipsolverChetrd_bufferSize
     end interface
     
     interface
-        function hipsolverZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork) &
+        function hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZheevd_bufferSize')
+                bind(c, name = 'hipsolverZhetrd_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: lwork
-        end function hipsolverZheevd_bufferSize
+        end function hipsolverZhetrd_bufferSize
     end interface
 
     interface
-        function hipsolverSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsyevd')
+                bind(c, name = 'hipsolverSsytrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsyevd
+        end function hipsolverSsytrd
     end interface
 
     interface
-        function hipsolverDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsyevd')
+                bind(c, name = 'hipsolverDsytrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsyevd
+        end function hipsolverDsytrd
     end interface
 
     interface
-        function hipsolverCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverCheevd')
+                bind(c, name = 'hipsolverChetrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverCheevd
+        end function hipsolverChetrd
     end interface
 
     interface
-        function hipsolverZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info) &
+        function hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZheevd')
+                bind(c, name = 'hipsolverZhetrd')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: D
+            type(c_ptr), value :: E
+            type(c_ptr), value :: tau
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZheevd
+        end function hipsolverZhetrd
     end interface
 
-    ! ******************** SYGVD/HEGVD ********************
+    ! ******************** SYTRD/HETRD_BATCHED ********************
     interface
-        function hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverSsytrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsygvd_bufferSize')
+                bind(c, name = 'hipsolverSsytrdBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSsygvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrdBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverDsytrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsygvd_bufferSize')
+                bind(c, name = 'hipsolverDsytrdBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverDsygvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrdBatched_bufferSize
     end interface
     
     interface
-        function hipsolverChegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverChetrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChegvd_bufferSize')
+                bind(c, name = 'hipsolverChetrdBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverChegvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverChetrdBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZhegvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, lwork) &
+        function hipsolverZhetrdBatched_bufferSize(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, &
+                strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhegvd_bufferSize')
+                bind(c, name = 'hipsolverZhetrdBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverZhegvd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZhetrdBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverSsytrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsygvd')
+                bind(c, name = 'hipsolverSsytrdBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsygvd
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrdBatched
     end interface
-
+    
     interface
-        function hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverDsytrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsygvd')
+                bind(c, name = 'hipsolverDsytrdBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsygvd
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrdBatched
     end interface
-
+    
     interface
-        function hipsolverChegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverChetrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChegvd')
+                bind(c, name = 'hipsolverChetrdBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverChegvd
+            integer(c_int), value :: batch_count
+        end function hipsolverChetrdBatched
     end interface
-
+    
     interface
-        function hipsolverZhegvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, D, work, lwork, info) &
+        function hipsolverZhetrdBatched(handle, uplo, n, A, lda, D, strideD, E, strideE, tau, strideP, work, &
+                lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhegvd')
+                bind(c, name = 'hipsolverZhetrdBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
             type(c_ptr), value :: handle
-            integer(kind(HIPSOLVER_EIG_TYPE_1)), value :: itype
-            integer(kind(HIPSOLVER_EIG_MODE_NOVECTOR)), value :: jobz
             integer(kind(HIPSOLVER_FILL_MODE_LOWER)), value :: uplo
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
+            type(c_ptr), value :: E
+            integer(c_int), value :: strideE
+            type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZhegvd
+            integer(c_int), value :: batch_count
+        end function hipsolverZhetrdBatched
     end interface
 
-    ! ******************** SYTRD/HETRD ********************
+    ! ******************** SYTRD/HETRD_STRIDED_BATCHED ********************
     interface
-        function hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverSsytrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsytrd_bufferSize')
+                bind(c, name = 'hipsolverSsytrdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2325,17 +7945,23 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverSsytrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverDsytrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsytrd_bufferSize')
+                bind(c, name = 'hipsolverDsytrdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2344,17 +7970,23 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverDsytrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverChetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverChetrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChetrd_bufferSize')
+                bind(c, name = 'hipsolverChetrdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2363,17 +7995,23 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverChetrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverChetrdStridedBatched_bufferSize
     end interface
     
     interface
-        function hipsolverZhetrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork) &
+        function hipsolverZhetrdStridedBatched_bufferSize(handle, uplo, n, A, lda, strideA, D, strideD, E, &
+                strideE, tau, strideP, lwork, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhetrd_bufferSize')
+                bind(c, name = 'hipsolverZhetrdStridedBatched_bufferSize')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2382,17 +8020,23 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: lwork
-        end function hipsolverZhetrd_bufferSize
+            integer(c_int), value :: batch_count
+        end function hipsolverZhetrdStridedBatched_bufferSize
     end interface
-
+    
     interface
-        function hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverSsytrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+                tau, strideP, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverSsytrd')
+                bind(c, name = 'hipsolverSsytrdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2401,19 +8045,25 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverSsytrd
+            integer(c_int), value :: batch_count
+        end function hipsolverSsytrdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverDsytrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+                tau, strideP, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverDsytrd')
+                bind(c, name = 'hipsolverDsytrdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2422,19 +8072,25 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverDsytrd
+            integer(c_int), value :: batch_count
+        end function hipsolverDsytrdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverChetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverChetrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+                tau, strideP, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverChetrd')
+                bind(c, name = 'hipsolverChetrdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2443,19 +8099,25 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverChetrd
+            integer(c_int), value :: batch_count
+        end function hipsolverChetrdStridedBatched
     end interface
-
+    
     interface
-        function hipsolverZhetrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info) &
+        function hipsolverZhetrdStridedBatched(handle, uplo, n, A, lda, strideA, D, strideD, E, strideE, &
+                tau, strideP, work, lwork, info, batch_count) &
                 result(c_int) &
-                bind(c, name = 'hipsolverZhetrd')
+                bind(c, name = 'hipsolverZhetrdStridedBatched')
             use iso_c_binding
             use hipsolver_enums
             implicit none
@@ -2464,13 +8126,18 @@ module hipsolver
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int), value :: strideA
             type(c_ptr), value :: D
+            integer(c_int), value :: strideD
             type(c_ptr), value :: E
+            integer(c_int), value :: strideE
             type(c_ptr), value :: tau
+            integer(c_int), value :: strideP
             type(c_ptr), value :: work
             integer(c_int), value :: lwork
             type(c_ptr), value :: info
-        end function hipsolverZhetrd
+            integer(c_int), value :: batch_count
+        end function hipsolverZhetrdStridedBatched
     end interface
     
 end module hipsolver
@@ -0,0 +1,354 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include <hip/hip_runtime_api.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <tuple>
+
+/*! \brief Identifies a class of problems that share an autotuned algorithm.
+ *
+ *  The variant distinguishes calls of one function that run different code, such as getrf with
+ *  and without pivoting, or potrf of either triangle. Sizes are bucketed by the next power of
+ *  two, and the architecture is that of the device, such as gfx90a or sm_80.
+ */
+struct hipsolver_autotune_key
+{
+    std::string arch;
+    int         function;
+    char        precision;
+    int         variant;
+    int         m_bucket;
+    int         n_bucket;
+
+    bool operator<(const hipsolver_autotune_key& other) const
+    {
+        return std::tie(arch, function, precision, variant, m_bucket, n_bucket)
+               < std::tie(other.arch,
+                          other.function,
+                          other.precision,
+                          other.variant,
+                          other.m_bucket,
+                          other.n_bucket);
+    }
+};
+
+/*! \brief Returns the bucket of size k, the smallest b such that k <= 2^b. */
+inline int hipsolver_autotune_bucket(int k)
+{
+    int b = 0;
+    while((int64_t(1) << b) < k)
+        b++;
+    return b;
+}
+
+inline char hipsolver_autotune_precision(const float*)
+{
+    return 's';
+}
+
+inline char hipsolver_autotune_precision(const double*)
+{
+    return 'd';
+}
+
+inline char hipsolver_autotune_precision(const hipsolverComplex*)
+{
+    return 'c';
+}
+
+inline char hipsolver_autotune_precision(const hipsolverDoubleComplex*)
+{
+    return 'z';
+}
+
+/*! \brief Process-wide cache of the algorithms selected by the autotuner.
+ *
+ *  The cache is persisted in the file named by HIPSOLVER_AUTOTUNE_PATH. Its first line is a
+ *  version header, followed by one line per key with the arch, function, precision, variant,
+ *  m and n buckets and the selected algorithm. A file of another version is ignored, and is
+ *  replaced when the next selection is saved. Saving first merges the entries that other
+ *  processes have added to the file, and then replaces the file by renaming a temporary one,
+ *  so that readers never see a partially written cache.
+ */
+class hipsolver_autotune_cache
+{
+    using map_t = std::map<hipsolver_autotune_key, int>;
+
+    std::mutex                 mutex;
+    std::string                path;
+    map_t                      choices;
+    std::map<int, std::string> archs;
+
+    /*! \brief Adds the entries of the cache file to entries, keeping those already there. */
+    void read(map_t& entries) const
+    {
+        std::ifstream file(path);
+        std::string   header;
+        int           file_version;
+        if(!(file >> header >> file_version) || header != "hipsolver-autotune"
+           || file_version != version)
+            return;
+
+        hipsolver_autotune_key key;
+        int                    choice;
+        while(file >> key.arch >> key.function >> key.precision >> key.variant >> key.m_bucket
+              >> key.n_bucket >> choice)
+            entries.insert({key, choice});
+    }
+
+    void save()
+    {
+        read(choices);
+
+        std::string tmp = path + "." + std::to_string(std::random_device{}());
+        {
+            std::ofstream file(tmp);
+            file << "hipsolver-autotune " << version << '\n';
+            for(const auto& c : choices)
+                file << c.first.arch << ' ' << c.first.function << ' ' << c.first.precision << ' '
+                     << c.first.variant << ' ' << c.first.m_bucket << ' ' << c.first.n_bucket
+                     << ' ' << c.second << '\n';
+            if(!file.flush())
+            {
+                file.close();
+                std::remove(tmp.c_str());
+                return;
+            }
+        }
+
+        if(std::rename(tmp.c_str(), path.c_str()) != 0)
+            std::remove(tmp.c_str());
+    }
+
+public:
+    static constexpr int version = 1;
+
+    static hipsolver_autotune_cache& instance()
+    {
+        static hipsolver_autotune_cache cache;
+        return cache;
+    }
+
+    /*! \brief Loads the file named by HIPSOLVER_AUTOTUNE_PATH, unless it is the file already
+     *  loaded, and returns true if the variable is set, which enables autotuning of new handles.
+     */
+    bool load_env()
+    {
+        const char* env = std::getenv("HIPSOLVER_AUTOTUNE_PATH");
+        if(!env || !*env)
+            return false;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(path != env)
+        {
+            path = env;
+            read(choices);
+        }
+        return true;
+    }
+
+    /*! \brief Returns true and sets choice if an algorithm has been selected for key. */
+    bool find(const hipsolver_autotune_key& key, int* choice)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = choices.find(key);
+        if(it == choices.end())
+            return false;
+
+        *choice = it->second;
+        return true;
+    }
+
+    /*! \brief Records the algorithm selected for key, and saves the cache if it has a file. */
+    void insert(const hipsolver_autotune_key& key, int choice)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        choices[key] = choice;
+        if(!path.empty())
+            save();
+    }
+
+    /*! \brief Returns the architecture of device, without the target features of AMD GPUs. */
+    std::string arch(int device)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = archs.find(device);
+        if(it != archs.end())
+            return it->second;
+
+        hipDeviceProp_t prop;
+        std::memset(&prop, 0, sizeof(prop));
+        std::string name = "unknown";
+        if(hipGetDeviceProperties(&prop, device) == hipSuccess)
+        {
+            prop.gcnArchName[sizeof(prop.gcnArchName) - 1] = 0;
+            name                                           = prop.gcnArchName;
+            if(name.compare(0, 3, "gfx") == 0)
+                name = name.substr(0, name.find(':'));
+            else
+                name = "sm_" + std::to_string(prop.major * 10 + prop.minor);
+        }
+
+        return archs[device] = name;
+    }
+};
+
+/*! \brief Autotuning mode of a handle. It is on by default if HIPSOLVER_AUTOTUNE_PATH names a
+ *  cache, which is loaded when the mode is first used rather than when the handle is created. */
+class hipsolver_autotune_setting
+{
+    std::once_flag env;
+    bool           on = false;
+
+    void load_env()
+    {
+        std::call_once(env, [this] { on = hipsolver_autotune_cache::instance().load_env(); });
+    }
+
+public:
+    bool get()
+    {
+        load_env();
+        return on;
+    }
+
+    void set(bool mode)
+    {
+        load_env();
+        on = mode;
+    }
+};
+
+/*! \brief Device memory and events used to time the candidate algorithms. */
+struct hipsolver_autotune_scratch
+{
+    void*      memory = nullptr;
+    hipEvent_t start  = nullptr;
+    hipEvent_t stop   = nullptr;
+
+    hipsolver_autotune_scratch() = default;
+
+    hipsolver_autotune_scratch(const hipsolver_autotune_scratch&) = delete;
+    hipsolver_autotune_scratch& operator=(const hipsolver_autotune_scratch&) = delete;
+
+    ~hipsolver_autotune_scratch()
+    {
+        if(memory)
+            hipFree(memory);
+        if(start)
+            hipEventDestroy(start);
+        if(stop)
+            hipEventDestroy(stop);
+    }
+
+    hipError_t allocate(size_t size)
+    {
+        hipError_t err = hipMalloc(&memory, size);
+        if(err != hipSuccess)
+            memory = nullptr;
+        if(err == hipSuccess)
+            err = hipEventCreate(&start);
+        if(err == hipSuccess)
+            err = hipEventCreate(&stop);
+        return err;
+    }
+};
+
+/*! \brief Sets unblocked to the algorithm selected by the autotuner for the factorization of the
+ *  m-by-n matrix A.
+ *
+ *  factor(unblocked, A, ipiv, info) enqueues the factorization with the given algorithm, and
+ *  returns a zero status on success. The first time that the key of the problem is seen, both
+ *  algorithms factor a copy of A, with pivots if ipiv is not null, and the faster one is added
+ *  to the cache. Each algorithm runs twice, and only the second run, which does not load
+ *  kernels, is timed. Timing synchronizes the stream, so while the stream is being captured, or
+ *  if the timing fails, a key that is not cached keeps the default algorithm.
+ */
+template <typename T, typename F>
+void hipsolver_autotune(hipsolverHandle_t     handle,
+                        hipsolverDnFunction_t function,
+                        int                   variant,
+                        int                   m,
+                        int                   n,
+                        T*                    A,
+                        int                   lda,
+                        int*                  ipiv,
+                        F                     factor,
+                        bool*                 unblocked)
+{
+    if(m <= 0 || n <= 0)
+        return;
+
+    int         device;
+    hipStream_t stream;
+    if(hipGetDevice(&device) != hipSuccess
+       || hipsolverGetStream(handle, &stream) != HIPSOLVER_STATUS_SUCCESS)
+        return;
+
+    hipsolver_autotune_cache& cache = hipsolver_autotune_cache::instance();
+    hipsolver_autotune_key    key   = {cache.arch(device),
+                                  function,
+                                  hipsolver_autotune_precision(A),
+                                  variant,
+                                  hipsolver_autotune_bucket(m),
+                                  hipsolver_autotune_bucket(n)};
+
+    int choice = 0;
+    if(cache.find(key, &choice))
+    {
+        *unblocked = choice == 1;
+        return;
+    }
+    if(hipsolver_stream_is_capturing(stream))
+        return;
+
+    int                        k      = std::min(m, n);
+    size_t                     a_size = sizeof(T) * (size_t(lda) * (n - 1) + m);
+    size_t                     offset = (a_size + sizeof(int) - 1) / sizeof(int) * sizeof(int);
+    hipsolver_autotune_scratch scratch;
+    if(scratch.allocate(offset + sizeof(int) * (k + 1)) != hipSuccess)
+        return;
+
+    T*    tA    = (T*)scratch.memory;
+    int*  tIpiv = (int*)((char*)scratch.memory + offset);
+    int*  tInfo = tIpiv + k;
+    float best  = std::numeric_limits<float>::max();
+    for(int c = 0; c < 2; c++)
+    {
+        float time = 0;
+        for(int run = 0; run < 2; run++)
+        {
+            if(hipMemcpyAsync(tA, A, a_size, hipMemcpyDeviceToDevice, stream) != hipSuccess
+               || hipEventRecord(scratch.start, stream) != hipSuccess
+               || int(factor(c == 1, tA, ipiv ? tIpiv : nullptr, tInfo)) != 0
+               || hipEventRecord(scratch.stop, stream) != hipSuccess
+               || hipEventSynchronize(scratch.stop) != hipSuccess
+               || hipEventElapsedTime(&time, scratch.start, scratch.stop) != hipSuccess)
+                return;
+        }
+
+        if(time < best)
+        {
+            best   = time;
+            choice = c;
+        }
+    }
+
+    cache.insert(key, choice);
+    *unblocked = choice == 1;
+}
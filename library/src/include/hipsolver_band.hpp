@@ -0,0 +1,1073 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_ooc.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Band LU and Cholesky factorizations and solves, gbtrf/gbtrs and pbtrf/pbtrs, in the band
+ * storage of LAPACK.
+ *
+ * The matrix is factorized by blocks of nb columns, with O(n * b^2) work and O(b^2) workspace
+ * for a bandwidth b. Each block is copied from the band storage to a dense window in the
+ * workspace, with zeros outside of the band, where it is factorized by the in-core getrf or
+ * potrf and the rows or columns it updates are computed by the BLAS of the back-end, before it is
+ * copied back. A column c of the band storage is a run of consecutive rows of the matrix, so the
+ * window is copied by one strided copy whose pitch on the window side is one more than its
+ * leading dimension; the window is surrounded by margins that absorb the entries of the copied
+ * runs that fall outside of it.
+ *
+ * The in-core getrf of a block applies the row interchanges of a column to the multipliers of
+ * the columns to its left, while LAPACK stores the multipliers of every column as they were
+ * computed. gbtrf undoes the interchanges in the multipliers of a block before it is copied back,
+ * and gbtrs applies them again to the multipliers it loads, one interchange per column, so that
+ * the factors keep the layout of LAPACK and fit in the kl subdiagonals of the band storage.
+ *
+ * The pivots and infos of the blocks are computed relative to the blocks, and the host makes
+ * them relative to the matrix at the end of the factorizations, so gbtrf and pbtrf synchronize
+ * with the stream of the handle once per call, and gbtrs once to read the pivots. When a block
+ * of pbtrf is not positive definite, the factorization of the blocks that follow it is not
+ * meaningful. The BLAS of the back-end are reached through the Blas policy, which provides the
+ * updates and triangular solves of the out-of-core factorizations, the row interchanges of
+ * LAPACK xLASWP, and the size in bytes of the workspace.
+ */
+
+/******************** HELPERS ********************/
+// the number of columns of the blocks
+constexpr int hipsolver_band_nb = 64;
+
+/*! \brief Layout of the workspace of a band function, with every part aligned to 256 bytes.
+ *
+ *  The window of nb + b columns has a leading dimension of ldw and is preceded by a margin of
+ *  slack entries. ipiv holds the pivots of the blocks of gbtrs, and info the infos of the blocks
+ *  of the factorizations.
+ */
+struct hipsolver_band_layout
+{
+    int    nb    = 0;
+    int    ldw   = 0;
+    int    slack = 0;
+    int    lwork = 0; // the workspace of the in-core factorization, in the units of the back-end
+    size_t window;
+    size_t work;
+    size_t ipiv;
+    size_t info;
+    size_t size;
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+
+    void init(size_t window_size, size_t work_size, size_t ipiv_count, size_t info_count)
+    {
+        window = 0;
+        work   = window + align(window_size);
+        ipiv   = work + align(work_size);
+        info   = ipiv + align(sizeof(int) * ipiv_count);
+        size   = info + align(sizeof(int) * info_count);
+    }
+
+    int blocks(int n) const
+    {
+        return (n + nb - 1) / nb;
+    }
+};
+
+/*! \brief Returns in lwork the size of the workspace of layout, in the units of the work arrays
+ *  of the back-end. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_band_lwork(const hipsolver_band_layout& layout, int* lwork)
+{
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    size_t unit = Blas::work_size(1, sizeof(T));
+    size_t size = (layout.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Checks that the workspace work of lwork holds layout. */
+template <typename Blas, typename T>
+hipsolverStatus_t
+    hipsolver_band_work(const hipsolver_band_layout& layout, const T* work, int lwork)
+{
+    if(lwork < 0 || Blas::work_size(lwork, sizeof(T)) < layout.size || !work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Copies the rows at offsets o0 to o1 of the band storage of the columns c0 to
+ *  c0 + cols - 1 to the window W, or back if to_band is true.
+ *
+ *  Entry (r, c) of the matrix is at AB[shift + r - c + c * ldab], and at
+ *  W[(r - c0) + (c - c0) * ldw] in the window. The rows outside of the window are copied to the
+ *  margins of W: the rows above it to the rows ldw + r - c0 of the previous column, or to the
+ *  shift - o0 entries before W, and the rows below it to the rows that follow nb + kl.
+ */
+template <typename T>
+inline hipError_t hipsolver_band_copy(T*          W,
+                                      int         ldw,
+                                      T*          AB,
+                                      int         ldab,
+                                      int         shift,
+                                      int         c0,
+                                      int         cols,
+                                      int         o0,
+                                      int         o1,
+                                      bool        to_band,
+                                      hipStream_t stream)
+{
+    if(cols == 0 || o1 < o0)
+        return hipSuccess;
+
+    T*     w     = W - shift + o0;
+    T*     b     = AB + o0 + size_t(c0) * ldab;
+    size_t wp    = sizeof(T) * (size_t(ldw) + 1);
+    size_t bp    = sizeof(T) * ldab;
+    size_t width = sizeof(T) * (o1 - o0 + 1);
+    return to_band ? hipMemcpy2DAsync(b, bp, w, wp, width, cols, hipMemcpyDeviceToDevice, stream)
+                   : hipMemcpy2DAsync(w, wp, b, bp, width, cols, hipMemcpyDeviceToDevice, stream);
+}
+
+/*! \brief Zeroes the window W of cols columns and loads the band entries of its columns. */
+template <typename T>
+inline hipError_t hipsolver_band_load(T*          W,
+                                      int         ldw,
+                                      T*          AB,
+                                      int         ldab,
+                                      int         shift,
+                                      int         c0,
+                                      int         cols,
+                                      int         o0,
+                                      int         o1,
+                                      hipStream_t stream)
+{
+    hipError_t error = hipMemsetAsync(W, 0, sizeof(T) * ldw * cols, stream);
+    if(error != hipSuccess)
+        return error;
+    return hipsolver_band_copy(W, ldw, AB, ldab, shift, c0, cols, o0, o1, false, stream);
+}
+
+/*! \brief Applies the row interchanges k of the block to the columns 0 to k - 1 of the window
+ *  W, for k = k0, k0 + step, ..., up to k1 excluded, with the pivots ipiv of the block. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_band_reswap(
+    hipsolverHandle_t handle, T* W, int ldw, int k0, int k1, int step, const int* ipiv)
+{
+    for(int k = k0; k != k1; k += step)
+    {
+        hipsolverStatus_t status = Blas::laswp(handle, k, W, ldw, k + 1, k + 1, ipiv);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Copies the batch_count x count integers of the device array src, with a stride of
+ *  stride, to the host vector dst, or back if to_device is true. */
+inline hipError_t hipsolver_band_ints(std::vector<int>& dst,
+                                      int*              src,
+                                      int               count,
+                                      int               stride,
+                                      int               batch_count,
+                                      bool              to_device,
+                                      hipStream_t       stream)
+{
+    dst.resize(size_t(count) * batch_count);
+    if(count == 0 || batch_count == 0)
+        return hipSuccess;
+
+    size_t hp = sizeof(int) * count, dp = sizeof(int) * stride;
+    return to_device ? hipMemcpy2DAsync(
+               src, dp, dst.data(), hp, hp, batch_count, hipMemcpyHostToDevice, stream)
+                     : hipMemcpy2DAsync(
+                         dst.data(), hp, src, dp, hp, batch_count, hipMemcpyDeviceToHost, stream);
+}
+
+/*! \brief Writes to the infos of the batch the first nonzero info of the blocks of each
+ *  factorization, relative to the matrix. Synchronizes with stream. */
+inline hipsolverStatus_t hipsolver_band_infos(const hipsolver_band_layout& layout,
+                                              const int*                   block_info,
+                                              int                          n,
+                                              int*                         info,
+                                              int                          batch_count,
+                                              hipStream_t                  stream)
+{
+    int              blocks = layout.blocks(n);
+    std::vector<int> hblock(size_t(blocks) * batch_count);
+    if(hipMemcpyAsync(hblock.data(),
+                      block_info,
+                      sizeof(int) * hblock.size(),
+                      hipMemcpyDeviceToHost,
+                      stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    std::vector<int> hinfo(batch_count, 0);
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int k = 0; k < blocks; k++)
+        {
+            int block = hblock[size_t(b) * blocks + k];
+            if(block > 0)
+            {
+                hinfo[b] = k * layout.nb + block;
+                break;
+            }
+        }
+    }
+
+    if(hipMemcpyAsync(info, hinfo.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice, stream)
+       != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GBTRF ********************/
+/*! \brief Layout of the workspace of gbtrf and gbtrs. The window holds the rows of a block of
+ *  gbtrf and the kl + ku columns it updates, and the pivots of gbtrs are relative to the blocks.
+ */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_gbtrf_layout(hipsolverHandle_t      handle,
+                                         int                    n,
+                                         int                    kl,
+                                         int                    ku,
+                                         int                    batch_count,
+                                         bool                   solve,
+                                         hipsolver_band_layout* layout)
+{
+    int kv        = kl + ku;
+    layout->nb    = std::min(hipsolver_band_nb, std::max(n, 1));
+    layout->ldw   = layout->nb + kv + kl;
+    layout->slack = kv;
+    layout->lwork = 0;
+
+    if(n > 0 && !solve)
+    {
+        hipsolverStatus_t status = hipsolver_ooc_getrf_bufferSize(handle,
+                                                                  std::min(layout->nb + kl, n),
+                                                                  layout->nb,
+                                                                  (T*)nullptr,
+                                                                  layout->ldw,
+                                                                  &layout->lwork);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    size_t window = size_t(layout->slack) + size_t(layout->ldw) * (layout->nb + kv);
+    layout->init(sizeof(T) * window,
+                 Blas::work_size(layout->lwork, sizeof(T)),
+                 solve ? size_t(n) * batch_count : 0,
+                 solve ? 0 : size_t(layout->blocks(n)) * batch_count);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_gbtrf_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             int               kl,
+                                             int               ku,
+                                             int               ldab,
+                                             int               strideAB,
+                                             int               strideP,
+                                             int*              lwork,
+                                             int               batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 || strideP < n || batch_count < 0
+       || (batch_count > 1 && size_t(strideAB) < size_t(ldab) * n) || !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t status
+        = hipsolver_gbtrf_layout<Blas, T>(handle, n, kl, ku, batch_count, false, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_band_lwork<Blas, T>(layout, lwork);
+}
+
+/*! \brief The LU factorization of the batch of batch_count band matrices of order n with kl
+ *  subdiagonals and ku superdiagonals, with partial pivoting, as by LAPACK gbtrf. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_gbtrf(hipsolverHandle_t handle,
+                                  int               n,
+                                  int               kl,
+                                  int               ku,
+                                  T*                AB,
+                                  int               ldab,
+                                  int               strideAB,
+                                  T*                work,
+                                  int               lwork,
+                                  int*              ipiv,
+                                  int               strideP,
+                                  int*              info,
+                                  int               batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 || strideP < n || batch_count < 0
+       || (batch_count > 1 && size_t(strideAB) < size_t(ldab) * n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && (!info || (n > 0 && (!AB || !ipiv))))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t     status
+        = hipsolver_gbtrf_layout<Blas, T>(handle, n, kl, ku, batch_count, false, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_band_work<Blas, T>(layout, work, lwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+    {
+        if(batch_count > 0
+           && hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+    hipsolver_forbid_capture(stream);
+
+    const int nb = layout.nb, ldw = layout.ldw, kv = kl + ku, blocks = layout.blocks(n);
+    char*     base  = (char*)work;
+    T*        W     = (T*)(base + layout.window) + layout.slack;
+    T*        cwork = (T*)(base + layout.work);
+    int*      binfo = (int*)(base + layout.info);
+
+    // the pivots start as the identity of each block, in case the algorithm hints of the handle
+    // disable pivoting
+    std::vector<int> hipiv(size_t(n) * batch_count);
+    for(size_t i = 0; i < hipiv.size(); i++)
+        hipiv[i] = int(i % n) % nb + 1;
+    if(hipsolver_band_ints(hipiv, ipiv, n, strideP, batch_count, true, stream) != hipSuccess
+       || hipMemsetAsync(binfo, 0, sizeof(int) * blocks * batch_count, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        T*   A = AB + size_t(b) * strideAB;
+        int* P = ipiv + size_t(b) * strideP;
+
+        // the kl rows of fill-in need not be set on entry
+        if(kl > 0
+           && hipMemset2DAsync(A, sizeof(T) * ldab, 0, sizeof(T) * kl, n, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        for(int j = 0, k = 0; j < n; j += nb, k++)
+        {
+            // the block has jb columns and R rows, and updates C columns
+            int jb = std::min(nb, n - j);
+            int R = std::min(jb + kl, n - j), C = std::min(jb + kv, n - j);
+            if(hipsolver_band_load(W, ldw, A, ldab, kv, j, C, 0, kv + kl, stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+            status = hipsolver_ooc_getrf(
+                handle, R, jb, W, ldw, cwork, layout.lwork, P + j, binfo + size_t(b) * blocks + k);
+            if(status == HIPSOLVER_STATUS_SUCCESS && C > jb)
+                status = Blas::laswp(handle, C - jb, W + size_t(jb) * ldw, ldw, 1, jb, P + j);
+            if(status == HIPSOLVER_STATUS_SUCCESS && C > jb)
+                status = Blas::trsm(handle,
+                                    HIPSOLVER_SIDE_LEFT,
+                                    HIPSOLVER_FILL_MODE_LOWER,
+                                    HIPSOLVER_OP_N,
+                                    true,
+                                    jb,
+                                    C - jb,
+                                    W,
+                                    ldw,
+                                    W + size_t(jb) * ldw,
+                                    ldw);
+            if(status == HIPSOLVER_STATUS_SUCCESS && C > jb && R > jb)
+                status = Blas::gemm(handle,
+                                    HIPSOLVER_OP_N,
+                                    HIPSOLVER_OP_N,
+                                    R - jb,
+                                    C - jb,
+                                    jb,
+                                    W + jb,
+                                    ldw,
+                                    W + size_t(jb) * ldw,
+                                    ldw,
+                                    W + jb + size_t(jb) * ldw,
+                                    ldw);
+
+            // the multipliers of column i are restored by undoing the interchanges jb - 1 down
+            // to i + 1
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = hipsolver_band_reswap<Blas>(handle, W, ldw, jb - 1, 0, -1, P + j);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+
+            if(hipsolver_band_copy(W, ldw, A, ldab, kv, j, C, 0, kv + kl, true, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    // the pivots of the blocks are made relative to the matrices
+    if(hipsolver_band_ints(hipiv, ipiv, n, strideP, batch_count, false, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    status = hipsolver_band_infos(layout, binfo, n, info, batch_count, stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    for(size_t i = 0; i < hipiv.size(); i++)
+        hipiv[i] += int(i % n) / nb * nb;
+    if(hipsolver_band_ints(hipiv, ipiv, n, strideP, batch_count, true, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GBTRS ********************/
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_gbtrs_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  kl,
+                                             int                  ku,
+                                             int                  nrhs,
+                                             int                  ldab,
+                                             int                  strideAB,
+                                             int                  strideP,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(trans != HIPSOLVER_OP_N && trans != HIPSOLVER_OP_T && trans != HIPSOLVER_OP_C)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || kl < 0 || ku < 0 || nrhs < 0 || ldab < 2 * kl + ku + 1 || ldb < std::max(n, 1)
+       || strideP < n || batch_count < 0 || !lwork
+       || (batch_count > 1
+           && (size_t(strideAB) < size_t(ldab) * n || size_t(strideB) < size_t(ldb) * nrhs)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t status
+        = hipsolver_gbtrf_layout<Blas, T>(handle, n, kl, ku, batch_count, true, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_band_lwork<Blas, T>(layout, lwork);
+}
+
+/*! \brief Solves op(A) * X = B for the batch of band matrices factorized by gbtrf, as by LAPACK
+ *  gbtrs. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_gbtrs(hipsolverHandle_t    handle,
+                                  hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  kl,
+                                  int                  ku,
+                                  int                  nrhs,
+                                  T*                   AB,
+                                  int                  ldab,
+                                  int                  strideAB,
+                                  int*                 ipiv,
+                                  int                  strideP,
+                                  T*                   B,
+                                  int                  ldb,
+                                  int                  strideB,
+                                  T*                   work,
+                                  int                  lwork,
+                                  int*                 info,
+                                  int                  batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(trans != HIPSOLVER_OP_N && trans != HIPSOLVER_OP_T && trans != HIPSOLVER_OP_C)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || kl < 0 || ku < 0 || nrhs < 0 || ldab < 2 * kl + ku + 1 || ldb < std::max(n, 1)
+       || strideP < n || batch_count < 0
+       || (batch_count > 1
+           && (size_t(strideAB) < size_t(ldab) * n || size_t(strideB) < size_t(ldb) * nrhs)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && (!info || (n > 0 && (!AB || !ipiv)) || (n > 0 && nrhs > 0 && !B)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t     status
+        = hipsolver_gbtrf_layout<Blas, T>(handle, n, kl, ku, batch_count, true, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_band_work<Blas, T>(layout, work, lwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(batch_count > 0 && hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    const int nb = layout.nb, ldw = layout.ldw, kv = kl + ku;
+    char*     base = (char*)work;
+    T*        W    = (T*)(base + layout.window) + layout.slack;
+    int*      lpiv = (int*)(base + layout.ipiv);
+
+    // the interchanges of the multipliers need the pivots relative to the blocks
+    if(kl > 0)
+    {
+        hipsolver_forbid_capture(stream);
+        std::vector<int> hipiv;
+        if(hipsolver_band_ints(hipiv, ipiv, n, strideP, batch_count, false, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        for(size_t i = 0; i < hipiv.size(); i++)
+            hipiv[i] -= int(i % n) / nb * nb;
+        if(hipsolver_band_ints(hipiv, lpiv, n, n, batch_count, true, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    const int last = (n - 1) / nb * nb;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T*   A  = AB + size_t(b) * strideAB;
+        int* P  = ipiv + size_t(b) * strideP;
+        int* LP = lpiv + size_t(b) * n;
+        T*   X  = B + size_t(b) * strideB;
+
+        // loads the multipliers of the block at j, with their interchanges applied
+        auto load_l = [&](int j, int jb) {
+            if(hipsolver_band_load(W, ldw, A, ldab, kv, j, jb, kv + 1, kv + kl, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            return hipsolver_band_reswap<Blas>(handle, W, ldw, 1, jb, 1, LP + j);
+        };
+        auto load_u = [&](int j, int C) {
+            return hipsolver_band_load(W, ldw, A, ldab, kv, j, C, 0, kv, stream) == hipSuccess
+                       ? HIPSOLVER_STATUS_SUCCESS
+                       : HIPSOLVER_STATUS_INTERNAL_ERROR;
+        };
+
+        if(trans == HIPSOLVER_OP_N)
+        {
+            // L * Y = P * B, by blocks from the top
+            for(int j = 0; kl > 0 && j < n; j += nb)
+            {
+                int jb = std::min(nb, n - j), R = std::min(jb + kl, n - j);
+                status = Blas::laswp(handle, nrhs, X, ldb, j + 1, j + jb, P);
+                if(status == HIPSOLVER_STATUS_SUCCESS)
+                    status = load_l(j, jb);
+                if(status == HIPSOLVER_STATUS_SUCCESS)
+                    status = Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_LEFT,
+                                        HIPSOLVER_FILL_MODE_LOWER,
+                                        HIPSOLVER_OP_N,
+                                        true,
+                                        jb,
+                                        nrhs,
+                                        W,
+                                        ldw,
+                                        X + j,
+                                        ldb);
+                if(status == HIPSOLVER_STATUS_SUCCESS && R > jb)
+                    status = Blas::gemm(handle,
+                                        HIPSOLVER_OP_N,
+                                        HIPSOLVER_OP_N,
+                                        R - jb,
+                                        nrhs,
+                                        jb,
+                                        W + jb,
+                                        ldw,
+                                        X + j,
+                                        ldb,
+                                        X + j + jb,
+                                        ldb);
+                if(status != HIPSOLVER_STATUS_SUCCESS)
+                    return status;
+            }
+
+            // U * X = Y, by blocks from the bottom
+            for(int j = last; j >= 0; j -= nb)
+            {
+                int jb = std::min(nb, n - j), C = std::min(jb + kv, n - j);
+                status = load_u(j, C);
+                if(status == HIPSOLVER_STATUS_SUCCESS && C > jb)
+                    status = Blas::gemm(handle,
+                                        HIPSOLVER_OP_N,
+                                        HIPSOLVER_OP_N,
+                                        jb,
+                                        nrhs,
+                                        C - jb,
+                                        W + size_t(jb) * ldw,
+                                        ldw,
+                                        X + j + jb,
+                                        ldb,
+                                        X + j,
+                                        ldb);
+                if(status == HIPSOLVER_STATUS_SUCCESS)
+                    status = Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_LEFT,
+                                        HIPSOLVER_FILL_MODE_UPPER,
+                                        HIPSOLVER_OP_N,
+                                        false,
+                                        jb,
+                                        nrhs,
+                                        W,
+                                        ldw,
+                                        X + j,
+                                        ldb);
+                if(status != HIPSOLVER_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+        else
+        {
+            // op(U) * Y = B, by blocks from the top
+            for(int j = 0; j < n; j += nb)
+            {
+                int jb = std::min(nb, n - j), C = std::min(jb + kv, n - j);
+                status = load_u(j, C);
+                if(status == HIPSOLVER_STATUS_SUCCESS)
+                    status = Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_LEFT,
+                                        HIPSOLVER_FILL_MODE_UPPER,
+                                        trans,
+                                        false,
+                                        jb,
+                                        nrhs,
+                                        W,
+                                        ldw,
+                                        X + j,
+                                        ldb);
+                if(status == HIPSOLVER_STATUS_SUCCESS && C > jb)
+                    status = Blas::gemm(handle,
+                                        trans,
+                                        HIPSOLVER_OP_N,
+                                        C - jb,
+                                        nrhs,
+                                        jb,
+                                        W + size_t(jb) * ldw,
+                                        ldw,
+                                        X + j,
+                                        ldb,
+                                        X + j + jb,
+                                        ldb);
+                if(status != HIPSOLVER_STATUS_SUCCESS)
+                    return status;
+            }
+
+            // op(L) * Z = Y and X = P^T * Z, by blocks from the bottom, with the interchanges of
+            // a block in reverse order
+            for(int j = last; kl > 0 && j >= 0; j -= nb)
+            {
+                int jb = std::min(nb, n - j), R = std::min(jb + kl, n - j);
+                status = load_l(j, jb);
+                if(status == HIPSOLVER_STATUS_SUCCESS && R > jb)
+                    status = Blas::gemm(handle,
+                                        trans,
+                                        HIPSOLVER_OP_N,
+                                        jb,
+                                        nrhs,
+                                        R - jb,
+                                        W + jb,
+                                        ldw,
+                                        X + j + jb,
+                                        ldb,
+                                        X + j,
+                                        ldb);
+                if(status == HIPSOLVER_STATUS_SUCCESS)
+                    status = Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_LEFT,
+                                        HIPSOLVER_FILL_MODE_LOWER,
+                                        trans,
+                                        true,
+                                        jb,
+                                        nrhs,
+                                        W,
+                                        ldw,
+                                        X + j,
+                                        ldb);
+                for(int k = j + jb; status == HIPSOLVER_STATUS_SUCCESS && k > j; k--)
+                    status = Blas::laswp(handle, nrhs, X, ldb, k, k, P);
+                if(status != HIPSOLVER_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** PBTRF ********************/
+/*! \brief Layout of the workspace of pbtrf and pbtrs. The window holds the rows of a block and
+ *  the kd rows below it for the lower triangle, or the columns of a block and the kd columns to
+ *  its right for the upper triangle. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_pbtrf_layout(hipsolverHandle_t      handle,
+                                         hipsolverFillMode_t    uplo,
+                                         int                    n,
+                                         int                    kd,
+                                         int                    batch_count,
+                                         bool                   solve,
+                                         hipsolver_band_layout* layout)
+{
+    layout->nb    = std::min(hipsolver_band_nb, std::max(n, 1));
+    layout->ldw   = layout->nb + kd;
+    layout->slack = kd;
+    layout->lwork = 0;
+
+    if(n > 0 && !solve)
+    {
+        hipsolverStatus_t status = hipsolver_ooc_potrf_bufferSize(
+            handle, uplo, layout->nb, (T*)nullptr, layout->ldw, &layout->lwork);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    size_t window = size_t(layout->slack) + size_t(layout->ldw) * (layout->nb + kd);
+    layout->init(sizeof(T) * window,
+                 Blas::work_size(layout->lwork, sizeof(T)),
+                 0,
+                 solve ? 0 : size_t(layout->blocks(n)) * batch_count);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_pbtrf_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int*                lwork,
+                                             int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || kd < 0 || ldab < kd + 1 || batch_count < 0 || !lwork
+       || (batch_count > 1 && size_t(strideAB) < size_t(ldab) * n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t status
+        = hipsolver_pbtrf_layout<Blas, T>(handle, uplo, n, kd, batch_count, false, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_band_lwork<Blas, T>(layout, lwork);
+}
+
+/*! \brief The Cholesky factorization of the batch of batch_count positive definite band
+ *  matrices of order n with kd subdiagonals or superdiagonals, as by LAPACK pbtrf. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_pbtrf(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  T*                  AB,
+                                  int                 ldab,
+                                  int                 strideAB,
+                                  T*                  work,
+                                  int                 lwork,
+                                  int*                info,
+                                  int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || kd < 0 || ldab < kd + 1 || batch_count < 0
+       || (batch_count > 1 && size_t(strideAB) < size_t(ldab) * n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && (!info || (n > 0 && !AB)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t     status
+        = hipsolver_pbtrf_layout<Blas, T>(handle, uplo, n, kd, batch_count, false, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_band_work<Blas, T>(layout, work, lwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+    {
+        if(batch_count > 0
+           && hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+    hipsolver_forbid_capture(stream);
+
+    // the lower window is the block of columns j to j + jb - 1 and rows j to j + R - 1, with
+    // the band entries at offsets 0 to kd; the upper window is the block of rows j to j + jb - 1
+    // and columns j to j + C - 1, with the band entries at offsets 0 to kd shifted by kd
+    const bool                 lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+    const hipsolverOperation_t opC   = hipsolver_ooc_op_c<T>();
+    const int                  nb = layout.nb, ldw = layout.ldw, blocks = layout.blocks(n);
+    const int                  shift = lower ? 0 : kd;
+    char*                      base  = (char*)work;
+    T*                         W     = (T*)(base + layout.window) + layout.slack;
+    T*                         cwork = (T*)(base + layout.work);
+    int*                       binfo = (int*)(base + layout.info);
+
+    if(hipMemsetAsync(binfo, 0, sizeof(int) * blocks * batch_count, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* A = AB + size_t(b) * strideAB;
+
+        for(int j = 0, k = 0; j < n; j += nb, k++)
+        {
+            // the block updates the trailing block of order R - jb
+            int jb = std::min(nb, n - j), R = std::min(jb + kd, n - j);
+            int cols = lower ? jb : R;
+            if(hipsolver_band_load(W, ldw, A, ldab, shift, j, cols, 0, kd, stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+            status = hipsolver_ooc_potrf(
+                handle, uplo, jb, W, ldw, cwork, layout.lwork, binfo + size_t(b) * blocks + k);
+            if(status == HIPSOLVER_STATUS_SUCCESS && R > jb)
+                status = lower ? Blas::trsm(handle,
+                                            HIPSOLVER_SIDE_RIGHT,
+                                            uplo,
+                                            opC,
+                                            false,
+                                            R - jb,
+                                            jb,
+                                            W,
+                                            ldw,
+                                            W + jb,
+                                            ldw)
+                               : Blas::trsm(handle,
+                                            HIPSOLVER_SIDE_LEFT,
+                                            uplo,
+                                            opC,
+                                            false,
+                                            jb,
+                                            R - jb,
+                                            W,
+                                            ldw,
+                                            W + size_t(jb) * ldw,
+                                            ldw);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+
+            // the window is copied back before the trailing block, which it overlaps for the
+            // upper triangle, is updated in the band storage
+            if(hipsolver_band_copy(W, ldw, A, ldab, shift, j, cols, 0, kd, true, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            if(R > jb)
+            {
+                T* A22 = A + shift + size_t(j + jb) * ldab;
+                status = lower ? Blas::herk(
+                             handle, uplo, HIPSOLVER_OP_N, R - jb, jb, W + jb, ldw, A22, ldab - 1)
+                               : Blas::herk(handle,
+                                            uplo,
+                                            opC,
+                                            R - jb,
+                                            jb,
+                                            W + size_t(jb) * ldw,
+                                            ldw,
+                                            A22,
+                                            ldab - 1);
+                if(status != HIPSOLVER_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+    }
+
+    return hipsolver_band_infos(layout, binfo, n, info, batch_count, stream);
+}
+
+/******************** PBTRS ********************/
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_pbtrs_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 kd,
+                                             int                 nrhs,
+                                             int                 ldab,
+                                             int                 strideAB,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || kd < 0 || nrhs < 0 || ldab < kd + 1 || ldb < std::max(n, 1) || batch_count < 0
+       || !lwork
+       || (batch_count > 1
+           && (size_t(strideAB) < size_t(ldab) * n || size_t(strideB) < size_t(ldb) * nrhs)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t status
+        = hipsolver_pbtrf_layout<Blas, T>(handle, uplo, n, kd, batch_count, true, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_band_lwork<Blas, T>(layout, lwork);
+}
+
+/*! \brief Solves A * X = B for the batch of band matrices factorized by pbtrf, as by LAPACK
+ *  pbtrs. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_pbtrs(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  int                 kd,
+                                  int                 nrhs,
+                                  T*                  AB,
+                                  int                 ldab,
+                                  int                 strideAB,
+                                  T*                  B,
+                                  int                 ldb,
+                                  int                 strideB,
+                                  T*                  work,
+                                  int                 lwork,
+                                  int*                info,
+                                  int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || kd < 0 || nrhs < 0 || ldab < kd + 1 || ldb < std::max(n, 1) || batch_count < 0
+       || (batch_count > 1
+           && (size_t(strideAB) < size_t(ldab) * n || size_t(strideB) < size_t(ldb) * nrhs)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && (!info || (n > 0 && !AB) || (n > 0 && nrhs > 0 && !B)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_band_layout layout;
+    hipsolverStatus_t     status
+        = hipsolver_pbtrf_layout<Blas, T>(handle, uplo, n, kd, batch_count, true, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_band_work<Blas, T>(layout, work, lwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(batch_count > 0 && hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // the windows are those of pbtrf; the off-diagonal part of the lower window is L21, and that
+    // of the upper window is U12
+    const bool                 lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+    const hipsolverOperation_t opC   = hipsolver_ooc_op_c<T>();
+    const int                  nb = layout.nb, ldw = layout.ldw, shift = lower ? 0 : kd;
+    const int                  last = (n - 1) / nb * nb;
+    T*                         W    = (T*)((char*)work + layout.window) + layout.slack;
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* A = AB + size_t(b) * strideAB;
+        T* X = B + size_t(b) * strideB;
+
+        // the first solve, with L or U^H, goes from the top, and the second from the bottom
+        for(int pass = 0; pass < 2; pass++)
+        {
+            for(int j = pass == 0 ? 0 : last; j >= 0 && j < n; j += pass == 0 ? nb : -nb)
+            {
+                int jb = std::min(nb, n - j), R = std::min(jb + kd, n - j);
+                int cols = lower ? jb : R;
+                T*  off  = lower ? W + jb : W + size_t(jb) * ldw;
+                if(hipsolver_band_load(W, ldw, A, ldab, shift, j, cols, 0, kd, stream)
+                   != hipSuccess)
+                    return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+                hipsolverOperation_t op = (pass == 0) == lower ? HIPSOLVER_OP_N : opC;
+                if(pass == 0)
+                {
+                    status = Blas::trsm(
+                        handle, HIPSOLVER_SIDE_LEFT, uplo, op, false, jb, nrhs, W, ldw, X + j, ldb);
+                    if(status == HIPSOLVER_STATUS_SUCCESS && R > jb)
+                        status = Blas::gemm(handle,
+                                            op,
+                                            HIPSOLVER_OP_N,
+                                            R - jb,
+                                            nrhs,
+                                            jb,
+                                            off,
+                                            ldw,
+                                            X + j,
+                                            ldb,
+                                            X + j + jb,
+                                            ldb);
+                }
+                else
+                {
+                    status = R > jb ? Blas::gemm(handle,
+                                                 op,
+                                                 HIPSOLVER_OP_N,
+                                                 jb,
+                                                 nrhs,
+                                                 R - jb,
+                                                 off,
+                                                 ldw,
+                                                 X + j + jb,
+                                                 ldb,
+                                                 X + j,
+                                                 ldb)
+                                    : HIPSOLVER_STATUS_SUCCESS;
+                    if(status == HIPSOLVER_STATUS_SUCCESS)
+                        status = Blas::trsm(handle,
+                                            HIPSOLVER_SIDE_LEFT,
+                                            uplo,
+                                            op,
+                                            false,
+                                            jb,
+                                            nrhs,
+                                            W,
+                                            ldw,
+                                            X + j,
+                                            ldb);
+                }
+                if(status != HIPSOLVER_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
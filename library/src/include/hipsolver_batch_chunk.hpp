@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+
+/*
+ * Chunking of the batched functions whose workspace grows with batch_count.
+ *
+ * A batch whose workspace would exceed the batch workspace limit of the handle, set by
+ * hipsolverSetBatchWorkspaceLimit, or the largest lwork that fits in an int, is solved in chunks
+ * of consecutive problems, and every chunk reuses the workspace of the first. The chunk is the
+ * largest number of problems whose workspace fits, found by bisection on the workspace size
+ * queries of the back-end, which do not decrease with the number of problems. A single problem
+ * is always solved, even if its workspace exceeds the limit, as long as it fits in an int.
+ *
+ * The chunks are enqueued on the stream of the handle one after the other, without synchronizing
+ * the host, so that the host prepares and enqueues each chunk while the device is still solving
+ * the previous ones.
+ */
+
+/*! \brief Returns the workspace budget of a chunk, given the batch workspace limit of a handle,
+ *  which is zero if it has none. */
+inline size_t hipsolver_batch_budget(size_t limit)
+{
+    size_t max_lwork = INT_MAX;
+    return limit ? std::min(limit, max_lwork) : max_lwork;
+}
+
+/*! \brief Finds the number of problems of a batch of batch_count solved at once under budget.
+ *
+ *  query(count, &size) sets size to the workspace of count problems. On success, chunk is the
+ *  largest number of problems, from 1 to batch_count, whose workspace fits in budget, or 1 if none
+ *  does, and size is its workspace. A batch of no problems is a single chunk.
+ */
+template <typename Q>
+inline hipsolverStatus_t hipsolver_batch_chunk_search(
+    int batch_count, size_t budget, Q query, int* chunk, size_t* size)
+{
+    hipsolverStatus_t status = query(batch_count, size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *chunk = batch_count;
+    if(*size <= budget || batch_count <= 1)
+        return *size > INT_MAX ? HIPSOLVER_STATUS_INTERNAL_ERROR : HIPSOLVER_STATUS_SUCCESS;
+
+    // lo problems fit in budget, or lo is 1, and hi problems do not
+    int    lo = 1, hi = batch_count;
+    size_t lo_size;
+    status = query(lo, &lo_size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(lo_size > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    while(lo_size <= budget && hi - lo > 1)
+    {
+        int    mid = lo + (hi - lo) / 2;
+        size_t mid_size;
+        status = query(mid, &mid_size);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        if(mid_size <= budget)
+        {
+            lo      = mid;
+            lo_size = mid_size;
+        }
+        else
+            hi = mid;
+    }
+
+    *chunk = lo;
+    *size  = lo_size;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Calls launch(first, count) for the consecutive chunks of chunk problems of a batch of
+ *  batch_count, stopping at the first failure. A batch of no problems is launched once, so that
+ *  the back-end checks its arguments. */
+template <typename F>
+inline hipsolverStatus_t hipsolver_batch_chunk_run(int batch_count, int chunk, F launch)
+{
+    int first = 0;
+    do
+    {
+        int               count  = std::min(chunk, batch_count - first);
+        hipsolverStatus_t status = launch(first, count);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        first += count;
+    } while(first < batch_count);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
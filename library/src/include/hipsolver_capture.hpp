@@ -0,0 +1,30 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <hip/hip_runtime_api.h>
+
+/*! \brief Returns true if work enqueued on stream is currently being recorded into a graph.
+ *
+ *  Allocations, synchronizations and copies from pageable host memory cannot be recorded, so
+ *  the functions that would otherwise perform them check this first. An invalidated capture is
+ *  still reported as capturing, as the stream cannot be used for such operations until the
+ *  capture has been ended.
+ */
+inline bool hipsolver_stream_is_capturing(hipStream_t stream)
+{
+    hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &status) != hipSuccess)
+        return false;
+    return status != hipStreamCaptureStatusNone;
+}
+
+/*! \brief Throws HIPSOLVER_STATUS_CAPTURE_UNSAFE if stream is being captured. */
+inline void hipsolver_forbid_capture(hipStream_t stream)
+{
+    if(hipsolver_stream_is_capturing(stream))
+        throw HIPSOLVER_STATUS_CAPTURE_UNSAFE;
+}
@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <vector>
+
+/*! \brief Completion notification of the solver functions called on a handle.
+ *
+ *  In event mode, the completion event of the handle is recorded on its stream after every
+ *  solver function. With a completion callback, the info values of every solver function are
+ *  copied to pinned host memory and handed to the callback from a stream callback. The pinned
+ *  buffers are reused once their callback has run, so that no operation here waits for the
+ *  device, except the destruction of a handle whose callbacks are still pending.
+ */
+struct hipsolver_completion
+{
+    bool       record = false;
+    hipEvent_t event  = nullptr;
+
+    hipsolverCompletionCallback_t callback  = nullptr;
+    void*                         user_data = nullptr;
+
+    hipsolver_completion() = default;
+
+    hipsolver_completion(const hipsolver_completion&) = delete;
+    hipsolver_completion& operator=(const hipsolver_completion&) = delete;
+
+    ~hipsolver_completion()
+    {
+        // the pending callbacks return their buffers to this object
+        if(pending.load())
+            hipDeviceSynchronize();
+
+        for(const buffer& b : buffers)
+            hipHostFree(b.values);
+        if(event)
+            hipEventDestroy(event);
+    }
+
+    bool enabled() const
+    {
+        return record || callback;
+    }
+
+    /*! \brief Enables or disables the recording of the completion event, which is created the
+     *  first time it is enabled. */
+    hipError_t set_record(bool on)
+    {
+        if(on && !event)
+        {
+            hipError_t err = hipEventCreateWithFlags(&event, hipEventDisableTiming);
+            if(err != hipSuccess)
+            {
+                event = nullptr;
+                return err;
+            }
+        }
+
+        record = on;
+        return hipSuccess;
+    }
+
+    /*! \brief Enqueues the completion of the solver function routine, whose count info values
+     *  are in the device array devInfo. The event is recorded after the callback, which blocks
+     *  the stream until it returns, so that the event completes after the callback. The callback
+     *  cannot be recorded by a stream capture, which must be checked by the caller. */
+    hipError_t notify(hipsolverHandle_t handle,
+                      hipStream_t       stream,
+                      const char*       routine,
+                      const int*        devInfo,
+                      int               count)
+    {
+        if(callback)
+        {
+            request* req   = new request{this, handle, routine, callback, user_data};
+            req->count     = std::max(count, 0);
+            hipError_t err = acquire(req);
+            if(err == hipSuccess && req->count > 0)
+                err = hipMemcpyAsync(req->values,
+                                     devInfo,
+                                     sizeof(int) * req->count,
+                                     hipMemcpyDeviceToHost,
+                                     stream);
+            if(err == hipSuccess)
+                err = hipStreamAddCallback(stream, run, req, 0);
+            if(err != hipSuccess)
+            {
+                release(req);
+                delete req;
+                return err;
+            }
+
+            pending++;
+        }
+
+        if(record)
+            return hipEventRecord(event, stream);
+        return hipSuccess;
+    }
+
+private:
+    struct buffer
+    {
+        int* values;
+        int  capacity;
+    };
+
+    struct request
+    {
+        hipsolver_completion*         owner;
+        hipsolverHandle_t             handle;
+        const char*                   routine;
+        hipsolverCompletionCallback_t callback;
+        void*                         user_data;
+        int                           count    = 0;
+        int*                          values   = nullptr;
+        int                           capacity = 0;
+    };
+
+    // pinned buffers that are not in use by a pending callback
+    std::mutex          mutex;
+    std::vector<buffer> buffers;
+    std::atomic<int>    pending{0};
+
+    // takes the smallest free buffer that holds the info values of req, or allocates one
+    hipError_t acquire(request* req)
+    {
+        if(req->count == 0)
+            return hipSuccess;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        best = buffers.end();
+            for(auto it = buffers.begin(); it != buffers.end(); ++it)
+                if(it->capacity >= req->count
+                   && (best == buffers.end() || it->capacity < best->capacity))
+                    best = it;
+
+            if(best != buffers.end())
+            {
+                req->values   = best->values;
+                req->capacity = best->capacity;
+                buffers.erase(best);
+                return hipSuccess;
+            }
+        }
+
+        int        capacity = std::max(req->count, 64);
+        hipError_t err      = hipHostMalloc((void**)&req->values, sizeof(int) * capacity);
+        if(err != hipSuccess)
+        {
+            req->values = nullptr;
+            return err;
+        }
+
+        req->capacity = capacity;
+        return hipSuccess;
+    }
+
+    void release(request* req)
+    {
+        if(!req->values)
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.push_back({req->values, req->capacity});
+    }
+
+    static void run(hipStream_t stream, hipError_t status, void* data)
+    {
+        request* req = (request*)data;
+
+        // the info values are unknown if the stream failed before they were copied
+        const int* info = (status == hipSuccess) ? req->values : nullptr;
+        req->callback(req->handle, req->routine, info, req->count, req->user_data);
+
+        hipsolver_completion* owner = req->owner;
+        owner->release(req);
+        delete req;
+        owner->pending--;
+    }
+};
@@ -0,0 +1,394 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_host.hpp"
+#include "hipsolver_ooc.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Estimates of the reciprocal condition number of a matrix from its factors, as by LAPACK
+ * gecon and pocon.
+ *
+ * The 1-norm of the inverse is estimated by the iteration of Hager and Higham of LAPACK xLACN2.
+ * Every step multiplies a vector by A^-1 or A^-H, which takes two triangular solves with the
+ * factors on the device, and the host chooses the next vector from the product. The steps of
+ * the matrices of a batch are taken together, so that a call makes at most eleven round trips
+ * of n entries per matrix, whatever the batch size, and the factors never leave the device. The
+ * row interchanges of getrf do not change the 1-norm of the inverse, so they are not needed,
+ * and the infinity-norm of A^-1 is the 1-norm of A^-H.
+ *
+ * Unlike xLATRS, the solves are not scaled to avoid overflow; an estimate that overflows, or
+ * that is not a number, gives rcond = 0. The triangular solves of the back-end are reached
+ * through the Blas policy. The call synchronizes with the stream of the handle.
+ */
+
+/*! \brief Estimate of the 1-norm of a matrix B of order n, computed from the products by B and
+ *  B^H that it requests, with the reverse communication of LAPACK xLACN2.
+ *
+ *  After start, and after each call to step, x holds the vector to multiply by B if kase is 1,
+ *  or by B^H if kase is 2, and must be replaced by the product before the next step. est holds
+ *  the estimate once kase is 0.
+ */
+template <typename H>
+struct hipsolver_lacn2
+{
+    using S = decltype(hipsolver_host_real(H()));
+
+    static constexpr bool is_real = std::is_same<H, S>::value;
+    static constexpr int  itmax   = 5;
+
+    int              n;
+    std::vector<H>   x;
+    std::vector<int> isgn; // the signs of the previous real sign vector
+    S                est  = 0;
+    int              kase = 0;
+    int              jump = 0;
+    int              iter = 0;
+    int              j    = 0;
+
+    explicit hipsolver_lacn2(int n)
+        : n(n)
+        , x(n)
+        , isgn(n)
+    {
+    }
+
+    void start()
+    {
+        std::fill(x.begin(), x.end(), H(S(1) / n));
+        kase = 1;
+        jump = 1;
+    }
+
+    void step()
+    {
+        switch(jump)
+        {
+        case 1:
+            if(n == 1)
+            {
+                est  = std::abs(x[0]);
+                kase = 0;
+                return;
+            }
+            est = sum();
+            signs();
+            kase = 2;
+            jump = 2;
+            return;
+        case 2:
+            j    = argmax();
+            iter = 2;
+            unit();
+            return;
+        case 3:
+        {
+            S estold = est;
+            est      = sum();
+            // a repeated real sign vector, or no growth of the estimate, ends the iteration
+            if((is_real && same_signs()) || est <= estold)
+                alternate();
+            else
+            {
+                signs();
+                kase = 2;
+                jump = 4;
+            }
+            return;
+        }
+        case 4:
+        {
+            int jlast = j;
+            j         = argmax();
+            S xlast   = is_real ? hipsolver_host_real(x[jlast]) : std::abs(x[jlast]);
+            if(xlast != std::abs(x[j]) && iter < itmax)
+            {
+                iter++;
+                unit();
+            }
+            else
+                alternate();
+            return;
+        }
+        default:
+            // the alternative estimate of Higham guards against the failures of the iteration
+            est  = std::max(est, 2 * (sum() / (3 * n)));
+            kase = 0;
+            return;
+        }
+    }
+
+private:
+    S sum() const
+    {
+        S s = 0;
+        for(int i = 0; i < n; i++)
+            s += std::abs(x[i]);
+        return s;
+    }
+
+    int argmax() const
+    {
+        int k = 0;
+        for(int i = 1; i < n; i++)
+            if(std::abs(x[i]) > std::abs(x[k]))
+                k = i;
+        return k;
+    }
+
+    void signs()
+    {
+        for(int i = 0; i < n; i++)
+        {
+            S a  = std::abs(x[i]);
+            x[i] = is_real ? H(hipsolver_host_real(x[i]) >= 0 ? 1 : -1)
+                           : (a > std::numeric_limits<S>::min() ? x[i] / a : H(1));
+            isgn[i] = hipsolver_host_real(x[i]) >= 0 ? 1 : -1;
+        }
+    }
+
+    bool same_signs() const
+    {
+        for(int i = 0; i < n; i++)
+            if((hipsolver_host_real(x[i]) >= 0 ? 1 : -1) != isgn[i])
+                return false;
+        return true;
+    }
+
+    // x = e_j, and B * x is requested
+    void unit()
+    {
+        std::fill(x.begin(), x.end(), H(0));
+        x[j] = 1;
+        kase = 1;
+        jump = 3;
+    }
+
+    void alternate()
+    {
+        S altsgn = 1;
+        for(int i = 0; i < n; i++)
+        {
+            x[i]   = altsgn * (1 + S(i) / (n - 1));
+            altsgn = -altsgn;
+        }
+        kase = 1;
+        jump = 5;
+    }
+};
+
+/*! \brief Returns in lwork the size of the workspace of the estimates of batch_count matrices of
+ *  order n, in the units of the work arrays of the back-end. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_con_bufferSize(
+    hipsolverHandle_t handle, int n, int lda, int* lwork, int batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(n, 1) || !lwork || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    size_t unit = Blas::work_size(1, sizeof(T));
+    size_t size = (sizeof(T) * n * batch_count + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_gecon_bufferSize(
+    hipsolverHandle_t handle, hipsolverNormType_t norm, int n, int lda, int* lwork, int batch_count)
+{
+    if(handle && norm != HIPSOLVER_NORM_ONE && norm != HIPSOLVER_NORM_INF)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    return hipsolver_con_bufferSize<Blas, T>(handle, n, lda, lwork, batch_count);
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_pocon_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, int lda, int* lwork, int batch_count)
+{
+    if(handle && uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    return hipsolver_con_bufferSize<Blas, T>(handle, n, lda, lwork, batch_count);
+}
+
+/*! \brief Estimates the reciprocal condition numbers rcond[b] of batch_count matrices of order
+ *  n, in the 1-norm if one_norm is true and in the infinity-norm otherwise, given the norms
+ *  anorm[b] of the matrices. anorm and rcond are in host memory.
+ *
+ *  solve(b, conj, x) replaces the device vector x by A_b^-1 * x if conj is false, and by
+ *  A_b^-H * x if conj is true, on the stream of handle.
+ */
+template <typename Blas, typename T, typename S, typename F>
+hipsolverStatus_t hipsolver_con(hipsolverHandle_t handle,
+                                bool              one_norm,
+                                int               n,
+                                int               lda,
+                                const S*          anorm,
+                                S*                rcond,
+                                T*                work,
+                                int               lwork,
+                                int               batch_count,
+                                F                 solve)
+{
+    using H = typename hipsolver_host_type<T>::type;
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(n, 1) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && (!anorm || !rcond))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    for(int b = 0; b < batch_count; b++)
+        if(!(anorm[b] >= 0))
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    for(int b = 0; b < batch_count; b++)
+        rcond[b] = n == 0 ? 1 : 0;
+    if(n == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    if(!work || lwork < 0 || Blas::work_size(lwork, sizeof(T)) < sizeof(T) * n * batch_count)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    hipsolver_forbid_capture(stream);
+
+    // the estimate of B = A^-1 requests A^-1 for kase 1; that of B = A^-H, for kase 2
+    int                             kase1 = one_norm ? 1 : 2;
+    std::vector<hipsolver_lacn2<H>> est(batch_count, hipsolver_lacn2<H>(n));
+    for(int b = 0; b < batch_count; b++)
+        if(anorm[b] > 0)
+            est[b].start();
+
+    bool pending = true;
+    while(pending)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(est[b].kase == 0)
+                continue;
+
+            T* x = work + size_t(b) * n;
+            if(hipMemcpyAsync(x, est[b].x.data(), sizeof(T) * n, hipMemcpyHostToDevice, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            status = solve(b, est[b].kase != kase1, x);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            if(hipMemcpyAsync(est[b].x.data(), x, sizeof(T) * n, hipMemcpyDeviceToHost, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        if(hipStreamSynchronize(stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        pending = false;
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(est[b].kase == 0)
+                continue;
+            est[b].step();
+            pending = pending || est[b].kase != 0;
+        }
+    }
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        S ainvnm = est[b].est;
+        if(anorm[b] > 0 && ainvnm > 0 && std::isfinite(ainvnm))
+            rcond[b] = (1 / ainvnm) / anorm[b];
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Estimates the reciprocal condition numbers of batch_count general matrices from the
+ *  LU factors computed by getrf, whose device addresses are in the host array A. */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_gecon(hipsolverHandle_t   handle,
+                                  hipsolverNormType_t norm,
+                                  int                 n,
+                                  T* const*           A,
+                                  int                 lda,
+                                  const S*            anorm,
+                                  S*                  rcond,
+                                  T*                  work,
+                                  int                 lwork,
+                                  int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(norm != HIPSOLVER_NORM_ONE && norm != HIPSOLVER_NORM_INF)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    const hipsolverFillMode_t  lower = HIPSOLVER_FILL_MODE_LOWER;
+    const hipsolverFillMode_t  upper = HIPSOLVER_FILL_MODE_UPPER;
+    const hipsolverOperation_t opN   = HIPSOLVER_OP_N;
+    const hipsolverOperation_t opC   = hipsolver_ooc_op_c<T>();
+
+    // A = P * L * U, with L unit lower triangular
+    auto solve = [&](int b, bool conj, T* x) {
+        hipsolverStatus_t status
+            = conj ? Blas::trsv(handle, upper, opC, false, n, A[b], lda, x)
+                   : Blas::trsv(handle, lower, opN, true, n, A[b], lda, x);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        return conj ? Blas::trsv(handle, lower, opC, true, n, A[b], lda, x)
+                    : Blas::trsv(handle, upper, opN, false, n, A[b], lda, x);
+    };
+    bool one_norm = norm == HIPSOLVER_NORM_ONE;
+    return hipsolver_con<Blas>(
+        handle, one_norm, n, lda, anorm, rcond, work, lwork, batch_count, solve);
+}
+
+/*! \brief Estimates the reciprocal condition numbers in the 1-norm of batch_count Hermitian
+ *  positive definite matrices from the Cholesky factors of uplo computed by potrf, whose device
+ *  addresses are in the host array A. */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_pocon(hipsolverHandle_t   handle,
+                                  hipsolverFillMode_t uplo,
+                                  int                 n,
+                                  T* const*           A,
+                                  int                 lda,
+                                  const S*            anorm,
+                                  S*                  rcond,
+                                  T*                  work,
+                                  int                 lwork,
+                                  int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // A = U^H * U or A = L * L^H, so that A^-1 = A^-H
+    const hipsolverOperation_t opC    = hipsolver_ooc_op_c<T>();
+    const hipsolverOperation_t first  = uplo == HIPSOLVER_FILL_MODE_UPPER ? opC : HIPSOLVER_OP_N;
+    const hipsolverOperation_t second = uplo == HIPSOLVER_FILL_MODE_UPPER ? HIPSOLVER_OP_N : opC;
+
+    auto solve = [&](int b, bool, T* x) {
+        hipsolverStatus_t status = Blas::trsv(handle, uplo, first, false, n, A[b], lda, x);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        return Blas::trsv(handle, uplo, second, false, n, A[b], lda, x);
+    };
+    return hipsolver_con<Blas>(handle, true, n, lda, anorm, rcond, work, lwork, batch_count, solve);
+}
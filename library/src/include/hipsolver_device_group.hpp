@@ -0,0 +1,83 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Distribution of the batched functions of a handle over the devices of a hipsolverMg handle,
+ * set as its device group by hipsolverSetDeviceGroup.
+ *
+ * Device d of a group of ndev devices solves the problems first(d) to first(d + 1) - 1 of the
+ * batch, a contiguous slice of batch_count / ndev problems rounded up or down, with the handle
+ * and the stream that the group holds for it. The slices of the arrays of pointers, pivots and
+ * infos are read in place, so these arrays must be accessible from every device of the group,
+ * as managed memory or through peer access, and the matrices of a slice are best placed on the
+ * device that solves it.
+ *
+ * The streams of the devices wait for an event recorded on the stream of the handle, and the
+ * stream of the handle waits for the events recorded on theirs once their slices are enqueued,
+ * so that the call is ordered with the other work of the handle without synchronizing the host.
+ */
+
+/*! \brief Index of the first problem of the batch solved by device d of a group of ndev. */
+inline int hipsolver_device_group_first(int batch_count, int ndev, int d)
+{
+    return int(int64_t(batch_count) * d / ndev);
+}
+
+/*! \brief Calls launch(device, first, count) for the slice of each device of a group, with the
+ *  device current, ordered after the work enqueued on stream, and makes stream wait for them.
+ *
+ *  Device has the members id, stream and done, an event of the device. start is an event of the
+ *  device of stream, which is current on entry and on exit. The slice of every device is
+ *  launched, even if it is empty, so that each back-end call checks its arguments.
+ */
+template <typename Device, typename F>
+hipsolverStatus_t hipsolver_device_group_run(hipStream_t          stream,
+                                             hipEvent_t           start,
+                                             std::vector<Device>& devices,
+                                             int                  batch_count,
+                                             F                    launch)
+{
+    if(devices.empty())
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    hipsolver_forbid_capture(stream);
+
+    int current;
+    if(hipGetDevice(&current) != hipSuccess || hipEventRecord(start, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    int               ndev    = int(devices.size());
+    int               reached = 0;
+    hipsolverStatus_t status  = HIPSOLVER_STATUS_SUCCESS;
+    for(; reached < ndev && status == HIPSOLVER_STATUS_SUCCESS; reached++)
+    {
+        Device& dev   = devices[reached];
+        int     first = hipsolver_device_group_first(batch_count, ndev, reached);
+        int     count = hipsolver_device_group_first(batch_count, ndev, reached + 1) - first;
+        if(hipSetDevice(dev.id) != hipSuccess
+           || hipStreamWaitEvent(dev.stream, start, 0) != hipSuccess)
+            status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+        else
+            status = launch(dev, first, count);
+        if(status == HIPSOLVER_STATUS_SUCCESS && hipEventRecord(dev.done, dev.stream) != hipSuccess)
+            status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    // the stream also waits for the devices reached before a failure, so that the arrays of the
+    // call are not released while they are still in use
+    if(hipSetDevice(current) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    for(int d = 0; d < reached; d++)
+        if(hipStreamWaitEvent(stream, devices[d].done, 0) != hipSuccess)
+            status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return status;
+}
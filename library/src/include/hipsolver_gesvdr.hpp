@@ -0,0 +1,635 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_ooc.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+#include <random>
+#include <vector>
+
+/*
+ * Randomized truncated SVD, gesvdr, of Halko, Martinsson and Tropp.
+ *
+ * The range of the m-by-n matrix A is sampled by Y = A * Omega, with a Gaussian n-by-l test
+ * matrix Omega of l = k + p columns, and refined by niters power iterations Y = A * A^H * Y, each
+ * of which orthonormalizes its intermediate results by geqrf and orgqr. With Q an orthonormal
+ * basis of Y, A is approximated by Q * B with B = Q^H * A, and the SVD of the small l-by-n
+ * matrix B, computed by the in-core gesvd, gives the k largest singular triplets of A. gesvd is
+ * applied to the tall n-by-l matrix B^H, which every back-end supports. A is only read by gemm,
+ * so the work is O(m * n * l) per pass over A, and the workspace O((m + n) * l).
+ *
+ * The updates of the Blas policy compute C = C - op(A) * op(B), so every product is made into a
+ * zeroed matrix and is negated. The signs cancel in the left singular vectors, which are
+ * computed as the product of two negated factors, and are absorbed by the orthonormalizations
+ * elsewhere. The test matrix is generated on the host with a fixed seed, so that the results are
+ * reproducible, and copied to the device, so the call synchronizes with the stream of the handle.
+ */
+
+/******************** IN-CORE DISPATCH ********************/
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+{
+    return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+{
+    return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    return hipsolverCgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+{
+    return hipsolverZgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                float*            tau,
+                                                float*            work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                double*           tau,
+                                                double*           work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                hipsolverComplex* A,
+                                                int               lda,
+                                                hipsolverComplex* tau,
+                                                hipsolverComplex* work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverCgeqrf(handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_geqrf(hipsolverHandle_t       handle,
+                                                int                     m,
+                                                int                     n,
+                                                hipsolverDoubleComplex* A,
+                                                int                     lda,
+                                                hipsolverDoubleComplex* tau,
+                                                hipsolverDoubleComplex* work,
+                                                int                     lwork,
+                                                int*                    devInfo)
+{
+    return hipsolverZgeqrf(handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork)
+{
+    return hipsolverSorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, int* lwork)
+{
+    return hipsolverDorgqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr_bufferSize(hipsolverHandle_t handle,
+                                                           int               m,
+                                                           int               n,
+                                                           int               k,
+                                                           hipsolverComplex* A,
+                                                           int               lda,
+                                                           hipsolverComplex* tau,
+                                                           int*              lwork)
+{
+    return hipsolverCungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr_bufferSize(hipsolverHandle_t       handle,
+                                                           int                     m,
+                                                           int                     n,
+                                                           int                     k,
+                                                           hipsolverDoubleComplex* A,
+                                                           int                     lda,
+                                                           hipsolverDoubleComplex* tau,
+                                                           int*                    lwork)
+{
+    return hipsolverZungqr_bufferSize(handle, m, n, k, A, lda, tau, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                int               k,
+                                                float*            A,
+                                                int               lda,
+                                                float*            tau,
+                                                float*            work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverSorgqr(handle, m, n, k, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                int               k,
+                                                double*           A,
+                                                int               lda,
+                                                double*           tau,
+                                                double*           work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverDorgqr(handle, m, n, k, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                int               k,
+                                                hipsolverComplex* A,
+                                                int               lda,
+                                                hipsolverComplex* tau,
+                                                hipsolverComplex* work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverCungqr(handle, m, n, k, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_orgqr(hipsolverHandle_t       handle,
+                                                int                     m,
+                                                int                     n,
+                                                int                     k,
+                                                hipsolverDoubleComplex* A,
+                                                int                     lda,
+                                                hipsolverDoubleComplex* tau,
+                                                hipsolverDoubleComplex* work,
+                                                int                     lwork,
+                                                int*                    devInfo)
+{
+    return hipsolverZungqr(handle, m, n, k, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           float*            A,
+                                                           int*              lwork)
+{
+    return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           double*           A,
+                                                           int*              lwork)
+{
+    return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd_bufferSize(hipsolverHandle_t handle,
+                                                           signed char       jobu,
+                                                           signed char       jobv,
+                                                           int               m,
+                                                           int               n,
+                                                           hipsolverComplex* A,
+                                                           int*              lwork)
+{
+    return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd_bufferSize(hipsolverHandle_t       handle,
+                                                           signed char             jobu,
+                                                           signed char             jobv,
+                                                           int                     m,
+                                                           int                     n,
+                                                           hipsolverDoubleComplex* A,
+                                                           int*                    lwork)
+{
+    return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                float*            S,
+                                                float*            U,
+                                                int               ldu,
+                                                float*            V,
+                                                int               ldv,
+                                                float*            work,
+                                                int               lwork,
+                                                float*            rwork,
+                                                int*              devInfo)
+{
+    return hipsolverSgesvd(handle,
+                           jobu,
+                           jobv,
+                           m,
+                           n,
+                           A,
+                           lda,
+                           S,
+                           U,
+                           ldu,
+                           V,
+                           ldv,
+                           work,
+                           lwork,
+                           rwork,
+                           devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                double*           S,
+                                                double*           U,
+                                                int               ldu,
+                                                double*           V,
+                                                int               ldv,
+                                                double*           work,
+                                                int               lwork,
+                                                double*           rwork,
+                                                int*              devInfo)
+{
+    return hipsolverDgesvd(handle,
+                           jobu,
+                           jobv,
+                           m,
+                           n,
+                           A,
+                           lda,
+                           S,
+                           U,
+                           ldu,
+                           V,
+                           ldv,
+                           work,
+                           lwork,
+                           rwork,
+                           devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd(hipsolverHandle_t handle,
+                                                signed char       jobu,
+                                                signed char       jobv,
+                                                int               m,
+                                                int               n,
+                                                hipsolverComplex* A,
+                                                int               lda,
+                                                float*            S,
+                                                hipsolverComplex* U,
+                                                int               ldu,
+                                                hipsolverComplex* V,
+                                                int               ldv,
+                                                hipsolverComplex* work,
+                                                int               lwork,
+                                                float*            rwork,
+                                                int*              devInfo)
+{
+    return hipsolverCgesvd(handle,
+                           jobu,
+                           jobv,
+                           m,
+                           n,
+                           A,
+                           lda,
+                           S,
+                           U,
+                           ldu,
+                           V,
+                           ldv,
+                           work,
+                           lwork,
+                           rwork,
+                           devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_gesvdr_gesvd(hipsolverHandle_t       handle,
+                                                signed char             jobu,
+                                                signed char             jobv,
+                                                int                     m,
+                                                int                     n,
+                                                hipsolverDoubleComplex* A,
+                                                int                     lda,
+                                                double*                 S,
+                                                hipsolverDoubleComplex* U,
+                                                int                     ldu,
+                                                hipsolverDoubleComplex* V,
+                                                int                     ldv,
+                                                hipsolverDoubleComplex* work,
+                                                int                     lwork,
+                                                double*                 rwork,
+                                                int*                    devInfo)
+{
+    return hipsolverZgesvd(handle,
+                           jobu,
+                           jobv,
+                           m,
+                           n,
+                           A,
+                           lda,
+                           S,
+                           U,
+                           ldu,
+                           V,
+                           ldv,
+                           work,
+                           lwork,
+                           rwork,
+                           devInfo);
+}
+
+/******************** GESVDR ********************/
+/*! \brief Layout of the workspace of gesvdr, with every part aligned to 256 bytes.
+ *
+ *  Q is the m-by-l basis of the range, Z the n-by-l test matrix and its products, Uc and VT the
+ *  singular vectors of B^H, and s and e the singular values and superdiagonal of gesvd.
+ */
+struct hipsolver_gesvdr_layout
+{
+    int    l     = 0;
+    int    lwork = 0; // the workspace of the in-core functions, in the units of the back-end
+    size_t q;
+    size_t z;
+    size_t uc;
+    size_t vt;
+    size_t tau;
+    size_t s;
+    size_t e;
+    size_t info;
+    size_t work;
+    size_t size;
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+};
+
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_gesvdr_layout_init(hipsolverHandle_t        handle,
+                                               signed char              jobu,
+                                               signed char              jobv,
+                                               int                      m,
+                                               int                      n,
+                                               int                      k,
+                                               int                      p,
+                                               hipsolver_gesvdr_layout* layout)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if((jobu != 'S' && jobu != 'N') || (jobv != 'S' && jobv != 'N'))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || k < 0 || p < 0 || int64_t(k) + p > std::min(m, n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the in-core functions are sized for the orthonormalizations of Q and Z, and for the SVD of
+    // B^H, whose left singular vectors are the right singular vectors of A
+    int l = k + p, lwork = 0, lw = 0;
+    T*  null = nullptr;
+    if(k > 0)
+    {
+        hipsolverStatus_t status;
+        status = hipsolver_gesvdr_geqrf_bufferSize(handle, m, l, null, m, &lw);
+        lwork  = std::max(lwork, lw);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolver_gesvdr_geqrf_bufferSize(handle, n, l, null, n, &lw);
+        lwork = std::max(lwork, lw);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolver_gesvdr_orgqr_bufferSize(handle, m, l, l, null, m, null, &lw);
+        lwork = std::max(lwork, lw);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolver_gesvdr_orgqr_bufferSize(handle, n, l, l, null, n, null, &lw);
+        lwork = std::max(lwork, lw);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolver_gesvdr_gesvd_bufferSize(handle, jobv, jobu, n, l, null, &lw);
+        lwork = std::max(lwork, lw);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    size_t t      = sizeof(T);
+    layout->l     = l;
+    layout->lwork = lwork;
+    layout->q     = 0;
+    layout->z     = layout->q + layout->align(t * m * l);
+    layout->uc    = layout->z + layout->align(t * n * l);
+    layout->vt    = layout->uc + (jobv == 'S' ? layout->align(t * n * l) : 0);
+    layout->tau   = layout->vt + (jobu == 'S' ? layout->align(t * l * l) : 0);
+    layout->s     = layout->tau + layout->align(t * l);
+    layout->e     = layout->s + layout->align(sizeof(S) * l);
+    layout->info  = layout->e + layout->align(sizeof(S) * l);
+    layout->work  = layout->info + layout->align(sizeof(int));
+    layout->size  = layout->work + layout->align(Blas::work_size(lwork, t));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_gesvdr_bufferSize(hipsolverHandle_t handle,
+                                              signed char       jobu,
+                                              signed char       jobv,
+                                              int               m,
+                                              int               n,
+                                              int               k,
+                                              int               p,
+                                              int               niters,
+                                              int               lda,
+                                              int               ldu,
+                                              int               ldv,
+                                              int*              lwork)
+{
+    hipsolver_gesvdr_layout layout;
+    hipsolverStatus_t       status
+        = hipsolver_gesvdr_layout_init<Blas, T, S>(handle, jobu, jobv, m, n, k, p, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(niters < 0 || lda < std::max(m, 1) || (jobu == 'S' && ldu < std::max(m, 1))
+       || (jobv == 'S' && ldv < std::max(n, 1)) || !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    size_t unit = Blas::work_size(1, sizeof(T));
+    size_t size = (layout.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Computes the k largest singular values of A in S, and their left and right singular
+ *  vectors in the columns of U and V if jobu and jobv are 'S'. devInfo receives the info of gesvd.
+ */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_gesvdr(hipsolverHandle_t handle,
+                                   signed char       jobu,
+                                   signed char       jobv,
+                                   int               m,
+                                   int               n,
+                                   int               k,
+                                   int               p,
+                                   int               niters,
+                                   T*                A,
+                                   int               lda,
+                                   S*                Sv,
+                                   T*                U,
+                                   int               ldu,
+                                   T*                V,
+                                   int               ldv,
+                                   T*                work,
+                                   int               lwork,
+                                   int*              devInfo)
+{
+    hipsolver_gesvdr_layout layout;
+    hipsolverStatus_t       status
+        = hipsolver_gesvdr_layout_init<Blas, T, S>(handle, jobu, jobv, m, n, k, p, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(niters < 0 || lda < std::max(m, 1) || (jobu == 'S' && ldu < std::max(m, 1))
+       || (jobv == 'S' && ldv < std::max(n, 1)) || !devInfo)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(k > 0 && (!A || !Sv || (jobu == 'S' && !U) || (jobv == 'S' && !V)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(lwork < 0 || Blas::work_size(lwork, sizeof(T)) < layout.size || !work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(k == 0)
+    {
+        if(hipMemsetAsync(devInfo, 0, sizeof(int), stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+    hipsolver_forbid_capture(stream);
+
+    const hipsolverOperation_t opN = HIPSOLVER_OP_N;
+    const hipsolverOperation_t opC = hipsolver_ooc_op_c<T>();
+
+    const int l     = layout.l;
+    char*     base  = (char*)work;
+    T*        Q     = (T*)(base + layout.q);
+    T*        Z     = (T*)(base + layout.z);
+    T*        Uc    = jobv == 'S' ? (T*)(base + layout.uc) : nullptr;
+    T*        VT    = jobu == 'S' ? (T*)(base + layout.vt) : nullptr;
+    T*        tau   = (T*)(base + layout.tau);
+    S*        s     = (S*)(base + layout.s);
+    S*        e     = (S*)(base + layout.e);
+    int*      info  = (int*)(base + layout.info);
+    T*        cwork = (T*)(base + layout.work);
+
+    // the entries of the test matrix are independent standard normal real and imaginary parts
+    std::vector<S>              omega(size_t(n) * l * (sizeof(T) / sizeof(S)));
+    std::mt19937                gen(0);
+    std::normal_distribution<S> normal;
+    for(S& x : omega)
+        x = normal(gen);
+    if(hipMemcpyAsync(Z, omega.data(), sizeof(S) * omega.size(), hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // X = orth(X), for X with rows rows and l columns
+    auto orth = [&](T* X, int rows) {
+        hipsolverStatus_t st
+            = hipsolver_gesvdr_geqrf(handle, rows, l, X, rows, tau, cwork, layout.lwork, info);
+        if(st == HIPSOLVER_STATUS_SUCCESS)
+            st = hipsolver_gesvdr_orgqr(
+                handle, rows, l, l, X, rows, tau, cwork, layout.lwork, info);
+        return st;
+    };
+
+    // C = -op(A) * X, for C with rows rows and l columns
+    auto product = [&](hipsolverOperation_t op, const T* X, int ldx, T* C, int rows) {
+        if(hipMemsetAsync(C, 0, sizeof(T) * rows * l, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return Blas::gemm(handle, op, opN, rows, l, op == opN ? n : m, A, lda, X, ldx, C, rows);
+    };
+
+    // Y = A * Omega, and the power iterations Y = A * A^H * Y
+    status = product(opN, Z, n, Q, m);
+    for(int i = 0; i < niters && status == HIPSOLVER_STATUS_SUCCESS; i++)
+    {
+        status = orth(Q, m);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = product(opC, Q, m, Z, n);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = orth(Z, n);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = product(opN, Z, n, Q, m);
+    }
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = orth(Q, m);
+
+    // Z = -B^H = -A^H * Q = Uc * s * VT, so that A = Q * B = (-Q * VT^H) * s * Uc^H
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = product(opC, Q, m, Z, n);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = hipsolver_gesvdr_gesvd(
+            handle, jobv, jobu, n, l, Z, n, s, Uc, n, VT, l, cwork, layout.lwork, e, devInfo);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(hipMemcpyAsync(Sv, s, sizeof(S) * k, hipMemcpyDeviceToDevice, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    size_t t = sizeof(T);
+    if(jobv == 'S'
+       && hipMemcpy2DAsync(V, t * ldv, Uc, t * n, t * n, k, hipMemcpyDeviceToDevice, stream)
+              != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    if(jobu == 'S')
+    {
+        if(hipMemset2DAsync(U, t * ldu, 0, t * m, k, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        status = Blas::gemm(handle, opN, opC, m, k, l, Q, m, VT, l, U, ldu);
+    }
+    return status;
+}
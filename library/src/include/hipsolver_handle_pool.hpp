@@ -0,0 +1,249 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*! \brief Handles created by hipsolverCreateHandlePool and lent to threads by
+ *  hipsolverHandlePoolAcquire.
+ *
+ *  Every thread that holds handles of the pool has its own non-blocking stream, on the device
+ *  of the pool. When a thread releases the last of its handles, its stream goes back to the idle
+ *  streams, to be given to the next thread that acquires a handle, so that threads that come
+ *  and go do not leave a stream each behind them.
+ *
+ *  A released handle keeps its library state, including its workspace, and records an event on
+ *  its stream; the next thread to acquire the handle makes its own stream wait for that event,
+ *  so that the work enqueued before the release is finished before the workspace is used
+ *  again.
+ */
+class hipsolver_handle_pool
+{
+    int    m_device;
+    size_t m_workspace;
+
+    std::mutex                                        m_mutex;
+    std::unordered_map<hipsolverHandle_t, hipEvent_t> m_handles;
+    std::vector<hipsolverHandle_t>                    m_idle;
+    std::vector<hipStream_t>                          m_idle_streams;
+
+    /*! \brief Stream of a thread and the number of handles it holds. */
+    struct thread_stream_t
+    {
+        hipStream_t stream;
+        int         handles;
+    };
+    std::unordered_map<std::thread::id, thread_stream_t>   m_streams;
+    std::unordered_map<hipsolverHandle_t, std::thread::id> m_lent;
+
+    /*! \brief Makes the device of the pool current until the guard is destroyed. */
+    class device_guard
+    {
+        int m_previous;
+
+    public:
+        explicit device_guard(int device)
+        {
+            hipGetDevice(&m_previous);
+            if(device != m_previous)
+                hipSetDevice(device);
+        }
+        ~device_guard()
+        {
+            hipSetDevice(m_previous);
+        }
+    };
+
+    /*! \brief Creates a handle with its release event and adds it to the idle handles. */
+    hipsolverStatus_t grow()
+    {
+        device_guard guard(m_device);
+
+        hipsolverHandle_t handle;
+        hipsolverStatus_t status = hipsolverCreate(&handle);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        // reserving the workspace up front keeps the first calls from allocating
+        if(m_workspace > 0)
+            status = hipsolverReserveWorkspace(handle, m_workspace);
+
+        hipEvent_t event = nullptr;
+        if(status == HIPSOLVER_STATUS_SUCCESS
+           && hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+            status = HIPSOLVER_STATUS_ALLOC_FAILED;
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+        {
+            hipsolverDestroy(handle);
+            return status;
+        }
+
+        m_handles[handle] = event;
+        m_idle.push_back(handle);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    /*! \brief Returns the stream of the calling thread, taken from the idle streams or created
+     *  if it has none. */
+    hipsolverStatus_t thread_stream(hipStream_t* stream)
+    {
+        auto it = m_streams.find(std::this_thread::get_id());
+        if(it != m_streams.end())
+        {
+            *stream = it->second.stream;
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+
+        if(!m_idle_streams.empty())
+        {
+            *stream = m_idle_streams.back();
+            m_idle_streams.pop_back();
+        }
+        else
+        {
+            device_guard guard(m_device);
+            if(hipStreamCreateWithFlags(stream, hipStreamNonBlocking) != hipSuccess)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+        }
+
+        m_streams[std::this_thread::get_id()] = {*stream, 0};
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    /*! \brief Returns the stream of a thread that holds no handle to the idle streams. */
+    void idle_stream(std::unordered_map<std::thread::id, thread_stream_t>::iterator it)
+    {
+        if(it->second.handles > 0)
+            return;
+        m_idle_streams.push_back(it->second.stream);
+        m_streams.erase(it);
+    }
+
+public:
+    explicit hipsolver_handle_pool(size_t workspace)
+        : m_device(0)
+        , m_workspace(workspace)
+    {
+        hipGetDevice(&m_device);
+    }
+
+    hipsolver_handle_pool(const hipsolver_handle_pool&) = delete;
+    hipsolver_handle_pool& operator=(const hipsolver_handle_pool&) = delete;
+
+    ~hipsolver_handle_pool()
+    {
+        device_guard guard(m_device);
+
+        // hipsolverDestroy and hipStreamDestroy wait for any work still using the handles
+        for(auto& h : m_handles)
+        {
+            hipsolverDestroy(h.first);
+            hipEventDestroy(h.second);
+        }
+        for(auto& s : m_streams)
+            hipStreamDestroy(s.second.stream);
+        for(hipStream_t s : m_idle_streams)
+            hipStreamDestroy(s);
+    }
+
+    /*! \brief Creates count idle handles ahead of their first use. */
+    hipsolverStatus_t reserve(int count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for(int i = 0; i < count; i++)
+        {
+            hipsolverStatus_t status = grow();
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    /*! \brief Lends an idle handle, bound to the stream of the calling thread. A new handle is
+     *  created if all of them are in use. */
+    hipsolverStatus_t acquire(hipsolverHandle_t* handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        hipStream_t       stream;
+        hipsolverStatus_t status = thread_stream(&stream);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        auto it = m_streams.find(std::this_thread::get_id());
+        if(m_idle.empty())
+            status = grow();
+
+        // waiting for an event that was never recorded does nothing
+        hipsolverHandle_t h = status == HIPSOLVER_STATUS_SUCCESS ? m_idle.back() : nullptr;
+        if(h && hipStreamWaitEvent(stream, m_handles[h], 0) != hipSuccess)
+            status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolverSetStream(h, stream);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+        {
+            idle_stream(it);
+            return status;
+        }
+
+        it->second.handles++;
+        m_lent[h] = it->first;
+        m_idle.pop_back();
+        *handle = h;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    /*! \brief Returns a handle lent by acquire to the idle handles. */
+    hipsolverStatus_t release(hipsolverHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_handles.find(handle);
+        if(it == m_handles.end()
+           || std::find(m_idle.begin(), m_idle.end(), handle) != m_idle.end())
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        hipStream_t       stream;
+        hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        if(hipEventRecord(it->second, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        // the handle is counted for the thread that acquired it, which may not be this one
+        auto lent = m_lent.find(handle);
+        if(lent != m_lent.end())
+        {
+            auto s = m_streams.find(lent->second);
+            if(s != m_streams.end())
+            {
+                s->second.handles--;
+                idle_stream(s);
+            }
+            m_lent.erase(lent);
+        }
+
+        m_idle.push_back(handle);
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    /*! \brief Returns the number of handles created by the pool and the number of them that are
+     *  idle. */
+    void count(int* handles, int* idle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        *handles = (int)m_handles.size();
+        *idle    = (int)m_idle.size();
+    }
+};
@@ -0,0 +1,790 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_device.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Host fast path. Each kernel launch costs microseconds, and potrf, getrf
+ *    and syevd launch several, while the factorization of a matrix of order 8
+ *    takes a fraction of a microsecond on the host. When the host size of one
+ *    of these functions is set with HIPSOLVER_ADV_HOST_SIZE, problems up to
+ *    that order whose arguments the host can access, i.e. managed or
+ *    page-locked host memory, are solved by the unblocked host algorithms
+ *    below once the stream of the handle has finished the work that may
+ *    produce them. The work array is not used. While the host size is nonzero
+ *    the calls are counted by where they ran.
+ *
+ *    The back-ends do not link a host LAPACK, so the algorithms are written
+ *    with stride-one inner loops that the compiler vectorizes. Real matrices
+ *    of order up to hipsolver_host_fixed_size are instead copied to a local
+ *    tile and solved by the fixed-size solvers of hipsolver_device.hpp, which
+ *    are instantiated for each order so that their loops are fully unrolled.
+ *
+ *    The batched potrf, getrf and getrs take the host path of potrf and getrf
+ *    when all the matrices of the batch are host-accessible; getrs follows the
+ *    settings of getrf, which computes its factors.
+ * ===========================================================================
+ */
+
+/*! \brief Host size of a function and the counts of the calls made while it is nonzero. */
+struct hipsolver_host_dispatch
+{
+    int     host_size    = 0;
+    int64_t host_calls   = 0;
+    int64_t device_calls = 0;
+};
+
+/*! \brief Returns true if the host can read and write the memory at ptr, and so can the device,
+ *  as for managed and page-locked host memory. */
+inline bool hipsolver_host_accessible(const void* ptr)
+{
+    hipPointerAttribute_t attr;
+    if(hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+    {
+        // pageable host memory is not known to the runtime, and the device cannot use it
+        (void)hipGetLastError();
+        return false;
+    }
+    return attr.isManaged || attr.memoryType == hipMemoryTypeHost;
+}
+
+/*! \brief Decides whether a problem of m by n with leading dimension lda is solved on the host.
+ *
+ *  Returns true, after waiting for the work enqueued on the stream of handle, if dispatch
+ *  allows problems of that size, the stream is not being captured, and A, info and the other
+ *  non-null pointers are host-accessible. Counts the call while the host size is nonzero.
+ */
+inline bool hipsolver_host_begin(hipsolver_host_dispatch*            dispatch,
+                                 hipsolverHandle_t                   handle,
+                                 int                                 m,
+                                 int                                 n,
+                                 const void*                         A,
+                                 int                                 lda,
+                                 const int*                          info,
+                                 std::initializer_list<const void*> others = {})
+{
+    if(!dispatch || dispatch->host_size == 0)
+        return false;
+
+    bool host = m >= 1 && n >= 1 && m <= dispatch->host_size && n <= dispatch->host_size
+                && lda >= m && A && info && hipsolver_host_accessible(A)
+                && hipsolver_host_accessible(info);
+    for(const void* p : others)
+        host = host && (!p || hipsolver_host_accessible(p));
+
+    hipStream_t stream;
+    host = host && hipsolverGetStream(handle, &stream) == HIPSOLVER_STATUS_SUCCESS
+           && !hipsolver_stream_is_capturing(stream) && hipStreamSynchronize(stream) == hipSuccess;
+
+    if(host)
+        dispatch->host_calls++;
+    else
+        dispatch->device_calls++;
+    return host;
+}
+
+/*! \brief Returns the first matrix of a batch given by an array of pointers if the array and
+ *  all the matrices are host-accessible, and null otherwise. The pointers are only inspected
+ *  if dispatch allows problems of order n. */
+template <typename T>
+inline const void* hipsolver_host_batch(const hipsolver_host_dispatch* dispatch,
+                                        int                            n,
+                                        T* const                       A[],
+                                        int                            batch_count)
+{
+    if(!dispatch || n < 1 || n > dispatch->host_size || batch_count < 1 || !A
+       || !hipsolver_host_accessible(A))
+        return nullptr;
+
+    for(int b = 0; b < batch_count; b++)
+        if(!A[b] || !hipsolver_host_accessible(A[b]))
+            return nullptr;
+    return A[0];
+}
+
+/*! \brief hipsolver_host_begin for a batch given by an array of pointers. A declined batch is
+ *  counted as one call on the device. */
+template <typename T>
+inline bool hipsolver_host_begin_batched(hipsolver_host_dispatch*            dispatch,
+                                         hipsolverHandle_t                   handle,
+                                         int                                 m,
+                                         int                                 n,
+                                         T* const                            A[],
+                                         int                                 lda,
+                                         const int*                          info,
+                                         int                                 batch_count,
+                                         std::initializer_list<const void*> others = {})
+{
+    const void* A0 = hipsolver_host_batch(dispatch, std::max(m, n), A, batch_count);
+    return hipsolver_host_begin(dispatch, handle, m, n, A0, lda, info, others);
+}
+
+/*! \brief hipsolver_host_begin for getrs, which has no info: its pivots, which are required,
+ *  are checked in place of the info. Invalid right-hand sides decline the call. */
+inline bool hipsolver_host_begin_getrs(hipsolver_host_dispatch* dispatch,
+                                       hipsolverHandle_t        handle,
+                                       int                      n,
+                                       int                      nrhs,
+                                       const void*              A,
+                                       int                      lda,
+                                       const int*               ipiv,
+                                       const void*              B,
+                                       int                      ldb)
+{
+    bool valid = nrhs >= 0 && ldb >= n && B;
+    return hipsolver_host_begin(dispatch, handle, n, n, valid ? A : nullptr, lda, ipiv, {B});
+}
+
+template <typename T>
+inline bool hipsolver_host_begin_getrs(hipsolver_host_dispatch* dispatch,
+                                       hipsolverHandle_t        handle,
+                                       int                      n,
+                                       int                      nrhs,
+                                       T* const                 A[],
+                                       int                      lda,
+                                       const int*               ipiv,
+                                       T* const                 B[],
+                                       int                      ldb,
+                                       int                      batch_count)
+{
+    return hipsolver_host_begin_getrs(dispatch,
+                                      handle,
+                                      n,
+                                      nrhs,
+                                      hipsolver_host_batch(dispatch, n, A, batch_count),
+                                      lda,
+                                      ipiv,
+                                      hipsolver_host_batch(dispatch, n, B, batch_count),
+                                      ldb);
+}
+
+/*! \brief Host arithmetic type of a public type; the complex types share their layout with
+ *  std::complex. */
+template <typename T>
+struct hipsolver_host_type
+{
+    using type = T;
+};
+template <>
+struct hipsolver_host_type<hipsolverComplex>
+{
+    using type = std::complex<float>;
+};
+template <>
+struct hipsolver_host_type<hipsolverDoubleComplex>
+{
+    using type = std::complex<double>;
+};
+
+template <typename S>
+inline S hipsolver_host_conj(S x)
+{
+    return x;
+}
+template <typename S>
+inline std::complex<S> hipsolver_host_conj(std::complex<S> x)
+{
+    return std::conj(x);
+}
+
+template <typename S>
+inline S hipsolver_host_real(S x)
+{
+    return x;
+}
+template <typename S>
+inline S hipsolver_host_real(std::complex<S> x)
+{
+    return x.real();
+}
+
+// squared modulus
+template <typename S>
+inline S hipsolver_host_abs2(S x)
+{
+    return x * x;
+}
+template <typename S>
+inline S hipsolver_host_abs2(std::complex<S> x)
+{
+    return std::norm(x);
+}
+
+// modulus used to choose the pivots, as by LAPACK
+template <typename S>
+inline S hipsolver_host_abs1(S x)
+{
+    return std::abs(x);
+}
+template <typename S>
+inline S hipsolver_host_abs1(std::complex<S> x)
+{
+    return std::abs(x.real()) + std::abs(x.imag());
+}
+
+/*! \brief Unblocked Cholesky factorization. The factor of the lower triangle is computed by
+ *  columns and that of the upper triangle by rows, so that both read contiguous memory. */
+template <typename T>
+void hipsolver_host_potf2(hipsolverFillMode_t uplo, int n, T* A, int lda, int* info)
+{
+    using S = decltype(hipsolver_host_real(T()));
+
+    *info = 0;
+    for(int j = 0; j < n; j++)
+    {
+        T* Aj = A + size_t(j) * lda;
+        S  d  = hipsolver_host_real(Aj[j]);
+
+        if(uplo == HIPSOLVER_FILL_MODE_LOWER)
+        {
+            for(int k = 0; k < j; k++)
+                d -= hipsolver_host_abs2(A[j + size_t(k) * lda]);
+            if(!(d > 0))
+            {
+                *info = j + 1;
+                return;
+            }
+
+            d     = std::sqrt(d);
+            Aj[j] = d;
+            for(int k = 0; k < j; k++)
+            {
+                const T* Ak = A + size_t(k) * lda;
+                T        c  = hipsolver_host_conj(Ak[j]);
+                for(int i = j + 1; i < n; i++)
+                    Aj[i] -= Ak[i] * c;
+            }
+            for(int i = j + 1; i < n; i++)
+                Aj[i] /= d;
+        }
+        else
+        {
+            for(int k = 0; k < j; k++)
+                d -= hipsolver_host_abs2(Aj[k]);
+            if(!(d > 0))
+            {
+                *info = j + 1;
+                return;
+            }
+
+            d     = std::sqrt(d);
+            Aj[j] = d;
+            for(int i = j + 1; i < n; i++)
+            {
+                T* Ai = A + size_t(i) * lda;
+                T  s  = Ai[j];
+                for(int k = 0; k < j; k++)
+                    s -= hipsolver_host_conj(Aj[k]) * Ai[k];
+                Ai[j] = s / d;
+            }
+        }
+    }
+}
+
+/*! \brief Unblocked LU factorization with partial pivoting, or without pivoting if ipiv is
+ *  null. As by LAPACK, a zero pivot is reported in info and the factorization continues. */
+template <typename T>
+void hipsolver_host_getf2(int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    using S = decltype(hipsolver_host_real(T()));
+
+    *info = 0;
+    for(int j = 0; j < std::min(m, n); j++)
+    {
+        T* Aj = A + size_t(j) * lda;
+
+        if(ipiv)
+        {
+            int p    = j;
+            S   best = hipsolver_host_abs1(Aj[j]);
+            for(int i = j + 1; i < m; i++)
+            {
+                if(hipsolver_host_abs1(Aj[i]) > best)
+                {
+                    best = hipsolver_host_abs1(Aj[i]);
+                    p    = i;
+                }
+            }
+
+            ipiv[j] = p + 1;
+            if(p != j)
+                for(int c = 0; c < n; c++)
+                    std::swap(A[j + size_t(c) * lda], A[p + size_t(c) * lda]);
+        }
+
+        if(Aj[j] != T(0))
+        {
+            T r = T(1) / Aj[j];
+            for(int i = j + 1; i < m; i++)
+                Aj[i] *= r;
+        }
+        else if(*info == 0)
+            *info = j + 1;
+
+        for(int c = j + 1; c < n; c++)
+        {
+            T* Ac = A + size_t(c) * lda;
+            T  a  = Ac[j];
+            for(int i = j + 1; i < m; i++)
+                Ac[i] -= Aj[i] * a;
+        }
+    }
+}
+
+/*! \brief Solves op(A) * X = B with the LU factors and pivots of A computed by getf2. The
+ *  triangular solves with A read its columns, which are the rows of op(A) when transposed. */
+template <typename T>
+void hipsolver_host_getrs2(hipsolverOperation_t trans,
+                           int                  n,
+                           int                  nrhs,
+                           const T*             A,
+                           int                  lda,
+                           const int*           ipiv,
+                           T*                   B,
+                           int                  ldb)
+{
+    bool conj = trans == HIPSOLVER_OP_C;
+    auto op   = [conj](T a) { return conj ? hipsolver_host_conj(a) : a; };
+
+    for(int c = 0; c < nrhs; c++)
+    {
+        T* x = B + size_t(c) * ldb;
+        if(trans == HIPSOLVER_OP_N)
+        {
+            for(int j = 0; j < n; j++)
+                std::swap(x[j], x[ipiv[j] - 1]);
+
+            // L * U * x = P * b
+            for(int j = 0; j < n; j++)
+            {
+                const T* Aj = A + size_t(j) * lda;
+                for(int i = j + 1; i < n; i++)
+                    x[i] -= Aj[i] * x[j];
+            }
+            for(int j = n - 1; j >= 0; j--)
+            {
+                const T* Aj = A + size_t(j) * lda;
+                x[j] /= Aj[j];
+                for(int i = 0; i < j; i++)
+                    x[i] -= Aj[i] * x[j];
+            }
+        }
+        else
+        {
+            // op(U) * op(L) * P * x = b
+            for(int j = 0; j < n; j++)
+            {
+                const T* Aj = A + size_t(j) * lda;
+                T        s  = x[j];
+                for(int i = 0; i < j; i++)
+                    s -= op(Aj[i]) * x[i];
+                x[j] = s / op(Aj[j]);
+            }
+            for(int j = n - 1; j >= 0; j--)
+            {
+                const T* Aj = A + size_t(j) * lda;
+                T        s  = x[j];
+                for(int i = j + 1; i < n; i++)
+                    s -= op(Aj[i]) * x[i];
+                x[j] = s;
+            }
+
+            for(int j = n - 1; j >= 0; j--)
+                std::swap(x[j], x[ipiv[j] - 1]);
+        }
+    }
+}
+
+/*! \brief Eigenvalues, and eigenvectors if jobz is HIPSOLVER_EIG_MODE_VECTOR, of a Hermitian
+ *  matrix by the cyclic Jacobi method, which is simple and accurate at the orders of the host
+ *  path. The eigenvalues are sorted in ascending order. info is the number of off-diagonal
+ *  elements that did not converge. */
+template <typename T, typename S>
+void hipsolver_host_syevj(
+    hipsolverEigMode_t jobz, hipsolverFillMode_t uplo, int n, T* A, int lda, S* D, int* info)
+{
+    const int max_sweeps = 50;
+    const S   eps        = std::numeric_limits<S>::epsilon();
+
+    // full copy of the referenced triangle
+    std::vector<T> M(size_t(n) * n), V(size_t(n) * n, T(0));
+    S              norm = 0;
+    for(int j = 0; j < n; j++)
+    {
+        for(int i = j; i < n; i++)
+        {
+            T a = uplo == HIPSOLVER_FILL_MODE_LOWER ? A[i + size_t(j) * lda]
+                                                    : hipsolver_host_conj(A[j + size_t(i) * lda]);
+            if(i == j)
+                a = hipsolver_host_real(a);
+            M[i + size_t(j) * n] = a;
+            M[j + size_t(i) * n] = hipsolver_host_conj(a);
+            norm += (i == j ? 1 : 2) * hipsolver_host_abs2(a);
+        }
+        V[j + size_t(j) * n] = 1;
+    }
+
+    for(int sweep = 0; sweep < max_sweeps; sweep++)
+    {
+        S off = 0;
+        for(int q = 1; q < n; q++)
+            for(int p = 0; p < q; p++)
+                off += hipsolver_host_abs2(M[p + size_t(q) * n]);
+        if(2 * off <= eps * eps * norm)
+            break;
+
+        for(int q = 1; q < n; q++)
+        {
+            for(int p = 0; p < q; p++)
+            {
+                T apq = M[p + size_t(q) * n];
+                S g   = std::abs(apq);
+                if(g == 0)
+                    continue;
+
+                // U = diag(1, conj(e)) * [c s; -s c] annihilates M(p,q) = g * e
+                S app   = hipsolver_host_real(M[p + size_t(p) * n]);
+                S aqq   = hipsolver_host_real(M[q + size_t(q) * n]);
+                S theta = (aqq - app) / (2 * g);
+                S t     = (theta >= 0 ? 1 : -1) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+                S c     = 1 / std::sqrt(t * t + 1);
+                S s     = t * c;
+                T e     = hipsolver_host_conj(apq / g);
+                T uqp   = -s * e;
+                T uqq   = c * e;
+
+                // M = U^H * M * U and V = V * U
+                for(int k = 0; k < n; k++)
+                {
+                    T x                  = M[k + size_t(p) * n];
+                    T y                  = M[k + size_t(q) * n];
+                    M[k + size_t(p) * n] = c * x + y * uqp;
+                    M[k + size_t(q) * n] = s * x + y * uqq;
+
+                    x                    = V[k + size_t(p) * n];
+                    y                    = V[k + size_t(q) * n];
+                    V[k + size_t(p) * n] = c * x + y * uqp;
+                    V[k + size_t(q) * n] = s * x + y * uqq;
+                }
+                for(int k = 0; k < n; k++)
+                {
+                    T x                  = M[p + size_t(k) * n];
+                    T y                  = M[q + size_t(k) * n];
+                    M[p + size_t(k) * n] = c * x + hipsolver_host_conj(uqp) * y;
+                    M[q + size_t(k) * n] = s * x + hipsolver_host_conj(uqq) * y;
+                }
+
+                M[p + size_t(q) * n] = 0;
+                M[q + size_t(p) * n] = 0;
+                M[p + size_t(p) * n] = app - t * g;
+                M[q + size_t(q) * n] = aqq + t * g;
+            }
+        }
+    }
+
+    *info = 0;
+    for(int q = 1; q < n; q++)
+        for(int p = 0; p < q; p++)
+            if(hipsolver_host_abs2(M[p + size_t(q) * n]) > eps * eps * norm)
+                (*info)++;
+
+    for(int j = 0; j < n; j++)
+        D[j] = hipsolver_host_real(M[j + size_t(j) * n]);
+
+    // selection sort, which moves each eigenvector at most once
+    for(int j = 0; j < n - 1; j++)
+    {
+        int k = int(std::min_element(D + j, D + n) - D);
+        if(k != j)
+        {
+            std::swap(D[j], D[k]);
+            std::swap_ranges(V.begin() + size_t(j) * n,
+                             V.begin() + size_t(j + 1) * n,
+                             V.begin() + size_t(k) * n);
+        }
+    }
+
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+        for(int j = 0; j < n; j++)
+            std::copy(V.begin() + size_t(j) * n,
+                      V.begin() + size_t(j + 1) * n,
+                      A + size_t(j) * lda);
+}
+
+/*
+ * ===========================================================================
+ *    Fixed-size solvers. The runtime order selects the instantiations of
+ *    hipsolver_device.hpp for that order in a table built at compile time.
+ *    The matrix is copied to a tile with a compile-time leading dimension,
+ *    which the unrolled solvers keep in registers or on the stack, so that no
+ *    workspace is used.
+ * ===========================================================================
+ */
+
+// largest order with fixed-size solvers
+constexpr int hipsolver_host_fixed_size = 32;
+
+template <typename T>
+struct hipsolver_host_fixed_solvers
+{
+    int (*potrf)(hipsolverFillMode_t uplo, T* A, int lda);
+    int (*getrf)(T* A, int lda, int* ipiv);
+    void (*getrs)(hipsolverOperation_t trans,
+                  int                  nrhs,
+                  const T*             A,
+                  int                  lda,
+                  const int*           ipiv,
+                  T*                   B,
+                  int                  ldb);
+};
+
+template <typename T, int N>
+inline void hipsolver_host_load(const T* A, int lda, T* tile)
+{
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < N; i++)
+            tile[i + j * N] = A[i + size_t(j) * lda];
+}
+
+template <typename T, int N>
+inline void hipsolver_host_store(const T* tile, T* A, int lda)
+{
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < N; i++)
+            A[i + size_t(j) * lda] = tile[i + j * N];
+}
+
+template <typename T, int N>
+int hipsolver_host_potrf_fixed(hipsolverFillMode_t uplo, T* A, int lda)
+{
+    T tile[N * N];
+    hipsolver_host_load<T, N>(A, lda, tile);
+    int info = hipsolver::device::potrf<T, N>(uplo, tile);
+    hipsolver_host_store<T, N>(tile, A, lda);
+    return info;
+}
+
+template <typename T, int N>
+int hipsolver_host_getrf_fixed(T* A, int lda, int* ipiv)
+{
+    T tile[N * N];
+    hipsolver_host_load<T, N>(A, lda, tile);
+    int info = hipsolver::device::getrf<T, N>(tile, ipiv);
+    hipsolver_host_store<T, N>(tile, A, lda);
+    return info;
+}
+
+template <typename T, int N>
+void hipsolver_host_getrs_fixed(hipsolverOperation_t trans,
+                                int                  nrhs,
+                                const T*             A,
+                                int                  lda,
+                                const int*           ipiv,
+                                T*                   B,
+                                int                  ldb)
+{
+    T tile[N * N];
+    hipsolver_host_load<T, N>(A, lda, tile);
+    for(int c = 0; c < nrhs; c++)
+    {
+        T* x = B + size_t(c) * ldb;
+        T  y[N];
+        std::copy(x, x + N, y);
+        hipsolver::device::getrs<T, N, 1>(trans, tile, ipiv, y);
+        std::copy(y, y + N, x);
+    }
+}
+
+template <typename T, int... N>
+inline const hipsolver_host_fixed_solvers<T>*
+    hipsolver_host_fixed_table(std::integer_sequence<int, N...>)
+{
+    static const hipsolver_host_fixed_solvers<T> table[]
+        = {{hipsolver_host_potrf_fixed<T, N + 1>,
+            hipsolver_host_getrf_fixed<T, N + 1>,
+            hipsolver_host_getrs_fixed<T, N + 1>}...};
+    return table;
+}
+
+/*! \brief Fixed-size solvers for order n, or null if there are none. The solvers of
+ *  hipsolver_device.hpp are real, so there are none for the complex types. */
+template <typename T>
+inline const hipsolver_host_fixed_solvers<T>* hipsolver_host_fixed(int)
+{
+    return nullptr;
+}
+
+template <>
+inline const hipsolver_host_fixed_solvers<float>* hipsolver_host_fixed<float>(int n)
+{
+    if(n < 1 || n > hipsolver_host_fixed_size)
+        return nullptr;
+    return hipsolver_host_fixed_table<float>(
+               std::make_integer_sequence<int, hipsolver_host_fixed_size>())
+           + n - 1;
+}
+
+template <>
+inline const hipsolver_host_fixed_solvers<double>* hipsolver_host_fixed<double>(int n)
+{
+    if(n < 1 || n > hipsolver_host_fixed_size)
+        return nullptr;
+    return hipsolver_host_fixed_table<double>(
+               std::make_integer_sequence<int, hipsolver_host_fixed_size>())
+           + n - 1;
+}
+
+/*! \brief Host versions of potrf, getrf and syevd on the public types. Invalid enumerations
+ *  throw HIPSOLVER_STATUS_INVALID_ENUM, as for the back-ends. */
+template <typename T>
+void hipsolver_host_potrf(hipsolverFillMode_t uplo, int n, T* A, int lda, int* info)
+{
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+
+    using H     = typename hipsolver_host_type<T>::type;
+    auto* fixed = hipsolver_host_fixed<H>(n);
+    if(fixed)
+        *info = fixed->potrf(uplo, (H*)A, lda);
+    else
+        hipsolver_host_potf2(uplo, n, (H*)A, lda, info);
+}
+
+template <typename T>
+void hipsolver_host_getrf(int m, int n, T* A, int lda, int* ipiv, int* info)
+{
+    using H     = typename hipsolver_host_type<T>::type;
+    auto* fixed = m == n ? hipsolver_host_fixed<H>(n) : nullptr;
+    if(fixed)
+        *info = fixed->getrf((H*)A, lda, ipiv);
+    else
+        hipsolver_host_getf2(m, n, (H*)A, lda, ipiv, info);
+}
+
+template <typename T>
+void hipsolver_host_getrs(hipsolverOperation_t trans,
+                          int                  n,
+                          int                  nrhs,
+                          const T*             A,
+                          int                  lda,
+                          const int*           ipiv,
+                          T*                   B,
+                          int                  ldb)
+{
+    if(trans != HIPSOLVER_OP_N && trans != HIPSOLVER_OP_T && trans != HIPSOLVER_OP_C)
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+
+    using H     = typename hipsolver_host_type<T>::type;
+    auto* fixed = hipsolver_host_fixed<H>(n);
+    if(fixed)
+        fixed->getrs(trans, nrhs, (const H*)A, lda, ipiv, (H*)B, ldb);
+    else
+        hipsolver_host_getrs2(trans, n, nrhs, (const H*)A, lda, ipiv, (H*)B, ldb);
+}
+
+template <typename T, typename S>
+void hipsolver_host_syevd(
+    hipsolverEigMode_t jobz, hipsolverFillMode_t uplo, int n, T* A, int lda, S* D, int* info)
+{
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR && jobz != HIPSOLVER_EIG_MODE_VECTOR)
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver_host_syevj(jobz, uplo, n, (typename hipsolver_host_type<T>::type*)A, lda, D, info);
+}
+
+/*! \brief Host versions of the batched potrf, getrf and getrs, for batches given by arrays of
+ *  pointers or by strides. */
+template <typename T>
+void hipsolver_host_potrf_batched(
+    hipsolverFillMode_t uplo, int n, T* const A[], int lda, int* info, int batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        hipsolver_host_potrf(uplo, n, A[b], lda, info + b);
+}
+
+template <typename T>
+void hipsolver_host_getrf_batched(
+    int m, int n, T* const A[], int lda, int* ipiv, int strideP, int* info, int batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        hipsolver_host_getrf(
+            m, n, A[b], lda, ipiv ? ipiv + size_t(b) * strideP : nullptr, info + b);
+}
+
+template <typename T>
+void hipsolver_host_getrf_batched(int  m,
+                                  int  n,
+                                  T*   A,
+                                  int  lda,
+                                  int  strideA,
+                                  int* ipiv,
+                                  int  strideP,
+                                  int* info,
+                                  int  batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        hipsolver_host_getrf(m,
+                             n,
+                             A + size_t(b) * strideA,
+                             lda,
+                             ipiv ? ipiv + size_t(b) * strideP : nullptr,
+                             info + b);
+}
+
+template <typename T>
+void hipsolver_host_getrs_batched(hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  T* const             A[],
+                                  int                  lda,
+                                  const int*           ipiv,
+                                  int                  strideP,
+                                  T* const             B[],
+                                  int                  ldb,
+                                  int                  batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        hipsolver_host_getrs(trans, n, nrhs, A[b], lda, ipiv + size_t(b) * strideP, B[b], ldb);
+}
+
+template <typename T>
+void hipsolver_host_getrs_batched(hipsolverOperation_t trans,
+                                  int                  n,
+                                  int                  nrhs,
+                                  const T*             A,
+                                  int                  lda,
+                                  int                  strideA,
+                                  const int*           ipiv,
+                                  int                  strideP,
+                                  T*                   B,
+                                  int                  ldb,
+                                  int                  strideB,
+                                  int                  batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        hipsolver_host_getrs(trans,
+                             n,
+                             nrhs,
+                             A + size_t(b) * strideA,
+                             lda,
+                             ipiv + size_t(b) * strideP,
+                             B + size_t(b) * strideB,
+                             ldb);
+}
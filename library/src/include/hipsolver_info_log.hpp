@@ -0,0 +1,370 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <condition_variable>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef HIPSOLVER_DEVICE_KERNELS
+/*! \brief Reduction of the info values on the device. first is the position of the first nonzero
+ *  value, or UINT_MAX if there was none, as it is reduced with atomicMin. */
+struct hipsolver_info_state
+{
+    int      flag;
+    int      count;
+    unsigned first;
+};
+
+/*! \brief Reduces the count info values of the device array devInfo, at positions offset and
+ *  after in the accumulation, into state. Defined in hcc_detail/hipsolver_info_kernels.cpp. */
+hipError_t hipsolver_info_reduce_launch(hipStream_t           stream,
+                                        const int*            devInfo,
+                                        int                   count,
+                                        int                   offset,
+                                        hipsolver_info_state* state);
+#endif
+
+/*! \brief Device-side record of the info values written while info aggregation is enabled.
+ *
+ *  With the device kernels of the library, every solver call reduces its info array into the
+ *  fixed-size hipsolver_info_state of the handle, with a kernel enqueued on the handle's stream,
+ *  and a summary request copies that state back and resets it. Nothing grows with the number of
+ *  calls, and only the state is read on the host.
+ *
+ *  Without them, every solver call appends a copy of its info array to the log instead, and a
+ *  summary request copies the log to pinned host memory and reduces it in a stream callback. The
+ *  log is preallocated when the mode is enabled, and grows in stream order, freeing the old log
+ *  after the work already enqueued on the stream.
+ *
+ *  Either way no operation here waits for the device: the summary is written by a stream
+ *  callback. Every summary in flight owns one of the pinned staging buffers of the handle, which
+ *  its callback returns to the handle once the summary is written, so that summaries enqueued on
+ *  different streams never share a buffer and no buffer is freed while a copy may target it.
+ */
+struct hipsolver_info_log
+{
+    // number of entries allocated when the mode is enabled
+    static constexpr int initial_capacity = 1024;
+
+    bool enabled = false;
+
+    // log entries on the device; only size, the number of values since the last summary, is
+    // used with the device kernels
+    int* values   = nullptr;
+    int  size     = 0;
+    int  capacity = 0;
+
+#ifdef HIPSOLVER_DEVICE_KERNELS
+    hipsolver_info_state* state = nullptr;
+#endif
+
+    hipsolver_info_log()
+        : staging(new staging_pool)
+    {
+    }
+
+    hipsolver_info_log(const hipsolver_info_log&) = delete;
+    hipsolver_info_log& operator=(const hipsolver_info_log&) = delete;
+
+    ~hipsolver_info_log()
+    {
+        release();
+    }
+
+    /*! \brief Frees the log, and the staging buffers once every summary in flight is written. */
+    void release()
+    {
+        // hipFree and hipHostFree wait for any work still using the buffers
+        if(values)
+            hipFree(values);
+#ifdef HIPSOLVER_DEVICE_KERNELS
+        if(state)
+            hipFree(state);
+        state = nullptr;
+#endif
+        values   = nullptr;
+        size     = 0;
+        capacity = 0;
+        staging->clear();
+    }
+
+    /*! \brief Allocates the log ahead of the first append, so that the solver calls that follow
+     *  do not allocate. The device state is cleared when the mode is enabled. */
+    hipError_t reserve(hipStream_t stream)
+    {
+#ifdef HIPSOLVER_DEVICE_KERNELS
+        if(!state)
+        {
+            hipError_t err
+                = hipMallocAsync((void**)&state, sizeof(hipsolver_info_state), stream);
+            if(err != hipSuccess)
+            {
+                state = nullptr;
+                return err;
+            }
+        }
+        else if(enabled)
+            return hipSuccess;
+        return clear_state(stream);
+#else
+        if(capacity >= initial_capacity)
+            return hipSuccess;
+        return grow(stream, initial_capacity);
+#endif
+    }
+
+    /*! \brief Appends count info values from the device array devInfo. */
+    hipError_t append(hipStream_t stream, const int* devInfo, int count)
+    {
+        if(count <= 0)
+            return hipSuccess;
+
+#ifdef HIPSOLVER_DEVICE_KERNELS
+        hipError_t err = hipsolver_info_reduce_launch(stream, devInfo, count, size, state);
+        if(err == hipSuccess)
+            size += count;
+        return err;
+#else
+        if(size + count > capacity)
+        {
+            hipError_t err = grow(stream, size + count);
+            if(err != hipSuccess)
+                return err;
+        }
+
+        hipError_t err = hipMemcpyAsync(
+            values + size, devInfo, sizeof(int) * count, hipMemcpyDeviceToDevice, stream);
+        if(err == hipSuccess)
+            size += count;
+        return err;
+#endif
+    }
+
+    /*! \brief Enqueues the reduction of the log into summary and starts a new log. */
+    hipError_t summarize(hipStream_t stream, hipsolverInfoSummary_t* summary)
+    {
+#ifdef HIPSOLVER_DEVICE_KERNELS
+        // only the state is copied back, and it is cleared for the next summary
+        int                 copied  = sizeof(hipsolver_info_state) / sizeof(int);
+        hipStreamCallback_t written = report;
+#else
+        int                 copied  = size;
+        hipStreamCallback_t written = reduce;
+#endif
+
+        int*       buffer = nullptr;
+        hipError_t err    = staging->take(copied, &buffer);
+        if(err != hipSuccess)
+            return err;
+
+        request* req = new request{staging.get(), buffer, size, summary};
+#ifdef HIPSOLVER_DEVICE_KERNELS
+        err = hipMemcpyAsync(
+            buffer, state, sizeof(hipsolver_info_state), hipMemcpyDeviceToHost, stream);
+        if(err == hipSuccess)
+            err = clear_state(stream);
+#else
+        if(size > 0)
+            err = hipMemcpyAsync(
+                buffer, values, sizeof(int) * size, hipMemcpyDeviceToHost, stream);
+#endif
+        if(err == hipSuccess)
+            err = hipStreamAddCallback(stream, written, req, 0);
+        if(err != hipSuccess)
+        {
+            staging->give(buffer);
+            delete req;
+            return err;
+        }
+
+        size = 0;
+        return hipSuccess;
+    }
+
+private:
+    /*! \brief Pinned buffers of the summaries of one handle. A buffer is taken by a summary when
+     *  it is enqueued and given back by its callback, which cannot call the runtime, so buffers
+     *  are only allocated and freed by the thread that owns the handle. */
+    struct staging_pool
+    {
+        struct buffer
+        {
+            int* data;
+            int  capacity;
+        };
+
+        std::mutex              mutex;
+        std::condition_variable done;
+        std::vector<buffer>     free;
+        std::vector<buffer>     taken;
+
+        ~staging_pool()
+        {
+            clear();
+        }
+
+        hipError_t take(int count, int** data)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(size_t i = 0; i < free.size(); i++)
+            {
+                if(free[i].capacity >= count)
+                {
+                    taken.push_back(free[i]);
+                    free.erase(free.begin() + i);
+                    *data = taken.back().data;
+                    return hipSuccess;
+                }
+            }
+
+            // buffers that are too small are kept for smaller logs, and freed with the handle,
+            // as hipHostFree would wait for the device
+            buffer     b{nullptr, std::max(count, int(initial_capacity))};
+            hipError_t err = hipHostMalloc((void**)&b.data, sizeof(int) * b.capacity);
+            if(err != hipSuccess)
+                return err;
+
+            taken.push_back(b);
+            *data = b.data;
+            return hipSuccess;
+        }
+
+        void give(int* data)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for(size_t i = 0; i < taken.size(); i++)
+                {
+                    if(taken[i].data == data)
+                    {
+                        free.push_back(taken[i]);
+                        taken.erase(taken.begin() + i);
+                        break;
+                    }
+                }
+            }
+            done.notify_all();
+        }
+
+        /*! \brief Waits for the summaries in flight and frees every buffer. */
+        void clear()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this] { return taken.empty(); });
+            for(const buffer& b : free)
+                hipHostFree(b.data);
+            free.clear();
+        }
+    };
+
+    struct request
+    {
+        staging_pool*           pool;
+        int*                    values;
+        int                     count;
+        hipsolverInfoSummary_t* summary;
+    };
+
+    std::unique_ptr<staging_pool> staging;
+
+#ifdef HIPSOLVER_DEVICE_KERNELS
+    // no failure yet; first is set to UINT_MAX
+    hipError_t clear_state(hipStream_t stream)
+    {
+        hipError_t err = hipMemsetAsync(state, 0, sizeof(hipsolver_info_state), stream);
+        if(err == hipSuccess)
+            err = hipMemsetAsync(&state->first, 0xff, sizeof(state->first), stream);
+        return err;
+    }
+
+    static void report(hipStream_t stream, hipError_t status, void* data)
+    {
+        request*                    req     = (request*)data;
+        hipsolverInfoSummary_t*     summary = req->summary;
+        const hipsolver_info_state* reduced = (const hipsolver_info_state*)req->values;
+
+        summary->info_count = req->count;
+        if(status != hipSuccess)
+        {
+            // the state could not be copied; report that its contents are unknown
+            summary->any_failure   = 1;
+            summary->failure_count = -1;
+            summary->first_failure = -1;
+        }
+        else
+        {
+            summary->any_failure   = reduced->flag;
+            summary->failure_count = reduced->count;
+            summary->first_failure = reduced->flag ? int(reduced->first) : -1;
+        }
+
+        req->pool->give(req->values);
+        delete req;
+    }
+#endif
+
+    hipError_t grow(hipStream_t stream, int needed)
+    {
+        int new_capacity = std::max(needed, std::max(2 * capacity, int(initial_capacity)));
+
+        int*       new_values = nullptr;
+        hipError_t err = hipMallocAsync((void**)&new_values, sizeof(int) * new_capacity, stream);
+        if(err == hipSuccess && size > 0)
+            err = hipMemcpyAsync(
+                new_values, values, sizeof(int) * size, hipMemcpyDeviceToDevice, stream);
+        if(err != hipSuccess)
+        {
+            if(new_values)
+                hipFreeAsync(new_values, stream);
+            return err;
+        }
+
+        // the old log is freed in stream order, after the copy above
+        if(values)
+            hipFreeAsync(values, stream);
+        values   = new_values;
+        capacity = new_capacity;
+        return hipSuccess;
+    }
+
+    static void reduce(hipStream_t stream, hipError_t status, void* data)
+    {
+        request*                req     = (request*)data;
+        hipsolverInfoSummary_t* summary = req->summary;
+
+        summary->info_count    = req->count;
+        summary->any_failure   = 0;
+        summary->failure_count = 0;
+        summary->first_failure = -1;
+
+        if(status != hipSuccess)
+        {
+            // the log could not be copied; report that its contents are unknown
+            summary->any_failure   = 1;
+            summary->failure_count = -1;
+        }
+        else
+        {
+            for(int i = 0; i < req->count; i++)
+            {
+                if(req->values[i] != 0)
+                {
+                    if(summary->first_failure < 0)
+                        summary->first_failure = i;
+                    summary->any_failure = 1;
+                    summary->failure_count++;
+                }
+            }
+        }
+
+        req->pool->give(req->values);
+        delete req;
+    }
+};
@@ -0,0 +1,1339 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+
+/*
+ * Interleaved batched potrf, getrf, getrs and syevj.
+ *
+ * In the interleaved layout of a batch, the index of the matrix is the innermost: entry (i, j) of
+ * matrix b is at A[b + (i + j * lda) * batch_count], so that the entries (i, j) of all the
+ * matrices are contiguous. The pivots and eigenvalues are interleaved the same way, entry i of
+ * matrix b at ipiv[b + i * batch_count] and W[b + i * batch_count], and the infos are one per
+ * matrix. Batches of tiny matrices built in this layout are read with coalesced accesses by the
+ * kernels that produce and consume them.
+ *
+ * On the AMD back-end, the potrf, getrf and getrs of real square matrices of order up to 32 are
+ * solved in place by the small batched kernels (see hipsolver_small.hpp), which read the
+ * interleaved layout directly. Otherwise the back-ends take the strided layout, so the functions
+ * convert the batch to the strided layout in the workspace, call the strided (or batched)
+ * function, and convert the results back. A conversion is a transposition of the batch, by one
+ * call of geam for each column of the matrices, or by a single call when the matrices are not
+ * padded (lda == m). The pivots are moved by one two-dimensional copy for each row, and the
+ * addresses of the matrices taken by potrfBatched are written by the Blas trait, on the device
+ * where the back-end has kernels.
+ *
+ * The workspace is the work array of the caller, of the size returned by the bufferSize
+ * functions. On the AMD back-end, work may be null, and the workspace is then taken from the
+ * arena of the handle. cuSOLVER has no such arena, so the NVIDIA back-end requires work.
+ */
+
+/******************** BATCHED DISPATCH ********************/
+inline hipsolverStatus_t hipsolver_interleaved_potrf_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                float**             A,
+                                                                int                 lda,
+                                                                int*                lwork,
+                                                                int                 batch_count)
+{
+    return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_potrf(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     float**             A,
+                                                     int                 lda,
+                                                     float*              work,
+                                                     int                 lwork,
+                                                     int*                devInfo,
+                                                     int                 batch_count)
+{
+    return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_potrf_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                double**            A,
+                                                                int                 lda,
+                                                                int*                lwork,
+                                                                int                 batch_count)
+{
+    return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_potrf(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     double**            A,
+                                                     int                 lda,
+                                                     double*             work,
+                                                     int                 lwork,
+                                                     int*                devInfo,
+                                                     int                 batch_count)
+{
+    return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_potrf_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                hipsolverComplex**  A,
+                                                                int                 lda,
+                                                                int*                lwork,
+                                                                int                 batch_count)
+{
+    return hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_potrf(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     hipsolverComplex**  A,
+                                                     int                 lda,
+                                                     hipsolverComplex*   work,
+                                                     int                 lwork,
+                                                     int*                devInfo,
+                                                     int                 batch_count)
+{
+    return hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t
+    hipsolver_interleaved_potrf_bufferSize(hipsolverHandle_t        handle,
+                                           hipsolverFillMode_t      uplo,
+                                           int                      n,
+                                           hipsolverDoubleComplex** A,
+                                           int                      lda,
+                                           int*                     lwork,
+                                           int                      batch_count)
+{
+    return hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_potrf(hipsolverHandle_t        handle,
+                                                     hipsolverFillMode_t      uplo,
+                                                     int                      n,
+                                                     hipsolverDoubleComplex** A,
+                                                     int                      lda,
+                                                     hipsolverDoubleComplex*  work,
+                                                     int                      lwork,
+                                                     int*                     devInfo,
+                                                     int                      batch_count)
+{
+    return hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                float*            A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                int*              lwork,
+                                                                int               batch_count)
+{
+    return hipsolverSgetrfStridedBatched_bufferSize(
+        handle, m, n, A, lda, strideA, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     float*            A,
+                                                     int               lda,
+                                                     int               strideA,
+                                                     float*            work,
+                                                     int               lwork,
+                                                     int*              devIpiv,
+                                                     int               strideP,
+                                                     int*              devInfo,
+                                                     int               batch_count)
+{
+    return hipsolverSgetrfStridedBatched(
+        handle, m, n, A, lda, strideA, work, lwork, devIpiv, strideP, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                double*           A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                int*              lwork,
+                                                                int               batch_count)
+{
+    return hipsolverDgetrfStridedBatched_bufferSize(
+        handle, m, n, A, lda, strideA, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     double*           A,
+                                                     int               lda,
+                                                     int               strideA,
+                                                     double*           work,
+                                                     int               lwork,
+                                                     int*              devIpiv,
+                                                     int               strideP,
+                                                     int*              devInfo,
+                                                     int               batch_count)
+{
+    return hipsolverDgetrfStridedBatched(
+        handle, m, n, A, lda, strideA, work, lwork, devIpiv, strideP, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                hipsolverComplex* A,
+                                                                int               lda,
+                                                                int               strideA,
+                                                                int*              lwork,
+                                                                int               batch_count)
+{
+    return hipsolverCgetrfStridedBatched_bufferSize(
+        handle, m, n, A, lda, strideA, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     hipsolverComplex* A,
+                                                     int               lda,
+                                                     int               strideA,
+                                                     hipsolverComplex* work,
+                                                     int               lwork,
+                                                     int*              devIpiv,
+                                                     int               strideP,
+                                                     int*              devInfo,
+                                                     int               batch_count)
+{
+    return hipsolverCgetrfStridedBatched(
+        handle, m, n, A, lda, strideA, work, lwork, devIpiv, strideP, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf_bufferSize(hipsolverHandle_t       handle,
+                                                                int                     m,
+                                                                int                     n,
+                                                                hipsolverDoubleComplex* A,
+                                                                int                     lda,
+                                                                int                     strideA,
+                                                                int*                    lwork,
+                                                                int                     batch_count)
+{
+    return hipsolverZgetrfStridedBatched_bufferSize(
+        handle, m, n, A, lda, strideA, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrf(hipsolverHandle_t       handle,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     int                     strideA,
+                                                     hipsolverDoubleComplex* work,
+                                                     int                     lwork,
+                                                     int*                    devIpiv,
+                                                     int                     strideP,
+                                                     int*                    devInfo,
+                                                     int                     batch_count)
+{
+    return hipsolverZgetrfStridedBatched(
+        handle, m, n, A, lda, strideA, work, lwork, devIpiv, strideP, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs_bufferSize(hipsolverHandle_t    handle,
+                                                                hipsolverOperation_t trans,
+                                                                int                  n,
+                                                                int                  nrhs,
+                                                                float*               A,
+                                                                int                  lda,
+                                                                int                  strideA,
+                                                                int*                 devIpiv,
+                                                                int                  strideP,
+                                                                float*               B,
+                                                                int                  ldb,
+                                                                int                  strideB,
+                                                                int*                 lwork,
+                                                                int                  batch_count)
+{
+    return hipsolverSgetrsStridedBatched_bufferSize(handle,
+                                                    trans,
+                                                    n,
+                                                    nrhs,
+                                                    A,
+                                                    lda,
+                                                    strideA,
+                                                    devIpiv,
+                                                    strideP,
+                                                    B,
+                                                    ldb,
+                                                    strideB,
+                                                    lwork,
+                                                    batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs(hipsolverHandle_t    handle,
+                                                     hipsolverOperation_t trans,
+                                                     int                  n,
+                                                     int                  nrhs,
+                                                     float*               A,
+                                                     int                  lda,
+                                                     int                  strideA,
+                                                     int*                 devIpiv,
+                                                     int                  strideP,
+                                                     float*               B,
+                                                     int                  ldb,
+                                                     int                  strideB,
+                                                     float*               work,
+                                                     int                  lwork,
+                                                     int*                 devInfo,
+                                                     int                  batch_count)
+{
+    return hipsolverSgetrsStridedBatched(handle,
+                                         trans,
+                                         n,
+                                         nrhs,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         devIpiv,
+                                         strideP,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         work,
+                                         lwork,
+                                         devInfo,
+                                         batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs_bufferSize(hipsolverHandle_t    handle,
+                                                                hipsolverOperation_t trans,
+                                                                int                  n,
+                                                                int                  nrhs,
+                                                                double*              A,
+                                                                int                  lda,
+                                                                int                  strideA,
+                                                                int*                 devIpiv,
+                                                                int                  strideP,
+                                                                double*              B,
+                                                                int                  ldb,
+                                                                int                  strideB,
+                                                                int*                 lwork,
+                                                                int                  batch_count)
+{
+    return hipsolverDgetrsStridedBatched_bufferSize(handle,
+                                                    trans,
+                                                    n,
+                                                    nrhs,
+                                                    A,
+                                                    lda,
+                                                    strideA,
+                                                    devIpiv,
+                                                    strideP,
+                                                    B,
+                                                    ldb,
+                                                    strideB,
+                                                    lwork,
+                                                    batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs(hipsolverHandle_t    handle,
+                                                     hipsolverOperation_t trans,
+                                                     int                  n,
+                                                     int                  nrhs,
+                                                     double*              A,
+                                                     int                  lda,
+                                                     int                  strideA,
+                                                     int*                 devIpiv,
+                                                     int                  strideP,
+                                                     double*              B,
+                                                     int                  ldb,
+                                                     int                  strideB,
+                                                     double*              work,
+                                                     int                  lwork,
+                                                     int*                 devInfo,
+                                                     int                  batch_count)
+{
+    return hipsolverDgetrsStridedBatched(handle,
+                                         trans,
+                                         n,
+                                         nrhs,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         devIpiv,
+                                         strideP,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         work,
+                                         lwork,
+                                         devInfo,
+                                         batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs_bufferSize(hipsolverHandle_t    handle,
+                                                                hipsolverOperation_t trans,
+                                                                int                  n,
+                                                                int                  nrhs,
+                                                                hipsolverComplex*    A,
+                                                                int                  lda,
+                                                                int                  strideA,
+                                                                int*                 devIpiv,
+                                                                int                  strideP,
+                                                                hipsolverComplex*    B,
+                                                                int                  ldb,
+                                                                int                  strideB,
+                                                                int*                 lwork,
+                                                                int                  batch_count)
+{
+    return hipsolverCgetrsStridedBatched_bufferSize(handle,
+                                                    trans,
+                                                    n,
+                                                    nrhs,
+                                                    A,
+                                                    lda,
+                                                    strideA,
+                                                    devIpiv,
+                                                    strideP,
+                                                    B,
+                                                    ldb,
+                                                    strideB,
+                                                    lwork,
+                                                    batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs(hipsolverHandle_t    handle,
+                                                     hipsolverOperation_t trans,
+                                                     int                  n,
+                                                     int                  nrhs,
+                                                     hipsolverComplex*    A,
+                                                     int                  lda,
+                                                     int                  strideA,
+                                                     int*                 devIpiv,
+                                                     int                  strideP,
+                                                     hipsolverComplex*    B,
+                                                     int                  ldb,
+                                                     int                  strideB,
+                                                     hipsolverComplex*    work,
+                                                     int                  lwork,
+                                                     int*                 devInfo,
+                                                     int                  batch_count)
+{
+    return hipsolverCgetrsStridedBatched(handle,
+                                         trans,
+                                         n,
+                                         nrhs,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         devIpiv,
+                                         strideP,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         work,
+                                         lwork,
+                                         devInfo,
+                                         batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs_bufferSize(hipsolverHandle_t       handle,
+                                                                hipsolverOperation_t    trans,
+                                                                int                     n,
+                                                                int                     nrhs,
+                                                                hipsolverDoubleComplex* A,
+                                                                int                     lda,
+                                                                int                     strideA,
+                                                                int*                    devIpiv,
+                                                                int                     strideP,
+                                                                hipsolverDoubleComplex* B,
+                                                                int                     ldb,
+                                                                int                     strideB,
+                                                                int*                    lwork,
+                                                                int                     batch_count)
+{
+    return hipsolverZgetrsStridedBatched_bufferSize(handle,
+                                                    trans,
+                                                    n,
+                                                    nrhs,
+                                                    A,
+                                                    lda,
+                                                    strideA,
+                                                    devIpiv,
+                                                    strideP,
+                                                    B,
+                                                    ldb,
+                                                    strideB,
+                                                    lwork,
+                                                    batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_getrs(hipsolverHandle_t       handle,
+                                                     hipsolverOperation_t    trans,
+                                                     int                     n,
+                                                     int                     nrhs,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     int                     strideA,
+                                                     int*                    devIpiv,
+                                                     int                     strideP,
+                                                     hipsolverDoubleComplex* B,
+                                                     int                     ldb,
+                                                     int                     strideB,
+                                                     hipsolverDoubleComplex* work,
+                                                     int                     lwork,
+                                                     int*                    devInfo,
+                                                     int                     batch_count)
+{
+    return hipsolverZgetrsStridedBatched(handle,
+                                         trans,
+                                         n,
+                                         nrhs,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         devIpiv,
+                                         strideP,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         work,
+                                         lwork,
+                                         devInfo,
+                                         batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj_bufferSize(hipsolverHandle_t    handle,
+                                                                hipsolverEigMode_t   jobz,
+                                                                hipsolverFillMode_t  uplo,
+                                                                int                  n,
+                                                                float*               A,
+                                                                int                  lda,
+                                                                float*               W,
+                                                                int*                 lwork,
+                                                                hipsolverSyevjInfo_t params,
+                                                                int                  batch_count)
+{
+    return hipsolverSsyevjBatched_bufferSize(
+        handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj(hipsolverHandle_t    handle,
+                                                     hipsolverEigMode_t   jobz,
+                                                     hipsolverFillMode_t  uplo,
+                                                     int                  n,
+                                                     float*               A,
+                                                     int                  lda,
+                                                     float*               W,
+                                                     float*               work,
+                                                     int                  lwork,
+                                                     int*                 devInfo,
+                                                     hipsolverSyevjInfo_t params,
+                                                     int                  batch_count)
+{
+    return hipsolverSsyevjBatched(
+        handle, jobz, uplo, n, A, lda, W, work, lwork, devInfo, params, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj_bufferSize(hipsolverHandle_t    handle,
+                                                                hipsolverEigMode_t   jobz,
+                                                                hipsolverFillMode_t  uplo,
+                                                                int                  n,
+                                                                double*              A,
+                                                                int                  lda,
+                                                                double*              W,
+                                                                int*                 lwork,
+                                                                hipsolverSyevjInfo_t params,
+                                                                int                  batch_count)
+{
+    return hipsolverDsyevjBatched_bufferSize(
+        handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj(hipsolverHandle_t    handle,
+                                                     hipsolverEigMode_t   jobz,
+                                                     hipsolverFillMode_t  uplo,
+                                                     int                  n,
+                                                     double*              A,
+                                                     int                  lda,
+                                                     double*              W,
+                                                     double*              work,
+                                                     int                  lwork,
+                                                     int*                 devInfo,
+                                                     hipsolverSyevjInfo_t params,
+                                                     int                  batch_count)
+{
+    return hipsolverDsyevjBatched(
+        handle, jobz, uplo, n, A, lda, W, work, lwork, devInfo, params, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj_bufferSize(hipsolverHandle_t    handle,
+                                                                hipsolverEigMode_t   jobz,
+                                                                hipsolverFillMode_t  uplo,
+                                                                int                  n,
+                                                                hipsolverComplex*    A,
+                                                                int                  lda,
+                                                                float*               W,
+                                                                int*                 lwork,
+                                                                hipsolverSyevjInfo_t params,
+                                                                int                  batch_count)
+{
+    return hipsolverCheevjBatched_bufferSize(
+        handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj(hipsolverHandle_t    handle,
+                                                     hipsolverEigMode_t   jobz,
+                                                     hipsolverFillMode_t  uplo,
+                                                     int                  n,
+                                                     hipsolverComplex*    A,
+                                                     int                  lda,
+                                                     float*               W,
+                                                     hipsolverComplex*    work,
+                                                     int                  lwork,
+                                                     int*                 devInfo,
+                                                     hipsolverSyevjInfo_t params,
+                                                     int                  batch_count)
+{
+    return hipsolverCheevjBatched(
+        handle, jobz, uplo, n, A, lda, W, work, lwork, devInfo, params, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj_bufferSize(hipsolverHandle_t       handle,
+                                                                hipsolverEigMode_t      jobz,
+                                                                hipsolverFillMode_t     uplo,
+                                                                int                     n,
+                                                                hipsolverDoubleComplex* A,
+                                                                int                     lda,
+                                                                double*                 W,
+                                                                int*                    lwork,
+                                                                hipsolverSyevjInfo_t    params,
+                                                                int                     batch_count)
+{
+    return hipsolverZheevjBatched_bufferSize(
+        handle, jobz, uplo, n, A, lda, W, lwork, params, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_interleaved_syevj(hipsolverHandle_t       handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     hipsolverFillMode_t     uplo,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     double*                 W,
+                                                     hipsolverDoubleComplex* work,
+                                                     int                     lwork,
+                                                     int*                    devInfo,
+                                                     hipsolverSyevjInfo_t    params,
+                                                     int                     batch_count)
+{
+    return hipsolverZheevjBatched(
+        handle, jobz, uplo, n, A, lda, W, work, lwork, devInfo, params, batch_count);
+}
+
+/******************** CONVERSIONS ********************/
+/*! \brief Copies the batch_count m-by-n matrices of the interleaved batch A to the strided batch
+ *  B. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_interleaved_gather(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               const T*          A,
+                                               int               lda,
+                                               T*                B,
+                                               int               ldb,
+                                               int               strideB,
+                                               int               batch_count)
+{
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // column j of the matrices is the transpose of a batch_count-by-m matrix, and the whole
+    // batch is the transpose of a single batch_count-by-mn matrix when there is no padding
+    int rows = m, cols = n;
+    if(lda == m && ldb == m)
+    {
+        rows = m * n;
+        cols = 1;
+    }
+
+    for(int j = 0; j < cols; j++)
+    {
+        hipsolverStatus_t status = Blas::geam(handle,
+                                              batch_count,
+                                              rows,
+                                              A + size_t(j) * lda * batch_count,
+                                              batch_count,
+                                              B + size_t(j) * ldb,
+                                              strideB);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Copies the batch_count m-by-n matrices of the strided batch A to the interleaved batch
+ *  B. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_interleaved_scatter(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                const T*          A,
+                                                int               lda,
+                                                int               strideA,
+                                                T*                B,
+                                                int               ldb,
+                                                int               batch_count)
+{
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    int rows = m, cols = n;
+    if(lda == m && ldb == m)
+    {
+        rows = m * n;
+        cols = 1;
+    }
+
+    for(int j = 0; j < cols; j++)
+    {
+        hipsolverStatus_t status = Blas::geam(handle,
+                                              rows,
+                                              batch_count,
+                                              A + size_t(j) * lda,
+                                              strideA,
+                                              B + size_t(j) * ldb * batch_count,
+                                              batch_count);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Copies the k pivots of each matrix of a batch from the interleaved array ipiv to the
+ *  strided array sipiv, or back if to_strided is false. */
+inline hipError_t hipsolver_interleaved_pivots(hipStream_t stream,
+                                               int         k,
+                                               int*        ipiv,
+                                               int*        sipiv,
+                                               int         strideP,
+                                               int         batch_count,
+                                               bool        to_strided)
+{
+    size_t        pitch = sizeof(int) * strideP;
+    hipMemcpyKind d2d   = hipMemcpyDeviceToDevice;
+    for(int i = 0; i < k && batch_count > 0; i++)
+    {
+        // row i of ipiv holds pivot i of every matrix, one int apart, and the strided pivots
+        // are strideP ints apart
+        int*       row = ipiv + size_t(i) * batch_count;
+        hipError_t err;
+        if(to_strided)
+            err = hipMemcpy2DAsync(
+                sipiv + i, pitch, row, sizeof(int), sizeof(int), batch_count, d2d, stream);
+        else
+            err = hipMemcpy2DAsync(
+                row, sizeof(int), sipiv + i, pitch, sizeof(int), batch_count, d2d, stream);
+        if(err != hipSuccess)
+            return err;
+    }
+    return hipSuccess;
+}
+
+/******************** WORKSPACE ********************/
+struct hipsolver_interleaved_plan
+{
+    // offsets in the workspace, in bytes, of the strided copies of the arrays, of the addresses
+    // of the matrices, and of the workspace of the back-end function
+    size_t A = 0, B = 0, ipiv = 0, W = 0, ptrs = 0, work = 0;
+    size_t size  = 0;
+    int    lwork = 0; // the workspace of the back-end function, in the units of the back-end
+
+    size_t reserve(size_t bytes)
+    {
+        size_t offset = size;
+        size += (bytes + 255) / 256 * 256;
+        return offset;
+    }
+};
+
+/*! \brief Adds the workspace of the back-end function, of lwork units, to plan. */
+template <typename Blas, typename T>
+void hipsolver_interleaved_finish(hipsolver_interleaved_plan* plan, int lwork)
+{
+    plan->lwork = lwork;
+    plan->work  = plan->size;
+    plan->size += Blas::work_size(lwork, sizeof(T));
+}
+
+/*! \brief Returns in lwork the size of the workspace of plan, in the units of the work arrays of
+ *  the back-end. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_interleaved_lwork(const hipsolver_interleaved_plan& plan, int* lwork)
+{
+    size_t unit = Blas::work_size(1, sizeof(T));
+    size_t size = (plan.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Checks that work holds the workspace of plan, or takes it from handle if work is null,
+ *  and sets bwork and blwork to the workspace of the back-end function. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_interleaved_work(hipsolverHandle_t                 handle,
+                                             const hipsolver_interleaved_plan& plan,
+                                             T**                               work,
+                                             int                               lwork,
+                                             T**                               bwork,
+                                             int*                              blwork)
+{
+    size_t size;
+    if(*work)
+    {
+        if(lwork < 0 || Blas::work_size(lwork, sizeof(T)) < plan.size)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+        size = Blas::work_size(lwork, sizeof(T));
+    }
+    else
+    {
+        void*             ws;
+        hipsolverStatus_t status = Blas::workspace(handle, plan.size, &ws);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        *work = (T*)ws;
+        size  = plan.size;
+    }
+
+    size_t unit = Blas::work_size(1, sizeof(T));
+    *bwork      = (T*)((char*)*work + plan.work);
+    *blwork     = int((size - plan.work) / unit);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Sets the batch_count infos of an empty problem to zero. */
+inline hipsolverStatus_t
+    hipsolver_interleaved_quick_return(hipsolverHandle_t handle, int* info, int batch_count)
+{
+    if(!info || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** FUNCTIONS ********************/
+// conversions
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_interleaved_to_strided(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   const T*          A,
+                                                   int               lda,
+                                                   T*                B,
+                                                   int               ldb,
+                                                   int               strideB,
+                                                   int               batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || lda < std::max(m, 1) || ldb < std::max(m, 1) || batch_count < 0
+       || (n > 0 && strideB < ldb * n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m > 0 && n > 0 && batch_count > 0 && (!A || !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver_interleaved_gather<Blas>(
+        handle, m, n, A, lda, B, ldb, strideB, batch_count);
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_strided_to_interleaved(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   const T*          A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   T*                B,
+                                                   int               ldb,
+                                                   int               batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || lda < std::max(m, 1) || ldb < std::max(m, 1) || batch_count < 0
+       || (n > 0 && strideA < lda * n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m > 0 && n > 0 && batch_count > 0 && (!A || !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver_interleaved_scatter<Blas>(
+        handle, m, n, A, lda, strideA, B, ldb, batch_count);
+}
+
+// potrf
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_interleaved_plan(hipsolverHandle_t           handle,
+                                                   hipsolverFillMode_t         uplo,
+                                                   int                         n,
+                                                   int                         lda,
+                                                   int                         batch_count,
+                                                   hipsolver_interleaved_plan* plan)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(n, 1) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    int ld = n, lwork;
+    plan->A    = plan->reserve(sizeof(T) * ld * n * batch_count);
+    plan->ptrs = plan->reserve(sizeof(T*) * batch_count);
+
+    hipsolverStatus_t status = hipsolver_interleaved_potrf_bufferSize(
+        handle, uplo, n, (T**)nullptr, ld, &lwork, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    hipsolver_interleaved_finish<Blas, T>(plan, lwork);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_interleaved_bufferSize(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 lda,
+                                                         int*                lwork,
+                                                         int                 batch_count)
+{
+    if(handle && !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status
+        = hipsolver_potrf_interleaved_plan<Blas, T>(handle, uplo, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_interleaved_lwork<Blas, T>(plan, lwork);
+}
+
+/*! \brief Cholesky factorizations of the batch_count matrices of order n of the interleaved batch
+ *  A. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_interleaved(hipsolverHandle_t   handle,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              T*                  A,
+                                              int                 lda,
+                                              T*                  work,
+                                              int                 lwork,
+                                              int*                info,
+                                              int                 batch_count)
+{
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status
+        = hipsolver_potrf_interleaved_plan<Blas, T>(handle, uplo, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(n == 0 || batch_count == 0)
+        return hipsolver_interleaved_quick_return(handle, info, batch_count);
+    if(!A || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    status = Blas::small_potrf(handle, uplo, n, A, lda, info, batch_count);
+    if(status != HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return status;
+
+    T*  bwork;
+    int blwork;
+    status = hipsolver_interleaved_work<Blas>(handle, plan, &work, lwork, &bwork, &blwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // potrfBatched takes the addresses of the strided copies, which are written to the workspace
+    int ld     = n;
+    T*  sA     = (T*)((char*)work + plan.A);
+    T** sArray = (T**)((char*)work + plan.ptrs);
+    status     = Blas::pointers(handle, sArray, sA, ld * n, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    status = hipsolver_interleaved_gather<Blas>(handle, n, n, A, lda, sA, ld, ld * n, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_interleaved_potrf(
+        handle, uplo, n, sArray, ld, bwork, blwork, info, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_interleaved_scatter<Blas>(handle, n, n, sA, ld, ld * n, A, lda, batch_count);
+}
+
+// getrf
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrf_interleaved_plan(hipsolverHandle_t           handle,
+                                                   int                         m,
+                                                   int                         n,
+                                                   int                         lda,
+                                                   int                         batch_count,
+                                                   hipsolver_interleaved_plan* plan)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || lda < std::max(m, 1) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    int ld = m, k = std::min(m, n), lwork;
+    plan->A    = plan->reserve(sizeof(T) * ld * n * batch_count);
+    plan->ipiv = plan->reserve(sizeof(int) * k * batch_count);
+
+    hipsolverStatus_t status = hipsolver_interleaved_getrf_bufferSize(
+        handle, m, n, (T*)nullptr, ld, ld * n, &lwork, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    hipsolver_interleaved_finish<Blas, T>(plan, lwork);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrf_interleaved_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int lda, int* lwork, int batch_count)
+{
+    if(handle && !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status
+        = hipsolver_getrf_interleaved_plan<Blas, T>(handle, m, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_interleaved_lwork<Blas, T>(plan, lwork);
+}
+
+/*! \brief LU factorizations of the batch_count m-by-n matrices of the interleaved batch A, with
+ *  the pivots interleaved in ipiv, or without pivoting if ipiv is null. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrf_interleaved(hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              T*                A,
+                                              int               lda,
+                                              T*                work,
+                                              int               lwork,
+                                              int*              ipiv,
+                                              int*              info,
+                                              int               batch_count)
+{
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status
+        = hipsolver_getrf_interleaved_plan<Blas, T>(handle, m, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(m == 0 || n == 0 || batch_count == 0)
+        return hipsolver_interleaved_quick_return(handle, info, batch_count);
+    if(!A || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    status = Blas::small_getrf(handle, m, n, A, lda, ipiv, info, batch_count);
+    if(status != HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return status;
+
+    T*  bwork;
+    int blwork;
+    status = hipsolver_interleaved_work<Blas>(handle, plan, &work, lwork, &bwork, &blwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    int  ld    = m, k = std::min(m, n);
+    T*   sA    = (T*)((char*)work + plan.A);
+    int* sipiv = ipiv ? (int*)((char*)work + plan.ipiv) : nullptr;
+
+    status = hipsolver_interleaved_gather<Blas>(handle, m, n, A, lda, sA, ld, ld * n, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_interleaved_getrf(
+        handle, m, n, sA, ld, ld * n, bwork, blwork, sipiv, k, info, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_interleaved_scatter<Blas>(handle, m, n, sA, ld, ld * n, A, lda, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(sipiv
+       && hipsolver_interleaved_pivots(stream, k, ipiv, sipiv, k, batch_count, false) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// getrs
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrs_interleaved_plan(hipsolverHandle_t           handle,
+                                                   hipsolverOperation_t        trans,
+                                                   int                         n,
+                                                   int                         nrhs,
+                                                   int                         lda,
+                                                   int                         ldb,
+                                                   int                         batch_count,
+                                                   hipsolver_interleaved_plan* plan)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nrhs < 0 || lda < std::max(n, 1) || ldb < std::max(n, 1) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    int ld = n, lwork;
+    plan->A    = plan->reserve(sizeof(T) * ld * n * batch_count);
+    plan->B    = plan->reserve(sizeof(T) * ld * nrhs * batch_count);
+    plan->ipiv = plan->reserve(sizeof(int) * n * batch_count);
+
+    hipsolverStatus_t status = hipsolver_interleaved_getrs_bufferSize(handle,
+                                                                      trans,
+                                                                      n,
+                                                                      nrhs,
+                                                                      (T*)nullptr,
+                                                                      ld,
+                                                                      ld * n,
+                                                                      nullptr,
+                                                                      n,
+                                                                      (T*)nullptr,
+                                                                      ld,
+                                                                      ld * nrhs,
+                                                                      &lwork,
+                                                                      batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    hipsolver_interleaved_finish<Blas, T>(plan, lwork);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrs_interleaved_bufferSize(hipsolverHandle_t    handle,
+                                                         hipsolverOperation_t trans,
+                                                         int                  n,
+                                                         int                  nrhs,
+                                                         int                  lda,
+                                                         int                  ldb,
+                                                         int*                 lwork,
+                                                         int                  batch_count)
+{
+    if(handle && !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status = hipsolver_getrs_interleaved_plan<Blas, T>(
+        handle, trans, n, nrhs, lda, ldb, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_interleaved_lwork<Blas, T>(plan, lwork);
+}
+
+/*! \brief Solves the batch_count systems of the interleaved batch B with the factors of the
+ *  interleaved batch A and the interleaved pivots ipiv computed by getrf. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrs_interleaved(hipsolverHandle_t    handle,
+                                              hipsolverOperation_t trans,
+                                              int                  n,
+                                              int                  nrhs,
+                                              T*                   A,
+                                              int                  lda,
+                                              int*                 ipiv,
+                                              T*                   B,
+                                              int                  ldb,
+                                              T*                   work,
+                                              int                  lwork,
+                                              int*                 info,
+                                              int                  batch_count)
+{
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status = hipsolver_getrs_interleaved_plan<Blas, T>(
+        handle, trans, n, nrhs, lda, ldb, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return hipsolver_interleaved_quick_return(handle, info, batch_count);
+    if(!A || !ipiv || !B || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    status = Blas::small_getrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+    if(status != HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return status;
+
+    T*  bwork;
+    int blwork;
+    status = hipsolver_interleaved_work<Blas>(handle, plan, &work, lwork, &bwork, &blwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    int  ld    = n;
+    T*   sA    = (T*)((char*)work + plan.A);
+    T*   sB    = (T*)((char*)work + plan.B);
+    int* sipiv = (int*)((char*)work + plan.ipiv);
+
+    status = hipsolver_interleaved_gather<Blas>(handle, n, n, A, lda, sA, ld, ld * n, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_interleaved_gather<Blas>(
+        handle, n, nrhs, B, ldb, sB, ld, ld * nrhs, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(hipsolver_interleaved_pivots(stream, n, ipiv, sipiv, n, batch_count, true) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    status = hipsolver_interleaved_getrs(handle,
+                                         trans,
+                                         n,
+                                         nrhs,
+                                         sA,
+                                         ld,
+                                         ld * n,
+                                         sipiv,
+                                         n,
+                                         sB,
+                                         ld,
+                                         ld * nrhs,
+                                         bwork,
+                                         blwork,
+                                         info,
+                                         batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_interleaved_scatter<Blas>(
+        handle, n, nrhs, sB, ld, ld * nrhs, B, ldb, batch_count);
+}
+
+// syevj
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_syevj_interleaved_plan(hipsolverHandle_t           handle,
+                                                   hipsolverEigMode_t          jobz,
+                                                   hipsolverFillMode_t         uplo,
+                                                   int                         n,
+                                                   int                         lda,
+                                                   hipsolverSyevjInfo_t        params,
+                                                   int                         batch_count,
+                                                   hipsolver_interleaved_plan* plan)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(n, 1) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    int ld = n, lwork;
+    plan->A = plan->reserve(sizeof(T) * ld * n * batch_count);
+    plan->W = plan->reserve(sizeof(S) * n * batch_count);
+
+    hipsolverStatus_t status = hipsolver_interleaved_syevj_bufferSize(
+        handle, jobz, uplo, n, (T*)nullptr, ld, (S*)nullptr, &lwork, params, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    hipsolver_interleaved_finish<Blas, T>(plan, lwork);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_syevj_interleaved_bufferSize(hipsolverHandle_t    handle,
+                                                         hipsolverEigMode_t   jobz,
+                                                         hipsolverFillMode_t  uplo,
+                                                         int                  n,
+                                                         T*                   A,
+                                                         int                  lda,
+                                                         S*                   W,
+                                                         int*                 lwork,
+                                                         hipsolverSyevjInfo_t params,
+                                                         int                  batch_count)
+{
+    if(handle && !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status = hipsolver_syevj_interleaved_plan<Blas, T, S>(
+        handle, jobz, uplo, n, lda, params, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_interleaved_lwork<Blas, T>(plan, lwork);
+}
+
+/*! \brief Eigenvalues, interleaved in W, and eigenvectors, if jobz is HIPSOLVER_EIG_MODE_VECTOR,
+ *  of the batch_count matrices of order n of the interleaved batch A. */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_syevj_interleaved(hipsolverHandle_t    handle,
+                                              hipsolverEigMode_t   jobz,
+                                              hipsolverFillMode_t  uplo,
+                                              int                  n,
+                                              T*                   A,
+                                              int                  lda,
+                                              S*                   W,
+                                              T*                   work,
+                                              int                  lwork,
+                                              int*                 info,
+                                              hipsolverSyevjInfo_t params,
+                                              int                  batch_count)
+{
+    hipsolver_interleaved_plan plan;
+    hipsolverStatus_t          status = hipsolver_syevj_interleaved_plan<Blas, T, S>(
+        handle, jobz, uplo, n, lda, params, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(n == 0 || batch_count == 0)
+        return hipsolver_interleaved_quick_return(handle, info, batch_count);
+    if(!A || !W || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    T*  bwork;
+    int blwork;
+    status = hipsolver_interleaved_work<Blas>(handle, plan, &work, lwork, &bwork, &blwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // syevjBatched takes the matrices with a stride of lda * n, and the eigenvalues with a
+    // stride of n
+    int ld = n;
+    T*  sA = (T*)((char*)work + plan.A);
+    S*  sW = (S*)((char*)work + plan.W);
+
+    status = hipsolver_interleaved_gather<Blas>(handle, n, n, A, lda, sA, ld, ld * n, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_interleaved_syevj(
+        handle, jobz, uplo, n, sA, ld, sW, bwork, blwork, info, params, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_interleaved_scatter<Blas>(handle, n, 1, sW, n, n, W, n, batch_count);
+    if(status != HIPSOLVER_STATUS_SUCCESS || jobz != HIPSOLVER_EIG_MODE_VECTOR)
+        return status;
+    return hipsolver_interleaved_scatter<Blas>(handle, n, n, sA, ld, ld * n, A, lda, batch_count);
+}
@@ -0,0 +1,649 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_markers.hpp"
+#include "hipsolver_workspace_stats.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <hip/hip_runtime_api.h>
+#include <initializer_list>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Layer mode. HIPSOLVER_LAYER is a bitmask of the modes below; it is read
+ *    once, and while it is zero an entry point only pays for one branch.
+ *
+ *    trace:   every call with all of its arguments
+ *    bench:   hipsolver-bench command lines that replay the calls
+ *    profile: call counts and summed GPU time per signature, written at exit
+ *    markers: roctx/NVTX ranges named after the call and its sizes, if the
+ *             library was built with HIPSOLVER_ENABLE_MARKERS
+ *
+ *    Each mode writes to stderr unless HIPSOLVER_LOG_TRACE_PATH,
+ *    HIPSOLVER_LOG_BENCH_PATH or HIPSOLVER_LOG_PROFILE_PATH name a file.
+ * ===========================================================================
+ */
+
+enum hipsolver_layer_mode
+{
+    hipsolver_layer_none    = 0,
+    hipsolver_layer_trace   = 1,
+    hipsolver_layer_bench   = 2,
+    hipsolver_layer_profile = 4,
+    hipsolver_layer_markers = 8,
+};
+
+/*! \brief Argument formatting. Pointers are printed as addresses, enums as the characters used
+ *  by hipsolver-bench. */
+inline void hipsolver_log_value(std::ostream& os, hipsolverOperation_t v)
+{
+    os << (v == HIPSOLVER_OP_N ? 'N' : v == HIPSOLVER_OP_T ? 'T' : v == HIPSOLVER_OP_C ? 'C' : '?');
+}
+inline void hipsolver_log_value(std::ostream& os, hipsolverFillMode_t v)
+{
+    os << (v == HIPSOLVER_FILL_MODE_UPPER ? 'U' : v == HIPSOLVER_FILL_MODE_LOWER ? 'L' : '?');
+}
+inline void hipsolver_log_value(std::ostream& os, hipsolverSideMode_t v)
+{
+    os << (v == HIPSOLVER_SIDE_LEFT ? 'L' : v == HIPSOLVER_SIDE_RIGHT ? 'R' : '?');
+}
+inline void hipsolver_log_value(std::ostream& os, hipsolverEigMode_t v)
+{
+    os << (v == HIPSOLVER_EIG_MODE_NOVECTOR ? 'N' : v == HIPSOLVER_EIG_MODE_VECTOR ? 'V' : '?');
+}
+inline void hipsolver_log_value(std::ostream& os, hipsolverEigType_t v)
+{
+    os << (v == HIPSOLVER_EIG_TYPE_1   ? '1'
+           : v == HIPSOLVER_EIG_TYPE_2 ? '2'
+           : v == HIPSOLVER_EIG_TYPE_3 ? '3'
+                                       : '?');
+}
+inline void hipsolver_log_value(std::ostream& os, hipsolverEigRange_t v)
+{
+    os << (v == HIPSOLVER_EIG_RANGE_ALL ? 'A'
+           : v == HIPSOLVER_EIG_RANGE_V ? 'V'
+           : v == HIPSOLVER_EIG_RANGE_I ? 'I'
+                                        : '?');
+}
+inline void hipsolver_log_value(std::ostream& os, hipsolverNormType_t v)
+{
+    os << (v == HIPSOLVER_NORM_ONE ? '1' : v == HIPSOLVER_NORM_INF ? 'I' : '?');
+}
+inline void hipsolver_log_value(std::ostream& os, char v)
+{
+    os << v;
+}
+inline void hipsolver_log_value(std::ostream& os, signed char v)
+{
+    os << char(v);
+}
+inline void hipsolver_log_value(std::ostream& os, int v)
+{
+    os << v;
+}
+inline void hipsolver_log_value(std::ostream& os, int64_t v)
+{
+    os << v;
+}
+inline void hipsolver_log_value(std::ostream& os, size_t v)
+{
+    os << v;
+}
+inline void hipsolver_log_value(std::ostream& os, double v)
+{
+    os << v;
+}
+template <typename T>
+inline void hipsolver_log_value(std::ostream& os, T* v)
+{
+    os << (const void*)v;
+}
+
+template <typename T>
+constexpr bool hipsolver_log_is_pointer(const T&)
+{
+    return false;
+}
+template <typename T>
+constexpr bool hipsolver_log_is_pointer(T* const&)
+{
+    return true;
+}
+
+class hipsolver_logger
+{
+    struct profile_entry
+    {
+        int64_t calls   = 0;
+        double  time_ms = 0;
+    };
+
+    struct pending_timing
+    {
+        profile_entry* entry;
+        hipEvent_t     start;
+        hipEvent_t     stop;
+    };
+
+    int                           mode;
+    std::mutex                    mutex;
+    std::unique_ptr<std::ostream> trace_file, bench_file, profile_file;
+    std::ostream*                 trace_os;
+    std::ostream*                 bench_os;
+    std::ostream*                 profile_os;
+
+    std::map<std::string, profile_entry> profile;
+    std::deque<pending_timing>           pending;
+    std::vector<hipEvent_t>              free_events;
+    bool                                 exit_registered = false;
+
+    static std::ostream* open_log(const char* var, std::unique_ptr<std::ostream>& file)
+    {
+        const char* path = std::getenv(var);
+        if(path && *path)
+        {
+            file.reset(new std::ofstream(path));
+            if(*file)
+                return file.get();
+        }
+        return &std::cerr;
+    }
+
+    hipsolver_logger()
+    {
+        const char* layer = std::getenv("HIPSOLVER_LAYER");
+        mode              = layer ? std::atoi(layer) : 0;
+
+        trace_os   = (mode & hipsolver_layer_trace)
+                         ? open_log("HIPSOLVER_LOG_TRACE_PATH", trace_file)
+                         : nullptr;
+        bench_os   = (mode & hipsolver_layer_bench)
+                         ? open_log("HIPSOLVER_LOG_BENCH_PATH", bench_file)
+                         : nullptr;
+        profile_os = (mode & hipsolver_layer_profile)
+                         ? open_log("HIPSOLVER_LOG_PROFILE_PATH", profile_file)
+                         : nullptr;
+    }
+
+    // writes the profile at exit; the logger itself is never destroyed, so that no event is
+    // touched during static destruction, after which the HIP runtime may be gone
+    static void write_profile()
+    {
+        hipsolver_logger&           logger = instance();
+        std::lock_guard<std::mutex> lock(logger.mutex);
+        logger.collect(true);
+
+        for(const auto& p : logger.profile)
+            *logger.profile_os << "- {" << p.first << ", calls: " << p.second.calls
+                               << ", gpu_time_us: " << p.second.time_ms * 1000 << "}\n";
+        logger.profile_os->flush();
+    }
+
+    // adds the completed timings to the profile, or waits for all of them if wait is true, and
+    // then also destroys the events that are no longer used
+    void collect(bool wait)
+    {
+        while(!pending.empty())
+        {
+            hipError_t status = wait ? hipEventSynchronize(pending.front().stop)
+                                     : hipEventQuery(pending.front().stop);
+            if(status == hipErrorNotReady)
+                break;
+            finish_timing(status == hipSuccess);
+        }
+
+        if(wait)
+        {
+            for(hipEvent_t e : free_events)
+                hipEventDestroy(e);
+            free_events.clear();
+        }
+    }
+
+    hipEvent_t get_event()
+    {
+        hipEvent_t e = nullptr;
+        if(!free_events.empty())
+        {
+            e = free_events.back();
+            free_events.pop_back();
+        }
+        else if(hipEventCreate(&e) != hipSuccess)
+            e = nullptr;
+        return e;
+    }
+
+    // adds the front pending timing to its profile entry
+    void finish_timing(bool completed)
+    {
+        pending_timing& t = pending.front();
+        float           ms;
+        if(completed && hipEventElapsedTime(&ms, t.start, t.stop) == hipSuccess)
+            t.entry->time_ms += ms;
+        free_events.push_back(t.start);
+        free_events.push_back(t.stop);
+        pending.pop_front();
+    }
+
+public:
+    static hipsolver_logger& instance()
+    {
+        static hipsolver_logger* logger = new hipsolver_logger;
+        return *logger;
+    }
+
+    static int layer_mode()
+    {
+        static const int mode = instance().mode;
+        return mode;
+    }
+
+    void trace(const std::string& line)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        *trace_os << line << std::endl;
+    }
+
+    void bench(const std::string& line)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        *bench_os << line << std::endl;
+    }
+
+    /*! \brief Counts a call of the given signature and, if stream is not being captured,
+     *  records an event that starts its timing. Returns the entry for end_profile. */
+    void* begin_profile(const std::string& signature, hipStream_t stream, hipEvent_t* start)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        profile_entry&              entry = profile[signature];
+        entry.calls++;
+
+        *start = nullptr;
+        if(!hipsolver_stream_is_capturing(stream))
+        {
+            *start = get_event();
+            if(*start && hipEventRecord(*start, stream) != hipSuccess)
+            {
+                free_events.push_back(*start);
+                *start = nullptr;
+            }
+        }
+
+        // registered once the runtime is in use, so that the profile is written before the
+        // runtime is torn down
+        if(!exit_registered)
+            exit_registered = std::atexit(write_profile) == 0;
+        return &entry;
+    }
+
+    /*! \brief Ends the timing started by begin_profile. Completed timings are collected
+     *  without waiting for the device. */
+    void end_profile(void* entry, hipStream_t stream, hipEvent_t start)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(start)
+        {
+            hipEvent_t stop = get_event();
+            if(stop && hipEventRecord(stop, stream) == hipSuccess)
+                pending.push_back({(profile_entry*)entry, start, stop});
+            else
+            {
+                free_events.push_back(start);
+                if(stop)
+                    free_events.push_back(stop);
+            }
+        }
+
+        collect(false);
+    }
+
+    /*! \brief Waits for the timings in flight and releases the events of the profile. Called
+     *  when a handle is destroyed, while the runtime is known to be alive. */
+    void flush_profile()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        collect(true);
+    }
+};
+
+/*! \brief Logs one call of a public entry point while it is in scope. Nested entry points,
+ *  such as the bufferSize queries made by functions called without a work array, are not
+ *  logged separately. */
+class hipsolver_log_scope
+{
+    static int& depth()
+    {
+        static thread_local int d = 0;
+        return d;
+    }
+
+    bool        active = false;
+    bool        marked = false;
+    void*       entry  = nullptr;
+    hipStream_t stream = nullptr;
+    hipEvent_t  start  = nullptr;
+
+    // splits the stringized argument list into names
+    static std::vector<std::string> split_names(const char* names)
+    {
+        std::vector<std::string> result;
+        std::istringstream       ss(names);
+        std::string              name;
+        while(std::getline(ss, name, ','))
+        {
+            name.erase(0, name.find_first_not_of(' '));
+            name.erase(name.find_last_not_of(' ') + 1);
+            result.push_back(name);
+        }
+        return result;
+    }
+
+    // the hipsolver-bench function and precision that replay a public entry point; the
+    // generic API takes its precision, 0 here, from the data type of A, and names some of its
+    // functions differently for complex data
+    struct bench_name
+    {
+        const char* function;
+        const char* complex_function;
+        char        precision;
+    };
+
+    static const std::unordered_map<std::string, bench_name>& bench_names()
+    {
+        // the name of the routine after the precision, and the hipsolver-bench function
+        static const char* const all[][2] = {
+            {"gebrd", "gebrd"},
+            {"gebrdBatched", "gebrd_batched"},
+            {"gebrdStridedBatched", "gebrd_strided_batched"},
+            {"gelsStridedBatched", "gels_strided_batched"},
+            {"geqrf", "geqrf"},
+            {"geqrfBatched", "geqrf_batched"},
+            {"geqrfStridedBatched", "geqrf_strided_batched"},
+            {"gesvd", "gesvd"},
+            {"gesvd_64", "gesvd"},
+            {"gesvdStridedBatched", "gesvd_strided_batched"},
+            {"gesvdj", "gesvdj"},
+            {"gesvdjBatched", "gesvdj_batched"},
+            {"getrf", "getrf"},
+            {"getrfBatched", "getrf_batched"},
+            {"getrfStridedBatched", "getrf_strided_batched"},
+            {"getri", "getri"},
+            {"getriOutOfPlaceBatched", "getri_outofplace_batched"},
+            {"getriOutOfPlaceStridedBatched", "getri_outofplace_strided_batched"},
+            {"getrs", "getrs"},
+            {"getrsBatched", "getrs_batched"},
+            {"getrsStridedBatched", "getrs_strided_batched"},
+            {"potrf", "potrf"},
+            {"potrf_64", "potrf"},
+            {"potrfBatched", "potrf_batched"},
+            {"potri", "potri"},
+            {"potrs", "potrs"},
+            {"potrsBatched", "potrs_batched"},
+            {"sytrf", "sytrf"},
+            {"sytrs", "sytrs"},
+        };
+        static const char* const real[][2] = {
+            {"orgbr", "orgbr"},
+            {"orgbrBatched", "orgbr_batched"},
+            {"orgbrStridedBatched", "orgbr_strided_batched"},
+            {"orgqr", "orgqr"},
+            {"orgqrBatched", "orgqr_batched"},
+            {"orgqrStridedBatched", "orgqr_strided_batched"},
+            {"orgtr", "orgtr"},
+            {"orgtrBatched", "orgtr_batched"},
+            {"orgtrStridedBatched", "orgtr_strided_batched"},
+            {"ormqr", "ormqr"},
+            {"ormqrBatched", "ormqr_batched"},
+            {"ormqrStridedBatched", "ormqr_strided_batched"},
+            {"ormtr", "ormtr"},
+            {"syevd", "syevd"},
+            {"syevd_64", "syevd"},
+            {"syevdBatched", "syevd_batched"},
+            {"syevdStridedBatched", "syevd_strided_batched"},
+            {"syevdx", "syevdx"},
+            {"syevj", "syevj"},
+            {"syevjBatched", "syevj_batched"},
+            {"sygvd", "sygvd"},
+            {"sygvdStridedBatched", "sygvd_strided_batched"},
+            {"sygvdFactoredStridedBatched", "sygvd_factored"},
+            {"sygvdx", "sygvdx"},
+            {"sytrd", "sytrd"},
+            {"sytrdBatched", "sytrd_batched"},
+            {"sytrdStridedBatched", "sytrd_strided_batched"},
+        };
+        static const char* const complex[][2] = {
+            {"ungbr", "ungbr"},
+            {"ungbrBatched", "ungbr_batched"},
+            {"ungbrStridedBatched", "ungbr_strided_batched"},
+            {"ungqr", "ungqr"},
+            {"ungqrBatched", "ungqr_batched"},
+            {"ungqrStridedBatched", "ungqr_strided_batched"},
+            {"ungtr", "ungtr"},
+            {"ungtrBatched", "ungtr_batched"},
+            {"ungtrStridedBatched", "ungtr_strided_batched"},
+            {"unmqr", "unmqr"},
+            {"unmqrBatched", "unmqr_batched"},
+            {"unmqrStridedBatched", "unmqr_strided_batched"},
+            {"unmtr", "unmtr"},
+            {"heevd", "heevd"},
+            {"heevd_64", "heevd"},
+            {"heevdBatched", "heevd_batched"},
+            {"heevdStridedBatched", "heevd_strided_batched"},
+            {"heevdx", "heevdx"},
+            {"heevj", "heevj"},
+            {"heevjBatched", "heevj_batched"},
+            {"hegvd", "hegvd"},
+            {"hegvdStridedBatched", "hegvd_strided_batched"},
+            {"hegvdFactoredStridedBatched", "hegvd_factored"},
+            {"hegvdx", "hegvdx"},
+            {"hetrd", "hetrd"},
+            {"hetrdBatched", "hetrd_batched"},
+            {"hetrdStridedBatched", "hetrd_strided_batched"},
+        };
+
+        static const std::unordered_map<std::string, bench_name> names = [] {
+            std::unordered_map<std::string, bench_name> m;
+            auto add = [&m](const char* precisions, const char* const(*table)[2], size_t size) {
+                for(const char* p = precisions; *p; p++)
+                    for(size_t i = 0; i < size; i++)
+                        m[std::string("hipsolver") + *p + table[i][0]]
+                            = {table[i][1], table[i][1], char(*p - 'A' + 'a')};
+            };
+            add("SDCZ", all, sizeof(all) / sizeof(all[0]));
+            add("SD", real, sizeof(real) / sizeof(real[0]));
+            add("CZ", complex, sizeof(complex) / sizeof(complex[0]));
+
+            // the mixed-precision functions are replayed in the precision of their data
+            m["hipsolverSSgels"] = {"gels", "gels", 's'};
+            m["hipsolverDDgels"] = {"gels", "gels", 'd'};
+            m["hipsolverCCgels"] = {"gels", "gels", 'c'};
+            m["hipsolverZZgels"] = {"gels", "gels", 'z'};
+            m["hipsolverDSgesv"] = {"gesv", "gesv", 'd'};
+            m["hipsolverZCgesv"] = {"gesv", "gesv", 'z'};
+
+            m["hipsolverDnXgetrf"] = {"getrf", "getrf", 0};
+            m["hipsolverDnXpotrf"] = {"potrf", "potrf", 0};
+            m["hipsolverDnXsyevd"] = {"syevd", "heevd", 0};
+            return m;
+        }();
+        return names;
+    }
+
+    // the precision of a hipDataType, or 0 for any other argument
+    template <typename T>
+    static char data_precision(const T&)
+    {
+        return 0;
+    }
+    static char data_precision(const hipDataType& type)
+    {
+        return type == HIP_R_32F   ? 's'
+               : type == HIP_R_64F ? 'd'
+               : type == HIP_C_32F ? 'c'
+               : type == HIP_C_64F ? 'z'
+                                   : 0;
+    }
+
+    // sets options to the hipsolver-bench options, e.g. -f getrf_strided_batched -r d, that
+    // replay the call of func with the given argument names and data precisions; returns false
+    // if the call cannot be replayed, as for workspace queries and plans
+    static bool bench_function(const char*                     func,
+                               const std::vector<std::string>& arg_names,
+                               const std::vector<char>&        precisions,
+                               std::string&                    options)
+    {
+        auto it = bench_names().find(func);
+        if(it == bench_names().end())
+            return false;
+
+        const bench_name& name      = it->second;
+        char              precision = name.precision;
+        for(size_t j = 0; !precision && j < arg_names.size(); j++)
+            if(arg_names[j] == "dataTypeA")
+                precision = precisions[j];
+        if(!precision)
+            return false;
+
+        bool complex = precision == 'c' || precision == 'z';
+        options      = std::string("-f ") + (complex ? name.complex_function : name.function)
+                  + " -r " + precision;
+        return true;
+    }
+
+    template <typename T>
+    static std::string format(const T& v)
+    {
+        std::ostringstream os;
+        hipsolver_log_value(os, v);
+        return os.str();
+    }
+
+    static bool bench_option(const std::string& name)
+    {
+        static const char* options[]
+            = {"m",    "n",     "k",    "nrhs", "lda",  "ldb",  "ldc",   "ldu",  "ldv",
+               "ldx",  "uplo",  "trans", "side", "jobz", "jobu", "jobv", "itype", "econ",
+               "range", "vl",   "vu",   "il",   "iu",   "batch_count"};
+        for(const char* o : options)
+            if(name == o)
+                return true;
+        return false;
+    }
+
+    template <typename... Ts>
+    void log(hipsolverHandle_t handle, const char* func, const char* names, const Ts&... args)
+    {
+        int                      mode      = hipsolver_logger::layer_mode();
+        std::vector<std::string> arg_names = split_names(names);
+        std::vector<std::string> values;
+        std::vector<bool>        is_ptr;
+        std::vector<char>        precisions;
+        (void)std::initializer_list<int>{(values.push_back(format(args)),
+                                          is_ptr.push_back(hipsolver_log_is_pointer(args)),
+                                          precisions.push_back(data_precision(args)),
+                                          0)...};
+
+        if(mode & hipsolver_layer_trace)
+        {
+            std::ostringstream line;
+            line << func << "(handle=" << (const void*)handle;
+            for(size_t j = 0; j < sizeof...(Ts); j++)
+                line << ", " << arg_names[j] << "=" << values[j];
+            line << ")";
+            hipsolver_logger::instance().trace(line.str());
+        }
+
+        std::string options;
+        if((mode & hipsolver_layer_bench) && bench_function(func, arg_names, precisions, options))
+        {
+            std::ostringstream line;
+            line << "hipsolver-bench " << options;
+            for(size_t j = 0; j < sizeof...(Ts); j++)
+                if(bench_option(arg_names[j]))
+                    line << (arg_names[j].size() == 1 ? " -" : " --") << arg_names[j] << " "
+                         << values[j];
+            hipsolver_logger::instance().bench(line.str());
+        }
+
+        if(mode & hipsolver_layer_profile)
+        {
+            std::ostringstream signature;
+            signature << "function: " << func;
+            for(size_t j = 0; j < sizeof...(Ts); j++)
+                if(!is_ptr[j] && arg_names[j] != "lwork")
+                    signature << ", " << arg_names[j] << ": " << values[j];
+
+            if(!handle || hipsolverGetStream(handle, &stream) != HIPSOLVER_STATUS_SUCCESS)
+                stream = nullptr;
+            entry = hipsolver_logger::instance().begin_profile(signature.str(), stream, &start);
+        }
+
+        if(mode & hipsolver_layer_markers)
+        {
+            // the range name carries the problem sizes, e.g. hipsolverDsyevd n=1000
+            std::ostringstream range;
+            range << func;
+            for(size_t j = 0; j < sizeof...(Ts); j++)
+                if(arg_names[j] == "m" || arg_names[j] == "n" || arg_names[j] == "k"
+                   || arg_names[j] == "nrhs" || arg_names[j] == "batch_count")
+                    range << " " << arg_names[j] << "=" << values[j];
+            hipsolver_marker_push(range.str().c_str());
+            marked = true;
+        }
+    }
+
+public:
+    template <typename... Ts>
+    hipsolver_log_scope(hipsolverHandle_t handle,
+                        const char*       func,
+                        const char*       names,
+                        const Ts&... args)
+    {
+        if(!hipsolver_logger::layer_mode() || depth()++ > 0)
+            return;
+
+        active = true;
+        log(handle, func, names, args...);
+    }
+
+    ~hipsolver_log_scope()
+    {
+        if(!active)
+        {
+            if(hipsolver_logger::layer_mode())
+                depth()--;
+            return;
+        }
+
+        if(entry)
+            hipsolver_logger::instance().end_profile(entry, stream, start);
+        if(marked)
+            hipsolver_marker_pop();
+        depth()--;
+    }
+
+    hipsolver_log_scope(const hipsolver_log_scope&) = delete;
+    hipsolver_log_scope& operator=(const hipsolver_log_scope&) = delete;
+};
+
+/*! \brief Logs the enclosing entry point according to HIPSOLVER_LAYER and attributes the
+ *  workspace it takes from the handle to it. The arguments after the handle are the remaining
+ *  parameters of the function, in order. */
+#define HIPSOLVER_LOG_SCOPE(handle, ...)                        \
+    hipsolver_routine_scope hipsolver_routine_scope_(__func__); \
+    hipsolver_log_scope     hipsolver_log_scope_(handle, __func__, #__VA_ARGS__, __VA_ARGS__)
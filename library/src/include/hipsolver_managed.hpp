@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <initializer_list>
+#include <vector>
+
+/*
+ * ===========================================================================
+ *    Managed memory mode. On devices that share memory with the host, such as
+ *    APUs, arrays allocated with hipMallocManaged may be passed directly to the
+ *    library. Their pages then migrate on demand, one fault at a time, while
+ *    the kernels run. A handle in a managed memory mode looks at the array
+ *    arguments of each call instead: the part of each managed array that the
+ *    call may access is advised to be accessed by the device and prefetched
+ *    to it on the stream of the handle, ahead of the computation, and in
+ *    HIPSOLVER_MANAGED_MEMORY_PREFETCH_RETURN the results are prefetched back
+ *    to the host after it. Each entry point names the arguments it reads and
+ *    the ones it writes, with their extents; workspace arguments are read.
+ *
+ *    As long as no handle is in a managed memory mode, an entry point only
+ *    pays for one atomic load.
+ * ===========================================================================
+ */
+
+/*! \brief Number of handles whose managed memory mode is not HIPSOLVER_MANAGED_MEMORY_OFF. */
+inline std::atomic<int>& hipsolver_managed_handles()
+{
+    static std::atomic<int> count(0);
+    return count;
+}
+
+/*! \brief Managed memory mode of a handle, counted in hipsolver_managed_handles while it is
+ *  enabled. */
+class hipsolver_managed_setting
+{
+    hipsolverManagedMemoryMode_t m_mode = HIPSOLVER_MANAGED_MEMORY_OFF;
+
+public:
+    hipsolver_managed_setting() = default;
+
+    hipsolver_managed_setting(const hipsolver_managed_setting&) = delete;
+    hipsolver_managed_setting& operator=(const hipsolver_managed_setting&) = delete;
+
+    ~hipsolver_managed_setting()
+    {
+        set(HIPSOLVER_MANAGED_MEMORY_OFF);
+    }
+
+    void set(hipsolverManagedMemoryMode_t mode)
+    {
+        bool was_on = m_mode != HIPSOLVER_MANAGED_MEMORY_OFF;
+        bool is_on  = mode != HIPSOLVER_MANAGED_MEMORY_OFF;
+        if(is_on && !was_on)
+            hipsolver_managed_handles()++;
+        else if(was_on && !is_on)
+            hipsolver_managed_handles()--;
+        m_mode = mode;
+    }
+
+    hipsolverManagedMemoryMode_t get() const
+    {
+        return m_mode;
+    }
+};
+
+/*! \brief An array argument of an entry point, with the number of bytes of it that the entry
+ *  point may access. Only those bytes are prefetched, so that an array carved out of a larger
+ *  managed allocation does not move the rest of the allocation. */
+struct hipsolver_managed_arg
+{
+    const void* ptr;
+    size_t      bytes;
+
+    // count entries of type T, or none if count is not positive
+    template <typename T>
+    hipsolver_managed_arg(const T* ptr, int64_t count)
+        : ptr(ptr)
+        , bytes(count > 0 ? sizeof(T) * size_t(count) : 0)
+    {
+    }
+
+    // the n columns of a matrix of leading dimension ld, or the batch_count matrices of a strided
+    // batch, stride apart
+    template <typename T>
+    hipsolver_managed_arg(const T* ptr, int64_t ld, int64_t n)
+        : hipsolver_managed_arg(ptr, ld > 0 && n > 0 ? ld * n : 0)
+    {
+    }
+
+    // an untyped array of the given size in bytes
+    hipsolver_managed_arg(const void* ptr, size_t bytes)
+        : ptr(ptr)
+        , bytes(bytes)
+    {
+    }
+
+    /*! \brief An array whose extent is only known on the device, such as the pivots of a
+     *  variable-size batch, which extends to the end of its allocation. */
+    static hipsolver_managed_arg rest(const void* ptr)
+    {
+        return hipsolver_managed_arg(ptr, SIZE_MAX);
+    }
+};
+
+/*! \brief Size in bytes of the entries of an array of type type, or 0 if it is not supported. */
+inline size_t hipsolver_managed_type_size(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+        return 8;
+    case HIP_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+/*! \brief Prefetches the managed arguments of a public entry point while it is in scope.
+
+    The entry point lists its array arguments explicitly, with their extents: the ones it only
+    reads, including its workspace, and the ones it writes. The rest of the entry point is passed
+    to run, whose status tells whether the outputs are returned to the host: they are not if it
+    returned an error or threw. Nested entry points leave the arguments to the outermost one.
+
+    The pointer array of a batched entry point is prefetched like any other argument, but the
+    matrices it points to are not, as reading the array back to the host would synchronize the
+    stream; they migrate on demand. */
+class hipsolver_managed_scope
+{
+    struct range
+    {
+        const void* begin;
+        size_t      size;
+        bool        output;
+    };
+
+    static int& depth()
+    {
+        static thread_local int d = 0;
+        return d;
+    }
+
+    bool               counted   = false;
+    bool               succeeded = false;
+    int                device;
+    hipStream_t        stream;
+    std::vector<range> ranges;
+
+    // the hints are best effort; a failed one is not left as the last error of the thread
+    static void hint(hipError_t err)
+    {
+        if(err != hipSuccess)
+            (void)hipGetLastError();
+    }
+
+    void add(const hipsolver_managed_arg& arg, bool output)
+    {
+        if(!arg.ptr || !arg.bytes)
+            return;
+
+        // host memory that is not known to the runtime cannot be queried
+        hipPointerAttribute_t attr;
+        hipError_t            err = hipPointerGetAttributes(&attr, arg.ptr);
+        hint(err);
+        if(err != hipSuccess || !attr.isManaged)
+            return;
+
+        hipDeviceptr_t base;
+        size_t         size;
+        err = hipMemGetAddressRange(&base, &size, (hipDeviceptr_t)arg.ptr);
+        hint(err);
+        if(err != hipSuccess)
+            return;
+
+        // the extent is clipped to the allocation
+        size_t offset = (const char*)arg.ptr - (const char*)base;
+        size_t bytes  = std::min(arg.bytes, size - offset);
+        for(range& r : ranges)
+        {
+            if(r.begin == arg.ptr && r.size == bytes)
+            {
+                r.output = r.output || output;
+                return;
+            }
+        }
+        ranges.push_back({arg.ptr, bytes, output});
+
+        hint(hipMemAdvise(arg.ptr, bytes, hipMemAdviseSetAccessedBy, device));
+        hint(hipMemPrefetchAsync(arg.ptr, bytes, device, stream));
+    }
+
+public:
+    hipsolver_managed_scope(hipsolverHandle_t                            handle,
+                            std::initializer_list<hipsolver_managed_arg> inputs,
+                            std::initializer_list<hipsolver_managed_arg> outputs)
+    {
+        if(!hipsolver_managed_handles().load(std::memory_order_relaxed))
+            return;
+
+        counted = true;
+        if(depth()++ > 0 || !handle)
+            return;
+
+        hipsolverManagedMemoryMode_t mode;
+        if(hipsolverGetManagedMemoryMode(handle, &mode) != HIPSOLVER_STATUS_SUCCESS
+           || mode == HIPSOLVER_MANAGED_MEMORY_OFF)
+            return;
+
+        // prefetches cannot be recorded into a graph
+        if(hipsolverGetStream(handle, &stream) != HIPSOLVER_STATUS_SUCCESS
+           || hipsolver_stream_is_capturing(stream) || hipGetDevice(&device) != hipSuccess)
+            return;
+
+        bool returned = mode == HIPSOLVER_MANAGED_MEMORY_PREFETCH_RETURN;
+        for(const hipsolver_managed_arg& arg : inputs)
+            add(arg, false);
+        for(const hipsolver_managed_arg& arg : outputs)
+            add(arg, returned);
+    }
+
+    ~hipsolver_managed_scope()
+    {
+        if(counted)
+            depth()--;
+
+        if(!succeeded)
+            return;
+
+        for(const range& r : ranges)
+            if(r.output)
+                hint(hipMemPrefetchAsync(r.begin, r.size, hipCpuDeviceId, stream));
+    }
+
+    hipsolver_managed_scope(const hipsolver_managed_scope&) = delete;
+    hipsolver_managed_scope& operator=(const hipsolver_managed_scope&) = delete;
+
+    /*! \brief Returns the status of body, the rest of the entry point. */
+    template <typename F>
+    hipsolverStatus_t run(F body)
+    {
+        hipsolverStatus_t status = body();
+        succeeded                = status == HIPSOLVER_STATUS_SUCCESS;
+        return status;
+    }
+};
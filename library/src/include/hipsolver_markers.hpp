@@ -0,0 +1,46 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+/*
+ * ===========================================================================
+ *    Profiler ranges. When hipSOLVER is built with HIPSOLVER_ENABLE_MARKERS,
+ *    the entry points selected by the markers layer mode push a roctx range
+ *    on AMD, or an NVTX range on NVIDIA, that encloses all the work of the
+ *    call. Otherwise these functions do nothing.
+ * ===========================================================================
+ */
+
+#ifdef HIPSOLVER_MARKERS
+#ifdef __HIP_PLATFORM_NVCC__
+#include <nvToolsExt.h>
+#else
+#include <roctracer/roctx.h>
+#endif
+#endif
+
+inline void hipsolver_marker_push(const char* name)
+{
+#ifdef HIPSOLVER_MARKERS
+#ifdef __HIP_PLATFORM_NVCC__
+    nvtxRangePushA(name);
+#else
+    roctxRangePushA(name);
+#endif
+#else
+    (void)name;
+#endif
+}
+
+inline void hipsolver_marker_pop()
+{
+#ifdef HIPSOLVER_MARKERS
+#ifdef __HIP_PLATFORM_NVCC__
+    nvtxRangePop();
+#else
+    roctxRangePop();
+#endif
+#endif
+}
@@ -0,0 +1,715 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Out-of-core factorizations.
+ *
+ * The matrix stays in host memory and is factorized by column panels (row panels for the upper
+ * triangle of potrf) with a left-looking algorithm: every panel is updated on the device with
+ * the factored panels to its left, which are streamed through two device buffers, and is then
+ * factorized in core and copied back. The copies run on a stream of their own, ordered with the
+ * stream of the handle by events, so that the transfer of the next panel overlaps with the update
+ * by the current one. Every panel, double buffer and in-core workspace fits in the given budget
+ * of device memory.
+ *
+ * The host matrix is page-locked for the duration of the call when the system allows it;
+ * pageable memory gives the same results with less overlap. The pivots of getrf are applied to
+ * the rest of the host matrix by the host after each panel, so that every panel is loaded with
+ * the row order of the factorization so far.
+ *
+ * The BLAS of the back-end are reached through the Blas policy, which provides the updates
+ * C = C - op(A) * op(B) and C = C - op(A) * op(A)^H, the triangular solves, and the size in bytes
+ * of the workspace of the in-core factorizations.
+ */
+
+/******************** IN-CORE DISPATCH ********************/
+inline hipsolverStatus_t hipsolver_ooc_potrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork)
+{
+    return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_potrf_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, int* lwork)
+{
+    return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_potrf_bufferSize(hipsolverHandle_t   handle,
+                                                        hipsolverFillMode_t uplo,
+                                                        int                 n,
+                                                        hipsolverComplex*   A,
+                                                        int                 lda,
+                                                        int*                lwork)
+{
+    return hipsolverCpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_potrf_bufferSize(hipsolverHandle_t       handle,
+                                                        hipsolverFillMode_t     uplo,
+                                                        int                     n,
+                                                        hipsolverDoubleComplex* A,
+                                                        int                     lda,
+                                                        int*                    lwork)
+{
+    return hipsolverZpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_potrf(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             float*              work,
+                                             int                 lwork,
+                                             int*                devInfo)
+{
+    return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_potrf(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             double*             work,
+                                             int                 lwork,
+                                             int*                devInfo)
+{
+    return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_potrf(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipsolverComplex*   A,
+                                             int                 lda,
+                                             hipsolverComplex*   work,
+                                             int                 lwork,
+                                             int*                devInfo)
+{
+    return hipsolverCpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_potrf(hipsolverHandle_t       handle,
+                                             hipsolverFillMode_t     uplo,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             hipsolverDoubleComplex* work,
+                                             int                     lwork,
+                                             int*                    devInfo)
+{
+    return hipsolverZpotrf(handle, uplo, n, A, lda, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+{
+    return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+{
+    return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    return hipsolverCgetrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+{
+    return hipsolverZgetrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             float*            work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo)
+{
+    return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             double*           work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo)
+{
+    return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipsolverComplex* A,
+                                             int               lda,
+                                             hipsolverComplex* work,
+                                             int               lwork,
+                                             int*              devIpiv,
+                                             int*              devInfo)
+{
+    return hipsolverCgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_ooc_getrf(hipsolverHandle_t       handle,
+                                             int                     m,
+                                             int                     n,
+                                             hipsolverDoubleComplex* A,
+                                             int                     lda,
+                                             hipsolverDoubleComplex* work,
+                                             int                     lwork,
+                                             int*                    devIpiv,
+                                             int*                    devInfo)
+{
+    return hipsolverZgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
+}
+
+/******************** HELPERS ********************/
+/*! \brief The conjugate transpose, which is the transpose for real types. */
+template <typename T>
+constexpr hipsolverOperation_t hipsolver_ooc_op_c()
+{
+    return HIPSOLVER_OP_T;
+}
+
+template <>
+constexpr hipsolverOperation_t hipsolver_ooc_op_c<hipsolverComplex>()
+{
+    return HIPSOLVER_OP_C;
+}
+
+template <>
+constexpr hipsolverOperation_t hipsolver_ooc_op_c<hipsolverDoubleComplex>()
+{
+    return HIPSOLVER_OP_C;
+}
+
+/*! \brief Copies a rows x cols block between a host and a device matrix on stream. */
+template <typename T>
+inline hipError_t hipsolver_ooc_copy(T*            dst,
+                                     size_t        ldd,
+                                     const T*      src,
+                                     size_t        lds,
+                                     int           rows,
+                                     int           cols,
+                                     hipMemcpyKind kind,
+                                     hipStream_t   stream)
+{
+    if(rows == 0 || cols == 0)
+        return hipSuccess;
+    return hipMemcpy2DAsync(
+        dst, sizeof(T) * ldd, src, sizeof(T) * lds, sizeof(T) * rows, cols, kind, stream);
+}
+
+/*! \brief Applies the row interchanges k0 to k1 - 1 of ipiv to columns c0 to c1 - 1 of the host
+ *  matrix A, one column at a time. */
+template <typename T>
+inline void hipsolver_ooc_laswp(T* A, int lda, int c0, int c1, int k0, int k1, const int* ipiv)
+{
+    for(int c = c0; c < c1; c++)
+    {
+        T* col = A + size_t(c) * lda;
+        for(int i = k0; i < k1; i++)
+        {
+            int p = ipiv[i] - 1;
+            if(p != i)
+                std::swap(col[i], col[p]);
+        }
+    }
+}
+
+/*! \brief Device memory, copy stream and events of an out-of-core factorization. The host
+ *  matrix is page-locked while the context exists. */
+class hipsolver_ooc_context
+{
+    void* m_device = nullptr;
+    void* m_host   = nullptr; // only set if the registration was made by the context
+
+public:
+    hipStream_t copy        = nullptr;
+    hipEvent_t  ready       = nullptr; // the panel has been loaded
+    hipEvent_t  done        = nullptr; // the panel has been factorized
+    hipEvent_t  loaded[2]   = {nullptr, nullptr};
+    hipEvent_t  consumed[2] = {nullptr, nullptr};
+
+    hipsolver_ooc_context() = default;
+
+    hipsolver_ooc_context(const hipsolver_ooc_context&) = delete;
+    hipsolver_ooc_context& operator=(const hipsolver_ooc_context&) = delete;
+
+    ~hipsolver_ooc_context()
+    {
+        if(copy)
+        {
+            hipStreamSynchronize(copy);
+            hipStreamDestroy(copy);
+        }
+        for(hipEvent_t event : {ready, done, loaded[0], loaded[1], consumed[0], consumed[1]})
+            if(event)
+                hipEventDestroy(event);
+        if(m_device)
+            hipFree(m_device);
+        if(m_host)
+            hipHostUnregister(m_host);
+    }
+
+    hipsolverStatus_t init(void* host, size_t host_size, size_t device_size)
+    {
+        // the copies of pageable memory are staged, but still correct
+        if(hipHostRegister(host, host_size, hipHostRegisterDefault) == hipSuccess)
+            m_host = host;
+
+        if(hipMalloc(&m_device, device_size) != hipSuccess)
+        {
+            m_device = nullptr;
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        }
+
+        if(hipStreamCreateWithFlags(&copy, hipStreamNonBlocking) != hipSuccess)
+        {
+            copy = nullptr;
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+        for(hipEvent_t* event : {&ready, &done, &loaded[0], &loaded[1], &consumed[0], &consumed[1]})
+        {
+            if(hipEventCreateWithFlags(event, hipEventDisableTiming) != hipSuccess)
+            {
+                *event = nullptr;
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            }
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    /*! \brief Returns the device memory at offset bytes. */
+    template <typename T>
+    T* device(size_t offset) const
+    {
+        return (T*)((char*)m_device + offset);
+    }
+};
+
+/*! \brief Device memory of a panel factorization, with every part aligned to 256 bytes. */
+struct hipsolver_ooc_layout
+{
+    size_t panel = 0; // offset of the current panel; the two buffers and the rest follow
+    size_t buffer[2];
+    size_t work;
+    size_t ipiv;
+    size_t info;
+    size_t size;
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+
+    hipsolver_ooc_layout(size_t panel_size, size_t work_size, int nb)
+    {
+        buffer[0] = align(panel_size);
+        buffer[1] = buffer[0] + align(panel_size);
+        work      = buffer[1] + align(panel_size);
+        ipiv      = work + align(work_size);
+        info      = ipiv + align(sizeof(int) * nb);
+        size      = info + align(sizeof(int));
+    }
+};
+
+/*! \brief Finds the widest panel of at most n columns of rows elements such that its layout
+ *  fits in budget bytes. lwork_of(nb, &lwork) returns the workspace size of the in-core
+ *  factorization of a panel of width nb, which Blas::work_size converts into bytes. */
+template <typename Blas, typename T, typename F>
+hipsolverStatus_t
+    hipsolver_ooc_width(size_t budget, int rows, int n, F lwork_of, int* nb, int* lwork)
+{
+    size_t column = sizeof(T) * size_t(std::max(rows, 1));
+
+    // a priori estimate, ignoring the workspace; panels of a multiple of 32 columns run faster
+    size_t width = std::min(size_t(n), budget / (3 * column));
+    if(width > 64)
+        width -= width % 32;
+
+    while(width > 0)
+    {
+        hipsolverStatus_t status = lwork_of(int(width), lwork);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        size_t               work_size = Blas::work_size(*lwork, sizeof(T));
+        hipsolver_ooc_layout layout(column * width, work_size, int(width));
+        if(layout.size <= budget)
+        {
+            *nb = int(width);
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+
+        // shrink the panels by the columns that are missing, which is at least one
+        size_t missing = (layout.size - budget + 3 * column - 1) / (3 * column);
+        width          = width > missing ? width - missing : 0;
+    }
+
+    // the budget cannot hold a single column of the matrix
+    return HIPSOLVER_STATUS_INVALID_VALUE;
+}
+
+/******************** POTRF ********************/
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_ooc(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      T*                  A,
+                                      int                 lda,
+                                      size_t              budget,
+                                      int*                info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || lda < std::max(n, 1) || !info || (n > 0 && !A))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // quick return
+    *info = 0;
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    hipsolver_forbid_capture(stream);
+
+    // lower panels are the columns j to j + jb - 1 of rows j to n - 1, stored with leading
+    // dimension n - j; upper panels are the rows j to j + jb - 1 of columns j to n - 1, stored
+    // with leading dimension jb
+    const bool                 lower = uplo == HIPSOLVER_FILL_MODE_LOWER;
+    const hipsolverOperation_t opC   = hipsolver_ooc_op_c<T>();
+
+    int nb, lwork;
+    status = hipsolver_ooc_width<Blas, T>(
+        budget,
+        n,
+        n,
+        [&](int w, int* lw) {
+            return hipsolver_ooc_potrf_bufferSize(handle, uplo, w, (T*)nullptr, lower ? n : w, lw);
+        },
+        &nb,
+        &lwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipsolver_ooc_layout  layout(sizeof(T) * n * nb, Blas::work_size(lwork, sizeof(T)), nb);
+    hipsolver_ooc_context ctx;
+    status = ctx.init(A, sizeof(T) * (size_t(lda) * (n - 1) + n), layout.size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    T*   P     = ctx.device<T>(layout.panel);
+    T*   L[2]  = {ctx.device<T>(layout.buffer[0]), ctx.device<T>(layout.buffer[1])};
+    T*   work  = ctx.device<T>(layout.work);
+    int* dinfo = ctx.device<int>(layout.info);
+
+    for(int j = 0; j < n; j += nb)
+    {
+        int jb = std::min(nb, n - j), rows = n - j;
+        int ldp = lower ? rows : jb, ldl = lower ? rows : nb;
+        T*  Ajj = A + j + size_t(j) * lda;
+
+        hipMemcpyKind h2d = hipMemcpyHostToDevice;
+        if((lower ? hipsolver_ooc_copy(P, ldp, Ajj, lda, rows, jb, h2d, ctx.copy)
+                  : hipsolver_ooc_copy(P, ldp, Ajj, lda, jb, rows, h2d, ctx.copy))
+               != hipSuccess
+           || hipEventRecord(ctx.ready, ctx.copy) != hipSuccess
+           || hipStreamWaitEvent(stream, ctx.ready, 0) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        // update with the factored panels, alternating between the buffers so that the next
+        // panel is loaded while the current one is used
+        for(int k = 0; k < j; k += nb)
+        {
+            int b = (k / nb) % 2;
+            if(hipStreamWaitEvent(ctx.copy, ctx.consumed[b], 0) != hipSuccess
+               || (lower ? hipsolver_ooc_copy(
+                       L[b], ldl, A + j + size_t(k) * lda, lda, rows, nb, h2d, ctx.copy)
+                         : hipsolver_ooc_copy(
+                             L[b], ldl, A + k + size_t(j) * lda, lda, nb, rows, h2d, ctx.copy))
+                      != hipSuccess
+               || hipEventRecord(ctx.loaded[b], ctx.copy) != hipSuccess
+               || hipStreamWaitEvent(stream, ctx.loaded[b], 0) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+            if(lower)
+            {
+                status = Blas::herk(handle, uplo, HIPSOLVER_OP_N, jb, nb, L[b], ldl, P, ldp);
+                if(status == HIPSOLVER_STATUS_SUCCESS && rows > jb)
+                    status = Blas::gemm(handle,
+                                        HIPSOLVER_OP_N,
+                                        opC,
+                                        rows - jb,
+                                        jb,
+                                        nb,
+                                        L[b] + jb,
+                                        ldl,
+                                        L[b],
+                                        ldl,
+                                        P + jb,
+                                        ldp);
+            }
+            else
+            {
+                status = Blas::herk(handle, uplo, opC, jb, nb, L[b], ldl, P, ldp);
+                if(status == HIPSOLVER_STATUS_SUCCESS && rows > jb)
+                    status = Blas::gemm(handle,
+                                        opC,
+                                        HIPSOLVER_OP_N,
+                                        jb,
+                                        rows - jb,
+                                        nb,
+                                        L[b],
+                                        ldl,
+                                        L[b] + size_t(jb) * ldl,
+                                        ldl,
+                                        P + size_t(jb) * ldp,
+                                        ldp);
+            }
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            if(hipEventRecord(ctx.consumed[b], stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+
+        // the columns of a failed panel are left as they were
+        int panel_info;
+        status = hipsolver_ooc_potrf(handle, uplo, jb, P, ldp, work, lwork, dinfo);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        if(hipMemcpyAsync(&panel_info, dinfo, sizeof(int), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        if(panel_info > 0)
+        {
+            *info = j + panel_info;
+            break;
+        }
+
+        if(rows > jb)
+        {
+            status = lower ? Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_RIGHT,
+                                        uplo,
+                                        opC,
+                                        false,
+                                        rows - jb,
+                                        jb,
+                                        P,
+                                        ldp,
+                                        P + jb,
+                                        ldp)
+                           : Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_LEFT,
+                                        uplo,
+                                        opC,
+                                        false,
+                                        jb,
+                                        rows - jb,
+                                        P,
+                                        ldp,
+                                        P + size_t(jb) * ldp,
+                                        ldp);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+        }
+
+        hipMemcpyKind d2h = hipMemcpyDeviceToHost;
+        if(hipEventRecord(ctx.done, stream) != hipSuccess
+           || hipStreamWaitEvent(ctx.copy, ctx.done, 0) != hipSuccess
+           || (lower ? hipsolver_ooc_copy(Ajj, lda, P, ldp, rows, jb, d2h, ctx.copy)
+                     : hipsolver_ooc_copy(Ajj, lda, P, ldp, jb, rows, d2h, ctx.copy))
+                  != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    if(hipStreamSynchronize(ctx.copy) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GETRF ********************/
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrf_ooc(
+    hipsolverHandle_t handle, int m, int n, T* A, int lda, int* ipiv, size_t budget, int* info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || lda < std::max(m, 1) || !info || (m > 0 && n > 0 && (!A || !ipiv)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // quick return
+    *info = 0;
+    if(m == 0 || n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    hipsolver_forbid_capture(stream);
+
+    // panels are the columns j to j + jb - 1 of all the rows, stored with leading dimension m;
+    // the buffers hold the factored columns k to k + kb - 1 of rows k to m - 1
+    const int mn = std::min(m, n);
+
+    int nb, lwork;
+    status = hipsolver_ooc_width<Blas, T>(
+        budget,
+        m,
+        n,
+        [&](int w, int* lw) {
+            return hipsolver_ooc_getrf_bufferSize(handle, m, w, (T*)nullptr, m, lw);
+        },
+        &nb,
+        &lwork);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipsolver_ooc_layout  layout(sizeof(T) * m * nb, Blas::work_size(lwork, sizeof(T)), nb);
+    hipsolver_ooc_context ctx;
+    status = ctx.init(A, sizeof(T) * (size_t(lda) * (n - 1) + m), layout.size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    T*   P     = ctx.device<T>(layout.panel);
+    T*   L[2]  = {ctx.device<T>(layout.buffer[0]), ctx.device<T>(layout.buffer[1])};
+    T*   work  = ctx.device<T>(layout.work);
+    int* dipiv = ctx.device<int>(layout.ipiv);
+    int* dinfo = ctx.device<int>(layout.info);
+
+    // the pivots are left untouched when the algorithm hints of the handle disable pivoting
+    std::vector<int> identity(nb);
+    for(int i = 0; i < nb; i++)
+        identity[i] = i + 1;
+
+    for(int j = 0; j < n; j += nb)
+    {
+        int jb = std::min(nb, n - j);
+        T*  Aj = A + size_t(j) * lda;
+
+        hipMemcpyKind h2d = hipMemcpyHostToDevice;
+        if(hipsolver_ooc_copy(P, m, Aj, lda, m, jb, h2d, ctx.copy) != hipSuccess
+           || hipEventRecord(ctx.ready, ctx.copy) != hipSuccess
+           || hipStreamWaitEvent(stream, ctx.ready, 0) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        // update with the factored panels, alternating between the buffers so that the next
+        // panel is loaded while the current one is used
+        for(int k = 0; k < std::min(j, mn); k += nb)
+        {
+            int b = (k / nb) % 2;
+            int kb = std::min(nb, mn - k), rows = m - k;
+            if(hipStreamWaitEvent(ctx.copy, ctx.consumed[b], 0) != hipSuccess
+               || hipsolver_ooc_copy(
+                      L[b], rows, A + k + size_t(k) * lda, lda, rows, kb, h2d, ctx.copy)
+                      != hipSuccess
+               || hipEventRecord(ctx.loaded[b], ctx.copy) != hipSuccess
+               || hipStreamWaitEvent(stream, ctx.loaded[b], 0) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+            status = Blas::trsm(handle,
+                                HIPSOLVER_SIDE_LEFT,
+                                HIPSOLVER_FILL_MODE_LOWER,
+                                HIPSOLVER_OP_N,
+                                true,
+                                kb,
+                                jb,
+                                L[b],
+                                rows,
+                                P + k,
+                                m);
+            if(status == HIPSOLVER_STATUS_SUCCESS && rows > kb)
+                status = Blas::gemm(handle,
+                                    HIPSOLVER_OP_N,
+                                    HIPSOLVER_OP_N,
+                                    rows - kb,
+                                    jb,
+                                    kb,
+                                    L[b] + kb,
+                                    rows,
+                                    P + k,
+                                    m,
+                                    P + k + kb,
+                                    m);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            if(hipEventRecord(ctx.consumed[b], stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+
+        // factorize the part of the panel below the diagonal, and make its pivots global
+        int pivots = j < mn ? std::min(m - j, jb) : 0;
+        if(pivots > 0)
+        {
+            int panel_info;
+            if(hipMemcpyAsync(dipiv, identity.data(), sizeof(int) * pivots, h2d, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            status = hipsolver_ooc_getrf(handle, m - j, jb, P + j, m, work, lwork, dipiv, dinfo);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            if(hipMemcpyAsync(
+                   ipiv + j, dipiv, sizeof(int) * pivots, hipMemcpyDeviceToHost, stream)
+                   != hipSuccess
+               || hipMemcpyAsync(&panel_info, dinfo, sizeof(int), hipMemcpyDeviceToHost, stream)
+                      != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+            for(int i = j; i < j + pivots; i++)
+                ipiv[i] += j;
+            if(*info == 0 && panel_info > 0)
+                *info = j + panel_info;
+        }
+
+        if(hipEventRecord(ctx.done, stream) != hipSuccess
+           || hipStreamWaitEvent(ctx.copy, ctx.done, 0) != hipSuccess
+           || hipsolver_ooc_copy(Aj, lda, P, m, m, jb, hipMemcpyDeviceToHost, ctx.copy)
+                  != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        // the panel is being copied back while its interchanges are applied to the other columns
+        if(pivots > 0)
+        {
+            hipsolver_ooc_laswp(A, lda, 0, j, j, j + pivots, ipiv);
+            hipsolver_ooc_laswp(A, lda, j + jb, n, j, j + pivots, ipiv);
+        }
+    }
+
+    if(hipStreamSynchronize(ctx.copy) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
@@ -0,0 +1,577 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_gesvdr.hpp"
+#include "hipsolver_ooc.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+/*
+ * Polar decomposition, geqdwh, and square roots of positive definite matrices, posqrt.
+ *
+ * The polar decomposition A = U * H of an m-by-n matrix A of full column rank is computed by the
+ * QDWH iteration of Nakatsukasa, Bai and Gygi. A is scaled by its Frobenius norm to X0, whose
+ * singular values lie in [l0, 1], and every iteration
+ *
+ *     X = (b / c) * X + (a - b / c) * X * (I + c * X^H * X)^-1
+ *
+ * maps them to [l, 1] with l closer to 1, with dynamic weights a, b and c that depend on l only.
+ * While c is large, the iteration is computed from the QR factorization of [sqrt(c) * X; I] by
+ * geqrf and orgqr, which is backward stable, and then from the Cholesky factorization of
+ * I + c * X^H * X by potrf and two triangular solves. U is the limit of X, and H = U^H * A, which
+ * is made exactly Hermitian.
+ *
+ * l0 is not estimated but taken as the machine epsilon, so the weights, and the number of
+ * iterations, are computed on the host before the first one: 6 in double precision and 4 in
+ * single precision, which converge for any A whose condition number is below 1 / (sqrt(n) * l0).
+ * The norm of A is read back to scale it, and the infos of the factorizations to report their
+ * failure, so the call synchronizes twice with the stream of the handle for every matrix.
+ *
+ * With the Cholesky factorization A = R^H * R of a Hermitian positive definite A, and the polar
+ * decomposition R = U * H, A = H * U^H * U * H = H^2, so the square root of A is H = U^H * R and
+ * its inverse is R^-1 * U. The batched variants reuse the workspace of one matrix for every
+ * matrix of the batch in turn.
+ */
+
+/******************** QDWH ********************/
+/*! \brief The weights of an iteration of QDWH. */
+struct hipsolver_polar_step
+{
+    double a;
+    double b;
+    double c;
+};
+
+/*! \brief The weights of the iterations of QDWH that take the singular values of X0 from
+ *  [eps, 1] to within 10 * eps of 1, with eps the machine epsilon of S. */
+template <typename S>
+std::vector<hipsolver_polar_step> hipsolver_polar_steps()
+{
+    const double eps = std::numeric_limits<S>::epsilon();
+
+    std::vector<hipsolver_polar_step> steps;
+    double                            l = eps;
+    while(1 - l > 10 * eps)
+    {
+        double l2 = l * l;
+        double d  = std::cbrt(4 * (1 - l2) / (l2 * l2));
+        double r  = std::sqrt(1 + d);
+        double a  = r + 0.5 * std::sqrt(8 - 4 * d + 8 * (2 - l2) / (l2 * r));
+        double b  = (a - 1) * (a - 1) / 4;
+        double c  = a + b - 1;
+
+        l = l * (a + b * l2) / (1 + c * l2);
+        steps.push_back({a, b, c});
+    }
+    return steps;
+}
+
+/*! \brief Layout of the workspace of geqdwh and posqrt, with every part aligned to 256 bytes.
+ *
+ *  X is the m-by-n iterate, W the (m + n)-by-n matrix factorized by QR, which also holds the
+ *  solves of the Cholesky iterations, Z the Cholesky factor of the iterations and the Hermitian
+ *  factor before it is made Hermitian, E the identity of order n, and R the Cholesky factor of A
+ *  for posqrt. info holds the info of that factorization and of every iteration.
+ */
+struct hipsolver_polar_layout
+{
+    int    steps = 0;
+    int    lwork = 0; // the workspace of the in-core functions, in the units of the back-end
+    size_t x;
+    size_t w;
+    size_t z;
+    size_t e;
+    size_t r;
+    size_t tau;
+    size_t nrm;
+    size_t info;
+    size_t work;
+    size_t size;
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+};
+
+/*! \brief Initializes the layout for an m-by-n A, and for the Cholesky factorization of A with
+ *  the triangle uplo if factor is true. */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_polar_layout_init(hipsolverHandle_t       handle,
+                                              int                     m,
+                                              int                     n,
+                                              bool                    factor,
+                                              hipsolverFillMode_t     uplo,
+                                              hipsolver_polar_layout* layout)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || m < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    int lwork = 0, lw = 0;
+    T*  null  = nullptr;
+    if(n > 0)
+    {
+        hipsolverStatus_t status;
+        status = hipsolver_gesvdr_geqrf_bufferSize(handle, m + n, n, null, m + n, &lw);
+        lwork  = std::max(lwork, lw);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolver_gesvdr_orgqr_bufferSize(
+                handle, m + n, n, n, null, m + n, null, &lw);
+        lwork = std::max(lwork, lw);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolver_ooc_potrf_bufferSize(
+                handle, HIPSOLVER_FILL_MODE_UPPER, n, null, n, &lw);
+        lwork = std::max(lwork, lw);
+        if(status == HIPSOLVER_STATUS_SUCCESS && factor)
+            status = hipsolver_ooc_potrf_bufferSize(handle, uplo, n, null, n, &lw);
+        lwork = std::max(lwork, lw);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    size_t t      = sizeof(T);
+    layout->steps = int(hipsolver_polar_steps<S>().size());
+    layout->lwork = lwork;
+    layout->x     = 0;
+    layout->w     = layout->x + layout->align(t * m * n);
+    layout->z     = layout->w + layout->align(t * (m + n) * n);
+    layout->e     = layout->z + layout->align(t * n * n);
+    layout->r     = layout->e + layout->align(t * n * n);
+    layout->tau   = layout->r + (factor ? layout->align(t * n * n) : 0);
+    layout->nrm   = layout->tau + layout->align(t * n);
+    layout->info  = layout->nrm + layout->align(sizeof(S));
+    layout->work  = layout->info + layout->align(sizeof(int) * (layout->steps + 1));
+    layout->size  = layout->work + layout->align(Blas::work_size(lwork, t));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Sets lwork to the size of the workspace in the units of the back-end. */
+inline hipsolverStatus_t hipsolver_polar_lwork(const hipsolver_polar_layout& layout,
+                                               size_t                        unit,
+                                               int*                          lwork)
+{
+    size_t size = (layout.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Overwrites the m-by-n matrix X of the workspace with the unitary factor of its polar
+ *  decomposition, unless the info of a preceding factorization of X, in the first entry of the
+ *  infos of the workspace, is nonzero. The identity E must be set. Sets hinfo to that info, and
+ *  hstep to the first iteration, from 1, whose Cholesky factorization failed, or to 0.
+ *  Synchronizes with stream. */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_polar_qdwh(hipsolverHandle_t             handle,
+                                       hipStream_t                   stream,
+                                       const hipsolver_polar_layout& layout,
+                                       int                           m,
+                                       int                           n,
+                                       T*                            work,
+                                       int*                          hinfo,
+                                       int*                          hstep)
+{
+    const hipsolverOperation_t opN = HIPSOLVER_OP_N;
+    const hipsolverOperation_t opC = hipsolver_ooc_op_c<T>();
+    const hipsolverFillMode_t  up  = HIPSOLVER_FILL_MODE_UPPER;
+
+    char*  base  = (char*)work;
+    T*     X     = (T*)(base + layout.x);
+    T*     W     = (T*)(base + layout.w);
+    T*     Z     = (T*)(base + layout.z);
+    T*     E     = (T*)(base + layout.e);
+    T*     tau   = (T*)(base + layout.tau);
+    S*     nrm   = (S*)(base + layout.nrm);
+    int*   info  = (int*)(base + layout.info);
+    T*     cwork = (T*)(base + layout.work);
+    int    mn    = m + n;
+    size_t t     = sizeof(T);
+
+    std::vector<hipsolver_polar_step> steps = hipsolver_polar_steps<S>();
+    std::vector<int>                  hinfos(steps.size() + 1, 0);
+
+    // X0 = X / ||X||_F
+    S                 norm;
+    hipsolverStatus_t status = Blas::nrm2(handle, m * n, X, 1, nrm);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(hipMemsetAsync(info + 1, 0, sizeof(int) * steps.size(), stream) != hipSuccess
+       || hipMemcpyAsync(&norm, nrm, sizeof(S), hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(hinfos.data(), info, sizeof(int), hipMemcpyDeviceToHost, stream)
+              != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *hinfo = hinfos[0];
+    *hstep = 0;
+    if(hinfos[0] != 0 || norm == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+    status = Blas::geam(handle, opN, opN, m, n, S(1 / norm), X, m, S(0), X, m, X, m);
+
+    for(size_t k = 0; k < steps.size() && status == HIPSOLVER_STATUS_SUCCESS; k++)
+    {
+        double a = steps[k].a, b = steps[k].b, c = steps[k].c;
+        int*   kinfo = info + k + 1;
+
+        if(c > 100)
+        {
+            // [Q1; Q2] = orth([sqrt(c) * X; I]), and X = (b / c) * X + e * Q1 * Q2^H
+            double e = (a - b / c) / std::sqrt(c);
+            status   = Blas::geam(handle, opN, opN, m, n, S(std::sqrt(c)), X, m, S(0), X, m, W, mn);
+            if(status == HIPSOLVER_STATUS_SUCCESS
+               && hipMemcpy2DAsync(
+                      W + m, t * mn, E, t * n, t * n, n, hipMemcpyDeviceToDevice, stream)
+                      != hipSuccess)
+                status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = hipsolver_gesvdr_geqrf(
+                    handle, mn, n, W, mn, tau, cwork, layout.lwork, kinfo);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = hipsolver_gesvdr_orgqr(
+                    handle, mn, n, n, W, mn, tau, cwork, layout.lwork, kinfo);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::geam(handle, opN, opN, m, n, S(b / c), X, m, S(0), X, m, X, m);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::gemm(handle, opN, opC, m, n, n, S(e), W, mn, W + m, mn, X, m);
+        }
+        else
+        {
+            // Z^H * Z = I + c * X^H * X, and X = (b / c) * X + (a - b / c) * X * Z^-1 * Z^-H
+            if(hipMemcpyAsync(Z, E, t * n * n, hipMemcpyDeviceToDevice, stream) != hipSuccess
+               || hipMemcpyAsync(W, X, t * m * n, hipMemcpyDeviceToDevice, stream) != hipSuccess)
+                status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::herk(handle, up, opC, n, m, S(c), X, m, S(1), Z, n);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = hipsolver_ooc_potrf(handle, up, n, Z, n, cwork, layout.lwork, kinfo);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::trsm(
+                    handle, HIPSOLVER_SIDE_RIGHT, up, opN, false, m, n, Z, n, W, m);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::trsm(
+                    handle, HIPSOLVER_SIDE_RIGHT, up, opC, false, m, n, Z, n, W, m);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::geam(
+                    handle, opN, opN, m, n, S(b / c), X, m, S(a - b / c), W, m, X, m);
+        }
+    }
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(hipMemcpyAsync(hinfos.data() + 1,
+                      info + 1,
+                      sizeof(int) * steps.size(),
+                      hipMemcpyDeviceToHost,
+                      stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    for(size_t k = 0; k < steps.size() && *hstep == 0; k++)
+        if(hinfos[k + 1] != 0)
+            *hstep = int(k + 1);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Sets the identity E of the workspace. */
+template <typename T, typename S>
+hipError_t hipsolver_polar_identity(
+    const hipsolver_polar_layout& layout, int n, T* work, hipStream_t stream)
+{
+    size_t         t = sizeof(T);
+    T*             E = (T*)((char*)work + layout.e);
+    std::vector<S> ones(n, S(1));
+
+    hipError_t err = hipMemsetAsync(E, 0, t * n * n, stream);
+    if(err == hipSuccess)
+        err = hipMemcpy2DAsync(
+            E, t * (n + 1), ones.data(), sizeof(S), sizeof(S), n, hipMemcpyHostToDevice, stream);
+    if(err == hipSuccess)
+        err = hipStreamSynchronize(stream);
+    return err;
+}
+
+/******************** GEQDWH ********************/
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_geqdwh_bufferSize(hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              int               lda,
+                                              int               strideA,
+                                              int               ldh,
+                                              int*              lwork,
+                                              int               batch_count)
+{
+    hipsolver_polar_layout layout;
+    hipsolverStatus_t      status = hipsolver_polar_layout_init<Blas, T, S>(
+        handle, m, n, false, HIPSOLVER_FILL_MODE_UPPER, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(lda < std::max(m, 1) || ldh < std::max(n, 1) || batch_count < 0
+       || (batch_count > 1 && size_t(strideA) < size_t(lda) * n) || !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver_polar_lwork(layout, Blas::work_size(1, sizeof(T)), lwork);
+}
+
+/*! \brief Overwrites the m-by-n matrices A of the batch with the unitary factors of their polar
+ *  decompositions, and, if H is not null, sets H to their Hermitian factors. devInfo receives
+ *  the first iteration whose Cholesky factorization failed, in which case A and H are unchanged.
+ */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_geqdwh(hipsolverHandle_t handle,
+                                   int               m,
+                                   int               n,
+                                   T*                A,
+                                   int               lda,
+                                   int               strideA,
+                                   T*                H,
+                                   int               ldh,
+                                   int               strideH,
+                                   T*                work,
+                                   int               lwork,
+                                   int*              devInfo,
+                                   int               batch_count)
+{
+    hipsolver_polar_layout layout;
+    hipsolverStatus_t      status = hipsolver_polar_layout_init<Blas, T, S>(
+        handle, m, n, false, HIPSOLVER_FILL_MODE_UPPER, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(lda < std::max(m, 1) || ldh < std::max(n, 1) || batch_count < 0
+       || (batch_count > 1 && size_t(strideA) < size_t(lda) * n)
+       || (batch_count > 1 && H && size_t(strideH) < size_t(ldh) * n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && (!devInfo || (n > 0 && !A)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(lwork < 0 || Blas::work_size(lwork, sizeof(T)) < layout.size || !work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+    {
+        if(batch_count > 0
+           && hipMemsetAsync(devInfo, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+    hipsolver_forbid_capture(stream);
+
+    const hipsolverOperation_t opN = HIPSOLVER_OP_N;
+    const hipsolverOperation_t opC = hipsolver_ooc_op_c<T>();
+
+    char*  base = (char*)work;
+    T*     X    = (T*)(base + layout.x);
+    T*     Z    = (T*)(base + layout.z);
+    int*   info = (int*)(base + layout.info);
+    size_t t    = sizeof(T);
+
+    if(hipMemsetAsync(info, 0, sizeof(int), stream) != hipSuccess
+       || hipsolver_polar_identity<T, S>(layout, n, work, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    std::vector<int> hinfo(batch_count, 0);
+    for(int b = 0; b < batch_count && status == HIPSOLVER_STATUS_SUCCESS; b++)
+    {
+        T* Ab = A + size_t(strideA) * b;
+        T* Hb = H ? H + size_t(strideH) * b : nullptr;
+
+        int finfo;
+        if(hipMemcpy2DAsync(X, t * m, Ab, t * lda, t * m, n, hipMemcpyDeviceToDevice, stream)
+           != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        status = hipsolver_polar_qdwh<Blas, T, S>(
+            handle, stream, layout, m, n, work, &finfo, &hinfo[b]);
+        if(status != HIPSOLVER_STATUS_SUCCESS || hinfo[b] != 0)
+            continue;
+
+        // H = (Z + Z^H) / 2, with Z = U^H * A
+        if(Hb)
+        {
+            if(hipMemsetAsync(Z, 0, t * n * n, stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            status = Blas::gemm(handle, opC, opN, n, n, m, S(1), X, m, Ab, lda, Z, n);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::geam(handle, opN, opC, n, n, S(0.5), Z, n, S(0.5), Z, n, Hb, ldh);
+        }
+        if(status == HIPSOLVER_STATUS_SUCCESS
+           && hipMemcpy2DAsync(Ab, t * lda, X, t * m, t * m, n, hipMemcpyDeviceToDevice, stream)
+                  != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(hipMemcpyAsync(
+           devInfo, hinfo.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice, stream)
+       != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** POSQRT ********************/
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_posqrt_bufferSize(hipsolverHandle_t   handle,
+                                              signed char         job,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 lda,
+                                              int                 strideA,
+                                              int*                lwork,
+                                              int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(job != 'S' && job != 'I')
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver_polar_layout layout;
+    hipsolverStatus_t      status
+        = hipsolver_polar_layout_init<Blas, T, S>(handle, n, n, true, uplo, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(lda < std::max(n, 1) || batch_count < 0
+       || (batch_count > 1 && size_t(strideA) < size_t(lda) * n) || !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver_polar_lwork(layout, Blas::work_size(1, sizeof(T)), lwork);
+}
+
+/*! \brief Overwrites the Hermitian positive definite matrices A of the batch, given by their
+ *  triangles uplo, with their square roots if job is 'S', or with the inverses of their square
+ *  roots if job is 'I', in both triangles. devInfo receives the info of the Cholesky factorization
+ *  of A, or n if A is numerically singular, in which case A is unchanged. */
+template <typename Blas, typename T, typename S>
+hipsolverStatus_t hipsolver_posqrt(hipsolverHandle_t   handle,
+                                   signed char         job,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   T*                  A,
+                                   int                 lda,
+                                   int                 strideA,
+                                   T*                  work,
+                                   int                 lwork,
+                                   int*                devInfo,
+                                   int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(job != 'S' && job != 'I')
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver_polar_layout layout;
+    hipsolverStatus_t      status
+        = hipsolver_polar_layout_init<Blas, T, S>(handle, n, n, true, uplo, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(lda < std::max(n, 1) || batch_count < 0
+       || (batch_count > 1 && size_t(strideA) < size_t(lda) * n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && (!devInfo || (n > 0 && !A)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(lwork < 0 || Blas::work_size(lwork, sizeof(T)) < layout.size || !work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+    {
+        if(batch_count > 0
+           && hipMemsetAsync(devInfo, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+    hipsolver_forbid_capture(stream);
+
+    // the Cholesky factor of A is op(R), with R the triangle uplo of the factorization
+    const hipsolverOperation_t opN = HIPSOLVER_OP_N;
+    const hipsolverOperation_t opC = hipsolver_ooc_op_c<T>();
+    const hipsolverOperation_t opR = uplo == HIPSOLVER_FILL_MODE_UPPER ? opN : opC;
+
+    char*  base  = (char*)work;
+    T*     X     = (T*)(base + layout.x);
+    T*     Z     = (T*)(base + layout.z);
+    T*     E     = (T*)(base + layout.e);
+    T*     R     = (T*)(base + layout.r);
+    int*   info  = (int*)(base + layout.info);
+    T*     cwork = (T*)(base + layout.work);
+    size_t t     = sizeof(T);
+
+    if(hipsolver_polar_identity<T, S>(layout, n, work, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    std::vector<int> hinfo(batch_count, 0);
+    for(int b = 0; b < batch_count && status == HIPSOLVER_STATUS_SUCCESS; b++)
+    {
+        T* Ab = A + size_t(strideA) * b;
+
+        // X = op(R), the Cholesky factor of A
+        if(hipMemcpy2DAsync(R, t * n, Ab, t * lda, t * n, n, hipMemcpyDeviceToDevice, stream)
+               != hipSuccess
+           || hipMemcpyAsync(X, E, t * n * n, hipMemcpyDeviceToDevice, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        status = hipsolver_ooc_potrf(handle, uplo, n, R, n, cwork, layout.lwork, info);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::trmm(handle, HIPSOLVER_SIDE_LEFT, uplo, opR, n, n, R, n, X, n);
+
+        int step = 0;
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = hipsolver_polar_qdwh<Blas, T, S>(
+                handle, stream, layout, n, n, work, &hinfo[b], &step);
+        if(status == HIPSOLVER_STATUS_SUCCESS && hinfo[b] == 0 && step != 0)
+            hinfo[b] = n;
+        if(status != HIPSOLVER_STATUS_SUCCESS || hinfo[b] != 0)
+            continue;
+
+        // A = (Z + Z^H) / 2, with Z = U^H * op(R) for the square root, and op(R)^-1 * U for its
+        // inverse
+        if(job == 'S')
+        {
+            status = Blas::geam(handle, opC, opN, n, n, S(1), X, n, S(0), X, n, Z, n);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::trmm(handle, HIPSOLVER_SIDE_RIGHT, uplo, opR, n, n, R, n, Z, n);
+        }
+        else
+        {
+            if(hipMemcpyAsync(Z, X, t * n * n, hipMemcpyDeviceToDevice, stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            status = Blas::trsm(handle, HIPSOLVER_SIDE_LEFT, uplo, opR, false, n, n, R, n, Z, n);
+        }
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::geam(handle, opN, opC, n, n, S(0.5), Z, n, S(0.5), Z, n, Ab, lda);
+    }
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(hipMemcpyAsync(
+           devInfo, hinfo.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice, stream)
+       != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
@@ -0,0 +1,459 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_ooc.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Rank-k updates and downdates of a Cholesky factorization.
+ *
+ * Given the factor L of A = L * L^H, the factor of A + s * V * V^H, with s = 1 for an update and
+ * s = -1 for a downdate, is computed by panels of nb columns. With the panel written as
+ *
+ *     L = [L11   0 ]    V = [V1]
+ *         [L21  L22]        [V2]
+ *
+ * the new panel is the Cholesky factorization of the updated first block column,
+ *
+ *     L11' = chol(L11 * L11^H + s * V1 * V1^H)
+ *     L21' = (L21 * L11^H + s * V2 * V1^H) * L11'^-H,
+ *
+ * and the rest of the matrix is left with the update of L22 by s * V2' * V2'^H, where
+ *
+ *     V2' = (V2 - L21 * G) * C^-1,    G = L11^-1 * V1,    C^H * C = I + s * G^H * G.
+ *
+ * Every panel costs O((nb + k) * n * nb) operations, so that the whole update costs
+ * O((nb + k) * n^2) instead of the O(n^3) of a new factorization. The upper triangular case is
+ * the same with L = U^H. Only the triangle uplo of A is read and written, and V is overwritten.
+ *
+ * The diagonal blocks are refactorized by the potrf of the back-end, whose info gives the first
+ * leading minor of the downdated matrix that is not positive definite. The infos of the panels
+ * are gathered on the host at the end, so the call synchronizes with the stream of the handle.
+ * The BLAS of the back-end are reached through the Blas policy of the out-of-core
+ * factorizations.
+ */
+
+// the number of columns of the panels
+constexpr int hipsolver_potrf_update_nb = 64;
+
+/*! \brief The real type of the scalars of herk. */
+template <typename T>
+struct hipsolver_potrf_update_real
+{
+    using type = T;
+};
+
+template <>
+struct hipsolver_potrf_update_real<hipsolverComplex>
+{
+    using type = float;
+};
+
+template <>
+struct hipsolver_potrf_update_real<hipsolverDoubleComplex>
+{
+    using type = double;
+};
+
+/*! \brief Workspace of an update, with every part aligned to 256 bytes. */
+struct hipsolver_potrf_update_layout
+{
+    size_t identity = 0; // the identity of order max(nb, k)
+    size_t diag     = 0; // the diagonal block L11, with the other triangle set to zero
+    size_t G        = 0;
+    size_t V2       = 0; // a copy of V2
+    size_t C        = 0;
+    size_t work     = 0; // the workspace of potrf
+    size_t info     = 0; // one info per panel and matrix, and one for the factorizations of C
+    size_t size     = 0;
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+
+    hipsolver_potrf_update_layout() = default;
+
+    hipsolver_potrf_update_layout(
+        size_t type_size, int n, int k, int nb, size_t work_size, int batch_count)
+    {
+        size_t m = std::max(nb, k), panels = (n + nb - 1) / nb;
+        identity = 0;
+        diag     = identity + align(type_size * m * m);
+        G        = diag + align(type_size * nb * nb);
+        V2       = G + align(type_size * nb * k);
+        C        = V2 + align(type_size * n * k);
+        work     = C + align(type_size * k * k);
+        info     = work + align(work_size);
+        size     = info + align(sizeof(int) * (panels * batch_count + 1));
+    }
+};
+
+/*! \brief Computes the layout of the workspace of an update of matrices of order n by k vectors.
+ *  The in-core workspace is the largest of the factorizations of L11 and C. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_update_workspace(hipsolverHandle_t              handle,
+                                                   hipsolverFillMode_t            uplo,
+                                                   int                            n,
+                                                   int                            k,
+                                                   int                            batch_count,
+                                                   int*                           lwork,
+                                                   hipsolver_potrf_update_layout* layout)
+{
+    int nb = std::min(n, hipsolver_potrf_update_nb), lwork_nb, lwork_k;
+
+    hipsolverStatus_t status
+        = hipsolver_ooc_potrf_bufferSize(handle, uplo, nb, (T*)nullptr, nb, &lwork_nb);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    status = hipsolver_ooc_potrf_bufferSize(
+        handle, HIPSOLVER_FILL_MODE_UPPER, k, (T*)nullptr, k, &lwork_k);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork  = std::max(lwork_nb, lwork_k);
+    *layout = hipsolver_potrf_update_layout(
+        sizeof(T), n, k, nb, Blas::work_size(*lwork, sizeof(T)), batch_count);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Returns in lwork the size of the workspace of an update or downdate of batch_count
+ *  matrices, in the units of the work arrays of the back-end. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_update_bufferSize(hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 k,
+                                                    int                 lda,
+                                                    int                 ldv,
+                                                    int*                lwork,
+                                                    int                 batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || k < 0 || lda < std::max(n, 1) || ldv < std::max(n, 1) || !lwork
+       || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = 0;
+    if(n == 0 || k == 0 || batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    int                           lwork_potrf;
+    hipsolver_potrf_update_layout layout;
+    hipsolverStatus_t             status = hipsolver_potrf_update_workspace<Blas, T>(
+        handle, uplo, n, k, batch_count, &lwork_potrf, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    size_t unit = Blas::work_size(1, sizeof(T));
+    size_t size = (layout.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Updates (downdate false) or downdates (downdate true) the Cholesky factors of the
+ *  batch_count matrices whose device addresses are in the host arrays A and V. devInfo holds
+ *  batch_count integers; devInfo[b] is set to i > 0 if the leading minor of order i of the
+ *  downdated matrix b is not positive definite, in which case its factor is not valid. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_update(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         bool                downdate,
+                                         int                 n,
+                                         int                 k,
+                                         T* const*           A,
+                                         int                 lda,
+                                         T* const*           V,
+                                         int                 ldv,
+                                         T*                  work,
+                                         int                 lwork,
+                                         int*                devInfo,
+                                         int                 batch_count)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || k < 0 || lda < std::max(n, 1) || ldv < std::max(n, 1) || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count > 0 && !devInfo)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    for(int b = 0; b < batch_count; b++)
+        if((n > 0 && !A[b]) || (n > 0 && k > 0 && !V[b]))
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(batch_count == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(n == 0 || k == 0)
+        return hipMemsetAsync(devInfo, 0, sizeof(int) * batch_count, stream) == hipSuccess
+                   ? HIPSOLVER_STATUS_SUCCESS
+                   : HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    int                           lwork_potrf;
+    hipsolver_potrf_update_layout layout;
+    status = hipsolver_potrf_update_workspace<Blas, T>(
+        handle, uplo, n, k, batch_count, &lwork_potrf, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(!work || lwork < 0 || Blas::work_size(lwork, sizeof(T)) < layout.size)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    hipsolver_forbid_capture(stream);
+
+    const bool                 lower  = uplo == HIPSOLVER_FILL_MODE_LOWER;
+    const hipsolverOperation_t opC    = hipsolver_ooc_op_c<T>();
+    const S                    sign   = downdate ? -1 : 1;
+    const int                  nb     = std::min(n, hipsolver_potrf_update_nb);
+    const int                  m      = std::max(nb, k);
+    const int                  panels = (n + nb - 1) / nb;
+
+    char* base  = (char*)work;
+    T*    E     = (T*)(base + layout.identity);
+    T*    D     = (T*)(base + layout.diag);
+    T*    G     = (T*)(base + layout.G);
+    T*    W     = (T*)(base + layout.V2);
+    T*    C     = (T*)(base + layout.C);
+    T*    pwork = (T*)(base + layout.work);
+    int*  dinfo = (int*)(base + layout.info);
+
+    // the ones are copied to the diagonal before the call returns
+    std::vector<T> ones(m, T(1));
+    hipMemcpyKind  d2d = hipMemcpyDeviceToDevice;
+    if(hipMemsetAsync(E, 0, sizeof(T) * m * m, stream) != hipSuccess
+       || hipMemcpy2DAsync(E,
+                           sizeof(T) * (m + 1),
+                           ones.data(),
+                           sizeof(T),
+                           sizeof(T),
+                           m,
+                           hipMemcpyHostToDevice,
+                           stream)
+              != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int j = 0; j < n; j += nb)
+        {
+            int jb = std::min(nb, n - j), rest = n - j - jb;
+            T*  A11 = A[b] + j + size_t(j) * lda;
+            T*  A21 = lower ? A11 + jb : A11 + size_t(jb) * lda; // L21, or U12 for upper
+            T*  V1  = V[b] + j;
+            T*  V2  = V1 + jb;
+
+            // G = L11^-1 * V1, and V2 - L21 * G before L21 is overwritten
+            if(hipsolver_ooc_copy(G, nb, V1, ldv, jb, k, d2d, stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            status = Blas::trsm(handle,
+                                HIPSOLVER_SIDE_LEFT,
+                                uplo,
+                                lower ? HIPSOLVER_OP_N : opC,
+                                false,
+                                jb,
+                                k,
+                                A11,
+                                lda,
+                                G,
+                                nb);
+            if(status == HIPSOLVER_STATUS_SUCCESS && rest > 0)
+            {
+                if(hipsolver_ooc_copy(W, n, V2, ldv, rest, k, d2d, stream) != hipSuccess)
+                    return HIPSOLVER_STATUS_INTERNAL_ERROR;
+                status = Blas::gemm(handle,
+                                    lower ? HIPSOLVER_OP_N : opC,
+                                    HIPSOLVER_OP_N,
+                                    rest,
+                                    k,
+                                    jb,
+                                    A21,
+                                    lda,
+                                    G,
+                                    nb,
+                                    V2,
+                                    ldv);
+            }
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+
+            // D = L11 with zeros above the diagonal, and L21 = L21 * L11^H + s * V2 * V1^H
+            if(hipsolver_ooc_copy(D, nb, E, m, jb, jb, d2d, stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            status = Blas::trmm(
+                handle, HIPSOLVER_SIDE_LEFT, uplo, HIPSOLVER_OP_N, jb, jb, A11, lda, D, nb);
+            if(status == HIPSOLVER_STATUS_SUCCESS && rest > 0)
+            {
+                status = lower ? Blas::trmm(handle,
+                                            HIPSOLVER_SIDE_RIGHT,
+                                            uplo,
+                                            opC,
+                                            rest,
+                                            jb,
+                                            A11,
+                                            lda,
+                                            A21,
+                                            lda)
+                               : Blas::trmm(handle,
+                                            HIPSOLVER_SIDE_LEFT,
+                                            uplo,
+                                            opC,
+                                            jb,
+                                            rest,
+                                            A11,
+                                            lda,
+                                            A21,
+                                            lda);
+                if(status == HIPSOLVER_STATUS_SUCCESS)
+                    status = lower ? Blas::gemm(handle,
+                                                HIPSOLVER_OP_N,
+                                                opC,
+                                                rest,
+                                                jb,
+                                                k,
+                                                sign,
+                                                W,
+                                                n,
+                                                V1,
+                                                ldv,
+                                                A21,
+                                                lda)
+                                   : Blas::gemm(handle,
+                                                HIPSOLVER_OP_N,
+                                                opC,
+                                                jb,
+                                                rest,
+                                                k,
+                                                sign,
+                                                V1,
+                                                ldv,
+                                                W,
+                                                n,
+                                                A21,
+                                                lda);
+            }
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+
+            // L11 = chol(L11 * L11^H + s * V1 * V1^H)
+            status = Blas::herk(
+                handle, uplo, lower ? HIPSOLVER_OP_N : opC, jb, jb, S(1), D, nb, S(0), A11, lda);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::herk(
+                    handle, uplo, HIPSOLVER_OP_N, jb, k, sign, V1, ldv, S(1), A11, lda);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = hipsolver_ooc_potrf(
+                    handle, uplo, jb, A11, lda, pwork, lwork_potrf, dinfo + b * panels + j / nb);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            if(rest == 0)
+                continue;
+
+            // L21 = L21 * L11^-H
+            status = lower ? Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_RIGHT,
+                                        uplo,
+                                        opC,
+                                        false,
+                                        rest,
+                                        jb,
+                                        A11,
+                                        lda,
+                                        A21,
+                                        lda)
+                           : Blas::trsm(handle,
+                                        HIPSOLVER_SIDE_LEFT,
+                                        uplo,
+                                        opC,
+                                        false,
+                                        jb,
+                                        rest,
+                                        A11,
+                                        lda,
+                                        A21,
+                                        lda);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+
+            // V2 = V2 * C^-1, with C^H * C = I + s * G^H * G
+            if(hipsolver_ooc_copy(C, k, E, m, k, k, d2d, stream) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            status = Blas::herk(
+                handle, HIPSOLVER_FILL_MODE_UPPER, opC, k, jb, sign, G, nb, S(1), C, k);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = hipsolver_ooc_potrf(handle,
+                                             HIPSOLVER_FILL_MODE_UPPER,
+                                             k,
+                                             C,
+                                             k,
+                                             pwork,
+                                             lwork_potrf,
+                                             dinfo + panels * batch_count);
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                status = Blas::trsm(handle,
+                                    HIPSOLVER_SIDE_RIGHT,
+                                    HIPSOLVER_FILL_MODE_UPPER,
+                                    HIPSOLVER_OP_N,
+                                    false,
+                                    rest,
+                                    k,
+                                    C,
+                                    k,
+                                    V2,
+                                    ldv);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+        }
+    }
+
+    // the info of a matrix is given by its first failed panel
+    std::vector<int> infos(size_t(panels) * batch_count), result(batch_count, 0);
+    if(hipMemcpyAsync(infos.data(),
+                      dinfo,
+                      sizeof(int) * infos.size(),
+                      hipMemcpyDeviceToHost,
+                      stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int p = 0; p < panels; p++)
+        {
+            int panel_info = infos[size_t(b) * panels + p];
+            if(panel_info > 0)
+            {
+                result[b] = p * nb + panel_info;
+                break;
+            }
+        }
+    }
+    if(hipMemcpyAsync(devInfo,
+                      result.data(),
+                      sizeof(int) * batch_count,
+                      hipMemcpyHostToDevice,
+                      stream)
+           != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*! \brief Device allocation of a warm-up call, freed when it goes out of scope. */
+class hipsolver_preload_buffer
+{
+    void* m_ptr = nullptr;
+
+public:
+    hipsolver_preload_buffer() = default;
+
+    hipsolver_preload_buffer(const hipsolver_preload_buffer&) = delete;
+    hipsolver_preload_buffer& operator=(const hipsolver_preload_buffer&) = delete;
+
+    ~hipsolver_preload_buffer()
+    {
+        // hipFree waits for the warm-up calls still using the buffer
+        if(m_ptr)
+            hipFree(m_ptr);
+    }
+
+    hipsolverStatus_t allocate(size_t size)
+    {
+        if(hipMalloc(&m_ptr, std::max(size, size_t(1))) != hipSuccess)
+        {
+            m_ptr = nullptr;
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    void* get() const
+    {
+        return m_ptr;
+    }
+};
+
+/*! \brief Runs each of the given functions once on the identity matrix of order n, through the
+ *  generic API.
+ *
+ *  The back-ends load their kernels, and rocBLAS its Tensile library, when they are first
+ *  launched. Running the functions on the handle's stream before the latency-sensitive work
+ *  moves that cost to a time chosen by the caller, and only for the functions and precision
+ *  that will be used. A warm-up problem of order n runs the same code paths as the problems of
+ *  that order, including the blocked algorithms when n is large enough for them.
+ */
+inline hipsolverStatus_t hipsolver_preload(hipsolverHandle_t            handle,
+                                           const hipsolverDnFunction_t* functions,
+                                           int                          count,
+                                           hipDataType                  dataType,
+                                           int                          n)
+{
+    for(int f = 0; f < count; f++)
+    {
+        if(functions[f] != HIPSOLVERDN_GETRF && functions[f] != HIPSOLVERDN_POTRF
+           && functions[f] != HIPSOLVERDN_SYEVD)
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+
+    size_t      size;
+    hipDataType dataTypeW;
+    switch(dataType)
+    {
+    case HIP_R_32F:
+        size      = sizeof(float);
+        dataTypeW = HIP_R_32F;
+        break;
+    case HIP_R_64F:
+        size      = sizeof(double);
+        dataTypeW = HIP_R_64F;
+        break;
+    case HIP_C_32F:
+        size      = 2 * sizeof(float);
+        dataTypeW = HIP_R_32F;
+        break;
+    case HIP_C_64F:
+        size      = 2 * sizeof(double);
+        dataTypeW = HIP_R_64F;
+        break;
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+
+    // quick return
+    if(count == 0 || n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // the warm-up calls allocate and synchronize
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    hipsolver_forbid_capture(stream);
+
+    // the real part of a complex number is its first component
+    std::vector<char> identity(size * n * n, 0);
+    for(int i = 0; i < n; i++)
+    {
+        char* diag = identity.data() + size * (size_t(i) * n + i);
+        if(dataTypeW == HIP_R_32F)
+        {
+            float one = 1;
+            std::memcpy(diag, &one, sizeof(one));
+        }
+        else
+        {
+            double one = 1;
+            std::memcpy(diag, &one, sizeof(one));
+        }
+    }
+
+    hipsolver_preload_buffer A, W, ipiv, info;
+    status = A.allocate(identity.size());
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = W.allocate(size * n);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = ipiv.allocate(sizeof(int64_t) * n);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = info.allocate(sizeof(int));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    for(int f = 0; f < count; f++)
+    {
+        if(hipMemcpyAsync(A.get(), identity.data(), identity.size(), hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        size_t lwork_device = 0, lwork_host = 0;
+        switch(functions[f])
+        {
+        case HIPSOLVERDN_GETRF:
+            status = hipsolverDnXgetrf_bufferSize(
+                handle, nullptr, n, n, dataType, A.get(), n, dataType, &lwork_device, &lwork_host);
+            break;
+        case HIPSOLVERDN_POTRF:
+            status = hipsolverDnXpotrf_bufferSize(handle,
+                                                  nullptr,
+                                                  HIPSOLVER_FILL_MODE_LOWER,
+                                                  n,
+                                                  dataType,
+                                                  A.get(),
+                                                  n,
+                                                  dataType,
+                                                  &lwork_device,
+                                                  &lwork_host);
+            break;
+        default:
+            status = hipsolverDnXsyevd_bufferSize(handle,
+                                                  nullptr,
+                                                  HIPSOLVER_EIG_MODE_VECTOR,
+                                                  HIPSOLVER_FILL_MODE_LOWER,
+                                                  n,
+                                                  dataType,
+                                                  A.get(),
+                                                  n,
+                                                  dataTypeW,
+                                                  W.get(),
+                                                  dataType,
+                                                  &lwork_device,
+                                                  &lwork_host);
+            break;
+        }
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        hipsolver_preload_buffer work;
+        std::vector<char>        host_work(lwork_host);
+        status = work.allocate(lwork_device);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        switch(functions[f])
+        {
+        case HIPSOLVERDN_GETRF:
+            status = hipsolverDnXgetrf(handle,
+                                       nullptr,
+                                       n,
+                                       n,
+                                       dataType,
+                                       A.get(),
+                                       n,
+                                       (int64_t*)ipiv.get(),
+                                       dataType,
+                                       work.get(),
+                                       lwork_device,
+                                       host_work.data(),
+                                       lwork_host,
+                                       (int*)info.get());
+            break;
+        case HIPSOLVERDN_POTRF:
+            status = hipsolverDnXpotrf(handle,
+                                       nullptr,
+                                       HIPSOLVER_FILL_MODE_LOWER,
+                                       n,
+                                       dataType,
+                                       A.get(),
+                                       n,
+                                       dataType,
+                                       work.get(),
+                                       lwork_device,
+                                       host_work.data(),
+                                       lwork_host,
+                                       (int*)info.get());
+            break;
+        default:
+            status = hipsolverDnXsyevd(handle,
+                                       nullptr,
+                                       HIPSOLVER_EIG_MODE_VECTOR,
+                                       HIPSOLVER_FILL_MODE_LOWER,
+                                       n,
+                                       dataType,
+                                       A.get(),
+                                       n,
+                                       dataTypeW,
+                                       W.get(),
+                                       dataType,
+                                       work.get(),
+                                       lwork_device,
+                                       host_work.data(),
+                                       lwork_host,
+                                       (int*)info.get());
+            break;
+        }
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        // the host workspace must outlive the call
+        if(hipStreamSynchronize(stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
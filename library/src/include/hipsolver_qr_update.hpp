@@ -0,0 +1,563 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_ooc.hpp"
+#include "hipsolver_potrf_update.hpp"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+
+/*
+ * Updates of a thin QR factorization A = Q * R, with Q of m-by-n with orthonormal columns and R
+ * upper triangular of order n, when a column or a row of A is inserted or deleted.
+ *
+ * The factorization is restored by Givens rotations. Their sines and cosines are computed on the
+ * device by rotg, and each one is applied by rot to a pair of rows of R and to the matching pair
+ * of columns of Q, so that an update costs O(m * n) operations instead of the O(m * n^2) of a
+ * new factorization:
+ *
+ *  - deleting column j leaves R upper Hessenberg from column j, which n - j rotations of
+ *    adjacent rows reduce to triangular form.
+ *  - inserting a column u appends q = (u - Q * Q^H * u) / rho to Q, with two passes of
+ *    classical Gram-Schmidt, and appends a row to R, so that the new column of R is Q^H * u
+ *    with rho below it. The entries below its diagonal are eliminated from the bottom.
+ *  - inserting a row v^T adds the row e_i^T to Q and the row v^T to R, and the rotations of
+ *    the rows of R with v^T eliminate it.
+ *  - deleting row i appends z = (e_i - Q * Q^H * e_i) / ||.|| to Q. The rotations that reduce
+ *    g = [Q, z]^H * e_i to a multiple of e_1 turn the first column of [Q, z] into a multiple of
+ *    e_i, and [R; 0] into an upper Hessenberg matrix. Dropping the row i and the first column
+ *    of Q, and the first row of R, leaves the factorization of the remaining rows.
+ *
+ * The rotations of Q are applied after those of R, with their sines negated, so that
+ * rot(Q(:, i), Q(:, i - 1)) applies Q * G^H. The inserted column, or the deleted row, must leave
+ * A with full column rank. Only the upper triangle of R is read, and the entries below its
+ * diagonal are not defined on exit. The functions do not synchronize, but copy constants from
+ * pageable memory, so they cannot be captured.
+ */
+
+/*! \brief Workspace of a QR update, with every part aligned to 256 bytes. */
+struct hipsolver_qr_update_layout
+{
+    size_t one       = 0; // the constant 1
+    size_t minus_one = 0; // the real constant -1
+    size_t rho       = 0; // the norm of the column appended to Q
+    size_t c         = 0; // the cosines of the rotations
+    size_t s         = 0; // the sines of the rotations
+    size_t g         = 0; // n + 1 entries
+    size_t w         = 0; // n + 1 entries
+    size_t x         = 0; // the row appended to R
+    size_t e         = 0; // m + 1 entries
+    size_t z         = 0; // the column appended to Q
+    size_t col       = 0; // a column of Q moved by a row insertion
+    size_t size      = 0;
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+
+    hipsolver_qr_update_layout() = default;
+
+    hipsolver_qr_update_layout(size_t type_size, int m, int n)
+    {
+        size_t rows = size_t(m) + 1, cols = size_t(n) + 1;
+        one       = 0;
+        minus_one = one + align(type_size);
+        rho       = minus_one + align(type_size);
+        c         = rho + align(type_size);
+        s         = c + align(type_size * cols);
+        g         = s + align(type_size * cols);
+        w         = g + align(type_size * cols);
+        x         = w + align(type_size * cols);
+        e         = x + align(type_size * cols);
+        z         = e + align(type_size * rows);
+        col       = z + align(type_size * rows);
+        size      = col + align(type_size * rows);
+    }
+};
+
+/*! \brief Returns in lwork the size of the workspace of the updates of a factorization with Q
+ *  of m-by-n, in the units of the work arrays of the back-end. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_qr_update_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int ldq, int ldr, int* lwork)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || n > m || ldq < std::max(m, 1) || ldr < std::max(n, 1) || !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_qr_update_layout layout(sizeof(T), m, n);
+    size_t                     unit = Blas::work_size(1, sizeof(T));
+    size_t                     size = (layout.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Checks the workspace of an update, and writes the constants 1 and -1 to it. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_qr_update_setup(hipStream_t                 stream,
+                                            int                         m,
+                                            int                         n,
+                                            T*                          work,
+                                            int                         lwork,
+                                            hipsolver_qr_update_layout* layout)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    static const T one(1);
+    static const S minus_one(-1);
+
+    *layout = hipsolver_qr_update_layout(sizeof(T), m, n);
+    if(!work || lwork < 0 || Blas::work_size(lwork, sizeof(T)) < layout->size)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    hipsolver_forbid_capture(stream);
+
+    char* base = (char*)work;
+    if(hipMemcpyAsync(base + layout->one, &one, sizeof(T), hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || hipMemcpyAsync(
+              base + layout->minus_one, &minus_one, sizeof(S), hipMemcpyHostToDevice, stream)
+              != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Divides the m-vector q by the norm of q, which is written to the real part of rho. */
+template <typename Blas, typename T>
+hipsolverStatus_t
+    hipsolver_qr_update_normalize(hipsolverHandle_t handle, hipStream_t stream, int m, T* q, T* rho)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    if(hipMemsetAsync(rho, 0, sizeof(T), stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    hipsolverStatus_t status = Blas::nrm2(handle, m, q, 1, (S*)rho);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return Blas::trsm(handle,
+                      HIPSOLVER_SIDE_RIGHT,
+                      HIPSOLVER_FILL_MODE_UPPER,
+                      HIPSOLVER_OP_N,
+                      false,
+                      m,
+                      1,
+                      rho,
+                      1,
+                      q,
+                      m);
+}
+
+/*! \brief Orthogonalizes the m-vector q against the n columns of Q by two passes of classical
+ *  Gram-Schmidt, and sets w to the coefficients of q in Q. w2 holds n entries. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_qr_update_project(hipsolverHandle_t handle,
+                                              int               m,
+                                              int               n,
+                                              const T*          Q,
+                                              int               ldq,
+                                              T*                q,
+                                              T*                w,
+                                              T*                w2,
+                                              const T*          one)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    const hipsolverOperation_t opC = hipsolver_ooc_op_c<T>();
+
+    hipsolverStatus_t status = Blas::gemv(handle, opC, m, n, S(1), Q, ldq, q, 1, S(0), w, 1);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = Blas::gemv(handle, HIPSOLVER_OP_N, m, n, S(-1), Q, ldq, w, 1, S(1), q, 1);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = Blas::gemv(handle, opC, m, n, S(1), Q, ldq, q, 1, S(0), w2, 1);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = Blas::gemv(handle, HIPSOLVER_OP_N, m, n, S(-1), Q, ldq, w2, 1, S(1), q, 1);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = Blas::gemv(handle, HIPSOLVER_OP_N, n, 1, S(1), w2, n, one, 1, S(1), w, 1);
+    return status;
+}
+
+/*! \brief Inserts the m-vector u as column j (1 <= j <= n + 1) of the factorization with Q of
+ *  m-by-n, where n < m. Q must have room for n + 1 columns and R for n + 1 rows and columns. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_qr_insert_column(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               j,
+                                             T*                Q,
+                                             int               ldq,
+                                             T*                R,
+                                             int               ldr,
+                                             const T*          u,
+                                             T*                work,
+                                             int               lwork)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || m <= n || j < 1 || j > n + 1 || ldq < m || ldr < n + 1 || !Q || !R || !u)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipsolver_qr_update_layout layout;
+    status = hipsolver_qr_update_setup<Blas>(stream, m, n, work, lwork, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    const int     p    = j - 1;
+    hipMemcpyKind d2d  = hipMemcpyDeviceToDevice;
+    char*         base = (char*)work;
+    T*            one  = (T*)(base + layout.one);
+    S*            neg  = (S*)(base + layout.minus_one);
+    S*            c    = (S*)(base + layout.c);
+    T*            s    = (T*)(base + layout.s);
+    T*            w2   = (T*)(base + layout.w);
+    T*            q    = Q + size_t(n) * ldq; // the new column of Q
+    T*            w    = R + size_t(p) * ldr; // the new column of R
+
+    // make room for the new column of R, and set its new last row and the diagonal of the moved
+    // columns, which held entries below the diagonal, to zero
+    for(int col = n - 1; col >= p; col--)
+        if(hipMemcpyAsync(
+               R + size_t(col + 1) * ldr, R + size_t(col) * ldr, sizeof(T) * n, d2d, stream)
+           != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    if(hipMemset2DAsync(R + n, sizeof(T) * ldr, 0, sizeof(T), n + 1, stream) != hipSuccess
+       || (n - 1 > p
+           && hipMemset2DAsync(R + (p + 1) + size_t(p + 1) * ldr,
+                               sizeof(T) * (ldr + 1),
+                               0,
+                               sizeof(T),
+                               n - 1 - p,
+                               stream)
+                  != hipSuccess)
+       || hipMemcpyAsync(q, u, sizeof(T) * m, d2d, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // R(0:n-1, p) = Q^H * u, and R(n, p) = ||q|| with q = (u - Q * Q^H * u) / ||.||
+    if(n > 0)
+    {
+        status = hipsolver_qr_update_project<Blas>(handle, m, n, Q, ldq, q, w, w2, one);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+    status = hipsolver_qr_update_normalize<Blas>(handle, stream, m, q, w + n);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // eliminate R(p+1:n, p) from the bottom; the rotation of rows i - 1 and i fills R(i, i)
+    for(int i = n; i > p; i--)
+    {
+        T* x = R + (i - 1) + size_t(i) * ldr;
+        T* y = R + i + size_t(i) * ldr;
+        status = Blas::rotg(handle, w + i - 1, w + i, c + i - 1, s + i - 1);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::rot(handle, n - i + 1, x, ldr, y, ldr, c + i - 1, s + i - 1);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+    if(hipMemsetAsync(w + p + 1, 0, sizeof(T) * (n - p), stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Q = Q * G^H, with the rotations in the same order
+    if(n > p)
+        status = Blas::scal(handle, n - p, neg, s + p, 1);
+    for(int i = n; i > p && status == HIPSOLVER_STATUS_SUCCESS; i--)
+        status = Blas::rot(
+            handle, m, Q + size_t(i) * ldq, 1, Q + size_t(i - 1) * ldq, 1, c + i - 1, s + i - 1);
+    return status;
+}
+
+/*! \brief Deletes column j (1 <= j <= n) of the factorization with Q of m-by-n, leaving Q of
+ *  m-by-(n - 1) and R of order n - 1. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_qr_delete_column(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             int               j,
+                                             T*                Q,
+                                             int               ldq,
+                                             T*                R,
+                                             int               ldr,
+                                             T*                work,
+                                             int               lwork)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 1 || m < n || j < 1 || j > n || ldq < m || ldr < n || !Q || !R)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    hipsolver_qr_update_layout layout;
+    status = hipsolver_qr_update_setup<Blas>(stream, m, n, work, lwork, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    const int     p    = j - 1;
+    hipMemcpyKind d2d  = hipMemcpyDeviceToDevice;
+    char*         base = (char*)work;
+    S*            neg  = (S*)(base + layout.minus_one);
+    S*            c    = (S*)(base + layout.c);
+    T*            s    = (T*)(base + layout.s);
+
+    // R(:, p:n-2) = R(:, p+1:n-1), which is upper Hessenberg
+    for(int col = p; col < n - 1; col++)
+        if(hipMemcpyAsync(
+               R + size_t(col) * ldr, R + size_t(col + 1) * ldr, sizeof(T) * n, d2d, stream)
+           != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // eliminate R(i + 1, i) for i = p, ..., n - 2
+    for(int i = p; i < n - 1; i++)
+    {
+        T* x = R + i + size_t(i) * ldr;
+        status = Blas::rotg(handle, x, x + 1, c + i, s + i);
+        if(status == HIPSOLVER_STATUS_SUCCESS && i < n - 2)
+            status = Blas::rot(handle, n - 2 - i, x + ldr, ldr, x + ldr + 1, ldr, c + i, s + i);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+    if(n - 1 > p
+       && hipMemset2DAsync(
+              R + (p + 1) + size_t(p) * ldr, sizeof(T) * (ldr + 1), 0, sizeof(T), n - 1 - p, stream)
+              != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // Q = Q * G^H, with the rotations in the same order
+    if(n - 1 > p)
+        status = Blas::scal(handle, n - 1 - p, neg, s + p, 1);
+    for(int i = p; i < n - 1 && status == HIPSOLVER_STATUS_SUCCESS; i++)
+        status = Blas::rot(
+            handle, m, Q + size_t(i + 1) * ldq, 1, Q + size_t(i) * ldq, 1, c + i, s + i);
+    return status;
+}
+
+/*! \brief Inserts the n-vector v as row i (1 <= i <= m + 1) of the factorization with Q of
+ *  m-by-n, where Q must have room for m + 1 rows. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_qr_insert_row(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          int               i,
+                                          T*                Q,
+                                          int               ldq,
+                                          T*                R,
+                                          int               ldr,
+                                          const T*          v,
+                                          T*                work,
+                                          int               lwork)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || m < n || i < 1 || i > m + 1 || ldq < m + 1 || ldr < std::max(n, 1))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n > 0 && (!Q || !R || !v))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_qr_update_layout layout;
+    status = hipsolver_qr_update_setup<Blas>(stream, m, n, work, lwork, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    const int     p    = i - 1;
+    hipMemcpyKind d2d  = hipMemcpyDeviceToDevice;
+    char*         base = (char*)work;
+    T*            one  = (T*)(base + layout.one);
+    S*            neg  = (S*)(base + layout.minus_one);
+    S*            c    = (S*)(base + layout.c);
+    T*            s    = (T*)(base + layout.s);
+    T*            x    = (T*)(base + layout.x); // the row appended to R
+    T*            e    = (T*)(base + layout.e); // the column appended to Q
+    T*            col  = (T*)(base + layout.col);
+
+    // move the rows p:m-1 of Q down by one, and set the new row p to zero
+    for(int k = 0; k < n && p < m; k++)
+    {
+        T* Qk = Q + size_t(k) * ldq;
+        if(hipMemcpyAsync(col, Qk + p, sizeof(T) * (m - p), d2d, stream) != hipSuccess
+           || hipMemcpyAsync(Qk + p + 1, col, sizeof(T) * (m - p), d2d, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    if(hipMemset2DAsync(Q + p, sizeof(T) * ldq, 0, sizeof(T), n, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // the factorization of the rows with v^T last is [Q, e_p] * [R; v^T]
+    if(hipMemsetAsync(e, 0, sizeof(T) * (m + 1), stream) != hipSuccess
+       || hipMemcpyAsync(e + p, one, sizeof(T), d2d, stream) != hipSuccess
+       || hipMemcpyAsync(x, v, sizeof(T) * n, d2d, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // eliminate v^T by rotations of the rows k of R with it
+    for(int k = 0; k < n; k++)
+    {
+        T* Rk  = R + k + size_t(k) * ldr;
+        status = Blas::rotg(handle, Rk, x + k, c + k, s + k);
+        if(status == HIPSOLVER_STATUS_SUCCESS && k < n - 1)
+            status = Blas::rot(handle, n - 1 - k, Rk + ldr, ldr, x + k + 1, 1, c + k, s + k);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    // [Q, e_p] = [Q, e_p] * G^H, with the rotations in the same order
+    status = Blas::scal(handle, n, neg, s, 1);
+    for(int k = 0; k < n && status == HIPSOLVER_STATUS_SUCCESS; k++)
+        status = Blas::rot(handle, m + 1, e, 1, Q + size_t(k) * ldq, 1, c + k, s + k);
+    return status;
+}
+
+/*! \brief Deletes row i (1 <= i <= m) of the factorization with Q of m-by-n, where n < m, leaving
+ *  Q of (m - 1)-by-n. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_qr_delete_row(hipsolverHandle_t handle,
+                                          int               m,
+                                          int               n,
+                                          int               i,
+                                          T*                Q,
+                                          int               ldq,
+                                          T*                R,
+                                          int               ldr,
+                                          T*                work,
+                                          int               lwork)
+{
+    using S = typename hipsolver_potrf_update_real<T>::type;
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || m <= n || i < 1 || i > m || ldq < m || ldr < std::max(n, 1))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n > 0 && (!Q || !R))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipsolver_qr_update_layout layout;
+    status = hipsolver_qr_update_setup<Blas>(stream, m, n, work, lwork, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    const hipsolverOperation_t opC  = hipsolver_ooc_op_c<T>();
+    const int                  p    = i - 1;
+    hipMemcpyKind              d2d  = hipMemcpyDeviceToDevice;
+    char*                      base = (char*)work;
+    T*                         one  = (T*)(base + layout.one);
+    S*                         neg  = (S*)(base + layout.minus_one);
+    T*                         rho  = (T*)(base + layout.rho);
+    S*                         c    = (S*)(base + layout.c);
+    T*                         s    = (T*)(base + layout.s);
+    T*                         g    = (T*)(base + layout.g);
+    T*                         w2   = (T*)(base + layout.w);
+    T*                         x    = (T*)(base + layout.x); // the row appended to R
+    T*                         e    = (T*)(base + layout.e);
+    T*                         z    = (T*)(base + layout.z); // the column appended to Q
+
+    // g(0:n-1) = Q^H * e_p, and z = (e_p - Q * Q^H * e_p) / ||.||
+    if(hipMemsetAsync(e, 0, sizeof(T) * m, stream) != hipSuccess
+       || hipMemcpyAsync(e + p, one, sizeof(T), d2d, stream) != hipSuccess
+       || hipMemcpyAsync(z, e, sizeof(T) * m, d2d, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    status = hipsolver_qr_update_project<Blas>(handle, m, n, Q, ldq, z, g, w2, one);
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = hipsolver_qr_update_normalize<Blas>(handle, stream, m, z, rho);
+
+    // g(n) = z^H * e_p, so that g = [Q, z]^H * e_p
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = Blas::gemv(handle, opC, m, 1, S(1), z, m, e, 1, S(0), g + n, 1);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // the factorization of A is [Q, z] * [R; 0], with zeros below the diagonal of R
+    if((n > 1
+        && hipMemset2DAsync(R + 1, sizeof(T) * (ldr + 1), 0, sizeof(T), n - 1, stream)
+               != hipSuccess)
+       || hipMemsetAsync(x, 0, sizeof(T) * n, stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // reduce g to a multiple of e_0 from the bottom, leaving [R; 0] upper Hessenberg
+    for(int k = n; k > 0; k--)
+    {
+        T*  Rk   = R + (k - 1) + size_t(k - 1) * ldr;
+        T*  y    = k == n ? x + (k - 1) : Rk + 1;
+        int incy = k == n ? 1 : ldr;
+        status   = Blas::rotg(handle, g + k - 1, g + k, c + k - 1, s + k - 1);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::rot(handle, n - k + 1, Rk, ldr, y, incy, c + k - 1, s + k - 1);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    // [Q, z] = [Q, z] * G^H, with the rotations in the same order
+    status = Blas::scal(handle, n, neg, s, 1);
+    for(int k = n; k > 0 && status == HIPSOLVER_STATUS_SUCCESS; k--)
+    {
+        T* y   = k == n ? z : Q + size_t(k) * ldq;
+        status = Blas::rot(handle, m, y, 1, Q + size_t(k - 1) * ldq, 1, c + k - 1, s + k - 1);
+    }
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // the first column of [Q, z] is now a multiple of e_p, and the row p a multiple of e_0^T, so
+    // that R is given by the rows 1:n of the Hessenberg matrix, and Q by the columns 1:n of
+    // [Q, z] without the row p
+    for(int k = 0; k < n - 1; k++)
+        if(hipMemcpy2DAsync(R + k + size_t(k) * ldr,
+                            sizeof(T) * ldr,
+                            R + (k + 1) + size_t(k) * ldr,
+                            sizeof(T) * ldr,
+                            sizeof(T),
+                            n - k,
+                            d2d,
+                            stream)
+           != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    if(hipMemcpyAsync(R + (n - 1) + size_t(n - 1) * ldr, x + n - 1, sizeof(T), d2d, stream)
+       != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    for(int k = 0; k < n; k++)
+    {
+        T*       dst = Q + size_t(k) * ldq;
+        const T* src = k == n - 1 ? z : dst + ldq;
+        if((p > 0 && hipMemcpyAsync(dst, src, sizeof(T) * p, d2d, stream) != hipSuccess)
+           || (p < m - 1
+               && hipMemcpyAsync(dst + p, src + p + 1, sizeof(T) * (m - 1 - p), d2d, stream)
+                      != hipSuccess))
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+    return HIPSOLVER_STATUS_SUCCESS;
+}
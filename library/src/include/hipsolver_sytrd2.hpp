@@ -0,0 +1,645 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_ooc.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+/*
+ * Two-stage tridiagonalization, sytrd2, of a real symmetric matrix.
+ *
+ * The one-stage reduction of sytrd computes half of its flops with symv, which reads the whole
+ * trailing matrix for every column, so for large n it is bound by the bandwidth of the device
+ * memory. sytrd2 first reduces A to a band of half-bandwidth b: each panel of b columns below the
+ * band is factorized by geqrf into Q = I - V * T * V^T, and the trailing matrix is updated by
+ * Q^T * A * Q = A - V * Z^T - Z * V^T with symm, trmm, gemm and syr2k, where Y = A * V * T and
+ * Z = Y - V * (T^T * V^T * Y) / 2, so that the first stage is compute-bound. The band, of
+ * (b + 1) * n entries, is then copied to the host and reduced to tridiagonal form by bulge
+ * chasing, as by LAPACK xSB2ST, with O(b * n^2) work. Sweep s annihilates column s below its
+ * subdiagonal with a reflector of rows s + 1 to s + b, and chases the bulge that it creates down
+ * the band with reflectors that each start b rows lower.
+ *
+ * The lower triangle is reduced in a copy W of A, which for an upper triangle is made by
+ * transposing A, so A is not modified unless the vectors are requested. Then Q = Q1 * Q2, with
+ * A = Q * T * Q^T, is formed in A from the identity. The reflectors of step k of b consecutive
+ * sweeps act on 2b - 1 consecutive rows, and those of different steps of later sweeps commute
+ * with them, so Q2 is applied as one blocked reflector of 2b - 1 rows per step, which the host
+ * builds and copies to the device once per block of sweeps. Q1 is then applied with the
+ * reflectors of the panels, which are kept in W below the band. Both are applied by gemm and
+ * trmm, with O(n^3) work.
+ *
+ * The panels and blocked reflectors are small, and their T factors are computed on the host as
+ * by LAPACK xLARFT, so the function synchronizes with the stream of the handle a few times per
+ * panel and once per block of sweeps.
+ */
+
+/******************** IN-CORE DISPATCH ********************/
+inline hipsolverStatus_t hipsolver_sytrd2_geqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
+{
+    return hipsolverSgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_sytrd2_geqrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork)
+{
+    return hipsolverDgeqrf_bufferSize(handle, m, n, A, lda, lwork);
+}
+
+inline hipsolverStatus_t hipsolver_sytrd2_geqrf(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                float*            tau,
+                                                float*            work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverSgeqrf(handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+
+inline hipsolverStatus_t hipsolver_sytrd2_geqrf(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                double*           tau,
+                                                double*           work,
+                                                int               lwork,
+                                                int*              devInfo)
+{
+    return hipsolverDgeqrf(handle, m, n, A, lda, tau, work, lwork, devInfo);
+}
+
+/******************** HOST REDUCTION ********************/
+/*! \brief The half-bandwidth of the first stage, which is smaller than n so that the first
+ *  stage has at least one panel when n > 2. */
+inline int hipsolver_sytrd2_nb(int n)
+{
+    return std::max(1, std::min(32, n - 1));
+}
+
+/*! \brief The number of reflectors of sweep s of the bulge chasing of a band of order n and
+ *  half-bandwidth b. */
+inline int hipsolver_sytrd2_steps(int n, int b, int s)
+{
+    return s < n - 2 ? (n - 3 - s) / b + 1 : 0;
+}
+
+/*! \brief Computes the upper triangular factor T of the blocked reflector of the k reflectors
+ *  with scalars tau, given the upper triangle of G = V^T * V, as by LAPACK xLARFT. */
+template <typename T>
+void hipsolver_sytrd2_larft(int k, const T* G, int ldg, const T* tau, T* Tf, int ldt)
+{
+    std::vector<T> g(k);
+    for(int i = 0; i < k; i++)
+    {
+        for(int r = 0; r < i; r++)
+            g[r] = -tau[i] * G[r + i * ldg];
+
+        // T(0:i, i) = T(0:i, 0:i) * g
+        for(int r = 0; r < i; r++)
+        {
+            T sum = 0;
+            for(int q = r; q < i; q++)
+                sum += Tf[r + q * ldt] * g[q];
+            Tf[r + i * ldt] = sum;
+        }
+        Tf[i + i * ldt] = tau[i];
+    }
+}
+
+/*! \brief The symmetric band matrix of the second stage, of order n and half-bandwidth b. Its
+ *  lower triangle is stored by columns of 2b + 1 entries from the diagonal down, which leaves
+ *  room for the bulges. */
+template <typename T>
+struct hipsolver_sytrd2_band
+{
+    int            n;
+    int            b;
+    int            ld;
+    std::vector<T> ab;
+
+    hipsolver_sytrd2_band(int n, int b)
+        : n(n)
+        , b(b)
+        , ld(2 * b + 1)
+        , ab(size_t(2 * b + 1) * n)
+    {
+    }
+
+    // the entry (i, j) of the lower triangle, with i >= j
+    T& operator()(int i, int j)
+    {
+        return ab[size_t(i - j) + size_t(j) * ld];
+    }
+
+    T sym(int i, int j)
+    {
+        return i >= j ? (*this)(i, j) : (*this)(j, i);
+    }
+
+    /*! \brief Reduces the band to tridiagonal form. If V is not null, the reflector of step t of
+     *  sweep s is kept in the b entries at V + (offset[s] + t) * b, padded with zeros, and its
+     *  scalar in tau[offset[s] + t]. */
+    void chase(T* V, T* tau, const std::vector<size_t>& offset)
+    {
+        std::vector<T> v(b), w(b);
+        for(int s = 0; s < n - 2; s++)
+        {
+            int c = s, r0 = s + 1;
+            for(int t = 0; r0 < n - 1; t++)
+            {
+                // H = I - tk * v * v^T annihilates the entries of column c below row r0
+                int len   = std::min(b, n - r0);
+                T   alpha = (*this)(r0, c), xnorm = 0, tk = 0;
+                for(int k = 1; k < len; k++)
+                    xnorm += (*this)(r0 + k, c) * (*this)(r0 + k, c);
+                xnorm = std::sqrt(xnorm);
+
+                v[0] = 1;
+                for(int k = 1; k < len; k++)
+                    v[k] = 0;
+                if(xnorm != 0)
+                {
+                    T beta = -std::copysign(std::hypot(alpha, xnorm), alpha);
+                    tk     = (beta - alpha) / beta;
+                    for(int k = 1; k < len; k++)
+                        v[k] = (*this)(r0 + k, c) / (alpha - beta);
+                    (*this)(r0, c) = beta;
+                }
+                for(int k = 1; k < len; k++)
+                    (*this)(r0 + k, c) = 0;
+
+                if(tk != 0)
+                {
+                    // the rest of the bulge of the previous step, from the left
+                    for(int j = c + 1; j < r0; j++)
+                    {
+                        T d = 0;
+                        for(int k = 0; k < len; k++)
+                            d += v[k] * (*this)(r0 + k, j);
+                        d *= tk;
+                        for(int k = 0; k < len; k++)
+                            (*this)(r0 + k, j) -= d * v[k];
+                    }
+
+                    // the diagonal block, H * A * H = A - v * w^T - w * v^T
+                    T dot = 0;
+                    for(int i = 0; i < len; i++)
+                    {
+                        w[i] = 0;
+                        for(int k = 0; k < len; k++)
+                            w[i] += sym(r0 + i, r0 + k) * v[k];
+                        w[i] *= tk;
+                        dot += w[i] * v[i];
+                    }
+                    for(int i = 0; i < len; i++)
+                        w[i] -= tk * dot / 2 * v[i];
+                    for(int j = 0; j < len; j++)
+                        for(int i = j; i < len; i++)
+                            (*this)(r0 + i, r0 + j) -= v[i] * w[j] + w[i] * v[j];
+
+                    // the rows below the block, from the right, which creates the next bulge
+                    int end = std::min(n, r0 + len + b);
+                    for(int i = r0 + len; i < end; i++)
+                    {
+                        T d = 0;
+                        for(int k = 0; k < len; k++)
+                            d += (*this)(i, r0 + k) * v[k];
+                        d *= tk;
+                        for(int k = 0; k < len; k++)
+                            (*this)(i, r0 + k) -= d * v[k];
+                    }
+                }
+
+                if(V)
+                {
+                    T* vt = V + (offset[s] + t) * b;
+                    std::copy(v.begin(), v.begin() + len, vt);
+                    std::fill(vt + len, vt + b, T(0));
+                    tau[offset[s] + t] = tk;
+                }
+
+                c = r0;
+                r0 += len;
+            }
+        }
+    }
+
+    /*! \brief Builds the blocked reflectors of the steps of sweeps j to j + b - 1 and returns
+     *  their number. The reflector of step k is the (2b - 1)-by-b matrix at Vg + k * (2b - 1) * b,
+     *  whose column i is the reflector of step k of sweep j + i from its row i, and acts on the
+     *  rows from j + 1 + k * b; its T factor is at Tg + k * b * b. */
+    int group(int j, const T* V, const T* tau, const std::vector<size_t>& offset, T* Vg, T* Tg)
+    {
+        int            ldv   = 2 * b - 1;
+        int            count = hipsolver_sytrd2_steps(n, b, j);
+        std::vector<T> G(size_t(b) * b), tg(b);
+        std::fill(Vg, Vg + size_t(count) * ldv * b, T(0));
+        std::fill(Tg, Tg + size_t(count) * b * b, T(0));
+
+        for(int k = 0; k < count; k++)
+        {
+            T* vg = Vg + size_t(k) * ldv * b;
+            for(int i = 0; i < b; i++)
+            {
+                int s = j + i;
+                tg[i] = 0;
+                if(k >= hipsolver_sytrd2_steps(n, b, s))
+                    continue;
+
+                int len = std::min(b, n - (s + 1 + k * b));
+                std::copy(V + (offset[s] + k) * b, V + (offset[s] + k) * b + len, vg + i + i * ldv);
+                tg[i] = tau[offset[s] + k];
+            }
+
+            for(int i = 0; i < b; i++)
+                for(int q = 0; q <= i; q++)
+                {
+                    T sum = 0;
+                    for(int p = i; p < ldv; p++)
+                        sum += vg[p + q * ldv] * vg[p + i * ldv];
+                    G[q + i * b] = sum;
+                }
+            hipsolver_sytrd2_larft(b, G.data(), b, tg.data(), Tg + size_t(k) * b * b, b);
+        }
+        return count;
+    }
+};
+
+/******************** SYTRD2 ********************/
+/*! \brief Layout of the workspace of sytrd2, with every part aligned to 256 bytes.
+ *
+ *  W is the n-by-n copy of A, padded by b entries so that the band can be read by one strided
+ *  copy; V holds the reflectors of a panel or the blocked reflectors of a block of sweeps, Y the
+ *  products of a panel or of a blocked reflector, T their T factors, and G the products of V with
+ *  itself and with Y.
+ */
+struct hipsolver_sytrd2_layout
+{
+    int    b     = 0;
+    int    lwork = 0; // the workspace of geqrf, in the units of the back-end
+    size_t w;
+    size_t v;
+    size_t y;
+    size_t t;
+    size_t g;
+    size_t tau;
+    size_t info;
+    size_t work;
+    size_t size;
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+};
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_sytrd2_layout_init(hipsolverHandle_t        handle,
+                                               hipsolverEigMode_t       jobz,
+                                               hipsolverFillMode_t      uplo,
+                                               int                      n,
+                                               int                      lda,
+                                               hipsolver_sytrd2_layout* layout)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(jobz != HIPSOLVER_EIG_MODE_NOVECTOR && jobz != HIPSOLVER_EIG_MODE_VECTOR)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || lda < std::max(n, 1))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    int b = hipsolver_sytrd2_nb(n), lwork = 0;
+    if(n > 2)
+    {
+        hipsolverStatus_t status
+            = hipsolver_sytrd2_geqrf_bufferSize(handle, n - b, b, (T*)nullptr, n, &lwork);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    // the blocked reflectors of a block of sweeps are fewer than n / b + 1
+    size_t t      = sizeof(T);
+    size_t groups = size_t(n / b + 1);
+    size_t vsize  = size_t(n) * b;
+    size_t tsize  = size_t(b) * b;
+    if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+    {
+        vsize = std::max(vsize, groups * (2 * b - 1) * b);
+        tsize = std::max(tsize, groups * b * b);
+    }
+
+    layout->b     = b;
+    layout->lwork = lwork;
+    layout->w     = 0;
+    layout->v     = layout->w + layout->align(t * (size_t(n) * n + b));
+    layout->y     = layout->v + layout->align(t * vsize);
+    layout->t     = layout->y + layout->align(t * n * b);
+    layout->g     = layout->t + layout->align(t * tsize);
+    layout->tau   = layout->g + layout->align(t * b * b);
+    layout->info  = layout->tau + layout->align(t * b);
+    layout->work  = layout->info + layout->align(sizeof(int));
+    layout->size  = layout->work + layout->align(Blas::work_size(lwork, t));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_sytrd2_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              int                 lda,
+                                              int*                lwork)
+{
+    hipsolver_sytrd2_layout layout;
+    hipsolverStatus_t       status
+        = hipsolver_sytrd2_layout_init<Blas, T>(handle, jobz, uplo, n, lda, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    size_t unit = Blas::work_size(1, sizeof(T));
+    size_t size = (layout.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Reduces the symmetric matrix A to the tridiagonal matrix T with diagonal D and
+ *  off-diagonal E, in two stages. If jobz is HIPSOLVER_EIG_MODE_VECTOR, A is overwritten by the
+ *  orthogonal Q with A = Q * T * Q^T. devInfo is set to zero.
+ */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_sytrd2(hipsolverHandle_t   handle,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverFillMode_t uplo,
+                                   int                 n,
+                                   T*                  A,
+                                   int                 lda,
+                                   T*                  D,
+                                   T*                  E,
+                                   T*                  work,
+                                   int                 lwork,
+                                   int*                devInfo)
+{
+    hipsolver_sytrd2_layout layout;
+    hipsolverStatus_t       status
+        = hipsolver_sytrd2_layout_init<Blas, T>(handle, jobz, uplo, n, lda, &layout);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    if(!devInfo || (n > 0 && (!A || !D || (n > 1 && !E))))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(lwork < 0 || Blas::work_size(lwork, sizeof(T)) < layout.size || !work)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(hipMemsetAsync(devInfo, 0, sizeof(int), stream) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    // quick return
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+    hipsolver_forbid_capture(stream);
+
+    const hipsolverOperation_t opN     = HIPSOLVER_OP_N;
+    const hipsolverOperation_t opT     = HIPSOLVER_OP_T;
+    const hipsolverFillMode_t  lower   = HIPSOLVER_FILL_MODE_LOWER;
+    const hipsolverFillMode_t  upper   = HIPSOLVER_FILL_MODE_UPPER;
+    const bool                 vectors = jobz == HIPSOLVER_EIG_MODE_VECTOR;
+
+    const int b     = layout.b;
+    const int ldv   = 2 * b - 1;
+    size_t    t     = sizeof(T);
+    char*     base  = (char*)work;
+    T*        W     = (T*)(base + layout.w);
+    T*        V     = (T*)(base + layout.v);
+    T*        Y     = (T*)(base + layout.y);
+    T*        Tf    = (T*)(base + layout.t);
+    T*        G     = (T*)(base + layout.g);
+    T*        tau   = (T*)(base + layout.tau);
+    int*      info  = (int*)(base + layout.info);
+    T*        gwork = (T*)(base + layout.work);
+
+    // hipsolver_sytrd2_layout_init checked uplo
+    if(uplo == upper)
+        status = Blas::geam(handle, n, n, A, lda, W, n);
+    else if(hipMemcpy2DAsync(W, t * n, A, t * lda, t * n, n, hipMemcpyDeviceToDevice, stream)
+            != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    auto sync = [&](hipError_t err) {
+        if(err == hipSuccess)
+            err = hipStreamSynchronize(stream);
+        return err == hipSuccess ? HIPSOLVER_STATUS_SUCCESS : HIPSOLVER_STATUS_INTERNAL_ERROR;
+    };
+
+    // V = the k reflectors of the panel at column i below the band, with their unit diagonal and
+    // the zeros above it, which W holds as part of R
+    std::vector<T> hv(size_t(b) * b);
+    auto           panel_v = [&](int i, int rows, int k) {
+        T*         P   = W + (i + b) + size_t(i) * n;
+        hipError_t err = hipMemcpy2DAsync(
+            V, t * n, P, t * n, t * rows, k, hipMemcpyDeviceToDevice, stream);
+        if(err == hipSuccess)
+            err = hipMemcpy2DAsync(
+                hv.data(), t * k, V, t * n, t * k, k, hipMemcpyDeviceToHost, stream);
+        hipsolverStatus_t st = sync(err);
+        if(st != HIPSOLVER_STATUS_SUCCESS)
+            return st;
+
+        for(int q = 0; q < k; q++)
+        {
+            std::fill(hv.begin() + size_t(q) * k, hv.begin() + size_t(q) * k + q, T(0));
+            hv[q + size_t(q) * k] = 1;
+        }
+        return sync(
+            hipMemcpy2DAsync(V, t * n, hv.data(), t * k, t * k, k, hipMemcpyHostToDevice, stream));
+    };
+
+    // first stage: the panels are factorized and the trailing matrices updated, and the T
+    // factors of the panels are kept for the vectors
+    std::vector<T> ht, hg(size_t(b) * b), htau(b);
+    int            panels = 0;
+    for(int i = 0; i + b + 1 < n; i += b)
+        panels++;
+    if(vectors)
+        ht.resize(size_t(panels) * b * b);
+
+    for(int p = 0; p < panels; p++)
+    {
+        int i = p * b, r0 = i + b, rows = n - r0, k = std::min(rows, b);
+        T*  A22 = W + r0 + size_t(r0) * n;
+
+        status = hipsolver_sytrd2_geqrf(
+            handle, rows, b, W + r0 + size_t(i) * n, n, tau, gwork, layout.lwork, info);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = panel_v(i, rows, k);
+
+        // T from tau and G = V^T * V
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::herk(handle, upper, opT, k, rows, T(1), V, n, T(0), G, b);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+        {
+            hipError_t err = hipMemcpy2DAsync(
+                hg.data(), t * b, G, t * b, t * k, k, hipMemcpyDeviceToHost, stream);
+            if(err == hipSuccess)
+                err = hipMemcpyAsync(htau.data(), tau, t * k, hipMemcpyDeviceToHost, stream);
+            status = sync(err);
+        }
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        std::vector<T> hT(size_t(b) * b, T(0));
+        hipsolver_sytrd2_larft(k, hg.data(), b, htau.data(), hT.data(), b);
+        if(vectors)
+            std::copy(hT.begin(), hT.end(), ht.begin() + size_t(p) * b * b);
+        status = sync(hipMemcpyAsync(Tf, hT.data(), t * b * b, hipMemcpyHostToDevice, stream));
+
+        // Y = A22 * V * T, G = T^T * V^T * Y, Y = Z = Y - V * G / 2, A22 = A22 - V * Z^T - Z * V^T
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::symm(handle, lower, rows, k, T(1), A22, n, V, n, T(0), Y, n);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::trmm(handle, HIPSOLVER_SIDE_RIGHT, upper, opN, rows, k, Tf, b, Y, n);
+        if(status == HIPSOLVER_STATUS_SUCCESS
+           && hipMemsetAsync(G, 0, t * b * b, stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::gemm(handle, opT, opN, k, k, rows, T(1), V, n, Y, n, G, b);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::trmm(handle, HIPSOLVER_SIDE_LEFT, upper, opT, k, k, Tf, b, G, b);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::gemm(handle, opN, opN, rows, k, k, T(-0.5), V, n, G, b, Y, n);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = Blas::syr2k(handle, lower, rows, k, V, n, Y, n, A22, n);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    // second stage: column c of the band is the run of b + 1 entries of W from its diagonal
+    hipsolver_sytrd2_band<T> band(n, b);
+    status = sync(hipMemcpy2DAsync(band.ab.data(),
+                                   t * band.ld,
+                                   W,
+                                   t * (n + 1),
+                                   t * (b + 1),
+                                   n,
+                                   hipMemcpyDeviceToHost,
+                                   stream));
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    std::vector<size_t> offset(n + 1, 0);
+    for(int s = 0; s < n; s++)
+        offset[s + 1] = offset[s] + hipsolver_sytrd2_steps(n, b, s);
+    std::vector<T> hV, hVtau;
+    if(vectors)
+    {
+        hV.resize(offset[n] * b);
+        hVtau.resize(offset[n]);
+    }
+    band.chase(vectors ? hV.data() : nullptr, hVtau.data(), offset);
+
+    std::vector<T> hd(n), he(n);
+    for(int i = 0; i < n; i++)
+    {
+        hd[i] = band(i, i);
+        he[i] = i + 1 < n ? band(i + 1, i) : T(0);
+    }
+    hipError_t err = hipMemcpyAsync(D, hd.data(), t * n, hipMemcpyHostToDevice, stream);
+    if(err == hipSuccess && n > 1)
+        err = hipMemcpyAsync(E, he.data(), t * (n - 1), hipMemcpyHostToDevice, stream);
+    status = sync(err);
+    if(status != HIPSOLVER_STATUS_SUCCESS || !vectors)
+        return status;
+
+    // Q = I
+    std::vector<T> ones(n, T(1));
+    err = hipMemset2DAsync(A, t * lda, 0, t * n, n, stream);
+    if(err == hipSuccess)
+        err = hipMemcpy2DAsync(
+            A, t * (lda + 1), ones.data(), t, t, n, hipMemcpyHostToDevice, stream);
+    status = sync(err);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // Q = H * Q for the blocked reflector H = I - V * T * V^T of rows rows from row r, given on
+    // the device, applied to the columns of Q from column c
+    auto apply = [&](const T* Vr, int ldvr, const T* Tr, int r, int rows, int k, int c) {
+        if(hipMemsetAsync(Y, 0, t * k * (n - c), stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        T*                Qr = A + r + size_t(c) * lda;
+        hipsolverStatus_t st
+            = Blas::gemm(handle, opT, opN, k, n - c, rows, T(1), Vr, ldvr, Qr, lda, Y, k);
+        if(st == HIPSOLVER_STATUS_SUCCESS)
+            st = Blas::trmm(handle, HIPSOLVER_SIDE_LEFT, upper, opN, k, n - c, Tr, b, Y, k);
+        if(st == HIPSOLVER_STATUS_SUCCESS)
+            st = Blas::gemm(handle, opN, opN, rows, n - c, k, Vr, ldvr, Y, k, Qr, lda);
+        return st;
+    };
+
+    // Q = Q2, applied by blocks of b sweeps from the last, in which the blocked reflectors act
+    // on the rows and columns from j + 1 on
+    std::vector<T> hVg(size_t(n / b + 1) * ldv * b), hTg(size_t(n / b + 1) * b * b);
+    int            sweeps = std::max(n - 2, 0);
+    for(int j = (sweeps - 1) / b * b; j >= 0 && sweeps > 0; j -= b)
+    {
+        int count = band.group(j, hV.data(), hVtau.data(), offset, hVg.data(), hTg.data());
+        err       = hipMemcpyAsync(
+            V, hVg.data(), t * count * ldv * b, hipMemcpyHostToDevice, stream);
+        if(err == hipSuccess)
+            err = hipMemcpyAsync(Tf, hTg.data(), t * count * b * b, hipMemcpyHostToDevice, stream);
+        status = sync(err);
+
+        for(int k = 0; k < count && status == HIPSOLVER_STATUS_SUCCESS; k++)
+        {
+            int r = j + 1 + k * b;
+            status = apply(V + size_t(k) * ldv * b,
+                           ldv,
+                           Tf + size_t(k) * b * b,
+                           r,
+                           std::min(ldv, n - r),
+                           b,
+                           j + 1);
+        }
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    // Q = Q1 * Q2, applied by panels from the last
+    for(int p = panels - 1; p >= 0; p--)
+    {
+        int i = p * b, rows = n - i - b, k = std::min(rows, b);
+        status = panel_v(i, rows, k);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = sync(hipMemcpyAsync(
+                Tf, ht.data() + size_t(p) * b * b, t * b * b, hipMemcpyHostToDevice, stream));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = apply(V, n, Tf, i + b, rows, k, 1);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
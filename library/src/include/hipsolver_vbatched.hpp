@@ -0,0 +1,984 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <vector>
+
+/*
+ * Variable-size batched potrf, getrf and getrs.
+ *
+ * Every problem of a variable-size batch has its own order and leading dimensions, given in
+ * device arrays. The pivots of the problems are stored one after the other, n[b] for problem b.
+ * A problem whose sizes are invalid is not solved, and its info is set to minus the position of
+ * the first invalid size in the arguments of the function, as for the argument checks of LAPACK.
+ *
+ * A back-end with variable-size batched kernels (Blas::vbatched_kernels()) solves the whole batch
+ * with one kernel, one block per problem, which reads the sizes of its problem on the device (see
+ * hcc_detail/hipsolver_vbatched_kernels.hpp). The workspace holds the offsets of the pivots, and
+ * only depends on batch_count, so that nothing is read back from the device and the call does not
+ * synchronize with the stream of the handle.
+ *
+ * Otherwise, the sizes are copied to the host, which synchronizes with the stream of the handle,
+ * and the problems are grouped by shape. Each group is solved by one call of the batched
+ * function, so that a batch of a few distinct sizes takes a few launches, instead of one per
+ * problem or padding every problem to the largest. The groups keep the device groups and the
+ * chunking of the batched functions. A group whose problems are consecutive in the batch is
+ * solved in place, through slices of the arrays of the call. The addresses of the matrices of the
+ * other groups are gathered in the workspace, and their infos and pivots are computed in the
+ * workspace, by device copies of runs of consecutive problems, so that batches sorted by size
+ * take the fewest copies.
+ */
+
+/******************** BATCHED DISPATCH ********************/
+inline hipsolverStatus_t hipsolver_vbatched_potrf_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             float**             A,
+                                                             int                 lda,
+                                                             int*                lwork,
+                                                             int                 batch_count)
+{
+    return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_potrf_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             double**            A,
+                                                             int                 lda,
+                                                             int*                lwork,
+                                                             int                 batch_count)
+{
+    return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_potrf_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             hipsolverComplex**  A,
+                                                             int                 lda,
+                                                             int*                lwork,
+                                                             int                 batch_count)
+{
+    return hipsolverCpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_potrf_bufferSize(hipsolverHandle_t        handle,
+                                                             hipsolverFillMode_t      uplo,
+                                                             int                      n,
+                                                             hipsolverDoubleComplex** A,
+                                                             int                      lda,
+                                                             int*                     lwork,
+                                                             int                      batch_count)
+{
+    return hipsolverZpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_potrf(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  float**             A,
+                                                  int                 lda,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                devInfo,
+                                                  int                 batch_count)
+{
+    return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_potrf(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  double**            A,
+                                                  int                 lda,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                devInfo,
+                                                  int                 batch_count)
+{
+    return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_potrf(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  hipsolverComplex**  A,
+                                                  int                 lda,
+                                                  hipsolverComplex*   work,
+                                                  int                 lwork,
+                                                  int*                devInfo,
+                                                  int                 batch_count)
+{
+    return hipsolverCpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_potrf(hipsolverHandle_t        handle,
+                                                  hipsolverFillMode_t      uplo,
+                                                  int                      n,
+                                                  hipsolverDoubleComplex** A,
+                                                  int                      lda,
+                                                  hipsolverDoubleComplex*  work,
+                                                  int                      lwork,
+                                                  int*                     devInfo,
+                                                  int                      batch_count)
+{
+    return hipsolverZpotrfBatched(handle, uplo, n, A, lda, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf_bufferSize(
+    hipsolverHandle_t handle, int n, float** A, int lda, int* lwork, int batch_count)
+{
+    return hipsolverSgetrfBatched_bufferSize(handle, n, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf_bufferSize(
+    hipsolverHandle_t handle, int n, double** A, int lda, int* lwork, int batch_count)
+{
+    return hipsolverDgetrfBatched_bufferSize(handle, n, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf_bufferSize(
+    hipsolverHandle_t handle, int n, hipsolverComplex** A, int lda, int* lwork, int batch_count)
+{
+    return hipsolverCgetrfBatched_bufferSize(handle, n, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf_bufferSize(hipsolverHandle_t        handle,
+                                                             int                      n,
+                                                             hipsolverDoubleComplex** A,
+                                                             int                      lda,
+                                                             int*                     lwork,
+                                                             int                      batch_count)
+{
+    return hipsolverZgetrfBatched_bufferSize(handle, n, n, A, lda, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf(hipsolverHandle_t handle,
+                                                  int               n,
+                                                  float**           A,
+                                                  int               lda,
+                                                  float*            work,
+                                                  int               lwork,
+                                                  int*              devIpiv,
+                                                  int*              devInfo,
+                                                  int               batch_count)
+{
+    return hipsolverSgetrfBatched(
+        handle, n, n, A, lda, work, lwork, devIpiv, n, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf(hipsolverHandle_t handle,
+                                                  int               n,
+                                                  double**          A,
+                                                  int               lda,
+                                                  double*           work,
+                                                  int               lwork,
+                                                  int*              devIpiv,
+                                                  int*              devInfo,
+                                                  int               batch_count)
+{
+    return hipsolverDgetrfBatched(
+        handle, n, n, A, lda, work, lwork, devIpiv, n, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf(hipsolverHandle_t  handle,
+                                                  int                n,
+                                                  hipsolverComplex** A,
+                                                  int                lda,
+                                                  hipsolverComplex*  work,
+                                                  int                lwork,
+                                                  int*               devIpiv,
+                                                  int*               devInfo,
+                                                  int                batch_count)
+{
+    return hipsolverCgetrfBatched(
+        handle, n, n, A, lda, work, lwork, devIpiv, n, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrf(hipsolverHandle_t        handle,
+                                                  int                      n,
+                                                  hipsolverDoubleComplex** A,
+                                                  int                      lda,
+                                                  hipsolverDoubleComplex*  work,
+                                                  int                      lwork,
+                                                  int*                     devIpiv,
+                                                  int*                     devInfo,
+                                                  int                      batch_count)
+{
+    return hipsolverZgetrfBatched(
+        handle, n, n, A, lda, work, lwork, devIpiv, n, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs_bufferSize(hipsolverHandle_t    handle,
+                                                             hipsolverOperation_t trans,
+                                                             int                  n,
+                                                             int                  nrhs,
+                                                             float**              A,
+                                                             int                  lda,
+                                                             int*                 devIpiv,
+                                                             float**              B,
+                                                             int                  ldb,
+                                                             int*                 lwork,
+                                                             int                  batch_count)
+{
+    return hipsolverSgetrsBatched_bufferSize(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs_bufferSize(hipsolverHandle_t    handle,
+                                                             hipsolverOperation_t trans,
+                                                             int                  n,
+                                                             int                  nrhs,
+                                                             double**             A,
+                                                             int                  lda,
+                                                             int*                 devIpiv,
+                                                             double**             B,
+                                                             int                  ldb,
+                                                             int*                 lwork,
+                                                             int                  batch_count)
+{
+    return hipsolverDgetrsBatched_bufferSize(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs_bufferSize(hipsolverHandle_t    handle,
+                                                             hipsolverOperation_t trans,
+                                                             int                  n,
+                                                             int                  nrhs,
+                                                             hipsolverComplex**   A,
+                                                             int                  lda,
+                                                             int*                 devIpiv,
+                                                             hipsolverComplex**   B,
+                                                             int                  ldb,
+                                                             int*                 lwork,
+                                                             int                  batch_count)
+{
+    return hipsolverCgetrsBatched_bufferSize(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs_bufferSize(hipsolverHandle_t        handle,
+                                                             hipsolverOperation_t     trans,
+                                                             int                      n,
+                                                             int                      nrhs,
+                                                             hipsolverDoubleComplex** A,
+                                                             int                      lda,
+                                                             int*                     devIpiv,
+                                                             hipsolverDoubleComplex** B,
+                                                             int                      ldb,
+                                                             int*                     lwork,
+                                                             int                      batch_count)
+{
+    return hipsolverZgetrsBatched_bufferSize(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, lwork, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs(hipsolverHandle_t    handle,
+                                                  hipsolverOperation_t trans,
+                                                  int                  n,
+                                                  int                  nrhs,
+                                                  float**              A,
+                                                  int                  lda,
+                                                  int*                 devIpiv,
+                                                  float**              B,
+                                                  int                  ldb,
+                                                  float*               work,
+                                                  int                  lwork,
+                                                  int*                 devInfo,
+                                                  int                  batch_count)
+{
+    return hipsolverSgetrsBatched(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs(hipsolverHandle_t    handle,
+                                                  hipsolverOperation_t trans,
+                                                  int                  n,
+                                                  int                  nrhs,
+                                                  double**             A,
+                                                  int                  lda,
+                                                  int*                 devIpiv,
+                                                  double**             B,
+                                                  int                  ldb,
+                                                  double*              work,
+                                                  int                  lwork,
+                                                  int*                 devInfo,
+                                                  int                  batch_count)
+{
+    return hipsolverDgetrsBatched(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs(hipsolverHandle_t    handle,
+                                                  hipsolverOperation_t trans,
+                                                  int                  n,
+                                                  int                  nrhs,
+                                                  hipsolverComplex**   A,
+                                                  int                  lda,
+                                                  int*                 devIpiv,
+                                                  hipsolverComplex**   B,
+                                                  int                  ldb,
+                                                  hipsolverComplex*    work,
+                                                  int                  lwork,
+                                                  int*                 devInfo,
+                                                  int                  batch_count)
+{
+    return hipsolverCgetrsBatched(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, work, lwork, devInfo, batch_count);
+}
+
+inline hipsolverStatus_t hipsolver_vbatched_getrs(hipsolverHandle_t        handle,
+                                                  hipsolverOperation_t     trans,
+                                                  int                      n,
+                                                  int                      nrhs,
+                                                  hipsolverDoubleComplex** A,
+                                                  int                      lda,
+                                                  int*                     devIpiv,
+                                                  hipsolverDoubleComplex** B,
+                                                  int                      ldb,
+                                                  hipsolverDoubleComplex*  work,
+                                                  int                      lwork,
+                                                  int*                     devInfo,
+                                                  int                      batch_count)
+{
+    return hipsolverZgetrsBatched(
+        handle, trans, n, nrhs, A, lda, devIpiv, n, B, ldb, work, lwork, devInfo, batch_count);
+}
+
+/******************** GROUPS ********************/
+/*! \brief Problems of a variable-size batch that share their shape, solved by one call. */
+struct hipsolver_vbatched_group
+{
+    int              n, nrhs, lda, ldb;
+    std::vector<int> index; // the problems of the group, in increasing order
+
+    int count() const
+    {
+        return int(index.size());
+    }
+
+    // the problems are consecutive in the batch
+    bool in_place() const
+    {
+        return index.back() - index.front() + 1 == count();
+    }
+
+    /*! \brief Calls f(k, b, len) for the runs of len consecutive problems of the group, from its
+     *  problem k, which is problem b of the batch. */
+    template <typename F>
+    hipsolverStatus_t runs(F f) const
+    {
+        for(int k = 0, len; k < count(); k += len)
+        {
+            for(len = 1; k + len < count() && index[k + len] == index[k] + len; len++)
+                ;
+            hipsolverStatus_t status = f(k, index[k], len);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+};
+
+/*! \brief Groups of a variable-size batch, and the layout of the workspace, with every part
+ *  aligned to 256 bytes. The arrays of the groups that are not solved in place are sized for the
+ *  largest of them, and the workspace of the batched function follows them. A batch solved by the
+ *  kernels has no groups, and its workspace only holds the offsets of the pivots. */
+struct hipsolver_vbatched_plan
+{
+    bool kernel = false; // the batch is solved by the kernels of the back-end
+
+    std::vector<hipsolver_vbatched_group> groups;
+    std::vector<size_t>                   offset;  // the first pivot of each problem
+    std::vector<std::array<int, 2>>       invalid; // the problems of invalid sizes, and their infos
+
+    size_t A     = 0; // the addresses of the matrices of a group
+    size_t B     = 0; // the addresses of the right-hand sides of a group
+    size_t info  = 0; // the infos of a group
+    size_t ipiv  = 0; // the pivots of a group
+    size_t work  = 0; // the workspace of the batched function
+    size_t size  = 0;
+    int    lwork = 0; // the workspace of the batched function, in the units of the back-end
+
+    static size_t align(size_t size)
+    {
+        return (size + 255) / 256 * 256;
+    }
+
+    bool in_place() const
+    {
+        for(const hipsolver_vbatched_group& g : groups)
+            if(!g.in_place())
+                return false;
+        return true;
+    }
+};
+
+/*! \brief Lays out the workspace of the batch_count problems of a variable-size batch, whose
+ *  sizes are in the device arrays n, nrhs, lda and ldb, and groups them by shape if the back-end
+ *  has no variable-size batched kernels.
+ *
+ *  nrhs and ldb are null for the factorizations; solve is true if the problems have right-hand
+ *  sides. pivots is true if the problems have pivots. args holds the positions of n, nrhs, lda
+ *  and ldb in the arguments of the function. query(group, &lwork) sets lwork to the workspace of
+ *  the batched function on the problems of group.
+ */
+template <typename Blas, typename T, typename Q>
+hipsolverStatus_t hipsolver_vbatched_build(hipsolverHandle_t        handle,
+                                           const int*               n,
+                                           const int*               nrhs,
+                                           const int*               lda,
+                                           const int*               ldb,
+                                           int                      batch_count,
+                                           bool                     pivots,
+                                           std::array<int, 4>       args,
+                                           Q                        query,
+                                           hipsolver_vbatched_plan* plan)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    bool solve = nrhs || ldb;
+    if(batch_count < 0 || (batch_count > 0 && (!n || !lda || (solve && (!nrhs || !ldb)))))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    plan->kernel = Blas::vbatched_kernels();
+    plan->groups.clear();
+    plan->invalid.clear();
+    plan->lwork = 0;
+    if(plan->kernel)
+    {
+        plan->size = pivots ? plan->align(sizeof(int64_t) * batch_count) : 0;
+        plan->work = plan->size;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // the sizes are read on the host
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    std::vector<int> hn(batch_count), hnrhs(batch_count), hlda(batch_count), hldb(batch_count);
+    auto copy = [&](std::vector<int>& h, const int* d) {
+        return hipMemcpyAsync(
+                   h.data(), d, sizeof(int) * batch_count, hipMemcpyDeviceToHost, stream)
+               == hipSuccess;
+    };
+    if(batch_count > 0)
+    {
+        bool ok = copy(hn, n) && copy(hlda, lda)
+                  && (!solve || (copy(hnrhs, nrhs) && copy(hldb, ldb)));
+        if(!ok || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    // the groups are ordered by shape
+    std::map<std::array<int, 4>, hipsolver_vbatched_group> groups;
+    plan->offset.assign(batch_count + 1, 0);
+    for(int b = 0; b < batch_count; b++)
+    {
+        int bn   = hn[b], bnrhs = hnrhs[b], blda = hlda[b], bldb = hldb[b];
+        int info = 0;
+        if(bn < 0)
+            info = -args[0];
+        else if(solve && bnrhs < 0)
+            info = -args[1];
+        else if(blda < std::max(bn, 1))
+            info = -args[2];
+        else if(solve && bldb < std::max(bn, 1))
+            info = -args[3];
+        plan->offset[b + 1] = plan->offset[b] + std::max(bn, 0);
+        if(info)
+        {
+            plan->invalid.push_back({b, info});
+            continue;
+        }
+
+        hipsolver_vbatched_group& g = groups[{bn, bnrhs, blda, bldb}];
+        g.n                         = bn;
+        g.nrhs                      = bnrhs;
+        g.lda                       = blda;
+        g.ldb                       = bldb;
+        g.index.push_back(b);
+    }
+
+    size_t count = 0, pivot_count = 0;
+    for(auto& it : groups)
+    {
+        int lwork;
+        status = query(it.second, &lwork);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        plan->lwork = std::max(plan->lwork, lwork);
+
+        if(!it.second.in_place())
+        {
+            count       = std::max(count, size_t(it.second.count()));
+            pivot_count = std::max(pivot_count, size_t(it.second.count()) * it.second.n);
+        }
+        plan->groups.push_back(std::move(it.second));
+    }
+
+    plan->A    = 0;
+    plan->B    = plan->A + plan->align(sizeof(T*) * count);
+    plan->info = plan->B + (solve ? plan->align(sizeof(T*) * count) : 0);
+    plan->ipiv = plan->info + plan->align(sizeof(int) * count);
+    plan->work = plan->ipiv + (pivots ? plan->align(sizeof(int) * pivot_count) : 0);
+    plan->size = plan->work + Blas::work_size(plan->lwork, sizeof(T));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Returns in lwork the size of the workspace of a variable-size batch, in the units of
+ *  the work arrays of the back-end. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_vbatched_lwork(const hipsolver_vbatched_plan& plan, int* lwork)
+{
+    size_t unit = Blas::work_size(1, sizeof(T));
+    size_t size = (plan.size + unit - 1) / unit;
+    if(size > size_t(INT_MAX))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lwork = int(size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Solves the groups of a variable-size batch.
+ *
+ *  A and B are the device arrays of addresses of the call, and B is null for the factorizations.
+ *  ipiv and info are the device arrays of pivots and infos of the call, or null. The pivots are
+ *  read by the solves (pivots_in) and written by the factorizations. launch(group, A, B, ipiv,
+ *  info, work, lwork) calls the batched function on the problems of group, with the arrays of
+ *  the group.
+ */
+template <typename Blas, typename T, typename F>
+hipsolverStatus_t hipsolver_vbatched_run(hipsolverHandle_t              handle,
+                                         const hipsolver_vbatched_plan& plan,
+                                         T* const*                      A,
+                                         T* const*                      B,
+                                         int*                           ipiv,
+                                         bool                           pivots_in,
+                                         int*                           info,
+                                         T*                             work,
+                                         int                            lwork,
+                                         F                              launch)
+{
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(work && (lwork < 0 || Blas::work_size(lwork, sizeof(T)) < plan.size))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!work && plan.work > 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the batched function takes the rest of the workspace
+    size_t unit   = Blas::work_size(1, sizeof(T));
+    char*  base   = (char*)work;
+    T*     bwork  = work ? (T*)(base + plan.work) : nullptr;
+    int    blwork = work ? int((Blas::work_size(lwork, sizeof(T)) - plan.work) / unit) : lwork;
+
+    hipMemcpyKind d2d = hipMemcpyDeviceToDevice;
+    for(const hipsolver_vbatched_group& g : plan.groups)
+    {
+        int n = g.n;
+        if(g.in_place())
+        {
+            int first = g.index.front();
+            status    = launch(g,
+                            (T**)A + first,
+                            B ? (T**)B + first : nullptr,
+                            ipiv ? ipiv + plan.offset[first] : nullptr,
+                            info ? info + first : nullptr,
+                            bwork,
+                            blwork);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            continue;
+        }
+
+        T**  gA    = (T**)(base + plan.A);
+        T**  gB    = B ? (T**)(base + plan.B) : nullptr;
+        int* gipiv = ipiv ? (int*)(base + plan.ipiv) : nullptr;
+        int* ginfo = info ? (int*)(base + plan.info) : nullptr;
+
+        if(ginfo && hipMemsetAsync(ginfo, 0, sizeof(int) * g.count(), stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+        // the addresses, and the pivots read by the solves, are gathered on the device
+        auto gather = [&](int k, int b, int len) {
+            bool ok = hipMemcpyAsync(gA + k, A + b, sizeof(T*) * len, d2d, stream) == hipSuccess;
+            if(ok && gB)
+                ok = hipMemcpyAsync(gB + k, B + b, sizeof(T*) * len, d2d, stream) == hipSuccess;
+            if(ok && gipiv && pivots_in && n > 0)
+                ok = hipMemcpyAsync(gipiv + size_t(k) * n,
+                                    ipiv + plan.offset[b],
+                                    sizeof(int) * len * n,
+                                    d2d,
+                                    stream)
+                     == hipSuccess;
+            return ok ? HIPSOLVER_STATUS_SUCCESS : HIPSOLVER_STATUS_INTERNAL_ERROR;
+        };
+        status = g.runs(gather);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        status = launch(g, gA, gB, gipiv, ginfo, bwork, blwork);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+
+        auto scatter = [&](int k, int b, int len) {
+            bool ok = !ginfo
+                      || hipMemcpyAsync(info + b, ginfo + k, sizeof(int) * len, d2d, stream)
+                             == hipSuccess;
+            if(ok && gipiv && !pivots_in && n > 0)
+                ok = hipMemcpyAsync(ipiv + plan.offset[b],
+                                    gipiv + size_t(k) * n,
+                                    sizeof(int) * len * n,
+                                    d2d,
+                                    stream)
+                     == hipSuccess;
+            return ok ? HIPSOLVER_STATUS_SUCCESS : HIPSOLVER_STATUS_INTERNAL_ERROR;
+        };
+        status = g.runs(scatter);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    // the infos of the problems of invalid sizes are copied from the plan, before it is released
+    if(info && !plan.invalid.empty())
+    {
+        for(const std::array<int, 2>& bad : plan.invalid)
+            if(hipMemcpyAsync(info + bad[0], &bad[1], sizeof(int), hipMemcpyHostToDevice, stream)
+               != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        if(hipStreamSynchronize(stream) != hipSuccess)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Solves a variable-size batch with the kernels of the back-end. launch(stream, offset)
+ *  launches them, with the offsets of the pivots in the workspace. */
+template <typename Blas, typename T, typename F>
+hipsolverStatus_t hipsolver_vbatched_kernel(hipsolverHandle_t              handle,
+                                            const hipsolver_vbatched_plan& plan,
+                                            T*                             work,
+                                            int                            lwork,
+                                            F                              launch)
+{
+    hipStream_t       stream;
+    hipsolverStatus_t status = hipsolverGetStream(handle, &stream);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(plan.size > 0 && (!work || lwork < 0 || Blas::work_size(lwork, sizeof(T)) < plan.size))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(launch(stream, (int64_t*)work) != hipSuccess)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** FUNCTIONS ********************/
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_vbatched_plan(hipsolverHandle_t        handle,
+                                                hipsolverFillMode_t      uplo,
+                                                const int*               n,
+                                                const int*               lda,
+                                                int                      batch_count,
+                                                hipsolver_vbatched_plan* plan)
+{
+    if(handle && uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    auto query = [&](const hipsolver_vbatched_group& g, int* lwork) {
+        return hipsolver_vbatched_potrf_bufferSize(
+            handle, uplo, g.n, (T**)nullptr, g.lda, lwork, g.count());
+    };
+    return hipsolver_vbatched_build<Blas, T>(
+        handle, n, nullptr, lda, nullptr, batch_count, false, {2, 0, 4, 0}, query, plan);
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_vbatched_bufferSize(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      const int*          n,
+                                                      const int*          lda,
+                                                      int*                lwork,
+                                                      int                 batch_count)
+{
+    if(handle && !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_vbatched_plan plan;
+    hipsolverStatus_t       status
+        = hipsolver_potrf_vbatched_plan<Blas, T>(handle, uplo, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_vbatched_lwork<Blas, T>(plan, lwork);
+}
+
+/*! \brief Cholesky factorizations of the batch_count matrices of orders n[b], whose device
+ *  addresses are in the device array A. n and lda are device arrays. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_potrf_vbatched(hipsolverHandle_t   handle,
+                                           hipsolverFillMode_t uplo,
+                                           const int*          n,
+                                           T* const*           A,
+                                           const int*          lda,
+                                           T*                  work,
+                                           int                 lwork,
+                                           int*                devInfo,
+                                           int                 batch_count)
+{
+    if(handle && batch_count > 0 && (!A || !devInfo))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_vbatched_plan plan;
+    hipsolverStatus_t       status
+        = hipsolver_potrf_vbatched_plan<Blas, T>(handle, uplo, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(plan.kernel)
+        return hipsolver_vbatched_kernel<Blas>(
+            handle, plan, work, lwork, [&](hipStream_t stream, int64_t*) {
+                return Blas::potrf_vbatched(stream, uplo, n, A, lda, devInfo, batch_count);
+            });
+
+    auto launch = [&](const hipsolver_vbatched_group& g,
+                      T**                             gA,
+                      T**,
+                      int*,
+                      int* ginfo,
+                      T*   gwork,
+                      int  glwork) {
+        return hipsolver_vbatched_potrf(
+            handle, uplo, g.n, gA, g.lda, gwork, glwork, ginfo, g.count());
+    };
+    return hipsolver_vbatched_run<Blas>(handle,
+                                        plan,
+                                        A,
+                                        (T* const*)nullptr,
+                                        nullptr,
+                                        false,
+                                        devInfo,
+                                        work,
+                                        lwork,
+                                        launch);
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrf_vbatched_plan(hipsolverHandle_t        handle,
+                                                const int*               n,
+                                                const int*               lda,
+                                                int                      batch_count,
+                                                hipsolver_vbatched_plan* plan)
+{
+    auto query = [&](const hipsolver_vbatched_group& g, int* lwork) {
+        return hipsolver_vbatched_getrf_bufferSize(
+            handle, g.n, (T**)nullptr, g.lda, lwork, g.count());
+    };
+    return hipsolver_vbatched_build<Blas, T>(
+        handle, n, nullptr, lda, nullptr, batch_count, true, {1, 0, 3, 0}, query, plan);
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrf_vbatched_bufferSize(
+    hipsolverHandle_t handle, const int* n, const int* lda, int* lwork, int batch_count)
+{
+    if(handle && !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_vbatched_plan plan;
+    hipsolverStatus_t       status
+        = hipsolver_getrf_vbatched_plan<Blas, T>(handle, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_vbatched_lwork<Blas, T>(plan, lwork);
+}
+
+/*! \brief LU factorizations of the batch_count square matrices of orders n[b], whose device
+ *  addresses are in the device array A. n and lda are device arrays. devIpiv holds the pivots of
+ *  the matrices one after the other, or is null for factorizations without pivoting. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrf_vbatched(hipsolverHandle_t handle,
+                                           const int*        n,
+                                           T* const*         A,
+                                           const int*        lda,
+                                           T*                work,
+                                           int               lwork,
+                                           int*              devIpiv,
+                                           int*              devInfo,
+                                           int               batch_count)
+{
+    if(handle && batch_count > 0 && (!A || !devInfo))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_vbatched_plan plan;
+    hipsolverStatus_t       status
+        = hipsolver_getrf_vbatched_plan<Blas, T>(handle, n, lda, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(plan.kernel)
+        return hipsolver_vbatched_kernel<Blas>(
+            handle, plan, work, lwork, [&](hipStream_t stream, int64_t* offset) {
+                return Blas::getrf_vbatched(
+                    stream, n, A, lda, offset, devIpiv, devInfo, batch_count);
+            });
+
+    auto launch = [&](const hipsolver_vbatched_group& g,
+                      T**                             gA,
+                      T**,
+                      int* gipiv,
+                      int* ginfo,
+                      T*   gwork,
+                      int  glwork) {
+        return hipsolver_vbatched_getrf(
+            handle, g.n, gA, g.lda, gwork, glwork, gipiv, ginfo, g.count());
+    };
+    return hipsolver_vbatched_run<Blas>(handle,
+                                        plan,
+                                        A,
+                                        (T* const*)nullptr,
+                                        devIpiv,
+                                        false,
+                                        devInfo,
+                                        work,
+                                        lwork,
+                                        launch);
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrs_vbatched_plan(hipsolverHandle_t        handle,
+                                                hipsolverOperation_t     trans,
+                                                const int*               n,
+                                                const int*               nrhs,
+                                                const int*               lda,
+                                                const int*               ldb,
+                                                int                      batch_count,
+                                                hipsolver_vbatched_plan* plan)
+{
+    if(handle && trans != HIPSOLVER_OP_N && trans != HIPSOLVER_OP_T && trans != HIPSOLVER_OP_C)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    auto query = [&](const hipsolver_vbatched_group& g, int* lwork) {
+        return hipsolver_vbatched_getrs_bufferSize(handle,
+                                                   trans,
+                                                   g.n,
+                                                   g.nrhs,
+                                                   (T**)nullptr,
+                                                   g.lda,
+                                                   nullptr,
+                                                   (T**)nullptr,
+                                                   g.ldb,
+                                                   lwork,
+                                                   g.count());
+    };
+    return hipsolver_vbatched_build<Blas, T>(
+        handle, n, nrhs, lda, ldb, batch_count, true, {2, 3, 5, 8}, query, plan);
+}
+
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrs_vbatched_bufferSize(hipsolverHandle_t    handle,
+                                                      hipsolverOperation_t trans,
+                                                      const int*           n,
+                                                      const int*           nrhs,
+                                                      const int*           lda,
+                                                      const int*           ldb,
+                                                      int*                 lwork,
+                                                      int                  batch_count)
+{
+    if(handle && !lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_vbatched_plan plan;
+    hipsolverStatus_t       status = hipsolver_getrs_vbatched_plan<Blas, T>(
+        handle, trans, n, nrhs, lda, ldb, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+    return hipsolver_vbatched_lwork<Blas, T>(plan, lwork);
+}
+
+/*! \brief Solves the batch_count systems of orders n[b] with nrhs[b] right-hand sides, given the
+ *  LU factors and pivots computed by the variable-size batched getrf. The device addresses of
+ *  the factors and of the right-hand sides are in the device arrays A and B, and n, nrhs, lda and
+ *  ldb are device arrays. */
+template <typename Blas, typename T>
+hipsolverStatus_t hipsolver_getrs_vbatched(hipsolverHandle_t    handle,
+                                           hipsolverOperation_t trans,
+                                           const int*           n,
+                                           const int*           nrhs,
+                                           T* const*            A,
+                                           const int*           lda,
+                                           int*                 devIpiv,
+                                           T* const*            B,
+                                           const int*           ldb,
+                                           T*                   work,
+                                           int                  lwork,
+                                           int*                 devInfo,
+                                           int                  batch_count)
+{
+    if(handle && batch_count > 0 && (!A || !devIpiv || !B || !devInfo))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver_vbatched_plan plan;
+    hipsolverStatus_t       status = hipsolver_getrs_vbatched_plan<Blas, T>(
+        handle, trans, n, nrhs, lda, ldb, batch_count, &plan);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(plan.kernel)
+        return hipsolver_vbatched_kernel<Blas>(
+            handle, plan, work, lwork, [&](hipStream_t stream, int64_t* offset) {
+                return Blas::getrs_vbatched(stream,
+                                            trans,
+                                            n,
+                                            nrhs,
+                                            A,
+                                            lda,
+                                            offset,
+                                            devIpiv,
+                                            B,
+                                            ldb,
+                                            devInfo,
+                                            batch_count);
+            });
+
+    auto launch = [&](const hipsolver_vbatched_group& g,
+                      T**                             gA,
+                      T**                             gB,
+                      int*                            gipiv,
+                      int*                            ginfo,
+                      T*                              gwork,
+                      int                             glwork) {
+        return hipsolver_vbatched_getrs(handle,
+                                        trans,
+                                        g.n,
+                                        g.nrhs,
+                                        gA,
+                                        g.lda,
+                                        gipiv,
+                                        gB,
+                                        g.ldb,
+                                        gwork,
+                                        glwork,
+                                        ginfo,
+                                        g.count());
+    };
+    return hipsolver_vbatched_run<Blas>(
+        handle, plan, A, B, devIpiv, true, devInfo, work, lwork, launch);
+}
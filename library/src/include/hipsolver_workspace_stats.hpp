@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+/*! \brief Names the outermost public entry point that the calling thread is executing, so that
+ *  the workspace it requests can be attributed to it. Nested entry points, such as the
+ *  bufferSize queries made by functions called without a work array, keep the outer name. */
+class hipsolver_routine_scope
+{
+    static const char*& name()
+    {
+        static thread_local const char* n = nullptr;
+        return n;
+    }
+
+    bool outer;
+
+public:
+    explicit hipsolver_routine_scope(const char* func)
+        : outer(!name())
+    {
+        if(outer)
+            name() = func;
+    }
+
+    ~hipsolver_routine_scope()
+    {
+        if(outer)
+            name() = nullptr;
+    }
+
+    hipsolver_routine_scope(const hipsolver_routine_scope&) = delete;
+    hipsolver_routine_scope& operator=(const hipsolver_routine_scope&) = delete;
+
+    /*! \brief Returns the name of the outermost entry point, or null outside of one. */
+    static const char* current()
+    {
+        return name();
+    }
+};
+
+/*! \brief Statistics of the workspace that functions called without a work array take from
+ *  their handle, since the handle was created or the statistics were reset. */
+struct hipsolver_workspace_stats
+{
+    size_t  peak_size    = 0;
+    size_t  peak_request = 0;
+    int64_t growth_count = 0;
+
+    // the largest request and the number of requests of each entry point
+    std::map<std::string, hipsolverRoutineWorkspace_t> routines;
+
+    hipsolverWorkspaceGrowthCallback_t callback  = nullptr;
+    void*                              user_data = nullptr;
+
+    /*! \brief Records a request of size bytes made by routine, which may be null, and the growth
+     *  of the workspace from old_size to new_size bytes that it caused, if any. */
+    void record(hipsolverHandle_t handle,
+                const char*       routine,
+                size_t            size,
+                size_t            old_size,
+                size_t            new_size)
+    {
+        peak_size    = std::max(peak_size, new_size);
+        peak_request = std::max(peak_request, size);
+        if(routine)
+        {
+            hipsolverRoutineWorkspace_t& r = routines[routine];
+            r.routine                      = routine;
+            r.peak_request                 = std::max(r.peak_request, size);
+            r.calls++;
+        }
+
+        if(new_size > old_size)
+        {
+            growth_count++;
+            if(callback)
+                callback(handle, routine, old_size, new_size, user_data);
+        }
+    }
+
+    /*! \brief Restarts the statistics from a workspace of current_size bytes. */
+    void reset(size_t current_size)
+    {
+        peak_size    = current_size;
+        peak_request = 0;
+        growth_count = 0;
+        routines.clear();
+    }
+
+    /*! \brief Copies the statistics of up to capacity entry points to entries, in decreasing
+     *  order of their largest request. */
+    void copy_routines(hipsolverRoutineWorkspace_t* entries, int capacity) const
+    {
+        std::vector<hipsolverRoutineWorkspace_t> sorted;
+        for(const auto& r : routines)
+            sorted.push_back(r.second);
+        std::stable_sort(sorted.begin(),
+                         sorted.end(),
+                         [](const hipsolverRoutineWorkspace_t& a,
+                            const hipsolverRoutineWorkspace_t& b) {
+                             return a.peak_request > b.peak_request;
+                         });
+
+        int count = std::min(capacity, int(sorted.size()));
+        std::copy(sorted.begin(), sorted.begin() + count, entries);
+    }
+};
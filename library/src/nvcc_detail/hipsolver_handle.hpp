@@ -0,0 +1,476 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_autotune.hpp"
+#include "hipsolver_capture.hpp"
+#include "hipsolver_completion.hpp"
+#include "hipsolver_host.hpp"
+#include "hipsolver_info_log.hpp"
+#include "hipsolver_managed.hpp"
+#include <cublas_v2.h>
+#include <cusolverDn.h>
+#include <cusparse.h>
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/*! \brief Algorithm hints of one function, set by hipsolverSetAdvOptions.
+ *
+ *  The algorithm is also set on the cusolverDnParams_t of the handle, which selects it for the
+ *  64-bit and generic functions. cuSOLVER has no runtime choice of blocking.
+ */
+struct hipsolver_adv_options
+{
+    hipsolverAlgMode_t      algo     = HIPSOLVER_ALG_0;
+    bool                    pivoting = true;
+    hipsolver_host_dispatch host;
+};
+
+struct hipsolver_mg_handle;
+
+/*! \brief hipSOLVER state associated with a cuSOLVER handle created by hipsolverCreate. */
+struct hipsolver_handle_data
+{
+    // cuBLAS handle used by the batched LU functions, created on first use
+    cublasHandle_t blas = nullptr;
+
+    // cuSPARSE handle used by the tridiagonal and pentadiagonal solvers, created on first use
+    cusparseHandle_t sparse = nullptr;
+
+    // parameters of the 64-bit cusolverDnX functions, created on first use
+    cusolverDnParams_t params = nullptr;
+
+    // info values accumulated while info aggregation is enabled
+    hipsolver_info_log info_log;
+
+    // completion event and callback of the solver functions
+    hipsolver_completion completion;
+
+    // algorithm hints of getrf, potrf and syevd
+    hipsolver_adv_options getrf_options;
+    hipsolver_adv_options potrf_options;
+    hipsolver_adv_options syevd_options;
+
+    // autotuning mode; cuSOLVER has no runtime choice of blocking to tune, so it only loads the
+    // cache
+    hipsolver_autotune_setting autotune;
+
+    // prefetching of the managed arguments of each call
+    hipsolver_managed_setting managed_memory;
+
+    // devices over which the batched functions split their batch, if not null, and the event
+    // that orders them after the work enqueued on the stream of the handle
+    hipsolver_mg_handle* device_group = nullptr;
+    hipEvent_t           group_start  = nullptr;
+
+    // workspace budget of the batched functions that solve their batch in chunks, or zero for
+    // none, and the number of problems per chunk of the last of them
+    size_t batch_workspace_limit = 0;
+    int    batch_chunk           = 0;
+
+    hipsolver_handle_data() = default;
+
+    hipsolver_handle_data(const hipsolver_handle_data&) = delete;
+    hipsolver_handle_data& operator=(const hipsolver_handle_data&) = delete;
+
+    ~hipsolver_handle_data()
+    {
+        if(blas)
+            cublasDestroy(blas);
+        if(sparse)
+            cusparseDestroy(sparse);
+        if(params)
+            cusolverDnDestroyParams(params);
+        if(group_start)
+            hipEventDestroy(group_start);
+    }
+};
+
+/*! \brief Fixed-shape call prepared by one of the createPlan functions.
+ *
+ *  Holds the translated arguments of the call and owns a workspace sized when the plan was
+ *  created, so that executing the plan only needs to launch cuSOLVER. The routine is
+ *  identified by the address of its createPlan function, which encodes both the LAPACK routine
+ *  and the precision.
+ */
+struct hipsolver_plan
+{
+    cusolverDnHandle_t handle;
+    void (*routine)();
+
+    cublasFillMode_t  uplo = CUBLAS_FILL_MODE_LOWER;
+    cusolverEigMode_t jobz = CUSOLVER_EIG_MODE_NOVECTOR;
+    int               m    = 0;
+    int               n    = 0;
+    int               lda  = 0;
+
+    // algorithm hints of the handle when the plan was created
+    hipsolver_adv_options options;
+
+    // the workspace, with its size in elements as reported by cuSOLVER
+    void* workspace = nullptr;
+    int   lwork     = 0;
+
+    template <typename F>
+    hipsolver_plan(cusolverDnHandle_t handle, F* func)
+        : handle(handle)
+        , routine(reinterpret_cast<void (*)()>(func))
+    {
+    }
+
+    hipsolver_plan(const hipsolver_plan&) = delete;
+    hipsolver_plan& operator=(const hipsolver_plan&) = delete;
+
+    ~hipsolver_plan()
+    {
+        if(workspace)
+            hipFree(workspace);
+    }
+
+    /*! \brief Returns true if the plan was created by func. */
+    template <typename F>
+    bool is(F* func) const
+    {
+        return routine == reinterpret_cast<void (*)()>(func);
+    }
+
+    /*! \brief Allocates a workspace of lwork elements of size elem_size. */
+    hipError_t allocate(int lwork, size_t elem_size)
+    {
+        hipError_t err = hipMalloc(&workspace, std::max(elem_size * lwork, size_t(1)));
+        if(err != hipSuccess)
+        {
+            workspace = nullptr;
+            return err;
+        }
+
+        this->lwork = lwork;
+        return hipSuccess;
+    }
+};
+
+/*! \brief Maps cuSOLVER handles to their hipSOLVER state.
+ *
+ *  hipsolverHandle_t is the cuSOLVER handle itself, so any additional state is kept here and
+ *  looked up by handle. Handles that were not created by hipsolverCreate have no entry.
+ *
+ *  As on the rocSOLVER side, every thread remembers the last handle that it looked up, which
+ *  stays valid until the next create or destroy advances the generation of the registry.
+ */
+class hipsolver_handle_registry
+{
+    using map_t = std::unordered_map<cusolverDnHandle_t, std::unique_ptr<hipsolver_handle_data>>;
+
+    struct last_lookup
+    {
+        cusolverDnHandle_t     handle     = nullptr;
+        hipsolver_handle_data* data       = nullptr;
+        uint64_t               generation = 0;
+    };
+
+    static std::mutex& mutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+
+    static map_t& map()
+    {
+        static map_t m;
+        return m;
+    }
+
+    static std::atomic<uint64_t>& generation()
+    {
+        static std::atomic<uint64_t> g(1);
+        return g;
+    }
+
+    static last_lookup& last()
+    {
+        static thread_local last_lookup l;
+        return l;
+    }
+
+public:
+    /*! \brief Registers handle; its state is allocated by the first lookup. */
+    static void create(cusolverDnHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        map()[handle].reset();
+        generation()++;
+    }
+
+    static void destroy(cusolverDnHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        map().erase(handle);
+        generation()++;
+    }
+
+    static hipsolver_handle_data* get(cusolverDnHandle_t handle)
+    {
+        last_lookup& l = last();
+        uint64_t     g = generation().load(std::memory_order_acquire);
+        if(l.handle == handle && l.generation == g)
+            return l.data;
+
+        std::lock_guard<std::mutex> lock(mutex());
+        auto it = map().find(handle);
+        if(it != map().end() && !it->second)
+            it->second.reset(new hipsolver_handle_data);
+        l.handle     = handle;
+        l.data       = it != map().end() ? it->second.get() : nullptr;
+        l.generation = generation().load(std::memory_order_relaxed);
+        return l.data;
+    }
+};
+
+/*! \brief Returns the cuBLAS handle of handle, bound to the same stream as the cuSOLVER handle.
+ *
+ *  Creating the cuBLAS handle allocates device memory, so the first call cannot be made while
+ *  the stream is being captured.
+ */
+inline cublasStatus_t hipsolver_cublas_handle(cusolverDnHandle_t handle, cublasHandle_t* blas)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return CUBLAS_STATUS_NOT_INITIALIZED;
+
+    hipStream_t stream;
+    if(cusolverDnGetStream(handle, &stream) != CUSOLVER_STATUS_SUCCESS)
+        return CUBLAS_STATUS_NOT_INITIALIZED;
+
+    if(!data->blas)
+    {
+        hipsolver_forbid_capture(stream);
+        cublasStatus_t status = cublasCreate(&data->blas);
+        if(status != CUBLAS_STATUS_SUCCESS)
+        {
+            data->blas = nullptr;
+            return status;
+        }
+    }
+
+    *blas = data->blas;
+    return cublasSetStream(data->blas, stream);
+}
+
+/*! \brief Returns the cuSPARSE handle of handle, bound to the same stream as the cuSOLVER handle.
+ *
+ *  Creating the cuSPARSE handle allocates device memory, so the first call cannot be made while
+ *  the stream is being captured.
+ */
+inline cusparseStatus_t hipsolver_cusparse_handle(cusolverDnHandle_t handle,
+                                                  cusparseHandle_t*  sparse)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return CUSPARSE_STATUS_NOT_INITIALIZED;
+
+    hipStream_t stream;
+    if(cusolverDnGetStream(handle, &stream) != CUSOLVER_STATUS_SUCCESS)
+        return CUSPARSE_STATUS_NOT_INITIALIZED;
+
+    if(!data->sparse)
+    {
+        hipsolver_forbid_capture(stream);
+        cusparseStatus_t status = cusparseCreate(&data->sparse);
+        if(status != CUSPARSE_STATUS_SUCCESS)
+        {
+            data->sparse = nullptr;
+            return status;
+        }
+    }
+
+    *sparse = data->sparse;
+    return cusparseSetStream(data->sparse, stream);
+}
+
+/*! \brief Returns the cusolverDnParams_t used by the 64-bit functions of handle. */
+inline cusolverStatus_t hipsolver_dn_params(cusolverDnHandle_t handle, cusolverDnParams_t* params)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+
+    if(!data->params)
+    {
+        cusolverStatus_t status = cusolverDnCreateParams(&data->params);
+        if(status != CUSOLVER_STATUS_SUCCESS)
+        {
+            data->params = nullptr;
+            return status;
+        }
+    }
+
+    *params = data->params;
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Returns the algorithm hints of function in data, or null if function has none. */
+inline hipsolver_adv_options* hipsolver_find_adv_options(hipsolver_handle_data* data,
+                                                         hipsolverDnFunction_t  function)
+{
+    switch(function)
+    {
+    case HIPSOLVERDN_GETRF:
+        return &data->getrf_options;
+    case HIPSOLVERDN_POTRF:
+        return &data->potrf_options;
+    case HIPSOLVERDN_SYEVD:
+        return &data->syevd_options;
+    default:
+        return nullptr;
+    }
+}
+
+/*! \brief Returns the algorithm hints of function on handle, or the defaults if handle has no
+ *  hipSOLVER state. */
+inline hipsolver_adv_options hipsolver_get_adv_options(cusolverDnHandle_t    handle,
+                                                       hipsolverDnFunction_t function)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return hipsolver_adv_options();
+
+    hipsolver_adv_options* options = hipsolver_find_adv_options(data, function);
+    return options ? *options : hipsolver_adv_options();
+}
+
+/*! \brief Returns the host dispatch state of function on handle, or null if handle has no
+ *  hipSOLVER state. */
+inline hipsolver_host_dispatch* hipsolver_get_host_dispatch(cusolverDnHandle_t    handle,
+                                                            hipsolverDnFunction_t function)
+{
+    hipsolver_handle_data* data = hipsolver_handle_registry::get(handle);
+    if(!data)
+        return nullptr;
+
+    hipsolver_adv_options* options = hipsolver_find_adv_options(data, function);
+    return options ? &options->host : nullptr;
+}
+
+/*! \brief Number of elements of type T needed to hold count device pointers in a workspace. */
+template <typename T>
+inline int hipsolver_pointer_array_size(int count)
+{
+    return count > 0 ? int((count * sizeof(T*) + sizeof(T) - 1) / sizeof(T)) : 0;
+}
+
+/*! \brief Writes the addresses of the matrices of a strided batch to the device array Aarray.
+ *
+ *  The copy is enqueued on stream. As the source is pageable host memory, it has been consumed
+ *  by the time this function returns, and it cannot be recorded by a stream capture.
+ */
+template <typename T>
+inline hipError_t hipsolver_strided_to_pointers(
+    hipStream_t stream, T** Aarray, T* A, int strideA, int batch_count)
+{
+    hipsolver_forbid_capture(stream);
+
+    std::vector<T*> ptrs(batch_count);
+    for(int b = 0; b < batch_count; ++b)
+        ptrs[b] = A + size_t(b) * strideA;
+
+    return hipMemcpyAsync(
+        Aarray, ptrs.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice, stream);
+}
+
+/*! \brief Copies the device array of matrix addresses Aarray to the host vector ptrs.
+ *
+ *  The copy is enqueued on stream, and the stream is synchronized before returning.
+ */
+template <typename T>
+inline hipError_t hipsolver_pointers_to_host(hipStream_t      stream,
+                                             T* const         Aarray[],
+                                             int              batch_count,
+                                             std::vector<T*>& ptrs)
+{
+    hipsolver_forbid_capture(stream);
+
+    ptrs.resize(batch_count);
+    if(batch_count == 0)
+        return hipSuccess;
+
+    hipError_t err = hipMemcpyAsync(
+        ptrs.data(), Aarray, sizeof(T*) * batch_count, hipMemcpyDeviceToHost, stream);
+    if(err != hipSuccess)
+        return err;
+
+    return hipStreamSynchronize(stream);
+}
+
+/*! \brief Writes the addresses of column j of the matrices in ptrs to the device array Bcol.
+ *
+ *  The copy is enqueued on stream. As the source is pageable host memory, it has been consumed
+ *  by the time this function returns, and it cannot be recorded by a stream capture.
+ */
+template <typename T>
+inline hipError_t hipsolver_column_pointers(
+    hipStream_t stream, T** Bcol, const std::vector<T*>& ptrs, int j, int ldb)
+{
+    hipsolver_forbid_capture(stream);
+
+    int             batch_count = int(ptrs.size());
+    std::vector<T*> cols(batch_count);
+    for(int b = 0; b < batch_count; ++b)
+        cols[b] = ptrs[b] + size_t(j) * ldb;
+
+    return hipMemcpyAsync(
+        Bcol, cols.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice, stream);
+}
+
+/*! \brief Number of elements of type T needed to hold count 64-bit pivot indices in a
+ *  workspace.
+ */
+template <typename T>
+inline int hipsolver_pivot64_array_size(int count)
+{
+    return count > 0 ? int((count * sizeof(int64_t) + sizeof(T) - 1) / sizeof(T)) : 0;
+}
+
+/*! \brief Writes the 32-bit pivot indices ipiv to the device array ipiv64 as 64-bit integers.
+ *
+ *  The conversion is done on the host. The stream is synchronized to read the pivots back, so
+ *  it cannot be recorded by a stream capture.
+ */
+inline hipError_t
+    hipsolver_pivots_to_64(hipStream_t stream, int64_t* ipiv64, const int* ipiv, int n)
+{
+    hipsolver_forbid_capture(stream);
+
+    if(n <= 0)
+        return hipSuccess;
+
+    std::vector<int> p32(n);
+    hipError_t       err
+        = hipMemcpyAsync(p32.data(), ipiv, sizeof(int) * n, hipMemcpyDeviceToHost, stream);
+    if(err != hipSuccess)
+        return err;
+    err = hipStreamSynchronize(stream);
+    if(err != hipSuccess)
+        return err;
+
+    std::vector<int64_t> p64(p32.begin(), p32.end());
+    return hipMemcpyAsync(ipiv64, p64.data(), sizeof(int64_t) * n, hipMemcpyHostToDevice, stream);
+}
+
+// largest order supported by the batched Jacobi eigensolvers of cuSOLVER
+constexpr int hipsolver_syevj_batched_max_n = 32;
+
+/*! \brief Returns true if a strided batch of eigenproblems can be given to syevjBatched,
+ *  which requires small matrices and eigenvalues stored contiguously.
+ */
+inline bool hipsolver_use_syevj_batched(int n, int lda, int strideA, int strideD)
+{
+    return n <= hipsolver_syevj_batched_max_n && int64_t(strideA) == int64_t(lda) * n
+           && strideD == n;
+}
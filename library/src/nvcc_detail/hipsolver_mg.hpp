@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cublas_v2.h>
+#include <cusolverDn.h>
+#ifdef HIPSOLVER_HAVE_CUSOLVERMG
+#include <cusolverMg.h>
+#endif
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <vector>
+
+/*
+ * Multi-GPU solvers.
+ *
+ * cuSOLVERMg distributes matrices in the same 1D block-cyclic column layout as the rocSOLVER
+ * backend, so the hipsolverMg functions forward to it with IA = JA = 1. cuSOLVERMg is optional:
+ * when hipSOLVER is built without it (HIPSOLVER_HAVE_CUSOLVERMG undefined), the handles and
+ * descriptors only serve the batched functions of device groups.
+ */
+
+/*! \brief Handles and stream of one of the devices selected by hipsolverMgDeviceSelect, used by
+    the batched functions of the handles that have the devices as their device group. */
+struct hipsolver_mg_device
+{
+    int                id     = 0;
+    cusolverDnHandle_t handle = nullptr;
+    cublasHandle_t     blas   = nullptr;
+    hipStream_t        stream = nullptr;
+    hipEvent_t         done   = nullptr; // recorded once the slice of a batch is enqueued
+};
+
+struct hipsolver_mg_handle
+{
+#ifdef HIPSOLVER_HAVE_CUSOLVERMG
+    cusolverMgHandle_t handle = nullptr;
+#endif
+    std::vector<int>                 devices;
+    std::vector<hipsolver_mg_device> batch_devices;
+
+    hipsolver_mg_handle() = default;
+    ~hipsolver_mg_handle()
+    {
+        release_batch_devices();
+#ifdef HIPSOLVER_HAVE_CUSOLVERMG
+        if(handle)
+            cusolverMgDestroy(handle);
+#endif
+    }
+
+    hipsolver_mg_handle(const hipsolver_mg_handle&) = delete;
+    hipsolver_mg_handle& operator=(const hipsolver_mg_handle&) = delete;
+
+    void release_batch_devices()
+    {
+        int current;
+        hipGetDevice(&current);
+        for(hipsolver_mg_device& dev : batch_devices)
+        {
+            hipSetDevice(dev.id);
+            if(dev.handle)
+                cusolverDnDestroy(dev.handle);
+            if(dev.blas)
+                cublasDestroy(dev.blas);
+            if(dev.stream)
+                hipStreamDestroy(dev.stream);
+            if(dev.done)
+                hipEventDestroy(dev.done);
+        }
+        batch_devices.clear();
+        hipSetDevice(current);
+    }
+
+    /*! \brief Creates the handles, the stream and the event of each of the selected devices. */
+    bool select_batch_devices()
+    {
+        release_batch_devices();
+
+        int current;
+        if(hipGetDevice(&current) != hipSuccess)
+            return false;
+
+        bool ok = true;
+        batch_devices.resize(devices.size());
+        for(size_t d = 0; d < devices.size() && ok; d++)
+        {
+            hipsolver_mg_device& dev = batch_devices[d];
+            dev.id                   = devices[d];
+            ok = hipSetDevice(dev.id) == hipSuccess
+                 && hipStreamCreateWithFlags(&dev.stream, hipStreamNonBlocking) == hipSuccess
+                 && hipEventCreateWithFlags(&dev.done, hipEventDisableTiming) == hipSuccess
+                 && cusolverDnCreate(&dev.handle) == CUSOLVER_STATUS_SUCCESS
+                 && cusolverDnSetStream(dev.handle, dev.stream) == CUSOLVER_STATUS_SUCCESS
+                 && cublasCreate(&dev.blas) == CUBLAS_STATUS_SUCCESS
+                 && cublasSetStream(dev.blas, dev.stream) == CUBLAS_STATUS_SUCCESS;
+        }
+
+        hipSetDevice(current);
+        if(!ok)
+            release_batch_devices();
+        return ok;
+    }
+};
+
+/*! \brief Layout of a distributed matrix.
+
+    cuSOLVERMg descriptors also fix the data type of the matrix, so one is created for each data
+    type that the layout is used with. */
+struct hipsolver_mg_desc
+{
+    int64_t rows;
+    int64_t cols;
+    int64_t nb;
+#ifdef HIPSOLVER_HAVE_CUSOLVERMG
+    cudaLibMgGrid_t                               grid = nullptr;
+    std::map<cudaDataType, cudaLibMgMatrixDesc_t> descs;
+#endif
+
+    hipsolver_mg_desc(int64_t rows, int64_t cols, int64_t nb)
+        : rows(rows)
+        , cols(cols)
+        , nb(nb)
+    {
+    }
+
+    ~hipsolver_mg_desc()
+    {
+#ifdef HIPSOLVER_HAVE_CUSOLVERMG
+        for(auto& desc : descs)
+            cusolverMgDestroyMatrixDesc(desc.second);
+        if(grid)
+            cusolverMgDestroyGrid(grid);
+#endif
+    }
+
+    hipsolver_mg_desc(const hipsolver_mg_desc&) = delete;
+    hipsolver_mg_desc& operator=(const hipsolver_mg_desc&) = delete;
+
+#ifdef HIPSOLVER_HAVE_CUSOLVERMG
+    cusolverStatus_t get(cudaDataType type, cudaLibMgMatrixDesc_t* desc)
+    {
+        auto it = descs.find(type);
+        if(it == descs.end())
+        {
+            cudaLibMgMatrixDesc_t created;
+            cusolverStatus_t      status
+                = cusolverMgCreateMatrixDesc(&created, rows, cols, rows, nb, type, grid);
+            if(status != CUSOLVER_STATUS_SUCCESS)
+                return status;
+            it = descs.emplace(type, created).first;
+        }
+
+        *desc = it->second;
+        return CUSOLVER_STATUS_SUCCESS;
+    }
+#endif
+};
@@ -0,0 +1,542 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipsolver_capture.hpp"
+#include <algorithm>
+#include <climits>
+#include <cublas_v2.h>
+#include <cusolverDn.h>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+/*
+ * Generalized eigensolvers with a factored B.
+ *
+ * cuSOLVER does not expose sygst/hegst, so the reduction to standard form is done with cuBLAS
+ * triangular solves or products on a full copy of A, made with symm/hemm against the identity.
+ * The reduced matrix is then solved with syevd/heevd and its eigenvectors are back-transformed
+ * into A. The matrices of a batch are processed one at a time.
+ */
+
+/******************** CUSOLVER AND CUBLAS DISPATCH ********************/
+inline cusolverStatus_t hipsolver_cublas2cuda_status(cublasStatus_t status)
+{
+    switch(status)
+    {
+    case CUBLAS_STATUS_SUCCESS:
+        return CUSOLVER_STATUS_SUCCESS;
+    case CUBLAS_STATUS_NOT_INITIALIZED:
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+    case CUBLAS_STATUS_ALLOC_FAILED:
+        return CUSOLVER_STATUS_ALLOC_FAILED;
+    case CUBLAS_STATUS_INVALID_VALUE:
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    case CUBLAS_STATUS_ARCH_MISMATCH:
+        return CUSOLVER_STATUS_ARCH_MISMATCH;
+    case CUBLAS_STATUS_EXECUTION_FAILED:
+        return CUSOLVER_STATUS_EXECUTION_FAILED;
+    default:
+        return CUSOLVER_STATUS_INTERNAL_ERROR;
+    }
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd_bufferSize(cusolverDnHandle_t handle,
+                                                         cusolverEigMode_t  jobz,
+                                                         cublasFillMode_t   uplo,
+                                                         int                n,
+                                                         const float*       A,
+                                                         int                lda,
+                                                         const float*       D,
+                                                         int*               lwork)
+{
+    return cusolverDnSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd_bufferSize(cusolverDnHandle_t handle,
+                                                         cusolverEigMode_t  jobz,
+                                                         cublasFillMode_t   uplo,
+                                                         int                n,
+                                                         const double*      A,
+                                                         int                lda,
+                                                         const double*      D,
+                                                         int*               lwork)
+{
+    return cusolverDnDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd_bufferSize(cusolverDnHandle_t handle,
+                                                         cusolverEigMode_t  jobz,
+                                                         cublasFillMode_t   uplo,
+                                                         int                n,
+                                                         const cuComplex*   A,
+                                                         int                lda,
+                                                         const float*       D,
+                                                         int*               lwork)
+{
+    return cusolverDnCheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd_bufferSize(cusolverDnHandle_t     handle,
+                                                         cusolverEigMode_t      jobz,
+                                                         cublasFillMode_t       uplo,
+                                                         int                    n,
+                                                         const cuDoubleComplex* A,
+                                                         int                    lda,
+                                                         const double*          D,
+                                                         int*                   lwork)
+{
+    return cusolverDnZheevd_bufferSize(handle, jobz, uplo, n, A, lda, D, lwork);
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd(cusolverDnHandle_t handle,
+                                              cusolverEigMode_t  jobz,
+                                              cublasFillMode_t   uplo,
+                                              int                n,
+                                              float*             A,
+                                              int                lda,
+                                              float*             D,
+                                              float*             work,
+                                              int                lwork,
+                                              int*               info)
+{
+    return cusolverDnSsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd(cusolverDnHandle_t handle,
+                                              cusolverEigMode_t  jobz,
+                                              cublasFillMode_t   uplo,
+                                              int                n,
+                                              double*            A,
+                                              int                lda,
+                                              double*            D,
+                                              double*            work,
+                                              int                lwork,
+                                              int*               info)
+{
+    return cusolverDnDsyevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd(cusolverDnHandle_t handle,
+                                              cusolverEigMode_t  jobz,
+                                              cublasFillMode_t   uplo,
+                                              int                n,
+                                              cuComplex*         A,
+                                              int                lda,
+                                              float*             D,
+                                              cuComplex*         work,
+                                              int                lwork,
+                                              int*               info)
+{
+    return cusolverDnCheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+}
+
+inline cusolverStatus_t hipsolver_sygvd_syevd(cusolverDnHandle_t handle,
+                                              cusolverEigMode_t  jobz,
+                                              cublasFillMode_t   uplo,
+                                              int                n,
+                                              cuDoubleComplex*   A,
+                                              int                lda,
+                                              double*            D,
+                                              cuDoubleComplex*   work,
+                                              int                lwork,
+                                              int*               info)
+{
+    return cusolverDnZheevd(handle, jobz, uplo, n, A, lda, D, work, lwork, info);
+}
+
+/*! \brief Computes F = A, given A in the uplo triangle, by multiplying it by the identity W. */
+inline cublasStatus_t hipsolver_sygvd_full(cublasHandle_t   blas,
+                                           cublasFillMode_t uplo,
+                                           int              n,
+                                           const float*     A,
+                                           int              lda,
+                                           const float*     W,
+                                           float*           F)
+{
+    float one = 1, zero = 0;
+    return cublasSsymm(blas, CUBLAS_SIDE_LEFT, uplo, n, n, &one, A, lda, W, n, &zero, F, n);
+}
+
+/*! \brief Computes F = A, given A in the uplo triangle, by multiplying it by the identity W. */
+inline cublasStatus_t hipsolver_sygvd_full(cublasHandle_t   blas,
+                                           cublasFillMode_t uplo,
+                                           int              n,
+                                           const double*    A,
+                                           int              lda,
+                                           const double*    W,
+                                           double*          F)
+{
+    double one = 1, zero = 0;
+    return cublasDsymm(blas, CUBLAS_SIDE_LEFT, uplo, n, n, &one, A, lda, W, n, &zero, F, n);
+}
+
+/*! \brief Computes F = A, given A in the uplo triangle, by multiplying it by the identity W. */
+inline cublasStatus_t hipsolver_sygvd_full(cublasHandle_t   blas,
+                                           cublasFillMode_t uplo,
+                                           int              n,
+                                           const cuComplex* A,
+                                           int              lda,
+                                           const cuComplex* W,
+                                           cuComplex*       F)
+{
+    cuComplex one = {1, 0}, zero = {0, 0};
+    return cublasChemm(blas, CUBLAS_SIDE_LEFT, uplo, n, n, &one, A, lda, W, n, &zero, F, n);
+}
+
+/*! \brief Computes F = A, given A in the uplo triangle, by multiplying it by the identity W. */
+inline cublasStatus_t hipsolver_sygvd_full(cublasHandle_t         blas,
+                                           cublasFillMode_t       uplo,
+                                           int                    n,
+                                           const cuDoubleComplex* A,
+                                           int                    lda,
+                                           const cuDoubleComplex* W,
+                                           cuDoubleComplex*       F)
+{
+    cuDoubleComplex one = {1, 0}, zero = {0, 0};
+    return cublasZhemm(blas, CUBLAS_SIDE_LEFT, uplo, n, n, &one, A, lda, W, n, &zero, F, n);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trsm(cublasHandle_t    blas,
+                                           cublasSideMode_t  side,
+                                           cublasFillMode_t  uplo,
+                                           cublasOperation_t trans,
+                                           int               n,
+                                           const float*      B,
+                                           int               ldb,
+                                           float*            A,
+                                           int               lda)
+{
+    float one = 1;
+    return cublasStrsm(blas, side, uplo, trans, CUBLAS_DIAG_NON_UNIT, n, n, &one, B, ldb, A, lda);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trsm(cublasHandle_t    blas,
+                                           cublasSideMode_t  side,
+                                           cublasFillMode_t  uplo,
+                                           cublasOperation_t trans,
+                                           int               n,
+                                           const double*     B,
+                                           int               ldb,
+                                           double*           A,
+                                           int               lda)
+{
+    double one = 1;
+    return cublasDtrsm(blas, side, uplo, trans, CUBLAS_DIAG_NON_UNIT, n, n, &one, B, ldb, A, lda);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trsm(cublasHandle_t    blas,
+                                           cublasSideMode_t  side,
+                                           cublasFillMode_t  uplo,
+                                           cublasOperation_t trans,
+                                           int               n,
+                                           const cuComplex*  B,
+                                           int               ldb,
+                                           cuComplex*        A,
+                                           int               lda)
+{
+    cuComplex one = {1, 0};
+    return cublasCtrsm(blas, side, uplo, trans, CUBLAS_DIAG_NON_UNIT, n, n, &one, B, ldb, A, lda);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trsm(cublasHandle_t         blas,
+                                           cublasSideMode_t       side,
+                                           cublasFillMode_t       uplo,
+                                           cublasOperation_t      trans,
+                                           int                    n,
+                                           const cuDoubleComplex* B,
+                                           int                    ldb,
+                                           cuDoubleComplex*       A,
+                                           int                    lda)
+{
+    cuDoubleComplex one = {1, 0};
+    return cublasZtrsm(blas, side, uplo, trans, CUBLAS_DIAG_NON_UNIT, n, n, &one, B, ldb, A, lda);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trmm(cublasHandle_t    blas,
+                                           cublasSideMode_t  side,
+                                           cublasFillMode_t  uplo,
+                                           cublasOperation_t trans,
+                                           int               n,
+                                           const float*      B,
+                                           int               ldb,
+                                           float*            A,
+                                           int               lda)
+{
+    float one = 1;
+
+    // A is updated in place
+    return cublasStrmm(blas,
+                       side,
+                       uplo,
+                       trans,
+                       CUBLAS_DIAG_NON_UNIT,
+                       n,
+                       n,
+                       &one,
+                       B,
+                       ldb,
+                       A,
+                       lda,
+                       A,
+                       lda);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trmm(cublasHandle_t    blas,
+                                           cublasSideMode_t  side,
+                                           cublasFillMode_t  uplo,
+                                           cublasOperation_t trans,
+                                           int               n,
+                                           const double*     B,
+                                           int               ldb,
+                                           double*           A,
+                                           int               lda)
+{
+    double one = 1;
+
+    // A is updated in place
+    return cublasDtrmm(blas,
+                       side,
+                       uplo,
+                       trans,
+                       CUBLAS_DIAG_NON_UNIT,
+                       n,
+                       n,
+                       &one,
+                       B,
+                       ldb,
+                       A,
+                       lda,
+                       A,
+                       lda);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trmm(cublasHandle_t    blas,
+                                           cublasSideMode_t  side,
+                                           cublasFillMode_t  uplo,
+                                           cublasOperation_t trans,
+                                           int               n,
+                                           const cuComplex*  B,
+                                           int               ldb,
+                                           cuComplex*        A,
+                                           int               lda)
+{
+    cuComplex one = {1, 0};
+
+    // A is updated in place
+    return cublasCtrmm(blas,
+                       side,
+                       uplo,
+                       trans,
+                       CUBLAS_DIAG_NON_UNIT,
+                       n,
+                       n,
+                       &one,
+                       B,
+                       ldb,
+                       A,
+                       lda,
+                       A,
+                       lda);
+}
+
+inline cublasStatus_t hipsolver_sygvd_trmm(cublasHandle_t         blas,
+                                           cublasSideMode_t       side,
+                                           cublasFillMode_t       uplo,
+                                           cublasOperation_t      trans,
+                                           int                    n,
+                                           const cuDoubleComplex* B,
+                                           int                    ldb,
+                                           cuDoubleComplex*       A,
+                                           int                    lda)
+{
+    cuDoubleComplex one = {1, 0};
+
+    // A is updated in place
+    return cublasZtrmm(blas,
+                       side,
+                       uplo,
+                       trans,
+                       CUBLAS_DIAG_NON_UNIT,
+                       n,
+                       n,
+                       &one,
+                       B,
+                       ldb,
+                       A,
+                       lda,
+                       A,
+                       lda);
+}
+
+/******************** SYGVD_FACTORED ********************/
+/*! \brief Operation applied to the factor of B from the left when reducing the problem.
+
+    For itype 1 the reduced matrix is inv(L) * A * inv(L') or inv(U') * A * inv(U), and for
+    itype 2 and 3 it is L' * A * L or U * A * U'. The operation from the right is the opposite
+    one. */
+inline cublasOperation_t hipsolver_sygvd_reduce_op(cusolverEigType_t itype, cublasFillMode_t uplo)
+{
+    bool lower = uplo == CUBLAS_FILL_MODE_LOWER;
+    return lower == (itype == CUSOLVER_EIG_TYPE_1) ? CUBLAS_OP_N : CUBLAS_OP_C;
+}
+
+/*! \brief Operation applied to the factor of B when back-transforming the eigenvectors.
+
+    The back-transform is X = inv(L') * Z or X = inv(U) * Z for itype 1 and 2, and X = L * Z or
+    X = U' * Z for itype 3. */
+inline cublasOperation_t hipsolver_sygvd_back_op(cusolverEigType_t itype, cublasFillMode_t uplo)
+{
+    bool lower = uplo == CUBLAS_FILL_MODE_LOWER;
+    return lower == (itype == CUSOLVER_EIG_TYPE_3) ? CUBLAS_OP_N : CUBLAS_OP_C;
+}
+
+/*! \brief Workspace in elements of hipsolver_sygvd_factored: the full copy of A and the identity,
+    followed by the syevd/heevd workspace. */
+template <typename T, typename S>
+inline cusolverStatus_t hipsolver_sygvd_factored_bufferSize(cusolverDnHandle_t handle,
+                                                            cusolverEigMode_t  jobz,
+                                                            cublasFillMode_t   uplo,
+                                                            int                n,
+                                                            const T*           A,
+                                                            const S*           D,
+                                                            int*               lwork)
+{
+    if(n < 0)
+        return CUSOLVER_STATUS_INVALID_VALUE;
+
+    int              lsyevd;
+    cusolverStatus_t status
+        = hipsolver_sygvd_syevd_bufferSize(handle, jobz, uplo, n, A, std::max(1, n), D, &lsyevd);
+    if(status != CUSOLVER_STATUS_SUCCESS)
+        return status;
+
+    int64_t sz = 2 * int64_t(n) * n + lsyevd;
+    if(sz > INT_MAX)
+        return CUSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = int(sz);
+    return CUSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Solves the generalized eigenproblems of a strided batch given the Cholesky factors of
+    their B matrices, as computed by potrf with the same uplo.
+
+    The first 2 * n * n elements of work hold temporary matrices, and the rest is given to
+    syevd/heevd. The factors are not modified. The identity is written from host memory, so the
+    function cannot be captured. */
+template <typename T, typename S>
+cusolverStatus_t hipsolver_sygvd_factored(cusolverDnHandle_t handle,
+                                          cublasHandle_t     blas,
+                                          cusolverEigType_t  itype,
+                                          cusolverEigMode_t  jobz,
+                                          cublasFillMode_t   uplo,
+                                          int                n,
+                                          T*                 A,
+                                          int                lda,
+                                          int                strideA,
+                                          T*                 B,
+                                          int                ldb,
+                                          int                strideB,
+                                          S*                 D,
+                                          int                strideD,
+                                          T*                 work,
+                                          int                lwork,
+                                          int*               devInfo,
+                                          int                batch_count)
+{
+    if(n < 0 || lda < std::max(1, n) || ldb < std::max(1, n) || batch_count < 0)
+        return CUSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    if(cusolverDnGetStream(handle, &stream) != CUSOLVER_STATUS_SUCCESS)
+        return CUSOLVER_STATUS_NOT_INITIALIZED;
+
+    if(batch_count == 0)
+        return CUSOLVER_STATUS_SUCCESS;
+    if(n == 0)
+    {
+        if(hipMemsetAsync(devInfo, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+            return CUSOLVER_STATUS_INTERNAL_ERROR;
+        return CUSOLVER_STATUS_SUCCESS;
+    }
+
+    size_t nn = size_t(n) * n;
+    if(!work || lwork < 2 * int64_t(nn))
+        return CUSOLVER_STATUS_INVALID_VALUE;
+    int lsyevd = int(lwork - 2 * int64_t(nn));
+
+    T* F = work;
+    T* W = F + nn;
+    work = W + nn;
+
+    // W = I
+    hipsolver_forbid_capture(stream);
+    std::vector<S> ones(n * (sizeof(T) / sizeof(S)), S(0));
+    for(int i = 0; i < n; i++)
+        ones[i * (sizeof(T) / sizeof(S))] = S(1);
+    if(hipMemsetAsync(W, 0, sizeof(T) * nn, stream) != hipSuccess
+       || hipMemcpy2DAsync(W,
+                           sizeof(T) * (n + 1),
+                           ones.data(),
+                           sizeof(T),
+                           sizeof(T),
+                           n,
+                           hipMemcpyHostToDevice,
+                           stream)
+              != hipSuccess)
+        return CUSOLVER_STATUS_INTERNAL_ERROR;
+
+    cublasOperation_t left  = hipsolver_sygvd_reduce_op(itype, uplo);
+    cublasOperation_t right = left == CUBLAS_OP_N ? CUBLAS_OP_C : CUBLAS_OP_N;
+    cublasOperation_t back  = hipsolver_sygvd_back_op(itype, uplo);
+    bool              solve = itype == CUSOLVER_EIG_TYPE_1;
+
+    for(int b = 0; b < batch_count; ++b)
+    {
+        T* Ab = A + size_t(b) * strideA;
+        T* Bb = B + size_t(b) * strideB;
+
+        cublasStatus_t bstatus = hipsolver_sygvd_full(blas, uplo, n, Ab, lda, W, F);
+        if(bstatus == CUBLAS_STATUS_SUCCESS && solve)
+            bstatus = hipsolver_sygvd_trsm(blas, CUBLAS_SIDE_LEFT, uplo, left, n, Bb, ldb, F, n);
+        if(bstatus == CUBLAS_STATUS_SUCCESS && solve)
+            bstatus = hipsolver_sygvd_trsm(blas, CUBLAS_SIDE_RIGHT, uplo, right, n, Bb, ldb, F, n);
+        if(bstatus == CUBLAS_STATUS_SUCCESS && !solve)
+            bstatus = hipsolver_sygvd_trmm(blas, CUBLAS_SIDE_LEFT, uplo, left, n, Bb, ldb, F, n);
+        if(bstatus == CUBLAS_STATUS_SUCCESS && !solve)
+            bstatus = hipsolver_sygvd_trmm(blas, CUBLAS_SIDE_RIGHT, uplo, right, n, Bb, ldb, F, n);
+        if(bstatus != CUBLAS_STATUS_SUCCESS)
+            return hipsolver_cublas2cuda_status(bstatus);
+
+        cusolverStatus_t status = hipsolver_sygvd_syevd(
+            handle, jobz, uplo, n, F, n, D + size_t(b) * strideD, work, lsyevd, devInfo + b);
+        if(status != CUSOLVER_STATUS_SUCCESS)
+            return status;
+
+        if(jobz == CUSOLVER_EIG_MODE_NOVECTOR)
+            continue;
+
+        if(hipMemcpy2DAsync(Ab,
+                            sizeof(T) * lda,
+                            F,
+                            sizeof(T) * n,
+                            sizeof(T) * n,
+                            n,
+                            hipMemcpyDeviceToDevice,
+                            stream)
+           != hipSuccess)
+            return CUSOLVER_STATUS_INTERNAL_ERROR;
+
+        if(itype == CUSOLVER_EIG_TYPE_3)
+            bstatus = hipsolver_sygvd_trmm(blas, CUBLAS_SIDE_LEFT, uplo, back, n, Bb, ldb, Ab, lda);
+        else
+            bstatus = hipsolver_sygvd_trsm(blas, CUBLAS_SIDE_LEFT, uplo, back, n, Bb, ldb, Ab, lda);
+        if(bstatus != CUBLAS_STATUS_SUCCESS)
+            return hipsolver_cublas2cuda_status(bstatus);
+    }
+
+    return CUSOLVER_STATUS_SUCCESS;
+}